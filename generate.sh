@@ -16,7 +16,8 @@ echo -e "\033[32mLCM -> Python done\033[0m"
 
 # Generate C++ bindings
 rm -rf "$SCRIPT_DIR/generated/cpp_lcm_msgs"
-"$SCRIPT_DIR/sources/lcm_to_generated.sh" -cpp "$SCRIPT_DIR/lcm_types" -o "$SCRIPT_DIR/generated/cpp_lcm_msgs"
+# Message classes, companion headers (std::pmr, structure-of-arrays, copy-on-write and interned flavors, zero-copy views, ...) and the dimos_lcm/ runtime they use
+python3 "$SCRIPT_DIR/tools/cpp/gen/lcm_cpp.py" -q -o "$SCRIPT_DIR/generated/cpp_lcm_msgs" "$SCRIPT_DIR/lcm_types"/*.lcm
 echo -e "\033[32mLCM -> C++ done\033[0m"
 
 # Generate C# bindings
@@ -1,7 +1,7 @@
 /** THIS IS AN AUTOMATICALLY GENERATED FILE.  DO NOT MODIFY
  * BY HAND!!
  *
- * Generated by lcm-gen 1.5.2
+ * Generated by lcm-cpp (tools/cpp/gen)
  **/
 
 #ifndef __actionlib_msgs_GoalID_hpp__
@@ -9,7 +9,11 @@
 
 #include <lcm/lcm_coretypes.h>
 
+#include <array>
 #include <string>
+#include "dimos_lcm/writer.hpp"
+#include "dimos_lcm/fingerprint.hpp"
+#include "dimos_lcm/reflection.hpp"
 #include "std_msgs/Time.hpp"
 
 namespace actionlib_msgs
@@ -34,6 +38,15 @@ class GoalID
          */
         inline int encode(void *buf, int offset, int maxlen) const;
 
+        /**
+         * Encode a message by appending it to @p buf, walking the message once
+         * instead of sizing it with getEncodedSize() first. @p buf grows
+         * geometrically; reuse it across calls to avoid reallocating.
+         *
+         * @return The number of bytes appended.
+         */
+        inline int encodeTo(std::vector<uint8_t> &buf) const;
+
         /**
          * Check how many bytes are required to encode this message.
          */
@@ -49,6 +62,28 @@ class GoalID
          */
         inline int decode(const void *buf, int offset, int maxlen);
 
+        /**
+         * Field bits for decodeFields().
+         */
+        struct Fields
+        {
+            static constexpr uint64_t stamp = 1ULL << 0;
+            static constexpr uint64_t id = 1ULL << 1;
+            static constexpr uint64_t all = (1ULL << 2) - 1;
+        };
+
+        /**
+         * Decode only the fields selected by @p Mask, a bitwise or of Fields
+         * values. Strings, arrays and nested structs that are not selected are
+         * skipped over by their length prefixes without being allocated, and
+         * keep their previous value. Scalar fields are always decoded: they
+         * cost nothing to read and array lengths depend on them.
+         *
+         * @return The number of bytes decoded, or <0 if an error occured.
+         */
+        template <uint64_t Mask>
+        inline int decodeFields(const void *buf, int offset, int maxlen);
+
         /**
          * Retrieve the 64-bit fingerprint identifying the structure of the message.
          * Note that the fingerprint is the same for all instances of the same
@@ -57,18 +92,47 @@ class GoalID
          */
         inline static int64_t getHash();
 
+        /**
+         * The fingerprint returned by getHash(), as a compile-time constant.
+         */
+        static constexpr int64_t kHash = static_cast<int64_t>(0x56e1630c849fd64dULL);
+
         /**
          * Returns "GoalID"
          */
         inline static const char* getTypeName();
 
+        /**
+         * Name, LCM type and array dimensions of each field, in wire order.
+         * See dimos_lcm::for_each_field() for visiting the fields themselves.
+         */
+        static constexpr std::array<dimos_lcm::field_info, 2> kFields = {{
+            { "stamp", "std_msgs.Time", false, 0, 0, NULL },
+            { "id", "string", true, 0, 0, NULL },
+        }};
+
         // LCM support functions. Users should not call these
         inline int _encodeNoHash(void *buf, int offset, int maxlen) const;
+        template <typename Writer>
+        inline void _writeNoHash(Writer &out) const;
         inline int _getEncodedSizeNoHash() const;
         inline int _decodeNoHash(const void *buf, int offset, int maxlen);
+        template <uint64_t Mask>
+        inline int _decodeFieldsNoHash(const void *buf, int offset, int maxlen);
+        template <typename Self, typename Visitor>
+        inline static void _forEachField(Self &self, Visitor &visitor);
+        inline static int _skipNoHash(const void *buf, int offset, int maxlen);
         inline static uint64_t _computeHash(const __lcm_hash_ptr *p);
 };
 
+static_assert(GoalID::kHash == dimos_lcm::fingerprint(
+    dimos_lcm::signature_hash()
+        .member("stamp", NULL, 0)
+        .member("id", "string", 0)
+        .value(),
+    std_msgs::Time::kHash),
+    "actionlib_msgs::GoalID fingerprint does not match its definition");
+
 int GoalID::encode(void *buf, int offset, int maxlen) const
 {
     int pos = 0, tlen;
@@ -83,6 +147,15 @@ int GoalID::encode(void *buf, int offset, int maxlen) const
     return pos;
 }
 
+int GoalID::encodeTo(std::vector<uint8_t> &buf) const
+{
+    dimos_lcm::vector_writer out(buf);
+    int64_t hash = getHash();
+    out.put(&hash, 1);
+    this->_writeNoHash(out);
+    return static_cast<int>(out.size());
+}
+
 int GoalID::decode(const void *buf, int offset, int maxlen)
 {
     int pos = 0, thislen;
@@ -98,6 +171,22 @@ int GoalID::decode(const void *buf, int offset, int maxlen)
     return pos;
 }
 
+template <uint64_t Mask>
+int GoalID::decodeFields(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, thislen;
+
+    int64_t msg_hash;
+    thislen = __int64_t_decode_array(buf, offset + pos, maxlen - pos, &msg_hash, 1);
+    if (thislen < 0) return thislen; else pos += thislen;
+    if (msg_hash != getHash()) return -1;
+
+    thislen = this->_decodeFieldsNoHash<Mask>(buf, offset + pos, maxlen - pos);
+    if (thislen < 0) return thislen; else pos += thislen;
+
+    return pos;
+}
+
 int GoalID::getEncodedSize() const
 {
     return 8 + _getEncodedSizeNoHash();
@@ -105,8 +194,7 @@ int GoalID::getEncodedSize() const
 
 int64_t GoalID::getHash()
 {
-    static int64_t hash = static_cast<int64_t>(_computeHash(NULL));
-    return hash;
+    return kHash;
 }
 
 const char* GoalID::getTypeName()
@@ -129,6 +217,13 @@ int GoalID::_encodeNoHash(void *buf, int offset, int maxlen) const
     return pos;
 }
 
+template <typename Writer>
+void GoalID::_writeNoHash(Writer &out) const
+{
+    this->stamp._writeNoHash(out);
+    out.put(this->id);
+}
+
 int GoalID::_decodeNoHash(const void *buf, int offset, int maxlen)
 {
     int pos = 0, tlen;
@@ -140,7 +235,7 @@ int GoalID::_decodeNoHash(const void *buf, int offset, int maxlen)
     tlen = __int32_t_decode_array(
         buf, offset + pos, maxlen - pos, &__id_len__, 1);
     if(tlen < 0) return tlen; else pos += tlen;
-    if(__id_len__ > maxlen - pos) return -1;
+    if(__id_len__ < 1 || __id_len__ > maxlen - pos) return -1;
     this->id.assign(
         static_cast<const char*>(buf) + offset + pos, __id_len__ - 1);
     pos += __id_len__;
@@ -148,6 +243,39 @@ int GoalID::_decodeNoHash(const void *buf, int offset, int maxlen)
     return pos;
 }
 
+template <uint64_t Mask>
+int GoalID::_decodeFieldsNoHash(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, tlen;
+
+    if ((Mask & Fields::stamp) != 0) {
+        tlen = this->stamp._decodeNoHash(buf, offset + pos, maxlen - pos);
+        if(tlen < 0) return tlen; else pos += tlen;
+    } else {
+        tlen = std_msgs::Time::_skipNoHash(buf, offset + pos, maxlen - pos);
+        if(tlen < 0) return tlen; else pos += tlen;
+    }
+
+    if ((Mask & Fields::id) != 0) {
+        int32_t __id_len__;
+        tlen = __int32_t_decode_array(
+            buf, offset + pos, maxlen - pos, &__id_len__, 1);
+        if(tlen < 0) return tlen; else pos += tlen;
+        if(__id_len__ < 1 || __id_len__ > maxlen - pos) return -1;
+        this->id.assign(
+            static_cast<const char*>(buf) + offset + pos, __id_len__ - 1);
+        pos += __id_len__;
+    } else {
+        int32_t __id_len__;
+        tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &__id_len__, 1);
+        if(tlen < 0) return tlen; else pos += tlen;
+        if(__id_len__ < 0 || __id_len__ > maxlen - pos) return -1;
+        pos += __id_len__;
+    }
+
+    return pos;
+}
+
 int GoalID::_getEncodedSizeNoHash() const
 {
     int enc_size = 0;
@@ -156,6 +284,27 @@ int GoalID::_getEncodedSizeNoHash() const
     return enc_size;
 }
 
+int GoalID::_skipNoHash(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, tlen;
+    tlen = std_msgs::Time::_skipNoHash(buf, offset + pos, maxlen - pos);
+    if(tlen < 0) return tlen; else pos += tlen;
+    int32_t __id_len__;
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &__id_len__, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+    if(__id_len__ < 0 || __id_len__ > maxlen - pos) return -1;
+    pos += __id_len__;
+    if(pos > maxlen) return -1;
+    return pos;
+}
+
+template <typename Self, typename Visitor>
+void GoalID::_forEachField(Self &self, Visitor &visitor)
+{
+    visitor(kFields[0], self.stamp);
+    visitor(kFields[1], self.id);
+}
+
 uint64_t GoalID::_computeHash(const __lcm_hash_ptr *p)
 {
     const __lcm_hash_ptr *fp;
@@ -1,7 +1,7 @@
 /** THIS IS AN AUTOMATICALLY GENERATED FILE.  DO NOT MODIFY
  * BY HAND!!
  *
- * Generated by lcm-gen 1.5.2
+ * Generated by lcm-cpp (tools/cpp/gen)
  **/
 
 #ifndef __actionlib_msgs_GoalStatus_hpp__
@@ -9,7 +9,11 @@
 
 #include <lcm/lcm_coretypes.h>
 
+#include <array>
 #include <string>
+#include "dimos_lcm/writer.hpp"
+#include "dimos_lcm/fingerprint.hpp"
+#include "dimos_lcm/reflection.hpp"
 #include "actionlib_msgs/GoalID.hpp"
 
 namespace actionlib_msgs
@@ -88,6 +92,15 @@ class GoalStatus
          */
         inline int encode(void *buf, int offset, int maxlen) const;
 
+        /**
+         * Encode a message by appending it to @p buf, walking the message once
+         * instead of sizing it with getEncodedSize() first. @p buf grows
+         * geometrically; reuse it across calls to avoid reallocating.
+         *
+         * @return The number of bytes appended.
+         */
+        inline int encodeTo(std::vector<uint8_t> &buf) const;
+
         /**
          * Check how many bytes are required to encode this message.
          */
@@ -103,6 +116,29 @@ class GoalStatus
          */
         inline int decode(const void *buf, int offset, int maxlen);
 
+        /**
+         * Field bits for decodeFields().
+         */
+        struct Fields
+        {
+            static constexpr uint64_t goal_id = 1ULL << 0;
+            static constexpr uint64_t status = 1ULL << 1;
+            static constexpr uint64_t text = 1ULL << 2;
+            static constexpr uint64_t all = (1ULL << 3) - 1;
+        };
+
+        /**
+         * Decode only the fields selected by @p Mask, a bitwise or of Fields
+         * values. Strings, arrays and nested structs that are not selected are
+         * skipped over by their length prefixes without being allocated, and
+         * keep their previous value. Scalar fields are always decoded: they
+         * cost nothing to read and array lengths depend on them.
+         *
+         * @return The number of bytes decoded, or <0 if an error occured.
+         */
+        template <uint64_t Mask>
+        inline int decodeFields(const void *buf, int offset, int maxlen);
+
         /**
          * Retrieve the 64-bit fingerprint identifying the structure of the message.
          * Note that the fingerprint is the same for all instances of the same
@@ -111,18 +147,49 @@ class GoalStatus
          */
         inline static int64_t getHash();
 
+        /**
+         * The fingerprint returned by getHash(), as a compile-time constant.
+         */
+        static constexpr int64_t kHash = static_cast<int64_t>(0x2f2c98d8e0f95fc2ULL);
+
         /**
          * Returns "GoalStatus"
          */
         inline static const char* getTypeName();
 
+        /**
+         * Name, LCM type and array dimensions of each field, in wire order.
+         * See dimos_lcm::for_each_field() for visiting the fields themselves.
+         */
+        static constexpr std::array<dimos_lcm::field_info, 3> kFields = {{
+            { "goal_id", "actionlib_msgs.GoalID", false, 0, 0, NULL },
+            { "status", "byte", true, 0, 0, NULL },
+            { "text", "string", true, 0, 0, NULL },
+        }};
+
         // LCM support functions. Users should not call these
         inline int _encodeNoHash(void *buf, int offset, int maxlen) const;
+        template <typename Writer>
+        inline void _writeNoHash(Writer &out) const;
         inline int _getEncodedSizeNoHash() const;
         inline int _decodeNoHash(const void *buf, int offset, int maxlen);
+        template <uint64_t Mask>
+        inline int _decodeFieldsNoHash(const void *buf, int offset, int maxlen);
+        template <typename Self, typename Visitor>
+        inline static void _forEachField(Self &self, Visitor &visitor);
+        inline static int _skipNoHash(const void *buf, int offset, int maxlen);
         inline static uint64_t _computeHash(const __lcm_hash_ptr *p);
 };
 
+static_assert(GoalStatus::kHash == dimos_lcm::fingerprint(
+    dimos_lcm::signature_hash()
+        .member("goal_id", NULL, 0)
+        .member("status", "byte", 0)
+        .member("text", "string", 0)
+        .value(),
+    actionlib_msgs::GoalID::kHash),
+    "actionlib_msgs::GoalStatus fingerprint does not match its definition");
+
 int GoalStatus::encode(void *buf, int offset, int maxlen) const
 {
     int pos = 0, tlen;
@@ -137,6 +204,15 @@ int GoalStatus::encode(void *buf, int offset, int maxlen) const
     return pos;
 }
 
+int GoalStatus::encodeTo(std::vector<uint8_t> &buf) const
+{
+    dimos_lcm::vector_writer out(buf);
+    int64_t hash = getHash();
+    out.put(&hash, 1);
+    this->_writeNoHash(out);
+    return static_cast<int>(out.size());
+}
+
 int GoalStatus::decode(const void *buf, int offset, int maxlen)
 {
     int pos = 0, thislen;
@@ -152,6 +228,22 @@ int GoalStatus::decode(const void *buf, int offset, int maxlen)
     return pos;
 }
 
+template <uint64_t Mask>
+int GoalStatus::decodeFields(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, thislen;
+
+    int64_t msg_hash;
+    thislen = __int64_t_decode_array(buf, offset + pos, maxlen - pos, &msg_hash, 1);
+    if (thislen < 0) return thislen; else pos += thislen;
+    if (msg_hash != getHash()) return -1;
+
+    thislen = this->_decodeFieldsNoHash<Mask>(buf, offset + pos, maxlen - pos);
+    if (thislen < 0) return thislen; else pos += thislen;
+
+    return pos;
+}
+
 int GoalStatus::getEncodedSize() const
 {
     return 8 + _getEncodedSizeNoHash();
@@ -159,8 +251,7 @@ int GoalStatus::getEncodedSize() const
 
 int64_t GoalStatus::getHash()
 {
-    static int64_t hash = static_cast<int64_t>(_computeHash(NULL));
-    return hash;
+    return kHash;
 }
 
 const char* GoalStatus::getTypeName()
@@ -186,6 +277,14 @@ int GoalStatus::_encodeNoHash(void *buf, int offset, int maxlen) const
     return pos;
 }
 
+template <typename Writer>
+void GoalStatus::_writeNoHash(Writer &out) const
+{
+    this->goal_id._writeNoHash(out);
+    out.put(&this->status, 1);
+    out.put(this->text);
+}
+
 int GoalStatus::_decodeNoHash(const void *buf, int offset, int maxlen)
 {
     int pos = 0, tlen;
@@ -200,7 +299,7 @@ int GoalStatus::_decodeNoHash(const void *buf, int offset, int maxlen)
     tlen = __int32_t_decode_array(
         buf, offset + pos, maxlen - pos, &__text_len__, 1);
     if(tlen < 0) return tlen; else pos += tlen;
-    if(__text_len__ > maxlen - pos) return -1;
+    if(__text_len__ < 1 || __text_len__ > maxlen - pos) return -1;
     this->text.assign(
         static_cast<const char*>(buf) + offset + pos, __text_len__ - 1);
     pos += __text_len__;
@@ -208,6 +307,42 @@ int GoalStatus::_decodeNoHash(const void *buf, int offset, int maxlen)
     return pos;
 }
 
+template <uint64_t Mask>
+int GoalStatus::_decodeFieldsNoHash(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, tlen;
+
+    if ((Mask & Fields::goal_id) != 0) {
+        tlen = this->goal_id._decodeNoHash(buf, offset + pos, maxlen - pos);
+        if(tlen < 0) return tlen; else pos += tlen;
+    } else {
+        tlen = actionlib_msgs::GoalID::_skipNoHash(buf, offset + pos, maxlen - pos);
+        if(tlen < 0) return tlen; else pos += tlen;
+    }
+
+    tlen = __byte_decode_array(buf, offset + pos, maxlen - pos, &this->status, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    if ((Mask & Fields::text) != 0) {
+        int32_t __text_len__;
+        tlen = __int32_t_decode_array(
+            buf, offset + pos, maxlen - pos, &__text_len__, 1);
+        if(tlen < 0) return tlen; else pos += tlen;
+        if(__text_len__ < 1 || __text_len__ > maxlen - pos) return -1;
+        this->text.assign(
+            static_cast<const char*>(buf) + offset + pos, __text_len__ - 1);
+        pos += __text_len__;
+    } else {
+        int32_t __text_len__;
+        tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &__text_len__, 1);
+        if(tlen < 0) return tlen; else pos += tlen;
+        if(__text_len__ < 0 || __text_len__ > maxlen - pos) return -1;
+        pos += __text_len__;
+    }
+
+    return pos;
+}
+
 int GoalStatus::_getEncodedSizeNoHash() const
 {
     int enc_size = 0;
@@ -217,6 +352,29 @@ int GoalStatus::_getEncodedSizeNoHash() const
     return enc_size;
 }
 
+int GoalStatus::_skipNoHash(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, tlen;
+    tlen = actionlib_msgs::GoalID::_skipNoHash(buf, offset + pos, maxlen - pos);
+    if(tlen < 0) return tlen; else pos += tlen;
+    pos += 1;
+    int32_t __text_len__;
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &__text_len__, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+    if(__text_len__ < 0 || __text_len__ > maxlen - pos) return -1;
+    pos += __text_len__;
+    if(pos > maxlen) return -1;
+    return pos;
+}
+
+template <typename Self, typename Visitor>
+void GoalStatus::_forEachField(Self &self, Visitor &visitor)
+{
+    visitor(kFields[0], self.goal_id);
+    visitor(kFields[1], self.status);
+    visitor(kFields[2], self.text);
+}
+
 uint64_t GoalStatus::_computeHash(const __lcm_hash_ptr *p)
 {
     const __lcm_hash_ptr *fp;
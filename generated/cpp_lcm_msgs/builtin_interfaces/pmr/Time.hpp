@@ -0,0 +1,23 @@
+/** THIS IS AN AUTOMATICALLY GENERATED FILE.  DO NOT MODIFY
+ * BY HAND!!
+ *
+ * Generated by lcm-cpp (tools/cpp/gen)
+ **/
+
+#ifndef __builtin_interfaces_pmr_Time_hpp__
+#define __builtin_interfaces_pmr_Time_hpp__
+
+#include "builtin_interfaces/Time.hpp"
+
+namespace builtin_interfaces
+{
+namespace pmr
+{
+
+// Time has no strings or variable-length arrays, so it never allocates
+typedef builtin_interfaces::Time Time;
+
+}
+}
+
+#endif
@@ -1,7 +1,7 @@
 /** THIS IS AN AUTOMATICALLY GENERATED FILE.  DO NOT MODIFY
  * BY HAND!!
  *
- * Generated by lcm-gen 1.5.2
+ * Generated by lcm-cpp (tools/cpp/gen)
  **/
 
 #ifndef __diagnostic_msgs_DiagnosticStatus_hpp__
@@ -9,8 +9,12 @@
 
 #include <lcm/lcm_coretypes.h>
 
+#include <array>
 #include <string>
 #include <vector>
+#include "dimos_lcm/writer.hpp"
+#include "dimos_lcm/fingerprint.hpp"
+#include "dimos_lcm/reflection.hpp"
 #include "diagnostic_msgs/KeyValue.hpp"
 
 namespace diagnostic_msgs
@@ -68,6 +72,15 @@ class DiagnosticStatus
          */
         inline int encode(void *buf, int offset, int maxlen) const;
 
+        /**
+         * Encode a message by appending it to @p buf, walking the message once
+         * instead of sizing it with getEncodedSize() first. @p buf grows
+         * geometrically; reuse it across calls to avoid reallocating.
+         *
+         * @return The number of bytes appended.
+         */
+        inline int encodeTo(std::vector<uint8_t> &buf) const;
+
         /**
          * Check how many bytes are required to encode this message.
          */
@@ -83,6 +96,45 @@ class DiagnosticStatus
          */
         inline int decode(const void *buf, int offset, int maxlen);
 
+        /**
+         * Field bits for decodeFields().
+         */
+        struct Fields
+        {
+            static constexpr uint64_t values_length = 1ULL << 0;
+            static constexpr uint64_t level = 1ULL << 1;
+            static constexpr uint64_t name = 1ULL << 2;
+            static constexpr uint64_t message = 1ULL << 3;
+            static constexpr uint64_t hardware_id = 1ULL << 4;
+            static constexpr uint64_t values = 1ULL << 5;
+            static constexpr uint64_t all = (1ULL << 6) - 1;
+        };
+
+        /**
+         * Decode only the fields selected by @p Mask, a bitwise or of Fields
+         * values. Strings, arrays and nested structs that are not selected are
+         * skipped over by their length prefixes without being allocated, and
+         * keep their previous value. Scalar fields are always decoded: they
+         * cost nothing to read and array lengths depend on them.
+         *
+         * @return The number of bytes decoded, or <0 if an error occured.
+         */
+        template <uint64_t Mask>
+        inline int decodeFields(const void *buf, int offset, int maxlen);
+
+        /**
+         * Upper bound on the length of every variable-length array of this
+         * type, checked by decode() before anything is allocated; messages
+         * exceeding it fail to decode. It does not apply to nested types,
+         * which have their own. Set it once at startup, before decoding.
+         * Before C++17 it is a constant with no limit.
+         */
+#if __cplusplus >= 201703L
+        static inline int32_t maxArrayLength = INT32_MAX;
+#else
+        static constexpr int32_t maxArrayLength = INT32_MAX;
+#endif
+
         /**
          * Retrieve the 64-bit fingerprint identifying the structure of the message.
          * Note that the fingerprint is the same for all instances of the same
@@ -91,18 +143,55 @@ class DiagnosticStatus
          */
         inline static int64_t getHash();
 
+        /**
+         * The fingerprint returned by getHash(), as a compile-time constant.
+         */
+        static constexpr int64_t kHash = static_cast<int64_t>(0xd9dc607027aad370ULL);
+
         /**
          * Returns "DiagnosticStatus"
          */
         inline static const char* getTypeName();
 
+        /**
+         * Name, LCM type and array dimensions of each field, in wire order.
+         * See dimos_lcm::for_each_field() for visiting the fields themselves.
+         */
+        static constexpr std::array<dimos_lcm::field_info, 6> kFields = {{
+            { "values_length", "int32_t", true, 0, 0, NULL },
+            { "level", "int8_t", true, 0, 0, NULL },
+            { "name", "string", true, 0, 0, NULL },
+            { "message", "string", true, 0, 0, NULL },
+            { "hardware_id", "string", true, 0, 0, NULL },
+            { "values", "diagnostic_msgs.KeyValue", false, 1, -1, "values_length" },
+        }};
+
         // LCM support functions. Users should not call these
         inline int _encodeNoHash(void *buf, int offset, int maxlen) const;
+        template <typename Writer>
+        inline void _writeNoHash(Writer &out) const;
         inline int _getEncodedSizeNoHash() const;
         inline int _decodeNoHash(const void *buf, int offset, int maxlen);
+        template <uint64_t Mask>
+        inline int _decodeFieldsNoHash(const void *buf, int offset, int maxlen);
+        template <typename Self, typename Visitor>
+        inline static void _forEachField(Self &self, Visitor &visitor);
+        inline static int _skipNoHash(const void *buf, int offset, int maxlen);
         inline static uint64_t _computeHash(const __lcm_hash_ptr *p);
 };
 
+static_assert(DiagnosticStatus::kHash == dimos_lcm::fingerprint(
+    dimos_lcm::signature_hash()
+        .member("values_length", "int32_t", 0)
+        .member("level", "int8_t", 0)
+        .member("name", "string", 0)
+        .member("message", "string", 0)
+        .member("hardware_id", "string", 0)
+        .member("values", NULL, 1).dim(true, "values_length")
+        .value(),
+    diagnostic_msgs::KeyValue::kHash),
+    "diagnostic_msgs::DiagnosticStatus fingerprint does not match its definition");
+
 int DiagnosticStatus::encode(void *buf, int offset, int maxlen) const
 {
     int pos = 0, tlen;
@@ -117,6 +206,15 @@ int DiagnosticStatus::encode(void *buf, int offset, int maxlen) const
     return pos;
 }
 
+int DiagnosticStatus::encodeTo(std::vector<uint8_t> &buf) const
+{
+    dimos_lcm::vector_writer out(buf);
+    int64_t hash = getHash();
+    out.put(&hash, 1);
+    this->_writeNoHash(out);
+    return static_cast<int>(out.size());
+}
+
 int DiagnosticStatus::decode(const void *buf, int offset, int maxlen)
 {
     int pos = 0, thislen;
@@ -132,6 +230,22 @@ int DiagnosticStatus::decode(const void *buf, int offset, int maxlen)
     return pos;
 }
 
+template <uint64_t Mask>
+int DiagnosticStatus::decodeFields(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, thislen;
+
+    int64_t msg_hash;
+    thislen = __int64_t_decode_array(buf, offset + pos, maxlen - pos, &msg_hash, 1);
+    if (thislen < 0) return thislen; else pos += thislen;
+    if (msg_hash != getHash()) return -1;
+
+    thislen = this->_decodeFieldsNoHash<Mask>(buf, offset + pos, maxlen - pos);
+    if (thislen < 0) return thislen; else pos += thislen;
+
+    return pos;
+}
+
 int DiagnosticStatus::getEncodedSize() const
 {
     return 8 + _getEncodedSizeNoHash();
@@ -139,8 +253,7 @@ int DiagnosticStatus::getEncodedSize() const
 
 int64_t DiagnosticStatus::getHash()
 {
-    static int64_t hash = static_cast<int64_t>(_computeHash(NULL));
-    return hash;
+    return kHash;
 }
 
 const char* DiagnosticStatus::getTypeName()
@@ -181,6 +294,18 @@ int DiagnosticStatus::_encodeNoHash(void *buf, int offset, int maxlen) const
     return pos;
 }
 
+template <typename Writer>
+void DiagnosticStatus::_writeNoHash(Writer &out) const
+{
+    out.put(&this->values_length, 1);
+    out.put(&this->level, 1);
+    out.put(this->name);
+    out.put(this->message);
+    out.put(this->hardware_id);
+    for (int a0 = 0; a0 < this->values_length; a0++)
+        this->values[a0]._writeNoHash(out);
+}
+
 int DiagnosticStatus::_decodeNoHash(const void *buf, int offset, int maxlen)
 {
     int pos = 0, tlen;
@@ -195,7 +320,7 @@ int DiagnosticStatus::_decodeNoHash(const void *buf, int offset, int maxlen)
     tlen = __int32_t_decode_array(
         buf, offset + pos, maxlen - pos, &__name_len__, 1);
     if(tlen < 0) return tlen; else pos += tlen;
-    if(__name_len__ > maxlen - pos) return -1;
+    if(__name_len__ < 1 || __name_len__ > maxlen - pos) return -1;
     this->name.assign(
         static_cast<const char*>(buf) + offset + pos, __name_len__ - 1);
     pos += __name_len__;
@@ -204,7 +329,7 @@ int DiagnosticStatus::_decodeNoHash(const void *buf, int offset, int maxlen)
     tlen = __int32_t_decode_array(
         buf, offset + pos, maxlen - pos, &__message_len__, 1);
     if(tlen < 0) return tlen; else pos += tlen;
-    if(__message_len__ > maxlen - pos) return -1;
+    if(__message_len__ < 1 || __message_len__ > maxlen - pos) return -1;
     this->message.assign(
         static_cast<const char*>(buf) + offset + pos, __message_len__ - 1);
     pos += __message_len__;
@@ -213,11 +338,12 @@ int DiagnosticStatus::_decodeNoHash(const void *buf, int offset, int maxlen)
     tlen = __int32_t_decode_array(
         buf, offset + pos, maxlen - pos, &__hardware_id_len__, 1);
     if(tlen < 0) return tlen; else pos += tlen;
-    if(__hardware_id_len__ > maxlen - pos) return -1;
+    if(__hardware_id_len__ < 1 || __hardware_id_len__ > maxlen - pos) return -1;
     this->hardware_id.assign(
         static_cast<const char*>(buf) + offset + pos, __hardware_id_len__ - 1);
     pos += __hardware_id_len__;
 
+    if(this->values_length < 0 || this->values_length > (maxlen - pos) / 10 || this->values_length > maxArrayLength) return -1;
     try {
         this->values.resize(this->values_length);
     } catch (...) {
@@ -231,6 +357,90 @@ int DiagnosticStatus::_decodeNoHash(const void *buf, int offset, int maxlen)
     return pos;
 }
 
+template <uint64_t Mask>
+int DiagnosticStatus::_decodeFieldsNoHash(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, tlen;
+
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &this->values_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = __int8_t_decode_array(buf, offset + pos, maxlen - pos, &this->level, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    if ((Mask & Fields::name) != 0) {
+        int32_t __name_len__;
+        tlen = __int32_t_decode_array(
+            buf, offset + pos, maxlen - pos, &__name_len__, 1);
+        if(tlen < 0) return tlen; else pos += tlen;
+        if(__name_len__ < 1 || __name_len__ > maxlen - pos) return -1;
+        this->name.assign(
+            static_cast<const char*>(buf) + offset + pos, __name_len__ - 1);
+        pos += __name_len__;
+    } else {
+        int32_t __name_len__;
+        tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &__name_len__, 1);
+        if(tlen < 0) return tlen; else pos += tlen;
+        if(__name_len__ < 0 || __name_len__ > maxlen - pos) return -1;
+        pos += __name_len__;
+    }
+
+    if ((Mask & Fields::message) != 0) {
+        int32_t __message_len__;
+        tlen = __int32_t_decode_array(
+            buf, offset + pos, maxlen - pos, &__message_len__, 1);
+        if(tlen < 0) return tlen; else pos += tlen;
+        if(__message_len__ < 1 || __message_len__ > maxlen - pos) return -1;
+        this->message.assign(
+            static_cast<const char*>(buf) + offset + pos, __message_len__ - 1);
+        pos += __message_len__;
+    } else {
+        int32_t __message_len__;
+        tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &__message_len__, 1);
+        if(tlen < 0) return tlen; else pos += tlen;
+        if(__message_len__ < 0 || __message_len__ > maxlen - pos) return -1;
+        pos += __message_len__;
+    }
+
+    if ((Mask & Fields::hardware_id) != 0) {
+        int32_t __hardware_id_len__;
+        tlen = __int32_t_decode_array(
+            buf, offset + pos, maxlen - pos, &__hardware_id_len__, 1);
+        if(tlen < 0) return tlen; else pos += tlen;
+        if(__hardware_id_len__ < 1 || __hardware_id_len__ > maxlen - pos) return -1;
+        this->hardware_id.assign(
+            static_cast<const char*>(buf) + offset + pos, __hardware_id_len__ - 1);
+        pos += __hardware_id_len__;
+    } else {
+        int32_t __hardware_id_len__;
+        tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &__hardware_id_len__, 1);
+        if(tlen < 0) return tlen; else pos += tlen;
+        if(__hardware_id_len__ < 0 || __hardware_id_len__ > maxlen - pos) return -1;
+        pos += __hardware_id_len__;
+    }
+
+    if ((Mask & Fields::values) != 0) {
+        if(this->values_length < 0 || this->values_length > (maxlen - pos) / 10 || this->values_length > maxArrayLength) return -1;
+        try {
+            this->values.resize(this->values_length);
+        } catch (...) {
+            return -1;
+        }
+        for (int a0 = 0; a0 < this->values_length; a0++) {
+            tlen = this->values[a0]._decodeNoHash(buf, offset + pos, maxlen - pos);
+            if(tlen < 0) return tlen; else pos += tlen;
+        }
+    } else {
+        if(this->values_length < 0) return -1;
+        for (int a0 = 0; a0 < this->values_length; a0++) {
+            tlen = diagnostic_msgs::KeyValue::_skipNoHash(buf, offset + pos, maxlen - pos);
+            if(tlen < 0) return tlen; else pos += tlen;
+        }
+    }
+
+    return pos;
+}
+
 int DiagnosticStatus::_getEncodedSizeNoHash() const
 {
     int enc_size = 0;
@@ -245,6 +455,48 @@ int DiagnosticStatus::_getEncodedSizeNoHash() const
     return enc_size;
 }
 
+int DiagnosticStatus::_skipNoHash(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, tlen;
+    int32_t values_length;
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &values_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+    pos += 1;
+    int32_t __name_len__;
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &__name_len__, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+    if(__name_len__ < 0 || __name_len__ > maxlen - pos) return -1;
+    pos += __name_len__;
+    int32_t __message_len__;
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &__message_len__, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+    if(__message_len__ < 0 || __message_len__ > maxlen - pos) return -1;
+    pos += __message_len__;
+    int32_t __hardware_id_len__;
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &__hardware_id_len__, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+    if(__hardware_id_len__ < 0 || __hardware_id_len__ > maxlen - pos) return -1;
+    pos += __hardware_id_len__;
+    if(values_length < 0) return -1;
+    for (int a0 = 0; a0 < values_length; a0++) {
+        tlen = diagnostic_msgs::KeyValue::_skipNoHash(buf, offset + pos, maxlen - pos);
+        if(tlen < 0) return tlen; else pos += tlen;
+    }
+    if(pos > maxlen) return -1;
+    return pos;
+}
+
+template <typename Self, typename Visitor>
+void DiagnosticStatus::_forEachField(Self &self, Visitor &visitor)
+{
+    visitor(kFields[0], self.values_length);
+    visitor(kFields[1], self.level);
+    visitor(kFields[2], self.name);
+    visitor(kFields[3], self.message);
+    visitor(kFields[4], self.hardware_id);
+    visitor(kFields[5], self.values);
+}
+
 uint64_t DiagnosticStatus::_computeHash(const __lcm_hash_ptr *p)
 {
     const __lcm_hash_ptr *fp;
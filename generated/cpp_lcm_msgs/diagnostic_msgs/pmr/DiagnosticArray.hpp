@@ -0,0 +1,443 @@
+/** THIS IS AN AUTOMATICALLY GENERATED FILE.  DO NOT MODIFY
+ * BY HAND!!
+ *
+ * Generated by lcm-cpp (tools/cpp/gen)
+ **/
+
+#ifndef __diagnostic_msgs_pmr_DiagnosticArray_hpp__
+#define __diagnostic_msgs_pmr_DiagnosticArray_hpp__
+
+#include <lcm/lcm_coretypes.h>
+
+#include <array>
+#include <memory_resource>
+#include <utility>
+#include <vector>
+#include "dimos_lcm/writer.hpp"
+#include "dimos_lcm/fingerprint.hpp"
+#include "dimos_lcm/reflection.hpp"
+#include "std_msgs/pmr/Header.hpp"
+#include "diagnostic_msgs/pmr/DiagnosticStatus.hpp"
+#if __cplusplus >= 201703L
+#include "std_msgs/HeaderView.hpp"
+#endif
+
+namespace diagnostic_msgs
+{
+namespace pmr
+{
+
+class DiagnosticArray
+{
+    public:
+        int32_t    status_length;
+
+        std_msgs::pmr::Header header;
+
+        /**
+         * LCM Type: diagnostic_msgs.DiagnosticStatus[status_length]
+         */
+        std::pmr::vector< diagnostic_msgs::pmr::DiagnosticStatus > status;
+
+    public:
+        typedef std::pmr::polymorphic_allocator<char> allocator_type;
+
+        /**
+         * Construct a message whose strings and arrays, and those of the
+         * messages it nests, allocate from @p alloc. Scalars are zeroed.
+         */
+        inline explicit DiagnosticArray(const allocator_type &alloc = allocator_type());
+
+        /**
+         * Copy or move @p other into a message that allocates from @p alloc.
+         * With allocator_type, these let std::pmr containers of DiagnosticArray pass
+         * their memory resource on to their elements.
+         */
+        inline DiagnosticArray(const DiagnosticArray &other, const allocator_type &alloc);
+        inline DiagnosticArray(DiagnosticArray &&other, const allocator_type &alloc);
+
+        /**
+         * Encode a message into binary form.
+         *
+         * @param buf The output buffer.
+         * @param offset Encoding starts at thie byte offset into @p buf.
+         * @param maxlen Maximum number of bytes to write.  This should generally be
+         *  equal to getEncodedSize().
+         * @return The number of bytes encoded, or <0 on error.
+         */
+        inline int encode(void *buf, int offset, int maxlen) const;
+
+        /**
+         * Encode a message by appending it to @p buf, walking the message once
+         * instead of sizing it with getEncodedSize() first. @p buf grows
+         * geometrically; reuse it across calls to avoid reallocating.
+         *
+         * @return The number of bytes appended.
+         */
+        inline int encodeTo(std::vector<uint8_t> &buf) const;
+
+        /**
+         * Check how many bytes are required to encode this message.
+         */
+        inline int getEncodedSize() const;
+
+        /**
+         * Decode a message from binary form into this instance.
+         *
+         * @param buf The buffer containing the encoded message.
+         * @param offset The byte offset into @p buf where the encoded message starts.
+         * @param maxlen The maximum number of bytes to read while decoding.
+         * @return The number of bytes decoded, or <0 if an error occured.
+         */
+        inline int decode(const void *buf, int offset, int maxlen);
+
+#if __cplusplus >= 201703L
+        /**
+         * Decode only the header field of an encoded message, leaving the
+         * rest of it untouched. The field sits at a fixed offset, so this costs
+         * the same for any payload size. The view points into @p buf.
+         *
+         * @param buf The buffer containing the encoded message.
+         * @param offset The byte offset into @p buf where the encoded message starts.
+         * @param maxlen The maximum number of bytes to read while decoding.
+         * @param header Receives the decoded header.
+         * @return The number of bytes of the field decoded, or <0 if @p buf does
+         *  not hold a DiagnosticArray or is truncated.
+         *
+         * Needs C++17, for the std::string_view of the view.
+         */
+        inline static int peekHeader(const void *buf, int offset, int maxlen, std_msgs::HeaderView &header);
+#endif
+
+        /**
+         * Field bits for decodeFields().
+         */
+        struct Fields
+        {
+            static constexpr uint64_t status_length = 1ULL << 0;
+            static constexpr uint64_t header = 1ULL << 1;
+            static constexpr uint64_t status = 1ULL << 2;
+            static constexpr uint64_t all = (1ULL << 3) - 1;
+        };
+
+        /**
+         * Decode only the fields selected by @p Mask, a bitwise or of Fields
+         * values. Strings, arrays and nested structs that are not selected are
+         * skipped over by their length prefixes without being allocated, and
+         * keep their previous value. Scalar fields are always decoded: they
+         * cost nothing to read and array lengths depend on them.
+         *
+         * @return The number of bytes decoded, or <0 if an error occured.
+         */
+        template <uint64_t Mask>
+        inline int decodeFields(const void *buf, int offset, int maxlen);
+
+        /**
+         * Upper bound on the length of every variable-length array of this
+         * type, checked by decode() before anything is allocated; messages
+         * exceeding it fail to decode. It does not apply to nested types,
+         * which have their own. Set it once at startup, before decoding.
+         * Before C++17 it is a constant with no limit.
+         */
+#if __cplusplus >= 201703L
+        static inline int32_t maxArrayLength = INT32_MAX;
+#else
+        static constexpr int32_t maxArrayLength = INT32_MAX;
+#endif
+
+        /**
+         * Retrieve the 64-bit fingerprint identifying the structure of the message.
+         * Note that the fingerprint is the same for all instances of the same
+         * message type, and is a fingerprint on the message type definition, not on
+         * the message contents.
+         */
+        inline static int64_t getHash();
+
+        /**
+         * The fingerprint returned by getHash(), as a compile-time constant.
+         */
+        static constexpr int64_t kHash = static_cast<int64_t>(0x1636697c5123af68ULL);
+
+        /**
+         * Returns "DiagnosticArray"
+         */
+        inline static const char* getTypeName();
+
+        /**
+         * Name, LCM type and array dimensions of each field, in wire order.
+         * See dimos_lcm::for_each_field() for visiting the fields themselves.
+         */
+        static constexpr std::array<dimos_lcm::field_info, 3> kFields = {{
+            { "status_length", "int32_t", true, 0, 0, NULL },
+            { "header", "std_msgs.Header", false, 0, 0, NULL },
+            { "status", "diagnostic_msgs.DiagnosticStatus", false, 1, -1, "status_length" },
+        }};
+
+        // LCM support functions. Users should not call these
+        inline int _encodeNoHash(void *buf, int offset, int maxlen) const;
+        template <typename Writer>
+        inline void _writeNoHash(Writer &out) const;
+        inline int _getEncodedSizeNoHash() const;
+        inline int _decodeNoHash(const void *buf, int offset, int maxlen);
+        template <uint64_t Mask>
+        inline int _decodeFieldsNoHash(const void *buf, int offset, int maxlen);
+        template <typename Self, typename Visitor>
+        inline static void _forEachField(Self &self, Visitor &visitor);
+        inline static int _skipNoHash(const void *buf, int offset, int maxlen);
+        inline static uint64_t _computeHash(const __lcm_hash_ptr *p);
+};
+
+static_assert(DiagnosticArray::kHash == dimos_lcm::fingerprint(
+    dimos_lcm::signature_hash()
+        .member("status_length", "int32_t", 0)
+        .member("header", NULL, 0)
+        .member("status", NULL, 1).dim(true, "status_length")
+        .value(),
+    std_msgs::pmr::Header::kHash,
+    diagnostic_msgs::pmr::DiagnosticStatus::kHash),
+    "diagnostic_msgs::pmr::DiagnosticArray fingerprint does not match its definition");
+
+DiagnosticArray::DiagnosticArray(const allocator_type &alloc) :
+    status_length(),
+    header(alloc),
+    status(alloc)
+{
+}
+
+DiagnosticArray::DiagnosticArray(const DiagnosticArray &other, const allocator_type &alloc) :
+    DiagnosticArray(alloc)
+{
+    *this = other;
+}
+
+DiagnosticArray::DiagnosticArray(DiagnosticArray &&other, const allocator_type &alloc) :
+    DiagnosticArray(alloc)
+{
+    *this = std::move(other);
+}
+
+int DiagnosticArray::encode(void *buf, int offset, int maxlen) const
+{
+    int pos = 0, tlen;
+    int64_t hash = getHash();
+
+    tlen = __int64_t_encode_array(buf, offset + pos, maxlen - pos, &hash, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = this->_encodeNoHash(buf, offset + pos, maxlen - pos);
+    if (tlen < 0) return tlen; else pos += tlen;
+
+    return pos;
+}
+
+int DiagnosticArray::encodeTo(std::vector<uint8_t> &buf) const
+{
+    dimos_lcm::vector_writer out(buf);
+    int64_t hash = getHash();
+    out.put(&hash, 1);
+    this->_writeNoHash(out);
+    return static_cast<int>(out.size());
+}
+
+int DiagnosticArray::decode(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, thislen;
+
+    int64_t msg_hash;
+    thislen = __int64_t_decode_array(buf, offset + pos, maxlen - pos, &msg_hash, 1);
+    if (thislen < 0) return thislen; else pos += thislen;
+    if (msg_hash != getHash()) return -1;
+
+    thislen = this->_decodeNoHash(buf, offset + pos, maxlen - pos);
+    if (thislen < 0) return thislen; else pos += thislen;
+
+    return pos;
+}
+
+#if __cplusplus >= 201703L
+int DiagnosticArray::peekHeader(const void *buf, int offset, int maxlen, std_msgs::HeaderView &header)
+{
+    int64_t msg_hash;
+    if (__int64_t_decode_array(buf, offset, maxlen, &msg_hash, 1) < 0) return -1;
+    if (msg_hash != kHash) return -1;
+
+    // header follows the hash and 4 bytes of fixed-size fields
+    return header._decodeNoHash(buf, offset + 12, maxlen - 12);
+}
+#endif
+
+template <uint64_t Mask>
+int DiagnosticArray::decodeFields(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, thislen;
+
+    int64_t msg_hash;
+    thislen = __int64_t_decode_array(buf, offset + pos, maxlen - pos, &msg_hash, 1);
+    if (thislen < 0) return thislen; else pos += thislen;
+    if (msg_hash != getHash()) return -1;
+
+    thislen = this->_decodeFieldsNoHash<Mask>(buf, offset + pos, maxlen - pos);
+    if (thislen < 0) return thislen; else pos += thislen;
+
+    return pos;
+}
+
+int DiagnosticArray::getEncodedSize() const
+{
+    return 8 + _getEncodedSizeNoHash();
+}
+
+int64_t DiagnosticArray::getHash()
+{
+    return kHash;
+}
+
+const char* DiagnosticArray::getTypeName()
+{
+    return "DiagnosticArray";
+}
+
+int DiagnosticArray::_encodeNoHash(void *buf, int offset, int maxlen) const
+{
+    int pos = 0, tlen;
+
+    tlen = __int32_t_encode_array(buf, offset + pos, maxlen - pos, &this->status_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = this->header._encodeNoHash(buf, offset + pos, maxlen - pos);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    for (int a0 = 0; a0 < this->status_length; a0++) {
+        tlen = this->status[a0]._encodeNoHash(buf, offset + pos, maxlen - pos);
+        if(tlen < 0) return tlen; else pos += tlen;
+    }
+
+    return pos;
+}
+
+template <typename Writer>
+void DiagnosticArray::_writeNoHash(Writer &out) const
+{
+    out.put(&this->status_length, 1);
+    this->header._writeNoHash(out);
+    for (int a0 = 0; a0 < this->status_length; a0++)
+        this->status[a0]._writeNoHash(out);
+}
+
+int DiagnosticArray::_decodeNoHash(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, tlen;
+
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &this->status_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = this->header._decodeNoHash(buf, offset + pos, maxlen - pos);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    if(this->status_length < 0 || this->status_length > (maxlen - pos) / 20 || this->status_length > maxArrayLength) return -1;
+    try {
+        this->status.resize(this->status_length);
+    } catch (...) {
+        return -1;
+    }
+    for (int a0 = 0; a0 < this->status_length; a0++) {
+        tlen = this->status[a0]._decodeNoHash(buf, offset + pos, maxlen - pos);
+        if(tlen < 0) return tlen; else pos += tlen;
+    }
+
+    return pos;
+}
+
+template <uint64_t Mask>
+int DiagnosticArray::_decodeFieldsNoHash(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, tlen;
+
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &this->status_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    if ((Mask & Fields::header) != 0) {
+        tlen = this->header._decodeNoHash(buf, offset + pos, maxlen - pos);
+        if(tlen < 0) return tlen; else pos += tlen;
+    } else {
+        tlen = std_msgs::pmr::Header::_skipNoHash(buf, offset + pos, maxlen - pos);
+        if(tlen < 0) return tlen; else pos += tlen;
+    }
+
+    if ((Mask & Fields::status) != 0) {
+        if(this->status_length < 0 || this->status_length > (maxlen - pos) / 20 || this->status_length > maxArrayLength) return -1;
+        try {
+            this->status.resize(this->status_length);
+        } catch (...) {
+            return -1;
+        }
+        for (int a0 = 0; a0 < this->status_length; a0++) {
+            tlen = this->status[a0]._decodeNoHash(buf, offset + pos, maxlen - pos);
+            if(tlen < 0) return tlen; else pos += tlen;
+        }
+    } else {
+        if(this->status_length < 0) return -1;
+        for (int a0 = 0; a0 < this->status_length; a0++) {
+            tlen = diagnostic_msgs::pmr::DiagnosticStatus::_skipNoHash(buf, offset + pos, maxlen - pos);
+            if(tlen < 0) return tlen; else pos += tlen;
+        }
+    }
+
+    return pos;
+}
+
+int DiagnosticArray::_getEncodedSizeNoHash() const
+{
+    int enc_size = 0;
+    enc_size += __int32_t_encoded_array_size(NULL, 1);
+    enc_size += this->header._getEncodedSizeNoHash();
+    for (int a0 = 0; a0 < this->status_length; a0++) {
+        enc_size += this->status[a0]._getEncodedSizeNoHash();
+    }
+    return enc_size;
+}
+
+int DiagnosticArray::_skipNoHash(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, tlen;
+    int32_t status_length;
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &status_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+    tlen = std_msgs::pmr::Header::_skipNoHash(buf, offset + pos, maxlen - pos);
+    if(tlen < 0) return tlen; else pos += tlen;
+    if(status_length < 0) return -1;
+    for (int a0 = 0; a0 < status_length; a0++) {
+        tlen = diagnostic_msgs::pmr::DiagnosticStatus::_skipNoHash(buf, offset + pos, maxlen - pos);
+        if(tlen < 0) return tlen; else pos += tlen;
+    }
+    if(pos > maxlen) return -1;
+    return pos;
+}
+
+template <typename Self, typename Visitor>
+void DiagnosticArray::_forEachField(Self &self, Visitor &visitor)
+{
+    visitor(kFields[0], self.status_length);
+    visitor(kFields[1], self.header);
+    visitor(kFields[2], self.status);
+}
+
+uint64_t DiagnosticArray::_computeHash(const __lcm_hash_ptr *p)
+{
+    const __lcm_hash_ptr *fp;
+    for(fp = p; fp != NULL; fp = fp->parent)
+        if(fp->v == DiagnosticArray::getHash)
+            return 0;
+    const __lcm_hash_ptr cp = { p, DiagnosticArray::getHash };
+
+    uint64_t hash = 0x0163c308c500b94dLL +
+         std_msgs::pmr::Header::_computeHash(&cp) +
+         diagnostic_msgs::pmr::DiagnosticStatus::_computeHash(&cp);
+
+    return (hash<<1) + ((hash>>63)&1);
+}
+
+}
+}
+
+#endif
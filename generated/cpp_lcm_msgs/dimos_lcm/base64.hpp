@@ -0,0 +1,154 @@
+/**
+ * Base64 encoder for byte payloads written as JSON strings.
+ *
+ * Whole 24- and 12-byte blocks are encoded with AVX2 or SSSE3 shuffles when
+ * the target supports them, and the rest three bytes at a time through a
+ * table of character pairs. Define DIMOS_LCM_NO_SIMD to force the table path.
+ **/
+
+#ifndef __dimos_lcm_base64_hpp__
+#define __dimos_lcm_base64_hpp__
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#if !defined(DIMOS_LCM_NO_SIMD)
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define DIMOS_LCM_BASE64_AVX2 1
+#elif defined(__SSSE3__)
+#include <tmmintrin.h>
+#define DIMOS_LCM_BASE64_SSSE3 1
+#endif
+#endif
+
+namespace dimos_lcm
+{
+
+namespace detail
+{
+
+inline constexpr char kBase64Chars[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+// The two characters of every 12-bit group, so three bytes take two lookups
+struct base64_pairs
+{
+    char c[4096][2];
+
+    constexpr base64_pairs() : c()
+    {
+        for (int i = 0; i < 4096; i++) {
+            c[i][0] = kBase64Chars[i >> 6];
+            c[i][1] = kBase64Chars[i & 63];
+        }
+    }
+};
+
+inline constexpr base64_pairs kBase64Pairs;
+
+#if defined(DIMOS_LCM_BASE64_AVX2)
+// Spread 24 bytes, 12 per lane, into 32 six-bit indices and map them to
+// characters (the method of Muła and Lemire)
+inline __m256i base64_block(__m256i in)
+{
+    in = _mm256_shuffle_epi8(in, _mm256_setr_epi8(1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10,
+                                                  1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10));
+    __m256i hi = _mm256_mulhi_epu16(_mm256_and_si256(in, _mm256_set1_epi32(0x0fc0fc00)),
+                                    _mm256_set1_epi32(0x04000040));
+    __m256i lo = _mm256_mullo_epi16(_mm256_and_si256(in, _mm256_set1_epi32(0x003f03f0)),
+                                    _mm256_set1_epi32(0x01000010));
+    __m256i sextets = _mm256_or_si256(hi, lo);
+    // Offset from each sextet to its character, picked by range
+    const __m256i offsets = _mm256_setr_epi8(65, 71, -4, -4, -4, -4, -4, -4, -4, -4, -4, -4, -19, -16, 0, 0,
+                                             65, 71, -4, -4, -4, -4, -4, -4, -4, -4, -4, -4, -19, -16, 0, 0);
+    __m256i range = _mm256_subs_epu8(sextets, _mm256_set1_epi8(51));
+    range = _mm256_sub_epi8(range, _mm256_cmpgt_epi8(sextets, _mm256_set1_epi8(25)));
+    return _mm256_add_epi8(sextets, _mm256_shuffle_epi8(offsets, range));
+}
+#elif defined(DIMOS_LCM_BASE64_SSSE3)
+inline __m128i base64_block(__m128i in)
+{
+    in = _mm_shuffle_epi8(in, _mm_setr_epi8(1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10));
+    __m128i hi = _mm_mulhi_epu16(_mm_and_si128(in, _mm_set1_epi32(0x0fc0fc00)), _mm_set1_epi32(0x04000040));
+    __m128i lo = _mm_mullo_epi16(_mm_and_si128(in, _mm_set1_epi32(0x003f03f0)), _mm_set1_epi32(0x01000010));
+    __m128i sextets = _mm_or_si128(hi, lo);
+    const __m128i offsets = _mm_setr_epi8(65, 71, -4, -4, -4, -4, -4, -4, -4, -4, -4, -4, -19, -16, 0, 0);
+    __m128i range = _mm_subs_epu8(sextets, _mm_set1_epi8(51));
+    range = _mm_sub_epi8(range, _mm_cmpgt_epi8(sextets, _mm_set1_epi8(25)));
+    return _mm_add_epi8(sextets, _mm_shuffle_epi8(offsets, range));
+}
+#endif
+
+}
+
+/**
+ * Number of characters base64_encode() writes for @p n bytes.
+ */
+constexpr size_t base64_encoded_size(size_t n)
+{
+    return (n + 2) / 3 * 4;
+}
+
+/**
+ * Write the padded base64 encoding of @p n bytes at @p data to @p out, which
+ * must have room for base64_encoded_size(@p n) characters. Returns the end of
+ * what was written; no NUL is added.
+ */
+inline char *base64_encode(char *out, const void *data, size_t n)
+{
+    const uint8_t *s = static_cast<const uint8_t *>(data);
+    size_t i = 0;
+#if defined(DIMOS_LCM_BASE64_AVX2)
+    // Each block reads 28 bytes and consumes 24
+    for (; i + 32 <= n; i += 24) {
+        __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i *>(s + i));
+        __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i *>(s + i + 12));
+        __m256i in = _mm256_inserti128_si256(_mm256_castsi128_si256(a), b, 1);
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(out), detail::base64_block(in));
+        out += 32;
+    }
+#elif defined(DIMOS_LCM_BASE64_SSSE3)
+    // Each block reads 16 bytes and consumes 12
+    for (; i + 16 <= n; i += 12) {
+        __m128i in = _mm_loadu_si128(reinterpret_cast<const __m128i *>(s + i));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(out), detail::base64_block(in));
+        out += 16;
+    }
+#endif
+    for (; i + 3 <= n; i += 3) {
+        uint32_t v = (static_cast<uint32_t>(s[i]) << 16) | (static_cast<uint32_t>(s[i + 1]) << 8) | s[i + 2];
+        const char *hi = detail::kBase64Pairs.c[v >> 12];
+        const char *lo = detail::kBase64Pairs.c[v & 0xfff];
+        out[0] = hi[0];
+        out[1] = hi[1];
+        out[2] = lo[0];
+        out[3] = lo[1];
+        out += 4;
+    }
+    if (i < n) {
+        uint32_t v = static_cast<uint32_t>(s[i]) << 16;
+        if (i + 1 < n)
+            v |= static_cast<uint32_t>(s[i + 1]) << 8;
+        out[0] = detail::kBase64Chars[v >> 18];
+        out[1] = detail::kBase64Chars[(v >> 12) & 63];
+        out[2] = i + 1 < n ? detail::kBase64Chars[(v >> 6) & 63] : '=';
+        out[3] = '=';
+        out += 4;
+    }
+    return out;
+}
+
+/**
+ * Append the base64 encoding of @p n bytes at @p data to @p out.
+ */
+inline void append_base64(std::string &out, const void *data, size_t n)
+{
+    size_t pos = out.size();
+    out.resize(pos + base64_encoded_size(n));
+    base64_encode(&out[pos], data, n);
+}
+
+}
+
+#endif
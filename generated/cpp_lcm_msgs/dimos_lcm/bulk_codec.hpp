@@ -0,0 +1,185 @@
+/**
+ * Bulk big-endian codec for arrays of multi-byte primitives.
+ *
+ * Drop-in replacements for the __<type>_encode_array/__<type>_decode_array
+ * functions of lcm_coretypes.h, which shuffle one byte at a time. Whole runs
+ * are byte-swapped with AVX2, SSSE3 or NEON shuffles when the target supports
+ * them, and with a scalar bswap loop otherwise. Define DIMOS_LCM_NO_SIMD to
+ * force the scalar path.
+ **/
+
+#ifndef __dimos_lcm_bulk_codec_hpp__
+#define __dimos_lcm_bulk_codec_hpp__
+
+#include <lcm/lcm_coretypes.h>
+
+#include <cstddef>
+#include <cstring>
+
+#if !defined(DIMOS_LCM_NO_SIMD)
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define DIMOS_LCM_BSWAP_AVX2 1
+#elif defined(__SSSE3__)
+#include <tmmintrin.h>
+#define DIMOS_LCM_BSWAP_SSSE3 1
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#define DIMOS_LCM_BSWAP_NEON 1
+#endif
+#endif
+
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+#define DIMOS_LCM_HOST_BIG_ENDIAN 1
+#endif
+
+namespace dimos_lcm
+{
+
+namespace detail
+{
+
+inline uint16_t bswap(uint16_t v) { return static_cast<uint16_t>((v >> 8) | (v << 8)); }
+
+inline uint32_t bswap(uint32_t v)
+{
+#if defined(__GNUC__)
+    return __builtin_bswap32(v);
+#else
+    return ((v & 0xff000000u) >> 24) | ((v & 0x00ff0000u) >> 8) |
+           ((v & 0x0000ff00u) << 8) | ((v & 0x000000ffu) << 24);
+#endif
+}
+
+inline uint64_t bswap(uint64_t v)
+{
+#if defined(__GNUC__)
+    return __builtin_bswap64(v);
+#else
+    return (static_cast<uint64_t>(bswap(static_cast<uint32_t>(v))) << 32) |
+           bswap(static_cast<uint32_t>(v >> 32));
+#endif
+}
+
+template <typename U>
+inline void bswap_scalar(uint8_t *dst, const uint8_t *src, size_t n)
+{
+    for (size_t i = 0; i < n; i++) {
+        U v;
+        memcpy(&v, src + i * sizeof(U), sizeof(U));
+        v = bswap(v);
+        memcpy(dst + i * sizeof(U), &v, sizeof(U));
+    }
+}
+
+/**
+ * Copy @p n elements of @p W bytes from @p src to @p dst, reversing the byte
+ * order of each. Neither pointer needs to be aligned; they must not overlap.
+ */
+template <size_t W>
+inline void bswap_copy(void *dst, const void *src, size_t n)
+{
+    uint8_t *d = static_cast<uint8_t *>(dst);
+    const uint8_t *s = static_cast<const uint8_t *>(src);
+#if defined(DIMOS_LCM_HOST_BIG_ENDIAN)
+    memcpy(d, s, n * W);
+    return;
+#else
+    size_t i = 0;
+#if defined(DIMOS_LCM_BSWAP_AVX2)
+    const __m256i mask = W == 2
+        ? _mm256_setr_epi8(1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14,
+                           1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14)
+        : W == 4
+        ? _mm256_setr_epi8(3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12,
+                           3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12)
+        : _mm256_setr_epi8(7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8,
+                           7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8);
+    const size_t per_vec = 32 / W;
+    for (; i + 2 * per_vec <= n; i += 2 * per_vec) {
+        __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(s + i * W));
+        __m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(s + i * W + 32));
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(d + i * W), _mm256_shuffle_epi8(a, mask));
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(d + i * W + 32), _mm256_shuffle_epi8(b, mask));
+    }
+    for (; i + per_vec <= n; i += per_vec) {
+        __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(s + i * W));
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(d + i * W), _mm256_shuffle_epi8(a, mask));
+    }
+#elif defined(DIMOS_LCM_BSWAP_SSSE3)
+    const __m128i mask = W == 2
+        ? _mm_setr_epi8(1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14)
+        : W == 4
+        ? _mm_setr_epi8(3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12)
+        : _mm_setr_epi8(7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8);
+    const size_t per_vec = 16 / W;
+    for (; i + per_vec <= n; i += per_vec) {
+        __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i *>(s + i * W));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(d + i * W), _mm_shuffle_epi8(a, mask));
+    }
+#elif defined(DIMOS_LCM_BSWAP_NEON)
+    const size_t per_vec = 16 / W;
+    for (; i + per_vec <= n; i += per_vec) {
+        uint8x16_t a = vld1q_u8(s + i * W);
+        uint8x16_t r = W == 2 ? vrev16q_u8(a) : W == 4 ? vrev32q_u8(a) : vrev64q_u8(a);
+        vst1q_u8(d + i * W, r);
+    }
+#endif
+    if (W == 2)
+        bswap_scalar<uint16_t>(d + i * W, s + i * W, n - i);
+    else if (W == 4)
+        bswap_scalar<uint32_t>(d + i * W, s + i * W, n - i);
+    else
+        bswap_scalar<uint64_t>(d + i * W, s + i * W, n - i);
+#endif
+}
+
+template <typename T>
+inline int encode_array(void *buf, int offset, int maxlen, const T *p, int elements)
+{
+    int total_size = static_cast<int>(sizeof(T)) * elements;
+    if (maxlen < total_size) return -1;
+    bswap_copy<sizeof(T)>(static_cast<uint8_t *>(buf) + offset, p, elements);
+    return total_size;
+}
+
+template <typename T>
+inline int decode_array(const void *buf, int offset, int maxlen, T *p, int elements)
+{
+    int total_size = static_cast<int>(sizeof(T)) * elements;
+    if (maxlen < total_size) return -1;
+    bswap_copy<sizeof(T)>(p, static_cast<const uint8_t *>(buf) + offset, elements);
+    return total_size;
+}
+
+}
+
+/**
+ * Bulk versions of __<type>_encode_array / __<type>_decode_array with the same
+ * signatures and return values.
+ */
+inline int bulk_encode_array(void *buf, int offset, int maxlen, const int16_t *p, int elements)
+{ return detail::encode_array(buf, offset, maxlen, p, elements); }
+inline int bulk_encode_array(void *buf, int offset, int maxlen, const int32_t *p, int elements)
+{ return detail::encode_array(buf, offset, maxlen, p, elements); }
+inline int bulk_encode_array(void *buf, int offset, int maxlen, const int64_t *p, int elements)
+{ return detail::encode_array(buf, offset, maxlen, p, elements); }
+inline int bulk_encode_array(void *buf, int offset, int maxlen, const float *p, int elements)
+{ return detail::encode_array(buf, offset, maxlen, p, elements); }
+inline int bulk_encode_array(void *buf, int offset, int maxlen, const double *p, int elements)
+{ return detail::encode_array(buf, offset, maxlen, p, elements); }
+
+inline int bulk_decode_array(const void *buf, int offset, int maxlen, int16_t *p, int elements)
+{ return detail::decode_array(buf, offset, maxlen, p, elements); }
+inline int bulk_decode_array(const void *buf, int offset, int maxlen, int32_t *p, int elements)
+{ return detail::decode_array(buf, offset, maxlen, p, elements); }
+inline int bulk_decode_array(const void *buf, int offset, int maxlen, int64_t *p, int elements)
+{ return detail::decode_array(buf, offset, maxlen, p, elements); }
+inline int bulk_decode_array(const void *buf, int offset, int maxlen, float *p, int elements)
+{ return detail::decode_array(buf, offset, maxlen, p, elements); }
+inline int bulk_decode_array(const void *buf, int offset, int maxlen, double *p, int elements)
+{ return detail::decode_array(buf, offset, maxlen, p, elements); }
+
+}
+
+#endif
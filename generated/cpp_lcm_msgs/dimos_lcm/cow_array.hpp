@@ -0,0 +1,159 @@
+/**
+ * Copy-on-write byte payloads for the cow:: message flavor.
+ *
+ * Copying an Image or PointCloud2 to hand it to several consumers copies its
+ * payload once per consumer. The cow:: classes hold their byte arrays in a
+ * cow_array instead, which copies share until one of them writes to it.
+ **/
+
+#ifndef __dimos_lcm_cow_array_hpp__
+#define __dimos_lcm_cow_array_hpp__
+
+#include <atomic>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+namespace dimos_lcm
+{
+
+/**
+ * A reference-counted array of @p T that is copied on the first write
+ * through a copy that shares it.
+ *
+ * Reading works like a const std::vector. Writing goes through mutate(),
+ * which makes the array unshared first, or through assign()/resize()/clear().
+ * assign(), which decode() uses, overwrites the array in place when nothing
+ * else shares it and allocates a new one otherwise, so decoding into a
+ * message whose payload was handed on leaves the consumers' copy untouched.
+ *
+ * Copies may be used from different threads as long as each thread has its
+ * own cow_array object, as with std::shared_ptr. The count of copies is
+ * released when a copy goes away and acquired when a write finds the array
+ * unshared, so a write never races with the reads of a copy on another
+ * thread that has just been destroyed. std::shared_ptr::use_count() is a
+ * relaxed load and gives no such guarantee, so the array keeps its own
+ * count.
+ */
+template <typename T>
+class cow_array
+{
+    public:
+        typedef T value_type;
+        typedef size_t size_type;
+        typedef const T *const_iterator;
+
+        cow_array() : buf_(nullptr) {}
+
+        cow_array(std::vector<T> v) : buf_(v.empty() ? nullptr : new shared(std::move(v))) {}
+
+        cow_array(const cow_array &other) : buf_(other.buf_)
+        {
+            if (buf_)
+                buf_->copies.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        cow_array(cow_array &&other) noexcept : buf_(other.buf_) { other.buf_ = nullptr; }
+
+        ~cow_array() { release(); }
+
+        cow_array &operator=(cow_array other) noexcept
+        {
+            std::swap(buf_, other.buf_);
+            return *this;
+        }
+
+        size_t size() const { return buf_ ? buf_->values.size() : 0; }
+        bool empty() const { return size() == 0; }
+
+        const T *data() const { return buf_ ? buf_->values.data() : nullptr; }
+        const T &operator[](size_t i) const { return buf_->values[i]; }
+        const_iterator begin() const { return data(); }
+        const_iterator end() const { return data() + size(); }
+
+        /**
+         * The array as a vector.
+         */
+        const std::vector<T> &vector() const
+        {
+            static const std::vector<T> empty;
+            return buf_ ? buf_->values : empty;
+        }
+
+        /**
+         * Writable access to the array, which is copied first if it is
+         * shared.
+         */
+        std::vector<T> &mutate()
+        {
+            if (!buf_)
+                buf_ = new shared(std::vector<T>());
+            else if (!unique())
+                reset(new shared(buf_->values));
+            return buf_->values;
+        }
+
+        void assign(const T *first, const T *last)
+        {
+            if (unique())
+                buf_->values.assign(first, last);
+            else
+                reset(new shared(std::vector<T>(first, last)));
+        }
+
+        void resize(size_t n) { mutate().resize(n); }
+
+        void clear()
+        {
+            if (unique())
+                buf_->values.clear();
+            else
+                reset(nullptr);
+        }
+
+        /**
+         * Number of cow_arrays sharing this array, 0 if it has none.
+         */
+        long use_count() const { return buf_ ? buf_->copies.load(std::memory_order_relaxed) : 0; }
+
+        bool operator==(const cow_array &other) const
+        {
+            return buf_ == other.buf_ || vector() == other.vector();
+        }
+
+        bool operator!=(const cow_array &other) const { return !(*this == other); }
+
+    private:
+        struct shared
+        {
+            explicit shared(std::vector<T> v) : copies(1), values(std::move(v)) {}
+
+            std::atomic<long> copies;
+            std::vector<T> values;
+        };
+
+        /**
+         * True if this is the only copy of the array. The acquire pairs with
+         * the release in release(), so the reads of the copies that are gone
+         * happen before the caller writes.
+         */
+        bool unique() const { return buf_ && buf_->copies.load(std::memory_order_acquire) == 1; }
+
+        void release()
+        {
+            if (buf_ && buf_->copies.fetch_sub(1, std::memory_order_acq_rel) == 1)
+                delete buf_;
+        }
+
+        void reset(shared *buf)
+        {
+            release();
+            buf_ = buf;
+        }
+
+        shared *buf_;
+};
+
+}
+
+#endif
@@ -0,0 +1,178 @@
+/**
+ * Interned identifier strings for the interned:: message flavor.
+ *
+ * Frame ids, joint names and hardware ids are the same few hundred strings in
+ * every message. The interned:: classes hold them as interned_strings: handles
+ * to the one copy of each string in a process-wide table, which decode() finds
+ * without allocating and which compare by identity.
+ **/
+
+#ifndef __dimos_lcm_interned_string_hpp__
+#define __dimos_lcm_interned_string_hpp__
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+namespace dimos_lcm
+{
+
+class interned_string;
+
+/**
+ * The set of interned strings. Entries are never removed, so the table is
+ * meant for identifiers drawn from a bounded vocabulary, not for free text.
+ * Lookups of strings already in the table take a shared lock and do not
+ * allocate.
+ */
+class string_table
+{
+    public:
+        struct entry
+        {
+            std::string str;
+            uint32_t id;
+        };
+
+        /**
+         * The table used by interned_string.
+         */
+        static string_table &global()
+        {
+            static string_table table;
+            return table;
+        }
+
+        /**
+         * The entry for @p s, added if it is not in the table yet.
+         */
+        const entry *intern(std::string_view s)
+        {
+            {
+                std::shared_lock<std::shared_mutex> lock(mutex_);
+                std::unordered_map<std::string_view, const entry *>::const_iterator it = index_.find(s);
+                if (it != index_.end())
+                    return it->second;
+            }
+            std::unique_lock<std::shared_mutex> lock(mutex_);
+            std::unordered_map<std::string_view, const entry *>::const_iterator it = index_.find(s);
+            if (it != index_.end())
+                return it->second;
+            entries_.push_back(entry{std::string(s), static_cast<uint32_t>(entries_.size())});
+            const entry *e = &entries_.back();
+            index_.emplace(std::string_view(e->str), e);
+            return e;
+        }
+
+        /**
+         * Number of strings in the table.
+         */
+        size_t size() const
+        {
+            std::shared_lock<std::shared_mutex> lock(mutex_);
+            return entries_.size();
+        }
+
+    private:
+        string_table()
+        {
+            // Id 0 is the empty string, which default-constructed handles hold
+            intern(std::string_view());
+        }
+
+        mutable std::shared_mutex mutex_;
+        // A deque never moves its elements, so the keys stay valid
+        std::deque<entry> entries_;
+        std::unordered_map<std::string_view, const entry *> index_;
+};
+
+/**
+ * A handle to a string in string_table::global(). Two interned_strings are
+ * equal exactly when they point to the same entry, so comparing them is a
+ * pointer compare, and id() is a small integer that can index arrays or
+ * serve as a map key.
+ *
+ * It reads like a const std::string (c_str(), size(), str(), and conversion
+ * to std::string_view); assigning or decoding a new value interns it.
+ */
+class interned_string
+{
+    public:
+        interned_string() : entry_(empty_entry()) {}
+        interned_string(std::string_view s) : entry_(string_table::global().intern(s)) {}
+        interned_string(const std::string &s) : interned_string(std::string_view(s)) {}
+        interned_string(const char *s) : interned_string(std::string_view(s)) {}
+
+        interned_string &operator=(std::string_view s)
+        {
+            entry_ = string_table::global().intern(s);
+            return *this;
+        }
+
+        interned_string &operator=(const std::string &s) { return *this = std::string_view(s); }
+        interned_string &operator=(const char *s) { return *this = std::string_view(s); }
+
+        interned_string &assign(const char *s, size_t n) { return *this = std::string_view(s, n); }
+
+        const std::string &str() const { return entry_->str; }
+        const char *c_str() const { return entry_->str.c_str(); }
+        const char *data() const { return entry_->str.data(); }
+        size_t size() const { return entry_->str.size(); }
+        bool empty() const { return entry_->str.empty(); }
+
+        /**
+         * Position of the string in the table: 0 for the empty string, then
+         * in the order the strings were first interned.
+         */
+        uint32_t id() const { return entry_->id; }
+
+        operator std::string_view() const { return entry_->str; }
+
+        bool operator==(const interned_string &other) const { return entry_ == other.entry_; }
+        bool operator!=(const interned_string &other) const { return entry_ != other.entry_; }
+        bool operator<(const interned_string &other) const { return entry_->id < other.entry_->id; }
+
+        // Comparisons with plain strings compare the characters
+        friend bool operator==(const interned_string &a, std::string_view b) { return a.str() == b; }
+        friend bool operator==(std::string_view a, const interned_string &b) { return b == a; }
+        friend bool operator==(const interned_string &a, const std::string &b) { return a.str() == b; }
+        friend bool operator==(const std::string &a, const interned_string &b) { return b == a; }
+        friend bool operator==(const interned_string &a, const char *b) { return a.str() == b; }
+        friend bool operator==(const char *a, const interned_string &b) { return b == a; }
+        friend bool operator!=(const interned_string &a, std::string_view b) { return !(a == b); }
+        friend bool operator!=(std::string_view a, const interned_string &b) { return !(b == a); }
+        friend bool operator!=(const interned_string &a, const std::string &b) { return !(a == b); }
+        friend bool operator!=(const std::string &a, const interned_string &b) { return !(b == a); }
+        friend bool operator!=(const interned_string &a, const char *b) { return !(a == b); }
+        friend bool operator!=(const char *a, const interned_string &b) { return !(b == a); }
+
+    private:
+        static const string_table::entry *empty_entry()
+        {
+            static const string_table::entry *e = string_table::global().intern(std::string_view());
+            return e;
+        }
+
+        const string_table::entry *entry_;
+};
+
+}
+
+namespace std
+{
+
+template <>
+struct hash<dimos_lcm::interned_string>
+{
+    size_t operator()(const dimos_lcm::interned_string &s) const { return s.id(); }
+};
+
+}
+
+#endif
@@ -0,0 +1,205 @@
+/**
+ * Recycled message instances for subscribers that decode the same types at a
+ * fixed rate.
+ *
+ * decode() resizes, assigns or clears every member of the message it is
+ * called on, so decoding into an instance that already held a message of the
+ * same shape reuses its vector and string capacity instead of allocating it
+ * again. The pool hands out such instances and takes them back when the last
+ * reference goes away.
+ **/
+
+#ifndef __dimos_lcm_message_pool_hpp__
+#define __dimos_lcm_message_pool_hpp__
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <vector>
+
+namespace dimos_lcm
+{
+
+/**
+ * A thread-safe pool of @p T messages handed out as std::shared_ptr<T>.
+ *
+ * The deleter of each pointer returns the message to the pool, contents and
+ * capacity included, and the shared_ptr control blocks are recycled too, so
+ * once the pool holds as many messages as are in flight at a time, acquire()
+ * and the release of the last reference do no heap allocations.
+ * allocations() counts the ones the pool has made; it stops growing once the
+ * pool is warm.
+ *
+ * Recycled messages keep the fields of their previous use: decode() into
+ * them, or assign every field, before reading them. Messages may outlive the
+ * pool; they are freed when they are released.
+ *
+ *     dimos_lcm::message_pool<sensor_msgs::Image> pool;
+ *
+ *     void handle(const lcm::ReceiveBuffer *rbuf)
+ *     {
+ *         std::shared_ptr<sensor_msgs::Image> img = pool.acquire();
+ *         img->decode(rbuf->data, 0, rbuf->data_size);
+ *         queue.push(std::move(img));
+ *     }
+ */
+template <typename T>
+class message_pool
+{
+    private:
+        struct state
+        {
+            std::mutex mutex;
+            std::vector<T *> messages;
+            std::vector<void *> blocks;
+            size_t block_size = 0;
+            size_t created = 0;
+            size_t allocations = 0;
+
+            ~state()
+            {
+                for (T *msg : messages)
+                    delete msg;
+                for (void *block : blocks)
+                    ::operator delete(block);
+            }
+        };
+
+        struct recycler
+        {
+            std::shared_ptr<state> pool;
+
+            void operator()(T *msg) const
+            {
+                std::lock_guard<std::mutex> lock(pool->mutex);
+                // Reserved when the message was created: does not allocate
+                pool->messages.push_back(msg);
+            }
+        };
+
+        // Allocates the shared_ptr control blocks from the pool. They all have
+        // the same size; any other request goes to operator new.
+        template <typename U>
+        struct block_allocator
+        {
+            typedef U value_type;
+
+            std::shared_ptr<state> pool;
+
+            explicit block_allocator(std::shared_ptr<state> p) : pool(std::move(p)) {}
+
+            template <typename V>
+            block_allocator(const block_allocator<V> &other) : pool(other.pool) {}
+
+            U *allocate(size_t n)
+            {
+                size_t size = n * sizeof(U);
+                std::lock_guard<std::mutex> lock(pool->mutex);
+                if (pool->block_size == 0)
+                    pool->block_size = size;
+                if (size != pool->block_size) {
+                    pool->allocations++;
+                    return static_cast<U *>(::operator new(size));
+                }
+                if (pool->blocks.empty()) {
+                    pool->allocations++;
+                    void *block = ::operator new(size);
+                    // Room to take it back without allocating
+                    pool->blocks.reserve(pool->created + 1);
+                    return static_cast<U *>(block);
+                }
+                void *block = pool->blocks.back();
+                pool->blocks.pop_back();
+                return static_cast<U *>(block);
+            }
+
+            void deallocate(U *p, size_t n)
+            {
+                std::lock_guard<std::mutex> lock(pool->mutex);
+                if (n * sizeof(U) != pool->block_size) {
+                    ::operator delete(p);
+                    return;
+                }
+                pool->blocks.push_back(p);
+            }
+
+            template <typename V>
+            bool operator==(const block_allocator<V> &other) const { return pool == other.pool; }
+
+            template <typename V>
+            bool operator!=(const block_allocator<V> &other) const { return pool != other.pool; }
+        };
+
+    public:
+        /**
+         * Create a pool holding @p reserve default-constructed messages.
+         */
+        explicit message_pool(size_t reserve = 0) : pool_(std::make_shared<state>())
+        {
+            std::vector<std::shared_ptr<T> > warm;
+            warm.reserve(reserve);
+            for (size_t i = 0; i < reserve; i++)
+                warm.push_back(acquire());
+        }
+
+        message_pool(const message_pool &) = delete;
+        message_pool &operator=(const message_pool &) = delete;
+
+        /**
+         * A message from the pool, or a new one if all of them are in use.
+         */
+        std::shared_ptr<T> acquire()
+        {
+            T *msg;
+            {
+                std::lock_guard<std::mutex> lock(pool_->mutex);
+                if (!pool_->messages.empty()) {
+                    msg = pool_->messages.back();
+                    pool_->messages.pop_back();
+                } else {
+                    msg = nullptr;
+                    pool_->created++;
+                    pool_->allocations++;
+                    pool_->messages.reserve(pool_->created);
+                }
+            }
+            if (!msg) {
+                try {
+                    msg = new T();
+                } catch (...) {
+                    std::lock_guard<std::mutex> lock(pool_->mutex);
+                    pool_->created--;
+                    throw;
+                }
+            }
+            // On failure the deleter is called, which returns msg to the pool
+            return std::shared_ptr<T>(msg, recycler{pool_}, block_allocator<T>(pool_));
+        }
+
+        /**
+         * Number of messages waiting in the pool.
+         */
+        size_t available() const
+        {
+            std::lock_guard<std::mutex> lock(pool_->mutex);
+            return pool_->messages.size();
+        }
+
+        /**
+         * Number of heap allocations the pool has made: messages and control
+         * blocks. Constant in steady state.
+         */
+        size_t allocations() const
+        {
+            std::lock_guard<std::mutex> lock(pool_->mutex);
+            return pool_->allocations;
+        }
+
+    private:
+        std::shared_ptr<state> pool_;
+};
+
+}
+
+#endif
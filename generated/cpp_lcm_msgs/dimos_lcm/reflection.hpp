@@ -0,0 +1,98 @@
+/**
+ * Compile-time field reflection for the generated message classes.
+ *
+ * Every class lists its fields, in wire order, as a constexpr array of
+ * field_info (T::kFields), and for_each_field() calls a visitor with each
+ * field's description and a reference to its member. A generic serializer,
+ * hasher or printer written once against these works for every type, and the
+ * compiler sees through the calls as it would through hand-written code.
+ **/
+
+#ifndef __dimos_lcm_reflection_hpp__
+#define __dimos_lcm_reflection_hpp__
+
+#include <array>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+namespace dimos_lcm
+{
+
+/**
+ * Description of one field of a message type.
+ */
+struct field_info
+{
+    // Member name, e.g. "frame_id"
+    const char *name;
+    // LCM type of the field or of its elements: a primitive ("double",
+    // "string", "byte", ...) or a full type name ("geometry_msgs.Point")
+    const char *type;
+    // True if type is a primitive, false for a nested message
+    bool is_primitive;
+    // Number of array dimensions, 0 for a scalar field
+    int ndim;
+    // Length of the first dimension of a fixed-size array, -1 for a
+    // variable-length array, 0 for a scalar field
+    int size;
+    // Member holding the length of a variable-length array, NULL otherwise
+    const char *length;
+
+    constexpr bool is_array() const { return ndim > 0; }
+    constexpr bool is_variable_array() const { return length != NULL; }
+};
+
+namespace detail
+{
+
+// std::void_t, which the message classes cannot use: they compile as C++11
+template <typename T>
+struct void_type
+{
+    typedef void type;
+};
+
+}
+
+/**
+ * True for the generated message classes, of any flavor.
+ */
+template <typename T, typename = void>
+struct is_message : std::false_type
+{
+};
+
+template <typename T>
+struct is_message<T, typename detail::void_type<decltype(T::kFields)>::type> : std::true_type
+{
+};
+
+#if __cplusplus >= 201703L
+template <typename T>
+inline constexpr bool is_message_v = is_message<T>::value;
+
+/**
+ * Number of fields of message type @p T.
+ */
+template <typename T>
+inline constexpr size_t field_count_v = std::tuple_size<decltype(T::kFields)>::value;
+#endif
+
+/**
+ * Call @p visitor(const field_info &, member) for each field of @p msg, in
+ * wire order. The member is passed as declared (std::string, std::vector,
+ * a nested message, ...; the flavors' own member types for the pmr::, soa::,
+ * cow:: and interned:: classes), const if @p msg is, so one generic visitor
+ * reads or writes every type. Recurse into nested messages by calling
+ * for_each_field() again on members for which is_message_v holds.
+ */
+template <typename Msg, typename Visitor>
+inline void for_each_field(Msg &msg, Visitor &&visitor)
+{
+    std::remove_const<Msg>::type::_forEachField(msg, visitor);
+}
+
+}
+
+#endif
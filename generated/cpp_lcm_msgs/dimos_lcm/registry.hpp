@@ -0,0 +1,647 @@
+/** THIS IS AN AUTOMATICALLY GENERATED FILE.  DO NOT MODIFY
+ * BY HAND!!
+ *
+ * Generated by lcm-cpp (tools/cpp/gen)
+ **/
+
+#ifndef __dimos_lcm_registry_hpp__
+#define __dimos_lcm_registry_hpp__
+
+#include <string_view>
+
+#include "dimos_lcm/type_registry.hpp"
+#include "dimos_lcm/view.hpp"
+#include "actionlib_msgs/GoalID.hpp"
+#include "actionlib_msgs/GoalStatus.hpp"
+#include "actionlib_msgs/GoalStatusArray.hpp"
+#include "builtin_interfaces/Duration.hpp"
+#include "builtin_interfaces/Time.hpp"
+#include "diagnostic_msgs/DiagnosticArray.hpp"
+#include "diagnostic_msgs/DiagnosticStatus.hpp"
+#include "diagnostic_msgs/KeyValue.hpp"
+#include "foxglove_msgs/ArrowPrimitive.hpp"
+#include "foxglove_msgs/CameraCalibration.hpp"
+#include "foxglove_msgs/CircleAnnotation.hpp"
+#include "foxglove_msgs/Color.hpp"
+#include "foxglove_msgs/CompressedImage.hpp"
+#include "foxglove_msgs/CompressedVideo.hpp"
+#include "foxglove_msgs/CubePrimitive.hpp"
+#include "foxglove_msgs/CylinderPrimitive.hpp"
+#include "foxglove_msgs/FrameTransform.hpp"
+#include "foxglove_msgs/FrameTransforms.hpp"
+#include "foxglove_msgs/GeoJSON.hpp"
+#include "foxglove_msgs/Grid.hpp"
+#include "foxglove_msgs/ImageAnnotations.hpp"
+#include "foxglove_msgs/KeyValuePair.hpp"
+#include "foxglove_msgs/LaserScan.hpp"
+#include "foxglove_msgs/LinePrimitive.hpp"
+#include "foxglove_msgs/LocationFix.hpp"
+#include "foxglove_msgs/Log.hpp"
+#include "foxglove_msgs/ModelPrimitive.hpp"
+#include "foxglove_msgs/PackedElementField.hpp"
+#include "foxglove_msgs/Point2.hpp"
+#include "foxglove_msgs/PointCloud.hpp"
+#include "foxglove_msgs/PointsAnnotation.hpp"
+#include "foxglove_msgs/PoseInFrame.hpp"
+#include "foxglove_msgs/PosesInFrame.hpp"
+#include "foxglove_msgs/RawAudio.hpp"
+#include "foxglove_msgs/RawImage.hpp"
+#include "foxglove_msgs/SceneEntity.hpp"
+#include "foxglove_msgs/SceneEntityDeletion.hpp"
+#include "foxglove_msgs/SceneUpdate.hpp"
+#include "foxglove_msgs/SpherePrimitive.hpp"
+#include "foxglove_msgs/TextAnnotation.hpp"
+#include "foxglove_msgs/TextPrimitive.hpp"
+#include "foxglove_msgs/TriangleListPrimitive.hpp"
+#include "foxglove_msgs/Vector2.hpp"
+#include "geometry_msgs/Accel.hpp"
+#include "geometry_msgs/AccelStamped.hpp"
+#include "geometry_msgs/AccelWithCovariance.hpp"
+#include "geometry_msgs/AccelWithCovarianceStamped.hpp"
+#include "geometry_msgs/Inertia.hpp"
+#include "geometry_msgs/InertiaStamped.hpp"
+#include "geometry_msgs/Point.hpp"
+#include "geometry_msgs/Point32.hpp"
+#include "geometry_msgs/PointStamped.hpp"
+#include "geometry_msgs/Polygon.hpp"
+#include "geometry_msgs/PolygonStamped.hpp"
+#include "geometry_msgs/Pose.hpp"
+#include "geometry_msgs/Pose2D.hpp"
+#include "geometry_msgs/PoseArray.hpp"
+#include "geometry_msgs/PoseStamped.hpp"
+#include "geometry_msgs/PoseWithCovariance.hpp"
+#include "geometry_msgs/PoseWithCovarianceStamped.hpp"
+#include "geometry_msgs/Quaternion.hpp"
+#include "geometry_msgs/QuaternionStamped.hpp"
+#include "geometry_msgs/Transform.hpp"
+#include "geometry_msgs/TransformStamped.hpp"
+#include "geometry_msgs/Twist.hpp"
+#include "geometry_msgs/TwistStamped.hpp"
+#include "geometry_msgs/TwistWithCovariance.hpp"
+#include "geometry_msgs/TwistWithCovarianceStamped.hpp"
+#include "geometry_msgs/Vector3.hpp"
+#include "geometry_msgs/Vector3Stamped.hpp"
+#include "geometry_msgs/Wrench.hpp"
+#include "geometry_msgs/WrenchStamped.hpp"
+#include "nav_msgs/GridCells.hpp"
+#include "nav_msgs/MapMetaData.hpp"
+#include "nav_msgs/OccupancyGrid.hpp"
+#include "nav_msgs/Odometry.hpp"
+#include "nav_msgs/Path.hpp"
+#include "sensor_msgs/BatteryState.hpp"
+#include "sensor_msgs/CameraInfo.hpp"
+#include "sensor_msgs/ChannelFloat32.hpp"
+#include "sensor_msgs/CompressedImage.hpp"
+#include "sensor_msgs/FluidPressure.hpp"
+#include "sensor_msgs/Illuminance.hpp"
+#include "sensor_msgs/Image.hpp"
+#include "sensor_msgs/Imu.hpp"
+#include "sensor_msgs/JointState.hpp"
+#include "sensor_msgs/Joy.hpp"
+#include "sensor_msgs/JoyFeedback.hpp"
+#include "sensor_msgs/JoyFeedbackArray.hpp"
+#include "sensor_msgs/LaserEcho.hpp"
+#include "sensor_msgs/LaserScan.hpp"
+#include "sensor_msgs/MagneticField.hpp"
+#include "sensor_msgs/MultiDOFJointState.hpp"
+#include "sensor_msgs/MultiEchoLaserScan.hpp"
+#include "sensor_msgs/NavSatFix.hpp"
+#include "sensor_msgs/NavSatStatus.hpp"
+#include "sensor_msgs/PointCloud.hpp"
+#include "sensor_msgs/PointCloud2.hpp"
+#include "sensor_msgs/PointField.hpp"
+#include "sensor_msgs/Range.hpp"
+#include "sensor_msgs/RegionOfInterest.hpp"
+#include "sensor_msgs/RelativeHumidity.hpp"
+#include "sensor_msgs/Temperature.hpp"
+#include "sensor_msgs/TimeReference.hpp"
+#include "shape_msgs/Mesh.hpp"
+#include "shape_msgs/MeshTriangle.hpp"
+#include "shape_msgs/Plane.hpp"
+#include "shape_msgs/SolidPrimitive.hpp"
+#include "std_msgs/Bool.hpp"
+#include "std_msgs/Byte.hpp"
+#include "std_msgs/ByteMultiArray.hpp"
+#include "std_msgs/Char.hpp"
+#include "std_msgs/ColorRGBA.hpp"
+#include "std_msgs/Duration.hpp"
+#include "std_msgs/Empty.hpp"
+#include "std_msgs/Float32.hpp"
+#include "std_msgs/Float32MultiArray.hpp"
+#include "std_msgs/Float64.hpp"
+#include "std_msgs/Float64MultiArray.hpp"
+#include "std_msgs/Header.hpp"
+#include "std_msgs/Int16.hpp"
+#include "std_msgs/Int16MultiArray.hpp"
+#include "std_msgs/Int32.hpp"
+#include "std_msgs/Int32MultiArray.hpp"
+#include "std_msgs/Int64.hpp"
+#include "std_msgs/Int64MultiArray.hpp"
+#include "std_msgs/Int8.hpp"
+#include "std_msgs/Int8MultiArray.hpp"
+#include "std_msgs/MultiArrayDimension.hpp"
+#include "std_msgs/MultiArrayLayout.hpp"
+#include "std_msgs/String.hpp"
+#include "std_msgs/Time.hpp"
+#include "std_msgs/UInt16.hpp"
+#include "std_msgs/UInt16MultiArray.hpp"
+#include "std_msgs/UInt32.hpp"
+#include "std_msgs/UInt32MultiArray.hpp"
+#include "std_msgs/UInt64.hpp"
+#include "std_msgs/UInt64MultiArray.hpp"
+#include "std_msgs/UInt8.hpp"
+#include "std_msgs/UInt8MultiArray.hpp"
+#include "stereo_msgs/DisparityImage.hpp"
+#include "tf2_msgs/TF2Error.hpp"
+#include "tf2_msgs/TFMessage.hpp"
+#include "trajectory_msgs/JointTrajectory.hpp"
+#include "trajectory_msgs/JointTrajectoryPoint.hpp"
+#include "trajectory_msgs/MultiDOFJointTrajectory.hpp"
+#include "trajectory_msgs/MultiDOFJointTrajectoryPoint.hpp"
+#include "vision_msgs/BoundingBox2D.hpp"
+#include "vision_msgs/BoundingBox2DArray.hpp"
+#include "vision_msgs/BoundingBox3D.hpp"
+#include "vision_msgs/BoundingBox3DArray.hpp"
+#include "vision_msgs/Classification.hpp"
+#include "vision_msgs/Detection2D.hpp"
+#include "vision_msgs/Detection2DArray.hpp"
+#include "vision_msgs/Detection3D.hpp"
+#include "vision_msgs/Detection3DArray.hpp"
+#include "vision_msgs/LabelInfo.hpp"
+#include "vision_msgs/ObjectHypothesis.hpp"
+#include "vision_msgs/ObjectHypothesisWithPose.hpp"
+#include "vision_msgs/Point2D.hpp"
+#include "vision_msgs/Pose2D.hpp"
+#include "vision_msgs/VisionClass.hpp"
+#include "vision_msgs/VisionInfo.hpp"
+#include "visualization_msgs/ImageMarker.hpp"
+#include "visualization_msgs/InteractiveMarker.hpp"
+#include "visualization_msgs/InteractiveMarkerControl.hpp"
+#include "visualization_msgs/InteractiveMarkerFeedback.hpp"
+#include "visualization_msgs/InteractiveMarkerInit.hpp"
+#include "visualization_msgs/InteractiveMarkerPose.hpp"
+#include "visualization_msgs/InteractiveMarkerUpdate.hpp"
+#include "visualization_msgs/Marker.hpp"
+#include "visualization_msgs/MarkerArray.hpp"
+#include "visualization_msgs/MenuEntry.hpp"
+
+namespace dimos_lcm
+{
+
+/**
+ * Every message type. Types with the same definition, and so the same
+ * fingerprint, are adjacent and in name order.
+ */
+inline constexpr type_info kTypes[] = {
+    make_type_info< actionlib_msgs::GoalID >("actionlib_msgs.GoalID", 0),
+    make_type_info< actionlib_msgs::GoalStatus >("actionlib_msgs.GoalStatus", 1),
+    make_type_info< actionlib_msgs::GoalStatusArray >("actionlib_msgs.GoalStatusArray", 2),
+    make_type_info< builtin_interfaces::Duration >("builtin_interfaces.Duration", 3),
+    make_type_info< builtin_interfaces::Time >("builtin_interfaces.Time", 4),
+    make_type_info< diagnostic_msgs::DiagnosticArray >("diagnostic_msgs.DiagnosticArray", 5),
+    make_type_info< diagnostic_msgs::DiagnosticStatus >("diagnostic_msgs.DiagnosticStatus", 6),
+    make_type_info< diagnostic_msgs::KeyValue >("diagnostic_msgs.KeyValue", 7),
+    make_type_info< foxglove_msgs::KeyValuePair >("foxglove_msgs.KeyValuePair", 8),
+    make_type_info< foxglove_msgs::ArrowPrimitive >("foxglove_msgs.ArrowPrimitive", 9),
+    make_type_info< foxglove_msgs::CameraCalibration >("foxglove_msgs.CameraCalibration", 10),
+    make_type_info< foxglove_msgs::CircleAnnotation >("foxglove_msgs.CircleAnnotation", 11),
+    make_type_info< foxglove_msgs::Color >("foxglove_msgs.Color", 12),
+    make_type_info< foxglove_msgs::CompressedImage >("foxglove_msgs.CompressedImage", 13),
+    make_type_info< foxglove_msgs::CompressedVideo >("foxglove_msgs.CompressedVideo", 14),
+    make_type_info< foxglove_msgs::CubePrimitive >("foxglove_msgs.CubePrimitive", 15),
+    make_type_info< foxglove_msgs::SpherePrimitive >("foxglove_msgs.SpherePrimitive", 16),
+    make_type_info< foxglove_msgs::CylinderPrimitive >("foxglove_msgs.CylinderPrimitive", 17),
+    make_type_info< foxglove_msgs::FrameTransform >("foxglove_msgs.FrameTransform", 18),
+    make_type_info< foxglove_msgs::FrameTransforms >("foxglove_msgs.FrameTransforms", 19),
+    make_type_info< foxglove_msgs::GeoJSON >("foxglove_msgs.GeoJSON", 20),
+    make_type_info< foxglove_msgs::Grid >("foxglove_msgs.Grid", 21),
+    make_type_info< foxglove_msgs::ImageAnnotations >("foxglove_msgs.ImageAnnotations", 22),
+    make_type_info< foxglove_msgs::LaserScan >("foxglove_msgs.LaserScan", 23),
+    make_type_info< foxglove_msgs::LinePrimitive >("foxglove_msgs.LinePrimitive", 24),
+    make_type_info< foxglove_msgs::LocationFix >("foxglove_msgs.LocationFix", 25),
+    make_type_info< foxglove_msgs::Log >("foxglove_msgs.Log", 26),
+    make_type_info< foxglove_msgs::ModelPrimitive >("foxglove_msgs.ModelPrimitive", 27),
+    make_type_info< foxglove_msgs::PackedElementField >("foxglove_msgs.PackedElementField", 28),
+    make_type_info< foxglove_msgs::Point2 >("foxglove_msgs.Point2", 29),
+    make_type_info< foxglove_msgs::Vector2 >("foxglove_msgs.Vector2", 30),
+    make_type_info< vision_msgs::Point2D >("vision_msgs.Point2D", 31),
+    make_type_info< foxglove_msgs::PointCloud >("foxglove_msgs.PointCloud", 32),
+    make_type_info< foxglove_msgs::PointsAnnotation >("foxglove_msgs.PointsAnnotation", 33),
+    make_type_info< foxglove_msgs::PoseInFrame >("foxglove_msgs.PoseInFrame", 34),
+    make_type_info< foxglove_msgs::PosesInFrame >("foxglove_msgs.PosesInFrame", 35),
+    make_type_info< foxglove_msgs::RawAudio >("foxglove_msgs.RawAudio", 36),
+    make_type_info< foxglove_msgs::RawImage >("foxglove_msgs.RawImage", 37),
+    make_type_info< foxglove_msgs::SceneEntity >("foxglove_msgs.SceneEntity", 38),
+    make_type_info< foxglove_msgs::SceneEntityDeletion >("foxglove_msgs.SceneEntityDeletion", 39),
+    make_type_info< foxglove_msgs::SceneUpdate >("foxglove_msgs.SceneUpdate", 40),
+    make_type_info< foxglove_msgs::TextAnnotation >("foxglove_msgs.TextAnnotation", 41),
+    make_type_info< foxglove_msgs::TextPrimitive >("foxglove_msgs.TextPrimitive", 42),
+    make_type_info< foxglove_msgs::TriangleListPrimitive >("foxglove_msgs.TriangleListPrimitive", 43),
+    make_type_info< geometry_msgs::Accel >("geometry_msgs.Accel", 44),
+    make_type_info< geometry_msgs::Twist >("geometry_msgs.Twist", 45),
+    make_type_info< geometry_msgs::AccelStamped >("geometry_msgs.AccelStamped", 46),
+    make_type_info< geometry_msgs::AccelWithCovariance >("geometry_msgs.AccelWithCovariance", 47),
+    make_type_info< geometry_msgs::AccelWithCovarianceStamped >("geometry_msgs.AccelWithCovarianceStamped", 48),
+    make_type_info< geometry_msgs::Inertia >("geometry_msgs.Inertia", 49),
+    make_type_info< geometry_msgs::InertiaStamped >("geometry_msgs.InertiaStamped", 50),
+    make_type_info< geometry_msgs::Point >("geometry_msgs.Point", 51),
+    make_type_info< geometry_msgs::Vector3 >("geometry_msgs.Vector3", 52),
+    make_type_info< geometry_msgs::Point32 >("geometry_msgs.Point32", 53),
+    make_type_info< geometry_msgs::PointStamped >("geometry_msgs.PointStamped", 54),
+    make_type_info< geometry_msgs::Polygon >("geometry_msgs.Polygon", 55),
+    make_type_info< geometry_msgs::PolygonStamped >("geometry_msgs.PolygonStamped", 56),
+    make_type_info< geometry_msgs::Pose >("geometry_msgs.Pose", 57),
+    make_type_info< geometry_msgs::Pose2D >("geometry_msgs.Pose2D", 58),
+    make_type_info< geometry_msgs::PoseArray >("geometry_msgs.PoseArray", 59),
+    make_type_info< geometry_msgs::PoseStamped >("geometry_msgs.PoseStamped", 60),
+    make_type_info< geometry_msgs::PoseWithCovariance >("geometry_msgs.PoseWithCovariance", 61),
+    make_type_info< geometry_msgs::PoseWithCovarianceStamped >("geometry_msgs.PoseWithCovarianceStamped", 62),
+    make_type_info< geometry_msgs::Quaternion >("geometry_msgs.Quaternion", 63),
+    make_type_info< geometry_msgs::QuaternionStamped >("geometry_msgs.QuaternionStamped", 64),
+    make_type_info< geometry_msgs::Transform >("geometry_msgs.Transform", 65),
+    make_type_info< geometry_msgs::TransformStamped >("geometry_msgs.TransformStamped", 66),
+    make_type_info< geometry_msgs::TwistStamped >("geometry_msgs.TwistStamped", 67),
+    make_type_info< geometry_msgs::TwistWithCovariance >("geometry_msgs.TwistWithCovariance", 68),
+    make_type_info< geometry_msgs::TwistWithCovarianceStamped >("geometry_msgs.TwistWithCovarianceStamped", 69),
+    make_type_info< geometry_msgs::Vector3Stamped >("geometry_msgs.Vector3Stamped", 70),
+    make_type_info< geometry_msgs::Wrench >("geometry_msgs.Wrench", 71),
+    make_type_info< geometry_msgs::WrenchStamped >("geometry_msgs.WrenchStamped", 72),
+    make_type_info< nav_msgs::GridCells >("nav_msgs.GridCells", 73),
+    make_type_info< nav_msgs::MapMetaData >("nav_msgs.MapMetaData", 74),
+    make_type_info< nav_msgs::OccupancyGrid >("nav_msgs.OccupancyGrid", 75),
+    make_type_info< nav_msgs::Odometry >("nav_msgs.Odometry", 76),
+    make_type_info< nav_msgs::Path >("nav_msgs.Path", 77),
+    make_type_info< sensor_msgs::BatteryState >("sensor_msgs.BatteryState", 78),
+    make_type_info< sensor_msgs::CameraInfo >("sensor_msgs.CameraInfo", 79),
+    make_type_info< sensor_msgs::ChannelFloat32 >("sensor_msgs.ChannelFloat32", 80),
+    make_type_info< sensor_msgs::CompressedImage >("sensor_msgs.CompressedImage", 81),
+    make_type_info< sensor_msgs::FluidPressure >("sensor_msgs.FluidPressure", 82),
+    make_type_info< sensor_msgs::Illuminance >("sensor_msgs.Illuminance", 83),
+    make_type_info< sensor_msgs::Image >("sensor_msgs.Image", 84),
+    make_type_info< sensor_msgs::Imu >("sensor_msgs.Imu", 85),
+    make_type_info< sensor_msgs::JointState >("sensor_msgs.JointState", 86),
+    make_type_info< sensor_msgs::Joy >("sensor_msgs.Joy", 87),
+    make_type_info< sensor_msgs::JoyFeedback >("sensor_msgs.JoyFeedback", 88),
+    make_type_info< sensor_msgs::JoyFeedbackArray >("sensor_msgs.JoyFeedbackArray", 89),
+    make_type_info< sensor_msgs::LaserEcho >("sensor_msgs.LaserEcho", 90),
+    make_type_info< sensor_msgs::LaserScan >("sensor_msgs.LaserScan", 91),
+    make_type_info< sensor_msgs::MagneticField >("sensor_msgs.MagneticField", 92),
+    make_type_info< sensor_msgs::MultiDOFJointState >("sensor_msgs.MultiDOFJointState", 93),
+    make_type_info< sensor_msgs::MultiEchoLaserScan >("sensor_msgs.MultiEchoLaserScan", 94),
+    make_type_info< sensor_msgs::NavSatFix >("sensor_msgs.NavSatFix", 95),
+    make_type_info< sensor_msgs::NavSatStatus >("sensor_msgs.NavSatStatus", 96),
+    make_type_info< sensor_msgs::PointCloud >("sensor_msgs.PointCloud", 97),
+    make_type_info< sensor_msgs::PointCloud2 >("sensor_msgs.PointCloud2", 98),
+    make_type_info< sensor_msgs::PointField >("sensor_msgs.PointField", 99),
+    make_type_info< sensor_msgs::Range >("sensor_msgs.Range", 100),
+    make_type_info< sensor_msgs::RegionOfInterest >("sensor_msgs.RegionOfInterest", 101),
+    make_type_info< sensor_msgs::RelativeHumidity >("sensor_msgs.RelativeHumidity", 102),
+    make_type_info< sensor_msgs::Temperature >("sensor_msgs.Temperature", 103),
+    make_type_info< sensor_msgs::TimeReference >("sensor_msgs.TimeReference", 104),
+    make_type_info< shape_msgs::Mesh >("shape_msgs.Mesh", 105),
+    make_type_info< shape_msgs::MeshTriangle >("shape_msgs.MeshTriangle", 106),
+    make_type_info< shape_msgs::Plane >("shape_msgs.Plane", 107),
+    make_type_info< shape_msgs::SolidPrimitive >("shape_msgs.SolidPrimitive", 108),
+    make_type_info< std_msgs::Bool >("std_msgs.Bool", 109),
+    make_type_info< std_msgs::Byte >("std_msgs.Byte", 110),
+    make_type_info< std_msgs::Int8 >("std_msgs.Int8", 111),
+    make_type_info< std_msgs::ByteMultiArray >("std_msgs.ByteMultiArray", 112),
+    make_type_info< std_msgs::Int8MultiArray >("std_msgs.Int8MultiArray", 113),
+    make_type_info< std_msgs::Char >("std_msgs.Char", 114),
+    make_type_info< std_msgs::UInt8 >("std_msgs.UInt8", 115),
+    make_type_info< std_msgs::ColorRGBA >("std_msgs.ColorRGBA", 116),
+    make_type_info< std_msgs::Duration >("std_msgs.Duration", 117),
+    make_type_info< std_msgs::Time >("std_msgs.Time", 118),
+    make_type_info< std_msgs::Empty >("std_msgs.Empty", 119),
+    make_type_info< std_msgs::Float32 >("std_msgs.Float32", 120),
+    make_type_info< std_msgs::Float32MultiArray >("std_msgs.Float32MultiArray", 121),
+    make_type_info< std_msgs::Float64 >("std_msgs.Float64", 122),
+    make_type_info< std_msgs::Float64MultiArray >("std_msgs.Float64MultiArray", 123),
+    make_type_info< std_msgs::Header >("std_msgs.Header", 124),
+    make_type_info< std_msgs::Int16 >("std_msgs.Int16", 125),
+    make_type_info< std_msgs::UInt16 >("std_msgs.UInt16", 126),
+    make_type_info< std_msgs::Int16MultiArray >("std_msgs.Int16MultiArray", 127),
+    make_type_info< std_msgs::UInt16MultiArray >("std_msgs.UInt16MultiArray", 128),
+    make_type_info< std_msgs::Int32 >("std_msgs.Int32", 129),
+    make_type_info< std_msgs::UInt32 >("std_msgs.UInt32", 130),
+    make_type_info< std_msgs::Int32MultiArray >("std_msgs.Int32MultiArray", 131),
+    make_type_info< std_msgs::UInt32MultiArray >("std_msgs.UInt32MultiArray", 132),
+    make_type_info< std_msgs::Int64 >("std_msgs.Int64", 133),
+    make_type_info< std_msgs::UInt64 >("std_msgs.UInt64", 134),
+    make_type_info< std_msgs::Int64MultiArray >("std_msgs.Int64MultiArray", 135),
+    make_type_info< std_msgs::UInt64MultiArray >("std_msgs.UInt64MultiArray", 136),
+    make_type_info< std_msgs::MultiArrayDimension >("std_msgs.MultiArrayDimension", 137),
+    make_type_info< std_msgs::MultiArrayLayout >("std_msgs.MultiArrayLayout", 138),
+    make_type_info< std_msgs::String >("std_msgs.String", 139),
+    make_type_info< std_msgs::UInt8MultiArray >("std_msgs.UInt8MultiArray", 140),
+    make_type_info< stereo_msgs::DisparityImage >("stereo_msgs.DisparityImage", 141),
+    make_type_info< tf2_msgs::TF2Error >("tf2_msgs.TF2Error", 142),
+    make_type_info< tf2_msgs::TFMessage >("tf2_msgs.TFMessage", 143),
+    make_type_info< trajectory_msgs::JointTrajectory >("trajectory_msgs.JointTrajectory", 144),
+    make_type_info< trajectory_msgs::JointTrajectoryPoint >("trajectory_msgs.JointTrajectoryPoint", 145),
+    make_type_info< trajectory_msgs::MultiDOFJointTrajectory >("trajectory_msgs.MultiDOFJointTrajectory", 146),
+    make_type_info< trajectory_msgs::MultiDOFJointTrajectoryPoint >("trajectory_msgs.MultiDOFJointTrajectoryPoint", 147),
+    make_type_info< vision_msgs::BoundingBox2D >("vision_msgs.BoundingBox2D", 148),
+    make_type_info< vision_msgs::BoundingBox2DArray >("vision_msgs.BoundingBox2DArray", 149),
+    make_type_info< vision_msgs::BoundingBox3D >("vision_msgs.BoundingBox3D", 150),
+    make_type_info< vision_msgs::BoundingBox3DArray >("vision_msgs.BoundingBox3DArray", 151),
+    make_type_info< vision_msgs::Classification >("vision_msgs.Classification", 152),
+    make_type_info< vision_msgs::Detection2D >("vision_msgs.Detection2D", 153),
+    make_type_info< vision_msgs::Detection2DArray >("vision_msgs.Detection2DArray", 154),
+    make_type_info< vision_msgs::Detection3D >("vision_msgs.Detection3D", 155),
+    make_type_info< vision_msgs::Detection3DArray >("vision_msgs.Detection3DArray", 156),
+    make_type_info< vision_msgs::LabelInfo >("vision_msgs.LabelInfo", 157),
+    make_type_info< vision_msgs::ObjectHypothesis >("vision_msgs.ObjectHypothesis", 158),
+    make_type_info< vision_msgs::ObjectHypothesisWithPose >("vision_msgs.ObjectHypothesisWithPose", 159),
+    make_type_info< vision_msgs::Pose2D >("vision_msgs.Pose2D", 160),
+    make_type_info< vision_msgs::VisionClass >("vision_msgs.VisionClass", 161),
+    make_type_info< vision_msgs::VisionInfo >("vision_msgs.VisionInfo", 162),
+    make_type_info< visualization_msgs::ImageMarker >("visualization_msgs.ImageMarker", 163),
+    make_type_info< visualization_msgs::InteractiveMarker >("visualization_msgs.InteractiveMarker", 164),
+    make_type_info< visualization_msgs::InteractiveMarkerControl >("visualization_msgs.InteractiveMarkerControl", 165),
+    make_type_info< visualization_msgs::InteractiveMarkerFeedback >("visualization_msgs.InteractiveMarkerFeedback", 166),
+    make_type_info< visualization_msgs::InteractiveMarkerInit >("visualization_msgs.InteractiveMarkerInit", 167),
+    make_type_info< visualization_msgs::InteractiveMarkerPose >("visualization_msgs.InteractiveMarkerPose", 168),
+    make_type_info< visualization_msgs::InteractiveMarkerUpdate >("visualization_msgs.InteractiveMarkerUpdate", 169),
+    make_type_info< visualization_msgs::Marker >("visualization_msgs.Marker", 170),
+    make_type_info< visualization_msgs::MarkerArray >("visualization_msgs.MarkerArray", 171),
+    make_type_info< visualization_msgs::MenuEntry >("visualization_msgs.MenuEntry", 172),
+};
+
+inline constexpr int kTypeCount = 173;
+
+namespace detail
+{
+
+// Perfect hash of the fingerprints, see find_type()
+inline constexpr uint64_t kRegistrySeed = 0x0000000000000002ULL;
+inline constexpr uint16_t kRegistryDisplacements[64] = {
+    1, 0, 0, 1, 0, 8, 5, 0, 0, 1, 1, 0, 0, 2, 6, 0,
+    0, 0, 2, 1, 2, 1, 0, 4, 1, 1, 2, 7, 0, 0, 1, 4,
+    13, 0, 0, 8, 0, 1, 0, 5, 1, 2, 4, 1, 0, 0, 0, 2,
+    0, 2, 1, 0, 0, 2, 0, 5, 3, 11, 5, 2, 1, 3, 1, 0,
+};
+inline constexpr int16_t kRegistrySlots[256] = {
+    133, -1, -1, -1, -1, 76, 98, -1, -1, -1, -1, -1, -1, 169, 5, -1,
+    139, -1, 160, -1, 57, -1, 75, -1, 93, 55, 108, 88, 1, 41, -1, 131,
+    -1, 24, 62, 25, 82, 171, 77, 112, -1, 42, -1, -1, 44, -1, -1, -1,
+    -1, 61, 29, 107, -1, -1, -1, -1, 110, 20, 104, 18, 155, -1, -1, -1,
+    -1, -1, -1, 12, -1, 28, -1, -1, 154, -1, 138, 53, -1, -1, -1, -1,
+    -1, 63, -1, 33, 137, -1, 86, 70, -1, -1, -1, -1, 54, -1, -1, 46,
+    153, 78, -1, -1, 2, 68, 102, 146, -1, -1, -1, 0, 10, 114, 99, 125,
+    -1, -1, -1, 35, -1, 72, -1, -1, 83, -1, -1, 80, 145, 96, 21, 58,
+    90, 36, 60, 15, 149, -1, 144, -1, -1, 140, -1, -1, 121, 162, 34, -1,
+    -1, -1, -1, -1, 22, 87, -1, 39, 37, 97, -1, 65, 165, 59, -1, 32,
+    119, 105, 91, 3, 152, 129, 19, 71, 135, 157, 9, 150, 47, -1, 56, 122,
+    43, -1, 74, 167, 50, -1, 7, 117, 101, -1, -1, 64, -1, -1, 163, -1,
+    11, -1, -1, 116, -1, 84, 168, 109, -1, 17, -1, 159, 120, 161, -1, -1,
+    94, 106, 127, 141, 48, 147, 73, 23, 89, 124, 51, 143, 151, 69, -1, 38,
+    -1, 27, 164, 123, 170, -1, 66, 166, 6, -1, 158, 156, 49, -1, -1, 142,
+    40, 148, -1, 26, 95, 172, 13, 81, 92, -1, 103, 85, 67, 79, 100, -1,
+};
+
+}
+
+/**
+ * The type with fingerprint @p hash, or NULL if there is none. Of types
+ * sharing a fingerprint this is the first by name; see find_types().
+ */
+inline const type_info *find_type(int64_t hash)
+{
+    uint64_t h1 = detail::mix_hash(static_cast<uint64_t>(hash) ^ detail::kRegistrySeed);
+    uint64_t slot = (detail::mix_hash(h1) ^ detail::kRegistryDisplacements[h1 >> 58]) &
+        255;
+    int index = detail::kRegistrySlots[slot];
+    if (index < 0 || kTypes[index].hash != hash)
+        return NULL;
+    return &kTypes[index];
+}
+
+/**
+ * All the types with fingerprint @p hash; empty if there are none.
+ */
+inline span<const type_info> find_types(int64_t hash)
+{
+    const type_info *type = find_type(hash);
+    if (!type)
+        return span<const type_info>();
+    int end = type->index + 1;
+    while (end < kTypeCount && kTypes[end].hash == hash)
+        end++;
+    return span<const type_info>(type, end - type->index);
+}
+
+/**
+ * The type named @p name ("sensor_msgs.Image"), or NULL. A linear search,
+ * meant for setup rather than per message.
+ */
+inline const type_info *find_type(std::string_view name)
+{
+    for (const type_info &type : kTypes) {
+        if (name == type.name)
+            return &type;
+    }
+    return NULL;
+}
+
+/**
+ * Decode a message of type @p type and call @p visitor with it as its
+ * concrete class, const T &. Returns what decode() returned.
+ */
+template <typename Visitor>
+int visit(const type_info &type, const void *buf, int offset, int maxlen, Visitor &&visitor)
+{
+    switch (type.index) {
+        case 0: return detail::visit_as< actionlib_msgs::GoalID >(buf, offset, maxlen, visitor);
+        case 1: return detail::visit_as< actionlib_msgs::GoalStatus >(buf, offset, maxlen, visitor);
+        case 2: return detail::visit_as< actionlib_msgs::GoalStatusArray >(buf, offset, maxlen, visitor);
+        case 3: return detail::visit_as< builtin_interfaces::Duration >(buf, offset, maxlen, visitor);
+        case 4: return detail::visit_as< builtin_interfaces::Time >(buf, offset, maxlen, visitor);
+        case 5: return detail::visit_as< diagnostic_msgs::DiagnosticArray >(buf, offset, maxlen, visitor);
+        case 6: return detail::visit_as< diagnostic_msgs::DiagnosticStatus >(buf, offset, maxlen, visitor);
+        case 7: return detail::visit_as< diagnostic_msgs::KeyValue >(buf, offset, maxlen, visitor);
+        case 8: return detail::visit_as< foxglove_msgs::KeyValuePair >(buf, offset, maxlen, visitor);
+        case 9: return detail::visit_as< foxglove_msgs::ArrowPrimitive >(buf, offset, maxlen, visitor);
+        case 10: return detail::visit_as< foxglove_msgs::CameraCalibration >(buf, offset, maxlen, visitor);
+        case 11: return detail::visit_as< foxglove_msgs::CircleAnnotation >(buf, offset, maxlen, visitor);
+        case 12: return detail::visit_as< foxglove_msgs::Color >(buf, offset, maxlen, visitor);
+        case 13: return detail::visit_as< foxglove_msgs::CompressedImage >(buf, offset, maxlen, visitor);
+        case 14: return detail::visit_as< foxglove_msgs::CompressedVideo >(buf, offset, maxlen, visitor);
+        case 15: return detail::visit_as< foxglove_msgs::CubePrimitive >(buf, offset, maxlen, visitor);
+        case 16: return detail::visit_as< foxglove_msgs::SpherePrimitive >(buf, offset, maxlen, visitor);
+        case 17: return detail::visit_as< foxglove_msgs::CylinderPrimitive >(buf, offset, maxlen, visitor);
+        case 18: return detail::visit_as< foxglove_msgs::FrameTransform >(buf, offset, maxlen, visitor);
+        case 19: return detail::visit_as< foxglove_msgs::FrameTransforms >(buf, offset, maxlen, visitor);
+        case 20: return detail::visit_as< foxglove_msgs::GeoJSON >(buf, offset, maxlen, visitor);
+        case 21: return detail::visit_as< foxglove_msgs::Grid >(buf, offset, maxlen, visitor);
+        case 22: return detail::visit_as< foxglove_msgs::ImageAnnotations >(buf, offset, maxlen, visitor);
+        case 23: return detail::visit_as< foxglove_msgs::LaserScan >(buf, offset, maxlen, visitor);
+        case 24: return detail::visit_as< foxglove_msgs::LinePrimitive >(buf, offset, maxlen, visitor);
+        case 25: return detail::visit_as< foxglove_msgs::LocationFix >(buf, offset, maxlen, visitor);
+        case 26: return detail::visit_as< foxglove_msgs::Log >(buf, offset, maxlen, visitor);
+        case 27: return detail::visit_as< foxglove_msgs::ModelPrimitive >(buf, offset, maxlen, visitor);
+        case 28: return detail::visit_as< foxglove_msgs::PackedElementField >(buf, offset, maxlen, visitor);
+        case 29: return detail::visit_as< foxglove_msgs::Point2 >(buf, offset, maxlen, visitor);
+        case 30: return detail::visit_as< foxglove_msgs::Vector2 >(buf, offset, maxlen, visitor);
+        case 31: return detail::visit_as< vision_msgs::Point2D >(buf, offset, maxlen, visitor);
+        case 32: return detail::visit_as< foxglove_msgs::PointCloud >(buf, offset, maxlen, visitor);
+        case 33: return detail::visit_as< foxglove_msgs::PointsAnnotation >(buf, offset, maxlen, visitor);
+        case 34: return detail::visit_as< foxglove_msgs::PoseInFrame >(buf, offset, maxlen, visitor);
+        case 35: return detail::visit_as< foxglove_msgs::PosesInFrame >(buf, offset, maxlen, visitor);
+        case 36: return detail::visit_as< foxglove_msgs::RawAudio >(buf, offset, maxlen, visitor);
+        case 37: return detail::visit_as< foxglove_msgs::RawImage >(buf, offset, maxlen, visitor);
+        case 38: return detail::visit_as< foxglove_msgs::SceneEntity >(buf, offset, maxlen, visitor);
+        case 39: return detail::visit_as< foxglove_msgs::SceneEntityDeletion >(buf, offset, maxlen, visitor);
+        case 40: return detail::visit_as< foxglove_msgs::SceneUpdate >(buf, offset, maxlen, visitor);
+        case 41: return detail::visit_as< foxglove_msgs::TextAnnotation >(buf, offset, maxlen, visitor);
+        case 42: return detail::visit_as< foxglove_msgs::TextPrimitive >(buf, offset, maxlen, visitor);
+        case 43: return detail::visit_as< foxglove_msgs::TriangleListPrimitive >(buf, offset, maxlen, visitor);
+        case 44: return detail::visit_as< geometry_msgs::Accel >(buf, offset, maxlen, visitor);
+        case 45: return detail::visit_as< geometry_msgs::Twist >(buf, offset, maxlen, visitor);
+        case 46: return detail::visit_as< geometry_msgs::AccelStamped >(buf, offset, maxlen, visitor);
+        case 47: return detail::visit_as< geometry_msgs::AccelWithCovariance >(buf, offset, maxlen, visitor);
+        case 48: return detail::visit_as< geometry_msgs::AccelWithCovarianceStamped >(buf, offset, maxlen, visitor);
+        case 49: return detail::visit_as< geometry_msgs::Inertia >(buf, offset, maxlen, visitor);
+        case 50: return detail::visit_as< geometry_msgs::InertiaStamped >(buf, offset, maxlen, visitor);
+        case 51: return detail::visit_as< geometry_msgs::Point >(buf, offset, maxlen, visitor);
+        case 52: return detail::visit_as< geometry_msgs::Vector3 >(buf, offset, maxlen, visitor);
+        case 53: return detail::visit_as< geometry_msgs::Point32 >(buf, offset, maxlen, visitor);
+        case 54: return detail::visit_as< geometry_msgs::PointStamped >(buf, offset, maxlen, visitor);
+        case 55: return detail::visit_as< geometry_msgs::Polygon >(buf, offset, maxlen, visitor);
+        case 56: return detail::visit_as< geometry_msgs::PolygonStamped >(buf, offset, maxlen, visitor);
+        case 57: return detail::visit_as< geometry_msgs::Pose >(buf, offset, maxlen, visitor);
+        case 58: return detail::visit_as< geometry_msgs::Pose2D >(buf, offset, maxlen, visitor);
+        case 59: return detail::visit_as< geometry_msgs::PoseArray >(buf, offset, maxlen, visitor);
+        case 60: return detail::visit_as< geometry_msgs::PoseStamped >(buf, offset, maxlen, visitor);
+        case 61: return detail::visit_as< geometry_msgs::PoseWithCovariance >(buf, offset, maxlen, visitor);
+        case 62: return detail::visit_as< geometry_msgs::PoseWithCovarianceStamped >(buf, offset, maxlen, visitor);
+        case 63: return detail::visit_as< geometry_msgs::Quaternion >(buf, offset, maxlen, visitor);
+        case 64: return detail::visit_as< geometry_msgs::QuaternionStamped >(buf, offset, maxlen, visitor);
+        case 65: return detail::visit_as< geometry_msgs::Transform >(buf, offset, maxlen, visitor);
+        case 66: return detail::visit_as< geometry_msgs::TransformStamped >(buf, offset, maxlen, visitor);
+        case 67: return detail::visit_as< geometry_msgs::TwistStamped >(buf, offset, maxlen, visitor);
+        case 68: return detail::visit_as< geometry_msgs::TwistWithCovariance >(buf, offset, maxlen, visitor);
+        case 69: return detail::visit_as< geometry_msgs::TwistWithCovarianceStamped >(buf, offset, maxlen, visitor);
+        case 70: return detail::visit_as< geometry_msgs::Vector3Stamped >(buf, offset, maxlen, visitor);
+        case 71: return detail::visit_as< geometry_msgs::Wrench >(buf, offset, maxlen, visitor);
+        case 72: return detail::visit_as< geometry_msgs::WrenchStamped >(buf, offset, maxlen, visitor);
+        case 73: return detail::visit_as< nav_msgs::GridCells >(buf, offset, maxlen, visitor);
+        case 74: return detail::visit_as< nav_msgs::MapMetaData >(buf, offset, maxlen, visitor);
+        case 75: return detail::visit_as< nav_msgs::OccupancyGrid >(buf, offset, maxlen, visitor);
+        case 76: return detail::visit_as< nav_msgs::Odometry >(buf, offset, maxlen, visitor);
+        case 77: return detail::visit_as< nav_msgs::Path >(buf, offset, maxlen, visitor);
+        case 78: return detail::visit_as< sensor_msgs::BatteryState >(buf, offset, maxlen, visitor);
+        case 79: return detail::visit_as< sensor_msgs::CameraInfo >(buf, offset, maxlen, visitor);
+        case 80: return detail::visit_as< sensor_msgs::ChannelFloat32 >(buf, offset, maxlen, visitor);
+        case 81: return detail::visit_as< sensor_msgs::CompressedImage >(buf, offset, maxlen, visitor);
+        case 82: return detail::visit_as< sensor_msgs::FluidPressure >(buf, offset, maxlen, visitor);
+        case 83: return detail::visit_as< sensor_msgs::Illuminance >(buf, offset, maxlen, visitor);
+        case 84: return detail::visit_as< sensor_msgs::Image >(buf, offset, maxlen, visitor);
+        case 85: return detail::visit_as< sensor_msgs::Imu >(buf, offset, maxlen, visitor);
+        case 86: return detail::visit_as< sensor_msgs::JointState >(buf, offset, maxlen, visitor);
+        case 87: return detail::visit_as< sensor_msgs::Joy >(buf, offset, maxlen, visitor);
+        case 88: return detail::visit_as< sensor_msgs::JoyFeedback >(buf, offset, maxlen, visitor);
+        case 89: return detail::visit_as< sensor_msgs::JoyFeedbackArray >(buf, offset, maxlen, visitor);
+        case 90: return detail::visit_as< sensor_msgs::LaserEcho >(buf, offset, maxlen, visitor);
+        case 91: return detail::visit_as< sensor_msgs::LaserScan >(buf, offset, maxlen, visitor);
+        case 92: return detail::visit_as< sensor_msgs::MagneticField >(buf, offset, maxlen, visitor);
+        case 93: return detail::visit_as< sensor_msgs::MultiDOFJointState >(buf, offset, maxlen, visitor);
+        case 94: return detail::visit_as< sensor_msgs::MultiEchoLaserScan >(buf, offset, maxlen, visitor);
+        case 95: return detail::visit_as< sensor_msgs::NavSatFix >(buf, offset, maxlen, visitor);
+        case 96: return detail::visit_as< sensor_msgs::NavSatStatus >(buf, offset, maxlen, visitor);
+        case 97: return detail::visit_as< sensor_msgs::PointCloud >(buf, offset, maxlen, visitor);
+        case 98: return detail::visit_as< sensor_msgs::PointCloud2 >(buf, offset, maxlen, visitor);
+        case 99: return detail::visit_as< sensor_msgs::PointField >(buf, offset, maxlen, visitor);
+        case 100: return detail::visit_as< sensor_msgs::Range >(buf, offset, maxlen, visitor);
+        case 101: return detail::visit_as< sensor_msgs::RegionOfInterest >(buf, offset, maxlen, visitor);
+        case 102: return detail::visit_as< sensor_msgs::RelativeHumidity >(buf, offset, maxlen, visitor);
+        case 103: return detail::visit_as< sensor_msgs::Temperature >(buf, offset, maxlen, visitor);
+        case 104: return detail::visit_as< sensor_msgs::TimeReference >(buf, offset, maxlen, visitor);
+        case 105: return detail::visit_as< shape_msgs::Mesh >(buf, offset, maxlen, visitor);
+        case 106: return detail::visit_as< shape_msgs::MeshTriangle >(buf, offset, maxlen, visitor);
+        case 107: return detail::visit_as< shape_msgs::Plane >(buf, offset, maxlen, visitor);
+        case 108: return detail::visit_as< shape_msgs::SolidPrimitive >(buf, offset, maxlen, visitor);
+        case 109: return detail::visit_as< std_msgs::Bool >(buf, offset, maxlen, visitor);
+        case 110: return detail::visit_as< std_msgs::Byte >(buf, offset, maxlen, visitor);
+        case 111: return detail::visit_as< std_msgs::Int8 >(buf, offset, maxlen, visitor);
+        case 112: return detail::visit_as< std_msgs::ByteMultiArray >(buf, offset, maxlen, visitor);
+        case 113: return detail::visit_as< std_msgs::Int8MultiArray >(buf, offset, maxlen, visitor);
+        case 114: return detail::visit_as< std_msgs::Char >(buf, offset, maxlen, visitor);
+        case 115: return detail::visit_as< std_msgs::UInt8 >(buf, offset, maxlen, visitor);
+        case 116: return detail::visit_as< std_msgs::ColorRGBA >(buf, offset, maxlen, visitor);
+        case 117: return detail::visit_as< std_msgs::Duration >(buf, offset, maxlen, visitor);
+        case 118: return detail::visit_as< std_msgs::Time >(buf, offset, maxlen, visitor);
+        case 119: return detail::visit_as< std_msgs::Empty >(buf, offset, maxlen, visitor);
+        case 120: return detail::visit_as< std_msgs::Float32 >(buf, offset, maxlen, visitor);
+        case 121: return detail::visit_as< std_msgs::Float32MultiArray >(buf, offset, maxlen, visitor);
+        case 122: return detail::visit_as< std_msgs::Float64 >(buf, offset, maxlen, visitor);
+        case 123: return detail::visit_as< std_msgs::Float64MultiArray >(buf, offset, maxlen, visitor);
+        case 124: return detail::visit_as< std_msgs::Header >(buf, offset, maxlen, visitor);
+        case 125: return detail::visit_as< std_msgs::Int16 >(buf, offset, maxlen, visitor);
+        case 126: return detail::visit_as< std_msgs::UInt16 >(buf, offset, maxlen, visitor);
+        case 127: return detail::visit_as< std_msgs::Int16MultiArray >(buf, offset, maxlen, visitor);
+        case 128: return detail::visit_as< std_msgs::UInt16MultiArray >(buf, offset, maxlen, visitor);
+        case 129: return detail::visit_as< std_msgs::Int32 >(buf, offset, maxlen, visitor);
+        case 130: return detail::visit_as< std_msgs::UInt32 >(buf, offset, maxlen, visitor);
+        case 131: return detail::visit_as< std_msgs::Int32MultiArray >(buf, offset, maxlen, visitor);
+        case 132: return detail::visit_as< std_msgs::UInt32MultiArray >(buf, offset, maxlen, visitor);
+        case 133: return detail::visit_as< std_msgs::Int64 >(buf, offset, maxlen, visitor);
+        case 134: return detail::visit_as< std_msgs::UInt64 >(buf, offset, maxlen, visitor);
+        case 135: return detail::visit_as< std_msgs::Int64MultiArray >(buf, offset, maxlen, visitor);
+        case 136: return detail::visit_as< std_msgs::UInt64MultiArray >(buf, offset, maxlen, visitor);
+        case 137: return detail::visit_as< std_msgs::MultiArrayDimension >(buf, offset, maxlen, visitor);
+        case 138: return detail::visit_as< std_msgs::MultiArrayLayout >(buf, offset, maxlen, visitor);
+        case 139: return detail::visit_as< std_msgs::String >(buf, offset, maxlen, visitor);
+        case 140: return detail::visit_as< std_msgs::UInt8MultiArray >(buf, offset, maxlen, visitor);
+        case 141: return detail::visit_as< stereo_msgs::DisparityImage >(buf, offset, maxlen, visitor);
+        case 142: return detail::visit_as< tf2_msgs::TF2Error >(buf, offset, maxlen, visitor);
+        case 143: return detail::visit_as< tf2_msgs::TFMessage >(buf, offset, maxlen, visitor);
+        case 144: return detail::visit_as< trajectory_msgs::JointTrajectory >(buf, offset, maxlen, visitor);
+        case 145: return detail::visit_as< trajectory_msgs::JointTrajectoryPoint >(buf, offset, maxlen, visitor);
+        case 146: return detail::visit_as< trajectory_msgs::MultiDOFJointTrajectory >(buf, offset, maxlen, visitor);
+        case 147: return detail::visit_as< trajectory_msgs::MultiDOFJointTrajectoryPoint >(buf, offset, maxlen, visitor);
+        case 148: return detail::visit_as< vision_msgs::BoundingBox2D >(buf, offset, maxlen, visitor);
+        case 149: return detail::visit_as< vision_msgs::BoundingBox2DArray >(buf, offset, maxlen, visitor);
+        case 150: return detail::visit_as< vision_msgs::BoundingBox3D >(buf, offset, maxlen, visitor);
+        case 151: return detail::visit_as< vision_msgs::BoundingBox3DArray >(buf, offset, maxlen, visitor);
+        case 152: return detail::visit_as< vision_msgs::Classification >(buf, offset, maxlen, visitor);
+        case 153: return detail::visit_as< vision_msgs::Detection2D >(buf, offset, maxlen, visitor);
+        case 154: return detail::visit_as< vision_msgs::Detection2DArray >(buf, offset, maxlen, visitor);
+        case 155: return detail::visit_as< vision_msgs::Detection3D >(buf, offset, maxlen, visitor);
+        case 156: return detail::visit_as< vision_msgs::Detection3DArray >(buf, offset, maxlen, visitor);
+        case 157: return detail::visit_as< vision_msgs::LabelInfo >(buf, offset, maxlen, visitor);
+        case 158: return detail::visit_as< vision_msgs::ObjectHypothesis >(buf, offset, maxlen, visitor);
+        case 159: return detail::visit_as< vision_msgs::ObjectHypothesisWithPose >(buf, offset, maxlen, visitor);
+        case 160: return detail::visit_as< vision_msgs::Pose2D >(buf, offset, maxlen, visitor);
+        case 161: return detail::visit_as< vision_msgs::VisionClass >(buf, offset, maxlen, visitor);
+        case 162: return detail::visit_as< vision_msgs::VisionInfo >(buf, offset, maxlen, visitor);
+        case 163: return detail::visit_as< visualization_msgs::ImageMarker >(buf, offset, maxlen, visitor);
+        case 164: return detail::visit_as< visualization_msgs::InteractiveMarker >(buf, offset, maxlen, visitor);
+        case 165: return detail::visit_as< visualization_msgs::InteractiveMarkerControl >(buf, offset, maxlen, visitor);
+        case 166: return detail::visit_as< visualization_msgs::InteractiveMarkerFeedback >(buf, offset, maxlen, visitor);
+        case 167: return detail::visit_as< visualization_msgs::InteractiveMarkerInit >(buf, offset, maxlen, visitor);
+        case 168: return detail::visit_as< visualization_msgs::InteractiveMarkerPose >(buf, offset, maxlen, visitor);
+        case 169: return detail::visit_as< visualization_msgs::InteractiveMarkerUpdate >(buf, offset, maxlen, visitor);
+        case 170: return detail::visit_as< visualization_msgs::Marker >(buf, offset, maxlen, visitor);
+        case 171: return detail::visit_as< visualization_msgs::MarkerArray >(buf, offset, maxlen, visitor);
+        case 172: return detail::visit_as< visualization_msgs::MenuEntry >(buf, offset, maxlen, visitor);
+    }
+    return -1;
+}
+
+/**
+ * Decode a message of whichever type its fingerprint names and call
+ * @p visitor with it; -1 if no type has that fingerprint.
+ */
+template <typename Visitor>
+int visit(const void *buf, int offset, int maxlen, Visitor &&visitor)
+{
+    const type_info *type = find_type(peek_hash(buf, offset, maxlen));
+    if (!type)
+        return -1;
+    return visit(*type, buf, offset, maxlen, visitor);
+}
+
+}
+
+#endif
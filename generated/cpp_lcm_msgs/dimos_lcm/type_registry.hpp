@@ -0,0 +1,154 @@
+/**
+ * Type-erased access to the generated message classes.
+ *
+ * The generated dimos_lcm/registry.hpp lists every message type as a
+ * type_info and finds them by fingerprint through a perfect hash computed by
+ * the generator, so a recorder or bridge can decode, size and re-encode any
+ * message it receives without per-type code.
+ **/
+
+#ifndef __dimos_lcm_type_registry_hpp__
+#define __dimos_lcm_type_registry_hpp__
+
+#include <lcm/lcm_coretypes.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+namespace dimos_lcm
+{
+
+/**
+ * A message type behind function pointers. The void * messages are
+ * instances created by create().
+ */
+struct type_info
+{
+    // getHash() of the type
+    int64_t hash;
+    // Full LCM name, e.g. "sensor_msgs.Image"
+    const char *name;
+    // Position in the registry
+    int index;
+
+    void *(*create)();
+    void (*destroy)(void *msg);
+    // encode()/decode()/getEncodedSize() of the type, fingerprint included
+    int (*encode)(const void *msg, void *buf, int offset, int maxlen);
+    int (*decode)(void *msg, const void *buf, int offset, int maxlen);
+    int (*encoded_size)(const void *msg);
+};
+
+template <typename T>
+constexpr type_info make_type_info(const char *name, int index)
+{
+    return type_info{
+        T::kHash,
+        name,
+        index,
+        []() -> void * { return new T(); },
+        [](void *msg) { delete static_cast<T *>(msg); },
+        [](const void *msg, void *buf, int offset, int maxlen) {
+            return static_cast<const T *>(msg)->encode(buf, offset, maxlen);
+        },
+        [](void *msg, const void *buf, int offset, int maxlen) {
+            return static_cast<T *>(msg)->decode(buf, offset, maxlen);
+        },
+        [](const void *msg) { return static_cast<const T *>(msg)->getEncodedSize(); },
+    };
+}
+
+/**
+ * The fingerprint an encoded message starts with, or 0 if @p maxlen is too
+ * short to hold one.
+ */
+inline int64_t peek_hash(const void *buf, int offset, int maxlen)
+{
+    int64_t hash;
+    if (__int64_t_decode_array(buf, offset, maxlen, &hash, 1) != 8)
+        return 0;
+    return hash;
+}
+
+/**
+ * A message of a type known only at run time, owning its instance.
+ */
+class any_message
+{
+    public:
+        any_message() : type_(nullptr), msg_(nullptr) {}
+        explicit any_message(const type_info &type) : type_(&type), msg_(type.create()) {}
+        ~any_message() { reset(); }
+
+        any_message(any_message &&other) noexcept : type_(other.type_), msg_(other.msg_)
+        {
+            other.type_ = nullptr;
+            other.msg_ = nullptr;
+        }
+
+        any_message &operator=(any_message &&other) noexcept
+        {
+            std::swap(type_, other.type_);
+            std::swap(msg_, other.msg_);
+            return *this;
+        }
+
+        any_message(const any_message &) = delete;
+        any_message &operator=(const any_message &) = delete;
+
+        /**
+         * The type, or NULL for an empty any_message.
+         */
+        const type_info *type() const { return type_; }
+
+        void *get() { return msg_; }
+        const void *get() const { return msg_; }
+
+        int encode(void *buf, int offset, int maxlen) const { return type_->encode(msg_, buf, offset, maxlen); }
+        int decode(const void *buf, int offset, int maxlen) { return type_->decode(msg_, buf, offset, maxlen); }
+        int getEncodedSize() const { return type_->encoded_size(msg_); }
+
+        void reset()
+        {
+            if (msg_)
+                type_->destroy(msg_);
+            type_ = nullptr;
+            msg_ = nullptr;
+        }
+
+    private:
+        const type_info *type_;
+        void *msg_;
+};
+
+namespace detail
+{
+
+// splitmix64's finalizer, the mixing function of the registry's perfect hash
+constexpr uint64_t mix_hash(uint64_t x)
+{
+    x ^= x >> 30;
+    x *= 0xbf58476d1ce4e5b9ULL;
+    x ^= x >> 27;
+    x *= 0x94d049bb133111ebULL;
+    x ^= x >> 31;
+    return x;
+}
+
+template <typename T, typename Visitor>
+int visit_as(const void *buf, int offset, int maxlen, Visitor &visitor)
+{
+    T msg;
+    int n = msg.decode(buf, offset, maxlen);
+    if (n < 0)
+        return n;
+    visitor(static_cast<const T &>(msg));
+    return n;
+}
+
+}
+
+}
+
+#endif
@@ -0,0 +1,172 @@
+/**
+ * Runtime support for the generated zero-copy *View types.
+ *
+ * Views borrow the encoded buffer they were decoded from: every span and
+ * string_view they hold points into it, so the buffer must outlive the view.
+ **/
+
+#ifndef __dimos_lcm_view_hpp__
+#define __dimos_lcm_view_hpp__
+
+#include <lcm/lcm_coretypes.h>
+
+#include <cstddef>
+#include <cstring>
+#include <iterator>
+
+#include "dimos_lcm/bulk_codec.hpp"
+
+namespace dimos_lcm
+{
+
+/**
+ * Contiguous run of elements owned by somebody else. A minimal stand-in for
+ * std::span until the generated code can require C++20.
+ */
+template <typename T>
+class span
+{
+    public:
+        typedef T element_type;
+        typedef T* iterator;
+
+        span() : data_(NULL), size_(0) {}
+        span(T *data, size_t size) : data_(data), size_(size) {}
+
+        T *data() const { return data_; }
+        size_t size() const { return size_; }
+        size_t size_bytes() const { return size_ * sizeof(T); }
+        bool empty() const { return size_ == 0; }
+
+        T &operator[](size_t i) const { return data_[i]; }
+        iterator begin() const { return data_; }
+        iterator end() const { return data_ + size_; }
+
+    private:
+        T *data_;
+        size_t size_;
+};
+
+/**
+ * Array of multi-byte primitives left in LCM (big-endian) wire order.
+ * Elements are byte-swapped on access.
+ */
+template <typename T>
+class be_array
+{
+    public:
+        be_array() : data_(NULL), size_(0) {}
+        be_array(const uint8_t *data, size_t size) : data_(data), size_(size) {}
+
+        size_t size() const { return size_; }
+        bool empty() const { return size_ == 0; }
+        const uint8_t *wire_data() const { return data_; }
+
+        T operator[](size_t i) const
+        {
+            T v;
+            detail::bswap_copy<sizeof(T)>(&v, data_ + i * sizeof(T), 1);
+            return v;
+        }
+
+        void copyTo(T *out) const
+        {
+            detail::bswap_copy<sizeof(T)>(out, data_, size_);
+        }
+
+    private:
+        const uint8_t *data_;
+        size_t size_;
+};
+
+/**
+ * Variable-length array of nested structs. The elements are validated once
+ * by _decodeNoHash() and decoded again, allocation-free, while iterating.
+ *
+ * @tparam V a generated *View type, or a message type without strings or
+ * variable-length arrays.
+ */
+template <typename V>
+class view_array
+{
+    public:
+        class iterator
+        {
+            public:
+                typedef std::forward_iterator_tag iterator_category;
+                typedef V value_type;
+                typedef std::ptrdiff_t difference_type;
+                typedef const V* pointer;
+                typedef const V& reference;
+
+                iterator() : buf_(NULL), pos_(0), maxlen_(0), remaining_(0), len_(0) {}
+                iterator(const void *buf, int pos, int maxlen, int remaining)
+                    : buf_(buf), pos_(pos), maxlen_(maxlen), remaining_(remaining), len_(0)
+                {
+                    load();
+                }
+
+                reference operator*() const { return cur_; }
+                pointer operator->() const { return &cur_; }
+
+                iterator &operator++()
+                {
+                    pos_ += len_;
+                    remaining_--;
+                    load();
+                    return *this;
+                }
+
+                bool operator==(const iterator &o) const { return remaining_ == o.remaining_; }
+                bool operator!=(const iterator &o) const { return remaining_ != o.remaining_; }
+
+            private:
+                void load()
+                {
+                    if (remaining_ > 0)
+                        len_ = cur_._decodeNoHash(buf_, pos_, maxlen_ - pos_);
+                }
+
+                const void *buf_;
+                int pos_;
+                int maxlen_;
+                int remaining_;
+                int len_;
+                V cur_;
+        };
+
+        view_array() : buf_(NULL), offset_(0), end_(0), size_(0) {}
+
+        int size() const { return size_; }
+        bool empty() const { return size_ == 0; }
+
+        iterator begin() const { return iterator(buf_, offset_, end_, size_); }
+        iterator end() const { return iterator(); }
+
+        // LCM support function. Users should not call this
+        int _decodeNoHash(const void *buf, int offset, int maxlen, int elements)
+        {
+            if (elements < 0) return -1;
+            int pos = 0, tlen;
+            V elem;
+            for (int a0 = 0; a0 < elements; a0++) {
+                tlen = elem._decodeNoHash(buf, offset + pos, maxlen - pos);
+                if(tlen < 0) return tlen; else pos += tlen;
+            }
+            buf_ = buf;
+            offset_ = offset;
+            end_ = offset + pos;
+            size_ = elements;
+            return pos;
+        }
+
+    private:
+        const void *buf_;
+        int offset_;
+        int end_;
+        int size_;
+};
+
+}
+
+#endif
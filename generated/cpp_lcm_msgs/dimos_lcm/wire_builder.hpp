@@ -0,0 +1,102 @@
+/**
+ * In-place output for the generated encodeInPlace() methods.
+ *
+ * The hash, lengths, header and other fields are encoded straight into a
+ * caller-provided buffer, such as the send buffer of a transport, while byte
+ * payloads are only given their place in it. The caller then fills each
+ * payload where it will be sent from, so a driver can DMA or convert a frame
+ * into the final packet instead of into the message and then again into the
+ * packet.
+ **/
+
+#ifndef __dimos_lcm_wire_builder_hpp__
+#define __dimos_lcm_wire_builder_hpp__
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "dimos_lcm/view.hpp"
+#include "dimos_lcm/writer.hpp"
+
+namespace dimos_lcm
+{
+
+/**
+ * Writes an encoded message into a fixed buffer, leaving a gap for each byte
+ * payload. Gaps are not written: they hold whatever the buffer held until
+ * the caller fills them through payload().
+ *
+ * Reuse one builder per publisher: reset() keeps the storage for the gaps,
+ * so steady-state encoding does not allocate.
+ */
+class wire_builder : public writer_base<wire_builder>
+{
+    public:
+        wire_builder() : buf_(NULL), capacity_(0), used_(0) {}
+
+        wire_builder(void *buf, size_t capacity)
+            : buf_(static_cast<uint8_t *>(buf)), capacity_(capacity), used_(0) {}
+
+        /**
+         * Start over at the beginning of @p buf.
+         */
+        void reset(void *buf, size_t capacity)
+        {
+            buf_ = static_cast<uint8_t *>(buf);
+            capacity_ = capacity;
+            used_ = 0;
+            payloads_.clear();
+        }
+
+        /**
+         * Number of bytes written so far, gaps included.
+         */
+        size_t size() const { return used_; }
+
+        /**
+         * Number of bytes left in the buffer.
+         */
+        size_t remaining() const { return capacity_ - used_; }
+
+        /**
+         * Number of gaps, one per non-empty byte array in wire order.
+         */
+        size_t payload_count() const { return payloads_.size(); }
+
+        /**
+         * The @p i-th gap, sized by the length field of its array.
+         */
+        span<uint8_t> payload(size_t i = 0) const { return payloads_[i]; }
+
+        /**
+         * Reserve @p n bytes. The generated encodeInPlace() checks that the
+         * message fits before writing anything.
+         */
+        uint8_t *extend(size_t n)
+        {
+            uint8_t *p = buf_ + used_;
+            used_ += n;
+            return p;
+        }
+
+        /**
+         * Leave a gap for @p n payload bytes. @p p is not read, so the message
+         * does not need to hold the payload.
+         */
+        void reference(const void *p, size_t n)
+        {
+            (void)p;
+            payloads_.push_back(span<uint8_t>(extend(n), n));
+        }
+
+    private:
+        uint8_t *buf_;
+        size_t capacity_;
+        size_t used_;
+        std::vector<span<uint8_t> > payloads_;
+};
+
+}
+
+#endif
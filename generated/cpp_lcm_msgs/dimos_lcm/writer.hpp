@@ -0,0 +1,156 @@
+/**
+ * Append-only output for the generated single-pass encoders.
+ *
+ * The generated encodeTo()/encodeIov() walk a message once and append each
+ * field to a writer as they go, instead of sizing the whole tree with
+ * getEncodedSize() and then encoding it in a second walk.
+ **/
+
+#ifndef __dimos_lcm_writer_hpp__
+#define __dimos_lcm_writer_hpp__
+
+#include <lcm/lcm_coretypes.h>
+
+#include <cstddef>
+#include <cstring>
+#include <string>
+#include <vector>
+#if __cplusplus >= 201703L
+#include <string_view>
+#endif
+
+#include "dimos_lcm/bulk_codec.hpp"
+
+namespace dimos_lcm
+{
+
+/**
+ * LCM wire encoding on top of a writer's extend(n), which must return
+ * @p n writable bytes at the end of the output.
+ */
+template <typename Derived>
+class writer_base
+{
+    public:
+        /**
+         * Encode primitives in LCM wire order.
+         */
+        template <typename T>
+        void put(const T *p, int elements)
+        {
+            int n = static_cast<int>(sizeof(T)) * elements;
+            uint8_t *d = self().extend(n);
+            if (sizeof(T) == 1)
+                memcpy(d, p, n);
+            else
+                detail::encode_array(d, 0, n, p, elements);
+        }
+
+        template <typename Alloc>
+        void put(const std::basic_string<char, std::char_traits<char>, Alloc> &s)
+        {
+            int32_t len = static_cast<int32_t>(s.size()) + 1;
+            uint8_t *d = self().extend(4 + len);
+            bulk_encode_array(d, 0, 4, &len, 1);
+            memcpy(d + 4, s.c_str(), len);
+        }
+
+#if __cplusplus >= 201703L
+        /**
+         * Encode an interned_string, or any string that is not NUL-terminated.
+         */
+        void put(std::string_view s)
+        {
+            int32_t len = static_cast<int32_t>(s.size()) + 1;
+            uint8_t *d = self().extend(4 + len);
+            bulk_encode_array(d, 0, 4, &len, 1);
+            memcpy(d + 4, s.data(), len - 1);
+            d[4 + len - 1] = 0;
+        }
+#endif
+
+        /**
+         * Encode a message without its hash through its buffer codec. Meant for
+         * fixed-size types, whose encoded size is a constant.
+         */
+        template <typename Msg>
+        void putStruct(const Msg &msg)
+        {
+            int n = msg._getEncodedSizeNoHash();
+            msg._encodeNoHash(self().extend(n), 0, n);
+        }
+
+        /**
+         * Encode an array of fixed-size messages, reserving space for all of
+         * them at once.
+         */
+        template <typename Msg>
+        void putStructArray(const Msg *msgs, int elements)
+        {
+            const int n = Msg::kEncodedSize - 8;
+            uint8_t *d = self().extend(static_cast<size_t>(n) * elements);
+            for (int i = 0; i < elements; i++)
+                msgs[i]._encodeNoHash(d + static_cast<size_t>(n) * i, 0, n);
+        }
+
+    private:
+        Derived &self() { return static_cast<Derived &>(*this); }
+};
+
+/**
+ * Appends to a std::vector. The vector is grown in chunks, at least doubling
+ * each time, and trimmed to the bytes actually written when the writer goes
+ * out of scope.
+ */
+class vector_writer : public writer_base<vector_writer>
+{
+    public:
+        explicit vector_writer(std::vector<uint8_t> &buf)
+            : buf_(buf), start_(buf.size()), used_(buf.size()) {}
+
+        ~vector_writer() { buf_.resize(used_); }
+
+        /**
+         * Number of bytes appended by this writer.
+         */
+        size_t size() const { return used_ - start_; }
+
+        uint8_t *extend(size_t n)
+        {
+            if (used_ + n > buf_.size())
+                grow(n);
+            uint8_t *p = buf_.data() + used_;
+            used_ += n;
+            return p;
+        }
+
+        void reference(const void *p, size_t n)
+        {
+            memcpy(extend(n), p, n);
+        }
+
+    private:
+        void grow(size_t n)
+        {
+            // A cleared vector keeps its capacity: use it before doubling, so
+            // a reused buffer is zero-filled once per message, not per step
+            if (used_ + n <= buf_.capacity()) {
+                buf_.resize(buf_.capacity());
+                return;
+            }
+            size_t size = 2 * buf_.size();
+            if (size < used_ + n)
+                size = used_ + n;
+            if (size < 256)
+                size = 256;
+            buf_.resize(size);
+        }
+
+        std::vector<uint8_t> &buf_;
+        size_t start_;
+        size_t used_;
+};
+
+}
+
+#endif
@@ -1,7 +1,7 @@
 /** THIS IS AN AUTOMATICALLY GENERATED FILE.  DO NOT MODIFY
  * BY HAND!!
  *
- * Generated by lcm-gen 1.5.2
+ * Generated by lcm-cpp (tools/cpp/gen)
  **/
 
 #ifndef __foxglove_msgs_ArrowPrimitive_hpp__
@@ -9,6 +9,11 @@
 
 #include <lcm/lcm_coretypes.h>
 
+#include <array>
+#include "dimos_lcm/fixed_codec.hpp"
+#include "dimos_lcm/writer.hpp"
+#include "dimos_lcm/fingerprint.hpp"
+#include "dimos_lcm/reflection.hpp"
 #include "geometry_msgs/Pose.hpp"
 #include "foxglove_msgs/Color.hpp"
 
@@ -42,11 +47,26 @@ class ArrowPrimitive
          */
         inline int encode(void *buf, int offset, int maxlen) const;
 
+        /**
+         * Encode a message by appending it to @p buf, walking the message once
+         * instead of sizing it with getEncodedSize() first. @p buf grows
+         * geometrically; reuse it across calls to avoid reallocating.
+         *
+         * @return The number of bytes appended.
+         */
+        inline int encodeTo(std::vector<uint8_t> &buf) const;
+
         /**
          * Check how many bytes are required to encode this message.
          */
         inline int getEncodedSize() const;
 
+        /**
+         * getEncodedSize() of every instance: the type has no strings or
+         * variable-length arrays.
+         */
+        static constexpr int kEncodedSize = 128;
+
         /**
          * Decode a message from binary form into this instance.
          *
@@ -65,18 +85,54 @@ class ArrowPrimitive
          */
         inline static int64_t getHash();
 
+        /**
+         * The fingerprint returned by getHash(), as a compile-time constant.
+         */
+        static constexpr int64_t kHash = static_cast<int64_t>(0x12a4e809847e2768ULL);
+
         /**
          * Returns "ArrowPrimitive"
          */
         inline static const char* getTypeName();
 
+        /**
+         * Name, LCM type and array dimensions of each field, in wire order.
+         * See dimos_lcm::for_each_field() for visiting the fields themselves.
+         */
+        static constexpr std::array<dimos_lcm::field_info, 6> kFields = {{
+            { "pose", "geometry_msgs.Pose", false, 0, 0, NULL },
+            { "shaft_length", "double", true, 0, 0, NULL },
+            { "shaft_diameter", "double", true, 0, 0, NULL },
+            { "head_length", "double", true, 0, 0, NULL },
+            { "head_diameter", "double", true, 0, 0, NULL },
+            { "color", "foxglove_msgs.Color", false, 0, 0, NULL },
+        }};
+
         // LCM support functions. Users should not call these
         inline int _encodeNoHash(void *buf, int offset, int maxlen) const;
+        template <typename Writer>
+        inline void _writeNoHash(Writer &out) const;
         inline int _getEncodedSizeNoHash() const;
         inline int _decodeNoHash(const void *buf, int offset, int maxlen);
+        template <typename Self, typename Visitor>
+        inline static void _forEachField(Self &self, Visitor &visitor);
+        inline static int _skipNoHash(const void *buf, int offset, int maxlen);
         inline static uint64_t _computeHash(const __lcm_hash_ptr *p);
 };
 
+static_assert(ArrowPrimitive::kHash == dimos_lcm::fingerprint(
+    dimos_lcm::signature_hash()
+        .member("pose", NULL, 0)
+        .member("shaft_length", "double", 0)
+        .member("shaft_diameter", "double", 0)
+        .member("head_length", "double", 0)
+        .member("head_diameter", "double", 0)
+        .member("color", NULL, 0)
+        .value(),
+    geometry_msgs::Pose::kHash,
+    foxglove_msgs::Color::kHash),
+    "foxglove_msgs::ArrowPrimitive fingerprint does not match its definition");
+
 int ArrowPrimitive::encode(void *buf, int offset, int maxlen) const
 {
     int pos = 0, tlen;
@@ -91,6 +147,15 @@ int ArrowPrimitive::encode(void *buf, int offset, int maxlen) const
     return pos;
 }
 
+int ArrowPrimitive::encodeTo(std::vector<uint8_t> &buf) const
+{
+    dimos_lcm::vector_writer out(buf);
+    int64_t hash = getHash();
+    out.put(&hash, 1);
+    this->_writeNoHash(out);
+    return static_cast<int>(out.size());
+}
+
 int ArrowPrimitive::decode(const void *buf, int offset, int maxlen)
 {
     int pos = 0, thislen;
@@ -113,8 +178,7 @@ int ArrowPrimitive::getEncodedSize() const
 
 int64_t ArrowPrimitive::getHash()
 {
-    static int64_t hash = static_cast<int64_t>(_computeHash(NULL));
-    return hash;
+    return kHash;
 }
 
 const char* ArrowPrimitive::getTypeName()
@@ -124,64 +188,73 @@ const char* ArrowPrimitive::getTypeName()
 
 int ArrowPrimitive::_encodeNoHash(void *buf, int offset, int maxlen) const
 {
-    int pos = 0, tlen;
-
-    tlen = this->pose._encodeNoHash(buf, offset + pos, maxlen - pos);
-    if(tlen < 0) return tlen; else pos += tlen;
-
-    tlen = __double_encode_array(buf, offset + pos, maxlen - pos, &this->shaft_length, 1);
-    if(tlen < 0) return tlen; else pos += tlen;
-
-    tlen = __double_encode_array(buf, offset + pos, maxlen - pos, &this->shaft_diameter, 1);
-    if(tlen < 0) return tlen; else pos += tlen;
-
-    tlen = __double_encode_array(buf, offset + pos, maxlen - pos, &this->head_length, 1);
-    if(tlen < 0) return tlen; else pos += tlen;
-
-    tlen = __double_encode_array(buf, offset + pos, maxlen - pos, &this->head_diameter, 1);
-    if(tlen < 0) return tlen; else pos += tlen;
-
-    tlen = this->color._encodeNoHash(buf, offset + pos, maxlen - pos);
-    if(tlen < 0) return tlen; else pos += tlen;
+    if(maxlen < kEncodedSize - 8) return -1;
+    uint8_t *p = static_cast<uint8_t*>(buf) + offset;
+    dimos_lcm::store_be(p + 0, this->pose.position.x);
+    dimos_lcm::store_be(p + 8, this->pose.position.y);
+    dimos_lcm::store_be(p + 16, this->pose.position.z);
+    dimos_lcm::store_be(p + 24, this->pose.orientation.x);
+    dimos_lcm::store_be(p + 32, this->pose.orientation.y);
+    dimos_lcm::store_be(p + 40, this->pose.orientation.z);
+    dimos_lcm::store_be(p + 48, this->pose.orientation.w);
+    dimos_lcm::store_be(p + 56, this->shaft_length);
+    dimos_lcm::store_be(p + 64, this->shaft_diameter);
+    dimos_lcm::store_be(p + 72, this->head_length);
+    dimos_lcm::store_be(p + 80, this->head_diameter);
+    dimos_lcm::store_be(p + 88, this->color.r);
+    dimos_lcm::store_be(p + 96, this->color.g);
+    dimos_lcm::store_be(p + 104, this->color.b);
+    dimos_lcm::store_be(p + 112, this->color.a);
+    return kEncodedSize - 8;
+}
 
-    return pos;
+template <typename Writer>
+void ArrowPrimitive::_writeNoHash(Writer &out) const
+{
+    out.putStruct(*this);
 }
 
 int ArrowPrimitive::_decodeNoHash(const void *buf, int offset, int maxlen)
 {
-    int pos = 0, tlen;
-
-    tlen = this->pose._decodeNoHash(buf, offset + pos, maxlen - pos);
-    if(tlen < 0) return tlen; else pos += tlen;
-
-    tlen = __double_decode_array(buf, offset + pos, maxlen - pos, &this->shaft_length, 1);
-    if(tlen < 0) return tlen; else pos += tlen;
-
-    tlen = __double_decode_array(buf, offset + pos, maxlen - pos, &this->shaft_diameter, 1);
-    if(tlen < 0) return tlen; else pos += tlen;
-
-    tlen = __double_decode_array(buf, offset + pos, maxlen - pos, &this->head_length, 1);
-    if(tlen < 0) return tlen; else pos += tlen;
-
-    tlen = __double_decode_array(buf, offset + pos, maxlen - pos, &this->head_diameter, 1);
-    if(tlen < 0) return tlen; else pos += tlen;
+    if(maxlen < kEncodedSize - 8) return -1;
+    const uint8_t *p = static_cast<const uint8_t*>(buf) + offset;
+    dimos_lcm::load_be(p + 0, this->pose.position.x);
+    dimos_lcm::load_be(p + 8, this->pose.position.y);
+    dimos_lcm::load_be(p + 16, this->pose.position.z);
+    dimos_lcm::load_be(p + 24, this->pose.orientation.x);
+    dimos_lcm::load_be(p + 32, this->pose.orientation.y);
+    dimos_lcm::load_be(p + 40, this->pose.orientation.z);
+    dimos_lcm::load_be(p + 48, this->pose.orientation.w);
+    dimos_lcm::load_be(p + 56, this->shaft_length);
+    dimos_lcm::load_be(p + 64, this->shaft_diameter);
+    dimos_lcm::load_be(p + 72, this->head_length);
+    dimos_lcm::load_be(p + 80, this->head_diameter);
+    dimos_lcm::load_be(p + 88, this->color.r);
+    dimos_lcm::load_be(p + 96, this->color.g);
+    dimos_lcm::load_be(p + 104, this->color.b);
+    dimos_lcm::load_be(p + 112, this->color.a);
+    return kEncodedSize - 8;
+}
 
-    tlen = this->color._decodeNoHash(buf, offset + pos, maxlen - pos);
-    if(tlen < 0) return tlen; else pos += tlen;
+int ArrowPrimitive::_getEncodedSizeNoHash() const
+{
+    return kEncodedSize - 8;
+}
 
-    return pos;
+int ArrowPrimitive::_skipNoHash(const void *, int, int maxlen)
+{
+    return maxlen < kEncodedSize - 8 ? -1 : kEncodedSize - 8;
 }
 
-int ArrowPrimitive::_getEncodedSizeNoHash() const
+template <typename Self, typename Visitor>
+void ArrowPrimitive::_forEachField(Self &self, Visitor &visitor)
 {
-    int enc_size = 0;
-    enc_size += this->pose._getEncodedSizeNoHash();
-    enc_size += __double_encoded_array_size(NULL, 1);
-    enc_size += __double_encoded_array_size(NULL, 1);
-    enc_size += __double_encoded_array_size(NULL, 1);
-    enc_size += __double_encoded_array_size(NULL, 1);
-    enc_size += this->color._getEncodedSizeNoHash();
-    return enc_size;
+    visitor(kFields[0], self.pose);
+    visitor(kFields[1], self.shaft_length);
+    visitor(kFields[2], self.shaft_diameter);
+    visitor(kFields[3], self.head_length);
+    visitor(kFields[4], self.head_diameter);
+    visitor(kFields[5], self.color);
 }
 
 uint64_t ArrowPrimitive::_computeHash(const __lcm_hash_ptr *p)
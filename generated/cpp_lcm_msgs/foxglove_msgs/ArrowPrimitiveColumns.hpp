@@ -0,0 +1,259 @@
+/** THIS IS AN AUTOMATICALLY GENERATED FILE.  DO NOT MODIFY
+ * BY HAND!!
+ *
+ * Generated by lcm-cpp (tools/cpp/gen)
+ **/
+
+#ifndef __foxglove_msgs_ArrowPrimitiveColumns_hpp__
+#define __foxglove_msgs_ArrowPrimitiveColumns_hpp__
+
+#include <lcm/lcm_coretypes.h>
+
+#include <vector>
+#include "dimos_lcm/fixed_codec.hpp"
+#include "foxglove_msgs/ArrowPrimitive.hpp"
+
+namespace foxglove_msgs
+{
+
+/**
+ * Structure-of-arrays storage for a sequence of foxglove_msgs.ArrowPrimitive: one
+ * contiguous array per field, with nested fields flattened and named by their
+ * path (pose_position_x, pose_position_y, ...). The soa:: message classes hold their
+ * ArrowPrimitive arrays this way and decode them straight into the columns.
+ */
+class ArrowPrimitiveColumns
+{
+    public:
+        // pose.position.x
+        std::vector< double > pose_position_x;
+
+        // pose.position.y
+        std::vector< double > pose_position_y;
+
+        // pose.position.z
+        std::vector< double > pose_position_z;
+
+        // pose.orientation.x
+        std::vector< double > pose_orientation_x;
+
+        // pose.orientation.y
+        std::vector< double > pose_orientation_y;
+
+        // pose.orientation.z
+        std::vector< double > pose_orientation_z;
+
+        // pose.orientation.w
+        std::vector< double > pose_orientation_w;
+
+        std::vector< double > shaft_length;
+
+        std::vector< double > shaft_diameter;
+
+        std::vector< double > head_length;
+
+        std::vector< double > head_diameter;
+
+        // color.r
+        std::vector< double > color_r;
+
+        // color.g
+        std::vector< double > color_g;
+
+        // color.b
+        std::vector< double > color_b;
+
+        // color.a
+        std::vector< double > color_a;
+
+    public:
+        /**
+         * Number of elements.
+         */
+        inline int size() const;
+
+        /**
+         * Resize every column to @p n elements.
+         */
+        inline void resize(int n);
+
+        /**
+         * Gather element @p i into a ArrowPrimitive.
+         */
+        inline foxglove_msgs::ArrowPrimitive get(int i) const;
+
+        /**
+         * Scatter @p msg into element @p i.
+         */
+        inline void set(int i, const foxglove_msgs::ArrowPrimitive &msg);
+
+        // LCM support functions. Users should not call these
+        inline int _encodeNoHash(void *buf, int offset, int maxlen, int n) const;
+        template <typename Writer>
+        inline void _writeNoHash(Writer &out, int n) const;
+        inline int _getEncodedSizeNoHash(int n) const;
+        inline int _decodeNoHash(const void *buf, int offset, int maxlen, int n);
+};
+
+int ArrowPrimitiveColumns::size() const
+{
+    return static_cast<int>(this->pose_position_x.size());
+}
+
+void ArrowPrimitiveColumns::resize(int n)
+{
+    this->pose_position_x.resize(n);
+    this->pose_position_y.resize(n);
+    this->pose_position_z.resize(n);
+    this->pose_orientation_x.resize(n);
+    this->pose_orientation_y.resize(n);
+    this->pose_orientation_z.resize(n);
+    this->pose_orientation_w.resize(n);
+    this->shaft_length.resize(n);
+    this->shaft_diameter.resize(n);
+    this->head_length.resize(n);
+    this->head_diameter.resize(n);
+    this->color_r.resize(n);
+    this->color_g.resize(n);
+    this->color_b.resize(n);
+    this->color_a.resize(n);
+}
+
+foxglove_msgs::ArrowPrimitive ArrowPrimitiveColumns::get(int i) const
+{
+    foxglove_msgs::ArrowPrimitive msg;
+    msg.pose.position.x = this->pose_position_x[i];
+    msg.pose.position.y = this->pose_position_y[i];
+    msg.pose.position.z = this->pose_position_z[i];
+    msg.pose.orientation.x = this->pose_orientation_x[i];
+    msg.pose.orientation.y = this->pose_orientation_y[i];
+    msg.pose.orientation.z = this->pose_orientation_z[i];
+    msg.pose.orientation.w = this->pose_orientation_w[i];
+    msg.shaft_length = this->shaft_length[i];
+    msg.shaft_diameter = this->shaft_diameter[i];
+    msg.head_length = this->head_length[i];
+    msg.head_diameter = this->head_diameter[i];
+    msg.color.r = this->color_r[i];
+    msg.color.g = this->color_g[i];
+    msg.color.b = this->color_b[i];
+    msg.color.a = this->color_a[i];
+    return msg;
+}
+
+void ArrowPrimitiveColumns::set(int i, const foxglove_msgs::ArrowPrimitive &msg)
+{
+    this->pose_position_x[i] = msg.pose.position.x;
+    this->pose_position_y[i] = msg.pose.position.y;
+    this->pose_position_z[i] = msg.pose.position.z;
+    this->pose_orientation_x[i] = msg.pose.orientation.x;
+    this->pose_orientation_y[i] = msg.pose.orientation.y;
+    this->pose_orientation_z[i] = msg.pose.orientation.z;
+    this->pose_orientation_w[i] = msg.pose.orientation.w;
+    this->shaft_length[i] = msg.shaft_length;
+    this->shaft_diameter[i] = msg.shaft_diameter;
+    this->head_length[i] = msg.head_length;
+    this->head_diameter[i] = msg.head_diameter;
+    this->color_r[i] = msg.color.r;
+    this->color_g[i] = msg.color.g;
+    this->color_b[i] = msg.color.b;
+    this->color_a[i] = msg.color.a;
+}
+
+int ArrowPrimitiveColumns::_encodeNoHash(void *buf, int offset, int maxlen, int n) const
+{
+    uint8_t *p = static_cast<uint8_t*>(buf) + offset;
+    int pos = 0;
+    for (int i = 0; i < n; i++) {
+        if(maxlen - pos < 120) return -1;
+        dimos_lcm::store_be(p + pos + 0, this->pose_position_x[i]);
+        dimos_lcm::store_be(p + pos + 8, this->pose_position_y[i]);
+        dimos_lcm::store_be(p + pos + 16, this->pose_position_z[i]);
+        dimos_lcm::store_be(p + pos + 24, this->pose_orientation_x[i]);
+        dimos_lcm::store_be(p + pos + 32, this->pose_orientation_y[i]);
+        dimos_lcm::store_be(p + pos + 40, this->pose_orientation_z[i]);
+        dimos_lcm::store_be(p + pos + 48, this->pose_orientation_w[i]);
+        dimos_lcm::store_be(p + pos + 56, this->shaft_length[i]);
+        dimos_lcm::store_be(p + pos + 64, this->shaft_diameter[i]);
+        dimos_lcm::store_be(p + pos + 72, this->head_length[i]);
+        dimos_lcm::store_be(p + pos + 80, this->head_diameter[i]);
+        dimos_lcm::store_be(p + pos + 88, this->color_r[i]);
+        dimos_lcm::store_be(p + pos + 96, this->color_g[i]);
+        dimos_lcm::store_be(p + pos + 104, this->color_b[i]);
+        dimos_lcm::store_be(p + pos + 112, this->color_a[i]);
+        pos += 120;
+    }
+    return pos;
+}
+
+template <typename Writer>
+void ArrowPrimitiveColumns::_writeNoHash(Writer &out, int n) const
+{
+    if(n <= 0) return;
+    uint8_t *p = out.extend(static_cast<size_t>(n) * 120);
+    for (int i = 0; i < n; i++, p += 120) {
+        dimos_lcm::store_be(p + 0, this->pose_position_x[i]);
+        dimos_lcm::store_be(p + 8, this->pose_position_y[i]);
+        dimos_lcm::store_be(p + 16, this->pose_position_z[i]);
+        dimos_lcm::store_be(p + 24, this->pose_orientation_x[i]);
+        dimos_lcm::store_be(p + 32, this->pose_orientation_y[i]);
+        dimos_lcm::store_be(p + 40, this->pose_orientation_z[i]);
+        dimos_lcm::store_be(p + 48, this->pose_orientation_w[i]);
+        dimos_lcm::store_be(p + 56, this->shaft_length[i]);
+        dimos_lcm::store_be(p + 64, this->shaft_diameter[i]);
+        dimos_lcm::store_be(p + 72, this->head_length[i]);
+        dimos_lcm::store_be(p + 80, this->head_diameter[i]);
+        dimos_lcm::store_be(p + 88, this->color_r[i]);
+        dimos_lcm::store_be(p + 96, this->color_g[i]);
+        dimos_lcm::store_be(p + 104, this->color_b[i]);
+        dimos_lcm::store_be(p + 112, this->color_a[i]);
+    }
+}
+
+int ArrowPrimitiveColumns::_getEncodedSizeNoHash(int n) const
+{
+    return n * 120;
+}
+
+int ArrowPrimitiveColumns::_decodeNoHash(const void *buf, int offset, int maxlen, int n)
+{
+    if(n < 0 || n > maxlen / 120) return -1;
+    this->resize(n);
+    const uint8_t *p = static_cast<const uint8_t*>(buf) + offset;
+    double *pose_position_x = this->pose_position_x.data();
+    double *pose_position_y = this->pose_position_y.data();
+    double *pose_position_z = this->pose_position_z.data();
+    double *pose_orientation_x = this->pose_orientation_x.data();
+    double *pose_orientation_y = this->pose_orientation_y.data();
+    double *pose_orientation_z = this->pose_orientation_z.data();
+    double *pose_orientation_w = this->pose_orientation_w.data();
+    double *shaft_length = this->shaft_length.data();
+    double *shaft_diameter = this->shaft_diameter.data();
+    double *head_length = this->head_length.data();
+    double *head_diameter = this->head_diameter.data();
+    double *color_r = this->color_r.data();
+    double *color_g = this->color_g.data();
+    double *color_b = this->color_b.data();
+    double *color_a = this->color_a.data();
+    for (int i = 0; i < n; i++, p += 120) {
+        dimos_lcm::load_be(p + 0, pose_position_x[i]);
+        dimos_lcm::load_be(p + 8, pose_position_y[i]);
+        dimos_lcm::load_be(p + 16, pose_position_z[i]);
+        dimos_lcm::load_be(p + 24, pose_orientation_x[i]);
+        dimos_lcm::load_be(p + 32, pose_orientation_y[i]);
+        dimos_lcm::load_be(p + 40, pose_orientation_z[i]);
+        dimos_lcm::load_be(p + 48, pose_orientation_w[i]);
+        dimos_lcm::load_be(p + 56, shaft_length[i]);
+        dimos_lcm::load_be(p + 64, shaft_diameter[i]);
+        dimos_lcm::load_be(p + 72, head_length[i]);
+        dimos_lcm::load_be(p + 80, head_diameter[i]);
+        dimos_lcm::load_be(p + 88, color_r[i]);
+        dimos_lcm::load_be(p + 96, color_g[i]);
+        dimos_lcm::load_be(p + 104, color_b[i]);
+        dimos_lcm::load_be(p + 112, color_a[i]);
+    }
+    return n * 120;
+}
+
+}
+
+#endif
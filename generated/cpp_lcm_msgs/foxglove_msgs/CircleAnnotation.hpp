@@ -1,7 +1,7 @@
 /** THIS IS AN AUTOMATICALLY GENERATED FILE.  DO NOT MODIFY
  * BY HAND!!
  *
- * Generated by lcm-gen 1.5.2
+ * Generated by lcm-cpp (tools/cpp/gen)
  **/
 
 #ifndef __foxglove_msgs_CircleAnnotation_hpp__
@@ -9,10 +9,14 @@
 
 #include <lcm/lcm_coretypes.h>
 
+#include <array>
+#include "dimos_lcm/fixed_codec.hpp"
+#include "dimos_lcm/writer.hpp"
+#include "dimos_lcm/fingerprint.hpp"
+#include "dimos_lcm/reflection.hpp"
 #include "builtin_interfaces/Time.hpp"
 #include "foxglove_msgs/Point2.hpp"
 #include "foxglove_msgs/Color.hpp"
-#include "foxglove_msgs/Color.hpp"
 
 namespace foxglove_msgs
 {
@@ -44,11 +48,26 @@ class CircleAnnotation
          */
         inline int encode(void *buf, int offset, int maxlen) const;
 
+        /**
+         * Encode a message by appending it to @p buf, walking the message once
+         * instead of sizing it with getEncodedSize() first. @p buf grows
+         * geometrically; reuse it across calls to avoid reallocating.
+         *
+         * @return The number of bytes appended.
+         */
+        inline int encodeTo(std::vector<uint8_t> &buf) const;
+
         /**
          * Check how many bytes are required to encode this message.
          */
         inline int getEncodedSize() const;
 
+        /**
+         * getEncodedSize() of every instance: the type has no strings or
+         * variable-length arrays.
+         */
+        static constexpr int kEncodedSize = 112;
+
         /**
          * Decode a message from binary form into this instance.
          *
@@ -67,18 +86,56 @@ class CircleAnnotation
          */
         inline static int64_t getHash();
 
+        /**
+         * The fingerprint returned by getHash(), as a compile-time constant.
+         */
+        static constexpr int64_t kHash = static_cast<int64_t>(0x62d00f3f0cc712a7ULL);
+
         /**
          * Returns "CircleAnnotation"
          */
         inline static const char* getTypeName();
 
+        /**
+         * Name, LCM type and array dimensions of each field, in wire order.
+         * See dimos_lcm::for_each_field() for visiting the fields themselves.
+         */
+        static constexpr std::array<dimos_lcm::field_info, 6> kFields = {{
+            { "timestamp", "builtin_interfaces.Time", false, 0, 0, NULL },
+            { "position", "foxglove_msgs.Point2", false, 0, 0, NULL },
+            { "diameter", "double", true, 0, 0, NULL },
+            { "thickness", "double", true, 0, 0, NULL },
+            { "fill_color", "foxglove_msgs.Color", false, 0, 0, NULL },
+            { "outline_color", "foxglove_msgs.Color", false, 0, 0, NULL },
+        }};
+
         // LCM support functions. Users should not call these
         inline int _encodeNoHash(void *buf, int offset, int maxlen) const;
+        template <typename Writer>
+        inline void _writeNoHash(Writer &out) const;
         inline int _getEncodedSizeNoHash() const;
         inline int _decodeNoHash(const void *buf, int offset, int maxlen);
+        template <typename Self, typename Visitor>
+        inline static void _forEachField(Self &self, Visitor &visitor);
+        inline static int _skipNoHash(const void *buf, int offset, int maxlen);
         inline static uint64_t _computeHash(const __lcm_hash_ptr *p);
 };
 
+static_assert(CircleAnnotation::kHash == dimos_lcm::fingerprint(
+    dimos_lcm::signature_hash()
+        .member("timestamp", NULL, 0)
+        .member("position", NULL, 0)
+        .member("diameter", "double", 0)
+        .member("thickness", "double", 0)
+        .member("fill_color", NULL, 0)
+        .member("outline_color", NULL, 0)
+        .value(),
+    builtin_interfaces::Time::kHash,
+    foxglove_msgs::Point2::kHash,
+    foxglove_msgs::Color::kHash,
+    foxglove_msgs::Color::kHash),
+    "foxglove_msgs::CircleAnnotation fingerprint does not match its definition");
+
 int CircleAnnotation::encode(void *buf, int offset, int maxlen) const
 {
     int pos = 0, tlen;
@@ -93,6 +150,15 @@ int CircleAnnotation::encode(void *buf, int offset, int maxlen) const
     return pos;
 }
 
+int CircleAnnotation::encodeTo(std::vector<uint8_t> &buf) const
+{
+    dimos_lcm::vector_writer out(buf);
+    int64_t hash = getHash();
+    out.put(&hash, 1);
+    this->_writeNoHash(out);
+    return static_cast<int>(out.size());
+}
+
 int CircleAnnotation::decode(const void *buf, int offset, int maxlen)
 {
     int pos = 0, thislen;
@@ -115,8 +181,7 @@ int CircleAnnotation::getEncodedSize() const
 
 int64_t CircleAnnotation::getHash()
 {
-    static int64_t hash = static_cast<int64_t>(_computeHash(NULL));
-    return hash;
+    return kHash;
 }
 
 const char* CircleAnnotation::getTypeName()
@@ -126,64 +191,71 @@ const char* CircleAnnotation::getTypeName()
 
 int CircleAnnotation::_encodeNoHash(void *buf, int offset, int maxlen) const
 {
-    int pos = 0, tlen;
-
-    tlen = this->timestamp._encodeNoHash(buf, offset + pos, maxlen - pos);
-    if(tlen < 0) return tlen; else pos += tlen;
-
-    tlen = this->position._encodeNoHash(buf, offset + pos, maxlen - pos);
-    if(tlen < 0) return tlen; else pos += tlen;
-
-    tlen = __double_encode_array(buf, offset + pos, maxlen - pos, &this->diameter, 1);
-    if(tlen < 0) return tlen; else pos += tlen;
-
-    tlen = __double_encode_array(buf, offset + pos, maxlen - pos, &this->thickness, 1);
-    if(tlen < 0) return tlen; else pos += tlen;
-
-    tlen = this->fill_color._encodeNoHash(buf, offset + pos, maxlen - pos);
-    if(tlen < 0) return tlen; else pos += tlen;
-
-    tlen = this->outline_color._encodeNoHash(buf, offset + pos, maxlen - pos);
-    if(tlen < 0) return tlen; else pos += tlen;
+    if(maxlen < kEncodedSize - 8) return -1;
+    uint8_t *p = static_cast<uint8_t*>(buf) + offset;
+    dimos_lcm::store_be(p + 0, this->timestamp.sec);
+    dimos_lcm::store_be(p + 4, this->timestamp.nanosec);
+    dimos_lcm::store_be(p + 8, this->position.x);
+    dimos_lcm::store_be(p + 16, this->position.y);
+    dimos_lcm::store_be(p + 24, this->diameter);
+    dimos_lcm::store_be(p + 32, this->thickness);
+    dimos_lcm::store_be(p + 40, this->fill_color.r);
+    dimos_lcm::store_be(p + 48, this->fill_color.g);
+    dimos_lcm::store_be(p + 56, this->fill_color.b);
+    dimos_lcm::store_be(p + 64, this->fill_color.a);
+    dimos_lcm::store_be(p + 72, this->outline_color.r);
+    dimos_lcm::store_be(p + 80, this->outline_color.g);
+    dimos_lcm::store_be(p + 88, this->outline_color.b);
+    dimos_lcm::store_be(p + 96, this->outline_color.a);
+    return kEncodedSize - 8;
+}
 
-    return pos;
+template <typename Writer>
+void CircleAnnotation::_writeNoHash(Writer &out) const
+{
+    out.putStruct(*this);
 }
 
 int CircleAnnotation::_decodeNoHash(const void *buf, int offset, int maxlen)
 {
-    int pos = 0, tlen;
-
-    tlen = this->timestamp._decodeNoHash(buf, offset + pos, maxlen - pos);
-    if(tlen < 0) return tlen; else pos += tlen;
-
-    tlen = this->position._decodeNoHash(buf, offset + pos, maxlen - pos);
-    if(tlen < 0) return tlen; else pos += tlen;
-
-    tlen = __double_decode_array(buf, offset + pos, maxlen - pos, &this->diameter, 1);
-    if(tlen < 0) return tlen; else pos += tlen;
-
-    tlen = __double_decode_array(buf, offset + pos, maxlen - pos, &this->thickness, 1);
-    if(tlen < 0) return tlen; else pos += tlen;
-
-    tlen = this->fill_color._decodeNoHash(buf, offset + pos, maxlen - pos);
-    if(tlen < 0) return tlen; else pos += tlen;
+    if(maxlen < kEncodedSize - 8) return -1;
+    const uint8_t *p = static_cast<const uint8_t*>(buf) + offset;
+    dimos_lcm::load_be(p + 0, this->timestamp.sec);
+    dimos_lcm::load_be(p + 4, this->timestamp.nanosec);
+    dimos_lcm::load_be(p + 8, this->position.x);
+    dimos_lcm::load_be(p + 16, this->position.y);
+    dimos_lcm::load_be(p + 24, this->diameter);
+    dimos_lcm::load_be(p + 32, this->thickness);
+    dimos_lcm::load_be(p + 40, this->fill_color.r);
+    dimos_lcm::load_be(p + 48, this->fill_color.g);
+    dimos_lcm::load_be(p + 56, this->fill_color.b);
+    dimos_lcm::load_be(p + 64, this->fill_color.a);
+    dimos_lcm::load_be(p + 72, this->outline_color.r);
+    dimos_lcm::load_be(p + 80, this->outline_color.g);
+    dimos_lcm::load_be(p + 88, this->outline_color.b);
+    dimos_lcm::load_be(p + 96, this->outline_color.a);
+    return kEncodedSize - 8;
+}
 
-    tlen = this->outline_color._decodeNoHash(buf, offset + pos, maxlen - pos);
-    if(tlen < 0) return tlen; else pos += tlen;
+int CircleAnnotation::_getEncodedSizeNoHash() const
+{
+    return kEncodedSize - 8;
+}
 
-    return pos;
+int CircleAnnotation::_skipNoHash(const void *, int, int maxlen)
+{
+    return maxlen < kEncodedSize - 8 ? -1 : kEncodedSize - 8;
 }
 
-int CircleAnnotation::_getEncodedSizeNoHash() const
+template <typename Self, typename Visitor>
+void CircleAnnotation::_forEachField(Self &self, Visitor &visitor)
 {
-    int enc_size = 0;
-    enc_size += this->timestamp._getEncodedSizeNoHash();
-    enc_size += this->position._getEncodedSizeNoHash();
-    enc_size += __double_encoded_array_size(NULL, 1);
-    enc_size += __double_encoded_array_size(NULL, 1);
-    enc_size += this->fill_color._getEncodedSizeNoHash();
-    enc_size += this->outline_color._getEncodedSizeNoHash();
-    return enc_size;
+    visitor(kFields[0], self.timestamp);
+    visitor(kFields[1], self.position);
+    visitor(kFields[2], self.diameter);
+    visitor(kFields[3], self.thickness);
+    visitor(kFields[4], self.fill_color);
+    visitor(kFields[5], self.outline_color);
 }
 
 uint64_t CircleAnnotation::_computeHash(const __lcm_hash_ptr *p)
@@ -0,0 +1,251 @@
+/** THIS IS AN AUTOMATICALLY GENERATED FILE.  DO NOT MODIFY
+ * BY HAND!!
+ *
+ * Generated by lcm-cpp (tools/cpp/gen)
+ **/
+
+#ifndef __foxglove_msgs_CircleAnnotationColumns_hpp__
+#define __foxglove_msgs_CircleAnnotationColumns_hpp__
+
+#include <lcm/lcm_coretypes.h>
+
+#include <vector>
+#include "dimos_lcm/fixed_codec.hpp"
+#include "foxglove_msgs/CircleAnnotation.hpp"
+
+namespace foxglove_msgs
+{
+
+/**
+ * Structure-of-arrays storage for a sequence of foxglove_msgs.CircleAnnotation: one
+ * contiguous array per field, with nested fields flattened and named by their
+ * path (timestamp_sec, timestamp_nanosec, ...). The soa:: message classes hold their
+ * CircleAnnotation arrays this way and decode them straight into the columns.
+ */
+class CircleAnnotationColumns
+{
+    public:
+        // timestamp.sec
+        std::vector< int32_t > timestamp_sec;
+
+        // timestamp.nanosec
+        std::vector< int32_t > timestamp_nanosec;
+
+        // position.x
+        std::vector< double > position_x;
+
+        // position.y
+        std::vector< double > position_y;
+
+        std::vector< double > diameter;
+
+        std::vector< double > thickness;
+
+        // fill_color.r
+        std::vector< double > fill_color_r;
+
+        // fill_color.g
+        std::vector< double > fill_color_g;
+
+        // fill_color.b
+        std::vector< double > fill_color_b;
+
+        // fill_color.a
+        std::vector< double > fill_color_a;
+
+        // outline_color.r
+        std::vector< double > outline_color_r;
+
+        // outline_color.g
+        std::vector< double > outline_color_g;
+
+        // outline_color.b
+        std::vector< double > outline_color_b;
+
+        // outline_color.a
+        std::vector< double > outline_color_a;
+
+    public:
+        /**
+         * Number of elements.
+         */
+        inline int size() const;
+
+        /**
+         * Resize every column to @p n elements.
+         */
+        inline void resize(int n);
+
+        /**
+         * Gather element @p i into a CircleAnnotation.
+         */
+        inline foxglove_msgs::CircleAnnotation get(int i) const;
+
+        /**
+         * Scatter @p msg into element @p i.
+         */
+        inline void set(int i, const foxglove_msgs::CircleAnnotation &msg);
+
+        // LCM support functions. Users should not call these
+        inline int _encodeNoHash(void *buf, int offset, int maxlen, int n) const;
+        template <typename Writer>
+        inline void _writeNoHash(Writer &out, int n) const;
+        inline int _getEncodedSizeNoHash(int n) const;
+        inline int _decodeNoHash(const void *buf, int offset, int maxlen, int n);
+};
+
+int CircleAnnotationColumns::size() const
+{
+    return static_cast<int>(this->timestamp_sec.size());
+}
+
+void CircleAnnotationColumns::resize(int n)
+{
+    this->timestamp_sec.resize(n);
+    this->timestamp_nanosec.resize(n);
+    this->position_x.resize(n);
+    this->position_y.resize(n);
+    this->diameter.resize(n);
+    this->thickness.resize(n);
+    this->fill_color_r.resize(n);
+    this->fill_color_g.resize(n);
+    this->fill_color_b.resize(n);
+    this->fill_color_a.resize(n);
+    this->outline_color_r.resize(n);
+    this->outline_color_g.resize(n);
+    this->outline_color_b.resize(n);
+    this->outline_color_a.resize(n);
+}
+
+foxglove_msgs::CircleAnnotation CircleAnnotationColumns::get(int i) const
+{
+    foxglove_msgs::CircleAnnotation msg;
+    msg.timestamp.sec = this->timestamp_sec[i];
+    msg.timestamp.nanosec = this->timestamp_nanosec[i];
+    msg.position.x = this->position_x[i];
+    msg.position.y = this->position_y[i];
+    msg.diameter = this->diameter[i];
+    msg.thickness = this->thickness[i];
+    msg.fill_color.r = this->fill_color_r[i];
+    msg.fill_color.g = this->fill_color_g[i];
+    msg.fill_color.b = this->fill_color_b[i];
+    msg.fill_color.a = this->fill_color_a[i];
+    msg.outline_color.r = this->outline_color_r[i];
+    msg.outline_color.g = this->outline_color_g[i];
+    msg.outline_color.b = this->outline_color_b[i];
+    msg.outline_color.a = this->outline_color_a[i];
+    return msg;
+}
+
+void CircleAnnotationColumns::set(int i, const foxglove_msgs::CircleAnnotation &msg)
+{
+    this->timestamp_sec[i] = msg.timestamp.sec;
+    this->timestamp_nanosec[i] = msg.timestamp.nanosec;
+    this->position_x[i] = msg.position.x;
+    this->position_y[i] = msg.position.y;
+    this->diameter[i] = msg.diameter;
+    this->thickness[i] = msg.thickness;
+    this->fill_color_r[i] = msg.fill_color.r;
+    this->fill_color_g[i] = msg.fill_color.g;
+    this->fill_color_b[i] = msg.fill_color.b;
+    this->fill_color_a[i] = msg.fill_color.a;
+    this->outline_color_r[i] = msg.outline_color.r;
+    this->outline_color_g[i] = msg.outline_color.g;
+    this->outline_color_b[i] = msg.outline_color.b;
+    this->outline_color_a[i] = msg.outline_color.a;
+}
+
+int CircleAnnotationColumns::_encodeNoHash(void *buf, int offset, int maxlen, int n) const
+{
+    uint8_t *p = static_cast<uint8_t*>(buf) + offset;
+    int pos = 0;
+    for (int i = 0; i < n; i++) {
+        if(maxlen - pos < 104) return -1;
+        dimos_lcm::store_be(p + pos + 0, this->timestamp_sec[i]);
+        dimos_lcm::store_be(p + pos + 4, this->timestamp_nanosec[i]);
+        dimos_lcm::store_be(p + pos + 8, this->position_x[i]);
+        dimos_lcm::store_be(p + pos + 16, this->position_y[i]);
+        dimos_lcm::store_be(p + pos + 24, this->diameter[i]);
+        dimos_lcm::store_be(p + pos + 32, this->thickness[i]);
+        dimos_lcm::store_be(p + pos + 40, this->fill_color_r[i]);
+        dimos_lcm::store_be(p + pos + 48, this->fill_color_g[i]);
+        dimos_lcm::store_be(p + pos + 56, this->fill_color_b[i]);
+        dimos_lcm::store_be(p + pos + 64, this->fill_color_a[i]);
+        dimos_lcm::store_be(p + pos + 72, this->outline_color_r[i]);
+        dimos_lcm::store_be(p + pos + 80, this->outline_color_g[i]);
+        dimos_lcm::store_be(p + pos + 88, this->outline_color_b[i]);
+        dimos_lcm::store_be(p + pos + 96, this->outline_color_a[i]);
+        pos += 104;
+    }
+    return pos;
+}
+
+template <typename Writer>
+void CircleAnnotationColumns::_writeNoHash(Writer &out, int n) const
+{
+    if(n <= 0) return;
+    uint8_t *p = out.extend(static_cast<size_t>(n) * 104);
+    for (int i = 0; i < n; i++, p += 104) {
+        dimos_lcm::store_be(p + 0, this->timestamp_sec[i]);
+        dimos_lcm::store_be(p + 4, this->timestamp_nanosec[i]);
+        dimos_lcm::store_be(p + 8, this->position_x[i]);
+        dimos_lcm::store_be(p + 16, this->position_y[i]);
+        dimos_lcm::store_be(p + 24, this->diameter[i]);
+        dimos_lcm::store_be(p + 32, this->thickness[i]);
+        dimos_lcm::store_be(p + 40, this->fill_color_r[i]);
+        dimos_lcm::store_be(p + 48, this->fill_color_g[i]);
+        dimos_lcm::store_be(p + 56, this->fill_color_b[i]);
+        dimos_lcm::store_be(p + 64, this->fill_color_a[i]);
+        dimos_lcm::store_be(p + 72, this->outline_color_r[i]);
+        dimos_lcm::store_be(p + 80, this->outline_color_g[i]);
+        dimos_lcm::store_be(p + 88, this->outline_color_b[i]);
+        dimos_lcm::store_be(p + 96, this->outline_color_a[i]);
+    }
+}
+
+int CircleAnnotationColumns::_getEncodedSizeNoHash(int n) const
+{
+    return n * 104;
+}
+
+int CircleAnnotationColumns::_decodeNoHash(const void *buf, int offset, int maxlen, int n)
+{
+    if(n < 0 || n > maxlen / 104) return -1;
+    this->resize(n);
+    const uint8_t *p = static_cast<const uint8_t*>(buf) + offset;
+    int32_t *timestamp_sec = this->timestamp_sec.data();
+    int32_t *timestamp_nanosec = this->timestamp_nanosec.data();
+    double *position_x = this->position_x.data();
+    double *position_y = this->position_y.data();
+    double *diameter = this->diameter.data();
+    double *thickness = this->thickness.data();
+    double *fill_color_r = this->fill_color_r.data();
+    double *fill_color_g = this->fill_color_g.data();
+    double *fill_color_b = this->fill_color_b.data();
+    double *fill_color_a = this->fill_color_a.data();
+    double *outline_color_r = this->outline_color_r.data();
+    double *outline_color_g = this->outline_color_g.data();
+    double *outline_color_b = this->outline_color_b.data();
+    double *outline_color_a = this->outline_color_a.data();
+    for (int i = 0; i < n; i++, p += 104) {
+        dimos_lcm::load_be(p + 0, timestamp_sec[i]);
+        dimos_lcm::load_be(p + 4, timestamp_nanosec[i]);
+        dimos_lcm::load_be(p + 8, position_x[i]);
+        dimos_lcm::load_be(p + 16, position_y[i]);
+        dimos_lcm::load_be(p + 24, diameter[i]);
+        dimos_lcm::load_be(p + 32, thickness[i]);
+        dimos_lcm::load_be(p + 40, fill_color_r[i]);
+        dimos_lcm::load_be(p + 48, fill_color_g[i]);
+        dimos_lcm::load_be(p + 56, fill_color_b[i]);
+        dimos_lcm::load_be(p + 64, fill_color_a[i]);
+        dimos_lcm::load_be(p + 72, outline_color_r[i]);
+        dimos_lcm::load_be(p + 80, outline_color_g[i]);
+        dimos_lcm::load_be(p + 88, outline_color_b[i]);
+        dimos_lcm::load_be(p + 96, outline_color_a[i]);
+    }
+    return n * 104;
+}
+
+}
+
+#endif
@@ -1,7 +1,7 @@
 /** THIS IS AN AUTOMATICALLY GENERATED FILE.  DO NOT MODIFY
  * BY HAND!!
  *
- * Generated by lcm-gen 1.5.2
+ * Generated by lcm-cpp (tools/cpp/gen)
  **/
 
 #ifndef __foxglove_msgs_Color_hpp__
@@ -9,6 +9,11 @@
 
 #include <lcm/lcm_coretypes.h>
 
+#include <array>
+#include "dimos_lcm/fixed_codec.hpp"
+#include "dimos_lcm/writer.hpp"
+#include "dimos_lcm/fingerprint.hpp"
+#include "dimos_lcm/reflection.hpp"
 
 namespace foxglove_msgs
 {
@@ -36,11 +41,26 @@ class Color
          */
         inline int encode(void *buf, int offset, int maxlen) const;
 
+        /**
+         * Encode a message by appending it to @p buf, walking the message once
+         * instead of sizing it with getEncodedSize() first. @p buf grows
+         * geometrically; reuse it across calls to avoid reallocating.
+         *
+         * @return The number of bytes appended.
+         */
+        inline int encodeTo(std::vector<uint8_t> &buf) const;
+
         /**
          * Check how many bytes are required to encode this message.
          */
         inline int getEncodedSize() const;
 
+        /**
+         * getEncodedSize() of every instance: the type has no strings or
+         * variable-length arrays.
+         */
+        static constexpr int kEncodedSize = 40;
+
         /**
          * Decode a message from binary form into this instance.
          *
@@ -59,18 +79,48 @@ class Color
          */
         inline static int64_t getHash();
 
+        /**
+         * The fingerprint returned by getHash(), as a compile-time constant.
+         */
+        static constexpr int64_t kHash = static_cast<int64_t>(0x33026c2d2ea78883ULL);
+
         /**
          * Returns "Color"
          */
         inline static const char* getTypeName();
 
+        /**
+         * Name, LCM type and array dimensions of each field, in wire order.
+         * See dimos_lcm::for_each_field() for visiting the fields themselves.
+         */
+        static constexpr std::array<dimos_lcm::field_info, 4> kFields = {{
+            { "r", "double", true, 0, 0, NULL },
+            { "g", "double", true, 0, 0, NULL },
+            { "b", "double", true, 0, 0, NULL },
+            { "a", "double", true, 0, 0, NULL },
+        }};
+
         // LCM support functions. Users should not call these
         inline int _encodeNoHash(void *buf, int offset, int maxlen) const;
+        template <typename Writer>
+        inline void _writeNoHash(Writer &out) const;
         inline int _getEncodedSizeNoHash() const;
         inline int _decodeNoHash(const void *buf, int offset, int maxlen);
+        template <typename Self, typename Visitor>
+        inline static void _forEachField(Self &self, Visitor &visitor);
+        inline static int _skipNoHash(const void *buf, int offset, int maxlen);
         inline static uint64_t _computeHash(const __lcm_hash_ptr *p);
 };
 
+static_assert(Color::kHash == dimos_lcm::fingerprint(
+    dimos_lcm::signature_hash()
+        .member("r", "double", 0)
+        .member("g", "double", 0)
+        .member("b", "double", 0)
+        .member("a", "double", 0)
+        .value()),
+    "foxglove_msgs::Color fingerprint does not match its definition");
+
 int Color::encode(void *buf, int offset, int maxlen) const
 {
     int pos = 0, tlen;
@@ -85,6 +135,15 @@ int Color::encode(void *buf, int offset, int maxlen) const
     return pos;
 }
 
+int Color::encodeTo(std::vector<uint8_t> &buf) const
+{
+    dimos_lcm::vector_writer out(buf);
+    int64_t hash = getHash();
+    out.put(&hash, 1);
+    this->_writeNoHash(out);
+    return static_cast<int>(out.size());
+}
+
 int Color::decode(const void *buf, int offset, int maxlen)
 {
     int pos = 0, thislen;
@@ -107,8 +166,7 @@ int Color::getEncodedSize() const
 
 int64_t Color::getHash()
 {
-    static int64_t hash = static_cast<int64_t>(_computeHash(NULL));
-    return hash;
+    return kHash;
 }
 
 const char* Color::getTypeName()
@@ -118,50 +176,49 @@ const char* Color::getTypeName()
 
 int Color::_encodeNoHash(void *buf, int offset, int maxlen) const
 {
-    int pos = 0, tlen;
-
-    tlen = __double_encode_array(buf, offset + pos, maxlen - pos, &this->r, 1);
-    if(tlen < 0) return tlen; else pos += tlen;
-
-    tlen = __double_encode_array(buf, offset + pos, maxlen - pos, &this->g, 1);
-    if(tlen < 0) return tlen; else pos += tlen;
-
-    tlen = __double_encode_array(buf, offset + pos, maxlen - pos, &this->b, 1);
-    if(tlen < 0) return tlen; else pos += tlen;
-
-    tlen = __double_encode_array(buf, offset + pos, maxlen - pos, &this->a, 1);
-    if(tlen < 0) return tlen; else pos += tlen;
+    if(maxlen < kEncodedSize - 8) return -1;
+    uint8_t *p = static_cast<uint8_t*>(buf) + offset;
+    dimos_lcm::store_be(p + 0, this->r);
+    dimos_lcm::store_be(p + 8, this->g);
+    dimos_lcm::store_be(p + 16, this->b);
+    dimos_lcm::store_be(p + 24, this->a);
+    return kEncodedSize - 8;
+}
 
-    return pos;
+template <typename Writer>
+void Color::_writeNoHash(Writer &out) const
+{
+    out.putStruct(*this);
 }
 
 int Color::_decodeNoHash(const void *buf, int offset, int maxlen)
 {
-    int pos = 0, tlen;
-
-    tlen = __double_decode_array(buf, offset + pos, maxlen - pos, &this->r, 1);
-    if(tlen < 0) return tlen; else pos += tlen;
-
-    tlen = __double_decode_array(buf, offset + pos, maxlen - pos, &this->g, 1);
-    if(tlen < 0) return tlen; else pos += tlen;
-
-    tlen = __double_decode_array(buf, offset + pos, maxlen - pos, &this->b, 1);
-    if(tlen < 0) return tlen; else pos += tlen;
+    if(maxlen < kEncodedSize - 8) return -1;
+    const uint8_t *p = static_cast<const uint8_t*>(buf) + offset;
+    dimos_lcm::load_be(p + 0, this->r);
+    dimos_lcm::load_be(p + 8, this->g);
+    dimos_lcm::load_be(p + 16, this->b);
+    dimos_lcm::load_be(p + 24, this->a);
+    return kEncodedSize - 8;
+}
 
-    tlen = __double_decode_array(buf, offset + pos, maxlen - pos, &this->a, 1);
-    if(tlen < 0) return tlen; else pos += tlen;
+int Color::_getEncodedSizeNoHash() const
+{
+    return kEncodedSize - 8;
+}
 
-    return pos;
+int Color::_skipNoHash(const void *, int, int maxlen)
+{
+    return maxlen < kEncodedSize - 8 ? -1 : kEncodedSize - 8;
 }
 
-int Color::_getEncodedSizeNoHash() const
+template <typename Self, typename Visitor>
+void Color::_forEachField(Self &self, Visitor &visitor)
 {
-    int enc_size = 0;
-    enc_size += __double_encoded_array_size(NULL, 1);
-    enc_size += __double_encoded_array_size(NULL, 1);
-    enc_size += __double_encoded_array_size(NULL, 1);
-    enc_size += __double_encoded_array_size(NULL, 1);
-    return enc_size;
+    visitor(kFields[0], self.r);
+    visitor(kFields[1], self.g);
+    visitor(kFields[2], self.b);
+    visitor(kFields[3], self.a);
 }
 
 uint64_t Color::_computeHash(const __lcm_hash_ptr *)
@@ -0,0 +1,149 @@
+/** THIS IS AN AUTOMATICALLY GENERATED FILE.  DO NOT MODIFY
+ * BY HAND!!
+ *
+ * Generated by lcm-cpp (tools/cpp/gen)
+ **/
+
+#ifndef __foxglove_msgs_ColorColumns_hpp__
+#define __foxglove_msgs_ColorColumns_hpp__
+
+#include <lcm/lcm_coretypes.h>
+
+#include <vector>
+#include "dimos_lcm/fixed_codec.hpp"
+#include "foxglove_msgs/Color.hpp"
+
+namespace foxglove_msgs
+{
+
+/**
+ * Structure-of-arrays storage for a sequence of foxglove_msgs.Color: one
+ * contiguous array per field, with nested fields flattened and named by their
+ * path (r, g, ...). The soa:: message classes hold their
+ * Color arrays this way and decode them straight into the columns.
+ */
+class ColorColumns
+{
+    public:
+        std::vector< double > r;
+
+        std::vector< double > g;
+
+        std::vector< double > b;
+
+        std::vector< double > a;
+
+    public:
+        /**
+         * Number of elements.
+         */
+        inline int size() const;
+
+        /**
+         * Resize every column to @p n elements.
+         */
+        inline void resize(int n);
+
+        /**
+         * Gather element @p i into a Color.
+         */
+        inline foxglove_msgs::Color get(int i) const;
+
+        /**
+         * Scatter @p msg into element @p i.
+         */
+        inline void set(int i, const foxglove_msgs::Color &msg);
+
+        // LCM support functions. Users should not call these
+        inline int _encodeNoHash(void *buf, int offset, int maxlen, int n) const;
+        template <typename Writer>
+        inline void _writeNoHash(Writer &out, int n) const;
+        inline int _getEncodedSizeNoHash(int n) const;
+        inline int _decodeNoHash(const void *buf, int offset, int maxlen, int n);
+};
+
+int ColorColumns::size() const
+{
+    return static_cast<int>(this->r.size());
+}
+
+void ColorColumns::resize(int n)
+{
+    this->r.resize(n);
+    this->g.resize(n);
+    this->b.resize(n);
+    this->a.resize(n);
+}
+
+foxglove_msgs::Color ColorColumns::get(int i) const
+{
+    foxglove_msgs::Color msg;
+    msg.r = this->r[i];
+    msg.g = this->g[i];
+    msg.b = this->b[i];
+    msg.a = this->a[i];
+    return msg;
+}
+
+void ColorColumns::set(int i, const foxglove_msgs::Color &msg)
+{
+    this->r[i] = msg.r;
+    this->g[i] = msg.g;
+    this->b[i] = msg.b;
+    this->a[i] = msg.a;
+}
+
+int ColorColumns::_encodeNoHash(void *buf, int offset, int maxlen, int n) const
+{
+    uint8_t *p = static_cast<uint8_t*>(buf) + offset;
+    int pos = 0;
+    for (int i = 0; i < n; i++) {
+        if(maxlen - pos < 32) return -1;
+        dimos_lcm::store_be(p + pos + 0, this->r[i]);
+        dimos_lcm::store_be(p + pos + 8, this->g[i]);
+        dimos_lcm::store_be(p + pos + 16, this->b[i]);
+        dimos_lcm::store_be(p + pos + 24, this->a[i]);
+        pos += 32;
+    }
+    return pos;
+}
+
+template <typename Writer>
+void ColorColumns::_writeNoHash(Writer &out, int n) const
+{
+    if(n <= 0) return;
+    uint8_t *p = out.extend(static_cast<size_t>(n) * 32);
+    for (int i = 0; i < n; i++, p += 32) {
+        dimos_lcm::store_be(p + 0, this->r[i]);
+        dimos_lcm::store_be(p + 8, this->g[i]);
+        dimos_lcm::store_be(p + 16, this->b[i]);
+        dimos_lcm::store_be(p + 24, this->a[i]);
+    }
+}
+
+int ColorColumns::_getEncodedSizeNoHash(int n) const
+{
+    return n * 32;
+}
+
+int ColorColumns::_decodeNoHash(const void *buf, int offset, int maxlen, int n)
+{
+    if(n < 0 || n > maxlen / 32) return -1;
+    this->resize(n);
+    const uint8_t *p = static_cast<const uint8_t*>(buf) + offset;
+    double *r = this->r.data();
+    double *g = this->g.data();
+    double *b = this->b.data();
+    double *a = this->a.data();
+    for (int i = 0; i < n; i++, p += 32) {
+        dimos_lcm::load_be(p + 0, r[i]);
+        dimos_lcm::load_be(p + 8, g[i]);
+        dimos_lcm::load_be(p + 16, b[i]);
+        dimos_lcm::load_be(p + 24, a[i]);
+    }
+    return n * 32;
+}
+
+}
+
+#endif
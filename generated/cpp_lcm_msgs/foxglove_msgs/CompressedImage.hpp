@@ -1,7 +1,7 @@
 /** THIS IS AN AUTOMATICALLY GENERATED FILE.  DO NOT MODIFY
  * BY HAND!!
  *
- * Generated by lcm-gen 1.5.2
+ * Generated by lcm-cpp (tools/cpp/gen)
  **/
 
 #ifndef __foxglove_msgs_CompressedImage_hpp__
@@ -9,8 +9,13 @@
 
 #include <lcm/lcm_coretypes.h>
 
+#include <array>
 #include <string>
 #include <vector>
+#include "dimos_lcm/iov_writer.hpp"
+#include "dimos_lcm/wire_builder.hpp"
+#include "dimos_lcm/fingerprint.hpp"
+#include "dimos_lcm/reflection.hpp"
 #include "builtin_interfaces/Time.hpp"
 
 namespace foxglove_msgs
@@ -44,6 +49,37 @@ class CompressedImage
          */
         inline int encode(void *buf, int offset, int maxlen) const;
 
+        /**
+         * Encode a message by appending it to @p buf, walking the message once
+         * instead of sizing it with getEncodedSize() first. @p buf grows
+         * geometrically; reuse it across calls to avoid reallocating.
+         *
+         * @return The number of bytes appended.
+         */
+        inline int encodeTo(std::vector<uint8_t> &buf) const;
+
+        /**
+         * Encode a message as a list of buffers for writev()/sendmsg(). Byte
+         * payloads are referenced in place instead of copied; see
+         * dimos_lcm/iov_writer.hpp for how long they must stay valid.
+         *
+         * @param out Receives the encoded message after anything it already holds.
+         * @return The number of bytes encoded.
+         */
+        inline int encodeIov(dimos_lcm::iov_writer &out) const;
+
+        /**
+         * Encode a message into the buffer of @p out, leaving a gap at the
+         * place of each byte payload for the caller to fill; see
+         * dimos_lcm/wire_builder.hpp. The payload arrays are not read: set
+         * their length fields, and leave the arrays empty to skip filling them
+         * twice.
+         *
+         * @param out Receives the encoded message after anything it already holds.
+         * @return The number of bytes encoded, or <0 if they do not fit.
+         */
+        inline int encodeInPlace(dimos_lcm::wire_builder &out) const;
+
         /**
          * Check how many bytes are required to encode this message.
          */
@@ -59,6 +95,44 @@ class CompressedImage
          */
         inline int decode(const void *buf, int offset, int maxlen);
 
+        /**
+         * Field bits for decodeFields().
+         */
+        struct Fields
+        {
+            static constexpr uint64_t data_length = 1ULL << 0;
+            static constexpr uint64_t timestamp = 1ULL << 1;
+            static constexpr uint64_t frame_id = 1ULL << 2;
+            static constexpr uint64_t data = 1ULL << 3;
+            static constexpr uint64_t format = 1ULL << 4;
+            static constexpr uint64_t all = (1ULL << 5) - 1;
+        };
+
+        /**
+         * Decode only the fields selected by @p Mask, a bitwise or of Fields
+         * values. Strings, arrays and nested structs that are not selected are
+         * skipped over by their length prefixes without being allocated, and
+         * keep their previous value. Scalar fields are always decoded: they
+         * cost nothing to read and array lengths depend on them.
+         *
+         * @return The number of bytes decoded, or <0 if an error occured.
+         */
+        template <uint64_t Mask>
+        inline int decodeFields(const void *buf, int offset, int maxlen);
+
+        /**
+         * Upper bound on the length of every variable-length array of this
+         * type, checked by decode() before anything is allocated; messages
+         * exceeding it fail to decode. It does not apply to nested types,
+         * which have their own. Set it once at startup, before decoding.
+         * Before C++17 it is a constant with no limit.
+         */
+#if __cplusplus >= 201703L
+        static inline int32_t maxArrayLength = INT32_MAX;
+#else
+        static constexpr int32_t maxArrayLength = INT32_MAX;
+#endif
+
         /**
          * Retrieve the 64-bit fingerprint identifying the structure of the message.
          * Note that the fingerprint is the same for all instances of the same
@@ -67,18 +141,53 @@ class CompressedImage
          */
         inline static int64_t getHash();
 
+        /**
+         * The fingerprint returned by getHash(), as a compile-time constant.
+         */
+        static constexpr int64_t kHash = static_cast<int64_t>(0x2217b46eefbf7b05ULL);
+
         /**
          * Returns "CompressedImage"
          */
         inline static const char* getTypeName();
 
+        /**
+         * Name, LCM type and array dimensions of each field, in wire order.
+         * See dimos_lcm::for_each_field() for visiting the fields themselves.
+         */
+        static constexpr std::array<dimos_lcm::field_info, 5> kFields = {{
+            { "data_length", "int32_t", true, 0, 0, NULL },
+            { "timestamp", "builtin_interfaces.Time", false, 0, 0, NULL },
+            { "frame_id", "string", true, 0, 0, NULL },
+            { "data", "byte", true, 1, -1, "data_length" },
+            { "format", "string", true, 0, 0, NULL },
+        }};
+
         // LCM support functions. Users should not call these
         inline int _encodeNoHash(void *buf, int offset, int maxlen) const;
+        template <typename Writer>
+        inline void _writeNoHash(Writer &out) const;
         inline int _getEncodedSizeNoHash() const;
         inline int _decodeNoHash(const void *buf, int offset, int maxlen);
+        template <uint64_t Mask>
+        inline int _decodeFieldsNoHash(const void *buf, int offset, int maxlen);
+        template <typename Self, typename Visitor>
+        inline static void _forEachField(Self &self, Visitor &visitor);
+        inline static int _skipNoHash(const void *buf, int offset, int maxlen);
         inline static uint64_t _computeHash(const __lcm_hash_ptr *p);
 };
 
+static_assert(CompressedImage::kHash == dimos_lcm::fingerprint(
+    dimos_lcm::signature_hash()
+        .member("data_length", "int32_t", 0)
+        .member("timestamp", NULL, 0)
+        .member("frame_id", "string", 0)
+        .member("data", "byte", 1).dim(true, "data_length")
+        .member("format", "string", 0)
+        .value(),
+    builtin_interfaces::Time::kHash),
+    "foxglove_msgs::CompressedImage fingerprint does not match its definition");
+
 int CompressedImage::encode(void *buf, int offset, int maxlen) const
 {
     int pos = 0, tlen;
@@ -93,6 +202,35 @@ int CompressedImage::encode(void *buf, int offset, int maxlen) const
     return pos;
 }
 
+int CompressedImage::encodeTo(std::vector<uint8_t> &buf) const
+{
+    dimos_lcm::vector_writer out(buf);
+    int64_t hash = getHash();
+    out.put(&hash, 1);
+    this->_writeNoHash(out);
+    return static_cast<int>(out.size());
+}
+
+int CompressedImage::encodeIov(dimos_lcm::iov_writer &out) const
+{
+    size_t start = out.size();
+    int64_t hash = getHash();
+    out.put(&hash, 1);
+    this->_writeNoHash(out);
+    return static_cast<int>(out.size() - start);
+}
+
+int CompressedImage::encodeInPlace(dimos_lcm::wire_builder &out) const
+{
+    int size = getEncodedSize();
+    if (static_cast<size_t>(size) > out.remaining())
+        return -1;
+    int64_t hash = getHash();
+    out.put(&hash, 1);
+    this->_writeNoHash(out);
+    return size;
+}
+
 int CompressedImage::decode(const void *buf, int offset, int maxlen)
 {
     int pos = 0, thislen;
@@ -108,6 +246,22 @@ int CompressedImage::decode(const void *buf, int offset, int maxlen)
     return pos;
 }
 
+template <uint64_t Mask>
+int CompressedImage::decodeFields(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, thislen;
+
+    int64_t msg_hash;
+    thislen = __int64_t_decode_array(buf, offset + pos, maxlen - pos, &msg_hash, 1);
+    if (thislen < 0) return thislen; else pos += thislen;
+    if (msg_hash != getHash()) return -1;
+
+    thislen = this->_decodeFieldsNoHash<Mask>(buf, offset + pos, maxlen - pos);
+    if (thislen < 0) return thislen; else pos += thislen;
+
+    return pos;
+}
+
 int CompressedImage::getEncodedSize() const
 {
     return 8 + _getEncodedSizeNoHash();
@@ -115,8 +269,7 @@ int CompressedImage::getEncodedSize() const
 
 int64_t CompressedImage::getHash()
 {
-    static int64_t hash = static_cast<int64_t>(_computeHash(NULL));
-    return hash;
+    return kHash;
 }
 
 const char* CompressedImage::getTypeName()
@@ -152,6 +305,17 @@ int CompressedImage::_encodeNoHash(void *buf, int offset, int maxlen) const
     return pos;
 }
 
+template <typename Writer>
+void CompressedImage::_writeNoHash(Writer &out) const
+{
+    out.put(&this->data_length, 1);
+    this->timestamp._writeNoHash(out);
+    out.put(this->frame_id);
+    if(this->data_length > 0)
+        out.reference(this->data.data(), this->data_length);
+    out.put(this->format);
+}
+
 int CompressedImage::_decodeNoHash(const void *buf, int offset, int maxlen)
 {
     int pos = 0, tlen;
@@ -166,22 +330,25 @@ int CompressedImage::_decodeNoHash(const void *buf, int offset, int maxlen)
     tlen = __int32_t_decode_array(
         buf, offset + pos, maxlen - pos, &__frame_id_len__, 1);
     if(tlen < 0) return tlen; else pos += tlen;
-    if(__frame_id_len__ > maxlen - pos) return -1;
+    if(__frame_id_len__ < 1 || __frame_id_len__ > maxlen - pos) return -1;
     this->frame_id.assign(
         static_cast<const char*>(buf) + offset + pos, __frame_id_len__ - 1);
     pos += __frame_id_len__;
 
     if(this->data_length) {
-        this->data.resize(this->data_length);
-        tlen = __byte_decode_array(buf, offset + pos, maxlen - pos, &this->data[0], this->data_length);
-        if(tlen < 0) return tlen; else pos += tlen;
+        if(this->data_length < 0 || this->data_length > maxlen - pos || this->data_length > maxArrayLength) return -1;
+        const uint8_t *__data_src__ = static_cast<const uint8_t*>(buf) + offset + pos;
+        this->data.assign(__data_src__, __data_src__ + this->data_length);
+        pos += this->data_length;
+    } else {
+        this->data.clear();
     }
 
     int32_t __format_len__;
     tlen = __int32_t_decode_array(
         buf, offset + pos, maxlen - pos, &__format_len__, 1);
     if(tlen < 0) return tlen; else pos += tlen;
-    if(__format_len__ > maxlen - pos) return -1;
+    if(__format_len__ < 1 || __format_len__ > maxlen - pos) return -1;
     this->format.assign(
         static_cast<const char*>(buf) + offset + pos, __format_len__ - 1);
     pos += __format_len__;
@@ -189,6 +356,73 @@ int CompressedImage::_decodeNoHash(const void *buf, int offset, int maxlen)
     return pos;
 }
 
+template <uint64_t Mask>
+int CompressedImage::_decodeFieldsNoHash(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, tlen;
+
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &this->data_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    if ((Mask & Fields::timestamp) != 0) {
+        tlen = this->timestamp._decodeNoHash(buf, offset + pos, maxlen - pos);
+        if(tlen < 0) return tlen; else pos += tlen;
+    } else {
+        tlen = builtin_interfaces::Time::_skipNoHash(buf, offset + pos, maxlen - pos);
+        if(tlen < 0) return tlen; else pos += tlen;
+    }
+
+    if ((Mask & Fields::frame_id) != 0) {
+        int32_t __frame_id_len__;
+        tlen = __int32_t_decode_array(
+            buf, offset + pos, maxlen - pos, &__frame_id_len__, 1);
+        if(tlen < 0) return tlen; else pos += tlen;
+        if(__frame_id_len__ < 1 || __frame_id_len__ > maxlen - pos) return -1;
+        this->frame_id.assign(
+            static_cast<const char*>(buf) + offset + pos, __frame_id_len__ - 1);
+        pos += __frame_id_len__;
+    } else {
+        int32_t __frame_id_len__;
+        tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &__frame_id_len__, 1);
+        if(tlen < 0) return tlen; else pos += tlen;
+        if(__frame_id_len__ < 0 || __frame_id_len__ > maxlen - pos) return -1;
+        pos += __frame_id_len__;
+    }
+
+    if ((Mask & Fields::data) != 0) {
+        if(this->data_length) {
+            if(this->data_length < 0 || this->data_length > maxlen - pos || this->data_length > maxArrayLength) return -1;
+            const uint8_t *__data_src__ = static_cast<const uint8_t*>(buf) + offset + pos;
+            this->data.assign(__data_src__, __data_src__ + this->data_length);
+            pos += this->data_length;
+        } else {
+            this->data.clear();
+        }
+    } else {
+        if(this->data_length < 0 || this->data_length > maxlen - pos) return -1;
+        pos += this->data_length;
+    }
+
+    if ((Mask & Fields::format) != 0) {
+        int32_t __format_len__;
+        tlen = __int32_t_decode_array(
+            buf, offset + pos, maxlen - pos, &__format_len__, 1);
+        if(tlen < 0) return tlen; else pos += tlen;
+        if(__format_len__ < 1 || __format_len__ > maxlen - pos) return -1;
+        this->format.assign(
+            static_cast<const char*>(buf) + offset + pos, __format_len__ - 1);
+        pos += __format_len__;
+    } else {
+        int32_t __format_len__;
+        tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &__format_len__, 1);
+        if(tlen < 0) return tlen; else pos += tlen;
+        if(__format_len__ < 0 || __format_len__ > maxlen - pos) return -1;
+        pos += __format_len__;
+    }
+
+    return pos;
+}
+
 int CompressedImage::_getEncodedSizeNoHash() const
 {
     int enc_size = 0;
@@ -200,6 +434,40 @@ int CompressedImage::_getEncodedSizeNoHash() const
     return enc_size;
 }
 
+int CompressedImage::_skipNoHash(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, tlen;
+    int32_t data_length;
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &data_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+    tlen = builtin_interfaces::Time::_skipNoHash(buf, offset + pos, maxlen - pos);
+    if(tlen < 0) return tlen; else pos += tlen;
+    int32_t __frame_id_len__;
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &__frame_id_len__, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+    if(__frame_id_len__ < 0 || __frame_id_len__ > maxlen - pos) return -1;
+    pos += __frame_id_len__;
+    if(data_length < 0 || data_length > maxlen - pos) return -1;
+    pos += data_length;
+    int32_t __format_len__;
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &__format_len__, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+    if(__format_len__ < 0 || __format_len__ > maxlen - pos) return -1;
+    pos += __format_len__;
+    if(pos > maxlen) return -1;
+    return pos;
+}
+
+template <typename Self, typename Visitor>
+void CompressedImage::_forEachField(Self &self, Visitor &visitor)
+{
+    visitor(kFields[0], self.data_length);
+    visitor(kFields[1], self.timestamp);
+    visitor(kFields[2], self.frame_id);
+    visitor(kFields[3], self.data);
+    visitor(kFields[4], self.format);
+}
+
 uint64_t CompressedImage::_computeHash(const __lcm_hash_ptr *p)
 {
     const __lcm_hash_ptr *fp;
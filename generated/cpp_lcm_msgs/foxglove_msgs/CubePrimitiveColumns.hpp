@@ -0,0 +1,253 @@
+/** THIS IS AN AUTOMATICALLY GENERATED FILE.  DO NOT MODIFY
+ * BY HAND!!
+ *
+ * Generated by lcm-cpp (tools/cpp/gen)
+ **/
+
+#ifndef __foxglove_msgs_CubePrimitiveColumns_hpp__
+#define __foxglove_msgs_CubePrimitiveColumns_hpp__
+
+#include <lcm/lcm_coretypes.h>
+
+#include <vector>
+#include "dimos_lcm/fixed_codec.hpp"
+#include "foxglove_msgs/CubePrimitive.hpp"
+
+namespace foxglove_msgs
+{
+
+/**
+ * Structure-of-arrays storage for a sequence of foxglove_msgs.CubePrimitive: one
+ * contiguous array per field, with nested fields flattened and named by their
+ * path (pose_position_x, pose_position_y, ...). The soa:: message classes hold their
+ * CubePrimitive arrays this way and decode them straight into the columns.
+ */
+class CubePrimitiveColumns
+{
+    public:
+        // pose.position.x
+        std::vector< double > pose_position_x;
+
+        // pose.position.y
+        std::vector< double > pose_position_y;
+
+        // pose.position.z
+        std::vector< double > pose_position_z;
+
+        // pose.orientation.x
+        std::vector< double > pose_orientation_x;
+
+        // pose.orientation.y
+        std::vector< double > pose_orientation_y;
+
+        // pose.orientation.z
+        std::vector< double > pose_orientation_z;
+
+        // pose.orientation.w
+        std::vector< double > pose_orientation_w;
+
+        // size.x
+        std::vector< double > size_x;
+
+        // size.y
+        std::vector< double > size_y;
+
+        // size.z
+        std::vector< double > size_z;
+
+        // color.r
+        std::vector< double > color_r;
+
+        // color.g
+        std::vector< double > color_g;
+
+        // color.b
+        std::vector< double > color_b;
+
+        // color.a
+        std::vector< double > color_a;
+
+    public:
+        /**
+         * Number of elements.
+         */
+        inline int size() const;
+
+        /**
+         * Resize every column to @p n elements.
+         */
+        inline void resize(int n);
+
+        /**
+         * Gather element @p i into a CubePrimitive.
+         */
+        inline foxglove_msgs::CubePrimitive get(int i) const;
+
+        /**
+         * Scatter @p msg into element @p i.
+         */
+        inline void set(int i, const foxglove_msgs::CubePrimitive &msg);
+
+        // LCM support functions. Users should not call these
+        inline int _encodeNoHash(void *buf, int offset, int maxlen, int n) const;
+        template <typename Writer>
+        inline void _writeNoHash(Writer &out, int n) const;
+        inline int _getEncodedSizeNoHash(int n) const;
+        inline int _decodeNoHash(const void *buf, int offset, int maxlen, int n);
+};
+
+int CubePrimitiveColumns::size() const
+{
+    return static_cast<int>(this->pose_position_x.size());
+}
+
+void CubePrimitiveColumns::resize(int n)
+{
+    this->pose_position_x.resize(n);
+    this->pose_position_y.resize(n);
+    this->pose_position_z.resize(n);
+    this->pose_orientation_x.resize(n);
+    this->pose_orientation_y.resize(n);
+    this->pose_orientation_z.resize(n);
+    this->pose_orientation_w.resize(n);
+    this->size_x.resize(n);
+    this->size_y.resize(n);
+    this->size_z.resize(n);
+    this->color_r.resize(n);
+    this->color_g.resize(n);
+    this->color_b.resize(n);
+    this->color_a.resize(n);
+}
+
+foxglove_msgs::CubePrimitive CubePrimitiveColumns::get(int i) const
+{
+    foxglove_msgs::CubePrimitive msg;
+    msg.pose.position.x = this->pose_position_x[i];
+    msg.pose.position.y = this->pose_position_y[i];
+    msg.pose.position.z = this->pose_position_z[i];
+    msg.pose.orientation.x = this->pose_orientation_x[i];
+    msg.pose.orientation.y = this->pose_orientation_y[i];
+    msg.pose.orientation.z = this->pose_orientation_z[i];
+    msg.pose.orientation.w = this->pose_orientation_w[i];
+    msg.size.x = this->size_x[i];
+    msg.size.y = this->size_y[i];
+    msg.size.z = this->size_z[i];
+    msg.color.r = this->color_r[i];
+    msg.color.g = this->color_g[i];
+    msg.color.b = this->color_b[i];
+    msg.color.a = this->color_a[i];
+    return msg;
+}
+
+void CubePrimitiveColumns::set(int i, const foxglove_msgs::CubePrimitive &msg)
+{
+    this->pose_position_x[i] = msg.pose.position.x;
+    this->pose_position_y[i] = msg.pose.position.y;
+    this->pose_position_z[i] = msg.pose.position.z;
+    this->pose_orientation_x[i] = msg.pose.orientation.x;
+    this->pose_orientation_y[i] = msg.pose.orientation.y;
+    this->pose_orientation_z[i] = msg.pose.orientation.z;
+    this->pose_orientation_w[i] = msg.pose.orientation.w;
+    this->size_x[i] = msg.size.x;
+    this->size_y[i] = msg.size.y;
+    this->size_z[i] = msg.size.z;
+    this->color_r[i] = msg.color.r;
+    this->color_g[i] = msg.color.g;
+    this->color_b[i] = msg.color.b;
+    this->color_a[i] = msg.color.a;
+}
+
+int CubePrimitiveColumns::_encodeNoHash(void *buf, int offset, int maxlen, int n) const
+{
+    uint8_t *p = static_cast<uint8_t*>(buf) + offset;
+    int pos = 0;
+    for (int i = 0; i < n; i++) {
+        if(maxlen - pos < 112) return -1;
+        dimos_lcm::store_be(p + pos + 0, this->pose_position_x[i]);
+        dimos_lcm::store_be(p + pos + 8, this->pose_position_y[i]);
+        dimos_lcm::store_be(p + pos + 16, this->pose_position_z[i]);
+        dimos_lcm::store_be(p + pos + 24, this->pose_orientation_x[i]);
+        dimos_lcm::store_be(p + pos + 32, this->pose_orientation_y[i]);
+        dimos_lcm::store_be(p + pos + 40, this->pose_orientation_z[i]);
+        dimos_lcm::store_be(p + pos + 48, this->pose_orientation_w[i]);
+        dimos_lcm::store_be(p + pos + 56, this->size_x[i]);
+        dimos_lcm::store_be(p + pos + 64, this->size_y[i]);
+        dimos_lcm::store_be(p + pos + 72, this->size_z[i]);
+        dimos_lcm::store_be(p + pos + 80, this->color_r[i]);
+        dimos_lcm::store_be(p + pos + 88, this->color_g[i]);
+        dimos_lcm::store_be(p + pos + 96, this->color_b[i]);
+        dimos_lcm::store_be(p + pos + 104, this->color_a[i]);
+        pos += 112;
+    }
+    return pos;
+}
+
+template <typename Writer>
+void CubePrimitiveColumns::_writeNoHash(Writer &out, int n) const
+{
+    if(n <= 0) return;
+    uint8_t *p = out.extend(static_cast<size_t>(n) * 112);
+    for (int i = 0; i < n; i++, p += 112) {
+        dimos_lcm::store_be(p + 0, this->pose_position_x[i]);
+        dimos_lcm::store_be(p + 8, this->pose_position_y[i]);
+        dimos_lcm::store_be(p + 16, this->pose_position_z[i]);
+        dimos_lcm::store_be(p + 24, this->pose_orientation_x[i]);
+        dimos_lcm::store_be(p + 32, this->pose_orientation_y[i]);
+        dimos_lcm::store_be(p + 40, this->pose_orientation_z[i]);
+        dimos_lcm::store_be(p + 48, this->pose_orientation_w[i]);
+        dimos_lcm::store_be(p + 56, this->size_x[i]);
+        dimos_lcm::store_be(p + 64, this->size_y[i]);
+        dimos_lcm::store_be(p + 72, this->size_z[i]);
+        dimos_lcm::store_be(p + 80, this->color_r[i]);
+        dimos_lcm::store_be(p + 88, this->color_g[i]);
+        dimos_lcm::store_be(p + 96, this->color_b[i]);
+        dimos_lcm::store_be(p + 104, this->color_a[i]);
+    }
+}
+
+int CubePrimitiveColumns::_getEncodedSizeNoHash(int n) const
+{
+    return n * 112;
+}
+
+int CubePrimitiveColumns::_decodeNoHash(const void *buf, int offset, int maxlen, int n)
+{
+    if(n < 0 || n > maxlen / 112) return -1;
+    this->resize(n);
+    const uint8_t *p = static_cast<const uint8_t*>(buf) + offset;
+    double *pose_position_x = this->pose_position_x.data();
+    double *pose_position_y = this->pose_position_y.data();
+    double *pose_position_z = this->pose_position_z.data();
+    double *pose_orientation_x = this->pose_orientation_x.data();
+    double *pose_orientation_y = this->pose_orientation_y.data();
+    double *pose_orientation_z = this->pose_orientation_z.data();
+    double *pose_orientation_w = this->pose_orientation_w.data();
+    double *size_x = this->size_x.data();
+    double *size_y = this->size_y.data();
+    double *size_z = this->size_z.data();
+    double *color_r = this->color_r.data();
+    double *color_g = this->color_g.data();
+    double *color_b = this->color_b.data();
+    double *color_a = this->color_a.data();
+    for (int i = 0; i < n; i++, p += 112) {
+        dimos_lcm::load_be(p + 0, pose_position_x[i]);
+        dimos_lcm::load_be(p + 8, pose_position_y[i]);
+        dimos_lcm::load_be(p + 16, pose_position_z[i]);
+        dimos_lcm::load_be(p + 24, pose_orientation_x[i]);
+        dimos_lcm::load_be(p + 32, pose_orientation_y[i]);
+        dimos_lcm::load_be(p + 40, pose_orientation_z[i]);
+        dimos_lcm::load_be(p + 48, pose_orientation_w[i]);
+        dimos_lcm::load_be(p + 56, size_x[i]);
+        dimos_lcm::load_be(p + 64, size_y[i]);
+        dimos_lcm::load_be(p + 72, size_z[i]);
+        dimos_lcm::load_be(p + 80, color_r[i]);
+        dimos_lcm::load_be(p + 88, color_g[i]);
+        dimos_lcm::load_be(p + 96, color_b[i]);
+        dimos_lcm::load_be(p + 104, color_a[i]);
+    }
+    return n * 112;
+}
+
+}
+
+#endif
@@ -1,7 +1,7 @@
 /** THIS IS AN AUTOMATICALLY GENERATED FILE.  DO NOT MODIFY
  * BY HAND!!
  *
- * Generated by lcm-gen 1.5.2
+ * Generated by lcm-cpp (tools/cpp/gen)
  **/
 
 #ifndef __foxglove_msgs_CylinderPrimitive_hpp__
@@ -9,6 +9,11 @@
 
 #include <lcm/lcm_coretypes.h>
 
+#include <array>
+#include "dimos_lcm/fixed_codec.hpp"
+#include "dimos_lcm/writer.hpp"
+#include "dimos_lcm/fingerprint.hpp"
+#include "dimos_lcm/reflection.hpp"
 #include "geometry_msgs/Pose.hpp"
 #include "geometry_msgs/Vector3.hpp"
 #include "foxglove_msgs/Color.hpp"
@@ -41,11 +46,26 @@ class CylinderPrimitive
          */
         inline int encode(void *buf, int offset, int maxlen) const;
 
+        /**
+         * Encode a message by appending it to @p buf, walking the message once
+         * instead of sizing it with getEncodedSize() first. @p buf grows
+         * geometrically; reuse it across calls to avoid reallocating.
+         *
+         * @return The number of bytes appended.
+         */
+        inline int encodeTo(std::vector<uint8_t> &buf) const;
+
         /**
          * Check how many bytes are required to encode this message.
          */
         inline int getEncodedSize() const;
 
+        /**
+         * getEncodedSize() of every instance: the type has no strings or
+         * variable-length arrays.
+         */
+        static constexpr int kEncodedSize = 136;
+
         /**
          * Decode a message from binary form into this instance.
          *
@@ -64,18 +84,53 @@ class CylinderPrimitive
          */
         inline static int64_t getHash();
 
+        /**
+         * The fingerprint returned by getHash(), as a compile-time constant.
+         */
+        static constexpr int64_t kHash = static_cast<int64_t>(0x55f0073208876187ULL);
+
         /**
          * Returns "CylinderPrimitive"
          */
         inline static const char* getTypeName();
 
+        /**
+         * Name, LCM type and array dimensions of each field, in wire order.
+         * See dimos_lcm::for_each_field() for visiting the fields themselves.
+         */
+        static constexpr std::array<dimos_lcm::field_info, 5> kFields = {{
+            { "pose", "geometry_msgs.Pose", false, 0, 0, NULL },
+            { "size", "geometry_msgs.Vector3", false, 0, 0, NULL },
+            { "bottom_scale", "double", true, 0, 0, NULL },
+            { "top_scale", "double", true, 0, 0, NULL },
+            { "color", "foxglove_msgs.Color", false, 0, 0, NULL },
+        }};
+
         // LCM support functions. Users should not call these
         inline int _encodeNoHash(void *buf, int offset, int maxlen) const;
+        template <typename Writer>
+        inline void _writeNoHash(Writer &out) const;
         inline int _getEncodedSizeNoHash() const;
         inline int _decodeNoHash(const void *buf, int offset, int maxlen);
+        template <typename Self, typename Visitor>
+        inline static void _forEachField(Self &self, Visitor &visitor);
+        inline static int _skipNoHash(const void *buf, int offset, int maxlen);
         inline static uint64_t _computeHash(const __lcm_hash_ptr *p);
 };
 
+static_assert(CylinderPrimitive::kHash == dimos_lcm::fingerprint(
+    dimos_lcm::signature_hash()
+        .member("pose", NULL, 0)
+        .member("size", NULL, 0)
+        .member("bottom_scale", "double", 0)
+        .member("top_scale", "double", 0)
+        .member("color", NULL, 0)
+        .value(),
+    geometry_msgs::Pose::kHash,
+    geometry_msgs::Vector3::kHash,
+    foxglove_msgs::Color::kHash),
+    "foxglove_msgs::CylinderPrimitive fingerprint does not match its definition");
+
 int CylinderPrimitive::encode(void *buf, int offset, int maxlen) const
 {
     int pos = 0, tlen;
@@ -90,6 +145,15 @@ int CylinderPrimitive::encode(void *buf, int offset, int maxlen) const
     return pos;
 }
 
+int CylinderPrimitive::encodeTo(std::vector<uint8_t> &buf) const
+{
+    dimos_lcm::vector_writer out(buf);
+    int64_t hash = getHash();
+    out.put(&hash, 1);
+    this->_writeNoHash(out);
+    return static_cast<int>(out.size());
+}
+
 int CylinderPrimitive::decode(const void *buf, int offset, int maxlen)
 {
     int pos = 0, thislen;
@@ -112,8 +176,7 @@ int CylinderPrimitive::getEncodedSize() const
 
 int64_t CylinderPrimitive::getHash()
 {
-    static int64_t hash = static_cast<int64_t>(_computeHash(NULL));
-    return hash;
+    return kHash;
 }
 
 const char* CylinderPrimitive::getTypeName()
@@ -123,57 +186,74 @@ const char* CylinderPrimitive::getTypeName()
 
 int CylinderPrimitive::_encodeNoHash(void *buf, int offset, int maxlen) const
 {
-    int pos = 0, tlen;
-
-    tlen = this->pose._encodeNoHash(buf, offset + pos, maxlen - pos);
-    if(tlen < 0) return tlen; else pos += tlen;
-
-    tlen = this->size._encodeNoHash(buf, offset + pos, maxlen - pos);
-    if(tlen < 0) return tlen; else pos += tlen;
-
-    tlen = __double_encode_array(buf, offset + pos, maxlen - pos, &this->bottom_scale, 1);
-    if(tlen < 0) return tlen; else pos += tlen;
-
-    tlen = __double_encode_array(buf, offset + pos, maxlen - pos, &this->top_scale, 1);
-    if(tlen < 0) return tlen; else pos += tlen;
-
-    tlen = this->color._encodeNoHash(buf, offset + pos, maxlen - pos);
-    if(tlen < 0) return tlen; else pos += tlen;
+    if(maxlen < kEncodedSize - 8) return -1;
+    uint8_t *p = static_cast<uint8_t*>(buf) + offset;
+    dimos_lcm::store_be(p + 0, this->pose.position.x);
+    dimos_lcm::store_be(p + 8, this->pose.position.y);
+    dimos_lcm::store_be(p + 16, this->pose.position.z);
+    dimos_lcm::store_be(p + 24, this->pose.orientation.x);
+    dimos_lcm::store_be(p + 32, this->pose.orientation.y);
+    dimos_lcm::store_be(p + 40, this->pose.orientation.z);
+    dimos_lcm::store_be(p + 48, this->pose.orientation.w);
+    dimos_lcm::store_be(p + 56, this->size.x);
+    dimos_lcm::store_be(p + 64, this->size.y);
+    dimos_lcm::store_be(p + 72, this->size.z);
+    dimos_lcm::store_be(p + 80, this->bottom_scale);
+    dimos_lcm::store_be(p + 88, this->top_scale);
+    dimos_lcm::store_be(p + 96, this->color.r);
+    dimos_lcm::store_be(p + 104, this->color.g);
+    dimos_lcm::store_be(p + 112, this->color.b);
+    dimos_lcm::store_be(p + 120, this->color.a);
+    return kEncodedSize - 8;
+}
 
-    return pos;
+template <typename Writer>
+void CylinderPrimitive::_writeNoHash(Writer &out) const
+{
+    out.putStruct(*this);
 }
 
 int CylinderPrimitive::_decodeNoHash(const void *buf, int offset, int maxlen)
 {
-    int pos = 0, tlen;
-
-    tlen = this->pose._decodeNoHash(buf, offset + pos, maxlen - pos);
-    if(tlen < 0) return tlen; else pos += tlen;
-
-    tlen = this->size._decodeNoHash(buf, offset + pos, maxlen - pos);
-    if(tlen < 0) return tlen; else pos += tlen;
-
-    tlen = __double_decode_array(buf, offset + pos, maxlen - pos, &this->bottom_scale, 1);
-    if(tlen < 0) return tlen; else pos += tlen;
-
-    tlen = __double_decode_array(buf, offset + pos, maxlen - pos, &this->top_scale, 1);
-    if(tlen < 0) return tlen; else pos += tlen;
+    if(maxlen < kEncodedSize - 8) return -1;
+    const uint8_t *p = static_cast<const uint8_t*>(buf) + offset;
+    dimos_lcm::load_be(p + 0, this->pose.position.x);
+    dimos_lcm::load_be(p + 8, this->pose.position.y);
+    dimos_lcm::load_be(p + 16, this->pose.position.z);
+    dimos_lcm::load_be(p + 24, this->pose.orientation.x);
+    dimos_lcm::load_be(p + 32, this->pose.orientation.y);
+    dimos_lcm::load_be(p + 40, this->pose.orientation.z);
+    dimos_lcm::load_be(p + 48, this->pose.orientation.w);
+    dimos_lcm::load_be(p + 56, this->size.x);
+    dimos_lcm::load_be(p + 64, this->size.y);
+    dimos_lcm::load_be(p + 72, this->size.z);
+    dimos_lcm::load_be(p + 80, this->bottom_scale);
+    dimos_lcm::load_be(p + 88, this->top_scale);
+    dimos_lcm::load_be(p + 96, this->color.r);
+    dimos_lcm::load_be(p + 104, this->color.g);
+    dimos_lcm::load_be(p + 112, this->color.b);
+    dimos_lcm::load_be(p + 120, this->color.a);
+    return kEncodedSize - 8;
+}
 
-    tlen = this->color._decodeNoHash(buf, offset + pos, maxlen - pos);
-    if(tlen < 0) return tlen; else pos += tlen;
+int CylinderPrimitive::_getEncodedSizeNoHash() const
+{
+    return kEncodedSize - 8;
+}
 
-    return pos;
+int CylinderPrimitive::_skipNoHash(const void *, int, int maxlen)
+{
+    return maxlen < kEncodedSize - 8 ? -1 : kEncodedSize - 8;
 }
 
-int CylinderPrimitive::_getEncodedSizeNoHash() const
+template <typename Self, typename Visitor>
+void CylinderPrimitive::_forEachField(Self &self, Visitor &visitor)
 {
-    int enc_size = 0;
-    enc_size += this->pose._getEncodedSizeNoHash();
-    enc_size += this->size._getEncodedSizeNoHash();
-    enc_size += __double_encoded_array_size(NULL, 1);
-    enc_size += __double_encoded_array_size(NULL, 1);
-    enc_size += this->color._getEncodedSizeNoHash();
-    return enc_size;
+    visitor(kFields[0], self.pose);
+    visitor(kFields[1], self.size);
+    visitor(kFields[2], self.bottom_scale);
+    visitor(kFields[3], self.top_scale);
+    visitor(kFields[4], self.color);
 }
 
 uint64_t CylinderPrimitive::_computeHash(const __lcm_hash_ptr *p)
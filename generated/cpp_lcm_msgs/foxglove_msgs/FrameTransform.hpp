@@ -1,7 +1,7 @@
 /** THIS IS AN AUTOMATICALLY GENERATED FILE.  DO NOT MODIFY
  * BY HAND!!
  *
- * Generated by lcm-gen 1.5.2
+ * Generated by lcm-cpp (tools/cpp/gen)
  **/
 
 #ifndef __foxglove_msgs_FrameTransform_hpp__
@@ -9,7 +9,11 @@
 
 #include <lcm/lcm_coretypes.h>
 
+#include <array>
 #include <string>
+#include "dimos_lcm/writer.hpp"
+#include "dimos_lcm/fingerprint.hpp"
+#include "dimos_lcm/reflection.hpp"
 #include "builtin_interfaces/Time.hpp"
 #include "geometry_msgs/Vector3.hpp"
 #include "geometry_msgs/Quaternion.hpp"
@@ -42,6 +46,15 @@ class FrameTransform
          */
         inline int encode(void *buf, int offset, int maxlen) const;
 
+        /**
+         * Encode a message by appending it to @p buf, walking the message once
+         * instead of sizing it with getEncodedSize() first. @p buf grows
+         * geometrically; reuse it across calls to avoid reallocating.
+         *
+         * @return The number of bytes appended.
+         */
+        inline int encodeTo(std::vector<uint8_t> &buf) const;
+
         /**
          * Check how many bytes are required to encode this message.
          */
@@ -57,6 +70,31 @@ class FrameTransform
          */
         inline int decode(const void *buf, int offset, int maxlen);
 
+        /**
+         * Field bits for decodeFields().
+         */
+        struct Fields
+        {
+            static constexpr uint64_t timestamp = 1ULL << 0;
+            static constexpr uint64_t parent_frame_id = 1ULL << 1;
+            static constexpr uint64_t child_frame_id = 1ULL << 2;
+            static constexpr uint64_t translation = 1ULL << 3;
+            static constexpr uint64_t rotation = 1ULL << 4;
+            static constexpr uint64_t all = (1ULL << 5) - 1;
+        };
+
+        /**
+         * Decode only the fields selected by @p Mask, a bitwise or of Fields
+         * values. Strings, arrays and nested structs that are not selected are
+         * skipped over by their length prefixes without being allocated, and
+         * keep their previous value. Scalar fields are always decoded: they
+         * cost nothing to read and array lengths depend on them.
+         *
+         * @return The number of bytes decoded, or <0 if an error occured.
+         */
+        template <uint64_t Mask>
+        inline int decodeFields(const void *buf, int offset, int maxlen);
+
         /**
          * Retrieve the 64-bit fingerprint identifying the structure of the message.
          * Note that the fingerprint is the same for all instances of the same
@@ -65,18 +103,55 @@ class FrameTransform
          */
         inline static int64_t getHash();
 
+        /**
+         * The fingerprint returned by getHash(), as a compile-time constant.
+         */
+        static constexpr int64_t kHash = static_cast<int64_t>(0x9007a6260103b7feULL);
+
         /**
          * Returns "FrameTransform"
          */
         inline static const char* getTypeName();
 
+        /**
+         * Name, LCM type and array dimensions of each field, in wire order.
+         * See dimos_lcm::for_each_field() for visiting the fields themselves.
+         */
+        static constexpr std::array<dimos_lcm::field_info, 5> kFields = {{
+            { "timestamp", "builtin_interfaces.Time", false, 0, 0, NULL },
+            { "parent_frame_id", "string", true, 0, 0, NULL },
+            { "child_frame_id", "string", true, 0, 0, NULL },
+            { "translation", "geometry_msgs.Vector3", false, 0, 0, NULL },
+            { "rotation", "geometry_msgs.Quaternion", false, 0, 0, NULL },
+        }};
+
         // LCM support functions. Users should not call these
         inline int _encodeNoHash(void *buf, int offset, int maxlen) const;
+        template <typename Writer>
+        inline void _writeNoHash(Writer &out) const;
         inline int _getEncodedSizeNoHash() const;
         inline int _decodeNoHash(const void *buf, int offset, int maxlen);
+        template <uint64_t Mask>
+        inline int _decodeFieldsNoHash(const void *buf, int offset, int maxlen);
+        template <typename Self, typename Visitor>
+        inline static void _forEachField(Self &self, Visitor &visitor);
+        inline static int _skipNoHash(const void *buf, int offset, int maxlen);
         inline static uint64_t _computeHash(const __lcm_hash_ptr *p);
 };
 
+static_assert(FrameTransform::kHash == dimos_lcm::fingerprint(
+    dimos_lcm::signature_hash()
+        .member("timestamp", NULL, 0)
+        .member("parent_frame_id", "string", 0)
+        .member("child_frame_id", "string", 0)
+        .member("translation", NULL, 0)
+        .member("rotation", NULL, 0)
+        .value(),
+    builtin_interfaces::Time::kHash,
+    geometry_msgs::Vector3::kHash,
+    geometry_msgs::Quaternion::kHash),
+    "foxglove_msgs::FrameTransform fingerprint does not match its definition");
+
 int FrameTransform::encode(void *buf, int offset, int maxlen) const
 {
     int pos = 0, tlen;
@@ -91,6 +166,15 @@ int FrameTransform::encode(void *buf, int offset, int maxlen) const
     return pos;
 }
 
+int FrameTransform::encodeTo(std::vector<uint8_t> &buf) const
+{
+    dimos_lcm::vector_writer out(buf);
+    int64_t hash = getHash();
+    out.put(&hash, 1);
+    this->_writeNoHash(out);
+    return static_cast<int>(out.size());
+}
+
 int FrameTransform::decode(const void *buf, int offset, int maxlen)
 {
     int pos = 0, thislen;
@@ -106,6 +190,22 @@ int FrameTransform::decode(const void *buf, int offset, int maxlen)
     return pos;
 }
 
+template <uint64_t Mask>
+int FrameTransform::decodeFields(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, thislen;
+
+    int64_t msg_hash;
+    thislen = __int64_t_decode_array(buf, offset + pos, maxlen - pos, &msg_hash, 1);
+    if (thislen < 0) return thislen; else pos += thislen;
+    if (msg_hash != getHash()) return -1;
+
+    thislen = this->_decodeFieldsNoHash<Mask>(buf, offset + pos, maxlen - pos);
+    if (thislen < 0) return thislen; else pos += thislen;
+
+    return pos;
+}
+
 int FrameTransform::getEncodedSize() const
 {
     return 8 + _getEncodedSizeNoHash();
@@ -113,8 +213,7 @@ int FrameTransform::getEncodedSize() const
 
 int64_t FrameTransform::getHash()
 {
-    static int64_t hash = static_cast<int64_t>(_computeHash(NULL));
-    return hash;
+    return kHash;
 }
 
 const char* FrameTransform::getTypeName()
@@ -148,6 +247,16 @@ int FrameTransform::_encodeNoHash(void *buf, int offset, int maxlen) const
     return pos;
 }
 
+template <typename Writer>
+void FrameTransform::_writeNoHash(Writer &out) const
+{
+    this->timestamp._writeNoHash(out);
+    out.put(this->parent_frame_id);
+    out.put(this->child_frame_id);
+    this->translation._writeNoHash(out);
+    this->rotation._writeNoHash(out);
+}
+
 int FrameTransform::_decodeNoHash(const void *buf, int offset, int maxlen)
 {
     int pos = 0, tlen;
@@ -159,7 +268,7 @@ int FrameTransform::_decodeNoHash(const void *buf, int offset, int maxlen)
     tlen = __int32_t_decode_array(
         buf, offset + pos, maxlen - pos, &__parent_frame_id_len__, 1);
     if(tlen < 0) return tlen; else pos += tlen;
-    if(__parent_frame_id_len__ > maxlen - pos) return -1;
+    if(__parent_frame_id_len__ < 1 || __parent_frame_id_len__ > maxlen - pos) return -1;
     this->parent_frame_id.assign(
         static_cast<const char*>(buf) + offset + pos, __parent_frame_id_len__ - 1);
     pos += __parent_frame_id_len__;
@@ -168,7 +277,7 @@ int FrameTransform::_decodeNoHash(const void *buf, int offset, int maxlen)
     tlen = __int32_t_decode_array(
         buf, offset + pos, maxlen - pos, &__child_frame_id_len__, 1);
     if(tlen < 0) return tlen; else pos += tlen;
-    if(__child_frame_id_len__ > maxlen - pos) return -1;
+    if(__child_frame_id_len__ < 1 || __child_frame_id_len__ > maxlen - pos) return -1;
     this->child_frame_id.assign(
         static_cast<const char*>(buf) + offset + pos, __child_frame_id_len__ - 1);
     pos += __child_frame_id_len__;
@@ -182,6 +291,72 @@ int FrameTransform::_decodeNoHash(const void *buf, int offset, int maxlen)
     return pos;
 }
 
+template <uint64_t Mask>
+int FrameTransform::_decodeFieldsNoHash(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, tlen;
+
+    if ((Mask & Fields::timestamp) != 0) {
+        tlen = this->timestamp._decodeNoHash(buf, offset + pos, maxlen - pos);
+        if(tlen < 0) return tlen; else pos += tlen;
+    } else {
+        tlen = builtin_interfaces::Time::_skipNoHash(buf, offset + pos, maxlen - pos);
+        if(tlen < 0) return tlen; else pos += tlen;
+    }
+
+    if ((Mask & Fields::parent_frame_id) != 0) {
+        int32_t __parent_frame_id_len__;
+        tlen = __int32_t_decode_array(
+            buf, offset + pos, maxlen - pos, &__parent_frame_id_len__, 1);
+        if(tlen < 0) return tlen; else pos += tlen;
+        if(__parent_frame_id_len__ < 1 || __parent_frame_id_len__ > maxlen - pos) return -1;
+        this->parent_frame_id.assign(
+            static_cast<const char*>(buf) + offset + pos, __parent_frame_id_len__ - 1);
+        pos += __parent_frame_id_len__;
+    } else {
+        int32_t __parent_frame_id_len__;
+        tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &__parent_frame_id_len__, 1);
+        if(tlen < 0) return tlen; else pos += tlen;
+        if(__parent_frame_id_len__ < 0 || __parent_frame_id_len__ > maxlen - pos) return -1;
+        pos += __parent_frame_id_len__;
+    }
+
+    if ((Mask & Fields::child_frame_id) != 0) {
+        int32_t __child_frame_id_len__;
+        tlen = __int32_t_decode_array(
+            buf, offset + pos, maxlen - pos, &__child_frame_id_len__, 1);
+        if(tlen < 0) return tlen; else pos += tlen;
+        if(__child_frame_id_len__ < 1 || __child_frame_id_len__ > maxlen - pos) return -1;
+        this->child_frame_id.assign(
+            static_cast<const char*>(buf) + offset + pos, __child_frame_id_len__ - 1);
+        pos += __child_frame_id_len__;
+    } else {
+        int32_t __child_frame_id_len__;
+        tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &__child_frame_id_len__, 1);
+        if(tlen < 0) return tlen; else pos += tlen;
+        if(__child_frame_id_len__ < 0 || __child_frame_id_len__ > maxlen - pos) return -1;
+        pos += __child_frame_id_len__;
+    }
+
+    if ((Mask & Fields::translation) != 0) {
+        tlen = this->translation._decodeNoHash(buf, offset + pos, maxlen - pos);
+        if(tlen < 0) return tlen; else pos += tlen;
+    } else {
+        tlen = geometry_msgs::Vector3::_skipNoHash(buf, offset + pos, maxlen - pos);
+        if(tlen < 0) return tlen; else pos += tlen;
+    }
+
+    if ((Mask & Fields::rotation) != 0) {
+        tlen = this->rotation._decodeNoHash(buf, offset + pos, maxlen - pos);
+        if(tlen < 0) return tlen; else pos += tlen;
+    } else {
+        tlen = geometry_msgs::Quaternion::_skipNoHash(buf, offset + pos, maxlen - pos);
+        if(tlen < 0) return tlen; else pos += tlen;
+    }
+
+    return pos;
+}
+
 int FrameTransform::_getEncodedSizeNoHash() const
 {
     int enc_size = 0;
@@ -193,6 +368,39 @@ int FrameTransform::_getEncodedSizeNoHash() const
     return enc_size;
 }
 
+int FrameTransform::_skipNoHash(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, tlen;
+    tlen = builtin_interfaces::Time::_skipNoHash(buf, offset + pos, maxlen - pos);
+    if(tlen < 0) return tlen; else pos += tlen;
+    int32_t __parent_frame_id_len__;
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &__parent_frame_id_len__, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+    if(__parent_frame_id_len__ < 0 || __parent_frame_id_len__ > maxlen - pos) return -1;
+    pos += __parent_frame_id_len__;
+    int32_t __child_frame_id_len__;
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &__child_frame_id_len__, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+    if(__child_frame_id_len__ < 0 || __child_frame_id_len__ > maxlen - pos) return -1;
+    pos += __child_frame_id_len__;
+    tlen = geometry_msgs::Vector3::_skipNoHash(buf, offset + pos, maxlen - pos);
+    if(tlen < 0) return tlen; else pos += tlen;
+    tlen = geometry_msgs::Quaternion::_skipNoHash(buf, offset + pos, maxlen - pos);
+    if(tlen < 0) return tlen; else pos += tlen;
+    if(pos > maxlen) return -1;
+    return pos;
+}
+
+template <typename Self, typename Visitor>
+void FrameTransform::_forEachField(Self &self, Visitor &visitor)
+{
+    visitor(kFields[0], self.timestamp);
+    visitor(kFields[1], self.parent_frame_id);
+    visitor(kFields[2], self.child_frame_id);
+    visitor(kFields[3], self.translation);
+    visitor(kFields[4], self.rotation);
+}
+
 uint64_t FrameTransform::_computeHash(const __lcm_hash_ptr *p)
 {
     const __lcm_hash_ptr *fp;
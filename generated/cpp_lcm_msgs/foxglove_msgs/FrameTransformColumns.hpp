@@ -0,0 +1,245 @@
+/** THIS IS AN AUTOMATICALLY GENERATED FILE.  DO NOT MODIFY
+ * BY HAND!!
+ *
+ * Generated by lcm-cpp (tools/cpp/gen)
+ **/
+
+#ifndef __foxglove_msgs_FrameTransformColumns_hpp__
+#define __foxglove_msgs_FrameTransformColumns_hpp__
+
+#include <lcm/lcm_coretypes.h>
+
+#include <string>
+#include <vector>
+#include "dimos_lcm/fixed_codec.hpp"
+#include "foxglove_msgs/FrameTransform.hpp"
+
+namespace foxglove_msgs
+{
+
+/**
+ * Structure-of-arrays storage for a sequence of foxglove_msgs.FrameTransform: one
+ * contiguous array per field, with nested fields flattened and named by their
+ * path (timestamp_sec, timestamp_nanosec, ...). The soa:: message classes hold their
+ * FrameTransform arrays this way and decode them straight into the columns.
+ */
+class FrameTransformColumns
+{
+    public:
+        // timestamp.sec
+        std::vector< int32_t > timestamp_sec;
+
+        // timestamp.nanosec
+        std::vector< int32_t > timestamp_nanosec;
+
+        std::vector< std::string > parent_frame_id;
+
+        std::vector< std::string > child_frame_id;
+
+        // translation.x
+        std::vector< double > translation_x;
+
+        // translation.y
+        std::vector< double > translation_y;
+
+        // translation.z
+        std::vector< double > translation_z;
+
+        // rotation.x
+        std::vector< double > rotation_x;
+
+        // rotation.y
+        std::vector< double > rotation_y;
+
+        // rotation.z
+        std::vector< double > rotation_z;
+
+        // rotation.w
+        std::vector< double > rotation_w;
+
+    public:
+        /**
+         * Number of elements.
+         */
+        inline int size() const;
+
+        /**
+         * Resize every column to @p n elements.
+         */
+        inline void resize(int n);
+
+        /**
+         * Gather element @p i into a FrameTransform.
+         */
+        inline foxglove_msgs::FrameTransform get(int i) const;
+
+        /**
+         * Scatter @p msg into element @p i.
+         */
+        inline void set(int i, const foxglove_msgs::FrameTransform &msg);
+
+        // LCM support functions. Users should not call these
+        inline int _encodeNoHash(void *buf, int offset, int maxlen, int n) const;
+        template <typename Writer>
+        inline void _writeNoHash(Writer &out, int n) const;
+        inline int _getEncodedSizeNoHash(int n) const;
+        inline int _decodeNoHash(const void *buf, int offset, int maxlen, int n);
+};
+
+int FrameTransformColumns::size() const
+{
+    return static_cast<int>(this->timestamp_sec.size());
+}
+
+void FrameTransformColumns::resize(int n)
+{
+    this->timestamp_sec.resize(n);
+    this->timestamp_nanosec.resize(n);
+    this->parent_frame_id.resize(n);
+    this->child_frame_id.resize(n);
+    this->translation_x.resize(n);
+    this->translation_y.resize(n);
+    this->translation_z.resize(n);
+    this->rotation_x.resize(n);
+    this->rotation_y.resize(n);
+    this->rotation_z.resize(n);
+    this->rotation_w.resize(n);
+}
+
+foxglove_msgs::FrameTransform FrameTransformColumns::get(int i) const
+{
+    foxglove_msgs::FrameTransform msg;
+    msg.timestamp.sec = this->timestamp_sec[i];
+    msg.timestamp.nanosec = this->timestamp_nanosec[i];
+    msg.parent_frame_id = this->parent_frame_id[i];
+    msg.child_frame_id = this->child_frame_id[i];
+    msg.translation.x = this->translation_x[i];
+    msg.translation.y = this->translation_y[i];
+    msg.translation.z = this->translation_z[i];
+    msg.rotation.x = this->rotation_x[i];
+    msg.rotation.y = this->rotation_y[i];
+    msg.rotation.z = this->rotation_z[i];
+    msg.rotation.w = this->rotation_w[i];
+    return msg;
+}
+
+void FrameTransformColumns::set(int i, const foxglove_msgs::FrameTransform &msg)
+{
+    this->timestamp_sec[i] = msg.timestamp.sec;
+    this->timestamp_nanosec[i] = msg.timestamp.nanosec;
+    this->parent_frame_id[i] = msg.parent_frame_id;
+    this->child_frame_id[i] = msg.child_frame_id;
+    this->translation_x[i] = msg.translation.x;
+    this->translation_y[i] = msg.translation.y;
+    this->translation_z[i] = msg.translation.z;
+    this->rotation_x[i] = msg.rotation.x;
+    this->rotation_y[i] = msg.rotation.y;
+    this->rotation_z[i] = msg.rotation.z;
+    this->rotation_w[i] = msg.rotation.w;
+}
+
+int FrameTransformColumns::_encodeNoHash(void *buf, int offset, int maxlen, int n) const
+{
+    uint8_t *p = static_cast<uint8_t*>(buf) + offset;
+    int pos = 0;
+    for (int i = 0; i < n; i++) {
+        if(maxlen - pos < 8) return -1;
+        dimos_lcm::store_be(p + pos + 0, this->timestamp_sec[i]);
+        dimos_lcm::store_be(p + pos + 4, this->timestamp_nanosec[i]);
+        pos += 8;
+        int32_t __parent_frame_id_len__ = static_cast<int32_t>(this->parent_frame_id[i].size()) + 1;
+        if(maxlen - pos < 4 || __parent_frame_id_len__ > maxlen - pos - 4) return -1;
+        dimos_lcm::store_be(p + pos, __parent_frame_id_len__);
+        memcpy(p + pos + 4, this->parent_frame_id[i].c_str(), __parent_frame_id_len__);
+        pos += 4 + __parent_frame_id_len__;
+        int32_t __child_frame_id_len__ = static_cast<int32_t>(this->child_frame_id[i].size()) + 1;
+        if(maxlen - pos < 4 || __child_frame_id_len__ > maxlen - pos - 4) return -1;
+        dimos_lcm::store_be(p + pos, __child_frame_id_len__);
+        memcpy(p + pos + 4, this->child_frame_id[i].c_str(), __child_frame_id_len__);
+        pos += 4 + __child_frame_id_len__;
+        if(maxlen - pos < 56) return -1;
+        dimos_lcm::store_be(p + pos + 0, this->translation_x[i]);
+        dimos_lcm::store_be(p + pos + 8, this->translation_y[i]);
+        dimos_lcm::store_be(p + pos + 16, this->translation_z[i]);
+        dimos_lcm::store_be(p + pos + 24, this->rotation_x[i]);
+        dimos_lcm::store_be(p + pos + 32, this->rotation_y[i]);
+        dimos_lcm::store_be(p + pos + 40, this->rotation_z[i]);
+        dimos_lcm::store_be(p + pos + 48, this->rotation_w[i]);
+        pos += 56;
+    }
+    return pos;
+}
+
+template <typename Writer>
+void FrameTransformColumns::_writeNoHash(Writer &out, int n) const
+{
+    for (int i = 0; i < n; i++) {
+        {
+            uint8_t *p = out.extend(8);
+            dimos_lcm::store_be(p + 0, this->timestamp_sec[i]);
+            dimos_lcm::store_be(p + 4, this->timestamp_nanosec[i]);
+        }
+        out.put(this->parent_frame_id[i]);
+        out.put(this->child_frame_id[i]);
+        {
+            uint8_t *p = out.extend(56);
+            dimos_lcm::store_be(p + 0, this->translation_x[i]);
+            dimos_lcm::store_be(p + 8, this->translation_y[i]);
+            dimos_lcm::store_be(p + 16, this->translation_z[i]);
+            dimos_lcm::store_be(p + 24, this->rotation_x[i]);
+            dimos_lcm::store_be(p + 32, this->rotation_y[i]);
+            dimos_lcm::store_be(p + 40, this->rotation_z[i]);
+            dimos_lcm::store_be(p + 48, this->rotation_w[i]);
+        }
+    }
+}
+
+int FrameTransformColumns::_getEncodedSizeNoHash(int n) const
+{
+    int size = n * 74;
+    for (int i = 0; i < n; i++)
+        size += this->parent_frame_id[i].size() + this->child_frame_id[i].size();
+    return size;
+}
+
+int FrameTransformColumns::_decodeNoHash(const void *buf, int offset, int maxlen, int n)
+{
+    if(n < 0 || n > maxlen / 74) return -1;
+    this->resize(n);
+    const uint8_t *p = static_cast<const uint8_t*>(buf) + offset;
+    int pos = 0;
+    for (int i = 0; i < n; i++) {
+        if(maxlen - pos < 8) return -1;
+        dimos_lcm::load_be(p + pos + 0, this->timestamp_sec[i]);
+        dimos_lcm::load_be(p + pos + 4, this->timestamp_nanosec[i]);
+        pos += 8;
+        int32_t __parent_frame_id_len__;
+        if(maxlen - pos < 4) return -1;
+        dimos_lcm::load_be(p + pos, __parent_frame_id_len__);
+        pos += 4;
+        if(__parent_frame_id_len__ < 1 || __parent_frame_id_len__ > maxlen - pos) return -1;
+        this->parent_frame_id[i].assign(reinterpret_cast<const char*>(p) + pos, __parent_frame_id_len__ - 1);
+        pos += __parent_frame_id_len__;
+        int32_t __child_frame_id_len__;
+        if(maxlen - pos < 4) return -1;
+        dimos_lcm::load_be(p + pos, __child_frame_id_len__);
+        pos += 4;
+        if(__child_frame_id_len__ < 1 || __child_frame_id_len__ > maxlen - pos) return -1;
+        this->child_frame_id[i].assign(reinterpret_cast<const char*>(p) + pos, __child_frame_id_len__ - 1);
+        pos += __child_frame_id_len__;
+        if(maxlen - pos < 56) return -1;
+        dimos_lcm::load_be(p + pos + 0, this->translation_x[i]);
+        dimos_lcm::load_be(p + pos + 8, this->translation_y[i]);
+        dimos_lcm::load_be(p + pos + 16, this->translation_z[i]);
+        dimos_lcm::load_be(p + pos + 24, this->rotation_x[i]);
+        dimos_lcm::load_be(p + pos + 32, this->rotation_y[i]);
+        dimos_lcm::load_be(p + pos + 40, this->rotation_z[i]);
+        dimos_lcm::load_be(p + pos + 48, this->rotation_w[i]);
+        pos += 56;
+    }
+    return pos;
+}
+
+}
+
+#endif
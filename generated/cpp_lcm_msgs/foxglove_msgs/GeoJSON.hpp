@@ -1,7 +1,7 @@
 /** THIS IS AN AUTOMATICALLY GENERATED FILE.  DO NOT MODIFY
  * BY HAND!!
  *
- * Generated by lcm-gen 1.5.2
+ * Generated by lcm-cpp (tools/cpp/gen)
  **/
 
 #ifndef __foxglove_msgs_GeoJSON_hpp__
@@ -9,7 +9,11 @@
 
 #include <lcm/lcm_coretypes.h>
 
+#include <array>
 #include <string>
+#include "dimos_lcm/writer.hpp"
+#include "dimos_lcm/fingerprint.hpp"
+#include "dimos_lcm/reflection.hpp"
 
 namespace foxglove_msgs
 {
@@ -31,6 +35,15 @@ class GeoJSON
          */
         inline int encode(void *buf, int offset, int maxlen) const;
 
+        /**
+         * Encode a message by appending it to @p buf, walking the message once
+         * instead of sizing it with getEncodedSize() first. @p buf grows
+         * geometrically; reuse it across calls to avoid reallocating.
+         *
+         * @return The number of bytes appended.
+         */
+        inline int encodeTo(std::vector<uint8_t> &buf) const;
+
         /**
          * Check how many bytes are required to encode this message.
          */
@@ -46,6 +59,27 @@ class GeoJSON
          */
         inline int decode(const void *buf, int offset, int maxlen);
 
+        /**
+         * Field bits for decodeFields().
+         */
+        struct Fields
+        {
+            static constexpr uint64_t geojson = 1ULL << 0;
+            static constexpr uint64_t all = (1ULL << 1) - 1;
+        };
+
+        /**
+         * Decode only the fields selected by @p Mask, a bitwise or of Fields
+         * values. Strings, arrays and nested structs that are not selected are
+         * skipped over by their length prefixes without being allocated, and
+         * keep their previous value. Scalar fields are always decoded: they
+         * cost nothing to read and array lengths depend on them.
+         *
+         * @return The number of bytes decoded, or <0 if an error occured.
+         */
+        template <uint64_t Mask>
+        inline int decodeFields(const void *buf, int offset, int maxlen);
+
         /**
          * Retrieve the 64-bit fingerprint identifying the structure of the message.
          * Note that the fingerprint is the same for all instances of the same
@@ -54,18 +88,44 @@ class GeoJSON
          */
         inline static int64_t getHash();
 
+        /**
+         * The fingerprint returned by getHash(), as a compile-time constant.
+         */
+        static constexpr int64_t kHash = static_cast<int64_t>(0x2a847ea2f2965d78ULL);
+
         /**
          * Returns "GeoJSON"
          */
         inline static const char* getTypeName();
 
+        /**
+         * Name, LCM type and array dimensions of each field, in wire order.
+         * See dimos_lcm::for_each_field() for visiting the fields themselves.
+         */
+        static constexpr std::array<dimos_lcm::field_info, 1> kFields = {{
+            { "geojson", "string", true, 0, 0, NULL },
+        }};
+
         // LCM support functions. Users should not call these
         inline int _encodeNoHash(void *buf, int offset, int maxlen) const;
+        template <typename Writer>
+        inline void _writeNoHash(Writer &out) const;
         inline int _getEncodedSizeNoHash() const;
         inline int _decodeNoHash(const void *buf, int offset, int maxlen);
+        template <uint64_t Mask>
+        inline int _decodeFieldsNoHash(const void *buf, int offset, int maxlen);
+        template <typename Self, typename Visitor>
+        inline static void _forEachField(Self &self, Visitor &visitor);
+        inline static int _skipNoHash(const void *buf, int offset, int maxlen);
         inline static uint64_t _computeHash(const __lcm_hash_ptr *p);
 };
 
+static_assert(GeoJSON::kHash == dimos_lcm::fingerprint(
+    dimos_lcm::signature_hash()
+        .member("geojson", "string", 0)
+        .value()),
+    "foxglove_msgs::GeoJSON fingerprint does not match its definition");
+
 int GeoJSON::encode(void *buf, int offset, int maxlen) const
 {
     int pos = 0, tlen;
@@ -80,6 +140,15 @@ int GeoJSON::encode(void *buf, int offset, int maxlen) const
     return pos;
 }
 
+int GeoJSON::encodeTo(std::vector<uint8_t> &buf) const
+{
+    dimos_lcm::vector_writer out(buf);
+    int64_t hash = getHash();
+    out.put(&hash, 1);
+    this->_writeNoHash(out);
+    return static_cast<int>(out.size());
+}
+
 int GeoJSON::decode(const void *buf, int offset, int maxlen)
 {
     int pos = 0, thislen;
@@ -95,6 +164,22 @@ int GeoJSON::decode(const void *buf, int offset, int maxlen)
     return pos;
 }
 
+template <uint64_t Mask>
+int GeoJSON::decodeFields(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, thislen;
+
+    int64_t msg_hash;
+    thislen = __int64_t_decode_array(buf, offset + pos, maxlen - pos, &msg_hash, 1);
+    if (thislen < 0) return thislen; else pos += thislen;
+    if (msg_hash != getHash()) return -1;
+
+    thislen = this->_decodeFieldsNoHash<Mask>(buf, offset + pos, maxlen - pos);
+    if (thislen < 0) return thislen; else pos += thislen;
+
+    return pos;
+}
+
 int GeoJSON::getEncodedSize() const
 {
     return 8 + _getEncodedSizeNoHash();
@@ -102,8 +187,7 @@ int GeoJSON::getEncodedSize() const
 
 int64_t GeoJSON::getHash()
 {
-    static int64_t hash = static_cast<int64_t>(_computeHash(NULL));
-    return hash;
+    return kHash;
 }
 
 const char* GeoJSON::getTypeName()
@@ -123,6 +207,12 @@ int GeoJSON::_encodeNoHash(void *buf, int offset, int maxlen) const
     return pos;
 }
 
+template <typename Writer>
+void GeoJSON::_writeNoHash(Writer &out) const
+{
+    out.put(this->geojson);
+}
+
 int GeoJSON::_decodeNoHash(const void *buf, int offset, int maxlen)
 {
     int pos = 0, tlen;
@@ -131,7 +221,7 @@ int GeoJSON::_decodeNoHash(const void *buf, int offset, int maxlen)
     tlen = __int32_t_decode_array(
         buf, offset + pos, maxlen - pos, &__geojson_len__, 1);
     if(tlen < 0) return tlen; else pos += tlen;
-    if(__geojson_len__ > maxlen - pos) return -1;
+    if(__geojson_len__ < 1 || __geojson_len__ > maxlen - pos) return -1;
     this->geojson.assign(
         static_cast<const char*>(buf) + offset + pos, __geojson_len__ - 1);
     pos += __geojson_len__;
@@ -139,6 +229,31 @@ int GeoJSON::_decodeNoHash(const void *buf, int offset, int maxlen)
     return pos;
 }
 
+template <uint64_t Mask>
+int GeoJSON::_decodeFieldsNoHash(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, tlen;
+
+    if ((Mask & Fields::geojson) != 0) {
+        int32_t __geojson_len__;
+        tlen = __int32_t_decode_array(
+            buf, offset + pos, maxlen - pos, &__geojson_len__, 1);
+        if(tlen < 0) return tlen; else pos += tlen;
+        if(__geojson_len__ < 1 || __geojson_len__ > maxlen - pos) return -1;
+        this->geojson.assign(
+            static_cast<const char*>(buf) + offset + pos, __geojson_len__ - 1);
+        pos += __geojson_len__;
+    } else {
+        int32_t __geojson_len__;
+        tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &__geojson_len__, 1);
+        if(tlen < 0) return tlen; else pos += tlen;
+        if(__geojson_len__ < 0 || __geojson_len__ > maxlen - pos) return -1;
+        pos += __geojson_len__;
+    }
+
+    return pos;
+}
+
 int GeoJSON::_getEncodedSizeNoHash() const
 {
     int enc_size = 0;
@@ -146,6 +261,24 @@ int GeoJSON::_getEncodedSizeNoHash() const
     return enc_size;
 }
 
+int GeoJSON::_skipNoHash(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, tlen;
+    int32_t __geojson_len__;
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &__geojson_len__, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+    if(__geojson_len__ < 0 || __geojson_len__ > maxlen - pos) return -1;
+    pos += __geojson_len__;
+    if(pos > maxlen) return -1;
+    return pos;
+}
+
+template <typename Self, typename Visitor>
+void GeoJSON::_forEachField(Self &self, Visitor &visitor)
+{
+    visitor(kFields[0], self.geojson);
+}
+
 uint64_t GeoJSON::_computeHash(const __lcm_hash_ptr *)
 {
     uint64_t hash = 0x15423f51794b2ebcLL;
@@ -1,7 +1,7 @@
 /** THIS IS AN AUTOMATICALLY GENERATED FILE.  DO NOT MODIFY
  * BY HAND!!
  *
- * Generated by lcm-gen 1.5.2
+ * Generated by lcm-cpp (tools/cpp/gen)
  **/
 
 #ifndef __foxglove_msgs_Grid_hpp__
@@ -9,8 +9,13 @@
 
 #include <lcm/lcm_coretypes.h>
 
+#include <array>
 #include <string>
 #include <vector>
+#include "dimos_lcm/iov_writer.hpp"
+#include "dimos_lcm/wire_builder.hpp"
+#include "dimos_lcm/fingerprint.hpp"
+#include "dimos_lcm/reflection.hpp"
 #include "builtin_interfaces/Time.hpp"
 #include "geometry_msgs/Pose.hpp"
 #include "foxglove_msgs/Vector2.hpp"
@@ -62,6 +67,37 @@ class Grid
          */
         inline int encode(void *buf, int offset, int maxlen) const;
 
+        /**
+         * Encode a message by appending it to @p buf, walking the message once
+         * instead of sizing it with getEncodedSize() first. @p buf grows
+         * geometrically; reuse it across calls to avoid reallocating.
+         *
+         * @return The number of bytes appended.
+         */
+        inline int encodeTo(std::vector<uint8_t> &buf) const;
+
+        /**
+         * Encode a message as a list of buffers for writev()/sendmsg(). Byte
+         * payloads are referenced in place instead of copied; see
+         * dimos_lcm/iov_writer.hpp for how long they must stay valid.
+         *
+         * @param out Receives the encoded message after anything it already holds.
+         * @return The number of bytes encoded.
+         */
+        inline int encodeIov(dimos_lcm::iov_writer &out) const;
+
+        /**
+         * Encode a message into the buffer of @p out, leaving a gap at the
+         * place of each byte payload for the caller to fill; see
+         * dimos_lcm/wire_builder.hpp. The payload arrays are not read: set
+         * their length fields, and leave the arrays empty to skip filling them
+         * twice.
+         *
+         * @param out Receives the encoded message after anything it already holds.
+         * @return The number of bytes encoded, or <0 if they do not fit.
+         */
+        inline int encodeInPlace(dimos_lcm::wire_builder &out) const;
+
         /**
          * Check how many bytes are required to encode this message.
          */
@@ -77,6 +113,50 @@ class Grid
          */
         inline int decode(const void *buf, int offset, int maxlen);
 
+        /**
+         * Field bits for decodeFields().
+         */
+        struct Fields
+        {
+            static constexpr uint64_t fields_length = 1ULL << 0;
+            static constexpr uint64_t data_length = 1ULL << 1;
+            static constexpr uint64_t timestamp = 1ULL << 2;
+            static constexpr uint64_t frame_id = 1ULL << 3;
+            static constexpr uint64_t pose = 1ULL << 4;
+            static constexpr uint64_t column_count = 1ULL << 5;
+            static constexpr uint64_t cell_size = 1ULL << 6;
+            static constexpr uint64_t row_stride = 1ULL << 7;
+            static constexpr uint64_t cell_stride = 1ULL << 8;
+            static constexpr uint64_t fields = 1ULL << 9;
+            static constexpr uint64_t data = 1ULL << 10;
+            static constexpr uint64_t all = (1ULL << 11) - 1;
+        };
+
+        /**
+         * Decode only the fields selected by @p Mask, a bitwise or of Fields
+         * values. Strings, arrays and nested structs that are not selected are
+         * skipped over by their length prefixes without being allocated, and
+         * keep their previous value. Scalar fields are always decoded: they
+         * cost nothing to read and array lengths depend on them.
+         *
+         * @return The number of bytes decoded, or <0 if an error occured.
+         */
+        template <uint64_t Mask>
+        inline int decodeFields(const void *buf, int offset, int maxlen);
+
+        /**
+         * Upper bound on the length of every variable-length array of this
+         * type, checked by decode() before anything is allocated; messages
+         * exceeding it fail to decode. It does not apply to nested types,
+         * which have their own. Set it once at startup, before decoding.
+         * Before C++17 it is a constant with no limit.
+         */
+#if __cplusplus >= 201703L
+        static inline int32_t maxArrayLength = INT32_MAX;
+#else
+        static constexpr int32_t maxArrayLength = INT32_MAX;
+#endif
+
         /**
          * Retrieve the 64-bit fingerprint identifying the structure of the message.
          * Note that the fingerprint is the same for all instances of the same
@@ -85,18 +165,68 @@ class Grid
          */
         inline static int64_t getHash();
 
+        /**
+         * The fingerprint returned by getHash(), as a compile-time constant.
+         */
+        static constexpr int64_t kHash = static_cast<int64_t>(0x6e1e26f538f7d7b0ULL);
+
         /**
          * Returns "Grid"
          */
         inline static const char* getTypeName();
 
+        /**
+         * Name, LCM type and array dimensions of each field, in wire order.
+         * See dimos_lcm::for_each_field() for visiting the fields themselves.
+         */
+        static constexpr std::array<dimos_lcm::field_info, 11> kFields = {{
+            { "fields_length", "int32_t", true, 0, 0, NULL },
+            { "data_length", "int32_t", true, 0, 0, NULL },
+            { "timestamp", "builtin_interfaces.Time", false, 0, 0, NULL },
+            { "frame_id", "string", true, 0, 0, NULL },
+            { "pose", "geometry_msgs.Pose", false, 0, 0, NULL },
+            { "column_count", "int32_t", true, 0, 0, NULL },
+            { "cell_size", "foxglove_msgs.Vector2", false, 0, 0, NULL },
+            { "row_stride", "int32_t", true, 0, 0, NULL },
+            { "cell_stride", "int32_t", true, 0, 0, NULL },
+            { "fields", "foxglove_msgs.PackedElementField", false, 1, -1, "fields_length" },
+            { "data", "byte", true, 1, -1, "data_length" },
+        }};
+
         // LCM support functions. Users should not call these
         inline int _encodeNoHash(void *buf, int offset, int maxlen) const;
+        template <typename Writer>
+        inline void _writeNoHash(Writer &out) const;
         inline int _getEncodedSizeNoHash() const;
         inline int _decodeNoHash(const void *buf, int offset, int maxlen);
+        template <uint64_t Mask>
+        inline int _decodeFieldsNoHash(const void *buf, int offset, int maxlen);
+        template <typename Self, typename Visitor>
+        inline static void _forEachField(Self &self, Visitor &visitor);
+        inline static int _skipNoHash(const void *buf, int offset, int maxlen);
         inline static uint64_t _computeHash(const __lcm_hash_ptr *p);
 };
 
+static_assert(Grid::kHash == dimos_lcm::fingerprint(
+    dimos_lcm::signature_hash()
+        .member("fields_length", "int32_t", 0)
+        .member("data_length", "int32_t", 0)
+        .member("timestamp", NULL, 0)
+        .member("frame_id", "string", 0)
+        .member("pose", NULL, 0)
+        .member("column_count", "int32_t", 0)
+        .member("cell_size", NULL, 0)
+        .member("row_stride", "int32_t", 0)
+        .member("cell_stride", "int32_t", 0)
+        .member("fields", NULL, 1).dim(true, "fields_length")
+        .member("data", "byte", 1).dim(true, "data_length")
+        .value(),
+    builtin_interfaces::Time::kHash,
+    geometry_msgs::Pose::kHash,
+    foxglove_msgs::Vector2::kHash,
+    foxglove_msgs::PackedElementField::kHash),
+    "foxglove_msgs::Grid fingerprint does not match its definition");
+
 int Grid::encode(void *buf, int offset, int maxlen) const
 {
     int pos = 0, tlen;
@@ -111,6 +241,35 @@ int Grid::encode(void *buf, int offset, int maxlen) const
     return pos;
 }
 
+int Grid::encodeTo(std::vector<uint8_t> &buf) const
+{
+    dimos_lcm::vector_writer out(buf);
+    int64_t hash = getHash();
+    out.put(&hash, 1);
+    this->_writeNoHash(out);
+    return static_cast<int>(out.size());
+}
+
+int Grid::encodeIov(dimos_lcm::iov_writer &out) const
+{
+    size_t start = out.size();
+    int64_t hash = getHash();
+    out.put(&hash, 1);
+    this->_writeNoHash(out);
+    return static_cast<int>(out.size() - start);
+}
+
+int Grid::encodeInPlace(dimos_lcm::wire_builder &out) const
+{
+    int size = getEncodedSize();
+    if (static_cast<size_t>(size) > out.remaining())
+        return -1;
+    int64_t hash = getHash();
+    out.put(&hash, 1);
+    this->_writeNoHash(out);
+    return size;
+}
+
 int Grid::decode(const void *buf, int offset, int maxlen)
 {
     int pos = 0, thislen;
@@ -126,6 +285,22 @@ int Grid::decode(const void *buf, int offset, int maxlen)
     return pos;
 }
 
+template <uint64_t Mask>
+int Grid::decodeFields(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, thislen;
+
+    int64_t msg_hash;
+    thislen = __int64_t_decode_array(buf, offset + pos, maxlen - pos, &msg_hash, 1);
+    if (thislen < 0) return thislen; else pos += thislen;
+    if (msg_hash != getHash()) return -1;
+
+    thislen = this->_decodeFieldsNoHash<Mask>(buf, offset + pos, maxlen - pos);
+    if (thislen < 0) return thislen; else pos += thislen;
+
+    return pos;
+}
+
 int Grid::getEncodedSize() const
 {
     return 8 + _getEncodedSizeNoHash();
@@ -133,8 +308,7 @@ int Grid::getEncodedSize() const
 
 int64_t Grid::getHash()
 {
-    static int64_t hash = static_cast<int64_t>(_computeHash(NULL));
-    return hash;
+    return kHash;
 }
 
 const char* Grid::getTypeName()
@@ -188,6 +362,24 @@ int Grid::_encodeNoHash(void *buf, int offset, int maxlen) const
     return pos;
 }
 
+template <typename Writer>
+void Grid::_writeNoHash(Writer &out) const
+{
+    out.put(&this->fields_length, 1);
+    out.put(&this->data_length, 1);
+    this->timestamp._writeNoHash(out);
+    out.put(this->frame_id);
+    this->pose._writeNoHash(out);
+    out.put(&this->column_count, 1);
+    this->cell_size._writeNoHash(out);
+    out.put(&this->row_stride, 1);
+    out.put(&this->cell_stride, 1);
+    for (int a0 = 0; a0 < this->fields_length; a0++)
+        this->fields[a0]._writeNoHash(out);
+    if(this->data_length > 0)
+        out.reference(this->data.data(), this->data_length);
+}
+
 int Grid::_decodeNoHash(const void *buf, int offset, int maxlen)
 {
     int pos = 0, tlen;
@@ -205,7 +397,7 @@ int Grid::_decodeNoHash(const void *buf, int offset, int maxlen)
     tlen = __int32_t_decode_array(
         buf, offset + pos, maxlen - pos, &__frame_id_len__, 1);
     if(tlen < 0) return tlen; else pos += tlen;
-    if(__frame_id_len__ > maxlen - pos) return -1;
+    if(__frame_id_len__ < 1 || __frame_id_len__ > maxlen - pos) return -1;
     this->frame_id.assign(
         static_cast<const char*>(buf) + offset + pos, __frame_id_len__ - 1);
     pos += __frame_id_len__;
@@ -225,6 +417,7 @@ int Grid::_decodeNoHash(const void *buf, int offset, int maxlen)
     tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &this->cell_stride, 1);
     if(tlen < 0) return tlen; else pos += tlen;
 
+    if(this->fields_length < 0 || this->fields_length > (maxlen - pos) / 10 || this->fields_length > maxArrayLength) return -1;
     try {
         this->fields.resize(this->fields_length);
     } catch (...) {
@@ -236,9 +429,109 @@ int Grid::_decodeNoHash(const void *buf, int offset, int maxlen)
     }
 
     if(this->data_length) {
-        this->data.resize(this->data_length);
-        tlen = __byte_decode_array(buf, offset + pos, maxlen - pos, &this->data[0], this->data_length);
+        if(this->data_length < 0 || this->data_length > maxlen - pos || this->data_length > maxArrayLength) return -1;
+        const uint8_t *__data_src__ = static_cast<const uint8_t*>(buf) + offset + pos;
+        this->data.assign(__data_src__, __data_src__ + this->data_length);
+        pos += this->data_length;
+    } else {
+        this->data.clear();
+    }
+
+    return pos;
+}
+
+template <uint64_t Mask>
+int Grid::_decodeFieldsNoHash(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, tlen;
+
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &this->fields_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &this->data_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    if ((Mask & Fields::timestamp) != 0) {
+        tlen = this->timestamp._decodeNoHash(buf, offset + pos, maxlen - pos);
         if(tlen < 0) return tlen; else pos += tlen;
+    } else {
+        tlen = builtin_interfaces::Time::_skipNoHash(buf, offset + pos, maxlen - pos);
+        if(tlen < 0) return tlen; else pos += tlen;
+    }
+
+    if ((Mask & Fields::frame_id) != 0) {
+        int32_t __frame_id_len__;
+        tlen = __int32_t_decode_array(
+            buf, offset + pos, maxlen - pos, &__frame_id_len__, 1);
+        if(tlen < 0) return tlen; else pos += tlen;
+        if(__frame_id_len__ < 1 || __frame_id_len__ > maxlen - pos) return -1;
+        this->frame_id.assign(
+            static_cast<const char*>(buf) + offset + pos, __frame_id_len__ - 1);
+        pos += __frame_id_len__;
+    } else {
+        int32_t __frame_id_len__;
+        tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &__frame_id_len__, 1);
+        if(tlen < 0) return tlen; else pos += tlen;
+        if(__frame_id_len__ < 0 || __frame_id_len__ > maxlen - pos) return -1;
+        pos += __frame_id_len__;
+    }
+
+    if ((Mask & Fields::pose) != 0) {
+        tlen = this->pose._decodeNoHash(buf, offset + pos, maxlen - pos);
+        if(tlen < 0) return tlen; else pos += tlen;
+    } else {
+        tlen = geometry_msgs::Pose::_skipNoHash(buf, offset + pos, maxlen - pos);
+        if(tlen < 0) return tlen; else pos += tlen;
+    }
+
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &this->column_count, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    if ((Mask & Fields::cell_size) != 0) {
+        tlen = this->cell_size._decodeNoHash(buf, offset + pos, maxlen - pos);
+        if(tlen < 0) return tlen; else pos += tlen;
+    } else {
+        tlen = foxglove_msgs::Vector2::_skipNoHash(buf, offset + pos, maxlen - pos);
+        if(tlen < 0) return tlen; else pos += tlen;
+    }
+
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &this->row_stride, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &this->cell_stride, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    if ((Mask & Fields::fields) != 0) {
+        if(this->fields_length < 0 || this->fields_length > (maxlen - pos) / 10 || this->fields_length > maxArrayLength) return -1;
+        try {
+            this->fields.resize(this->fields_length);
+        } catch (...) {
+            return -1;
+        }
+        for (int a0 = 0; a0 < this->fields_length; a0++) {
+            tlen = this->fields[a0]._decodeNoHash(buf, offset + pos, maxlen - pos);
+            if(tlen < 0) return tlen; else pos += tlen;
+        }
+    } else {
+        if(this->fields_length < 0) return -1;
+        for (int a0 = 0; a0 < this->fields_length; a0++) {
+            tlen = foxglove_msgs::PackedElementField::_skipNoHash(buf, offset + pos, maxlen - pos);
+            if(tlen < 0) return tlen; else pos += tlen;
+        }
+    }
+
+    if ((Mask & Fields::data) != 0) {
+        if(this->data_length) {
+            if(this->data_length < 0 || this->data_length > maxlen - pos || this->data_length > maxArrayLength) return -1;
+            const uint8_t *__data_src__ = static_cast<const uint8_t*>(buf) + offset + pos;
+            this->data.assign(__data_src__, __data_src__ + this->data_length);
+            pos += this->data_length;
+        } else {
+            this->data.clear();
+        }
+    } else {
+        if(this->data_length < 0 || this->data_length > maxlen - pos) return -1;
+        pos += this->data_length;
     }
 
     return pos;
@@ -263,6 +556,56 @@ int Grid::_getEncodedSizeNoHash() const
     return enc_size;
 }
 
+int Grid::_skipNoHash(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, tlen;
+    int32_t fields_length;
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &fields_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+    int32_t data_length;
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &data_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+    tlen = builtin_interfaces::Time::_skipNoHash(buf, offset + pos, maxlen - pos);
+    if(tlen < 0) return tlen; else pos += tlen;
+    int32_t __frame_id_len__;
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &__frame_id_len__, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+    if(__frame_id_len__ < 0 || __frame_id_len__ > maxlen - pos) return -1;
+    pos += __frame_id_len__;
+    tlen = geometry_msgs::Pose::_skipNoHash(buf, offset + pos, maxlen - pos);
+    if(tlen < 0) return tlen; else pos += tlen;
+    pos += 4;
+    tlen = foxglove_msgs::Vector2::_skipNoHash(buf, offset + pos, maxlen - pos);
+    if(tlen < 0) return tlen; else pos += tlen;
+    pos += 4;
+    pos += 4;
+    if(fields_length < 0) return -1;
+    for (int a0 = 0; a0 < fields_length; a0++) {
+        tlen = foxglove_msgs::PackedElementField::_skipNoHash(buf, offset + pos, maxlen - pos);
+        if(tlen < 0) return tlen; else pos += tlen;
+    }
+    if(data_length < 0 || data_length > maxlen - pos) return -1;
+    pos += data_length;
+    if(pos > maxlen) return -1;
+    return pos;
+}
+
+template <typename Self, typename Visitor>
+void Grid::_forEachField(Self &self, Visitor &visitor)
+{
+    visitor(kFields[0], self.fields_length);
+    visitor(kFields[1], self.data_length);
+    visitor(kFields[2], self.timestamp);
+    visitor(kFields[3], self.frame_id);
+    visitor(kFields[4], self.pose);
+    visitor(kFields[5], self.column_count);
+    visitor(kFields[6], self.cell_size);
+    visitor(kFields[7], self.row_stride);
+    visitor(kFields[8], self.cell_stride);
+    visitor(kFields[9], self.fields);
+    visitor(kFields[10], self.data);
+}
+
 uint64_t Grid::_computeHash(const __lcm_hash_ptr *p)
 {
     const __lcm_hash_ptr *fp;
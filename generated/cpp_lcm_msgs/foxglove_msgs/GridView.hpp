@@ -0,0 +1,185 @@
+/** THIS IS AN AUTOMATICALLY GENERATED FILE.  DO NOT MODIFY
+ * BY HAND!!
+ *
+ * Generated by lcm-cpp (tools/cpp/gen)
+ **/
+
+#ifndef __foxglove_msgs_GridView_hpp__
+#define __foxglove_msgs_GridView_hpp__
+
+#include <lcm/lcm_coretypes.h>
+
+#include <string_view>
+#include "dimos_lcm/view.hpp"
+#include "foxglove_msgs/Grid.hpp"
+#include "foxglove_msgs/PackedElementFieldView.hpp"
+
+namespace foxglove_msgs
+{
+
+/**
+ * Zero-copy read-only view of an encoded foxglove_msgs.Grid.
+ *
+ * Strings and variable-length arrays point into the buffer given to decode(),
+ * which must outlive the view. Decoding validates the whole message once and
+ * never allocates.
+ */
+class GridView
+{
+    public:
+        int32_t    fields_length;
+
+        int32_t    data_length;
+
+        builtin_interfaces::Time timestamp;
+
+        std::string_view frame_id;
+
+        geometry_msgs::Pose pose;
+
+        int32_t    column_count;
+
+        foxglove_msgs::Vector2 cell_size;
+
+        int32_t    row_stride;
+
+        int32_t    cell_stride;
+
+        /**
+         * LCM Type: foxglove_msgs.PackedElementField[fields_length]
+         */
+        dimos_lcm::view_array< foxglove_msgs::PackedElementFieldView > fields;
+
+        /**
+         * LCM Type: byte[data_length]
+         */
+        dimos_lcm::span< const uint8_t > data;
+
+    public:
+        /**
+         * Decode a view over a message in binary form.
+         *
+         * @param buf The buffer containing the encoded message. It must outlive
+         *  this view.
+         * @param offset The byte offset into @p buf where the encoded message starts.
+         * @param maxlen The maximum number of bytes to read while decoding.
+         * @return The number of bytes decoded, or <0 if an error occured.
+         */
+        inline int decode(const void *buf, int offset, int maxlen);
+
+        /**
+         * Copy the viewed message into an owning Grid.
+         */
+        inline void copyTo(Grid &msg) const;
+
+        /**
+         * Returns Grid::getHash()
+         */
+        inline static int64_t getHash();
+
+        /**
+         * Returns "Grid"
+         */
+        inline static const char* getTypeName();
+
+        // LCM support functions. Users should not call these
+        inline int _decodeNoHash(const void *buf, int offset, int maxlen);
+};
+
+int GridView::decode(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, thislen;
+
+    int64_t msg_hash;
+    thislen = __int64_t_decode_array(buf, offset + pos, maxlen - pos, &msg_hash, 1);
+    if (thislen < 0) return thislen; else pos += thislen;
+    if (msg_hash != getHash()) return -1;
+
+    thislen = this->_decodeNoHash(buf, offset + pos, maxlen - pos);
+    if (thislen < 0) return thislen; else pos += thislen;
+
+    return pos;
+}
+
+void GridView::copyTo(Grid &msg) const
+{
+    msg.fields_length = this->fields_length;
+    msg.data_length = this->data_length;
+    msg.timestamp = this->timestamp;
+    msg.frame_id.assign(this->frame_id.data(), this->frame_id.size());
+    msg.pose = this->pose;
+    msg.column_count = this->column_count;
+    msg.cell_size = this->cell_size;
+    msg.row_stride = this->row_stride;
+    msg.cell_stride = this->cell_stride;
+    msg.fields.resize(this->fields.size());
+    {
+        int a0 = 0;
+        for (dimos_lcm::view_array< foxglove_msgs::PackedElementFieldView >::iterator it = this->fields.begin();
+            it != this->fields.end(); ++it, a0++)
+            it->copyTo(msg.fields[a0]);
+    }
+    msg.data.assign(this->data.begin(), this->data.end());
+}
+
+int64_t GridView::getHash()
+{
+    return Grid::getHash();
+}
+
+const char* GridView::getTypeName()
+{
+    return "Grid";
+}
+
+int GridView::_decodeNoHash(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, tlen;
+
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &this->fields_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &this->data_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = this->timestamp._decodeNoHash(buf, offset + pos, maxlen - pos);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    int32_t __frame_id_len__;
+    tlen = __int32_t_decode_array(
+        buf, offset + pos, maxlen - pos, &__frame_id_len__, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+    if(__frame_id_len__ < 1 || __frame_id_len__ > maxlen - pos) return -1;
+    this->frame_id = std::string_view(
+        static_cast<const char*>(buf) + offset + pos, __frame_id_len__ - 1);
+    pos += __frame_id_len__;
+
+    tlen = this->pose._decodeNoHash(buf, offset + pos, maxlen - pos);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &this->column_count, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = this->cell_size._decodeNoHash(buf, offset + pos, maxlen - pos);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &this->row_stride, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &this->cell_stride, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = this->fields._decodeNoHash(buf, offset + pos, maxlen - pos, this->fields_length);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    if(this->data_length < 0 || this->data_length > maxlen - pos) return -1;
+    this->data = dimos_lcm::span< const uint8_t >(
+        static_cast<const uint8_t*>(buf) + offset + pos, this->data_length);
+    pos += this->data_length;
+
+    return pos;
+}
+
+}
+
+#endif
@@ -1,7 +1,7 @@
 /** THIS IS AN AUTOMATICALLY GENERATED FILE.  DO NOT MODIFY
  * BY HAND!!
  *
- * Generated by lcm-gen 1.5.2
+ * Generated by lcm-cpp (tools/cpp/gen)
  **/
 
 #ifndef __foxglove_msgs_KeyValuePair_hpp__
@@ -9,7 +9,11 @@
 
 #include <lcm/lcm_coretypes.h>
 
+#include <array>
 #include <string>
+#include "dimos_lcm/writer.hpp"
+#include "dimos_lcm/fingerprint.hpp"
+#include "dimos_lcm/reflection.hpp"
 
 namespace foxglove_msgs
 {
@@ -33,6 +37,15 @@ class KeyValuePair
          */
         inline int encode(void *buf, int offset, int maxlen) const;
 
+        /**
+         * Encode a message by appending it to @p buf, walking the message once
+         * instead of sizing it with getEncodedSize() first. @p buf grows
+         * geometrically; reuse it across calls to avoid reallocating.
+         *
+         * @return The number of bytes appended.
+         */
+        inline int encodeTo(std::vector<uint8_t> &buf) const;
+
         /**
          * Check how many bytes are required to encode this message.
          */
@@ -48,6 +61,28 @@ class KeyValuePair
          */
         inline int decode(const void *buf, int offset, int maxlen);
 
+        /**
+         * Field bits for decodeFields().
+         */
+        struct Fields
+        {
+            static constexpr uint64_t key = 1ULL << 0;
+            static constexpr uint64_t value = 1ULL << 1;
+            static constexpr uint64_t all = (1ULL << 2) - 1;
+        };
+
+        /**
+         * Decode only the fields selected by @p Mask, a bitwise or of Fields
+         * values. Strings, arrays and nested structs that are not selected are
+         * skipped over by their length prefixes without being allocated, and
+         * keep their previous value. Scalar fields are always decoded: they
+         * cost nothing to read and array lengths depend on them.
+         *
+         * @return The number of bytes decoded, or <0 if an error occured.
+         */
+        template <uint64_t Mask>
+        inline int decodeFields(const void *buf, int offset, int maxlen);
+
         /**
          * Retrieve the 64-bit fingerprint identifying the structure of the message.
          * Note that the fingerprint is the same for all instances of the same
@@ -56,18 +91,46 @@ class KeyValuePair
          */
         inline static int64_t getHash();
 
+        /**
+         * The fingerprint returned by getHash(), as a compile-time constant.
+         */
+        static constexpr int64_t kHash = static_cast<int64_t>(0x2eae802baa5ddbbdULL);
+
         /**
          * Returns "KeyValuePair"
          */
         inline static const char* getTypeName();
 
+        /**
+         * Name, LCM type and array dimensions of each field, in wire order.
+         * See dimos_lcm::for_each_field() for visiting the fields themselves.
+         */
+        static constexpr std::array<dimos_lcm::field_info, 2> kFields = {{
+            { "key", "string", true, 0, 0, NULL },
+            { "value", "string", true, 0, 0, NULL },
+        }};
+
         // LCM support functions. Users should not call these
         inline int _encodeNoHash(void *buf, int offset, int maxlen) const;
+        template <typename Writer>
+        inline void _writeNoHash(Writer &out) const;
         inline int _getEncodedSizeNoHash() const;
         inline int _decodeNoHash(const void *buf, int offset, int maxlen);
+        template <uint64_t Mask>
+        inline int _decodeFieldsNoHash(const void *buf, int offset, int maxlen);
+        template <typename Self, typename Visitor>
+        inline static void _forEachField(Self &self, Visitor &visitor);
+        inline static int _skipNoHash(const void *buf, int offset, int maxlen);
         inline static uint64_t _computeHash(const __lcm_hash_ptr *p);
 };
 
+static_assert(KeyValuePair::kHash == dimos_lcm::fingerprint(
+    dimos_lcm::signature_hash()
+        .member("key", "string", 0)
+        .member("value", "string", 0)
+        .value()),
+    "foxglove_msgs::KeyValuePair fingerprint does not match its definition");
+
 int KeyValuePair::encode(void *buf, int offset, int maxlen) const
 {
     int pos = 0, tlen;
@@ -82,6 +145,15 @@ int KeyValuePair::encode(void *buf, int offset, int maxlen) const
     return pos;
 }
 
+int KeyValuePair::encodeTo(std::vector<uint8_t> &buf) const
+{
+    dimos_lcm::vector_writer out(buf);
+    int64_t hash = getHash();
+    out.put(&hash, 1);
+    this->_writeNoHash(out);
+    return static_cast<int>(out.size());
+}
+
 int KeyValuePair::decode(const void *buf, int offset, int maxlen)
 {
     int pos = 0, thislen;
@@ -97,6 +169,22 @@ int KeyValuePair::decode(const void *buf, int offset, int maxlen)
     return pos;
 }
 
+template <uint64_t Mask>
+int KeyValuePair::decodeFields(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, thislen;
+
+    int64_t msg_hash;
+    thislen = __int64_t_decode_array(buf, offset + pos, maxlen - pos, &msg_hash, 1);
+    if (thislen < 0) return thislen; else pos += thislen;
+    if (msg_hash != getHash()) return -1;
+
+    thislen = this->_decodeFieldsNoHash<Mask>(buf, offset + pos, maxlen - pos);
+    if (thislen < 0) return thislen; else pos += thislen;
+
+    return pos;
+}
+
 int KeyValuePair::getEncodedSize() const
 {
     return 8 + _getEncodedSizeNoHash();
@@ -104,8 +192,7 @@ int KeyValuePair::getEncodedSize() const
 
 int64_t KeyValuePair::getHash()
 {
-    static int64_t hash = static_cast<int64_t>(_computeHash(NULL));
-    return hash;
+    return kHash;
 }
 
 const char* KeyValuePair::getTypeName()
@@ -130,6 +217,13 @@ int KeyValuePair::_encodeNoHash(void *buf, int offset, int maxlen) const
     return pos;
 }
 
+template <typename Writer>
+void KeyValuePair::_writeNoHash(Writer &out) const
+{
+    out.put(this->key);
+    out.put(this->value);
+}
+
 int KeyValuePair::_decodeNoHash(const void *buf, int offset, int maxlen)
 {
     int pos = 0, tlen;
@@ -138,7 +232,7 @@ int KeyValuePair::_decodeNoHash(const void *buf, int offset, int maxlen)
     tlen = __int32_t_decode_array(
         buf, offset + pos, maxlen - pos, &__key_len__, 1);
     if(tlen < 0) return tlen; else pos += tlen;
-    if(__key_len__ > maxlen - pos) return -1;
+    if(__key_len__ < 1 || __key_len__ > maxlen - pos) return -1;
     this->key.assign(
         static_cast<const char*>(buf) + offset + pos, __key_len__ - 1);
     pos += __key_len__;
@@ -147,7 +241,7 @@ int KeyValuePair::_decodeNoHash(const void *buf, int offset, int maxlen)
     tlen = __int32_t_decode_array(
         buf, offset + pos, maxlen - pos, &__value_len__, 1);
     if(tlen < 0) return tlen; else pos += tlen;
-    if(__value_len__ > maxlen - pos) return -1;
+    if(__value_len__ < 1 || __value_len__ > maxlen - pos) return -1;
     this->value.assign(
         static_cast<const char*>(buf) + offset + pos, __value_len__ - 1);
     pos += __value_len__;
@@ -155,6 +249,48 @@ int KeyValuePair::_decodeNoHash(const void *buf, int offset, int maxlen)
     return pos;
 }
 
+template <uint64_t Mask>
+int KeyValuePair::_decodeFieldsNoHash(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, tlen;
+
+    if ((Mask & Fields::key) != 0) {
+        int32_t __key_len__;
+        tlen = __int32_t_decode_array(
+            buf, offset + pos, maxlen - pos, &__key_len__, 1);
+        if(tlen < 0) return tlen; else pos += tlen;
+        if(__key_len__ < 1 || __key_len__ > maxlen - pos) return -1;
+        this->key.assign(
+            static_cast<const char*>(buf) + offset + pos, __key_len__ - 1);
+        pos += __key_len__;
+    } else {
+        int32_t __key_len__;
+        tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &__key_len__, 1);
+        if(tlen < 0) return tlen; else pos += tlen;
+        if(__key_len__ < 0 || __key_len__ > maxlen - pos) return -1;
+        pos += __key_len__;
+    }
+
+    if ((Mask & Fields::value) != 0) {
+        int32_t __value_len__;
+        tlen = __int32_t_decode_array(
+            buf, offset + pos, maxlen - pos, &__value_len__, 1);
+        if(tlen < 0) return tlen; else pos += tlen;
+        if(__value_len__ < 1 || __value_len__ > maxlen - pos) return -1;
+        this->value.assign(
+            static_cast<const char*>(buf) + offset + pos, __value_len__ - 1);
+        pos += __value_len__;
+    } else {
+        int32_t __value_len__;
+        tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &__value_len__, 1);
+        if(tlen < 0) return tlen; else pos += tlen;
+        if(__value_len__ < 0 || __value_len__ > maxlen - pos) return -1;
+        pos += __value_len__;
+    }
+
+    return pos;
+}
+
 int KeyValuePair::_getEncodedSizeNoHash() const
 {
     int enc_size = 0;
@@ -163,6 +299,30 @@ int KeyValuePair::_getEncodedSizeNoHash() const
     return enc_size;
 }
 
+int KeyValuePair::_skipNoHash(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, tlen;
+    int32_t __key_len__;
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &__key_len__, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+    if(__key_len__ < 0 || __key_len__ > maxlen - pos) return -1;
+    pos += __key_len__;
+    int32_t __value_len__;
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &__value_len__, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+    if(__value_len__ < 0 || __value_len__ > maxlen - pos) return -1;
+    pos += __value_len__;
+    if(pos > maxlen) return -1;
+    return pos;
+}
+
+template <typename Self, typename Visitor>
+void KeyValuePair::_forEachField(Self &self, Visitor &visitor)
+{
+    visitor(kFields[0], self.key);
+    visitor(kFields[1], self.value);
+}
+
 uint64_t KeyValuePair::_computeHash(const __lcm_hash_ptr *)
 {
     uint64_t hash = 0x97574015d52eeddeLL;
@@ -1,7 +1,7 @@
 /** THIS IS AN AUTOMATICALLY GENERATED FILE.  DO NOT MODIFY
  * BY HAND!!
  *
- * Generated by lcm-gen 1.5.2
+ * Generated by lcm-cpp (tools/cpp/gen)
  **/
 
 #ifndef __foxglove_msgs_LocationFix_hpp__
@@ -9,7 +9,12 @@
 
 #include <lcm/lcm_coretypes.h>
 
+#include <array>
 #include <string>
+#include "dimos_lcm/bulk_codec.hpp"
+#include "dimos_lcm/writer.hpp"
+#include "dimos_lcm/fingerprint.hpp"
+#include "dimos_lcm/reflection.hpp"
 #include "builtin_interfaces/Time.hpp"
 
 namespace foxglove_msgs
@@ -69,6 +74,15 @@ class LocationFix
          */
         inline int encode(void *buf, int offset, int maxlen) const;
 
+        /**
+         * Encode a message by appending it to @p buf, walking the message once
+         * instead of sizing it with getEncodedSize() first. @p buf grows
+         * geometrically; reuse it across calls to avoid reallocating.
+         *
+         * @return The number of bytes appended.
+         */
+        inline int encodeTo(std::vector<uint8_t> &buf) const;
+
         /**
          * Check how many bytes are required to encode this message.
          */
@@ -84,6 +98,33 @@ class LocationFix
          */
         inline int decode(const void *buf, int offset, int maxlen);
 
+        /**
+         * Field bits for decodeFields().
+         */
+        struct Fields
+        {
+            static constexpr uint64_t timestamp = 1ULL << 0;
+            static constexpr uint64_t frame_id = 1ULL << 1;
+            static constexpr uint64_t latitude = 1ULL << 2;
+            static constexpr uint64_t longitude = 1ULL << 3;
+            static constexpr uint64_t altitude = 1ULL << 4;
+            static constexpr uint64_t position_covariance = 1ULL << 5;
+            static constexpr uint64_t position_covariance_type = 1ULL << 6;
+            static constexpr uint64_t all = (1ULL << 7) - 1;
+        };
+
+        /**
+         * Decode only the fields selected by @p Mask, a bitwise or of Fields
+         * values. Strings, arrays and nested structs that are not selected are
+         * skipped over by their length prefixes without being allocated, and
+         * keep their previous value. Scalar fields are always decoded: they
+         * cost nothing to read and array lengths depend on them.
+         *
+         * @return The number of bytes decoded, or <0 if an error occured.
+         */
+        template <uint64_t Mask>
+        inline int decodeFields(const void *buf, int offset, int maxlen);
+
         /**
          * Retrieve the 64-bit fingerprint identifying the structure of the message.
          * Note that the fingerprint is the same for all instances of the same
@@ -92,18 +133,57 @@ class LocationFix
          */
         inline static int64_t getHash();
 
+        /**
+         * The fingerprint returned by getHash(), as a compile-time constant.
+         */
+        static constexpr int64_t kHash = static_cast<int64_t>(0x287fcdae2f0d1c34ULL);
+
         /**
          * Returns "LocationFix"
          */
         inline static const char* getTypeName();
 
+        /**
+         * Name, LCM type and array dimensions of each field, in wire order.
+         * See dimos_lcm::for_each_field() for visiting the fields themselves.
+         */
+        static constexpr std::array<dimos_lcm::field_info, 7> kFields = {{
+            { "timestamp", "builtin_interfaces.Time", false, 0, 0, NULL },
+            { "frame_id", "string", true, 0, 0, NULL },
+            { "latitude", "double", true, 0, 0, NULL },
+            { "longitude", "double", true, 0, 0, NULL },
+            { "altitude", "double", true, 0, 0, NULL },
+            { "position_covariance", "double", true, 1, 9, NULL },
+            { "position_covariance_type", "byte", true, 0, 0, NULL },
+        }};
+
         // LCM support functions. Users should not call these
         inline int _encodeNoHash(void *buf, int offset, int maxlen) const;
+        template <typename Writer>
+        inline void _writeNoHash(Writer &out) const;
         inline int _getEncodedSizeNoHash() const;
         inline int _decodeNoHash(const void *buf, int offset, int maxlen);
+        template <uint64_t Mask>
+        inline int _decodeFieldsNoHash(const void *buf, int offset, int maxlen);
+        template <typename Self, typename Visitor>
+        inline static void _forEachField(Self &self, Visitor &visitor);
+        inline static int _skipNoHash(const void *buf, int offset, int maxlen);
         inline static uint64_t _computeHash(const __lcm_hash_ptr *p);
 };
 
+static_assert(LocationFix::kHash == dimos_lcm::fingerprint(
+    dimos_lcm::signature_hash()
+        .member("timestamp", NULL, 0)
+        .member("frame_id", "string", 0)
+        .member("latitude", "double", 0)
+        .member("longitude", "double", 0)
+        .member("altitude", "double", 0)
+        .member("position_covariance", "double", 1).dim(false, "9")
+        .member("position_covariance_type", "byte", 0)
+        .value(),
+    builtin_interfaces::Time::kHash),
+    "foxglove_msgs::LocationFix fingerprint does not match its definition");
+
 int LocationFix::encode(void *buf, int offset, int maxlen) const
 {
     int pos = 0, tlen;
@@ -118,6 +198,15 @@ int LocationFix::encode(void *buf, int offset, int maxlen) const
     return pos;
 }
 
+int LocationFix::encodeTo(std::vector<uint8_t> &buf) const
+{
+    dimos_lcm::vector_writer out(buf);
+    int64_t hash = getHash();
+    out.put(&hash, 1);
+    this->_writeNoHash(out);
+    return static_cast<int>(out.size());
+}
+
 int LocationFix::decode(const void *buf, int offset, int maxlen)
 {
     int pos = 0, thislen;
@@ -133,6 +222,22 @@ int LocationFix::decode(const void *buf, int offset, int maxlen)
     return pos;
 }
 
+template <uint64_t Mask>
+int LocationFix::decodeFields(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, thislen;
+
+    int64_t msg_hash;
+    thislen = __int64_t_decode_array(buf, offset + pos, maxlen - pos, &msg_hash, 1);
+    if (thislen < 0) return thislen; else pos += thislen;
+    if (msg_hash != getHash()) return -1;
+
+    thislen = this->_decodeFieldsNoHash<Mask>(buf, offset + pos, maxlen - pos);
+    if (thislen < 0) return thislen; else pos += thislen;
+
+    return pos;
+}
+
 int LocationFix::getEncodedSize() const
 {
     return 8 + _getEncodedSizeNoHash();
@@ -140,8 +245,7 @@ int LocationFix::getEncodedSize() const
 
 int64_t LocationFix::getHash()
 {
-    static int64_t hash = static_cast<int64_t>(_computeHash(NULL));
-    return hash;
+    return kHash;
 }
 
 const char* LocationFix::getTypeName()
@@ -170,7 +274,7 @@ int LocationFix::_encodeNoHash(void *buf, int offset, int maxlen) const
     tlen = __double_encode_array(buf, offset + pos, maxlen - pos, &this->altitude, 1);
     if(tlen < 0) return tlen; else pos += tlen;
 
-    tlen = __double_encode_array(buf, offset + pos, maxlen - pos, &this->position_covariance[0], 9);
+    tlen = dimos_lcm::bulk_encode_array(buf, offset + pos, maxlen - pos, &this->position_covariance[0], 9);
     if(tlen < 0) return tlen; else pos += tlen;
 
     tlen = __byte_encode_array(buf, offset + pos, maxlen - pos, &this->position_covariance_type, 1);
@@ -179,6 +283,18 @@ int LocationFix::_encodeNoHash(void *buf, int offset, int maxlen) const
     return pos;
 }
 
+template <typename Writer>
+void LocationFix::_writeNoHash(Writer &out) const
+{
+    this->timestamp._writeNoHash(out);
+    out.put(this->frame_id);
+    out.put(&this->latitude, 1);
+    out.put(&this->longitude, 1);
+    out.put(&this->altitude, 1);
+    out.put(&this->position_covariance[0], 9);
+    out.put(&this->position_covariance_type, 1);
+}
+
 int LocationFix::_decodeNoHash(const void *buf, int offset, int maxlen)
 {
     int pos = 0, tlen;
@@ -190,7 +306,7 @@ int LocationFix::_decodeNoHash(const void *buf, int offset, int maxlen)
     tlen = __int32_t_decode_array(
         buf, offset + pos, maxlen - pos, &__frame_id_len__, 1);
     if(tlen < 0) return tlen; else pos += tlen;
-    if(__frame_id_len__ > maxlen - pos) return -1;
+    if(__frame_id_len__ < 1 || __frame_id_len__ > maxlen - pos) return -1;
     this->frame_id.assign(
         static_cast<const char*>(buf) + offset + pos, __frame_id_len__ - 1);
     pos += __frame_id_len__;
@@ -204,7 +320,7 @@ int LocationFix::_decodeNoHash(const void *buf, int offset, int maxlen)
     tlen = __double_decode_array(buf, offset + pos, maxlen - pos, &this->altitude, 1);
     if(tlen < 0) return tlen; else pos += tlen;
 
-    tlen = __double_decode_array(buf, offset + pos, maxlen - pos, &this->position_covariance[0], 9);
+    tlen = dimos_lcm::bulk_decode_array(buf, offset + pos, maxlen - pos, &this->position_covariance[0], 9);
     if(tlen < 0) return tlen; else pos += tlen;
 
     tlen = __byte_decode_array(buf, offset + pos, maxlen - pos, &this->position_covariance_type, 1);
@@ -213,6 +329,58 @@ int LocationFix::_decodeNoHash(const void *buf, int offset, int maxlen)
     return pos;
 }
 
+template <uint64_t Mask>
+int LocationFix::_decodeFieldsNoHash(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, tlen;
+
+    if ((Mask & Fields::timestamp) != 0) {
+        tlen = this->timestamp._decodeNoHash(buf, offset + pos, maxlen - pos);
+        if(tlen < 0) return tlen; else pos += tlen;
+    } else {
+        tlen = builtin_interfaces::Time::_skipNoHash(buf, offset + pos, maxlen - pos);
+        if(tlen < 0) return tlen; else pos += tlen;
+    }
+
+    if ((Mask & Fields::frame_id) != 0) {
+        int32_t __frame_id_len__;
+        tlen = __int32_t_decode_array(
+            buf, offset + pos, maxlen - pos, &__frame_id_len__, 1);
+        if(tlen < 0) return tlen; else pos += tlen;
+        if(__frame_id_len__ < 1 || __frame_id_len__ > maxlen - pos) return -1;
+        this->frame_id.assign(
+            static_cast<const char*>(buf) + offset + pos, __frame_id_len__ - 1);
+        pos += __frame_id_len__;
+    } else {
+        int32_t __frame_id_len__;
+        tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &__frame_id_len__, 1);
+        if(tlen < 0) return tlen; else pos += tlen;
+        if(__frame_id_len__ < 0 || __frame_id_len__ > maxlen - pos) return -1;
+        pos += __frame_id_len__;
+    }
+
+    tlen = __double_decode_array(buf, offset + pos, maxlen - pos, &this->latitude, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = __double_decode_array(buf, offset + pos, maxlen - pos, &this->longitude, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = __double_decode_array(buf, offset + pos, maxlen - pos, &this->altitude, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    if ((Mask & Fields::position_covariance) != 0) {
+        tlen = dimos_lcm::bulk_decode_array(buf, offset + pos, maxlen - pos, &this->position_covariance[0], 9);
+        if(tlen < 0) return tlen; else pos += tlen;
+    } else {
+        pos += 72;
+    }
+
+    tlen = __byte_decode_array(buf, offset + pos, maxlen - pos, &this->position_covariance_type, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    return pos;
+}
+
 int LocationFix::_getEncodedSizeNoHash() const
 {
     int enc_size = 0;
@@ -226,6 +394,37 @@ int LocationFix::_getEncodedSizeNoHash() const
     return enc_size;
 }
 
+int LocationFix::_skipNoHash(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, tlen;
+    tlen = builtin_interfaces::Time::_skipNoHash(buf, offset + pos, maxlen - pos);
+    if(tlen < 0) return tlen; else pos += tlen;
+    int32_t __frame_id_len__;
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &__frame_id_len__, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+    if(__frame_id_len__ < 0 || __frame_id_len__ > maxlen - pos) return -1;
+    pos += __frame_id_len__;
+    pos += 8;
+    pos += 8;
+    pos += 8;
+    pos += 72;
+    pos += 1;
+    if(pos > maxlen) return -1;
+    return pos;
+}
+
+template <typename Self, typename Visitor>
+void LocationFix::_forEachField(Self &self, Visitor &visitor)
+{
+    visitor(kFields[0], self.timestamp);
+    visitor(kFields[1], self.frame_id);
+    visitor(kFields[2], self.latitude);
+    visitor(kFields[3], self.longitude);
+    visitor(kFields[4], self.altitude);
+    visitor(kFields[5], self.position_covariance);
+    visitor(kFields[6], self.position_covariance_type);
+}
+
 uint64_t LocationFix::_computeHash(const __lcm_hash_ptr *p)
 {
     const __lcm_hash_ptr *fp;
@@ -0,0 +1,163 @@
+/** THIS IS AN AUTOMATICALLY GENERATED FILE.  DO NOT MODIFY
+ * BY HAND!!
+ *
+ * Generated by lcm-cpp (tools/cpp/gen)
+ **/
+
+#ifndef __foxglove_msgs_ModelPrimitiveView_hpp__
+#define __foxglove_msgs_ModelPrimitiveView_hpp__
+
+#include <lcm/lcm_coretypes.h>
+
+#include <string_view>
+#include "dimos_lcm/view.hpp"
+#include "foxglove_msgs/ModelPrimitive.hpp"
+
+namespace foxglove_msgs
+{
+
+/**
+ * Zero-copy read-only view of an encoded foxglove_msgs.ModelPrimitive.
+ *
+ * Strings and variable-length arrays point into the buffer given to decode(),
+ * which must outlive the view. Decoding validates the whole message once and
+ * never allocates.
+ */
+class ModelPrimitiveView
+{
+    public:
+        int32_t    data_length;
+
+        geometry_msgs::Pose pose;
+
+        geometry_msgs::Vector3 scale;
+
+        foxglove_msgs::Color color;
+
+        int8_t     override_color;
+
+        std::string_view url;
+
+        std::string_view media_type;
+
+        /**
+         * LCM Type: byte[data_length]
+         */
+        dimos_lcm::span< const uint8_t > data;
+
+    public:
+        /**
+         * Decode a view over a message in binary form.
+         *
+         * @param buf The buffer containing the encoded message. It must outlive
+         *  this view.
+         * @param offset The byte offset into @p buf where the encoded message starts.
+         * @param maxlen The maximum number of bytes to read while decoding.
+         * @return The number of bytes decoded, or <0 if an error occured.
+         */
+        inline int decode(const void *buf, int offset, int maxlen);
+
+        /**
+         * Copy the viewed message into an owning ModelPrimitive.
+         */
+        inline void copyTo(ModelPrimitive &msg) const;
+
+        /**
+         * Returns ModelPrimitive::getHash()
+         */
+        inline static int64_t getHash();
+
+        /**
+         * Returns "ModelPrimitive"
+         */
+        inline static const char* getTypeName();
+
+        // LCM support functions. Users should not call these
+        inline int _decodeNoHash(const void *buf, int offset, int maxlen);
+};
+
+int ModelPrimitiveView::decode(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, thislen;
+
+    int64_t msg_hash;
+    thislen = __int64_t_decode_array(buf, offset + pos, maxlen - pos, &msg_hash, 1);
+    if (thislen < 0) return thislen; else pos += thislen;
+    if (msg_hash != getHash()) return -1;
+
+    thislen = this->_decodeNoHash(buf, offset + pos, maxlen - pos);
+    if (thislen < 0) return thislen; else pos += thislen;
+
+    return pos;
+}
+
+void ModelPrimitiveView::copyTo(ModelPrimitive &msg) const
+{
+    msg.data_length = this->data_length;
+    msg.pose = this->pose;
+    msg.scale = this->scale;
+    msg.color = this->color;
+    msg.override_color = this->override_color;
+    msg.url.assign(this->url.data(), this->url.size());
+    msg.media_type.assign(this->media_type.data(), this->media_type.size());
+    msg.data.assign(this->data.begin(), this->data.end());
+}
+
+int64_t ModelPrimitiveView::getHash()
+{
+    return ModelPrimitive::getHash();
+}
+
+const char* ModelPrimitiveView::getTypeName()
+{
+    return "ModelPrimitive";
+}
+
+int ModelPrimitiveView::_decodeNoHash(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, tlen;
+
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &this->data_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = this->pose._decodeNoHash(buf, offset + pos, maxlen - pos);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = this->scale._decodeNoHash(buf, offset + pos, maxlen - pos);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = this->color._decodeNoHash(buf, offset + pos, maxlen - pos);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = __boolean_decode_array(buf, offset + pos, maxlen - pos, &this->override_color, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    int32_t __url_len__;
+    tlen = __int32_t_decode_array(
+        buf, offset + pos, maxlen - pos, &__url_len__, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+    if(__url_len__ < 1 || __url_len__ > maxlen - pos) return -1;
+    this->url = std::string_view(
+        static_cast<const char*>(buf) + offset + pos, __url_len__ - 1);
+    pos += __url_len__;
+
+    int32_t __media_type_len__;
+    tlen = __int32_t_decode_array(
+        buf, offset + pos, maxlen - pos, &__media_type_len__, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+    if(__media_type_len__ < 1 || __media_type_len__ > maxlen - pos) return -1;
+    this->media_type = std::string_view(
+        static_cast<const char*>(buf) + offset + pos, __media_type_len__ - 1);
+    pos += __media_type_len__;
+
+    if(this->data_length < 0 || this->data_length > maxlen - pos) return -1;
+    this->data = dimos_lcm::span< const uint8_t >(
+        static_cast<const uint8_t*>(buf) + offset + pos, this->data_length);
+    pos += this->data_length;
+
+    return pos;
+}
+
+}
+
+#endif
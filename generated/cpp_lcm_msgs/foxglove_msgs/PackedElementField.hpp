@@ -1,7 +1,7 @@
 /** THIS IS AN AUTOMATICALLY GENERATED FILE.  DO NOT MODIFY
  * BY HAND!!
  *
- * Generated by lcm-gen 1.5.2
+ * Generated by lcm-cpp (tools/cpp/gen)
  **/
 
 #ifndef __foxglove_msgs_PackedElementField_hpp__
@@ -9,7 +9,11 @@
 
 #include <lcm/lcm_coretypes.h>
 
+#include <array>
 #include <string>
+#include "dimos_lcm/writer.hpp"
+#include "dimos_lcm/fingerprint.hpp"
+#include "dimos_lcm/reflection.hpp"
 
 namespace foxglove_msgs
 {
@@ -82,6 +86,15 @@ class PackedElementField
          */
         inline int encode(void *buf, int offset, int maxlen) const;
 
+        /**
+         * Encode a message by appending it to @p buf, walking the message once
+         * instead of sizing it with getEncodedSize() first. @p buf grows
+         * geometrically; reuse it across calls to avoid reallocating.
+         *
+         * @return The number of bytes appended.
+         */
+        inline int encodeTo(std::vector<uint8_t> &buf) const;
+
         /**
          * Check how many bytes are required to encode this message.
          */
@@ -97,6 +110,29 @@ class PackedElementField
          */
         inline int decode(const void *buf, int offset, int maxlen);
 
+        /**
+         * Field bits for decodeFields().
+         */
+        struct Fields
+        {
+            static constexpr uint64_t name = 1ULL << 0;
+            static constexpr uint64_t offset = 1ULL << 1;
+            static constexpr uint64_t type = 1ULL << 2;
+            static constexpr uint64_t all = (1ULL << 3) - 1;
+        };
+
+        /**
+         * Decode only the fields selected by @p Mask, a bitwise or of Fields
+         * values. Strings, arrays and nested structs that are not selected are
+         * skipped over by their length prefixes without being allocated, and
+         * keep their previous value. Scalar fields are always decoded: they
+         * cost nothing to read and array lengths depend on them.
+         *
+         * @return The number of bytes decoded, or <0 if an error occured.
+         */
+        template <uint64_t Mask>
+        inline int decodeFields(const void *buf, int offset, int maxlen);
+
         /**
          * Retrieve the 64-bit fingerprint identifying the structure of the message.
          * Note that the fingerprint is the same for all instances of the same
@@ -105,18 +141,48 @@ class PackedElementField
          */
         inline static int64_t getHash();
 
+        /**
+         * The fingerprint returned by getHash(), as a compile-time constant.
+         */
+        static constexpr int64_t kHash = static_cast<int64_t>(0x8f90b741f5f42d70ULL);
+
         /**
          * Returns "PackedElementField"
          */
         inline static const char* getTypeName();
 
+        /**
+         * Name, LCM type and array dimensions of each field, in wire order.
+         * See dimos_lcm::for_each_field() for visiting the fields themselves.
+         */
+        static constexpr std::array<dimos_lcm::field_info, 3> kFields = {{
+            { "name", "string", true, 0, 0, NULL },
+            { "offset", "int32_t", true, 0, 0, NULL },
+            { "type", "byte", true, 0, 0, NULL },
+        }};
+
         // LCM support functions. Users should not call these
         inline int _encodeNoHash(void *buf, int offset, int maxlen) const;
+        template <typename Writer>
+        inline void _writeNoHash(Writer &out) const;
         inline int _getEncodedSizeNoHash() const;
         inline int _decodeNoHash(const void *buf, int offset, int maxlen);
+        template <uint64_t Mask>
+        inline int _decodeFieldsNoHash(const void *buf, int offset, int maxlen);
+        template <typename Self, typename Visitor>
+        inline static void _forEachField(Self &self, Visitor &visitor);
+        inline static int _skipNoHash(const void *buf, int offset, int maxlen);
         inline static uint64_t _computeHash(const __lcm_hash_ptr *p);
 };
 
+static_assert(PackedElementField::kHash == dimos_lcm::fingerprint(
+    dimos_lcm::signature_hash()
+        .member("name", "string", 0)
+        .member("offset", "int32_t", 0)
+        .member("type", "byte", 0)
+        .value()),
+    "foxglove_msgs::PackedElementField fingerprint does not match its definition");
+
 int PackedElementField::encode(void *buf, int offset, int maxlen) const
 {
     int pos = 0, tlen;
@@ -131,6 +197,15 @@ int PackedElementField::encode(void *buf, int offset, int maxlen) const
     return pos;
 }
 
+int PackedElementField::encodeTo(std::vector<uint8_t> &buf) const
+{
+    dimos_lcm::vector_writer out(buf);
+    int64_t hash = getHash();
+    out.put(&hash, 1);
+    this->_writeNoHash(out);
+    return static_cast<int>(out.size());
+}
+
 int PackedElementField::decode(const void *buf, int offset, int maxlen)
 {
     int pos = 0, thislen;
@@ -146,6 +221,22 @@ int PackedElementField::decode(const void *buf, int offset, int maxlen)
     return pos;
 }
 
+template <uint64_t Mask>
+int PackedElementField::decodeFields(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, thislen;
+
+    int64_t msg_hash;
+    thislen = __int64_t_decode_array(buf, offset + pos, maxlen - pos, &msg_hash, 1);
+    if (thislen < 0) return thislen; else pos += thislen;
+    if (msg_hash != getHash()) return -1;
+
+    thislen = this->_decodeFieldsNoHash<Mask>(buf, offset + pos, maxlen - pos);
+    if (thislen < 0) return thislen; else pos += thislen;
+
+    return pos;
+}
+
 int PackedElementField::getEncodedSize() const
 {
     return 8 + _getEncodedSizeNoHash();
@@ -153,8 +244,7 @@ int PackedElementField::getEncodedSize() const
 
 int64_t PackedElementField::getHash()
 {
-    static int64_t hash = static_cast<int64_t>(_computeHash(NULL));
-    return hash;
+    return kHash;
 }
 
 const char* PackedElementField::getTypeName()
@@ -180,6 +270,14 @@ int PackedElementField::_encodeNoHash(void *buf, int offset, int maxlen) const
     return pos;
 }
 
+template <typename Writer>
+void PackedElementField::_writeNoHash(Writer &out) const
+{
+    out.put(this->name);
+    out.put(&this->offset, 1);
+    out.put(&this->type, 1);
+}
+
 int PackedElementField::_decodeNoHash(const void *buf, int offset, int maxlen)
 {
     int pos = 0, tlen;
@@ -188,7 +286,7 @@ int PackedElementField::_decodeNoHash(const void *buf, int offset, int maxlen)
     tlen = __int32_t_decode_array(
         buf, offset + pos, maxlen - pos, &__name_len__, 1);
     if(tlen < 0) return tlen; else pos += tlen;
-    if(__name_len__ > maxlen - pos) return -1;
+    if(__name_len__ < 1 || __name_len__ > maxlen - pos) return -1;
     this->name.assign(
         static_cast<const char*>(buf) + offset + pos, __name_len__ - 1);
     pos += __name_len__;
@@ -202,6 +300,37 @@ int PackedElementField::_decodeNoHash(const void *buf, int offset, int maxlen)
     return pos;
 }
 
+template <uint64_t Mask>
+int PackedElementField::_decodeFieldsNoHash(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, tlen;
+
+    if ((Mask & Fields::name) != 0) {
+        int32_t __name_len__;
+        tlen = __int32_t_decode_array(
+            buf, offset + pos, maxlen - pos, &__name_len__, 1);
+        if(tlen < 0) return tlen; else pos += tlen;
+        if(__name_len__ < 1 || __name_len__ > maxlen - pos) return -1;
+        this->name.assign(
+            static_cast<const char*>(buf) + offset + pos, __name_len__ - 1);
+        pos += __name_len__;
+    } else {
+        int32_t __name_len__;
+        tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &__name_len__, 1);
+        if(tlen < 0) return tlen; else pos += tlen;
+        if(__name_len__ < 0 || __name_len__ > maxlen - pos) return -1;
+        pos += __name_len__;
+    }
+
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &this->offset, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = __byte_decode_array(buf, offset + pos, maxlen - pos, &this->type, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    return pos;
+}
+
 int PackedElementField::_getEncodedSizeNoHash() const
 {
     int enc_size = 0;
@@ -211,6 +340,28 @@ int PackedElementField::_getEncodedSizeNoHash() const
     return enc_size;
 }
 
+int PackedElementField::_skipNoHash(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, tlen;
+    int32_t __name_len__;
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &__name_len__, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+    if(__name_len__ < 0 || __name_len__ > maxlen - pos) return -1;
+    pos += __name_len__;
+    pos += 4;
+    pos += 1;
+    if(pos > maxlen) return -1;
+    return pos;
+}
+
+template <typename Self, typename Visitor>
+void PackedElementField::_forEachField(Self &self, Visitor &visitor)
+{
+    visitor(kFields[0], self.name);
+    visitor(kFields[1], self.offset);
+    visitor(kFields[2], self.type);
+}
+
 uint64_t PackedElementField::_computeHash(const __lcm_hash_ptr *)
 {
     uint64_t hash = 0x47c85ba0fafa16b8LL;
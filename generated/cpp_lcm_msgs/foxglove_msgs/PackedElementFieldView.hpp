@@ -0,0 +1,122 @@
+/** THIS IS AN AUTOMATICALLY GENERATED FILE.  DO NOT MODIFY
+ * BY HAND!!
+ *
+ * Generated by lcm-cpp (tools/cpp/gen)
+ **/
+
+#ifndef __foxglove_msgs_PackedElementFieldView_hpp__
+#define __foxglove_msgs_PackedElementFieldView_hpp__
+
+#include <lcm/lcm_coretypes.h>
+
+#include <string_view>
+#include "dimos_lcm/view.hpp"
+#include "foxglove_msgs/PackedElementField.hpp"
+
+namespace foxglove_msgs
+{
+
+/**
+ * Zero-copy read-only view of an encoded foxglove_msgs.PackedElementField.
+ *
+ * Strings and variable-length arrays point into the buffer given to decode(),
+ * which must outlive the view. Decoding validates the whole message once and
+ * never allocates.
+ */
+class PackedElementFieldView
+{
+    public:
+        std::string_view name;
+
+        int32_t    offset;
+
+        uint8_t    type;
+
+    public:
+        /**
+         * Decode a view over a message in binary form.
+         *
+         * @param buf The buffer containing the encoded message. It must outlive
+         *  this view.
+         * @param offset The byte offset into @p buf where the encoded message starts.
+         * @param maxlen The maximum number of bytes to read while decoding.
+         * @return The number of bytes decoded, or <0 if an error occured.
+         */
+        inline int decode(const void *buf, int offset, int maxlen);
+
+        /**
+         * Copy the viewed message into an owning PackedElementField.
+         */
+        inline void copyTo(PackedElementField &msg) const;
+
+        /**
+         * Returns PackedElementField::getHash()
+         */
+        inline static int64_t getHash();
+
+        /**
+         * Returns "PackedElementField"
+         */
+        inline static const char* getTypeName();
+
+        // LCM support functions. Users should not call these
+        inline int _decodeNoHash(const void *buf, int offset, int maxlen);
+};
+
+int PackedElementFieldView::decode(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, thislen;
+
+    int64_t msg_hash;
+    thislen = __int64_t_decode_array(buf, offset + pos, maxlen - pos, &msg_hash, 1);
+    if (thislen < 0) return thislen; else pos += thislen;
+    if (msg_hash != getHash()) return -1;
+
+    thislen = this->_decodeNoHash(buf, offset + pos, maxlen - pos);
+    if (thislen < 0) return thislen; else pos += thislen;
+
+    return pos;
+}
+
+void PackedElementFieldView::copyTo(PackedElementField &msg) const
+{
+    msg.name.assign(this->name.data(), this->name.size());
+    msg.offset = this->offset;
+    msg.type = this->type;
+}
+
+int64_t PackedElementFieldView::getHash()
+{
+    return PackedElementField::getHash();
+}
+
+const char* PackedElementFieldView::getTypeName()
+{
+    return "PackedElementField";
+}
+
+int PackedElementFieldView::_decodeNoHash(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, tlen;
+
+    int32_t __name_len__;
+    tlen = __int32_t_decode_array(
+        buf, offset + pos, maxlen - pos, &__name_len__, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+    if(__name_len__ < 1 || __name_len__ > maxlen - pos) return -1;
+    this->name = std::string_view(
+        static_cast<const char*>(buf) + offset + pos, __name_len__ - 1);
+    pos += __name_len__;
+
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &this->offset, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = __byte_decode_array(buf, offset + pos, maxlen - pos, &this->type, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    return pos;
+}
+
+}
+
+#endif
@@ -1,7 +1,7 @@
 /** THIS IS AN AUTOMATICALLY GENERATED FILE.  DO NOT MODIFY
  * BY HAND!!
  *
- * Generated by lcm-gen 1.5.2
+ * Generated by lcm-cpp (tools/cpp/gen)
  **/
 
 #ifndef __foxglove_msgs_Point2_hpp__
@@ -9,6 +9,11 @@
 
 #include <lcm/lcm_coretypes.h>
 
+#include <array>
+#include "dimos_lcm/fixed_codec.hpp"
+#include "dimos_lcm/writer.hpp"
+#include "dimos_lcm/fingerprint.hpp"
+#include "dimos_lcm/reflection.hpp"
 
 namespace foxglove_msgs
 {
@@ -32,11 +37,26 @@ class Point2
          */
         inline int encode(void *buf, int offset, int maxlen) const;
 
+        /**
+         * Encode a message by appending it to @p buf, walking the message once
+         * instead of sizing it with getEncodedSize() first. @p buf grows
+         * geometrically; reuse it across calls to avoid reallocating.
+         *
+         * @return The number of bytes appended.
+         */
+        inline int encodeTo(std::vector<uint8_t> &buf) const;
+
         /**
          * Check how many bytes are required to encode this message.
          */
         inline int getEncodedSize() const;
 
+        /**
+         * getEncodedSize() of every instance: the type has no strings or
+         * variable-length arrays.
+         */
+        static constexpr int kEncodedSize = 24;
+
         /**
          * Decode a message from binary form into this instance.
          *
@@ -55,18 +75,44 @@ class Point2
          */
         inline static int64_t getHash();
 
+        /**
+         * The fingerprint returned by getHash(), as a compile-time constant.
+         */
+        static constexpr int64_t kHash = static_cast<int64_t>(0xa4b2a25c6168910bULL);
+
         /**
          * Returns "Point2"
          */
         inline static const char* getTypeName();
 
+        /**
+         * Name, LCM type and array dimensions of each field, in wire order.
+         * See dimos_lcm::for_each_field() for visiting the fields themselves.
+         */
+        static constexpr std::array<dimos_lcm::field_info, 2> kFields = {{
+            { "x", "double", true, 0, 0, NULL },
+            { "y", "double", true, 0, 0, NULL },
+        }};
+
         // LCM support functions. Users should not call these
         inline int _encodeNoHash(void *buf, int offset, int maxlen) const;
+        template <typename Writer>
+        inline void _writeNoHash(Writer &out) const;
         inline int _getEncodedSizeNoHash() const;
         inline int _decodeNoHash(const void *buf, int offset, int maxlen);
+        template <typename Self, typename Visitor>
+        inline static void _forEachField(Self &self, Visitor &visitor);
+        inline static int _skipNoHash(const void *buf, int offset, int maxlen);
         inline static uint64_t _computeHash(const __lcm_hash_ptr *p);
 };
 
+static_assert(Point2::kHash == dimos_lcm::fingerprint(
+    dimos_lcm::signature_hash()
+        .member("x", "double", 0)
+        .member("y", "double", 0)
+        .value()),
+    "foxglove_msgs::Point2 fingerprint does not match its definition");
+
 int Point2::encode(void *buf, int offset, int maxlen) const
 {
     int pos = 0, tlen;
@@ -81,6 +127,15 @@ int Point2::encode(void *buf, int offset, int maxlen) const
     return pos;
 }
 
+int Point2::encodeTo(std::vector<uint8_t> &buf) const
+{
+    dimos_lcm::vector_writer out(buf);
+    int64_t hash = getHash();
+    out.put(&hash, 1);
+    this->_writeNoHash(out);
+    return static_cast<int>(out.size());
+}
+
 int Point2::decode(const void *buf, int offset, int maxlen)
 {
     int pos = 0, thislen;
@@ -103,8 +158,7 @@ int Point2::getEncodedSize() const
 
 int64_t Point2::getHash()
 {
-    static int64_t hash = static_cast<int64_t>(_computeHash(NULL));
-    return hash;
+    return kHash;
 }
 
 const char* Point2::getTypeName()
@@ -114,36 +168,43 @@ const char* Point2::getTypeName()
 
 int Point2::_encodeNoHash(void *buf, int offset, int maxlen) const
 {
-    int pos = 0, tlen;
-
-    tlen = __double_encode_array(buf, offset + pos, maxlen - pos, &this->x, 1);
-    if(tlen < 0) return tlen; else pos += tlen;
-
-    tlen = __double_encode_array(buf, offset + pos, maxlen - pos, &this->y, 1);
-    if(tlen < 0) return tlen; else pos += tlen;
+    if(maxlen < kEncodedSize - 8) return -1;
+    uint8_t *p = static_cast<uint8_t*>(buf) + offset;
+    dimos_lcm::store_be(p + 0, this->x);
+    dimos_lcm::store_be(p + 8, this->y);
+    return kEncodedSize - 8;
+}
 
-    return pos;
+template <typename Writer>
+void Point2::_writeNoHash(Writer &out) const
+{
+    out.putStruct(*this);
 }
 
 int Point2::_decodeNoHash(const void *buf, int offset, int maxlen)
 {
-    int pos = 0, tlen;
-
-    tlen = __double_decode_array(buf, offset + pos, maxlen - pos, &this->x, 1);
-    if(tlen < 0) return tlen; else pos += tlen;
+    if(maxlen < kEncodedSize - 8) return -1;
+    const uint8_t *p = static_cast<const uint8_t*>(buf) + offset;
+    dimos_lcm::load_be(p + 0, this->x);
+    dimos_lcm::load_be(p + 8, this->y);
+    return kEncodedSize - 8;
+}
 
-    tlen = __double_decode_array(buf, offset + pos, maxlen - pos, &this->y, 1);
-    if(tlen < 0) return tlen; else pos += tlen;
+int Point2::_getEncodedSizeNoHash() const
+{
+    return kEncodedSize - 8;
+}
 
-    return pos;
+int Point2::_skipNoHash(const void *, int, int maxlen)
+{
+    return maxlen < kEncodedSize - 8 ? -1 : kEncodedSize - 8;
 }
 
-int Point2::_getEncodedSizeNoHash() const
+template <typename Self, typename Visitor>
+void Point2::_forEachField(Self &self, Visitor &visitor)
 {
-    int enc_size = 0;
-    enc_size += __double_encoded_array_size(NULL, 1);
-    enc_size += __double_encoded_array_size(NULL, 1);
-    return enc_size;
+    visitor(kFields[0], self.x);
+    visitor(kFields[1], self.y);
 }
 
 uint64_t Point2::_computeHash(const __lcm_hash_ptr *)
@@ -0,0 +1,131 @@
+/** THIS IS AN AUTOMATICALLY GENERATED FILE.  DO NOT MODIFY
+ * BY HAND!!
+ *
+ * Generated by lcm-cpp (tools/cpp/gen)
+ **/
+
+#ifndef __foxglove_msgs_Point2Columns_hpp__
+#define __foxglove_msgs_Point2Columns_hpp__
+
+#include <lcm/lcm_coretypes.h>
+
+#include <vector>
+#include "dimos_lcm/fixed_codec.hpp"
+#include "foxglove_msgs/Point2.hpp"
+
+namespace foxglove_msgs
+{
+
+/**
+ * Structure-of-arrays storage for a sequence of foxglove_msgs.Point2: one
+ * contiguous array per field, with nested fields flattened and named by their
+ * path (x, y, ...). The soa:: message classes hold their
+ * Point2 arrays this way and decode them straight into the columns.
+ */
+class Point2Columns
+{
+    public:
+        std::vector< double > x;
+
+        std::vector< double > y;
+
+    public:
+        /**
+         * Number of elements.
+         */
+        inline int size() const;
+
+        /**
+         * Resize every column to @p n elements.
+         */
+        inline void resize(int n);
+
+        /**
+         * Gather element @p i into a Point2.
+         */
+        inline foxglove_msgs::Point2 get(int i) const;
+
+        /**
+         * Scatter @p msg into element @p i.
+         */
+        inline void set(int i, const foxglove_msgs::Point2 &msg);
+
+        // LCM support functions. Users should not call these
+        inline int _encodeNoHash(void *buf, int offset, int maxlen, int n) const;
+        template <typename Writer>
+        inline void _writeNoHash(Writer &out, int n) const;
+        inline int _getEncodedSizeNoHash(int n) const;
+        inline int _decodeNoHash(const void *buf, int offset, int maxlen, int n);
+};
+
+int Point2Columns::size() const
+{
+    return static_cast<int>(this->x.size());
+}
+
+void Point2Columns::resize(int n)
+{
+    this->x.resize(n);
+    this->y.resize(n);
+}
+
+foxglove_msgs::Point2 Point2Columns::get(int i) const
+{
+    foxglove_msgs::Point2 msg;
+    msg.x = this->x[i];
+    msg.y = this->y[i];
+    return msg;
+}
+
+void Point2Columns::set(int i, const foxglove_msgs::Point2 &msg)
+{
+    this->x[i] = msg.x;
+    this->y[i] = msg.y;
+}
+
+int Point2Columns::_encodeNoHash(void *buf, int offset, int maxlen, int n) const
+{
+    uint8_t *p = static_cast<uint8_t*>(buf) + offset;
+    int pos = 0;
+    for (int i = 0; i < n; i++) {
+        if(maxlen - pos < 16) return -1;
+        dimos_lcm::store_be(p + pos + 0, this->x[i]);
+        dimos_lcm::store_be(p + pos + 8, this->y[i]);
+        pos += 16;
+    }
+    return pos;
+}
+
+template <typename Writer>
+void Point2Columns::_writeNoHash(Writer &out, int n) const
+{
+    if(n <= 0) return;
+    uint8_t *p = out.extend(static_cast<size_t>(n) * 16);
+    for (int i = 0; i < n; i++, p += 16) {
+        dimos_lcm::store_be(p + 0, this->x[i]);
+        dimos_lcm::store_be(p + 8, this->y[i]);
+    }
+}
+
+int Point2Columns::_getEncodedSizeNoHash(int n) const
+{
+    return n * 16;
+}
+
+int Point2Columns::_decodeNoHash(const void *buf, int offset, int maxlen, int n)
+{
+    if(n < 0 || n > maxlen / 16) return -1;
+    this->resize(n);
+    const uint8_t *p = static_cast<const uint8_t*>(buf) + offset;
+    double *x = this->x.data();
+    double *y = this->y.data();
+    for (int i = 0; i < n; i++, p += 16) {
+        dimos_lcm::load_be(p + 0, x[i]);
+        dimos_lcm::load_be(p + 8, y[i]);
+    }
+    return n * 16;
+}
+
+}
+
+#endif
@@ -1,7 +1,7 @@
 /** THIS IS AN AUTOMATICALLY GENERATED FILE.  DO NOT MODIFY
  * BY HAND!!
  *
- * Generated by lcm-gen 1.5.2
+ * Generated by lcm-cpp (tools/cpp/gen)
  **/
 
 #ifndef __foxglove_msgs_PointsAnnotation_hpp__
@@ -9,12 +9,14 @@
 
 #include <lcm/lcm_coretypes.h>
 
+#include <array>
 #include <vector>
+#include "dimos_lcm/writer.hpp"
+#include "dimos_lcm/fingerprint.hpp"
+#include "dimos_lcm/reflection.hpp"
 #include "builtin_interfaces/Time.hpp"
 #include "foxglove_msgs/Point2.hpp"
 #include "foxglove_msgs/Color.hpp"
-#include "foxglove_msgs/Color.hpp"
-#include "foxglove_msgs/Color.hpp"
 
 namespace foxglove_msgs
 {
@@ -85,6 +87,15 @@ class PointsAnnotation
          */
         inline int encode(void *buf, int offset, int maxlen) const;
 
+        /**
+         * Encode a message by appending it to @p buf, walking the message once
+         * instead of sizing it with getEncodedSize() first. @p buf grows
+         * geometrically; reuse it across calls to avoid reallocating.
+         *
+         * @return The number of bytes appended.
+         */
+        inline int encodeTo(std::vector<uint8_t> &buf) const;
+
         /**
          * Check how many bytes are required to encode this message.
          */
@@ -100,6 +111,48 @@ class PointsAnnotation
          */
         inline int decode(const void *buf, int offset, int maxlen);
 
+        /**
+         * Field bits for decodeFields().
+         */
+        struct Fields
+        {
+            static constexpr uint64_t points_length = 1ULL << 0;
+            static constexpr uint64_t outline_colors_length = 1ULL << 1;
+            static constexpr uint64_t timestamp = 1ULL << 2;
+            static constexpr uint64_t type = 1ULL << 3;
+            static constexpr uint64_t points = 1ULL << 4;
+            static constexpr uint64_t outline_color = 1ULL << 5;
+            static constexpr uint64_t outline_colors = 1ULL << 6;
+            static constexpr uint64_t fill_color = 1ULL << 7;
+            static constexpr uint64_t thickness = 1ULL << 8;
+            static constexpr uint64_t all = (1ULL << 9) - 1;
+        };
+
+        /**
+         * Decode only the fields selected by @p Mask, a bitwise or of Fields
+         * values. Strings, arrays and nested structs that are not selected are
+         * skipped over by their length prefixes without being allocated, and
+         * keep their previous value. Scalar fields are always decoded: they
+         * cost nothing to read and array lengths depend on them.
+         *
+         * @return The number of bytes decoded, or <0 if an error occured.
+         */
+        template <uint64_t Mask>
+        inline int decodeFields(const void *buf, int offset, int maxlen);
+
+        /**
+         * Upper bound on the length of every variable-length array of this
+         * type, checked by decode() before anything is allocated; messages
+         * exceeding it fail to decode. It does not apply to nested types,
+         * which have their own. Set it once at startup, before decoding.
+         * Before C++17 it is a constant with no limit.
+         */
+#if __cplusplus >= 201703L
+        static inline int32_t maxArrayLength = INT32_MAX;
+#else
+        static constexpr int32_t maxArrayLength = INT32_MAX;
+#endif
+
         /**
          * Retrieve the 64-bit fingerprint identifying the structure of the message.
          * Note that the fingerprint is the same for all instances of the same
@@ -108,18 +161,65 @@ class PointsAnnotation
          */
         inline static int64_t getHash();
 
+        /**
+         * The fingerprint returned by getHash(), as a compile-time constant.
+         */
+        static constexpr int64_t kHash = static_cast<int64_t>(0x42fd5c4dfe5d66e4ULL);
+
         /**
          * Returns "PointsAnnotation"
          */
         inline static const char* getTypeName();
 
+        /**
+         * Name, LCM type and array dimensions of each field, in wire order.
+         * See dimos_lcm::for_each_field() for visiting the fields themselves.
+         */
+        static constexpr std::array<dimos_lcm::field_info, 9> kFields = {{
+            { "points_length", "int32_t", true, 0, 0, NULL },
+            { "outline_colors_length", "int32_t", true, 0, 0, NULL },
+            { "timestamp", "builtin_interfaces.Time", false, 0, 0, NULL },
+            { "type", "byte", true, 0, 0, NULL },
+            { "points", "foxglove_msgs.Point2", false, 1, -1, "points_length" },
+            { "outline_color", "foxglove_msgs.Color", false, 0, 0, NULL },
+            { "outline_colors", "foxglove_msgs.Color", false, 1, -1, "outline_colors_length" },
+            { "fill_color", "foxglove_msgs.Color", false, 0, 0, NULL },
+            { "thickness", "double", true, 0, 0, NULL },
+        }};
+
         // LCM support functions. Users should not call these
         inline int _encodeNoHash(void *buf, int offset, int maxlen) const;
+        template <typename Writer>
+        inline void _writeNoHash(Writer &out) const;
         inline int _getEncodedSizeNoHash() const;
         inline int _decodeNoHash(const void *buf, int offset, int maxlen);
+        template <uint64_t Mask>
+        inline int _decodeFieldsNoHash(const void *buf, int offset, int maxlen);
+        template <typename Self, typename Visitor>
+        inline static void _forEachField(Self &self, Visitor &visitor);
+        inline static int _skipNoHash(const void *buf, int offset, int maxlen);
         inline static uint64_t _computeHash(const __lcm_hash_ptr *p);
 };
 
+static_assert(PointsAnnotation::kHash == dimos_lcm::fingerprint(
+    dimos_lcm::signature_hash()
+        .member("points_length", "int32_t", 0)
+        .member("outline_colors_length", "int32_t", 0)
+        .member("timestamp", NULL, 0)
+        .member("type", "byte", 0)
+        .member("points", NULL, 1).dim(true, "points_length")
+        .member("outline_color", NULL, 0)
+        .member("outline_colors", NULL, 1).dim(true, "outline_colors_length")
+        .member("fill_color", NULL, 0)
+        .member("thickness", "double", 0)
+        .value(),
+    builtin_interfaces::Time::kHash,
+    foxglove_msgs::Point2::kHash,
+    foxglove_msgs::Color::kHash,
+    foxglove_msgs::Color::kHash,
+    foxglove_msgs::Color::kHash),
+    "foxglove_msgs::PointsAnnotation fingerprint does not match its definition");
+
 int PointsAnnotation::encode(void *buf, int offset, int maxlen) const
 {
     int pos = 0, tlen;
@@ -134,6 +234,15 @@ int PointsAnnotation::encode(void *buf, int offset, int maxlen) const
     return pos;
 }
 
+int PointsAnnotation::encodeTo(std::vector<uint8_t> &buf) const
+{
+    dimos_lcm::vector_writer out(buf);
+    int64_t hash = getHash();
+    out.put(&hash, 1);
+    this->_writeNoHash(out);
+    return static_cast<int>(out.size());
+}
+
 int PointsAnnotation::decode(const void *buf, int offset, int maxlen)
 {
     int pos = 0, thislen;
@@ -149,6 +258,22 @@ int PointsAnnotation::decode(const void *buf, int offset, int maxlen)
     return pos;
 }
 
+template <uint64_t Mask>
+int PointsAnnotation::decodeFields(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, thislen;
+
+    int64_t msg_hash;
+    thislen = __int64_t_decode_array(buf, offset + pos, maxlen - pos, &msg_hash, 1);
+    if (thislen < 0) return thislen; else pos += thislen;
+    if (msg_hash != getHash()) return -1;
+
+    thislen = this->_decodeFieldsNoHash<Mask>(buf, offset + pos, maxlen - pos);
+    if (thislen < 0) return thislen; else pos += thislen;
+
+    return pos;
+}
+
 int PointsAnnotation::getEncodedSize() const
 {
     return 8 + _getEncodedSizeNoHash();
@@ -156,8 +281,7 @@ int PointsAnnotation::getEncodedSize() const
 
 int64_t PointsAnnotation::getHash()
 {
-    static int64_t hash = static_cast<int64_t>(_computeHash(NULL));
-    return hash;
+    return kHash;
 }
 
 const char* PointsAnnotation::getTypeName()
@@ -203,6 +327,22 @@ int PointsAnnotation::_encodeNoHash(void *buf, int offset, int maxlen) const
     return pos;
 }
 
+template <typename Writer>
+void PointsAnnotation::_writeNoHash(Writer &out) const
+{
+    out.put(&this->points_length, 1);
+    out.put(&this->outline_colors_length, 1);
+    this->timestamp._writeNoHash(out);
+    out.put(&this->type, 1);
+    if(this->points_length > 0)
+        out.putStructArray(&this->points[0], this->points_length);
+    this->outline_color._writeNoHash(out);
+    if(this->outline_colors_length > 0)
+        out.putStructArray(&this->outline_colors[0], this->outline_colors_length);
+    this->fill_color._writeNoHash(out);
+    out.put(&this->thickness, 1);
+}
+
 int PointsAnnotation::_decodeNoHash(const void *buf, int offset, int maxlen)
 {
     int pos = 0, tlen;
@@ -219,6 +359,7 @@ int PointsAnnotation::_decodeNoHash(const void *buf, int offset, int maxlen)
     tlen = __byte_decode_array(buf, offset + pos, maxlen - pos, &this->type, 1);
     if(tlen < 0) return tlen; else pos += tlen;
 
+    if(this->points_length < 0 || this->points_length > (maxlen - pos) / 16 || this->points_length > maxArrayLength) return -1;
     try {
         this->points.resize(this->points_length);
     } catch (...) {
@@ -232,6 +373,7 @@ int PointsAnnotation::_decodeNoHash(const void *buf, int offset, int maxlen)
     tlen = this->outline_color._decodeNoHash(buf, offset + pos, maxlen - pos);
     if(tlen < 0) return tlen; else pos += tlen;
 
+    if(this->outline_colors_length < 0 || this->outline_colors_length > (maxlen - pos) / 32 || this->outline_colors_length > maxArrayLength) return -1;
     try {
         this->outline_colors.resize(this->outline_colors_length);
     } catch (...) {
@@ -251,6 +393,88 @@ int PointsAnnotation::_decodeNoHash(const void *buf, int offset, int maxlen)
     return pos;
 }
 
+template <uint64_t Mask>
+int PointsAnnotation::_decodeFieldsNoHash(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, tlen;
+
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &this->points_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &this->outline_colors_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    if ((Mask & Fields::timestamp) != 0) {
+        tlen = this->timestamp._decodeNoHash(buf, offset + pos, maxlen - pos);
+        if(tlen < 0) return tlen; else pos += tlen;
+    } else {
+        tlen = builtin_interfaces::Time::_skipNoHash(buf, offset + pos, maxlen - pos);
+        if(tlen < 0) return tlen; else pos += tlen;
+    }
+
+    tlen = __byte_decode_array(buf, offset + pos, maxlen - pos, &this->type, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    if ((Mask & Fields::points) != 0) {
+        if(this->points_length < 0 || this->points_length > (maxlen - pos) / 16 || this->points_length > maxArrayLength) return -1;
+        try {
+            this->points.resize(this->points_length);
+        } catch (...) {
+            return -1;
+        }
+        for (int a0 = 0; a0 < this->points_length; a0++) {
+            tlen = this->points[a0]._decodeNoHash(buf, offset + pos, maxlen - pos);
+            if(tlen < 0) return tlen; else pos += tlen;
+        }
+    } else {
+        if(this->points_length < 0) return -1;
+        for (int a0 = 0; a0 < this->points_length; a0++) {
+            tlen = foxglove_msgs::Point2::_skipNoHash(buf, offset + pos, maxlen - pos);
+            if(tlen < 0) return tlen; else pos += tlen;
+        }
+    }
+
+    if ((Mask & Fields::outline_color) != 0) {
+        tlen = this->outline_color._decodeNoHash(buf, offset + pos, maxlen - pos);
+        if(tlen < 0) return tlen; else pos += tlen;
+    } else {
+        tlen = foxglove_msgs::Color::_skipNoHash(buf, offset + pos, maxlen - pos);
+        if(tlen < 0) return tlen; else pos += tlen;
+    }
+
+    if ((Mask & Fields::outline_colors) != 0) {
+        if(this->outline_colors_length < 0 || this->outline_colors_length > (maxlen - pos) / 32 || this->outline_colors_length > maxArrayLength) return -1;
+        try {
+            this->outline_colors.resize(this->outline_colors_length);
+        } catch (...) {
+            return -1;
+        }
+        for (int a0 = 0; a0 < this->outline_colors_length; a0++) {
+            tlen = this->outline_colors[a0]._decodeNoHash(buf, offset + pos, maxlen - pos);
+            if(tlen < 0) return tlen; else pos += tlen;
+        }
+    } else {
+        if(this->outline_colors_length < 0) return -1;
+        for (int a0 = 0; a0 < this->outline_colors_length; a0++) {
+            tlen = foxglove_msgs::Color::_skipNoHash(buf, offset + pos, maxlen - pos);
+            if(tlen < 0) return tlen; else pos += tlen;
+        }
+    }
+
+    if ((Mask & Fields::fill_color) != 0) {
+        tlen = this->fill_color._decodeNoHash(buf, offset + pos, maxlen - pos);
+        if(tlen < 0) return tlen; else pos += tlen;
+    } else {
+        tlen = foxglove_msgs::Color::_skipNoHash(buf, offset + pos, maxlen - pos);
+        if(tlen < 0) return tlen; else pos += tlen;
+    }
+
+    tlen = __double_decode_array(buf, offset + pos, maxlen - pos, &this->thickness, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    return pos;
+}
+
 int PointsAnnotation::_getEncodedSizeNoHash() const
 {
     int enc_size = 0;
@@ -270,6 +494,51 @@ int PointsAnnotation::_getEncodedSizeNoHash() const
     return enc_size;
 }
 
+int PointsAnnotation::_skipNoHash(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, tlen;
+    int32_t points_length;
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &points_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+    int32_t outline_colors_length;
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &outline_colors_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+    tlen = builtin_interfaces::Time::_skipNoHash(buf, offset + pos, maxlen - pos);
+    if(tlen < 0) return tlen; else pos += tlen;
+    pos += 1;
+    if(points_length < 0) return -1;
+    for (int a0 = 0; a0 < points_length; a0++) {
+        tlen = foxglove_msgs::Point2::_skipNoHash(buf, offset + pos, maxlen - pos);
+        if(tlen < 0) return tlen; else pos += tlen;
+    }
+    tlen = foxglove_msgs::Color::_skipNoHash(buf, offset + pos, maxlen - pos);
+    if(tlen < 0) return tlen; else pos += tlen;
+    if(outline_colors_length < 0) return -1;
+    for (int a0 = 0; a0 < outline_colors_length; a0++) {
+        tlen = foxglove_msgs::Color::_skipNoHash(buf, offset + pos, maxlen - pos);
+        if(tlen < 0) return tlen; else pos += tlen;
+    }
+    tlen = foxglove_msgs::Color::_skipNoHash(buf, offset + pos, maxlen - pos);
+    if(tlen < 0) return tlen; else pos += tlen;
+    pos += 8;
+    if(pos > maxlen) return -1;
+    return pos;
+}
+
+template <typename Self, typename Visitor>
+void PointsAnnotation::_forEachField(Self &self, Visitor &visitor)
+{
+    visitor(kFields[0], self.points_length);
+    visitor(kFields[1], self.outline_colors_length);
+    visitor(kFields[2], self.timestamp);
+    visitor(kFields[3], self.type);
+    visitor(kFields[4], self.points);
+    visitor(kFields[5], self.outline_color);
+    visitor(kFields[6], self.outline_colors);
+    visitor(kFields[7], self.fill_color);
+    visitor(kFields[8], self.thickness);
+}
+
 uint64_t PointsAnnotation::_computeHash(const __lcm_hash_ptr *p)
 {
     const __lcm_hash_ptr *fp;
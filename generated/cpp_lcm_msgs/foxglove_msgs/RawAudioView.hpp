@@ -0,0 +1,145 @@
+/** THIS IS AN AUTOMATICALLY GENERATED FILE.  DO NOT MODIFY
+ * BY HAND!!
+ *
+ * Generated by lcm-cpp (tools/cpp/gen)
+ **/
+
+#ifndef __foxglove_msgs_RawAudioView_hpp__
+#define __foxglove_msgs_RawAudioView_hpp__
+
+#include <lcm/lcm_coretypes.h>
+
+#include <string_view>
+#include "dimos_lcm/view.hpp"
+#include "foxglove_msgs/RawAudio.hpp"
+
+namespace foxglove_msgs
+{
+
+/**
+ * Zero-copy read-only view of an encoded foxglove_msgs.RawAudio.
+ *
+ * Strings and variable-length arrays point into the buffer given to decode(),
+ * which must outlive the view. Decoding validates the whole message once and
+ * never allocates.
+ */
+class RawAudioView
+{
+    public:
+        int32_t    data_length;
+
+        builtin_interfaces::Time timestamp;
+
+        /**
+         * LCM Type: byte[data_length]
+         */
+        dimos_lcm::span< const uint8_t > data;
+
+        std::string_view format;
+
+        int32_t    sample_rate;
+
+        int32_t    number_of_channels;
+
+    public:
+        /**
+         * Decode a view over a message in binary form.
+         *
+         * @param buf The buffer containing the encoded message. It must outlive
+         *  this view.
+         * @param offset The byte offset into @p buf where the encoded message starts.
+         * @param maxlen The maximum number of bytes to read while decoding.
+         * @return The number of bytes decoded, or <0 if an error occured.
+         */
+        inline int decode(const void *buf, int offset, int maxlen);
+
+        /**
+         * Copy the viewed message into an owning RawAudio.
+         */
+        inline void copyTo(RawAudio &msg) const;
+
+        /**
+         * Returns RawAudio::getHash()
+         */
+        inline static int64_t getHash();
+
+        /**
+         * Returns "RawAudio"
+         */
+        inline static const char* getTypeName();
+
+        // LCM support functions. Users should not call these
+        inline int _decodeNoHash(const void *buf, int offset, int maxlen);
+};
+
+int RawAudioView::decode(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, thislen;
+
+    int64_t msg_hash;
+    thislen = __int64_t_decode_array(buf, offset + pos, maxlen - pos, &msg_hash, 1);
+    if (thislen < 0) return thislen; else pos += thislen;
+    if (msg_hash != getHash()) return -1;
+
+    thislen = this->_decodeNoHash(buf, offset + pos, maxlen - pos);
+    if (thislen < 0) return thislen; else pos += thislen;
+
+    return pos;
+}
+
+void RawAudioView::copyTo(RawAudio &msg) const
+{
+    msg.data_length = this->data_length;
+    msg.timestamp = this->timestamp;
+    msg.data.assign(this->data.begin(), this->data.end());
+    msg.format.assign(this->format.data(), this->format.size());
+    msg.sample_rate = this->sample_rate;
+    msg.number_of_channels = this->number_of_channels;
+}
+
+int64_t RawAudioView::getHash()
+{
+    return RawAudio::getHash();
+}
+
+const char* RawAudioView::getTypeName()
+{
+    return "RawAudio";
+}
+
+int RawAudioView::_decodeNoHash(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, tlen;
+
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &this->data_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = this->timestamp._decodeNoHash(buf, offset + pos, maxlen - pos);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    if(this->data_length < 0 || this->data_length > maxlen - pos) return -1;
+    this->data = dimos_lcm::span< const uint8_t >(
+        static_cast<const uint8_t*>(buf) + offset + pos, this->data_length);
+    pos += this->data_length;
+
+    int32_t __format_len__;
+    tlen = __int32_t_decode_array(
+        buf, offset + pos, maxlen - pos, &__format_len__, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+    if(__format_len__ < 1 || __format_len__ > maxlen - pos) return -1;
+    this->format = std::string_view(
+        static_cast<const char*>(buf) + offset + pos, __format_len__ - 1);
+    pos += __format_len__;
+
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &this->sample_rate, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &this->number_of_channels, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    return pos;
+}
+
+}
+
+#endif
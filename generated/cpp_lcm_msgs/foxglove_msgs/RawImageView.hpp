@@ -0,0 +1,163 @@
+/** THIS IS AN AUTOMATICALLY GENERATED FILE.  DO NOT MODIFY
+ * BY HAND!!
+ *
+ * Generated by lcm-cpp (tools/cpp/gen)
+ **/
+
+#ifndef __foxglove_msgs_RawImageView_hpp__
+#define __foxglove_msgs_RawImageView_hpp__
+
+#include <lcm/lcm_coretypes.h>
+
+#include <string_view>
+#include "dimos_lcm/view.hpp"
+#include "foxglove_msgs/RawImage.hpp"
+
+namespace foxglove_msgs
+{
+
+/**
+ * Zero-copy read-only view of an encoded foxglove_msgs.RawImage.
+ *
+ * Strings and variable-length arrays point into the buffer given to decode(),
+ * which must outlive the view. Decoding validates the whole message once and
+ * never allocates.
+ */
+class RawImageView
+{
+    public:
+        int32_t    data_length;
+
+        builtin_interfaces::Time timestamp;
+
+        std::string_view frame_id;
+
+        int32_t    width;
+
+        int32_t    height;
+
+        std::string_view encoding;
+
+        int32_t    step;
+
+        /**
+         * LCM Type: byte[data_length]
+         */
+        dimos_lcm::span< const uint8_t > data;
+
+    public:
+        /**
+         * Decode a view over a message in binary form.
+         *
+         * @param buf The buffer containing the encoded message. It must outlive
+         *  this view.
+         * @param offset The byte offset into @p buf where the encoded message starts.
+         * @param maxlen The maximum number of bytes to read while decoding.
+         * @return The number of bytes decoded, or <0 if an error occured.
+         */
+        inline int decode(const void *buf, int offset, int maxlen);
+
+        /**
+         * Copy the viewed message into an owning RawImage.
+         */
+        inline void copyTo(RawImage &msg) const;
+
+        /**
+         * Returns RawImage::getHash()
+         */
+        inline static int64_t getHash();
+
+        /**
+         * Returns "RawImage"
+         */
+        inline static const char* getTypeName();
+
+        // LCM support functions. Users should not call these
+        inline int _decodeNoHash(const void *buf, int offset, int maxlen);
+};
+
+int RawImageView::decode(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, thislen;
+
+    int64_t msg_hash;
+    thislen = __int64_t_decode_array(buf, offset + pos, maxlen - pos, &msg_hash, 1);
+    if (thislen < 0) return thislen; else pos += thislen;
+    if (msg_hash != getHash()) return -1;
+
+    thislen = this->_decodeNoHash(buf, offset + pos, maxlen - pos);
+    if (thislen < 0) return thislen; else pos += thislen;
+
+    return pos;
+}
+
+void RawImageView::copyTo(RawImage &msg) const
+{
+    msg.data_length = this->data_length;
+    msg.timestamp = this->timestamp;
+    msg.frame_id.assign(this->frame_id.data(), this->frame_id.size());
+    msg.width = this->width;
+    msg.height = this->height;
+    msg.encoding.assign(this->encoding.data(), this->encoding.size());
+    msg.step = this->step;
+    msg.data.assign(this->data.begin(), this->data.end());
+}
+
+int64_t RawImageView::getHash()
+{
+    return RawImage::getHash();
+}
+
+const char* RawImageView::getTypeName()
+{
+    return "RawImage";
+}
+
+int RawImageView::_decodeNoHash(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, tlen;
+
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &this->data_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = this->timestamp._decodeNoHash(buf, offset + pos, maxlen - pos);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    int32_t __frame_id_len__;
+    tlen = __int32_t_decode_array(
+        buf, offset + pos, maxlen - pos, &__frame_id_len__, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+    if(__frame_id_len__ < 1 || __frame_id_len__ > maxlen - pos) return -1;
+    this->frame_id = std::string_view(
+        static_cast<const char*>(buf) + offset + pos, __frame_id_len__ - 1);
+    pos += __frame_id_len__;
+
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &this->width, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &this->height, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    int32_t __encoding_len__;
+    tlen = __int32_t_decode_array(
+        buf, offset + pos, maxlen - pos, &__encoding_len__, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+    if(__encoding_len__ < 1 || __encoding_len__ > maxlen - pos) return -1;
+    this->encoding = std::string_view(
+        static_cast<const char*>(buf) + offset + pos, __encoding_len__ - 1);
+    pos += __encoding_len__;
+
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &this->step, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    if(this->data_length < 0 || this->data_length > maxlen - pos) return -1;
+    this->data = dimos_lcm::span< const uint8_t >(
+        static_cast<const uint8_t*>(buf) + offset + pos, this->data_length);
+    pos += this->data_length;
+
+    return pos;
+}
+
+}
+
+#endif
@@ -1,7 +1,7 @@
 /** THIS IS AN AUTOMATICALLY GENERATED FILE.  DO NOT MODIFY
  * BY HAND!!
  *
- * Generated by lcm-gen 1.5.2
+ * Generated by lcm-cpp (tools/cpp/gen)
  **/
 
 #ifndef __foxglove_msgs_SceneEntity_hpp__
@@ -9,8 +9,13 @@
 
 #include <lcm/lcm_coretypes.h>
 
+#include <array>
 #include <string>
 #include <vector>
+#include "dimos_lcm/iov_writer.hpp"
+#include "dimos_lcm/wire_builder.hpp"
+#include "dimos_lcm/fingerprint.hpp"
+#include "dimos_lcm/reflection.hpp"
 #include "builtin_interfaces/Time.hpp"
 #include "builtin_interfaces/Duration.hpp"
 #include "foxglove_msgs/KeyValuePair.hpp"
@@ -114,6 +119,37 @@ class SceneEntity
          */
         inline int encode(void *buf, int offset, int maxlen) const;
 
+        /**
+         * Encode a message by appending it to @p buf, walking the message once
+         * instead of sizing it with getEncodedSize() first. @p buf grows
+         * geometrically; reuse it across calls to avoid reallocating.
+         *
+         * @return The number of bytes appended.
+         */
+        inline int encodeTo(std::vector<uint8_t> &buf) const;
+
+        /**
+         * Encode a message as a list of buffers for writev()/sendmsg(). Byte
+         * payloads are referenced in place instead of copied; see
+         * dimos_lcm/iov_writer.hpp for how long they must stay valid.
+         *
+         * @param out Receives the encoded message after anything it already holds.
+         * @return The number of bytes encoded.
+         */
+        inline int encodeIov(dimos_lcm::iov_writer &out) const;
+
+        /**
+         * Encode a message into the buffer of @p out, leaving a gap at the
+         * place of each byte payload for the caller to fill; see
+         * dimos_lcm/wire_builder.hpp. The payload arrays are not read: set
+         * their length fields, and leave the arrays empty to skip filling them
+         * twice.
+         *
+         * @param out Receives the encoded message after anything it already holds.
+         * @return The number of bytes encoded, or <0 if they do not fit.
+         */
+        inline int encodeInPlace(dimos_lcm::wire_builder &out) const;
+
         /**
          * Check how many bytes are required to encode this message.
          */
@@ -129,6 +165,62 @@ class SceneEntity
          */
         inline int decode(const void *buf, int offset, int maxlen);
 
+        /**
+         * Field bits for decodeFields().
+         */
+        struct Fields
+        {
+            static constexpr uint64_t metadata_length = 1ULL << 0;
+            static constexpr uint64_t arrows_length = 1ULL << 1;
+            static constexpr uint64_t cubes_length = 1ULL << 2;
+            static constexpr uint64_t spheres_length = 1ULL << 3;
+            static constexpr uint64_t cylinders_length = 1ULL << 4;
+            static constexpr uint64_t lines_length = 1ULL << 5;
+            static constexpr uint64_t triangles_length = 1ULL << 6;
+            static constexpr uint64_t texts_length = 1ULL << 7;
+            static constexpr uint64_t models_length = 1ULL << 8;
+            static constexpr uint64_t timestamp = 1ULL << 9;
+            static constexpr uint64_t frame_id = 1ULL << 10;
+            static constexpr uint64_t id = 1ULL << 11;
+            static constexpr uint64_t lifetime = 1ULL << 12;
+            static constexpr uint64_t frame_locked = 1ULL << 13;
+            static constexpr uint64_t metadata = 1ULL << 14;
+            static constexpr uint64_t arrows = 1ULL << 15;
+            static constexpr uint64_t cubes = 1ULL << 16;
+            static constexpr uint64_t spheres = 1ULL << 17;
+            static constexpr uint64_t cylinders = 1ULL << 18;
+            static constexpr uint64_t lines = 1ULL << 19;
+            static constexpr uint64_t triangles = 1ULL << 20;
+            static constexpr uint64_t texts = 1ULL << 21;
+            static constexpr uint64_t models = 1ULL << 22;
+            static constexpr uint64_t all = (1ULL << 23) - 1;
+        };
+
+        /**
+         * Decode only the fields selected by @p Mask, a bitwise or of Fields
+         * values. Strings, arrays and nested structs that are not selected are
+         * skipped over by their length prefixes without being allocated, and
+         * keep their previous value. Scalar fields are always decoded: they
+         * cost nothing to read and array lengths depend on them.
+         *
+         * @return The number of bytes decoded, or <0 if an error occured.
+         */
+        template <uint64_t Mask>
+        inline int decodeFields(const void *buf, int offset, int maxlen);
+
+        /**
+         * Upper bound on the length of every variable-length array of this
+         * type, checked by decode() before anything is allocated; messages
+         * exceeding it fail to decode. It does not apply to nested types,
+         * which have their own. Set it once at startup, before decoding.
+         * Before C++17 it is a constant with no limit.
+         */
+#if __cplusplus >= 201703L
+        static inline int32_t maxArrayLength = INT32_MAX;
+#else
+        static constexpr int32_t maxArrayLength = INT32_MAX;
+#endif
+
         /**
          * Retrieve the 64-bit fingerprint identifying the structure of the message.
          * Note that the fingerprint is the same for all instances of the same
@@ -137,18 +229,99 @@ class SceneEntity
          */
         inline static int64_t getHash();
 
+        /**
+         * The fingerprint returned by getHash(), as a compile-time constant.
+         */
+        static constexpr int64_t kHash = static_cast<int64_t>(0x6f45556370928d42ULL);
+
         /**
          * Returns "SceneEntity"
          */
         inline static const char* getTypeName();
 
+        /**
+         * Name, LCM type and array dimensions of each field, in wire order.
+         * See dimos_lcm::for_each_field() for visiting the fields themselves.
+         */
+        static constexpr std::array<dimos_lcm::field_info, 23> kFields = {{
+            { "metadata_length", "int32_t", true, 0, 0, NULL },
+            { "arrows_length", "int32_t", true, 0, 0, NULL },
+            { "cubes_length", "int32_t", true, 0, 0, NULL },
+            { "spheres_length", "int32_t", true, 0, 0, NULL },
+            { "cylinders_length", "int32_t", true, 0, 0, NULL },
+            { "lines_length", "int32_t", true, 0, 0, NULL },
+            { "triangles_length", "int32_t", true, 0, 0, NULL },
+            { "texts_length", "int32_t", true, 0, 0, NULL },
+            { "models_length", "int32_t", true, 0, 0, NULL },
+            { "timestamp", "builtin_interfaces.Time", false, 0, 0, NULL },
+            { "frame_id", "string", true, 0, 0, NULL },
+            { "id", "string", true, 0, 0, NULL },
+            { "lifetime", "builtin_interfaces.Duration", false, 0, 0, NULL },
+            { "frame_locked", "boolean", true, 0, 0, NULL },
+            { "metadata", "foxglove_msgs.KeyValuePair", false, 1, -1, "metadata_length" },
+            { "arrows", "foxglove_msgs.ArrowPrimitive", false, 1, -1, "arrows_length" },
+            { "cubes", "foxglove_msgs.CubePrimitive", false, 1, -1, "cubes_length" },
+            { "spheres", "foxglove_msgs.SpherePrimitive", false, 1, -1, "spheres_length" },
+            { "cylinders", "foxglove_msgs.CylinderPrimitive", false, 1, -1, "cylinders_length" },
+            { "lines", "foxglove_msgs.LinePrimitive", false, 1, -1, "lines_length" },
+            { "triangles", "foxglove_msgs.TriangleListPrimitive", false, 1, -1, "triangles_length" },
+            { "texts", "foxglove_msgs.TextPrimitive", false, 1, -1, "texts_length" },
+            { "models", "foxglove_msgs.ModelPrimitive", false, 1, -1, "models_length" },
+        }};
+
         // LCM support functions. Users should not call these
         inline int _encodeNoHash(void *buf, int offset, int maxlen) const;
+        template <typename Writer>
+        inline void _writeNoHash(Writer &out) const;
         inline int _getEncodedSizeNoHash() const;
         inline int _decodeNoHash(const void *buf, int offset, int maxlen);
+        template <uint64_t Mask>
+        inline int _decodeFieldsNoHash(const void *buf, int offset, int maxlen);
+        template <typename Self, typename Visitor>
+        inline static void _forEachField(Self &self, Visitor &visitor);
+        inline static int _skipNoHash(const void *buf, int offset, int maxlen);
         inline static uint64_t _computeHash(const __lcm_hash_ptr *p);
 };
 
+static_assert(SceneEntity::kHash == dimos_lcm::fingerprint(
+    dimos_lcm::signature_hash()
+        .member("metadata_length", "int32_t", 0)
+        .member("arrows_length", "int32_t", 0)
+        .member("cubes_length", "int32_t", 0)
+        .member("spheres_length", "int32_t", 0)
+        .member("cylinders_length", "int32_t", 0)
+        .member("lines_length", "int32_t", 0)
+        .member("triangles_length", "int32_t", 0)
+        .member("texts_length", "int32_t", 0)
+        .member("models_length", "int32_t", 0)
+        .member("timestamp", NULL, 0)
+        .member("frame_id", "string", 0)
+        .member("id", "string", 0)
+        .member("lifetime", NULL, 0)
+        .member("frame_locked", "boolean", 0)
+        .member("metadata", NULL, 1).dim(true, "metadata_length")
+        .member("arrows", NULL, 1).dim(true, "arrows_length")
+        .member("cubes", NULL, 1).dim(true, "cubes_length")
+        .member("spheres", NULL, 1).dim(true, "spheres_length")
+        .member("cylinders", NULL, 1).dim(true, "cylinders_length")
+        .member("lines", NULL, 1).dim(true, "lines_length")
+        .member("triangles", NULL, 1).dim(true, "triangles_length")
+        .member("texts", NULL, 1).dim(true, "texts_length")
+        .member("models", NULL, 1).dim(true, "models_length")
+        .value(),
+    builtin_interfaces::Time::kHash,
+    builtin_interfaces::Duration::kHash,
+    foxglove_msgs::KeyValuePair::kHash,
+    foxglove_msgs::ArrowPrimitive::kHash,
+    foxglove_msgs::CubePrimitive::kHash,
+    foxglove_msgs::SpherePrimitive::kHash,
+    foxglove_msgs::CylinderPrimitive::kHash,
+    foxglove_msgs::LinePrimitive::kHash,
+    foxglove_msgs::TriangleListPrimitive::kHash,
+    foxglove_msgs::TextPrimitive::kHash,
+    foxglove_msgs::ModelPrimitive::kHash),
+    "foxglove_msgs::SceneEntity fingerprint does not match its definition");
+
 int SceneEntity::encode(void *buf, int offset, int maxlen) const
 {
     int pos = 0, tlen;
@@ -163,6 +336,35 @@ int SceneEntity::encode(void *buf, int offset, int maxlen) const
     return pos;
 }
 
+int SceneEntity::encodeTo(std::vector<uint8_t> &buf) const
+{
+    dimos_lcm::vector_writer out(buf);
+    int64_t hash = getHash();
+    out.put(&hash, 1);
+    this->_writeNoHash(out);
+    return static_cast<int>(out.size());
+}
+
+int SceneEntity::encodeIov(dimos_lcm::iov_writer &out) const
+{
+    size_t start = out.size();
+    int64_t hash = getHash();
+    out.put(&hash, 1);
+    this->_writeNoHash(out);
+    return static_cast<int>(out.size() - start);
+}
+
+int SceneEntity::encodeInPlace(dimos_lcm::wire_builder &out) const
+{
+    int size = getEncodedSize();
+    if (static_cast<size_t>(size) > out.remaining())
+        return -1;
+    int64_t hash = getHash();
+    out.put(&hash, 1);
+    this->_writeNoHash(out);
+    return size;
+}
+
 int SceneEntity::decode(const void *buf, int offset, int maxlen)
 {
     int pos = 0, thislen;
@@ -178,6 +380,22 @@ int SceneEntity::decode(const void *buf, int offset, int maxlen)
     return pos;
 }
 
+template <uint64_t Mask>
+int SceneEntity::decodeFields(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, thislen;
+
+    int64_t msg_hash;
+    thislen = __int64_t_decode_array(buf, offset + pos, maxlen - pos, &msg_hash, 1);
+    if (thislen < 0) return thislen; else pos += thislen;
+    if (msg_hash != getHash()) return -1;
+
+    thislen = this->_decodeFieldsNoHash<Mask>(buf, offset + pos, maxlen - pos);
+    if (thislen < 0) return thislen; else pos += thislen;
+
+    return pos;
+}
+
 int SceneEntity::getEncodedSize() const
 {
     return 8 + _getEncodedSizeNoHash();
@@ -185,8 +403,7 @@ int SceneEntity::getEncodedSize() const
 
 int64_t SceneEntity::getHash()
 {
-    static int64_t hash = static_cast<int64_t>(_computeHash(NULL));
-    return hash;
+    return kHash;
 }
 
 const char* SceneEntity::getTypeName()
@@ -292,6 +509,43 @@ int SceneEntity::_encodeNoHash(void *buf, int offset, int maxlen) const
     return pos;
 }
 
+template <typename Writer>
+void SceneEntity::_writeNoHash(Writer &out) const
+{
+    out.put(&this->metadata_length, 1);
+    out.put(&this->arrows_length, 1);
+    out.put(&this->cubes_length, 1);
+    out.put(&this->spheres_length, 1);
+    out.put(&this->cylinders_length, 1);
+    out.put(&this->lines_length, 1);
+    out.put(&this->triangles_length, 1);
+    out.put(&this->texts_length, 1);
+    out.put(&this->models_length, 1);
+    this->timestamp._writeNoHash(out);
+    out.put(this->frame_id);
+    out.put(this->id);
+    this->lifetime._writeNoHash(out);
+    out.put(&this->frame_locked, 1);
+    for (int a0 = 0; a0 < this->metadata_length; a0++)
+        this->metadata[a0]._writeNoHash(out);
+    if(this->arrows_length > 0)
+        out.putStructArray(&this->arrows[0], this->arrows_length);
+    if(this->cubes_length > 0)
+        out.putStructArray(&this->cubes[0], this->cubes_length);
+    if(this->spheres_length > 0)
+        out.putStructArray(&this->spheres[0], this->spheres_length);
+    if(this->cylinders_length > 0)
+        out.putStructArray(&this->cylinders[0], this->cylinders_length);
+    for (int a0 = 0; a0 < this->lines_length; a0++)
+        this->lines[a0]._writeNoHash(out);
+    for (int a0 = 0; a0 < this->triangles_length; a0++)
+        this->triangles[a0]._writeNoHash(out);
+    for (int a0 = 0; a0 < this->texts_length; a0++)
+        this->texts[a0]._writeNoHash(out);
+    for (int a0 = 0; a0 < this->models_length; a0++)
+        this->models[a0]._writeNoHash(out);
+}
+
 int SceneEntity::_decodeNoHash(const void *buf, int offset, int maxlen)
 {
     int pos = 0, tlen;
@@ -330,7 +584,7 @@ int SceneEntity::_decodeNoHash(const void *buf, int offset, int maxlen)
     tlen = __int32_t_decode_array(
         buf, offset + pos, maxlen - pos, &__frame_id_len__, 1);
     if(tlen < 0) return tlen; else pos += tlen;
-    if(__frame_id_len__ > maxlen - pos) return -1;
+    if(__frame_id_len__ < 1 || __frame_id_len__ > maxlen - pos) return -1;
     this->frame_id.assign(
         static_cast<const char*>(buf) + offset + pos, __frame_id_len__ - 1);
     pos += __frame_id_len__;
@@ -339,7 +593,7 @@ int SceneEntity::_decodeNoHash(const void *buf, int offset, int maxlen)
     tlen = __int32_t_decode_array(
         buf, offset + pos, maxlen - pos, &__id_len__, 1);
     if(tlen < 0) return tlen; else pos += tlen;
-    if(__id_len__ > maxlen - pos) return -1;
+    if(__id_len__ < 1 || __id_len__ > maxlen - pos) return -1;
     this->id.assign(
         static_cast<const char*>(buf) + offset + pos, __id_len__ - 1);
     pos += __id_len__;
@@ -350,6 +604,7 @@ int SceneEntity::_decodeNoHash(const void *buf, int offset, int maxlen)
     tlen = __boolean_decode_array(buf, offset + pos, maxlen - pos, &this->frame_locked, 1);
     if(tlen < 0) return tlen; else pos += tlen;
 
+    if(this->metadata_length < 0 || this->metadata_length > (maxlen - pos) / 10 || this->metadata_length > maxArrayLength) return -1;
     try {
         this->metadata.resize(this->metadata_length);
     } catch (...) {
@@ -360,6 +615,7 @@ int SceneEntity::_decodeNoHash(const void *buf, int offset, int maxlen)
         if(tlen < 0) return tlen; else pos += tlen;
     }
 
+    if(this->arrows_length < 0 || this->arrows_length > (maxlen - pos) / 120 || this->arrows_length > maxArrayLength) return -1;
     try {
         this->arrows.resize(this->arrows_length);
     } catch (...) {
@@ -370,6 +626,7 @@ int SceneEntity::_decodeNoHash(const void *buf, int offset, int maxlen)
         if(tlen < 0) return tlen; else pos += tlen;
     }
 
+    if(this->cubes_length < 0 || this->cubes_length > (maxlen - pos) / 112 || this->cubes_length > maxArrayLength) return -1;
     try {
         this->cubes.resize(this->cubes_length);
     } catch (...) {
@@ -380,6 +637,7 @@ int SceneEntity::_decodeNoHash(const void *buf, int offset, int maxlen)
         if(tlen < 0) return tlen; else pos += tlen;
     }
 
+    if(this->spheres_length < 0 || this->spheres_length > (maxlen - pos) / 112 || this->spheres_length > maxArrayLength) return -1;
     try {
         this->spheres.resize(this->spheres_length);
     } catch (...) {
@@ -390,6 +648,7 @@ int SceneEntity::_decodeNoHash(const void *buf, int offset, int maxlen)
         if(tlen < 0) return tlen; else pos += tlen;
     }
 
+    if(this->cylinders_length < 0 || this->cylinders_length > (maxlen - pos) / 128 || this->cylinders_length > maxArrayLength) return -1;
     try {
         this->cylinders.resize(this->cylinders_length);
     } catch (...) {
@@ -400,6 +659,7 @@ int SceneEntity::_decodeNoHash(const void *buf, int offset, int maxlen)
         if(tlen < 0) return tlen; else pos += tlen;
     }
 
+    if(this->lines_length < 0 || this->lines_length > (maxlen - pos) / 110 || this->lines_length > maxArrayLength) return -1;
     try {
         this->lines.resize(this->lines_length);
     } catch (...) {
@@ -410,6 +670,7 @@ int SceneEntity::_decodeNoHash(const void *buf, int offset, int maxlen)
         if(tlen < 0) return tlen; else pos += tlen;
     }
 
+    if(this->triangles_length < 0 || this->triangles_length > (maxlen - pos) / 100 || this->triangles_length > maxArrayLength) return -1;
     try {
         this->triangles.resize(this->triangles_length);
     } catch (...) {
@@ -420,6 +681,7 @@ int SceneEntity::_decodeNoHash(const void *buf, int offset, int maxlen)
         if(tlen < 0) return tlen; else pos += tlen;
     }
 
+    if(this->texts_length < 0 || this->texts_length > (maxlen - pos) / 103 || this->texts_length > maxArrayLength) return -1;
     try {
         this->texts.resize(this->texts_length);
     } catch (...) {
@@ -430,6 +692,7 @@ int SceneEntity::_decodeNoHash(const void *buf, int offset, int maxlen)
         if(tlen < 0) return tlen; else pos += tlen;
     }
 
+    if(this->models_length < 0 || this->models_length > (maxlen - pos) / 127 || this->models_length > maxArrayLength) return -1;
     try {
         this->models.resize(this->models_length);
     } catch (...) {
@@ -443,6 +706,265 @@ int SceneEntity::_decodeNoHash(const void *buf, int offset, int maxlen)
     return pos;
 }
 
+template <uint64_t Mask>
+int SceneEntity::_decodeFieldsNoHash(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, tlen;
+
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &this->metadata_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &this->arrows_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &this->cubes_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &this->spheres_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &this->cylinders_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &this->lines_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &this->triangles_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &this->texts_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &this->models_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    if ((Mask & Fields::timestamp) != 0) {
+        tlen = this->timestamp._decodeNoHash(buf, offset + pos, maxlen - pos);
+        if(tlen < 0) return tlen; else pos += tlen;
+    } else {
+        tlen = builtin_interfaces::Time::_skipNoHash(buf, offset + pos, maxlen - pos);
+        if(tlen < 0) return tlen; else pos += tlen;
+    }
+
+    if ((Mask & Fields::frame_id) != 0) {
+        int32_t __frame_id_len__;
+        tlen = __int32_t_decode_array(
+            buf, offset + pos, maxlen - pos, &__frame_id_len__, 1);
+        if(tlen < 0) return tlen; else pos += tlen;
+        if(__frame_id_len__ < 1 || __frame_id_len__ > maxlen - pos) return -1;
+        this->frame_id.assign(
+            static_cast<const char*>(buf) + offset + pos, __frame_id_len__ - 1);
+        pos += __frame_id_len__;
+    } else {
+        int32_t __frame_id_len__;
+        tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &__frame_id_len__, 1);
+        if(tlen < 0) return tlen; else pos += tlen;
+        if(__frame_id_len__ < 0 || __frame_id_len__ > maxlen - pos) return -1;
+        pos += __frame_id_len__;
+    }
+
+    if ((Mask & Fields::id) != 0) {
+        int32_t __id_len__;
+        tlen = __int32_t_decode_array(
+            buf, offset + pos, maxlen - pos, &__id_len__, 1);
+        if(tlen < 0) return tlen; else pos += tlen;
+        if(__id_len__ < 1 || __id_len__ > maxlen - pos) return -1;
+        this->id.assign(
+            static_cast<const char*>(buf) + offset + pos, __id_len__ - 1);
+        pos += __id_len__;
+    } else {
+        int32_t __id_len__;
+        tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &__id_len__, 1);
+        if(tlen < 0) return tlen; else pos += tlen;
+        if(__id_len__ < 0 || __id_len__ > maxlen - pos) return -1;
+        pos += __id_len__;
+    }
+
+    if ((Mask & Fields::lifetime) != 0) {
+        tlen = this->lifetime._decodeNoHash(buf, offset + pos, maxlen - pos);
+        if(tlen < 0) return tlen; else pos += tlen;
+    } else {
+        tlen = builtin_interfaces::Duration::_skipNoHash(buf, offset + pos, maxlen - pos);
+        if(tlen < 0) return tlen; else pos += tlen;
+    }
+
+    tlen = __boolean_decode_array(buf, offset + pos, maxlen - pos, &this->frame_locked, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    if ((Mask & Fields::metadata) != 0) {
+        if(this->metadata_length < 0 || this->metadata_length > (maxlen - pos) / 10 || this->metadata_length > maxArrayLength) return -1;
+        try {
+            this->metadata.resize(this->metadata_length);
+        } catch (...) {
+            return -1;
+        }
+        for (int a0 = 0; a0 < this->metadata_length; a0++) {
+            tlen = this->metadata[a0]._decodeNoHash(buf, offset + pos, maxlen - pos);
+            if(tlen < 0) return tlen; else pos += tlen;
+        }
+    } else {
+        if(this->metadata_length < 0) return -1;
+        for (int a0 = 0; a0 < this->metadata_length; a0++) {
+            tlen = foxglove_msgs::KeyValuePair::_skipNoHash(buf, offset + pos, maxlen - pos);
+            if(tlen < 0) return tlen; else pos += tlen;
+        }
+    }
+
+    if ((Mask & Fields::arrows) != 0) {
+        if(this->arrows_length < 0 || this->arrows_length > (maxlen - pos) / 120 || this->arrows_length > maxArrayLength) return -1;
+        try {
+            this->arrows.resize(this->arrows_length);
+        } catch (...) {
+            return -1;
+        }
+        for (int a0 = 0; a0 < this->arrows_length; a0++) {
+            tlen = this->arrows[a0]._decodeNoHash(buf, offset + pos, maxlen - pos);
+            if(tlen < 0) return tlen; else pos += tlen;
+        }
+    } else {
+        if(this->arrows_length < 0) return -1;
+        for (int a0 = 0; a0 < this->arrows_length; a0++) {
+            tlen = foxglove_msgs::ArrowPrimitive::_skipNoHash(buf, offset + pos, maxlen - pos);
+            if(tlen < 0) return tlen; else pos += tlen;
+        }
+    }
+
+    if ((Mask & Fields::cubes) != 0) {
+        if(this->cubes_length < 0 || this->cubes_length > (maxlen - pos) / 112 || this->cubes_length > maxArrayLength) return -1;
+        try {
+            this->cubes.resize(this->cubes_length);
+        } catch (...) {
+            return -1;
+        }
+        for (int a0 = 0; a0 < this->cubes_length; a0++) {
+            tlen = this->cubes[a0]._decodeNoHash(buf, offset + pos, maxlen - pos);
+            if(tlen < 0) return tlen; else pos += tlen;
+        }
+    } else {
+        if(this->cubes_length < 0) return -1;
+        for (int a0 = 0; a0 < this->cubes_length; a0++) {
+            tlen = foxglove_msgs::CubePrimitive::_skipNoHash(buf, offset + pos, maxlen - pos);
+            if(tlen < 0) return tlen; else pos += tlen;
+        }
+    }
+
+    if ((Mask & Fields::spheres) != 0) {
+        if(this->spheres_length < 0 || this->spheres_length > (maxlen - pos) / 112 || this->spheres_length > maxArrayLength) return -1;
+        try {
+            this->spheres.resize(this->spheres_length);
+        } catch (...) {
+            return -1;
+        }
+        for (int a0 = 0; a0 < this->spheres_length; a0++) {
+            tlen = this->spheres[a0]._decodeNoHash(buf, offset + pos, maxlen - pos);
+            if(tlen < 0) return tlen; else pos += tlen;
+        }
+    } else {
+        if(this->spheres_length < 0) return -1;
+        for (int a0 = 0; a0 < this->spheres_length; a0++) {
+            tlen = foxglove_msgs::SpherePrimitive::_skipNoHash(buf, offset + pos, maxlen - pos);
+            if(tlen < 0) return tlen; else pos += tlen;
+        }
+    }
+
+    if ((Mask & Fields::cylinders) != 0) {
+        if(this->cylinders_length < 0 || this->cylinders_length > (maxlen - pos) / 128 || this->cylinders_length > maxArrayLength) return -1;
+        try {
+            this->cylinders.resize(this->cylinders_length);
+        } catch (...) {
+            return -1;
+        }
+        for (int a0 = 0; a0 < this->cylinders_length; a0++) {
+            tlen = this->cylinders[a0]._decodeNoHash(buf, offset + pos, maxlen - pos);
+            if(tlen < 0) return tlen; else pos += tlen;
+        }
+    } else {
+        if(this->cylinders_length < 0) return -1;
+        for (int a0 = 0; a0 < this->cylinders_length; a0++) {
+            tlen = foxglove_msgs::CylinderPrimitive::_skipNoHash(buf, offset + pos, maxlen - pos);
+            if(tlen < 0) return tlen; else pos += tlen;
+        }
+    }
+
+    if ((Mask & Fields::lines) != 0) {
+        if(this->lines_length < 0 || this->lines_length > (maxlen - pos) / 110 || this->lines_length > maxArrayLength) return -1;
+        try {
+            this->lines.resize(this->lines_length);
+        } catch (...) {
+            return -1;
+        }
+        for (int a0 = 0; a0 < this->lines_length; a0++) {
+            tlen = this->lines[a0]._decodeNoHash(buf, offset + pos, maxlen - pos);
+            if(tlen < 0) return tlen; else pos += tlen;
+        }
+    } else {
+        if(this->lines_length < 0) return -1;
+        for (int a0 = 0; a0 < this->lines_length; a0++) {
+            tlen = foxglove_msgs::LinePrimitive::_skipNoHash(buf, offset + pos, maxlen - pos);
+            if(tlen < 0) return tlen; else pos += tlen;
+        }
+    }
+
+    if ((Mask & Fields::triangles) != 0) {
+        if(this->triangles_length < 0 || this->triangles_length > (maxlen - pos) / 100 || this->triangles_length > maxArrayLength) return -1;
+        try {
+            this->triangles.resize(this->triangles_length);
+        } catch (...) {
+            return -1;
+        }
+        for (int a0 = 0; a0 < this->triangles_length; a0++) {
+            tlen = this->triangles[a0]._decodeNoHash(buf, offset + pos, maxlen - pos);
+            if(tlen < 0) return tlen; else pos += tlen;
+        }
+    } else {
+        if(this->triangles_length < 0) return -1;
+        for (int a0 = 0; a0 < this->triangles_length; a0++) {
+            tlen = foxglove_msgs::TriangleListPrimitive::_skipNoHash(buf, offset + pos, maxlen - pos);
+            if(tlen < 0) return tlen; else pos += tlen;
+        }
+    }
+
+    if ((Mask & Fields::texts) != 0) {
+        if(this->texts_length < 0 || this->texts_length > (maxlen - pos) / 103 || this->texts_length > maxArrayLength) return -1;
+        try {
+            this->texts.resize(this->texts_length);
+        } catch (...) {
+            return -1;
+        }
+        for (int a0 = 0; a0 < this->texts_length; a0++) {
+            tlen = this->texts[a0]._decodeNoHash(buf, offset + pos, maxlen - pos);
+            if(tlen < 0) return tlen; else pos += tlen;
+        }
+    } else {
+        if(this->texts_length < 0) return -1;
+        for (int a0 = 0; a0 < this->texts_length; a0++) {
+            tlen = foxglove_msgs::TextPrimitive::_skipNoHash(buf, offset + pos, maxlen - pos);
+            if(tlen < 0) return tlen; else pos += tlen;
+        }
+    }
+
+    if ((Mask & Fields::models) != 0) {
+        if(this->models_length < 0 || this->models_length > (maxlen - pos) / 127 || this->models_length > maxArrayLength) return -1;
+        try {
+            this->models.resize(this->models_length);
+        } catch (...) {
+            return -1;
+        }
+        for (int a0 = 0; a0 < this->models_length; a0++) {
+            tlen = this->models[a0]._decodeNoHash(buf, offset + pos, maxlen - pos);
+            if(tlen < 0) return tlen; else pos += tlen;
+        }
+    } else {
+        if(this->models_length < 0) return -1;
+        for (int a0 = 0; a0 < this->models_length; a0++) {
+            tlen = foxglove_msgs::ModelPrimitive::_skipNoHash(buf, offset + pos, maxlen - pos);
+            if(tlen < 0) return tlen; else pos += tlen;
+        }
+    }
+
+    return pos;
+}
+
 int SceneEntity::_getEncodedSizeNoHash() const
 {
     int enc_size = 0;
@@ -490,6 +1012,128 @@ int SceneEntity::_getEncodedSizeNoHash() const
     return enc_size;
 }
 
+int SceneEntity::_skipNoHash(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, tlen;
+    int32_t metadata_length;
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &metadata_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+    int32_t arrows_length;
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &arrows_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+    int32_t cubes_length;
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &cubes_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+    int32_t spheres_length;
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &spheres_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+    int32_t cylinders_length;
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &cylinders_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+    int32_t lines_length;
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &lines_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+    int32_t triangles_length;
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &triangles_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+    int32_t texts_length;
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &texts_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+    int32_t models_length;
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &models_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+    tlen = builtin_interfaces::Time::_skipNoHash(buf, offset + pos, maxlen - pos);
+    if(tlen < 0) return tlen; else pos += tlen;
+    int32_t __frame_id_len__;
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &__frame_id_len__, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+    if(__frame_id_len__ < 0 || __frame_id_len__ > maxlen - pos) return -1;
+    pos += __frame_id_len__;
+    int32_t __id_len__;
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &__id_len__, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+    if(__id_len__ < 0 || __id_len__ > maxlen - pos) return -1;
+    pos += __id_len__;
+    tlen = builtin_interfaces::Duration::_skipNoHash(buf, offset + pos, maxlen - pos);
+    if(tlen < 0) return tlen; else pos += tlen;
+    pos += 1;
+    if(metadata_length < 0) return -1;
+    for (int a0 = 0; a0 < metadata_length; a0++) {
+        tlen = foxglove_msgs::KeyValuePair::_skipNoHash(buf, offset + pos, maxlen - pos);
+        if(tlen < 0) return tlen; else pos += tlen;
+    }
+    if(arrows_length < 0) return -1;
+    for (int a0 = 0; a0 < arrows_length; a0++) {
+        tlen = foxglove_msgs::ArrowPrimitive::_skipNoHash(buf, offset + pos, maxlen - pos);
+        if(tlen < 0) return tlen; else pos += tlen;
+    }
+    if(cubes_length < 0) return -1;
+    for (int a0 = 0; a0 < cubes_length; a0++) {
+        tlen = foxglove_msgs::CubePrimitive::_skipNoHash(buf, offset + pos, maxlen - pos);
+        if(tlen < 0) return tlen; else pos += tlen;
+    }
+    if(spheres_length < 0) return -1;
+    for (int a0 = 0; a0 < spheres_length; a0++) {
+        tlen = foxglove_msgs::SpherePrimitive::_skipNoHash(buf, offset + pos, maxlen - pos);
+        if(tlen < 0) return tlen; else pos += tlen;
+    }
+    if(cylinders_length < 0) return -1;
+    for (int a0 = 0; a0 < cylinders_length; a0++) {
+        tlen = foxglove_msgs::CylinderPrimitive::_skipNoHash(buf, offset + pos, maxlen - pos);
+        if(tlen < 0) return tlen; else pos += tlen;
+    }
+    if(lines_length < 0) return -1;
+    for (int a0 = 0; a0 < lines_length; a0++) {
+        tlen = foxglove_msgs::LinePrimitive::_skipNoHash(buf, offset + pos, maxlen - pos);
+        if(tlen < 0) return tlen; else pos += tlen;
+    }
+    if(triangles_length < 0) return -1;
+    for (int a0 = 0; a0 < triangles_length; a0++) {
+        tlen = foxglove_msgs::TriangleListPrimitive::_skipNoHash(buf, offset + pos, maxlen - pos);
+        if(tlen < 0) return tlen; else pos += tlen;
+    }
+    if(texts_length < 0) return -1;
+    for (int a0 = 0; a0 < texts_length; a0++) {
+        tlen = foxglove_msgs::TextPrimitive::_skipNoHash(buf, offset + pos, maxlen - pos);
+        if(tlen < 0) return tlen; else pos += tlen;
+    }
+    if(models_length < 0) return -1;
+    for (int a0 = 0; a0 < models_length; a0++) {
+        tlen = foxglove_msgs::ModelPrimitive::_skipNoHash(buf, offset + pos, maxlen - pos);
+        if(tlen < 0) return tlen; else pos += tlen;
+    }
+    if(pos > maxlen) return -1;
+    return pos;
+}
+
+template <typename Self, typename Visitor>
+void SceneEntity::_forEachField(Self &self, Visitor &visitor)
+{
+    visitor(kFields[0], self.metadata_length);
+    visitor(kFields[1], self.arrows_length);
+    visitor(kFields[2], self.cubes_length);
+    visitor(kFields[3], self.spheres_length);
+    visitor(kFields[4], self.cylinders_length);
+    visitor(kFields[5], self.lines_length);
+    visitor(kFields[6], self.triangles_length);
+    visitor(kFields[7], self.texts_length);
+    visitor(kFields[8], self.models_length);
+    visitor(kFields[9], self.timestamp);
+    visitor(kFields[10], self.frame_id);
+    visitor(kFields[11], self.id);
+    visitor(kFields[12], self.lifetime);
+    visitor(kFields[13], self.frame_locked);
+    visitor(kFields[14], self.metadata);
+    visitor(kFields[15], self.arrows);
+    visitor(kFields[16], self.cubes);
+    visitor(kFields[17], self.spheres);
+    visitor(kFields[18], self.cylinders);
+    visitor(kFields[19], self.lines);
+    visitor(kFields[20], self.triangles);
+    visitor(kFields[21], self.texts);
+    visitor(kFields[22], self.models);
+}
+
 uint64_t SceneEntity::_computeHash(const __lcm_hash_ptr *p)
 {
     const __lcm_hash_ptr *fp;
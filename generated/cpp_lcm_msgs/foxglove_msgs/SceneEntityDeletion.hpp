@@ -1,7 +1,7 @@
 /** THIS IS AN AUTOMATICALLY GENERATED FILE.  DO NOT MODIFY
  * BY HAND!!
  *
- * Generated by lcm-gen 1.5.2
+ * Generated by lcm-cpp (tools/cpp/gen)
  **/
 
 #ifndef __foxglove_msgs_SceneEntityDeletion_hpp__
@@ -9,7 +9,11 @@
 
 #include <lcm/lcm_coretypes.h>
 
+#include <array>
 #include <string>
+#include "dimos_lcm/writer.hpp"
+#include "dimos_lcm/fingerprint.hpp"
+#include "dimos_lcm/reflection.hpp"
 #include "builtin_interfaces/Time.hpp"
 
 namespace foxglove_msgs
@@ -48,6 +52,15 @@ class SceneEntityDeletion
          */
         inline int encode(void *buf, int offset, int maxlen) const;
 
+        /**
+         * Encode a message by appending it to @p buf, walking the message once
+         * instead of sizing it with getEncodedSize() first. @p buf grows
+         * geometrically; reuse it across calls to avoid reallocating.
+         *
+         * @return The number of bytes appended.
+         */
+        inline int encodeTo(std::vector<uint8_t> &buf) const;
+
         /**
          * Check how many bytes are required to encode this message.
          */
@@ -63,6 +76,29 @@ class SceneEntityDeletion
          */
         inline int decode(const void *buf, int offset, int maxlen);
 
+        /**
+         * Field bits for decodeFields().
+         */
+        struct Fields
+        {
+            static constexpr uint64_t timestamp = 1ULL << 0;
+            static constexpr uint64_t type = 1ULL << 1;
+            static constexpr uint64_t id = 1ULL << 2;
+            static constexpr uint64_t all = (1ULL << 3) - 1;
+        };
+
+        /**
+         * Decode only the fields selected by @p Mask, a bitwise or of Fields
+         * values. Strings, arrays and nested structs that are not selected are
+         * skipped over by their length prefixes without being allocated, and
+         * keep their previous value. Scalar fields are always decoded: they
+         * cost nothing to read and array lengths depend on them.
+         *
+         * @return The number of bytes decoded, or <0 if an error occured.
+         */
+        template <uint64_t Mask>
+        inline int decodeFields(const void *buf, int offset, int maxlen);
+
         /**
          * Retrieve the 64-bit fingerprint identifying the structure of the message.
          * Note that the fingerprint is the same for all instances of the same
@@ -71,18 +107,49 @@ class SceneEntityDeletion
          */
         inline static int64_t getHash();
 
+        /**
+         * The fingerprint returned by getHash(), as a compile-time constant.
+         */
+        static constexpr int64_t kHash = static_cast<int64_t>(0xe65d27075d42081dULL);
+
         /**
          * Returns "SceneEntityDeletion"
          */
         inline static const char* getTypeName();
 
+        /**
+         * Name, LCM type and array dimensions of each field, in wire order.
+         * See dimos_lcm::for_each_field() for visiting the fields themselves.
+         */
+        static constexpr std::array<dimos_lcm::field_info, 3> kFields = {{
+            { "timestamp", "builtin_interfaces.Time", false, 0, 0, NULL },
+            { "type", "byte", true, 0, 0, NULL },
+            { "id", "string", true, 0, 0, NULL },
+        }};
+
         // LCM support functions. Users should not call these
         inline int _encodeNoHash(void *buf, int offset, int maxlen) const;
+        template <typename Writer>
+        inline void _writeNoHash(Writer &out) const;
         inline int _getEncodedSizeNoHash() const;
         inline int _decodeNoHash(const void *buf, int offset, int maxlen);
+        template <uint64_t Mask>
+        inline int _decodeFieldsNoHash(const void *buf, int offset, int maxlen);
+        template <typename Self, typename Visitor>
+        inline static void _forEachField(Self &self, Visitor &visitor);
+        inline static int _skipNoHash(const void *buf, int offset, int maxlen);
         inline static uint64_t _computeHash(const __lcm_hash_ptr *p);
 };
 
+static_assert(SceneEntityDeletion::kHash == dimos_lcm::fingerprint(
+    dimos_lcm::signature_hash()
+        .member("timestamp", NULL, 0)
+        .member("type", "byte", 0)
+        .member("id", "string", 0)
+        .value(),
+    builtin_interfaces::Time::kHash),
+    "foxglove_msgs::SceneEntityDeletion fingerprint does not match its definition");
+
 int SceneEntityDeletion::encode(void *buf, int offset, int maxlen) const
 {
     int pos = 0, tlen;
@@ -97,6 +164,15 @@ int SceneEntityDeletion::encode(void *buf, int offset, int maxlen) const
     return pos;
 }
 
+int SceneEntityDeletion::encodeTo(std::vector<uint8_t> &buf) const
+{
+    dimos_lcm::vector_writer out(buf);
+    int64_t hash = getHash();
+    out.put(&hash, 1);
+    this->_writeNoHash(out);
+    return static_cast<int>(out.size());
+}
+
 int SceneEntityDeletion::decode(const void *buf, int offset, int maxlen)
 {
     int pos = 0, thislen;
@@ -112,6 +188,22 @@ int SceneEntityDeletion::decode(const void *buf, int offset, int maxlen)
     return pos;
 }
 
+template <uint64_t Mask>
+int SceneEntityDeletion::decodeFields(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, thislen;
+
+    int64_t msg_hash;
+    thislen = __int64_t_decode_array(buf, offset + pos, maxlen - pos, &msg_hash, 1);
+    if (thislen < 0) return thislen; else pos += thislen;
+    if (msg_hash != getHash()) return -1;
+
+    thislen = this->_decodeFieldsNoHash<Mask>(buf, offset + pos, maxlen - pos);
+    if (thislen < 0) return thislen; else pos += thislen;
+
+    return pos;
+}
+
 int SceneEntityDeletion::getEncodedSize() const
 {
     return 8 + _getEncodedSizeNoHash();
@@ -119,8 +211,7 @@ int SceneEntityDeletion::getEncodedSize() const
 
 int64_t SceneEntityDeletion::getHash()
 {
-    static int64_t hash = static_cast<int64_t>(_computeHash(NULL));
-    return hash;
+    return kHash;
 }
 
 const char* SceneEntityDeletion::getTypeName()
@@ -146,6 +237,14 @@ int SceneEntityDeletion::_encodeNoHash(void *buf, int offset, int maxlen) const
     return pos;
 }
 
+template <typename Writer>
+void SceneEntityDeletion::_writeNoHash(Writer &out) const
+{
+    this->timestamp._writeNoHash(out);
+    out.put(&this->type, 1);
+    out.put(this->id);
+}
+
 int SceneEntityDeletion::_decodeNoHash(const void *buf, int offset, int maxlen)
 {
     int pos = 0, tlen;
@@ -160,7 +259,7 @@ int SceneEntityDeletion::_decodeNoHash(const void *buf, int offset, int maxlen)
     tlen = __int32_t_decode_array(
         buf, offset + pos, maxlen - pos, &__id_len__, 1);
     if(tlen < 0) return tlen; else pos += tlen;
-    if(__id_len__ > maxlen - pos) return -1;
+    if(__id_len__ < 1 || __id_len__ > maxlen - pos) return -1;
     this->id.assign(
         static_cast<const char*>(buf) + offset + pos, __id_len__ - 1);
     pos += __id_len__;
@@ -168,6 +267,42 @@ int SceneEntityDeletion::_decodeNoHash(const void *buf, int offset, int maxlen)
     return pos;
 }
 
+template <uint64_t Mask>
+int SceneEntityDeletion::_decodeFieldsNoHash(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, tlen;
+
+    if ((Mask & Fields::timestamp) != 0) {
+        tlen = this->timestamp._decodeNoHash(buf, offset + pos, maxlen - pos);
+        if(tlen < 0) return tlen; else pos += tlen;
+    } else {
+        tlen = builtin_interfaces::Time::_skipNoHash(buf, offset + pos, maxlen - pos);
+        if(tlen < 0) return tlen; else pos += tlen;
+    }
+
+    tlen = __byte_decode_array(buf, offset + pos, maxlen - pos, &this->type, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    if ((Mask & Fields::id) != 0) {
+        int32_t __id_len__;
+        tlen = __int32_t_decode_array(
+            buf, offset + pos, maxlen - pos, &__id_len__, 1);
+        if(tlen < 0) return tlen; else pos += tlen;
+        if(__id_len__ < 1 || __id_len__ > maxlen - pos) return -1;
+        this->id.assign(
+            static_cast<const char*>(buf) + offset + pos, __id_len__ - 1);
+        pos += __id_len__;
+    } else {
+        int32_t __id_len__;
+        tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &__id_len__, 1);
+        if(tlen < 0) return tlen; else pos += tlen;
+        if(__id_len__ < 0 || __id_len__ > maxlen - pos) return -1;
+        pos += __id_len__;
+    }
+
+    return pos;
+}
+
 int SceneEntityDeletion::_getEncodedSizeNoHash() const
 {
     int enc_size = 0;
@@ -177,6 +312,29 @@ int SceneEntityDeletion::_getEncodedSizeNoHash() const
     return enc_size;
 }
 
+int SceneEntityDeletion::_skipNoHash(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, tlen;
+    tlen = builtin_interfaces::Time::_skipNoHash(buf, offset + pos, maxlen - pos);
+    if(tlen < 0) return tlen; else pos += tlen;
+    pos += 1;
+    int32_t __id_len__;
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &__id_len__, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+    if(__id_len__ < 0 || __id_len__ > maxlen - pos) return -1;
+    pos += __id_len__;
+    if(pos > maxlen) return -1;
+    return pos;
+}
+
+template <typename Self, typename Visitor>
+void SceneEntityDeletion::_forEachField(Self &self, Visitor &visitor)
+{
+    visitor(kFields[0], self.timestamp);
+    visitor(kFields[1], self.type);
+    visitor(kFields[2], self.id);
+}
+
 uint64_t SceneEntityDeletion::_computeHash(const __lcm_hash_ptr *p)
 {
     const __lcm_hash_ptr *fp;
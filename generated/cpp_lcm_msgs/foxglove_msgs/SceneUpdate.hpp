@@ -1,7 +1,7 @@
 /** THIS IS AN AUTOMATICALLY GENERATED FILE.  DO NOT MODIFY
  * BY HAND!!
  *
- * Generated by lcm-gen 1.5.2
+ * Generated by lcm-cpp (tools/cpp/gen)
  **/
 
 #ifndef __foxglove_msgs_SceneUpdate_hpp__
@@ -9,7 +9,12 @@
 
 #include <lcm/lcm_coretypes.h>
 
+#include <array>
 #include <vector>
+#include "dimos_lcm/iov_writer.hpp"
+#include "dimos_lcm/wire_builder.hpp"
+#include "dimos_lcm/fingerprint.hpp"
+#include "dimos_lcm/reflection.hpp"
 #include "foxglove_msgs/SceneEntityDeletion.hpp"
 #include "foxglove_msgs/SceneEntity.hpp"
 
@@ -45,6 +50,37 @@ class SceneUpdate
          */
         inline int encode(void *buf, int offset, int maxlen) const;
 
+        /**
+         * Encode a message by appending it to @p buf, walking the message once
+         * instead of sizing it with getEncodedSize() first. @p buf grows
+         * geometrically; reuse it across calls to avoid reallocating.
+         *
+         * @return The number of bytes appended.
+         */
+        inline int encodeTo(std::vector<uint8_t> &buf) const;
+
+        /**
+         * Encode a message as a list of buffers for writev()/sendmsg(). Byte
+         * payloads are referenced in place instead of copied; see
+         * dimos_lcm/iov_writer.hpp for how long they must stay valid.
+         *
+         * @param out Receives the encoded message after anything it already holds.
+         * @return The number of bytes encoded.
+         */
+        inline int encodeIov(dimos_lcm::iov_writer &out) const;
+
+        /**
+         * Encode a message into the buffer of @p out, leaving a gap at the
+         * place of each byte payload for the caller to fill; see
+         * dimos_lcm/wire_builder.hpp. The payload arrays are not read: set
+         * their length fields, and leave the arrays empty to skip filling them
+         * twice.
+         *
+         * @param out Receives the encoded message after anything it already holds.
+         * @return The number of bytes encoded, or <0 if they do not fit.
+         */
+        inline int encodeInPlace(dimos_lcm::wire_builder &out) const;
+
         /**
          * Check how many bytes are required to encode this message.
          */
@@ -60,6 +96,43 @@ class SceneUpdate
          */
         inline int decode(const void *buf, int offset, int maxlen);
 
+        /**
+         * Field bits for decodeFields().
+         */
+        struct Fields
+        {
+            static constexpr uint64_t deletions_length = 1ULL << 0;
+            static constexpr uint64_t entities_length = 1ULL << 1;
+            static constexpr uint64_t deletions = 1ULL << 2;
+            static constexpr uint64_t entities = 1ULL << 3;
+            static constexpr uint64_t all = (1ULL << 4) - 1;
+        };
+
+        /**
+         * Decode only the fields selected by @p Mask, a bitwise or of Fields
+         * values. Strings, arrays and nested structs that are not selected are
+         * skipped over by their length prefixes without being allocated, and
+         * keep their previous value. Scalar fields are always decoded: they
+         * cost nothing to read and array lengths depend on them.
+         *
+         * @return The number of bytes decoded, or <0 if an error occured.
+         */
+        template <uint64_t Mask>
+        inline int decodeFields(const void *buf, int offset, int maxlen);
+
+        /**
+         * Upper bound on the length of every variable-length array of this
+         * type, checked by decode() before anything is allocated; messages
+         * exceeding it fail to decode. It does not apply to nested types,
+         * which have their own. Set it once at startup, before decoding.
+         * Before C++17 it is a constant with no limit.
+         */
+#if __cplusplus >= 201703L
+        static inline int32_t maxArrayLength = INT32_MAX;
+#else
+        static constexpr int32_t maxArrayLength = INT32_MAX;
+#endif
+
         /**
          * Retrieve the 64-bit fingerprint identifying the structure of the message.
          * Note that the fingerprint is the same for all instances of the same
@@ -68,18 +141,52 @@ class SceneUpdate
          */
         inline static int64_t getHash();
 
+        /**
+         * The fingerprint returned by getHash(), as a compile-time constant.
+         */
+        static constexpr int64_t kHash = static_cast<int64_t>(0xca7f96a960fb8521ULL);
+
         /**
          * Returns "SceneUpdate"
          */
         inline static const char* getTypeName();
 
+        /**
+         * Name, LCM type and array dimensions of each field, in wire order.
+         * See dimos_lcm::for_each_field() for visiting the fields themselves.
+         */
+        static constexpr std::array<dimos_lcm::field_info, 4> kFields = {{
+            { "deletions_length", "int32_t", true, 0, 0, NULL },
+            { "entities_length", "int32_t", true, 0, 0, NULL },
+            { "deletions", "foxglove_msgs.SceneEntityDeletion", false, 1, -1, "deletions_length" },
+            { "entities", "foxglove_msgs.SceneEntity", false, 1, -1, "entities_length" },
+        }};
+
         // LCM support functions. Users should not call these
         inline int _encodeNoHash(void *buf, int offset, int maxlen) const;
+        template <typename Writer>
+        inline void _writeNoHash(Writer &out) const;
         inline int _getEncodedSizeNoHash() const;
         inline int _decodeNoHash(const void *buf, int offset, int maxlen);
+        template <uint64_t Mask>
+        inline int _decodeFieldsNoHash(const void *buf, int offset, int maxlen);
+        template <typename Self, typename Visitor>
+        inline static void _forEachField(Self &self, Visitor &visitor);
+        inline static int _skipNoHash(const void *buf, int offset, int maxlen);
         inline static uint64_t _computeHash(const __lcm_hash_ptr *p);
 };
 
+static_assert(SceneUpdate::kHash == dimos_lcm::fingerprint(
+    dimos_lcm::signature_hash()
+        .member("deletions_length", "int32_t", 0)
+        .member("entities_length", "int32_t", 0)
+        .member("deletions", NULL, 1).dim(true, "deletions_length")
+        .member("entities", NULL, 1).dim(true, "entities_length")
+        .value(),
+    foxglove_msgs::SceneEntityDeletion::kHash,
+    foxglove_msgs::SceneEntity::kHash),
+    "foxglove_msgs::SceneUpdate fingerprint does not match its definition");
+
 int SceneUpdate::encode(void *buf, int offset, int maxlen) const
 {
     int pos = 0, tlen;
@@ -94,6 +201,35 @@ int SceneUpdate::encode(void *buf, int offset, int maxlen) const
     return pos;
 }
 
+int SceneUpdate::encodeTo(std::vector<uint8_t> &buf) const
+{
+    dimos_lcm::vector_writer out(buf);
+    int64_t hash = getHash();
+    out.put(&hash, 1);
+    this->_writeNoHash(out);
+    return static_cast<int>(out.size());
+}
+
+int SceneUpdate::encodeIov(dimos_lcm::iov_writer &out) const
+{
+    size_t start = out.size();
+    int64_t hash = getHash();
+    out.put(&hash, 1);
+    this->_writeNoHash(out);
+    return static_cast<int>(out.size() - start);
+}
+
+int SceneUpdate::encodeInPlace(dimos_lcm::wire_builder &out) const
+{
+    int size = getEncodedSize();
+    if (static_cast<size_t>(size) > out.remaining())
+        return -1;
+    int64_t hash = getHash();
+    out.put(&hash, 1);
+    this->_writeNoHash(out);
+    return size;
+}
+
 int SceneUpdate::decode(const void *buf, int offset, int maxlen)
 {
     int pos = 0, thislen;
@@ -109,6 +245,22 @@ int SceneUpdate::decode(const void *buf, int offset, int maxlen)
     return pos;
 }
 
+template <uint64_t Mask>
+int SceneUpdate::decodeFields(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, thislen;
+
+    int64_t msg_hash;
+    thislen = __int64_t_decode_array(buf, offset + pos, maxlen - pos, &msg_hash, 1);
+    if (thislen < 0) return thislen; else pos += thislen;
+    if (msg_hash != getHash()) return -1;
+
+    thislen = this->_decodeFieldsNoHash<Mask>(buf, offset + pos, maxlen - pos);
+    if (thislen < 0) return thislen; else pos += thislen;
+
+    return pos;
+}
+
 int SceneUpdate::getEncodedSize() const
 {
     return 8 + _getEncodedSizeNoHash();
@@ -116,8 +268,7 @@ int SceneUpdate::getEncodedSize() const
 
 int64_t SceneUpdate::getHash()
 {
-    static int64_t hash = static_cast<int64_t>(_computeHash(NULL));
-    return hash;
+    return kHash;
 }
 
 const char* SceneUpdate::getTypeName()
@@ -148,6 +299,17 @@ int SceneUpdate::_encodeNoHash(void *buf, int offset, int maxlen) const
     return pos;
 }
 
+template <typename Writer>
+void SceneUpdate::_writeNoHash(Writer &out) const
+{
+    out.put(&this->deletions_length, 1);
+    out.put(&this->entities_length, 1);
+    for (int a0 = 0; a0 < this->deletions_length; a0++)
+        this->deletions[a0]._writeNoHash(out);
+    for (int a0 = 0; a0 < this->entities_length; a0++)
+        this->entities[a0]._writeNoHash(out);
+}
+
 int SceneUpdate::_decodeNoHash(const void *buf, int offset, int maxlen)
 {
     int pos = 0, tlen;
@@ -158,6 +320,7 @@ int SceneUpdate::_decodeNoHash(const void *buf, int offset, int maxlen)
     tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &this->entities_length, 1);
     if(tlen < 0) return tlen; else pos += tlen;
 
+    if(this->deletions_length < 0 || this->deletions_length > (maxlen - pos) / 14 || this->deletions_length > maxArrayLength) return -1;
     try {
         this->deletions.resize(this->deletions_length);
     } catch (...) {
@@ -168,6 +331,7 @@ int SceneUpdate::_decodeNoHash(const void *buf, int offset, int maxlen)
         if(tlen < 0) return tlen; else pos += tlen;
     }
 
+    if(this->entities_length < 0 || this->entities_length > (maxlen - pos) / 63 || this->entities_length > maxArrayLength) return -1;
     try {
         this->entities.resize(this->entities_length);
     } catch (...) {
@@ -181,6 +345,58 @@ int SceneUpdate::_decodeNoHash(const void *buf, int offset, int maxlen)
     return pos;
 }
 
+template <uint64_t Mask>
+int SceneUpdate::_decodeFieldsNoHash(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, tlen;
+
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &this->deletions_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &this->entities_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    if ((Mask & Fields::deletions) != 0) {
+        if(this->deletions_length < 0 || this->deletions_length > (maxlen - pos) / 14 || this->deletions_length > maxArrayLength) return -1;
+        try {
+            this->deletions.resize(this->deletions_length);
+        } catch (...) {
+            return -1;
+        }
+        for (int a0 = 0; a0 < this->deletions_length; a0++) {
+            tlen = this->deletions[a0]._decodeNoHash(buf, offset + pos, maxlen - pos);
+            if(tlen < 0) return tlen; else pos += tlen;
+        }
+    } else {
+        if(this->deletions_length < 0) return -1;
+        for (int a0 = 0; a0 < this->deletions_length; a0++) {
+            tlen = foxglove_msgs::SceneEntityDeletion::_skipNoHash(buf, offset + pos, maxlen - pos);
+            if(tlen < 0) return tlen; else pos += tlen;
+        }
+    }
+
+    if ((Mask & Fields::entities) != 0) {
+        if(this->entities_length < 0 || this->entities_length > (maxlen - pos) / 63 || this->entities_length > maxArrayLength) return -1;
+        try {
+            this->entities.resize(this->entities_length);
+        } catch (...) {
+            return -1;
+        }
+        for (int a0 = 0; a0 < this->entities_length; a0++) {
+            tlen = this->entities[a0]._decodeNoHash(buf, offset + pos, maxlen - pos);
+            if(tlen < 0) return tlen; else pos += tlen;
+        }
+    } else {
+        if(this->entities_length < 0) return -1;
+        for (int a0 = 0; a0 < this->entities_length; a0++) {
+            tlen = foxglove_msgs::SceneEntity::_skipNoHash(buf, offset + pos, maxlen - pos);
+            if(tlen < 0) return tlen; else pos += tlen;
+        }
+    }
+
+    return pos;
+}
+
 int SceneUpdate::_getEncodedSizeNoHash() const
 {
     int enc_size = 0;
@@ -195,6 +411,38 @@ int SceneUpdate::_getEncodedSizeNoHash() const
     return enc_size;
 }
 
+int SceneUpdate::_skipNoHash(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, tlen;
+    int32_t deletions_length;
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &deletions_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+    int32_t entities_length;
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &entities_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+    if(deletions_length < 0) return -1;
+    for (int a0 = 0; a0 < deletions_length; a0++) {
+        tlen = foxglove_msgs::SceneEntityDeletion::_skipNoHash(buf, offset + pos, maxlen - pos);
+        if(tlen < 0) return tlen; else pos += tlen;
+    }
+    if(entities_length < 0) return -1;
+    for (int a0 = 0; a0 < entities_length; a0++) {
+        tlen = foxglove_msgs::SceneEntity::_skipNoHash(buf, offset + pos, maxlen - pos);
+        if(tlen < 0) return tlen; else pos += tlen;
+    }
+    if(pos > maxlen) return -1;
+    return pos;
+}
+
+template <typename Self, typename Visitor>
+void SceneUpdate::_forEachField(Self &self, Visitor &visitor)
+{
+    visitor(kFields[0], self.deletions_length);
+    visitor(kFields[1], self.entities_length);
+    visitor(kFields[2], self.deletions);
+    visitor(kFields[3], self.entities);
+}
+
 uint64_t SceneUpdate::_computeHash(const __lcm_hash_ptr *p)
 {
     const __lcm_hash_ptr *fp;
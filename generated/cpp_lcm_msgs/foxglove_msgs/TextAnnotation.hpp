@@ -1,7 +1,7 @@
 /** THIS IS AN AUTOMATICALLY GENERATED FILE.  DO NOT MODIFY
  * BY HAND!!
  *
- * Generated by lcm-gen 1.5.2
+ * Generated by lcm-cpp (tools/cpp/gen)
  **/
 
 #ifndef __foxglove_msgs_TextAnnotation_hpp__
@@ -9,11 +9,14 @@
 
 #include <lcm/lcm_coretypes.h>
 
+#include <array>
 #include <string>
+#include "dimos_lcm/writer.hpp"
+#include "dimos_lcm/fingerprint.hpp"
+#include "dimos_lcm/reflection.hpp"
 #include "builtin_interfaces/Time.hpp"
 #include "foxglove_msgs/Point2.hpp"
 #include "foxglove_msgs/Color.hpp"
-#include "foxglove_msgs/Color.hpp"
 
 namespace foxglove_msgs
 {
@@ -45,6 +48,15 @@ class TextAnnotation
          */
         inline int encode(void *buf, int offset, int maxlen) const;
 
+        /**
+         * Encode a message by appending it to @p buf, walking the message once
+         * instead of sizing it with getEncodedSize() first. @p buf grows
+         * geometrically; reuse it across calls to avoid reallocating.
+         *
+         * @return The number of bytes appended.
+         */
+        inline int encodeTo(std::vector<uint8_t> &buf) const;
+
         /**
          * Check how many bytes are required to encode this message.
          */
@@ -60,6 +72,32 @@ class TextAnnotation
          */
         inline int decode(const void *buf, int offset, int maxlen);
 
+        /**
+         * Field bits for decodeFields().
+         */
+        struct Fields
+        {
+            static constexpr uint64_t timestamp = 1ULL << 0;
+            static constexpr uint64_t position = 1ULL << 1;
+            static constexpr uint64_t text = 1ULL << 2;
+            static constexpr uint64_t font_size = 1ULL << 3;
+            static constexpr uint64_t text_color = 1ULL << 4;
+            static constexpr uint64_t background_color = 1ULL << 5;
+            static constexpr uint64_t all = (1ULL << 6) - 1;
+        };
+
+        /**
+         * Decode only the fields selected by @p Mask, a bitwise or of Fields
+         * values. Strings, arrays and nested structs that are not selected are
+         * skipped over by their length prefixes without being allocated, and
+         * keep their previous value. Scalar fields are always decoded: they
+         * cost nothing to read and array lengths depend on them.
+         *
+         * @return The number of bytes decoded, or <0 if an error occured.
+         */
+        template <uint64_t Mask>
+        inline int decodeFields(const void *buf, int offset, int maxlen);
+
         /**
          * Retrieve the 64-bit fingerprint identifying the structure of the message.
          * Note that the fingerprint is the same for all instances of the same
@@ -68,18 +106,58 @@ class TextAnnotation
          */
         inline static int64_t getHash();
 
+        /**
+         * The fingerprint returned by getHash(), as a compile-time constant.
+         */
+        static constexpr int64_t kHash = static_cast<int64_t>(0xd5153b6ab4a40580ULL);
+
         /**
          * Returns "TextAnnotation"
          */
         inline static const char* getTypeName();
 
+        /**
+         * Name, LCM type and array dimensions of each field, in wire order.
+         * See dimos_lcm::for_each_field() for visiting the fields themselves.
+         */
+        static constexpr std::array<dimos_lcm::field_info, 6> kFields = {{
+            { "timestamp", "builtin_interfaces.Time", false, 0, 0, NULL },
+            { "position", "foxglove_msgs.Point2", false, 0, 0, NULL },
+            { "text", "string", true, 0, 0, NULL },
+            { "font_size", "double", true, 0, 0, NULL },
+            { "text_color", "foxglove_msgs.Color", false, 0, 0, NULL },
+            { "background_color", "foxglove_msgs.Color", false, 0, 0, NULL },
+        }};
+
         // LCM support functions. Users should not call these
         inline int _encodeNoHash(void *buf, int offset, int maxlen) const;
+        template <typename Writer>
+        inline void _writeNoHash(Writer &out) const;
         inline int _getEncodedSizeNoHash() const;
         inline int _decodeNoHash(const void *buf, int offset, int maxlen);
+        template <uint64_t Mask>
+        inline int _decodeFieldsNoHash(const void *buf, int offset, int maxlen);
+        template <typename Self, typename Visitor>
+        inline static void _forEachField(Self &self, Visitor &visitor);
+        inline static int _skipNoHash(const void *buf, int offset, int maxlen);
         inline static uint64_t _computeHash(const __lcm_hash_ptr *p);
 };
 
+static_assert(TextAnnotation::kHash == dimos_lcm::fingerprint(
+    dimos_lcm::signature_hash()
+        .member("timestamp", NULL, 0)
+        .member("position", NULL, 0)
+        .member("text", "string", 0)
+        .member("font_size", "double", 0)
+        .member("text_color", NULL, 0)
+        .member("background_color", NULL, 0)
+        .value(),
+    builtin_interfaces::Time::kHash,
+    foxglove_msgs::Point2::kHash,
+    foxglove_msgs::Color::kHash,
+    foxglove_msgs::Color::kHash),
+    "foxglove_msgs::TextAnnotation fingerprint does not match its definition");
+
 int TextAnnotation::encode(void *buf, int offset, int maxlen) const
 {
     int pos = 0, tlen;
@@ -94,6 +172,15 @@ int TextAnnotation::encode(void *buf, int offset, int maxlen) const
     return pos;
 }
 
+int TextAnnotation::encodeTo(std::vector<uint8_t> &buf) const
+{
+    dimos_lcm::vector_writer out(buf);
+    int64_t hash = getHash();
+    out.put(&hash, 1);
+    this->_writeNoHash(out);
+    return static_cast<int>(out.size());
+}
+
 int TextAnnotation::decode(const void *buf, int offset, int maxlen)
 {
     int pos = 0, thislen;
@@ -109,6 +196,22 @@ int TextAnnotation::decode(const void *buf, int offset, int maxlen)
     return pos;
 }
 
+template <uint64_t Mask>
+int TextAnnotation::decodeFields(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, thislen;
+
+    int64_t msg_hash;
+    thislen = __int64_t_decode_array(buf, offset + pos, maxlen - pos, &msg_hash, 1);
+    if (thislen < 0) return thislen; else pos += thislen;
+    if (msg_hash != getHash()) return -1;
+
+    thislen = this->_decodeFieldsNoHash<Mask>(buf, offset + pos, maxlen - pos);
+    if (thislen < 0) return thislen; else pos += thislen;
+
+    return pos;
+}
+
 int TextAnnotation::getEncodedSize() const
 {
     return 8 + _getEncodedSizeNoHash();
@@ -116,8 +219,7 @@ int TextAnnotation::getEncodedSize() const
 
 int64_t TextAnnotation::getHash()
 {
-    static int64_t hash = static_cast<int64_t>(_computeHash(NULL));
-    return hash;
+    return kHash;
 }
 
 const char* TextAnnotation::getTypeName()
@@ -152,6 +254,17 @@ int TextAnnotation::_encodeNoHash(void *buf, int offset, int maxlen) const
     return pos;
 }
 
+template <typename Writer>
+void TextAnnotation::_writeNoHash(Writer &out) const
+{
+    this->timestamp._writeNoHash(out);
+    this->position._writeNoHash(out);
+    out.put(this->text);
+    out.put(&this->font_size, 1);
+    this->text_color._writeNoHash(out);
+    this->background_color._writeNoHash(out);
+}
+
 int TextAnnotation::_decodeNoHash(const void *buf, int offset, int maxlen)
 {
     int pos = 0, tlen;
@@ -166,7 +279,7 @@ int TextAnnotation::_decodeNoHash(const void *buf, int offset, int maxlen)
     tlen = __int32_t_decode_array(
         buf, offset + pos, maxlen - pos, &__text_len__, 1);
     if(tlen < 0) return tlen; else pos += tlen;
-    if(__text_len__ > maxlen - pos) return -1;
+    if(__text_len__ < 1 || __text_len__ > maxlen - pos) return -1;
     this->text.assign(
         static_cast<const char*>(buf) + offset + pos, __text_len__ - 1);
     pos += __text_len__;
@@ -183,6 +296,66 @@ int TextAnnotation::_decodeNoHash(const void *buf, int offset, int maxlen)
     return pos;
 }
 
+template <uint64_t Mask>
+int TextAnnotation::_decodeFieldsNoHash(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, tlen;
+
+    if ((Mask & Fields::timestamp) != 0) {
+        tlen = this->timestamp._decodeNoHash(buf, offset + pos, maxlen - pos);
+        if(tlen < 0) return tlen; else pos += tlen;
+    } else {
+        tlen = builtin_interfaces::Time::_skipNoHash(buf, offset + pos, maxlen - pos);
+        if(tlen < 0) return tlen; else pos += tlen;
+    }
+
+    if ((Mask & Fields::position) != 0) {
+        tlen = this->position._decodeNoHash(buf, offset + pos, maxlen - pos);
+        if(tlen < 0) return tlen; else pos += tlen;
+    } else {
+        tlen = foxglove_msgs::Point2::_skipNoHash(buf, offset + pos, maxlen - pos);
+        if(tlen < 0) return tlen; else pos += tlen;
+    }
+
+    if ((Mask & Fields::text) != 0) {
+        int32_t __text_len__;
+        tlen = __int32_t_decode_array(
+            buf, offset + pos, maxlen - pos, &__text_len__, 1);
+        if(tlen < 0) return tlen; else pos += tlen;
+        if(__text_len__ < 1 || __text_len__ > maxlen - pos) return -1;
+        this->text.assign(
+            static_cast<const char*>(buf) + offset + pos, __text_len__ - 1);
+        pos += __text_len__;
+    } else {
+        int32_t __text_len__;
+        tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &__text_len__, 1);
+        if(tlen < 0) return tlen; else pos += tlen;
+        if(__text_len__ < 0 || __text_len__ > maxlen - pos) return -1;
+        pos += __text_len__;
+    }
+
+    tlen = __double_decode_array(buf, offset + pos, maxlen - pos, &this->font_size, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    if ((Mask & Fields::text_color) != 0) {
+        tlen = this->text_color._decodeNoHash(buf, offset + pos, maxlen - pos);
+        if(tlen < 0) return tlen; else pos += tlen;
+    } else {
+        tlen = foxglove_msgs::Color::_skipNoHash(buf, offset + pos, maxlen - pos);
+        if(tlen < 0) return tlen; else pos += tlen;
+    }
+
+    if ((Mask & Fields::background_color) != 0) {
+        tlen = this->background_color._decodeNoHash(buf, offset + pos, maxlen - pos);
+        if(tlen < 0) return tlen; else pos += tlen;
+    } else {
+        tlen = foxglove_msgs::Color::_skipNoHash(buf, offset + pos, maxlen - pos);
+        if(tlen < 0) return tlen; else pos += tlen;
+    }
+
+    return pos;
+}
+
 int TextAnnotation::_getEncodedSizeNoHash() const
 {
     int enc_size = 0;
@@ -195,6 +368,38 @@ int TextAnnotation::_getEncodedSizeNoHash() const
     return enc_size;
 }
 
+int TextAnnotation::_skipNoHash(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, tlen;
+    tlen = builtin_interfaces::Time::_skipNoHash(buf, offset + pos, maxlen - pos);
+    if(tlen < 0) return tlen; else pos += tlen;
+    tlen = foxglove_msgs::Point2::_skipNoHash(buf, offset + pos, maxlen - pos);
+    if(tlen < 0) return tlen; else pos += tlen;
+    int32_t __text_len__;
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &__text_len__, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+    if(__text_len__ < 0 || __text_len__ > maxlen - pos) return -1;
+    pos += __text_len__;
+    pos += 8;
+    tlen = foxglove_msgs::Color::_skipNoHash(buf, offset + pos, maxlen - pos);
+    if(tlen < 0) return tlen; else pos += tlen;
+    tlen = foxglove_msgs::Color::_skipNoHash(buf, offset + pos, maxlen - pos);
+    if(tlen < 0) return tlen; else pos += tlen;
+    if(pos > maxlen) return -1;
+    return pos;
+}
+
+template <typename Self, typename Visitor>
+void TextAnnotation::_forEachField(Self &self, Visitor &visitor)
+{
+    visitor(kFields[0], self.timestamp);
+    visitor(kFields[1], self.position);
+    visitor(kFields[2], self.text);
+    visitor(kFields[3], self.font_size);
+    visitor(kFields[4], self.text_color);
+    visitor(kFields[5], self.background_color);
+}
+
 uint64_t TextAnnotation::_computeHash(const __lcm_hash_ptr *p)
 {
     const __lcm_hash_ptr *fp;
@@ -0,0 +1,262 @@
+/** THIS IS AN AUTOMATICALLY GENERATED FILE.  DO NOT MODIFY
+ * BY HAND!!
+ *
+ * Generated by lcm-cpp (tools/cpp/gen)
+ **/
+
+#ifndef __foxglove_msgs_TextAnnotationColumns_hpp__
+#define __foxglove_msgs_TextAnnotationColumns_hpp__
+
+#include <lcm/lcm_coretypes.h>
+
+#include <string>
+#include <vector>
+#include "dimos_lcm/fixed_codec.hpp"
+#include "foxglove_msgs/TextAnnotation.hpp"
+
+namespace foxglove_msgs
+{
+
+/**
+ * Structure-of-arrays storage for a sequence of foxglove_msgs.TextAnnotation: one
+ * contiguous array per field, with nested fields flattened and named by their
+ * path (timestamp_sec, timestamp_nanosec, ...). The soa:: message classes hold their
+ * TextAnnotation arrays this way and decode them straight into the columns.
+ */
+class TextAnnotationColumns
+{
+    public:
+        // timestamp.sec
+        std::vector< int32_t > timestamp_sec;
+
+        // timestamp.nanosec
+        std::vector< int32_t > timestamp_nanosec;
+
+        // position.x
+        std::vector< double > position_x;
+
+        // position.y
+        std::vector< double > position_y;
+
+        std::vector< std::string > text;
+
+        std::vector< double > font_size;
+
+        // text_color.r
+        std::vector< double > text_color_r;
+
+        // text_color.g
+        std::vector< double > text_color_g;
+
+        // text_color.b
+        std::vector< double > text_color_b;
+
+        // text_color.a
+        std::vector< double > text_color_a;
+
+        // background_color.r
+        std::vector< double > background_color_r;
+
+        // background_color.g
+        std::vector< double > background_color_g;
+
+        // background_color.b
+        std::vector< double > background_color_b;
+
+        // background_color.a
+        std::vector< double > background_color_a;
+
+    public:
+        /**
+         * Number of elements.
+         */
+        inline int size() const;
+
+        /**
+         * Resize every column to @p n elements.
+         */
+        inline void resize(int n);
+
+        /**
+         * Gather element @p i into a TextAnnotation.
+         */
+        inline foxglove_msgs::TextAnnotation get(int i) const;
+
+        /**
+         * Scatter @p msg into element @p i.
+         */
+        inline void set(int i, const foxglove_msgs::TextAnnotation &msg);
+
+        // LCM support functions. Users should not call these
+        inline int _encodeNoHash(void *buf, int offset, int maxlen, int n) const;
+        template <typename Writer>
+        inline void _writeNoHash(Writer &out, int n) const;
+        inline int _getEncodedSizeNoHash(int n) const;
+        inline int _decodeNoHash(const void *buf, int offset, int maxlen, int n);
+};
+
+int TextAnnotationColumns::size() const
+{
+    return static_cast<int>(this->timestamp_sec.size());
+}
+
+void TextAnnotationColumns::resize(int n)
+{
+    this->timestamp_sec.resize(n);
+    this->timestamp_nanosec.resize(n);
+    this->position_x.resize(n);
+    this->position_y.resize(n);
+    this->text.resize(n);
+    this->font_size.resize(n);
+    this->text_color_r.resize(n);
+    this->text_color_g.resize(n);
+    this->text_color_b.resize(n);
+    this->text_color_a.resize(n);
+    this->background_color_r.resize(n);
+    this->background_color_g.resize(n);
+    this->background_color_b.resize(n);
+    this->background_color_a.resize(n);
+}
+
+foxglove_msgs::TextAnnotation TextAnnotationColumns::get(int i) const
+{
+    foxglove_msgs::TextAnnotation msg;
+    msg.timestamp.sec = this->timestamp_sec[i];
+    msg.timestamp.nanosec = this->timestamp_nanosec[i];
+    msg.position.x = this->position_x[i];
+    msg.position.y = this->position_y[i];
+    msg.text = this->text[i];
+    msg.font_size = this->font_size[i];
+    msg.text_color.r = this->text_color_r[i];
+    msg.text_color.g = this->text_color_g[i];
+    msg.text_color.b = this->text_color_b[i];
+    msg.text_color.a = this->text_color_a[i];
+    msg.background_color.r = this->background_color_r[i];
+    msg.background_color.g = this->background_color_g[i];
+    msg.background_color.b = this->background_color_b[i];
+    msg.background_color.a = this->background_color_a[i];
+    return msg;
+}
+
+void TextAnnotationColumns::set(int i, const foxglove_msgs::TextAnnotation &msg)
+{
+    this->timestamp_sec[i] = msg.timestamp.sec;
+    this->timestamp_nanosec[i] = msg.timestamp.nanosec;
+    this->position_x[i] = msg.position.x;
+    this->position_y[i] = msg.position.y;
+    this->text[i] = msg.text;
+    this->font_size[i] = msg.font_size;
+    this->text_color_r[i] = msg.text_color.r;
+    this->text_color_g[i] = msg.text_color.g;
+    this->text_color_b[i] = msg.text_color.b;
+    this->text_color_a[i] = msg.text_color.a;
+    this->background_color_r[i] = msg.background_color.r;
+    this->background_color_g[i] = msg.background_color.g;
+    this->background_color_b[i] = msg.background_color.b;
+    this->background_color_a[i] = msg.background_color.a;
+}
+
+int TextAnnotationColumns::_encodeNoHash(void *buf, int offset, int maxlen, int n) const
+{
+    uint8_t *p = static_cast<uint8_t*>(buf) + offset;
+    int pos = 0;
+    for (int i = 0; i < n; i++) {
+        if(maxlen - pos < 24) return -1;
+        dimos_lcm::store_be(p + pos + 0, this->timestamp_sec[i]);
+        dimos_lcm::store_be(p + pos + 4, this->timestamp_nanosec[i]);
+        dimos_lcm::store_be(p + pos + 8, this->position_x[i]);
+        dimos_lcm::store_be(p + pos + 16, this->position_y[i]);
+        pos += 24;
+        int32_t __text_len__ = static_cast<int32_t>(this->text[i].size()) + 1;
+        if(maxlen - pos < 4 || __text_len__ > maxlen - pos - 4) return -1;
+        dimos_lcm::store_be(p + pos, __text_len__);
+        memcpy(p + pos + 4, this->text[i].c_str(), __text_len__);
+        pos += 4 + __text_len__;
+        if(maxlen - pos < 72) return -1;
+        dimos_lcm::store_be(p + pos + 0, this->font_size[i]);
+        dimos_lcm::store_be(p + pos + 8, this->text_color_r[i]);
+        dimos_lcm::store_be(p + pos + 16, this->text_color_g[i]);
+        dimos_lcm::store_be(p + pos + 24, this->text_color_b[i]);
+        dimos_lcm::store_be(p + pos + 32, this->text_color_a[i]);
+        dimos_lcm::store_be(p + pos + 40, this->background_color_r[i]);
+        dimos_lcm::store_be(p + pos + 48, this->background_color_g[i]);
+        dimos_lcm::store_be(p + pos + 56, this->background_color_b[i]);
+        dimos_lcm::store_be(p + pos + 64, this->background_color_a[i]);
+        pos += 72;
+    }
+    return pos;
+}
+
+template <typename Writer>
+void TextAnnotationColumns::_writeNoHash(Writer &out, int n) const
+{
+    for (int i = 0; i < n; i++) {
+        {
+            uint8_t *p = out.extend(24);
+            dimos_lcm::store_be(p + 0, this->timestamp_sec[i]);
+            dimos_lcm::store_be(p + 4, this->timestamp_nanosec[i]);
+            dimos_lcm::store_be(p + 8, this->position_x[i]);
+            dimos_lcm::store_be(p + 16, this->position_y[i]);
+        }
+        out.put(this->text[i]);
+        {
+            uint8_t *p = out.extend(72);
+            dimos_lcm::store_be(p + 0, this->font_size[i]);
+            dimos_lcm::store_be(p + 8, this->text_color_r[i]);
+            dimos_lcm::store_be(p + 16, this->text_color_g[i]);
+            dimos_lcm::store_be(p + 24, this->text_color_b[i]);
+            dimos_lcm::store_be(p + 32, this->text_color_a[i]);
+            dimos_lcm::store_be(p + 40, this->background_color_r[i]);
+            dimos_lcm::store_be(p + 48, this->background_color_g[i]);
+            dimos_lcm::store_be(p + 56, this->background_color_b[i]);
+            dimos_lcm::store_be(p + 64, this->background_color_a[i]);
+        }
+    }
+}
+
+int TextAnnotationColumns::_getEncodedSizeNoHash(int n) const
+{
+    int size = n * 101;
+    for (int i = 0; i < n; i++)
+        size += this->text[i].size();
+    return size;
+}
+
+int TextAnnotationColumns::_decodeNoHash(const void *buf, int offset, int maxlen, int n)
+{
+    if(n < 0 || n > maxlen / 101) return -1;
+    this->resize(n);
+    const uint8_t *p = static_cast<const uint8_t*>(buf) + offset;
+    int pos = 0;
+    for (int i = 0; i < n; i++) {
+        if(maxlen - pos < 24) return -1;
+        dimos_lcm::load_be(p + pos + 0, this->timestamp_sec[i]);
+        dimos_lcm::load_be(p + pos + 4, this->timestamp_nanosec[i]);
+        dimos_lcm::load_be(p + pos + 8, this->position_x[i]);
+        dimos_lcm::load_be(p + pos + 16, this->position_y[i]);
+        pos += 24;
+        int32_t __text_len__;
+        if(maxlen - pos < 4) return -1;
+        dimos_lcm::load_be(p + pos, __text_len__);
+        pos += 4;
+        if(__text_len__ < 1 || __text_len__ > maxlen - pos) return -1;
+        this->text[i].assign(reinterpret_cast<const char*>(p) + pos, __text_len__ - 1);
+        pos += __text_len__;
+        if(maxlen - pos < 72) return -1;
+        dimos_lcm::load_be(p + pos + 0, this->font_size[i]);
+        dimos_lcm::load_be(p + pos + 8, this->text_color_r[i]);
+        dimos_lcm::load_be(p + pos + 16, this->text_color_g[i]);
+        dimos_lcm::load_be(p + pos + 24, this->text_color_b[i]);
+        dimos_lcm::load_be(p + pos + 32, this->text_color_a[i]);
+        dimos_lcm::load_be(p + pos + 40, this->background_color_r[i]);
+        dimos_lcm::load_be(p + pos + 48, this->background_color_g[i]);
+        dimos_lcm::load_be(p + pos + 56, this->background_color_b[i]);
+        dimos_lcm::load_be(p + pos + 64, this->background_color_a[i]);
+        pos += 72;
+    }
+    return pos;
+}
+
+}
+
+#endif
@@ -1,7 +1,7 @@
 /** THIS IS AN AUTOMATICALLY GENERATED FILE.  DO NOT MODIFY
  * BY HAND!!
  *
- * Generated by lcm-gen 1.5.2
+ * Generated by lcm-cpp (tools/cpp/gen)
  **/
 
 #ifndef __foxglove_msgs_TextPrimitive_hpp__
@@ -9,7 +9,11 @@
 
 #include <lcm/lcm_coretypes.h>
 
+#include <array>
 #include <string>
+#include "dimos_lcm/writer.hpp"
+#include "dimos_lcm/fingerprint.hpp"
+#include "dimos_lcm/reflection.hpp"
 #include "geometry_msgs/Pose.hpp"
 #include "foxglove_msgs/Color.hpp"
 
@@ -43,6 +47,15 @@ class TextPrimitive
          */
         inline int encode(void *buf, int offset, int maxlen) const;
 
+        /**
+         * Encode a message by appending it to @p buf, walking the message once
+         * instead of sizing it with getEncodedSize() first. @p buf grows
+         * geometrically; reuse it across calls to avoid reallocating.
+         *
+         * @return The number of bytes appended.
+         */
+        inline int encodeTo(std::vector<uint8_t> &buf) const;
+
         /**
          * Check how many bytes are required to encode this message.
          */
@@ -58,6 +71,32 @@ class TextPrimitive
          */
         inline int decode(const void *buf, int offset, int maxlen);
 
+        /**
+         * Field bits for decodeFields().
+         */
+        struct Fields
+        {
+            static constexpr uint64_t pose = 1ULL << 0;
+            static constexpr uint64_t billboard = 1ULL << 1;
+            static constexpr uint64_t font_size = 1ULL << 2;
+            static constexpr uint64_t scale_invariant = 1ULL << 3;
+            static constexpr uint64_t color = 1ULL << 4;
+            static constexpr uint64_t text = 1ULL << 5;
+            static constexpr uint64_t all = (1ULL << 6) - 1;
+        };
+
+        /**
+         * Decode only the fields selected by @p Mask, a bitwise or of Fields
+         * values. Strings, arrays and nested structs that are not selected are
+         * skipped over by their length prefixes without being allocated, and
+         * keep their previous value. Scalar fields are always decoded: they
+         * cost nothing to read and array lengths depend on them.
+         *
+         * @return The number of bytes decoded, or <0 if an error occured.
+         */
+        template <uint64_t Mask>
+        inline int decodeFields(const void *buf, int offset, int maxlen);
+
         /**
          * Retrieve the 64-bit fingerprint identifying the structure of the message.
          * Note that the fingerprint is the same for all instances of the same
@@ -66,18 +105,56 @@ class TextPrimitive
          */
         inline static int64_t getHash();
 
+        /**
+         * The fingerprint returned by getHash(), as a compile-time constant.
+         */
+        static constexpr int64_t kHash = static_cast<int64_t>(0x239d7d554833d777ULL);
+
         /**
          * Returns "TextPrimitive"
          */
         inline static const char* getTypeName();
 
+        /**
+         * Name, LCM type and array dimensions of each field, in wire order.
+         * See dimos_lcm::for_each_field() for visiting the fields themselves.
+         */
+        static constexpr std::array<dimos_lcm::field_info, 6> kFields = {{
+            { "pose", "geometry_msgs.Pose", false, 0, 0, NULL },
+            { "billboard", "boolean", true, 0, 0, NULL },
+            { "font_size", "double", true, 0, 0, NULL },
+            { "scale_invariant", "boolean", true, 0, 0, NULL },
+            { "color", "foxglove_msgs.Color", false, 0, 0, NULL },
+            { "text", "string", true, 0, 0, NULL },
+        }};
+
         // LCM support functions. Users should not call these
         inline int _encodeNoHash(void *buf, int offset, int maxlen) const;
+        template <typename Writer>
+        inline void _writeNoHash(Writer &out) const;
         inline int _getEncodedSizeNoHash() const;
         inline int _decodeNoHash(const void *buf, int offset, int maxlen);
+        template <uint64_t Mask>
+        inline int _decodeFieldsNoHash(const void *buf, int offset, int maxlen);
+        template <typename Self, typename Visitor>
+        inline static void _forEachField(Self &self, Visitor &visitor);
+        inline static int _skipNoHash(const void *buf, int offset, int maxlen);
         inline static uint64_t _computeHash(const __lcm_hash_ptr *p);
 };
 
+static_assert(TextPrimitive::kHash == dimos_lcm::fingerprint(
+    dimos_lcm::signature_hash()
+        .member("pose", NULL, 0)
+        .member("billboard", "boolean", 0)
+        .member("font_size", "double", 0)
+        .member("scale_invariant", "boolean", 0)
+        .member("color", NULL, 0)
+        .member("text", "string", 0)
+        .value(),
+    geometry_msgs::Pose::kHash,
+    foxglove_msgs::Color::kHash),
+    "foxglove_msgs::TextPrimitive fingerprint does not match its definition");
+
 int TextPrimitive::encode(void *buf, int offset, int maxlen) const
 {
     int pos = 0, tlen;
@@ -92,6 +169,15 @@ int TextPrimitive::encode(void *buf, int offset, int maxlen) const
     return pos;
 }
 
+int TextPrimitive::encodeTo(std::vector<uint8_t> &buf) const
+{
+    dimos_lcm::vector_writer out(buf);
+    int64_t hash = getHash();
+    out.put(&hash, 1);
+    this->_writeNoHash(out);
+    return static_cast<int>(out.size());
+}
+
 int TextPrimitive::decode(const void *buf, int offset, int maxlen)
 {
     int pos = 0, thislen;
@@ -107,6 +193,22 @@ int TextPrimitive::decode(const void *buf, int offset, int maxlen)
     return pos;
 }
 
+template <uint64_t Mask>
+int TextPrimitive::decodeFields(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, thislen;
+
+    int64_t msg_hash;
+    thislen = __int64_t_decode_array(buf, offset + pos, maxlen - pos, &msg_hash, 1);
+    if (thislen < 0) return thislen; else pos += thislen;
+    if (msg_hash != getHash()) return -1;
+
+    thislen = this->_decodeFieldsNoHash<Mask>(buf, offset + pos, maxlen - pos);
+    if (thislen < 0) return thislen; else pos += thislen;
+
+    return pos;
+}
+
 int TextPrimitive::getEncodedSize() const
 {
     return 8 + _getEncodedSizeNoHash();
@@ -114,8 +216,7 @@ int TextPrimitive::getEncodedSize() const
 
 int64_t TextPrimitive::getHash()
 {
-    static int64_t hash = static_cast<int64_t>(_computeHash(NULL));
-    return hash;
+    return kHash;
 }
 
 const char* TextPrimitive::getTypeName()
@@ -150,6 +251,17 @@ int TextPrimitive::_encodeNoHash(void *buf, int offset, int maxlen) const
     return pos;
 }
 
+template <typename Writer>
+void TextPrimitive::_writeNoHash(Writer &out) const
+{
+    this->pose._writeNoHash(out);
+    out.put(&this->billboard, 1);
+    out.put(&this->font_size, 1);
+    out.put(&this->scale_invariant, 1);
+    this->color._writeNoHash(out);
+    out.put(this->text);
+}
+
 int TextPrimitive::_decodeNoHash(const void *buf, int offset, int maxlen)
 {
     int pos = 0, tlen;
@@ -173,7 +285,7 @@ int TextPrimitive::_decodeNoHash(const void *buf, int offset, int maxlen)
     tlen = __int32_t_decode_array(
         buf, offset + pos, maxlen - pos, &__text_len__, 1);
     if(tlen < 0) return tlen; else pos += tlen;
-    if(__text_len__ > maxlen - pos) return -1;
+    if(__text_len__ < 1 || __text_len__ > maxlen - pos) return -1;
     this->text.assign(
         static_cast<const char*>(buf) + offset + pos, __text_len__ - 1);
     pos += __text_len__;
@@ -181,6 +293,56 @@ int TextPrimitive::_decodeNoHash(const void *buf, int offset, int maxlen)
     return pos;
 }
 
+template <uint64_t Mask>
+int TextPrimitive::_decodeFieldsNoHash(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, tlen;
+
+    if ((Mask & Fields::pose) != 0) {
+        tlen = this->pose._decodeNoHash(buf, offset + pos, maxlen - pos);
+        if(tlen < 0) return tlen; else pos += tlen;
+    } else {
+        tlen = geometry_msgs::Pose::_skipNoHash(buf, offset + pos, maxlen - pos);
+        if(tlen < 0) return tlen; else pos += tlen;
+    }
+
+    tlen = __boolean_decode_array(buf, offset + pos, maxlen - pos, &this->billboard, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = __double_decode_array(buf, offset + pos, maxlen - pos, &this->font_size, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = __boolean_decode_array(buf, offset + pos, maxlen - pos, &this->scale_invariant, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    if ((Mask & Fields::color) != 0) {
+        tlen = this->color._decodeNoHash(buf, offset + pos, maxlen - pos);
+        if(tlen < 0) return tlen; else pos += tlen;
+    } else {
+        tlen = foxglove_msgs::Color::_skipNoHash(buf, offset + pos, maxlen - pos);
+        if(tlen < 0) return tlen; else pos += tlen;
+    }
+
+    if ((Mask & Fields::text) != 0) {
+        int32_t __text_len__;
+        tlen = __int32_t_decode_array(
+            buf, offset + pos, maxlen - pos, &__text_len__, 1);
+        if(tlen < 0) return tlen; else pos += tlen;
+        if(__text_len__ < 1 || __text_len__ > maxlen - pos) return -1;
+        this->text.assign(
+            static_cast<const char*>(buf) + offset + pos, __text_len__ - 1);
+        pos += __text_len__;
+    } else {
+        int32_t __text_len__;
+        tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &__text_len__, 1);
+        if(tlen < 0) return tlen; else pos += tlen;
+        if(__text_len__ < 0 || __text_len__ > maxlen - pos) return -1;
+        pos += __text_len__;
+    }
+
+    return pos;
+}
+
 int TextPrimitive::_getEncodedSizeNoHash() const
 {
     int enc_size = 0;
@@ -193,6 +355,36 @@ int TextPrimitive::_getEncodedSizeNoHash() const
     return enc_size;
 }
 
+int TextPrimitive::_skipNoHash(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, tlen;
+    tlen = geometry_msgs::Pose::_skipNoHash(buf, offset + pos, maxlen - pos);
+    if(tlen < 0) return tlen; else pos += tlen;
+    pos += 1;
+    pos += 8;
+    pos += 1;
+    tlen = foxglove_msgs::Color::_skipNoHash(buf, offset + pos, maxlen - pos);
+    if(tlen < 0) return tlen; else pos += tlen;
+    int32_t __text_len__;
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &__text_len__, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+    if(__text_len__ < 0 || __text_len__ > maxlen - pos) return -1;
+    pos += __text_len__;
+    if(pos > maxlen) return -1;
+    return pos;
+}
+
+template <typename Self, typename Visitor>
+void TextPrimitive::_forEachField(Self &self, Visitor &visitor)
+{
+    visitor(kFields[0], self.pose);
+    visitor(kFields[1], self.billboard);
+    visitor(kFields[2], self.font_size);
+    visitor(kFields[3], self.scale_invariant);
+    visitor(kFields[4], self.color);
+    visitor(kFields[5], self.text);
+}
+
 uint64_t TextPrimitive::_computeHash(const __lcm_hash_ptr *p)
 {
     const __lcm_hash_ptr *fp;
@@ -0,0 +1,262 @@
+/** THIS IS AN AUTOMATICALLY GENERATED FILE.  DO NOT MODIFY
+ * BY HAND!!
+ *
+ * Generated by lcm-cpp (tools/cpp/gen)
+ **/
+
+#ifndef __foxglove_msgs_TextPrimitiveColumns_hpp__
+#define __foxglove_msgs_TextPrimitiveColumns_hpp__
+
+#include <lcm/lcm_coretypes.h>
+
+#include <string>
+#include <vector>
+#include "dimos_lcm/fixed_codec.hpp"
+#include "foxglove_msgs/TextPrimitive.hpp"
+
+namespace foxglove_msgs
+{
+
+/**
+ * Structure-of-arrays storage for a sequence of foxglove_msgs.TextPrimitive: one
+ * contiguous array per field, with nested fields flattened and named by their
+ * path (pose_position_x, pose_position_y, ...). The soa:: message classes hold their
+ * TextPrimitive arrays this way and decode them straight into the columns.
+ */
+class TextPrimitiveColumns
+{
+    public:
+        // pose.position.x
+        std::vector< double > pose_position_x;
+
+        // pose.position.y
+        std::vector< double > pose_position_y;
+
+        // pose.position.z
+        std::vector< double > pose_position_z;
+
+        // pose.orientation.x
+        std::vector< double > pose_orientation_x;
+
+        // pose.orientation.y
+        std::vector< double > pose_orientation_y;
+
+        // pose.orientation.z
+        std::vector< double > pose_orientation_z;
+
+        // pose.orientation.w
+        std::vector< double > pose_orientation_w;
+
+        std::vector< int8_t > billboard;
+
+        std::vector< double > font_size;
+
+        std::vector< int8_t > scale_invariant;
+
+        // color.r
+        std::vector< double > color_r;
+
+        // color.g
+        std::vector< double > color_g;
+
+        // color.b
+        std::vector< double > color_b;
+
+        // color.a
+        std::vector< double > color_a;
+
+        std::vector< std::string > text;
+
+    public:
+        /**
+         * Number of elements.
+         */
+        inline int size() const;
+
+        /**
+         * Resize every column to @p n elements.
+         */
+        inline void resize(int n);
+
+        /**
+         * Gather element @p i into a TextPrimitive.
+         */
+        inline foxglove_msgs::TextPrimitive get(int i) const;
+
+        /**
+         * Scatter @p msg into element @p i.
+         */
+        inline void set(int i, const foxglove_msgs::TextPrimitive &msg);
+
+        // LCM support functions. Users should not call these
+        inline int _encodeNoHash(void *buf, int offset, int maxlen, int n) const;
+        template <typename Writer>
+        inline void _writeNoHash(Writer &out, int n) const;
+        inline int _getEncodedSizeNoHash(int n) const;
+        inline int _decodeNoHash(const void *buf, int offset, int maxlen, int n);
+};
+
+int TextPrimitiveColumns::size() const
+{
+    return static_cast<int>(this->pose_position_x.size());
+}
+
+void TextPrimitiveColumns::resize(int n)
+{
+    this->pose_position_x.resize(n);
+    this->pose_position_y.resize(n);
+    this->pose_position_z.resize(n);
+    this->pose_orientation_x.resize(n);
+    this->pose_orientation_y.resize(n);
+    this->pose_orientation_z.resize(n);
+    this->pose_orientation_w.resize(n);
+    this->billboard.resize(n);
+    this->font_size.resize(n);
+    this->scale_invariant.resize(n);
+    this->color_r.resize(n);
+    this->color_g.resize(n);
+    this->color_b.resize(n);
+    this->color_a.resize(n);
+    this->text.resize(n);
+}
+
+foxglove_msgs::TextPrimitive TextPrimitiveColumns::get(int i) const
+{
+    foxglove_msgs::TextPrimitive msg;
+    msg.pose.position.x = this->pose_position_x[i];
+    msg.pose.position.y = this->pose_position_y[i];
+    msg.pose.position.z = this->pose_position_z[i];
+    msg.pose.orientation.x = this->pose_orientation_x[i];
+    msg.pose.orientation.y = this->pose_orientation_y[i];
+    msg.pose.orientation.z = this->pose_orientation_z[i];
+    msg.pose.orientation.w = this->pose_orientation_w[i];
+    msg.billboard = this->billboard[i];
+    msg.font_size = this->font_size[i];
+    msg.scale_invariant = this->scale_invariant[i];
+    msg.color.r = this->color_r[i];
+    msg.color.g = this->color_g[i];
+    msg.color.b = this->color_b[i];
+    msg.color.a = this->color_a[i];
+    msg.text = this->text[i];
+    return msg;
+}
+
+void TextPrimitiveColumns::set(int i, const foxglove_msgs::TextPrimitive &msg)
+{
+    this->pose_position_x[i] = msg.pose.position.x;
+    this->pose_position_y[i] = msg.pose.position.y;
+    this->pose_position_z[i] = msg.pose.position.z;
+    this->pose_orientation_x[i] = msg.pose.orientation.x;
+    this->pose_orientation_y[i] = msg.pose.orientation.y;
+    this->pose_orientation_z[i] = msg.pose.orientation.z;
+    this->pose_orientation_w[i] = msg.pose.orientation.w;
+    this->billboard[i] = msg.billboard;
+    this->font_size[i] = msg.font_size;
+    this->scale_invariant[i] = msg.scale_invariant;
+    this->color_r[i] = msg.color.r;
+    this->color_g[i] = msg.color.g;
+    this->color_b[i] = msg.color.b;
+    this->color_a[i] = msg.color.a;
+    this->text[i] = msg.text;
+}
+
+int TextPrimitiveColumns::_encodeNoHash(void *buf, int offset, int maxlen, int n) const
+{
+    uint8_t *p = static_cast<uint8_t*>(buf) + offset;
+    int pos = 0;
+    for (int i = 0; i < n; i++) {
+        if(maxlen - pos < 98) return -1;
+        dimos_lcm::store_be(p + pos + 0, this->pose_position_x[i]);
+        dimos_lcm::store_be(p + pos + 8, this->pose_position_y[i]);
+        dimos_lcm::store_be(p + pos + 16, this->pose_position_z[i]);
+        dimos_lcm::store_be(p + pos + 24, this->pose_orientation_x[i]);
+        dimos_lcm::store_be(p + pos + 32, this->pose_orientation_y[i]);
+        dimos_lcm::store_be(p + pos + 40, this->pose_orientation_z[i]);
+        dimos_lcm::store_be(p + pos + 48, this->pose_orientation_w[i]);
+        dimos_lcm::store_be(p + pos + 56, this->billboard[i]);
+        dimos_lcm::store_be(p + pos + 57, this->font_size[i]);
+        dimos_lcm::store_be(p + pos + 65, this->scale_invariant[i]);
+        dimos_lcm::store_be(p + pos + 66, this->color_r[i]);
+        dimos_lcm::store_be(p + pos + 74, this->color_g[i]);
+        dimos_lcm::store_be(p + pos + 82, this->color_b[i]);
+        dimos_lcm::store_be(p + pos + 90, this->color_a[i]);
+        pos += 98;
+        int32_t __text_len__ = static_cast<int32_t>(this->text[i].size()) + 1;
+        if(maxlen - pos < 4 || __text_len__ > maxlen - pos - 4) return -1;
+        dimos_lcm::store_be(p + pos, __text_len__);
+        memcpy(p + pos + 4, this->text[i].c_str(), __text_len__);
+        pos += 4 + __text_len__;
+    }
+    return pos;
+}
+
+template <typename Writer>
+void TextPrimitiveColumns::_writeNoHash(Writer &out, int n) const
+{
+    for (int i = 0; i < n; i++) {
+        {
+            uint8_t *p = out.extend(98);
+            dimos_lcm::store_be(p + 0, this->pose_position_x[i]);
+            dimos_lcm::store_be(p + 8, this->pose_position_y[i]);
+            dimos_lcm::store_be(p + 16, this->pose_position_z[i]);
+            dimos_lcm::store_be(p + 24, this->pose_orientation_x[i]);
+            dimos_lcm::store_be(p + 32, this->pose_orientation_y[i]);
+            dimos_lcm::store_be(p + 40, this->pose_orientation_z[i]);
+            dimos_lcm::store_be(p + 48, this->pose_orientation_w[i]);
+            dimos_lcm::store_be(p + 56, this->billboard[i]);
+            dimos_lcm::store_be(p + 57, this->font_size[i]);
+            dimos_lcm::store_be(p + 65, this->scale_invariant[i]);
+            dimos_lcm::store_be(p + 66, this->color_r[i]);
+            dimos_lcm::store_be(p + 74, this->color_g[i]);
+            dimos_lcm::store_be(p + 82, this->color_b[i]);
+            dimos_lcm::store_be(p + 90, this->color_a[i]);
+        }
+        out.put(this->text[i]);
+    }
+}
+
+int TextPrimitiveColumns::_getEncodedSizeNoHash(int n) const
+{
+    int size = n * 103;
+    for (int i = 0; i < n; i++)
+        size += this->text[i].size();
+    return size;
+}
+
+int TextPrimitiveColumns::_decodeNoHash(const void *buf, int offset, int maxlen, int n)
+{
+    if(n < 0 || n > maxlen / 103) return -1;
+    this->resize(n);
+    const uint8_t *p = static_cast<const uint8_t*>(buf) + offset;
+    int pos = 0;
+    for (int i = 0; i < n; i++) {
+        if(maxlen - pos < 98) return -1;
+        dimos_lcm::load_be(p + pos + 0, this->pose_position_x[i]);
+        dimos_lcm::load_be(p + pos + 8, this->pose_position_y[i]);
+        dimos_lcm::load_be(p + pos + 16, this->pose_position_z[i]);
+        dimos_lcm::load_be(p + pos + 24, this->pose_orientation_x[i]);
+        dimos_lcm::load_be(p + pos + 32, this->pose_orientation_y[i]);
+        dimos_lcm::load_be(p + pos + 40, this->pose_orientation_z[i]);
+        dimos_lcm::load_be(p + pos + 48, this->pose_orientation_w[i]);
+        dimos_lcm::load_be(p + pos + 56, this->billboard[i]);
+        dimos_lcm::load_be(p + pos + 57, this->font_size[i]);
+        dimos_lcm::load_be(p + pos + 65, this->scale_invariant[i]);
+        dimos_lcm::load_be(p + pos + 66, this->color_r[i]);
+        dimos_lcm::load_be(p + pos + 74, this->color_g[i]);
+        dimos_lcm::load_be(p + pos + 82, this->color_b[i]);
+        dimos_lcm::load_be(p + pos + 90, this->color_a[i]);
+        pos += 98;
+        int32_t __text_len__;
+        if(maxlen - pos < 4) return -1;
+        dimos_lcm::load_be(p + pos, __text_len__);
+        pos += 4;
+        if(__text_len__ < 1 || __text_len__ > maxlen - pos) return -1;
+        this->text[i].assign(reinterpret_cast<const char*>(p) + pos, __text_len__ - 1);
+        pos += __text_len__;
+    }
+    return pos;
+}
+
+}
+
+#endif
@@ -1,7 +1,7 @@
 /** THIS IS AN AUTOMATICALLY GENERATED FILE.  DO NOT MODIFY
  * BY HAND!!
  *
- * Generated by lcm-gen 1.5.2
+ * Generated by lcm-cpp (tools/cpp/gen)
  **/
 
 #ifndef __foxglove_msgs_TriangleListPrimitive_hpp__
@@ -9,11 +9,15 @@
 
 #include <lcm/lcm_coretypes.h>
 
+#include <array>
 #include <vector>
+#include "dimos_lcm/bulk_codec.hpp"
+#include "dimos_lcm/writer.hpp"
+#include "dimos_lcm/fingerprint.hpp"
+#include "dimos_lcm/reflection.hpp"
 #include "geometry_msgs/Pose.hpp"
 #include "geometry_msgs/Point.hpp"
 #include "foxglove_msgs/Color.hpp"
-#include "foxglove_msgs/Color.hpp"
 
 namespace foxglove_msgs
 {
@@ -58,6 +62,15 @@ class TriangleListPrimitive
          */
         inline int encode(void *buf, int offset, int maxlen) const;
 
+        /**
+         * Encode a message by appending it to @p buf, walking the message once
+         * instead of sizing it with getEncodedSize() first. @p buf grows
+         * geometrically; reuse it across calls to avoid reallocating.
+         *
+         * @return The number of bytes appended.
+         */
+        inline int encodeTo(std::vector<uint8_t> &buf) const;
+
         /**
          * Check how many bytes are required to encode this message.
          */
@@ -73,6 +86,47 @@ class TriangleListPrimitive
          */
         inline int decode(const void *buf, int offset, int maxlen);
 
+        /**
+         * Field bits for decodeFields().
+         */
+        struct Fields
+        {
+            static constexpr uint64_t points_length = 1ULL << 0;
+            static constexpr uint64_t colors_length = 1ULL << 1;
+            static constexpr uint64_t indices_length = 1ULL << 2;
+            static constexpr uint64_t pose = 1ULL << 3;
+            static constexpr uint64_t points = 1ULL << 4;
+            static constexpr uint64_t color = 1ULL << 5;
+            static constexpr uint64_t colors = 1ULL << 6;
+            static constexpr uint64_t indices = 1ULL << 7;
+            static constexpr uint64_t all = (1ULL << 8) - 1;
+        };
+
+        /**
+         * Decode only the fields selected by @p Mask, a bitwise or of Fields
+         * values. Strings, arrays and nested structs that are not selected are
+         * skipped over by their length prefixes without being allocated, and
+         * keep their previous value. Scalar fields are always decoded: they
+         * cost nothing to read and array lengths depend on them.
+         *
+         * @return The number of bytes decoded, or <0 if an error occured.
+         */
+        template <uint64_t Mask>
+        inline int decodeFields(const void *buf, int offset, int maxlen);
+
+        /**
+         * Upper bound on the length of every variable-length array of this
+         * type, checked by decode() before anything is allocated; messages
+         * exceeding it fail to decode. It does not apply to nested types,
+         * which have their own. Set it once at startup, before decoding.
+         * Before C++17 it is a constant with no limit.
+         */
+#if __cplusplus >= 201703L
+        static inline int32_t maxArrayLength = INT32_MAX;
+#else
+        static constexpr int32_t maxArrayLength = INT32_MAX;
+#endif
+
         /**
          * Retrieve the 64-bit fingerprint identifying the structure of the message.
          * Note that the fingerprint is the same for all instances of the same
@@ -81,18 +135,62 @@ class TriangleListPrimitive
          */
         inline static int64_t getHash();
 
+        /**
+         * The fingerprint returned by getHash(), as a compile-time constant.
+         */
+        static constexpr int64_t kHash = static_cast<int64_t>(0x101368aec009a8ccULL);
+
         /**
          * Returns "TriangleListPrimitive"
          */
         inline static const char* getTypeName();
 
+        /**
+         * Name, LCM type and array dimensions of each field, in wire order.
+         * See dimos_lcm::for_each_field() for visiting the fields themselves.
+         */
+        static constexpr std::array<dimos_lcm::field_info, 8> kFields = {{
+            { "points_length", "int32_t", true, 0, 0, NULL },
+            { "colors_length", "int32_t", true, 0, 0, NULL },
+            { "indices_length", "int32_t", true, 0, 0, NULL },
+            { "pose", "geometry_msgs.Pose", false, 0, 0, NULL },
+            { "points", "geometry_msgs.Point", false, 1, -1, "points_length" },
+            { "color", "foxglove_msgs.Color", false, 0, 0, NULL },
+            { "colors", "foxglove_msgs.Color", false, 1, -1, "colors_length" },
+            { "indices", "int32_t", true, 1, -1, "indices_length" },
+        }};
+
         // LCM support functions. Users should not call these
         inline int _encodeNoHash(void *buf, int offset, int maxlen) const;
+        template <typename Writer>
+        inline void _writeNoHash(Writer &out) const;
         inline int _getEncodedSizeNoHash() const;
         inline int _decodeNoHash(const void *buf, int offset, int maxlen);
+        template <uint64_t Mask>
+        inline int _decodeFieldsNoHash(const void *buf, int offset, int maxlen);
+        template <typename Self, typename Visitor>
+        inline static void _forEachField(Self &self, Visitor &visitor);
+        inline static int _skipNoHash(const void *buf, int offset, int maxlen);
         inline static uint64_t _computeHash(const __lcm_hash_ptr *p);
 };
 
+static_assert(TriangleListPrimitive::kHash == dimos_lcm::fingerprint(
+    dimos_lcm::signature_hash()
+        .member("points_length", "int32_t", 0)
+        .member("colors_length", "int32_t", 0)
+        .member("indices_length", "int32_t", 0)
+        .member("pose", NULL, 0)
+        .member("points", NULL, 1).dim(true, "points_length")
+        .member("color", NULL, 0)
+        .member("colors", NULL, 1).dim(true, "colors_length")
+        .member("indices", "int32_t", 1).dim(true, "indices_length")
+        .value(),
+    geometry_msgs::Pose::kHash,
+    geometry_msgs::Point::kHash,
+    foxglove_msgs::Color::kHash,
+    foxglove_msgs::Color::kHash),
+    "foxglove_msgs::TriangleListPrimitive fingerprint does not match its definition");
+
 int TriangleListPrimitive::encode(void *buf, int offset, int maxlen) const
 {
     int pos = 0, tlen;
@@ -107,6 +205,15 @@ int TriangleListPrimitive::encode(void *buf, int offset, int maxlen) const
     return pos;
 }
 
+int TriangleListPrimitive::encodeTo(std::vector<uint8_t> &buf) const
+{
+    dimos_lcm::vector_writer out(buf);
+    int64_t hash = getHash();
+    out.put(&hash, 1);
+    this->_writeNoHash(out);
+    return static_cast<int>(out.size());
+}
+
 int TriangleListPrimitive::decode(const void *buf, int offset, int maxlen)
 {
     int pos = 0, thislen;
@@ -122,6 +229,22 @@ int TriangleListPrimitive::decode(const void *buf, int offset, int maxlen)
     return pos;
 }
 
+template <uint64_t Mask>
+int TriangleListPrimitive::decodeFields(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, thislen;
+
+    int64_t msg_hash;
+    thislen = __int64_t_decode_array(buf, offset + pos, maxlen - pos, &msg_hash, 1);
+    if (thislen < 0) return thislen; else pos += thislen;
+    if (msg_hash != getHash()) return -1;
+
+    thislen = this->_decodeFieldsNoHash<Mask>(buf, offset + pos, maxlen - pos);
+    if (thislen < 0) return thislen; else pos += thislen;
+
+    return pos;
+}
+
 int TriangleListPrimitive::getEncodedSize() const
 {
     return 8 + _getEncodedSizeNoHash();
@@ -129,8 +252,7 @@ int TriangleListPrimitive::getEncodedSize() const
 
 int64_t TriangleListPrimitive::getHash()
 {
-    static int64_t hash = static_cast<int64_t>(_computeHash(NULL));
-    return hash;
+    return kHash;
 }
 
 const char* TriangleListPrimitive::getTypeName()
@@ -168,13 +290,29 @@ int TriangleListPrimitive::_encodeNoHash(void *buf, int offset, int maxlen) cons
     }
 
     if(this->indices_length > 0) {
-        tlen = __int32_t_encode_array(buf, offset + pos, maxlen - pos, &this->indices[0], this->indices_length);
+        tlen = dimos_lcm::bulk_encode_array(buf, offset + pos, maxlen - pos, &this->indices[0], this->indices_length);
         if(tlen < 0) return tlen; else pos += tlen;
     }
 
     return pos;
 }
 
+template <typename Writer>
+void TriangleListPrimitive::_writeNoHash(Writer &out) const
+{
+    out.put(&this->points_length, 1);
+    out.put(&this->colors_length, 1);
+    out.put(&this->indices_length, 1);
+    this->pose._writeNoHash(out);
+    if(this->points_length > 0)
+        out.putStructArray(&this->points[0], this->points_length);
+    this->color._writeNoHash(out);
+    if(this->colors_length > 0)
+        out.putStructArray(&this->colors[0], this->colors_length);
+    if(this->indices_length > 0)
+        out.put(&this->indices[0], this->indices_length);
+}
+
 int TriangleListPrimitive::_decodeNoHash(const void *buf, int offset, int maxlen)
 {
     int pos = 0, tlen;
@@ -191,6 +329,7 @@ int TriangleListPrimitive::_decodeNoHash(const void *buf, int offset, int maxlen
     tlen = this->pose._decodeNoHash(buf, offset + pos, maxlen - pos);
     if(tlen < 0) return tlen; else pos += tlen;
 
+    if(this->points_length < 0 || this->points_length > (maxlen - pos) / 24 || this->points_length > maxArrayLength) return -1;
     try {
         this->points.resize(this->points_length);
     } catch (...) {
@@ -204,6 +343,7 @@ int TriangleListPrimitive::_decodeNoHash(const void *buf, int offset, int maxlen
     tlen = this->color._decodeNoHash(buf, offset + pos, maxlen - pos);
     if(tlen < 0) return tlen; else pos += tlen;
 
+    if(this->colors_length < 0 || this->colors_length > (maxlen - pos) / 32 || this->colors_length > maxArrayLength) return -1;
     try {
         this->colors.resize(this->colors_length);
     } catch (...) {
@@ -215,11 +355,99 @@ int TriangleListPrimitive::_decodeNoHash(const void *buf, int offset, int maxlen
     }
 
     if(this->indices_length) {
+        if(this->indices_length < 0 || this->indices_length > (maxlen - pos) / 4 || this->indices_length > maxArrayLength) return -1;
         this->indices.resize(this->indices_length);
-        tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &this->indices[0], this->indices_length);
+        tlen = dimos_lcm::bulk_decode_array(buf, offset + pos, maxlen - pos, &this->indices[0], this->indices_length);
+        if(tlen < 0) return tlen; else pos += tlen;
+    } else {
+        this->indices.clear();
+    }
+
+    return pos;
+}
+
+template <uint64_t Mask>
+int TriangleListPrimitive::_decodeFieldsNoHash(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, tlen;
+
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &this->points_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &this->colors_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &this->indices_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    if ((Mask & Fields::pose) != 0) {
+        tlen = this->pose._decodeNoHash(buf, offset + pos, maxlen - pos);
+        if(tlen < 0) return tlen; else pos += tlen;
+    } else {
+        tlen = geometry_msgs::Pose::_skipNoHash(buf, offset + pos, maxlen - pos);
         if(tlen < 0) return tlen; else pos += tlen;
     }
 
+    if ((Mask & Fields::points) != 0) {
+        if(this->points_length < 0 || this->points_length > (maxlen - pos) / 24 || this->points_length > maxArrayLength) return -1;
+        try {
+            this->points.resize(this->points_length);
+        } catch (...) {
+            return -1;
+        }
+        for (int a0 = 0; a0 < this->points_length; a0++) {
+            tlen = this->points[a0]._decodeNoHash(buf, offset + pos, maxlen - pos);
+            if(tlen < 0) return tlen; else pos += tlen;
+        }
+    } else {
+        if(this->points_length < 0) return -1;
+        for (int a0 = 0; a0 < this->points_length; a0++) {
+            tlen = geometry_msgs::Point::_skipNoHash(buf, offset + pos, maxlen - pos);
+            if(tlen < 0) return tlen; else pos += tlen;
+        }
+    }
+
+    if ((Mask & Fields::color) != 0) {
+        tlen = this->color._decodeNoHash(buf, offset + pos, maxlen - pos);
+        if(tlen < 0) return tlen; else pos += tlen;
+    } else {
+        tlen = foxglove_msgs::Color::_skipNoHash(buf, offset + pos, maxlen - pos);
+        if(tlen < 0) return tlen; else pos += tlen;
+    }
+
+    if ((Mask & Fields::colors) != 0) {
+        if(this->colors_length < 0 || this->colors_length > (maxlen - pos) / 32 || this->colors_length > maxArrayLength) return -1;
+        try {
+            this->colors.resize(this->colors_length);
+        } catch (...) {
+            return -1;
+        }
+        for (int a0 = 0; a0 < this->colors_length; a0++) {
+            tlen = this->colors[a0]._decodeNoHash(buf, offset + pos, maxlen - pos);
+            if(tlen < 0) return tlen; else pos += tlen;
+        }
+    } else {
+        if(this->colors_length < 0) return -1;
+        for (int a0 = 0; a0 < this->colors_length; a0++) {
+            tlen = foxglove_msgs::Color::_skipNoHash(buf, offset + pos, maxlen - pos);
+            if(tlen < 0) return tlen; else pos += tlen;
+        }
+    }
+
+    if ((Mask & Fields::indices) != 0) {
+        if(this->indices_length) {
+            if(this->indices_length < 0 || this->indices_length > (maxlen - pos) / 4 || this->indices_length > maxArrayLength) return -1;
+            this->indices.resize(this->indices_length);
+            tlen = dimos_lcm::bulk_decode_array(buf, offset + pos, maxlen - pos, &this->indices[0], this->indices_length);
+            if(tlen < 0) return tlen; else pos += tlen;
+        } else {
+            this->indices.clear();
+        }
+    } else {
+        if(this->indices_length < 0 || this->indices_length > (maxlen - pos) / 4) return -1;
+        pos += this->indices_length * 4;
+    }
+
     return pos;
 }
 
@@ -241,6 +469,51 @@ int TriangleListPrimitive::_getEncodedSizeNoHash() const
     return enc_size;
 }
 
+int TriangleListPrimitive::_skipNoHash(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, tlen;
+    int32_t points_length;
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &points_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+    int32_t colors_length;
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &colors_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+    int32_t indices_length;
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &indices_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+    tlen = geometry_msgs::Pose::_skipNoHash(buf, offset + pos, maxlen - pos);
+    if(tlen < 0) return tlen; else pos += tlen;
+    if(points_length < 0) return -1;
+    for (int a0 = 0; a0 < points_length; a0++) {
+        tlen = geometry_msgs::Point::_skipNoHash(buf, offset + pos, maxlen - pos);
+        if(tlen < 0) return tlen; else pos += tlen;
+    }
+    tlen = foxglove_msgs::Color::_skipNoHash(buf, offset + pos, maxlen - pos);
+    if(tlen < 0) return tlen; else pos += tlen;
+    if(colors_length < 0) return -1;
+    for (int a0 = 0; a0 < colors_length; a0++) {
+        tlen = foxglove_msgs::Color::_skipNoHash(buf, offset + pos, maxlen - pos);
+        if(tlen < 0) return tlen; else pos += tlen;
+    }
+    if(indices_length < 0 || indices_length > (maxlen - pos) / 4) return -1;
+    pos += indices_length * 4;
+    if(pos > maxlen) return -1;
+    return pos;
+}
+
+template <typename Self, typename Visitor>
+void TriangleListPrimitive::_forEachField(Self &self, Visitor &visitor)
+{
+    visitor(kFields[0], self.points_length);
+    visitor(kFields[1], self.colors_length);
+    visitor(kFields[2], self.indices_length);
+    visitor(kFields[3], self.pose);
+    visitor(kFields[4], self.points);
+    visitor(kFields[5], self.color);
+    visitor(kFields[6], self.colors);
+    visitor(kFields[7], self.indices);
+}
+
 uint64_t TriangleListPrimitive::_computeHash(const __lcm_hash_ptr *p)
 {
     const __lcm_hash_ptr *fp;
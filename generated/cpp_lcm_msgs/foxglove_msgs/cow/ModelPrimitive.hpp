@@ -0,0 +1,563 @@
+/** THIS IS AN AUTOMATICALLY GENERATED FILE.  DO NOT MODIFY
+ * BY HAND!!
+ *
+ * Generated by lcm-cpp (tools/cpp/gen)
+ **/
+
+#ifndef __foxglove_msgs_cow_ModelPrimitive_hpp__
+#define __foxglove_msgs_cow_ModelPrimitive_hpp__
+
+#include <lcm/lcm_coretypes.h>
+
+#include <array>
+#include <string>
+#include <vector>
+#include "dimos_lcm/cow_array.hpp"
+#include "dimos_lcm/iov_writer.hpp"
+#include "dimos_lcm/wire_builder.hpp"
+#include "dimos_lcm/fingerprint.hpp"
+#include "dimos_lcm/reflection.hpp"
+#include "geometry_msgs/Pose.hpp"
+#include "geometry_msgs/Vector3.hpp"
+#include "foxglove_msgs/Color.hpp"
+
+namespace foxglove_msgs
+{
+namespace cow
+{
+
+class ModelPrimitive
+{
+    public:
+        int32_t    data_length;
+
+        geometry_msgs::Pose pose;
+
+        geometry_msgs::Vector3 scale;
+
+        foxglove_msgs::Color color;
+
+        int8_t     override_color;
+
+        std::string url;
+
+        std::string media_type;
+
+        /**
+         * LCM Type: byte[data_length]
+         */
+        dimos_lcm::cow_array< uint8_t > data;
+
+    public:
+        /**
+         * Encode a message into binary form.
+         *
+         * @param buf The output buffer.
+         * @param offset Encoding starts at thie byte offset into @p buf.
+         * @param maxlen Maximum number of bytes to write.  This should generally be
+         *  equal to getEncodedSize().
+         * @return The number of bytes encoded, or <0 on error.
+         */
+        inline int encode(void *buf, int offset, int maxlen) const;
+
+        /**
+         * Encode a message by appending it to @p buf, walking the message once
+         * instead of sizing it with getEncodedSize() first. @p buf grows
+         * geometrically; reuse it across calls to avoid reallocating.
+         *
+         * @return The number of bytes appended.
+         */
+        inline int encodeTo(std::vector<uint8_t> &buf) const;
+
+        /**
+         * Encode a message as a list of buffers for writev()/sendmsg(). Byte
+         * payloads are referenced in place instead of copied; see
+         * dimos_lcm/iov_writer.hpp for how long they must stay valid.
+         *
+         * @param out Receives the encoded message after anything it already holds.
+         * @return The number of bytes encoded.
+         */
+        inline int encodeIov(dimos_lcm::iov_writer &out) const;
+
+        /**
+         * Encode a message into the buffer of @p out, leaving a gap at the
+         * place of each byte payload for the caller to fill; see
+         * dimos_lcm/wire_builder.hpp. The payload arrays are not read: set
+         * their length fields, and leave the arrays empty to skip filling them
+         * twice.
+         *
+         * @param out Receives the encoded message after anything it already holds.
+         * @return The number of bytes encoded, or <0 if they do not fit.
+         */
+        inline int encodeInPlace(dimos_lcm::wire_builder &out) const;
+
+        /**
+         * Check how many bytes are required to encode this message.
+         */
+        inline int getEncodedSize() const;
+
+        /**
+         * Decode a message from binary form into this instance.
+         *
+         * @param buf The buffer containing the encoded message.
+         * @param offset The byte offset into @p buf where the encoded message starts.
+         * @param maxlen The maximum number of bytes to read while decoding.
+         * @return The number of bytes decoded, or <0 if an error occured.
+         */
+        inline int decode(const void *buf, int offset, int maxlen);
+
+        /**
+         * Field bits for decodeFields().
+         */
+        struct Fields
+        {
+            static constexpr uint64_t data_length = 1ULL << 0;
+            static constexpr uint64_t pose = 1ULL << 1;
+            static constexpr uint64_t scale = 1ULL << 2;
+            static constexpr uint64_t color = 1ULL << 3;
+            static constexpr uint64_t override_color = 1ULL << 4;
+            static constexpr uint64_t url = 1ULL << 5;
+            static constexpr uint64_t media_type = 1ULL << 6;
+            static constexpr uint64_t data = 1ULL << 7;
+            static constexpr uint64_t all = (1ULL << 8) - 1;
+        };
+
+        /**
+         * Decode only the fields selected by @p Mask, a bitwise or of Fields
+         * values. Strings, arrays and nested structs that are not selected are
+         * skipped over by their length prefixes without being allocated, and
+         * keep their previous value. Scalar fields are always decoded: they
+         * cost nothing to read and array lengths depend on them.
+         *
+         * @return The number of bytes decoded, or <0 if an error occured.
+         */
+        template <uint64_t Mask>
+        inline int decodeFields(const void *buf, int offset, int maxlen);
+
+        /**
+         * Upper bound on the length of every variable-length array of this
+         * type, checked by decode() before anything is allocated; messages
+         * exceeding it fail to decode. It does not apply to nested types,
+         * which have their own. Set it once at startup, before decoding.
+         * Before C++17 it is a constant with no limit.
+         */
+#if __cplusplus >= 201703L
+        static inline int32_t maxArrayLength = INT32_MAX;
+#else
+        static constexpr int32_t maxArrayLength = INT32_MAX;
+#endif
+
+        /**
+         * Retrieve the 64-bit fingerprint identifying the structure of the message.
+         * Note that the fingerprint is the same for all instances of the same
+         * message type, and is a fingerprint on the message type definition, not on
+         * the message contents.
+         */
+        inline static int64_t getHash();
+
+        /**
+         * The fingerprint returned by getHash(), as a compile-time constant.
+         */
+        static constexpr int64_t kHash = static_cast<int64_t>(0x534884a083aa8e22ULL);
+
+        /**
+         * Returns "ModelPrimitive"
+         */
+        inline static const char* getTypeName();
+
+        /**
+         * Name, LCM type and array dimensions of each field, in wire order.
+         * See dimos_lcm::for_each_field() for visiting the fields themselves.
+         */
+        static constexpr std::array<dimos_lcm::field_info, 8> kFields = {{
+            { "data_length", "int32_t", true, 0, 0, NULL },
+            { "pose", "geometry_msgs.Pose", false, 0, 0, NULL },
+            { "scale", "geometry_msgs.Vector3", false, 0, 0, NULL },
+            { "color", "foxglove_msgs.Color", false, 0, 0, NULL },
+            { "override_color", "boolean", true, 0, 0, NULL },
+            { "url", "string", true, 0, 0, NULL },
+            { "media_type", "string", true, 0, 0, NULL },
+            { "data", "byte", true, 1, -1, "data_length" },
+        }};
+
+        // LCM support functions. Users should not call these
+        inline int _encodeNoHash(void *buf, int offset, int maxlen) const;
+        template <typename Writer>
+        inline void _writeNoHash(Writer &out) const;
+        inline int _getEncodedSizeNoHash() const;
+        inline int _decodeNoHash(const void *buf, int offset, int maxlen);
+        template <uint64_t Mask>
+        inline int _decodeFieldsNoHash(const void *buf, int offset, int maxlen);
+        template <typename Self, typename Visitor>
+        inline static void _forEachField(Self &self, Visitor &visitor);
+        inline static int _skipNoHash(const void *buf, int offset, int maxlen);
+        inline static uint64_t _computeHash(const __lcm_hash_ptr *p);
+};
+
+static_assert(ModelPrimitive::kHash == dimos_lcm::fingerprint(
+    dimos_lcm::signature_hash()
+        .member("data_length", "int32_t", 0)
+        .member("pose", NULL, 0)
+        .member("scale", NULL, 0)
+        .member("color", NULL, 0)
+        .member("override_color", "boolean", 0)
+        .member("url", "string", 0)
+        .member("media_type", "string", 0)
+        .member("data", "byte", 1).dim(true, "data_length")
+        .value(),
+    geometry_msgs::Pose::kHash,
+    geometry_msgs::Vector3::kHash,
+    foxglove_msgs::Color::kHash),
+    "foxglove_msgs::cow::ModelPrimitive fingerprint does not match its definition");
+
+int ModelPrimitive::encode(void *buf, int offset, int maxlen) const
+{
+    int pos = 0, tlen;
+    int64_t hash = getHash();
+
+    tlen = __int64_t_encode_array(buf, offset + pos, maxlen - pos, &hash, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = this->_encodeNoHash(buf, offset + pos, maxlen - pos);
+    if (tlen < 0) return tlen; else pos += tlen;
+
+    return pos;
+}
+
+int ModelPrimitive::encodeTo(std::vector<uint8_t> &buf) const
+{
+    dimos_lcm::vector_writer out(buf);
+    int64_t hash = getHash();
+    out.put(&hash, 1);
+    this->_writeNoHash(out);
+    return static_cast<int>(out.size());
+}
+
+int ModelPrimitive::encodeIov(dimos_lcm::iov_writer &out) const
+{
+    size_t start = out.size();
+    int64_t hash = getHash();
+    out.put(&hash, 1);
+    this->_writeNoHash(out);
+    return static_cast<int>(out.size() - start);
+}
+
+int ModelPrimitive::encodeInPlace(dimos_lcm::wire_builder &out) const
+{
+    int size = getEncodedSize();
+    if (static_cast<size_t>(size) > out.remaining())
+        return -1;
+    int64_t hash = getHash();
+    out.put(&hash, 1);
+    this->_writeNoHash(out);
+    return size;
+}
+
+int ModelPrimitive::decode(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, thislen;
+
+    int64_t msg_hash;
+    thislen = __int64_t_decode_array(buf, offset + pos, maxlen - pos, &msg_hash, 1);
+    if (thislen < 0) return thislen; else pos += thislen;
+    if (msg_hash != getHash()) return -1;
+
+    thislen = this->_decodeNoHash(buf, offset + pos, maxlen - pos);
+    if (thislen < 0) return thislen; else pos += thislen;
+
+    return pos;
+}
+
+template <uint64_t Mask>
+int ModelPrimitive::decodeFields(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, thislen;
+
+    int64_t msg_hash;
+    thislen = __int64_t_decode_array(buf, offset + pos, maxlen - pos, &msg_hash, 1);
+    if (thislen < 0) return thislen; else pos += thislen;
+    if (msg_hash != getHash()) return -1;
+
+    thislen = this->_decodeFieldsNoHash<Mask>(buf, offset + pos, maxlen - pos);
+    if (thislen < 0) return thislen; else pos += thislen;
+
+    return pos;
+}
+
+int ModelPrimitive::getEncodedSize() const
+{
+    return 8 + _getEncodedSizeNoHash();
+}
+
+int64_t ModelPrimitive::getHash()
+{
+    return kHash;
+}
+
+const char* ModelPrimitive::getTypeName()
+{
+    return "ModelPrimitive";
+}
+
+int ModelPrimitive::_encodeNoHash(void *buf, int offset, int maxlen) const
+{
+    int pos = 0, tlen;
+
+    tlen = __int32_t_encode_array(buf, offset + pos, maxlen - pos, &this->data_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = this->pose._encodeNoHash(buf, offset + pos, maxlen - pos);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = this->scale._encodeNoHash(buf, offset + pos, maxlen - pos);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = this->color._encodeNoHash(buf, offset + pos, maxlen - pos);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = __boolean_encode_array(buf, offset + pos, maxlen - pos, &this->override_color, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    char* url_cstr = const_cast<char*>(this->url.c_str());
+    tlen = __string_encode_array(
+        buf, offset + pos, maxlen - pos, &url_cstr, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    char* media_type_cstr = const_cast<char*>(this->media_type.c_str());
+    tlen = __string_encode_array(
+        buf, offset + pos, maxlen - pos, &media_type_cstr, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    if(this->data_length > 0) {
+        tlen = __byte_encode_array(buf, offset + pos, maxlen - pos, &this->data[0], this->data_length);
+        if(tlen < 0) return tlen; else pos += tlen;
+    }
+
+    return pos;
+}
+
+template <typename Writer>
+void ModelPrimitive::_writeNoHash(Writer &out) const
+{
+    out.put(&this->data_length, 1);
+    this->pose._writeNoHash(out);
+    this->scale._writeNoHash(out);
+    this->color._writeNoHash(out);
+    out.put(&this->override_color, 1);
+    out.put(this->url);
+    out.put(this->media_type);
+    if(this->data_length > 0)
+        out.reference(this->data.data(), this->data_length);
+}
+
+int ModelPrimitive::_decodeNoHash(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, tlen;
+
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &this->data_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = this->pose._decodeNoHash(buf, offset + pos, maxlen - pos);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = this->scale._decodeNoHash(buf, offset + pos, maxlen - pos);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = this->color._decodeNoHash(buf, offset + pos, maxlen - pos);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = __boolean_decode_array(buf, offset + pos, maxlen - pos, &this->override_color, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    int32_t __url_len__;
+    tlen = __int32_t_decode_array(
+        buf, offset + pos, maxlen - pos, &__url_len__, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+    if(__url_len__ < 1 || __url_len__ > maxlen - pos) return -1;
+    this->url.assign(
+        static_cast<const char*>(buf) + offset + pos, __url_len__ - 1);
+    pos += __url_len__;
+
+    int32_t __media_type_len__;
+    tlen = __int32_t_decode_array(
+        buf, offset + pos, maxlen - pos, &__media_type_len__, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+    if(__media_type_len__ < 1 || __media_type_len__ > maxlen - pos) return -1;
+    this->media_type.assign(
+        static_cast<const char*>(buf) + offset + pos, __media_type_len__ - 1);
+    pos += __media_type_len__;
+
+    if(this->data_length) {
+        if(this->data_length < 0 || this->data_length > maxlen - pos || this->data_length > maxArrayLength) return -1;
+        const uint8_t *__data_src__ = static_cast<const uint8_t*>(buf) + offset + pos;
+        this->data.assign(__data_src__, __data_src__ + this->data_length);
+        pos += this->data_length;
+    } else {
+        this->data.clear();
+    }
+
+    return pos;
+}
+
+template <uint64_t Mask>
+int ModelPrimitive::_decodeFieldsNoHash(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, tlen;
+
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &this->data_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    if ((Mask & Fields::pose) != 0) {
+        tlen = this->pose._decodeNoHash(buf, offset + pos, maxlen - pos);
+        if(tlen < 0) return tlen; else pos += tlen;
+    } else {
+        tlen = geometry_msgs::Pose::_skipNoHash(buf, offset + pos, maxlen - pos);
+        if(tlen < 0) return tlen; else pos += tlen;
+    }
+
+    if ((Mask & Fields::scale) != 0) {
+        tlen = this->scale._decodeNoHash(buf, offset + pos, maxlen - pos);
+        if(tlen < 0) return tlen; else pos += tlen;
+    } else {
+        tlen = geometry_msgs::Vector3::_skipNoHash(buf, offset + pos, maxlen - pos);
+        if(tlen < 0) return tlen; else pos += tlen;
+    }
+
+    if ((Mask & Fields::color) != 0) {
+        tlen = this->color._decodeNoHash(buf, offset + pos, maxlen - pos);
+        if(tlen < 0) return tlen; else pos += tlen;
+    } else {
+        tlen = foxglove_msgs::Color::_skipNoHash(buf, offset + pos, maxlen - pos);
+        if(tlen < 0) return tlen; else pos += tlen;
+    }
+
+    tlen = __boolean_decode_array(buf, offset + pos, maxlen - pos, &this->override_color, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    if ((Mask & Fields::url) != 0) {
+        int32_t __url_len__;
+        tlen = __int32_t_decode_array(
+            buf, offset + pos, maxlen - pos, &__url_len__, 1);
+        if(tlen < 0) return tlen; else pos += tlen;
+        if(__url_len__ < 1 || __url_len__ > maxlen - pos) return -1;
+        this->url.assign(
+            static_cast<const char*>(buf) + offset + pos, __url_len__ - 1);
+        pos += __url_len__;
+    } else {
+        int32_t __url_len__;
+        tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &__url_len__, 1);
+        if(tlen < 0) return tlen; else pos += tlen;
+        if(__url_len__ < 0 || __url_len__ > maxlen - pos) return -1;
+        pos += __url_len__;
+    }
+
+    if ((Mask & Fields::media_type) != 0) {
+        int32_t __media_type_len__;
+        tlen = __int32_t_decode_array(
+            buf, offset + pos, maxlen - pos, &__media_type_len__, 1);
+        if(tlen < 0) return tlen; else pos += tlen;
+        if(__media_type_len__ < 1 || __media_type_len__ > maxlen - pos) return -1;
+        this->media_type.assign(
+            static_cast<const char*>(buf) + offset + pos, __media_type_len__ - 1);
+        pos += __media_type_len__;
+    } else {
+        int32_t __media_type_len__;
+        tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &__media_type_len__, 1);
+        if(tlen < 0) return tlen; else pos += tlen;
+        if(__media_type_len__ < 0 || __media_type_len__ > maxlen - pos) return -1;
+        pos += __media_type_len__;
+    }
+
+    if ((Mask & Fields::data) != 0) {
+        if(this->data_length) {
+            if(this->data_length < 0 || this->data_length > maxlen - pos || this->data_length > maxArrayLength) return -1;
+            const uint8_t *__data_src__ = static_cast<const uint8_t*>(buf) + offset + pos;
+            this->data.assign(__data_src__, __data_src__ + this->data_length);
+            pos += this->data_length;
+        } else {
+            this->data.clear();
+        }
+    } else {
+        if(this->data_length < 0 || this->data_length > maxlen - pos) return -1;
+        pos += this->data_length;
+    }
+
+    return pos;
+}
+
+int ModelPrimitive::_getEncodedSizeNoHash() const
+{
+    int enc_size = 0;
+    enc_size += __int32_t_encoded_array_size(NULL, 1);
+    enc_size += this->pose._getEncodedSizeNoHash();
+    enc_size += this->scale._getEncodedSizeNoHash();
+    enc_size += this->color._getEncodedSizeNoHash();
+    enc_size += __boolean_encoded_array_size(NULL, 1);
+    enc_size += this->url.size() + 4 + 1;
+    enc_size += this->media_type.size() + 4 + 1;
+    enc_size += __byte_encoded_array_size(NULL, this->data_length);
+    return enc_size;
+}
+
+int ModelPrimitive::_skipNoHash(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, tlen;
+    int32_t data_length;
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &data_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+    tlen = geometry_msgs::Pose::_skipNoHash(buf, offset + pos, maxlen - pos);
+    if(tlen < 0) return tlen; else pos += tlen;
+    tlen = geometry_msgs::Vector3::_skipNoHash(buf, offset + pos, maxlen - pos);
+    if(tlen < 0) return tlen; else pos += tlen;
+    tlen = foxglove_msgs::Color::_skipNoHash(buf, offset + pos, maxlen - pos);
+    if(tlen < 0) return tlen; else pos += tlen;
+    pos += 1;
+    int32_t __url_len__;
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &__url_len__, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+    if(__url_len__ < 0 || __url_len__ > maxlen - pos) return -1;
+    pos += __url_len__;
+    int32_t __media_type_len__;
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &__media_type_len__, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+    if(__media_type_len__ < 0 || __media_type_len__ > maxlen - pos) return -1;
+    pos += __media_type_len__;
+    if(data_length < 0 || data_length > maxlen - pos) return -1;
+    pos += data_length;
+    if(pos > maxlen) return -1;
+    return pos;
+}
+
+template <typename Self, typename Visitor>
+void ModelPrimitive::_forEachField(Self &self, Visitor &visitor)
+{
+    visitor(kFields[0], self.data_length);
+    visitor(kFields[1], self.pose);
+    visitor(kFields[2], self.scale);
+    visitor(kFields[3], self.color);
+    visitor(kFields[4], self.override_color);
+    visitor(kFields[5], self.url);
+    visitor(kFields[6], self.media_type);
+    visitor(kFields[7], self.data);
+}
+
+uint64_t ModelPrimitive::_computeHash(const __lcm_hash_ptr *p)
+{
+    const __lcm_hash_ptr *fp;
+    for(fp = p; fp != NULL; fp = fp->parent)
+        if(fp->v == ModelPrimitive::getHash)
+            return 0;
+    const __lcm_hash_ptr cp = { p, ModelPrimitive::getHash };
+
+    uint64_t hash = 0x23cd41ba898fa1faLL +
+         geometry_msgs::Pose::_computeHash(&cp) +
+         geometry_msgs::Vector3::_computeHash(&cp) +
+         foxglove_msgs::Color::_computeHash(&cp);
+
+    return (hash<<1) + ((hash>>63)&1);
+}
+
+}
+}
+
+#endif
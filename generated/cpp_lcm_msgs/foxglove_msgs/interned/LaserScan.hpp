@@ -0,0 +1,530 @@
+/** THIS IS AN AUTOMATICALLY GENERATED FILE.  DO NOT MODIFY
+ * BY HAND!!
+ *
+ * Generated by lcm-cpp (tools/cpp/gen)
+ **/
+
+#ifndef __foxglove_msgs_interned_LaserScan_hpp__
+#define __foxglove_msgs_interned_LaserScan_hpp__
+
+#include <lcm/lcm_coretypes.h>
+
+#include <array>
+#include <string>
+#include <vector>
+#include "dimos_lcm/bulk_codec.hpp"
+#include "dimos_lcm/interned_string.hpp"
+#include "dimos_lcm/writer.hpp"
+#include "dimos_lcm/fingerprint.hpp"
+#include "dimos_lcm/reflection.hpp"
+#include "builtin_interfaces/Time.hpp"
+#include "geometry_msgs/Pose.hpp"
+
+namespace foxglove_msgs
+{
+namespace interned
+{
+
+class LaserScan
+{
+    public:
+        int32_t    ranges_length;
+
+        int32_t    intensities_length;
+
+        builtin_interfaces::Time timestamp;
+
+        dimos_lcm::interned_string frame_id;
+
+        geometry_msgs::Pose pose;
+
+        double     start_angle;
+
+        double     end_angle;
+
+        /**
+         * LCM Type: double[ranges_length]
+         */
+        std::vector< double > ranges;
+
+        /**
+         * LCM Type: double[intensities_length]
+         */
+        std::vector< double > intensities;
+
+    public:
+        /**
+         * Encode a message into binary form.
+         *
+         * @param buf The output buffer.
+         * @param offset Encoding starts at thie byte offset into @p buf.
+         * @param maxlen Maximum number of bytes to write.  This should generally be
+         *  equal to getEncodedSize().
+         * @return The number of bytes encoded, or <0 on error.
+         */
+        inline int encode(void *buf, int offset, int maxlen) const;
+
+        /**
+         * Encode a message by appending it to @p buf, walking the message once
+         * instead of sizing it with getEncodedSize() first. @p buf grows
+         * geometrically; reuse it across calls to avoid reallocating.
+         *
+         * @return The number of bytes appended.
+         */
+        inline int encodeTo(std::vector<uint8_t> &buf) const;
+
+        /**
+         * Check how many bytes are required to encode this message.
+         */
+        inline int getEncodedSize() const;
+
+        /**
+         * Decode a message from binary form into this instance.
+         *
+         * @param buf The buffer containing the encoded message.
+         * @param offset The byte offset into @p buf where the encoded message starts.
+         * @param maxlen The maximum number of bytes to read while decoding.
+         * @return The number of bytes decoded, or <0 if an error occured.
+         */
+        inline int decode(const void *buf, int offset, int maxlen);
+
+        /**
+         * Field bits for decodeFields().
+         */
+        struct Fields
+        {
+            static constexpr uint64_t ranges_length = 1ULL << 0;
+            static constexpr uint64_t intensities_length = 1ULL << 1;
+            static constexpr uint64_t timestamp = 1ULL << 2;
+            static constexpr uint64_t frame_id = 1ULL << 3;
+            static constexpr uint64_t pose = 1ULL << 4;
+            static constexpr uint64_t start_angle = 1ULL << 5;
+            static constexpr uint64_t end_angle = 1ULL << 6;
+            static constexpr uint64_t ranges = 1ULL << 7;
+            static constexpr uint64_t intensities = 1ULL << 8;
+            static constexpr uint64_t all = (1ULL << 9) - 1;
+        };
+
+        /**
+         * Decode only the fields selected by @p Mask, a bitwise or of Fields
+         * values. Strings, arrays and nested structs that are not selected are
+         * skipped over by their length prefixes without being allocated, and
+         * keep their previous value. Scalar fields are always decoded: they
+         * cost nothing to read and array lengths depend on them.
+         *
+         * @return The number of bytes decoded, or <0 if an error occured.
+         */
+        template <uint64_t Mask>
+        inline int decodeFields(const void *buf, int offset, int maxlen);
+
+        /**
+         * Upper bound on the length of every variable-length array of this
+         * type, checked by decode() before anything is allocated; messages
+         * exceeding it fail to decode. It does not apply to nested types,
+         * which have their own. Set it once at startup, before decoding.
+         * Before C++17 it is a constant with no limit.
+         */
+#if __cplusplus >= 201703L
+        static inline int32_t maxArrayLength = INT32_MAX;
+#else
+        static constexpr int32_t maxArrayLength = INT32_MAX;
+#endif
+
+        /**
+         * Retrieve the 64-bit fingerprint identifying the structure of the message.
+         * Note that the fingerprint is the same for all instances of the same
+         * message type, and is a fingerprint on the message type definition, not on
+         * the message contents.
+         */
+        inline static int64_t getHash();
+
+        /**
+         * The fingerprint returned by getHash(), as a compile-time constant.
+         */
+        static constexpr int64_t kHash = static_cast<int64_t>(0x2778dfee54ded5fdULL);
+
+        /**
+         * Returns "LaserScan"
+         */
+        inline static const char* getTypeName();
+
+        /**
+         * Name, LCM type and array dimensions of each field, in wire order.
+         * See dimos_lcm::for_each_field() for visiting the fields themselves.
+         */
+        static constexpr std::array<dimos_lcm::field_info, 9> kFields = {{
+            { "ranges_length", "int32_t", true, 0, 0, NULL },
+            { "intensities_length", "int32_t", true, 0, 0, NULL },
+            { "timestamp", "builtin_interfaces.Time", false, 0, 0, NULL },
+            { "frame_id", "string", true, 0, 0, NULL },
+            { "pose", "geometry_msgs.Pose", false, 0, 0, NULL },
+            { "start_angle", "double", true, 0, 0, NULL },
+            { "end_angle", "double", true, 0, 0, NULL },
+            { "ranges", "double", true, 1, -1, "ranges_length" },
+            { "intensities", "double", true, 1, -1, "intensities_length" },
+        }};
+
+        // LCM support functions. Users should not call these
+        inline int _encodeNoHash(void *buf, int offset, int maxlen) const;
+        template <typename Writer>
+        inline void _writeNoHash(Writer &out) const;
+        inline int _getEncodedSizeNoHash() const;
+        inline int _decodeNoHash(const void *buf, int offset, int maxlen);
+        template <uint64_t Mask>
+        inline int _decodeFieldsNoHash(const void *buf, int offset, int maxlen);
+        template <typename Self, typename Visitor>
+        inline static void _forEachField(Self &self, Visitor &visitor);
+        inline static int _skipNoHash(const void *buf, int offset, int maxlen);
+        inline static uint64_t _computeHash(const __lcm_hash_ptr *p);
+};
+
+static_assert(LaserScan::kHash == dimos_lcm::fingerprint(
+    dimos_lcm::signature_hash()
+        .member("ranges_length", "int32_t", 0)
+        .member("intensities_length", "int32_t", 0)
+        .member("timestamp", NULL, 0)
+        .member("frame_id", "string", 0)
+        .member("pose", NULL, 0)
+        .member("start_angle", "double", 0)
+        .member("end_angle", "double", 0)
+        .member("ranges", "double", 1).dim(true, "ranges_length")
+        .member("intensities", "double", 1).dim(true, "intensities_length")
+        .value(),
+    builtin_interfaces::Time::kHash,
+    geometry_msgs::Pose::kHash),
+    "foxglove_msgs::interned::LaserScan fingerprint does not match its definition");
+
+int LaserScan::encode(void *buf, int offset, int maxlen) const
+{
+    int pos = 0, tlen;
+    int64_t hash = getHash();
+
+    tlen = __int64_t_encode_array(buf, offset + pos, maxlen - pos, &hash, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = this->_encodeNoHash(buf, offset + pos, maxlen - pos);
+    if (tlen < 0) return tlen; else pos += tlen;
+
+    return pos;
+}
+
+int LaserScan::encodeTo(std::vector<uint8_t> &buf) const
+{
+    dimos_lcm::vector_writer out(buf);
+    int64_t hash = getHash();
+    out.put(&hash, 1);
+    this->_writeNoHash(out);
+    return static_cast<int>(out.size());
+}
+
+int LaserScan::decode(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, thislen;
+
+    int64_t msg_hash;
+    thislen = __int64_t_decode_array(buf, offset + pos, maxlen - pos, &msg_hash, 1);
+    if (thislen < 0) return thislen; else pos += thislen;
+    if (msg_hash != getHash()) return -1;
+
+    thislen = this->_decodeNoHash(buf, offset + pos, maxlen - pos);
+    if (thislen < 0) return thislen; else pos += thislen;
+
+    return pos;
+}
+
+template <uint64_t Mask>
+int LaserScan::decodeFields(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, thislen;
+
+    int64_t msg_hash;
+    thislen = __int64_t_decode_array(buf, offset + pos, maxlen - pos, &msg_hash, 1);
+    if (thislen < 0) return thislen; else pos += thislen;
+    if (msg_hash != getHash()) return -1;
+
+    thislen = this->_decodeFieldsNoHash<Mask>(buf, offset + pos, maxlen - pos);
+    if (thislen < 0) return thislen; else pos += thislen;
+
+    return pos;
+}
+
+int LaserScan::getEncodedSize() const
+{
+    return 8 + _getEncodedSizeNoHash();
+}
+
+int64_t LaserScan::getHash()
+{
+    return kHash;
+}
+
+const char* LaserScan::getTypeName()
+{
+    return "LaserScan";
+}
+
+int LaserScan::_encodeNoHash(void *buf, int offset, int maxlen) const
+{
+    int pos = 0, tlen;
+
+    tlen = __int32_t_encode_array(buf, offset + pos, maxlen - pos, &this->ranges_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = __int32_t_encode_array(buf, offset + pos, maxlen - pos, &this->intensities_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = this->timestamp._encodeNoHash(buf, offset + pos, maxlen - pos);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    char* frame_id_cstr = const_cast<char*>(this->frame_id.c_str());
+    tlen = __string_encode_array(
+        buf, offset + pos, maxlen - pos, &frame_id_cstr, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = this->pose._encodeNoHash(buf, offset + pos, maxlen - pos);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = __double_encode_array(buf, offset + pos, maxlen - pos, &this->start_angle, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = __double_encode_array(buf, offset + pos, maxlen - pos, &this->end_angle, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    if(this->ranges_length > 0) {
+        tlen = dimos_lcm::bulk_encode_array(buf, offset + pos, maxlen - pos, &this->ranges[0], this->ranges_length);
+        if(tlen < 0) return tlen; else pos += tlen;
+    }
+
+    if(this->intensities_length > 0) {
+        tlen = dimos_lcm::bulk_encode_array(buf, offset + pos, maxlen - pos, &this->intensities[0], this->intensities_length);
+        if(tlen < 0) return tlen; else pos += tlen;
+    }
+
+    return pos;
+}
+
+template <typename Writer>
+void LaserScan::_writeNoHash(Writer &out) const
+{
+    out.put(&this->ranges_length, 1);
+    out.put(&this->intensities_length, 1);
+    this->timestamp._writeNoHash(out);
+    out.put(this->frame_id);
+    this->pose._writeNoHash(out);
+    out.put(&this->start_angle, 1);
+    out.put(&this->end_angle, 1);
+    if(this->ranges_length > 0)
+        out.put(&this->ranges[0], this->ranges_length);
+    if(this->intensities_length > 0)
+        out.put(&this->intensities[0], this->intensities_length);
+}
+
+int LaserScan::_decodeNoHash(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, tlen;
+
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &this->ranges_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &this->intensities_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = this->timestamp._decodeNoHash(buf, offset + pos, maxlen - pos);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    int32_t __frame_id_len__;
+    tlen = __int32_t_decode_array(
+        buf, offset + pos, maxlen - pos, &__frame_id_len__, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+    if(__frame_id_len__ < 1 || __frame_id_len__ > maxlen - pos) return -1;
+    this->frame_id.assign(
+        static_cast<const char*>(buf) + offset + pos, __frame_id_len__ - 1);
+    pos += __frame_id_len__;
+
+    tlen = this->pose._decodeNoHash(buf, offset + pos, maxlen - pos);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = __double_decode_array(buf, offset + pos, maxlen - pos, &this->start_angle, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = __double_decode_array(buf, offset + pos, maxlen - pos, &this->end_angle, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    if(this->ranges_length) {
+        if(this->ranges_length < 0 || this->ranges_length > (maxlen - pos) / 8 || this->ranges_length > maxArrayLength) return -1;
+        this->ranges.resize(this->ranges_length);
+        tlen = dimos_lcm::bulk_decode_array(buf, offset + pos, maxlen - pos, &this->ranges[0], this->ranges_length);
+        if(tlen < 0) return tlen; else pos += tlen;
+    } else {
+        this->ranges.clear();
+    }
+
+    if(this->intensities_length) {
+        if(this->intensities_length < 0 || this->intensities_length > (maxlen - pos) / 8 || this->intensities_length > maxArrayLength) return -1;
+        this->intensities.resize(this->intensities_length);
+        tlen = dimos_lcm::bulk_decode_array(buf, offset + pos, maxlen - pos, &this->intensities[0], this->intensities_length);
+        if(tlen < 0) return tlen; else pos += tlen;
+    } else {
+        this->intensities.clear();
+    }
+
+    return pos;
+}
+
+template <uint64_t Mask>
+int LaserScan::_decodeFieldsNoHash(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, tlen;
+
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &this->ranges_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &this->intensities_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    if ((Mask & Fields::timestamp) != 0) {
+        tlen = this->timestamp._decodeNoHash(buf, offset + pos, maxlen - pos);
+        if(tlen < 0) return tlen; else pos += tlen;
+    } else {
+        tlen = builtin_interfaces::Time::_skipNoHash(buf, offset + pos, maxlen - pos);
+        if(tlen < 0) return tlen; else pos += tlen;
+    }
+
+    if ((Mask & Fields::frame_id) != 0) {
+        int32_t __frame_id_len__;
+        tlen = __int32_t_decode_array(
+            buf, offset + pos, maxlen - pos, &__frame_id_len__, 1);
+        if(tlen < 0) return tlen; else pos += tlen;
+        if(__frame_id_len__ < 1 || __frame_id_len__ > maxlen - pos) return -1;
+        this->frame_id.assign(
+            static_cast<const char*>(buf) + offset + pos, __frame_id_len__ - 1);
+        pos += __frame_id_len__;
+    } else {
+        int32_t __frame_id_len__;
+        tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &__frame_id_len__, 1);
+        if(tlen < 0) return tlen; else pos += tlen;
+        if(__frame_id_len__ < 0 || __frame_id_len__ > maxlen - pos) return -1;
+        pos += __frame_id_len__;
+    }
+
+    if ((Mask & Fields::pose) != 0) {
+        tlen = this->pose._decodeNoHash(buf, offset + pos, maxlen - pos);
+        if(tlen < 0) return tlen; else pos += tlen;
+    } else {
+        tlen = geometry_msgs::Pose::_skipNoHash(buf, offset + pos, maxlen - pos);
+        if(tlen < 0) return tlen; else pos += tlen;
+    }
+
+    tlen = __double_decode_array(buf, offset + pos, maxlen - pos, &this->start_angle, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = __double_decode_array(buf, offset + pos, maxlen - pos, &this->end_angle, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    if ((Mask & Fields::ranges) != 0) {
+        if(this->ranges_length) {
+            if(this->ranges_length < 0 || this->ranges_length > (maxlen - pos) / 8 || this->ranges_length > maxArrayLength) return -1;
+            this->ranges.resize(this->ranges_length);
+            tlen = dimos_lcm::bulk_decode_array(buf, offset + pos, maxlen - pos, &this->ranges[0], this->ranges_length);
+            if(tlen < 0) return tlen; else pos += tlen;
+        } else {
+            this->ranges.clear();
+        }
+    } else {
+        if(this->ranges_length < 0 || this->ranges_length > (maxlen - pos) / 8) return -1;
+        pos += this->ranges_length * 8;
+    }
+
+    if ((Mask & Fields::intensities) != 0) {
+        if(this->intensities_length) {
+            if(this->intensities_length < 0 || this->intensities_length > (maxlen - pos) / 8 || this->intensities_length > maxArrayLength) return -1;
+            this->intensities.resize(this->intensities_length);
+            tlen = dimos_lcm::bulk_decode_array(buf, offset + pos, maxlen - pos, &this->intensities[0], this->intensities_length);
+            if(tlen < 0) return tlen; else pos += tlen;
+        } else {
+            this->intensities.clear();
+        }
+    } else {
+        if(this->intensities_length < 0 || this->intensities_length > (maxlen - pos) / 8) return -1;
+        pos += this->intensities_length * 8;
+    }
+
+    return pos;
+}
+
+int LaserScan::_getEncodedSizeNoHash() const
+{
+    int enc_size = 0;
+    enc_size += __int32_t_encoded_array_size(NULL, 1);
+    enc_size += __int32_t_encoded_array_size(NULL, 1);
+    enc_size += this->timestamp._getEncodedSizeNoHash();
+    enc_size += this->frame_id.size() + 4 + 1;
+    enc_size += this->pose._getEncodedSizeNoHash();
+    enc_size += __double_encoded_array_size(NULL, 1);
+    enc_size += __double_encoded_array_size(NULL, 1);
+    enc_size += __double_encoded_array_size(NULL, this->ranges_length);
+    enc_size += __double_encoded_array_size(NULL, this->intensities_length);
+    return enc_size;
+}
+
+int LaserScan::_skipNoHash(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, tlen;
+    int32_t ranges_length;
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &ranges_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+    int32_t intensities_length;
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &intensities_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+    tlen = builtin_interfaces::Time::_skipNoHash(buf, offset + pos, maxlen - pos);
+    if(tlen < 0) return tlen; else pos += tlen;
+    int32_t __frame_id_len__;
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &__frame_id_len__, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+    if(__frame_id_len__ < 0 || __frame_id_len__ > maxlen - pos) return -1;
+    pos += __frame_id_len__;
+    tlen = geometry_msgs::Pose::_skipNoHash(buf, offset + pos, maxlen - pos);
+    if(tlen < 0) return tlen; else pos += tlen;
+    pos += 8;
+    pos += 8;
+    if(ranges_length < 0 || ranges_length > (maxlen - pos) / 8) return -1;
+    pos += ranges_length * 8;
+    if(intensities_length < 0 || intensities_length > (maxlen - pos) / 8) return -1;
+    pos += intensities_length * 8;
+    if(pos > maxlen) return -1;
+    return pos;
+}
+
+template <typename Self, typename Visitor>
+void LaserScan::_forEachField(Self &self, Visitor &visitor)
+{
+    visitor(kFields[0], self.ranges_length);
+    visitor(kFields[1], self.intensities_length);
+    visitor(kFields[2], self.timestamp);
+    visitor(kFields[3], self.frame_id);
+    visitor(kFields[4], self.pose);
+    visitor(kFields[5], self.start_angle);
+    visitor(kFields[6], self.end_angle);
+    visitor(kFields[7], self.ranges);
+    visitor(kFields[8], self.intensities);
+}
+
+uint64_t LaserScan::_computeHash(const __lcm_hash_ptr *p)
+{
+    const __lcm_hash_ptr *fp;
+    for(fp = p; fp != NULL; fp = fp->parent)
+        if(fp->v == LaserScan::getHash)
+            return 0;
+    const __lcm_hash_ptr cp = { p, LaserScan::getHash };
+
+    uint64_t hash = 0x22e7c769ba6a90c2LL +
+         builtin_interfaces::Time::_computeHash(&cp) +
+         geometry_msgs::Pose::_computeHash(&cp);
+
+    return (hash<<1) + ((hash>>63)&1);
+}
+
+}
+}
+
+#endif
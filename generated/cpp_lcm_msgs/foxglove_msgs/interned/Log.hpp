@@ -0,0 +1,484 @@
+/** THIS IS AN AUTOMATICALLY GENERATED FILE.  DO NOT MODIFY
+ * BY HAND!!
+ *
+ * Generated by lcm-cpp (tools/cpp/gen)
+ **/
+
+#ifndef __foxglove_msgs_interned_Log_hpp__
+#define __foxglove_msgs_interned_Log_hpp__
+
+#include <lcm/lcm_coretypes.h>
+
+#include <array>
+#include <string>
+#include "dimos_lcm/interned_string.hpp"
+#include "dimos_lcm/writer.hpp"
+#include "dimos_lcm/fingerprint.hpp"
+#include "dimos_lcm/reflection.hpp"
+#include "builtin_interfaces/Time.hpp"
+
+namespace foxglove_msgs
+{
+namespace interned
+{
+
+class Log
+{
+    public:
+        builtin_interfaces::Time timestamp;
+
+        uint8_t    level;
+
+        std::string message;
+
+        dimos_lcm::interned_string name;
+
+        std::string file;
+
+        int32_t    line;
+
+    public:
+        // If you're using C++11 and are getting compiler errors saying
+        // things like ‘constexpr’ needed for in-class initialization of
+        // static data member then re-run lcm-gen with '--cpp-std=c++11'
+        // to generate code that is compliant with C++11
+        static const int8_t   UNKNOWN = 0;
+        // If you're using C++11 and are getting compiler errors saying
+        // things like ‘constexpr’ needed for in-class initialization of
+        // static data member then re-run lcm-gen with '--cpp-std=c++11'
+        // to generate code that is compliant with C++11
+        static const int8_t   DEBUG = 1;
+        // If you're using C++11 and are getting compiler errors saying
+        // things like ‘constexpr’ needed for in-class initialization of
+        // static data member then re-run lcm-gen with '--cpp-std=c++11'
+        // to generate code that is compliant with C++11
+        static const int8_t   INFO = 2;
+        // If you're using C++11 and are getting compiler errors saying
+        // things like ‘constexpr’ needed for in-class initialization of
+        // static data member then re-run lcm-gen with '--cpp-std=c++11'
+        // to generate code that is compliant with C++11
+        static const int8_t   WARNING = 3;
+        // If you're using C++11 and are getting compiler errors saying
+        // things like ‘constexpr’ needed for in-class initialization of
+        // static data member then re-run lcm-gen with '--cpp-std=c++11'
+        // to generate code that is compliant with C++11
+        static const int8_t   ERROR = 4;
+        // If you're using C++11 and are getting compiler errors saying
+        // things like ‘constexpr’ needed for in-class initialization of
+        // static data member then re-run lcm-gen with '--cpp-std=c++11'
+        // to generate code that is compliant with C++11
+        static const int8_t   FATAL = 5;
+
+    public:
+        /**
+         * Encode a message into binary form.
+         *
+         * @param buf The output buffer.
+         * @param offset Encoding starts at thie byte offset into @p buf.
+         * @param maxlen Maximum number of bytes to write.  This should generally be
+         *  equal to getEncodedSize().
+         * @return The number of bytes encoded, or <0 on error.
+         */
+        inline int encode(void *buf, int offset, int maxlen) const;
+
+        /**
+         * Encode a message by appending it to @p buf, walking the message once
+         * instead of sizing it with getEncodedSize() first. @p buf grows
+         * geometrically; reuse it across calls to avoid reallocating.
+         *
+         * @return The number of bytes appended.
+         */
+        inline int encodeTo(std::vector<uint8_t> &buf) const;
+
+        /**
+         * Check how many bytes are required to encode this message.
+         */
+        inline int getEncodedSize() const;
+
+        /**
+         * Decode a message from binary form into this instance.
+         *
+         * @param buf The buffer containing the encoded message.
+         * @param offset The byte offset into @p buf where the encoded message starts.
+         * @param maxlen The maximum number of bytes to read while decoding.
+         * @return The number of bytes decoded, or <0 if an error occured.
+         */
+        inline int decode(const void *buf, int offset, int maxlen);
+
+        /**
+         * Field bits for decodeFields().
+         */
+        struct Fields
+        {
+            static constexpr uint64_t timestamp = 1ULL << 0;
+            static constexpr uint64_t level = 1ULL << 1;
+            static constexpr uint64_t message = 1ULL << 2;
+            static constexpr uint64_t name = 1ULL << 3;
+            static constexpr uint64_t file = 1ULL << 4;
+            static constexpr uint64_t line = 1ULL << 5;
+            static constexpr uint64_t all = (1ULL << 6) - 1;
+        };
+
+        /**
+         * Decode only the fields selected by @p Mask, a bitwise or of Fields
+         * values. Strings, arrays and nested structs that are not selected are
+         * skipped over by their length prefixes without being allocated, and
+         * keep their previous value. Scalar fields are always decoded: they
+         * cost nothing to read and array lengths depend on them.
+         *
+         * @return The number of bytes decoded, or <0 if an error occured.
+         */
+        template <uint64_t Mask>
+        inline int decodeFields(const void *buf, int offset, int maxlen);
+
+        /**
+         * Retrieve the 64-bit fingerprint identifying the structure of the message.
+         * Note that the fingerprint is the same for all instances of the same
+         * message type, and is a fingerprint on the message type definition, not on
+         * the message contents.
+         */
+        inline static int64_t getHash();
+
+        /**
+         * The fingerprint returned by getHash(), as a compile-time constant.
+         */
+        static constexpr int64_t kHash = static_cast<int64_t>(0x5d78444967c8011bULL);
+
+        /**
+         * Returns "Log"
+         */
+        inline static const char* getTypeName();
+
+        /**
+         * Name, LCM type and array dimensions of each field, in wire order.
+         * See dimos_lcm::for_each_field() for visiting the fields themselves.
+         */
+        static constexpr std::array<dimos_lcm::field_info, 6> kFields = {{
+            { "timestamp", "builtin_interfaces.Time", false, 0, 0, NULL },
+            { "level", "byte", true, 0, 0, NULL },
+            { "message", "string", true, 0, 0, NULL },
+            { "name", "string", true, 0, 0, NULL },
+            { "file", "string", true, 0, 0, NULL },
+            { "line", "int32_t", true, 0, 0, NULL },
+        }};
+
+        // LCM support functions. Users should not call these
+        inline int _encodeNoHash(void *buf, int offset, int maxlen) const;
+        template <typename Writer>
+        inline void _writeNoHash(Writer &out) const;
+        inline int _getEncodedSizeNoHash() const;
+        inline int _decodeNoHash(const void *buf, int offset, int maxlen);
+        template <uint64_t Mask>
+        inline int _decodeFieldsNoHash(const void *buf, int offset, int maxlen);
+        template <typename Self, typename Visitor>
+        inline static void _forEachField(Self &self, Visitor &visitor);
+        inline static int _skipNoHash(const void *buf, int offset, int maxlen);
+        inline static uint64_t _computeHash(const __lcm_hash_ptr *p);
+};
+
+static_assert(Log::kHash == dimos_lcm::fingerprint(
+    dimos_lcm::signature_hash()
+        .member("timestamp", NULL, 0)
+        .member("level", "byte", 0)
+        .member("message", "string", 0)
+        .member("name", "string", 0)
+        .member("file", "string", 0)
+        .member("line", "int32_t", 0)
+        .value(),
+    builtin_interfaces::Time::kHash),
+    "foxglove_msgs::interned::Log fingerprint does not match its definition");
+
+int Log::encode(void *buf, int offset, int maxlen) const
+{
+    int pos = 0, tlen;
+    int64_t hash = getHash();
+
+    tlen = __int64_t_encode_array(buf, offset + pos, maxlen - pos, &hash, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = this->_encodeNoHash(buf, offset + pos, maxlen - pos);
+    if (tlen < 0) return tlen; else pos += tlen;
+
+    return pos;
+}
+
+int Log::encodeTo(std::vector<uint8_t> &buf) const
+{
+    dimos_lcm::vector_writer out(buf);
+    int64_t hash = getHash();
+    out.put(&hash, 1);
+    this->_writeNoHash(out);
+    return static_cast<int>(out.size());
+}
+
+int Log::decode(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, thislen;
+
+    int64_t msg_hash;
+    thislen = __int64_t_decode_array(buf, offset + pos, maxlen - pos, &msg_hash, 1);
+    if (thislen < 0) return thislen; else pos += thislen;
+    if (msg_hash != getHash()) return -1;
+
+    thislen = this->_decodeNoHash(buf, offset + pos, maxlen - pos);
+    if (thislen < 0) return thislen; else pos += thislen;
+
+    return pos;
+}
+
+template <uint64_t Mask>
+int Log::decodeFields(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, thislen;
+
+    int64_t msg_hash;
+    thislen = __int64_t_decode_array(buf, offset + pos, maxlen - pos, &msg_hash, 1);
+    if (thislen < 0) return thislen; else pos += thislen;
+    if (msg_hash != getHash()) return -1;
+
+    thislen = this->_decodeFieldsNoHash<Mask>(buf, offset + pos, maxlen - pos);
+    if (thislen < 0) return thislen; else pos += thislen;
+
+    return pos;
+}
+
+int Log::getEncodedSize() const
+{
+    return 8 + _getEncodedSizeNoHash();
+}
+
+int64_t Log::getHash()
+{
+    return kHash;
+}
+
+const char* Log::getTypeName()
+{
+    return "Log";
+}
+
+int Log::_encodeNoHash(void *buf, int offset, int maxlen) const
+{
+    int pos = 0, tlen;
+
+    tlen = this->timestamp._encodeNoHash(buf, offset + pos, maxlen - pos);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = __byte_encode_array(buf, offset + pos, maxlen - pos, &this->level, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    char* message_cstr = const_cast<char*>(this->message.c_str());
+    tlen = __string_encode_array(
+        buf, offset + pos, maxlen - pos, &message_cstr, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    char* name_cstr = const_cast<char*>(this->name.c_str());
+    tlen = __string_encode_array(
+        buf, offset + pos, maxlen - pos, &name_cstr, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    char* file_cstr = const_cast<char*>(this->file.c_str());
+    tlen = __string_encode_array(
+        buf, offset + pos, maxlen - pos, &file_cstr, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = __int32_t_encode_array(buf, offset + pos, maxlen - pos, &this->line, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    return pos;
+}
+
+template <typename Writer>
+void Log::_writeNoHash(Writer &out) const
+{
+    this->timestamp._writeNoHash(out);
+    out.put(&this->level, 1);
+    out.put(this->message);
+    out.put(this->name);
+    out.put(this->file);
+    out.put(&this->line, 1);
+}
+
+int Log::_decodeNoHash(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, tlen;
+
+    tlen = this->timestamp._decodeNoHash(buf, offset + pos, maxlen - pos);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = __byte_decode_array(buf, offset + pos, maxlen - pos, &this->level, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    int32_t __message_len__;
+    tlen = __int32_t_decode_array(
+        buf, offset + pos, maxlen - pos, &__message_len__, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+    if(__message_len__ < 1 || __message_len__ > maxlen - pos) return -1;
+    this->message.assign(
+        static_cast<const char*>(buf) + offset + pos, __message_len__ - 1);
+    pos += __message_len__;
+
+    int32_t __name_len__;
+    tlen = __int32_t_decode_array(
+        buf, offset + pos, maxlen - pos, &__name_len__, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+    if(__name_len__ < 1 || __name_len__ > maxlen - pos) return -1;
+    this->name.assign(
+        static_cast<const char*>(buf) + offset + pos, __name_len__ - 1);
+    pos += __name_len__;
+
+    int32_t __file_len__;
+    tlen = __int32_t_decode_array(
+        buf, offset + pos, maxlen - pos, &__file_len__, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+    if(__file_len__ < 1 || __file_len__ > maxlen - pos) return -1;
+    this->file.assign(
+        static_cast<const char*>(buf) + offset + pos, __file_len__ - 1);
+    pos += __file_len__;
+
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &this->line, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    return pos;
+}
+
+template <uint64_t Mask>
+int Log::_decodeFieldsNoHash(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, tlen;
+
+    if ((Mask & Fields::timestamp) != 0) {
+        tlen = this->timestamp._decodeNoHash(buf, offset + pos, maxlen - pos);
+        if(tlen < 0) return tlen; else pos += tlen;
+    } else {
+        tlen = builtin_interfaces::Time::_skipNoHash(buf, offset + pos, maxlen - pos);
+        if(tlen < 0) return tlen; else pos += tlen;
+    }
+
+    tlen = __byte_decode_array(buf, offset + pos, maxlen - pos, &this->level, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    if ((Mask & Fields::message) != 0) {
+        int32_t __message_len__;
+        tlen = __int32_t_decode_array(
+            buf, offset + pos, maxlen - pos, &__message_len__, 1);
+        if(tlen < 0) return tlen; else pos += tlen;
+        if(__message_len__ < 1 || __message_len__ > maxlen - pos) return -1;
+        this->message.assign(
+            static_cast<const char*>(buf) + offset + pos, __message_len__ - 1);
+        pos += __message_len__;
+    } else {
+        int32_t __message_len__;
+        tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &__message_len__, 1);
+        if(tlen < 0) return tlen; else pos += tlen;
+        if(__message_len__ < 0 || __message_len__ > maxlen - pos) return -1;
+        pos += __message_len__;
+    }
+
+    if ((Mask & Fields::name) != 0) {
+        int32_t __name_len__;
+        tlen = __int32_t_decode_array(
+            buf, offset + pos, maxlen - pos, &__name_len__, 1);
+        if(tlen < 0) return tlen; else pos += tlen;
+        if(__name_len__ < 1 || __name_len__ > maxlen - pos) return -1;
+        this->name.assign(
+            static_cast<const char*>(buf) + offset + pos, __name_len__ - 1);
+        pos += __name_len__;
+    } else {
+        int32_t __name_len__;
+        tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &__name_len__, 1);
+        if(tlen < 0) return tlen; else pos += tlen;
+        if(__name_len__ < 0 || __name_len__ > maxlen - pos) return -1;
+        pos += __name_len__;
+    }
+
+    if ((Mask & Fields::file) != 0) {
+        int32_t __file_len__;
+        tlen = __int32_t_decode_array(
+            buf, offset + pos, maxlen - pos, &__file_len__, 1);
+        if(tlen < 0) return tlen; else pos += tlen;
+        if(__file_len__ < 1 || __file_len__ > maxlen - pos) return -1;
+        this->file.assign(
+            static_cast<const char*>(buf) + offset + pos, __file_len__ - 1);
+        pos += __file_len__;
+    } else {
+        int32_t __file_len__;
+        tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &__file_len__, 1);
+        if(tlen < 0) return tlen; else pos += tlen;
+        if(__file_len__ < 0 || __file_len__ > maxlen - pos) return -1;
+        pos += __file_len__;
+    }
+
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &this->line, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    return pos;
+}
+
+int Log::_getEncodedSizeNoHash() const
+{
+    int enc_size = 0;
+    enc_size += this->timestamp._getEncodedSizeNoHash();
+    enc_size += __byte_encoded_array_size(NULL, 1);
+    enc_size += this->message.size() + 4 + 1;
+    enc_size += this->name.size() + 4 + 1;
+    enc_size += this->file.size() + 4 + 1;
+    enc_size += __int32_t_encoded_array_size(NULL, 1);
+    return enc_size;
+}
+
+int Log::_skipNoHash(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, tlen;
+    tlen = builtin_interfaces::Time::_skipNoHash(buf, offset + pos, maxlen - pos);
+    if(tlen < 0) return tlen; else pos += tlen;
+    pos += 1;
+    int32_t __message_len__;
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &__message_len__, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+    if(__message_len__ < 0 || __message_len__ > maxlen - pos) return -1;
+    pos += __message_len__;
+    int32_t __name_len__;
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &__name_len__, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+    if(__name_len__ < 0 || __name_len__ > maxlen - pos) return -1;
+    pos += __name_len__;
+    int32_t __file_len__;
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &__file_len__, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+    if(__file_len__ < 0 || __file_len__ > maxlen - pos) return -1;
+    pos += __file_len__;
+    pos += 4;
+    if(pos > maxlen) return -1;
+    return pos;
+}
+
+template <typename Self, typename Visitor>
+void Log::_forEachField(Self &self, Visitor &visitor)
+{
+    visitor(kFields[0], self.timestamp);
+    visitor(kFields[1], self.level);
+    visitor(kFields[2], self.message);
+    visitor(kFields[3], self.name);
+    visitor(kFields[4], self.file);
+    visitor(kFields[5], self.line);
+}
+
+uint64_t Log::_computeHash(const __lcm_hash_ptr *p)
+{
+    const __lcm_hash_ptr *fp;
+    for(fp = p; fp != NULL; fp = fp->parent)
+        if(fp->v == Log::getHash)
+            return 0;
+    const __lcm_hash_ptr cp = { p, Log::getHash };
+
+    uint64_t hash = 0x623dae456e90a1c7LL +
+         builtin_interfaces::Time::_computeHash(&cp);
+
+    return (hash<<1) + ((hash>>63)&1);
+}
+
+}
+}
+
+#endif
@@ -0,0 +1,23 @@
+/** THIS IS AN AUTOMATICALLY GENERATED FILE.  DO NOT MODIFY
+ * BY HAND!!
+ *
+ * Generated by lcm-cpp (tools/cpp/gen)
+ **/
+
+#ifndef __foxglove_msgs_pmr_ArrowPrimitive_hpp__
+#define __foxglove_msgs_pmr_ArrowPrimitive_hpp__
+
+#include "foxglove_msgs/ArrowPrimitive.hpp"
+
+namespace foxglove_msgs
+{
+namespace pmr
+{
+
+// ArrowPrimitive has no strings or variable-length arrays, so it never allocates
+typedef foxglove_msgs::ArrowPrimitive ArrowPrimitive;
+
+}
+}
+
+#endif
@@ -0,0 +1,603 @@
+/** THIS IS AN AUTOMATICALLY GENERATED FILE.  DO NOT MODIFY
+ * BY HAND!!
+ *
+ * Generated by lcm-cpp (tools/cpp/gen)
+ **/
+
+#ifndef __foxglove_msgs_pmr_CameraCalibration_hpp__
+#define __foxglove_msgs_pmr_CameraCalibration_hpp__
+
+#include <lcm/lcm_coretypes.h>
+
+#include <array>
+#include <memory_resource>
+#include <utility>
+#include <string>
+#include <vector>
+#include "dimos_lcm/bulk_codec.hpp"
+#include "dimos_lcm/writer.hpp"
+#include "dimos_lcm/fingerprint.hpp"
+#include "dimos_lcm/reflection.hpp"
+#include "builtin_interfaces/pmr/Time.hpp"
+
+namespace foxglove_msgs
+{
+namespace pmr
+{
+
+class CameraCalibration
+{
+    public:
+        int32_t    d_length;
+
+        builtin_interfaces::pmr::Time timestamp;
+
+        std::pmr::string frame_id;
+
+        int32_t    width;
+
+        int32_t    height;
+
+        std::pmr::string distortion_model;
+
+        /**
+         * LCM Type: double[d_length]
+         */
+        std::pmr::vector< double > d;
+
+        /**
+         * LCM Type: double[9]
+         */
+        double     k[9];
+
+        /**
+         * LCM Type: double[9]
+         */
+        double     r[9];
+
+        /**
+         * LCM Type: double[12]
+         */
+        double     p[12];
+
+    public:
+        typedef std::pmr::polymorphic_allocator<char> allocator_type;
+
+        /**
+         * Construct a message whose strings and arrays, and those of the
+         * messages it nests, allocate from @p alloc. Scalars are zeroed.
+         */
+        inline explicit CameraCalibration(const allocator_type &alloc = allocator_type());
+
+        /**
+         * Copy or move @p other into a message that allocates from @p alloc.
+         * With allocator_type, these let std::pmr containers of CameraCalibration pass
+         * their memory resource on to their elements.
+         */
+        inline CameraCalibration(const CameraCalibration &other, const allocator_type &alloc);
+        inline CameraCalibration(CameraCalibration &&other, const allocator_type &alloc);
+
+        /**
+         * Encode a message into binary form.
+         *
+         * @param buf The output buffer.
+         * @param offset Encoding starts at thie byte offset into @p buf.
+         * @param maxlen Maximum number of bytes to write.  This should generally be
+         *  equal to getEncodedSize().
+         * @return The number of bytes encoded, or <0 on error.
+         */
+        inline int encode(void *buf, int offset, int maxlen) const;
+
+        /**
+         * Encode a message by appending it to @p buf, walking the message once
+         * instead of sizing it with getEncodedSize() first. @p buf grows
+         * geometrically; reuse it across calls to avoid reallocating.
+         *
+         * @return The number of bytes appended.
+         */
+        inline int encodeTo(std::vector<uint8_t> &buf) const;
+
+        /**
+         * Check how many bytes are required to encode this message.
+         */
+        inline int getEncodedSize() const;
+
+        /**
+         * Decode a message from binary form into this instance.
+         *
+         * @param buf The buffer containing the encoded message.
+         * @param offset The byte offset into @p buf where the encoded message starts.
+         * @param maxlen The maximum number of bytes to read while decoding.
+         * @return The number of bytes decoded, or <0 if an error occured.
+         */
+        inline int decode(const void *buf, int offset, int maxlen);
+
+        /**
+         * Field bits for decodeFields().
+         */
+        struct Fields
+        {
+            static constexpr uint64_t d_length = 1ULL << 0;
+            static constexpr uint64_t timestamp = 1ULL << 1;
+            static constexpr uint64_t frame_id = 1ULL << 2;
+            static constexpr uint64_t width = 1ULL << 3;
+            static constexpr uint64_t height = 1ULL << 4;
+            static constexpr uint64_t distortion_model = 1ULL << 5;
+            static constexpr uint64_t d = 1ULL << 6;
+            static constexpr uint64_t k = 1ULL << 7;
+            static constexpr uint64_t r = 1ULL << 8;
+            static constexpr uint64_t p = 1ULL << 9;
+            static constexpr uint64_t all = (1ULL << 10) - 1;
+        };
+
+        /**
+         * Decode only the fields selected by @p Mask, a bitwise or of Fields
+         * values. Strings, arrays and nested structs that are not selected are
+         * skipped over by their length prefixes without being allocated, and
+         * keep their previous value. Scalar fields are always decoded: they
+         * cost nothing to read and array lengths depend on them.
+         *
+         * @return The number of bytes decoded, or <0 if an error occured.
+         */
+        template <uint64_t Mask>
+        inline int decodeFields(const void *buf, int offset, int maxlen);
+
+        /**
+         * Upper bound on the length of every variable-length array of this
+         * type, checked by decode() before anything is allocated; messages
+         * exceeding it fail to decode. It does not apply to nested types,
+         * which have their own. Set it once at startup, before decoding.
+         * Before C++17 it is a constant with no limit.
+         */
+#if __cplusplus >= 201703L
+        static inline int32_t maxArrayLength = INT32_MAX;
+#else
+        static constexpr int32_t maxArrayLength = INT32_MAX;
+#endif
+
+        /**
+         * Retrieve the 64-bit fingerprint identifying the structure of the message.
+         * Note that the fingerprint is the same for all instances of the same
+         * message type, and is a fingerprint on the message type definition, not on
+         * the message contents.
+         */
+        inline static int64_t getHash();
+
+        /**
+         * The fingerprint returned by getHash(), as a compile-time constant.
+         */
+        static constexpr int64_t kHash = static_cast<int64_t>(0xac81d1ceffb1b751ULL);
+
+        /**
+         * Returns "CameraCalibration"
+         */
+        inline static const char* getTypeName();
+
+        /**
+         * Name, LCM type and array dimensions of each field, in wire order.
+         * See dimos_lcm::for_each_field() for visiting the fields themselves.
+         */
+        static constexpr std::array<dimos_lcm::field_info, 10> kFields = {{
+            { "d_length", "int32_t", true, 0, 0, NULL },
+            { "timestamp", "builtin_interfaces.Time", false, 0, 0, NULL },
+            { "frame_id", "string", true, 0, 0, NULL },
+            { "width", "int32_t", true, 0, 0, NULL },
+            { "height", "int32_t", true, 0, 0, NULL },
+            { "distortion_model", "string", true, 0, 0, NULL },
+            { "d", "double", true, 1, -1, "d_length" },
+            { "k", "double", true, 1, 9, NULL },
+            { "r", "double", true, 1, 9, NULL },
+            { "p", "double", true, 1, 12, NULL },
+        }};
+
+        // LCM support functions. Users should not call these
+        inline int _encodeNoHash(void *buf, int offset, int maxlen) const;
+        template <typename Writer>
+        inline void _writeNoHash(Writer &out) const;
+        inline int _getEncodedSizeNoHash() const;
+        inline int _decodeNoHash(const void *buf, int offset, int maxlen);
+        template <uint64_t Mask>
+        inline int _decodeFieldsNoHash(const void *buf, int offset, int maxlen);
+        template <typename Self, typename Visitor>
+        inline static void _forEachField(Self &self, Visitor &visitor);
+        inline static int _skipNoHash(const void *buf, int offset, int maxlen);
+        inline static uint64_t _computeHash(const __lcm_hash_ptr *p);
+};
+
+static_assert(CameraCalibration::kHash == dimos_lcm::fingerprint(
+    dimos_lcm::signature_hash()
+        .member("d_length", "int32_t", 0)
+        .member("timestamp", NULL, 0)
+        .member("frame_id", "string", 0)
+        .member("width", "int32_t", 0)
+        .member("height", "int32_t", 0)
+        .member("distortion_model", "string", 0)
+        .member("d", "double", 1).dim(true, "d_length")
+        .member("k", "double", 1).dim(false, "9")
+        .member("r", "double", 1).dim(false, "9")
+        .member("p", "double", 1).dim(false, "12")
+        .value(),
+    builtin_interfaces::pmr::Time::kHash),
+    "foxglove_msgs::pmr::CameraCalibration fingerprint does not match its definition");
+
+CameraCalibration::CameraCalibration(const allocator_type &alloc) :
+    d_length(),
+    timestamp(),
+    frame_id(alloc),
+    width(),
+    height(),
+    distortion_model(alloc),
+    d(alloc),
+    k(),
+    r(),
+    p()
+{
+}
+
+CameraCalibration::CameraCalibration(const CameraCalibration &other, const allocator_type &alloc) :
+    CameraCalibration(alloc)
+{
+    *this = other;
+}
+
+CameraCalibration::CameraCalibration(CameraCalibration &&other, const allocator_type &alloc) :
+    CameraCalibration(alloc)
+{
+    *this = std::move(other);
+}
+
+int CameraCalibration::encode(void *buf, int offset, int maxlen) const
+{
+    int pos = 0, tlen;
+    int64_t hash = getHash();
+
+    tlen = __int64_t_encode_array(buf, offset + pos, maxlen - pos, &hash, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = this->_encodeNoHash(buf, offset + pos, maxlen - pos);
+    if (tlen < 0) return tlen; else pos += tlen;
+
+    return pos;
+}
+
+int CameraCalibration::encodeTo(std::vector<uint8_t> &buf) const
+{
+    dimos_lcm::vector_writer out(buf);
+    int64_t hash = getHash();
+    out.put(&hash, 1);
+    this->_writeNoHash(out);
+    return static_cast<int>(out.size());
+}
+
+int CameraCalibration::decode(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, thislen;
+
+    int64_t msg_hash;
+    thislen = __int64_t_decode_array(buf, offset + pos, maxlen - pos, &msg_hash, 1);
+    if (thislen < 0) return thislen; else pos += thislen;
+    if (msg_hash != getHash()) return -1;
+
+    thislen = this->_decodeNoHash(buf, offset + pos, maxlen - pos);
+    if (thislen < 0) return thislen; else pos += thislen;
+
+    return pos;
+}
+
+template <uint64_t Mask>
+int CameraCalibration::decodeFields(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, thislen;
+
+    int64_t msg_hash;
+    thislen = __int64_t_decode_array(buf, offset + pos, maxlen - pos, &msg_hash, 1);
+    if (thislen < 0) return thislen; else pos += thislen;
+    if (msg_hash != getHash()) return -1;
+
+    thislen = this->_decodeFieldsNoHash<Mask>(buf, offset + pos, maxlen - pos);
+    if (thislen < 0) return thislen; else pos += thislen;
+
+    return pos;
+}
+
+int CameraCalibration::getEncodedSize() const
+{
+    return 8 + _getEncodedSizeNoHash();
+}
+
+int64_t CameraCalibration::getHash()
+{
+    return kHash;
+}
+
+const char* CameraCalibration::getTypeName()
+{
+    return "CameraCalibration";
+}
+
+int CameraCalibration::_encodeNoHash(void *buf, int offset, int maxlen) const
+{
+    int pos = 0, tlen;
+
+    tlen = __int32_t_encode_array(buf, offset + pos, maxlen - pos, &this->d_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = this->timestamp._encodeNoHash(buf, offset + pos, maxlen - pos);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    char* frame_id_cstr = const_cast<char*>(this->frame_id.c_str());
+    tlen = __string_encode_array(
+        buf, offset + pos, maxlen - pos, &frame_id_cstr, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = __int32_t_encode_array(buf, offset + pos, maxlen - pos, &this->width, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = __int32_t_encode_array(buf, offset + pos, maxlen - pos, &this->height, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    char* distortion_model_cstr = const_cast<char*>(this->distortion_model.c_str());
+    tlen = __string_encode_array(
+        buf, offset + pos, maxlen - pos, &distortion_model_cstr, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    if(this->d_length > 0) {
+        tlen = dimos_lcm::bulk_encode_array(buf, offset + pos, maxlen - pos, &this->d[0], this->d_length);
+        if(tlen < 0) return tlen; else pos += tlen;
+    }
+
+    tlen = dimos_lcm::bulk_encode_array(buf, offset + pos, maxlen - pos, &this->k[0], 9);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = dimos_lcm::bulk_encode_array(buf, offset + pos, maxlen - pos, &this->r[0], 9);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = dimos_lcm::bulk_encode_array(buf, offset + pos, maxlen - pos, &this->p[0], 12);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    return pos;
+}
+
+template <typename Writer>
+void CameraCalibration::_writeNoHash(Writer &out) const
+{
+    out.put(&this->d_length, 1);
+    this->timestamp._writeNoHash(out);
+    out.put(this->frame_id);
+    out.put(&this->width, 1);
+    out.put(&this->height, 1);
+    out.put(this->distortion_model);
+    if(this->d_length > 0)
+        out.put(&this->d[0], this->d_length);
+    out.put(&this->k[0], 9);
+    out.put(&this->r[0], 9);
+    out.put(&this->p[0], 12);
+}
+
+int CameraCalibration::_decodeNoHash(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, tlen;
+
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &this->d_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = this->timestamp._decodeNoHash(buf, offset + pos, maxlen - pos);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    int32_t __frame_id_len__;
+    tlen = __int32_t_decode_array(
+        buf, offset + pos, maxlen - pos, &__frame_id_len__, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+    if(__frame_id_len__ < 1 || __frame_id_len__ > maxlen - pos) return -1;
+    this->frame_id.assign(
+        static_cast<const char*>(buf) + offset + pos, __frame_id_len__ - 1);
+    pos += __frame_id_len__;
+
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &this->width, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &this->height, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    int32_t __distortion_model_len__;
+    tlen = __int32_t_decode_array(
+        buf, offset + pos, maxlen - pos, &__distortion_model_len__, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+    if(__distortion_model_len__ < 1 || __distortion_model_len__ > maxlen - pos) return -1;
+    this->distortion_model.assign(
+        static_cast<const char*>(buf) + offset + pos, __distortion_model_len__ - 1);
+    pos += __distortion_model_len__;
+
+    if(this->d_length) {
+        if(this->d_length < 0 || this->d_length > (maxlen - pos) / 8 || this->d_length > maxArrayLength) return -1;
+        this->d.resize(this->d_length);
+        tlen = dimos_lcm::bulk_decode_array(buf, offset + pos, maxlen - pos, &this->d[0], this->d_length);
+        if(tlen < 0) return tlen; else pos += tlen;
+    } else {
+        this->d.clear();
+    }
+
+    tlen = dimos_lcm::bulk_decode_array(buf, offset + pos, maxlen - pos, &this->k[0], 9);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = dimos_lcm::bulk_decode_array(buf, offset + pos, maxlen - pos, &this->r[0], 9);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = dimos_lcm::bulk_decode_array(buf, offset + pos, maxlen - pos, &this->p[0], 12);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    return pos;
+}
+
+template <uint64_t Mask>
+int CameraCalibration::_decodeFieldsNoHash(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, tlen;
+
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &this->d_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    if ((Mask & Fields::timestamp) != 0) {
+        tlen = this->timestamp._decodeNoHash(buf, offset + pos, maxlen - pos);
+        if(tlen < 0) return tlen; else pos += tlen;
+    } else {
+        tlen = builtin_interfaces::pmr::Time::_skipNoHash(buf, offset + pos, maxlen - pos);
+        if(tlen < 0) return tlen; else pos += tlen;
+    }
+
+    if ((Mask & Fields::frame_id) != 0) {
+        int32_t __frame_id_len__;
+        tlen = __int32_t_decode_array(
+            buf, offset + pos, maxlen - pos, &__frame_id_len__, 1);
+        if(tlen < 0) return tlen; else pos += tlen;
+        if(__frame_id_len__ < 1 || __frame_id_len__ > maxlen - pos) return -1;
+        this->frame_id.assign(
+            static_cast<const char*>(buf) + offset + pos, __frame_id_len__ - 1);
+        pos += __frame_id_len__;
+    } else {
+        int32_t __frame_id_len__;
+        tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &__frame_id_len__, 1);
+        if(tlen < 0) return tlen; else pos += tlen;
+        if(__frame_id_len__ < 0 || __frame_id_len__ > maxlen - pos) return -1;
+        pos += __frame_id_len__;
+    }
+
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &this->width, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &this->height, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    if ((Mask & Fields::distortion_model) != 0) {
+        int32_t __distortion_model_len__;
+        tlen = __int32_t_decode_array(
+            buf, offset + pos, maxlen - pos, &__distortion_model_len__, 1);
+        if(tlen < 0) return tlen; else pos += tlen;
+        if(__distortion_model_len__ < 1 || __distortion_model_len__ > maxlen - pos) return -1;
+        this->distortion_model.assign(
+            static_cast<const char*>(buf) + offset + pos, __distortion_model_len__ - 1);
+        pos += __distortion_model_len__;
+    } else {
+        int32_t __distortion_model_len__;
+        tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &__distortion_model_len__, 1);
+        if(tlen < 0) return tlen; else pos += tlen;
+        if(__distortion_model_len__ < 0 || __distortion_model_len__ > maxlen - pos) return -1;
+        pos += __distortion_model_len__;
+    }
+
+    if ((Mask & Fields::d) != 0) {
+        if(this->d_length) {
+            if(this->d_length < 0 || this->d_length > (maxlen - pos) / 8 || this->d_length > maxArrayLength) return -1;
+            this->d.resize(this->d_length);
+            tlen = dimos_lcm::bulk_decode_array(buf, offset + pos, maxlen - pos, &this->d[0], this->d_length);
+            if(tlen < 0) return tlen; else pos += tlen;
+        } else {
+            this->d.clear();
+        }
+    } else {
+        if(this->d_length < 0 || this->d_length > (maxlen - pos) / 8) return -1;
+        pos += this->d_length * 8;
+    }
+
+    if ((Mask & Fields::k) != 0) {
+        tlen = dimos_lcm::bulk_decode_array(buf, offset + pos, maxlen - pos, &this->k[0], 9);
+        if(tlen < 0) return tlen; else pos += tlen;
+    } else {
+        pos += 72;
+    }
+
+    if ((Mask & Fields::r) != 0) {
+        tlen = dimos_lcm::bulk_decode_array(buf, offset + pos, maxlen - pos, &this->r[0], 9);
+        if(tlen < 0) return tlen; else pos += tlen;
+    } else {
+        pos += 72;
+    }
+
+    if ((Mask & Fields::p) != 0) {
+        tlen = dimos_lcm::bulk_decode_array(buf, offset + pos, maxlen - pos, &this->p[0], 12);
+        if(tlen < 0) return tlen; else pos += tlen;
+    } else {
+        pos += 96;
+    }
+
+    return pos;
+}
+
+int CameraCalibration::_getEncodedSizeNoHash() const
+{
+    int enc_size = 0;
+    enc_size += __int32_t_encoded_array_size(NULL, 1);
+    enc_size += this->timestamp._getEncodedSizeNoHash();
+    enc_size += this->frame_id.size() + 4 + 1;
+    enc_size += __int32_t_encoded_array_size(NULL, 1);
+    enc_size += __int32_t_encoded_array_size(NULL, 1);
+    enc_size += this->distortion_model.size() + 4 + 1;
+    enc_size += __double_encoded_array_size(NULL, this->d_length);
+    enc_size += __double_encoded_array_size(NULL, 9);
+    enc_size += __double_encoded_array_size(NULL, 9);
+    enc_size += __double_encoded_array_size(NULL, 12);
+    return enc_size;
+}
+
+int CameraCalibration::_skipNoHash(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, tlen;
+    int32_t d_length;
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &d_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+    tlen = builtin_interfaces::pmr::Time::_skipNoHash(buf, offset + pos, maxlen - pos);
+    if(tlen < 0) return tlen; else pos += tlen;
+    int32_t __frame_id_len__;
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &__frame_id_len__, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+    if(__frame_id_len__ < 0 || __frame_id_len__ > maxlen - pos) return -1;
+    pos += __frame_id_len__;
+    pos += 4;
+    pos += 4;
+    int32_t __distortion_model_len__;
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &__distortion_model_len__, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+    if(__distortion_model_len__ < 0 || __distortion_model_len__ > maxlen - pos) return -1;
+    pos += __distortion_model_len__;
+    if(d_length < 0 || d_length > (maxlen - pos) / 8) return -1;
+    pos += d_length * 8;
+    pos += 72;
+    pos += 72;
+    pos += 96;
+    if(pos > maxlen) return -1;
+    return pos;
+}
+
+template <typename Self, typename Visitor>
+void CameraCalibration::_forEachField(Self &self, Visitor &visitor)
+{
+    visitor(kFields[0], self.d_length);
+    visitor(kFields[1], self.timestamp);
+    visitor(kFields[2], self.frame_id);
+    visitor(kFields[3], self.width);
+    visitor(kFields[4], self.height);
+    visitor(kFields[5], self.distortion_model);
+    visitor(kFields[6], self.d);
+    visitor(kFields[7], self.k);
+    visitor(kFields[8], self.r);
+    visitor(kFields[9], self.p);
+}
+
+uint64_t CameraCalibration::_computeHash(const __lcm_hash_ptr *p)
+{
+    const __lcm_hash_ptr *fp;
+    for(fp = p; fp != NULL; fp = fp->parent)
+        if(fp->v == CameraCalibration::getHash)
+            return 0;
+    const __lcm_hash_ptr cp = { p, CameraCalibration::getHash };
+
+    uint64_t hash = 0x89c275083a857ce2LL +
+         builtin_interfaces::pmr::Time::_computeHash(&cp);
+
+    return (hash<<1) + ((hash>>63)&1);
+}
+
+}
+}
+
+#endif
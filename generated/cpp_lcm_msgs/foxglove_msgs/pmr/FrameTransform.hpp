@@ -0,0 +1,464 @@
+/** THIS IS AN AUTOMATICALLY GENERATED FILE.  DO NOT MODIFY
+ * BY HAND!!
+ *
+ * Generated by lcm-cpp (tools/cpp/gen)
+ **/
+
+#ifndef __foxglove_msgs_pmr_FrameTransform_hpp__
+#define __foxglove_msgs_pmr_FrameTransform_hpp__
+
+#include <lcm/lcm_coretypes.h>
+
+#include <array>
+#include <memory_resource>
+#include <utility>
+#include <string>
+#include "dimos_lcm/writer.hpp"
+#include "dimos_lcm/fingerprint.hpp"
+#include "dimos_lcm/reflection.hpp"
+#include "builtin_interfaces/pmr/Time.hpp"
+#include "geometry_msgs/pmr/Vector3.hpp"
+#include "geometry_msgs/pmr/Quaternion.hpp"
+
+namespace foxglove_msgs
+{
+namespace pmr
+{
+
+class FrameTransform
+{
+    public:
+        builtin_interfaces::pmr::Time timestamp;
+
+        std::pmr::string parent_frame_id;
+
+        std::pmr::string child_frame_id;
+
+        geometry_msgs::pmr::Vector3 translation;
+
+        geometry_msgs::pmr::Quaternion rotation;
+
+    public:
+        typedef std::pmr::polymorphic_allocator<char> allocator_type;
+
+        /**
+         * Construct a message whose strings and arrays, and those of the
+         * messages it nests, allocate from @p alloc. Scalars are zeroed.
+         */
+        inline explicit FrameTransform(const allocator_type &alloc = allocator_type());
+
+        /**
+         * Copy or move @p other into a message that allocates from @p alloc.
+         * With allocator_type, these let std::pmr containers of FrameTransform pass
+         * their memory resource on to their elements.
+         */
+        inline FrameTransform(const FrameTransform &other, const allocator_type &alloc);
+        inline FrameTransform(FrameTransform &&other, const allocator_type &alloc);
+
+        /**
+         * Encode a message into binary form.
+         *
+         * @param buf The output buffer.
+         * @param offset Encoding starts at thie byte offset into @p buf.
+         * @param maxlen Maximum number of bytes to write.  This should generally be
+         *  equal to getEncodedSize().
+         * @return The number of bytes encoded, or <0 on error.
+         */
+        inline int encode(void *buf, int offset, int maxlen) const;
+
+        /**
+         * Encode a message by appending it to @p buf, walking the message once
+         * instead of sizing it with getEncodedSize() first. @p buf grows
+         * geometrically; reuse it across calls to avoid reallocating.
+         *
+         * @return The number of bytes appended.
+         */
+        inline int encodeTo(std::vector<uint8_t> &buf) const;
+
+        /**
+         * Check how many bytes are required to encode this message.
+         */
+        inline int getEncodedSize() const;
+
+        /**
+         * Decode a message from binary form into this instance.
+         *
+         * @param buf The buffer containing the encoded message.
+         * @param offset The byte offset into @p buf where the encoded message starts.
+         * @param maxlen The maximum number of bytes to read while decoding.
+         * @return The number of bytes decoded, or <0 if an error occured.
+         */
+        inline int decode(const void *buf, int offset, int maxlen);
+
+        /**
+         * Field bits for decodeFields().
+         */
+        struct Fields
+        {
+            static constexpr uint64_t timestamp = 1ULL << 0;
+            static constexpr uint64_t parent_frame_id = 1ULL << 1;
+            static constexpr uint64_t child_frame_id = 1ULL << 2;
+            static constexpr uint64_t translation = 1ULL << 3;
+            static constexpr uint64_t rotation = 1ULL << 4;
+            static constexpr uint64_t all = (1ULL << 5) - 1;
+        };
+
+        /**
+         * Decode only the fields selected by @p Mask, a bitwise or of Fields
+         * values. Strings, arrays and nested structs that are not selected are
+         * skipped over by their length prefixes without being allocated, and
+         * keep their previous value. Scalar fields are always decoded: they
+         * cost nothing to read and array lengths depend on them.
+         *
+         * @return The number of bytes decoded, or <0 if an error occured.
+         */
+        template <uint64_t Mask>
+        inline int decodeFields(const void *buf, int offset, int maxlen);
+
+        /**
+         * Retrieve the 64-bit fingerprint identifying the structure of the message.
+         * Note that the fingerprint is the same for all instances of the same
+         * message type, and is a fingerprint on the message type definition, not on
+         * the message contents.
+         */
+        inline static int64_t getHash();
+
+        /**
+         * The fingerprint returned by getHash(), as a compile-time constant.
+         */
+        static constexpr int64_t kHash = static_cast<int64_t>(0x9007a6260103b7feULL);
+
+        /**
+         * Returns "FrameTransform"
+         */
+        inline static const char* getTypeName();
+
+        /**
+         * Name, LCM type and array dimensions of each field, in wire order.
+         * See dimos_lcm::for_each_field() for visiting the fields themselves.
+         */
+        static constexpr std::array<dimos_lcm::field_info, 5> kFields = {{
+            { "timestamp", "builtin_interfaces.Time", false, 0, 0, NULL },
+            { "parent_frame_id", "string", true, 0, 0, NULL },
+            { "child_frame_id", "string", true, 0, 0, NULL },
+            { "translation", "geometry_msgs.Vector3", false, 0, 0, NULL },
+            { "rotation", "geometry_msgs.Quaternion", false, 0, 0, NULL },
+        }};
+
+        // LCM support functions. Users should not call these
+        inline int _encodeNoHash(void *buf, int offset, int maxlen) const;
+        template <typename Writer>
+        inline void _writeNoHash(Writer &out) const;
+        inline int _getEncodedSizeNoHash() const;
+        inline int _decodeNoHash(const void *buf, int offset, int maxlen);
+        template <uint64_t Mask>
+        inline int _decodeFieldsNoHash(const void *buf, int offset, int maxlen);
+        template <typename Self, typename Visitor>
+        inline static void _forEachField(Self &self, Visitor &visitor);
+        inline static int _skipNoHash(const void *buf, int offset, int maxlen);
+        inline static uint64_t _computeHash(const __lcm_hash_ptr *p);
+};
+
+static_assert(FrameTransform::kHash == dimos_lcm::fingerprint(
+    dimos_lcm::signature_hash()
+        .member("timestamp", NULL, 0)
+        .member("parent_frame_id", "string", 0)
+        .member("child_frame_id", "string", 0)
+        .member("translation", NULL, 0)
+        .member("rotation", NULL, 0)
+        .value(),
+    builtin_interfaces::pmr::Time::kHash,
+    geometry_msgs::pmr::Vector3::kHash,
+    geometry_msgs::pmr::Quaternion::kHash),
+    "foxglove_msgs::pmr::FrameTransform fingerprint does not match its definition");
+
+FrameTransform::FrameTransform(const allocator_type &alloc) :
+    timestamp(),
+    parent_frame_id(alloc),
+    child_frame_id(alloc),
+    translation(),
+    rotation()
+{
+}
+
+FrameTransform::FrameTransform(const FrameTransform &other, const allocator_type &alloc) :
+    FrameTransform(alloc)
+{
+    *this = other;
+}
+
+FrameTransform::FrameTransform(FrameTransform &&other, const allocator_type &alloc) :
+    FrameTransform(alloc)
+{
+    *this = std::move(other);
+}
+
+int FrameTransform::encode(void *buf, int offset, int maxlen) const
+{
+    int pos = 0, tlen;
+    int64_t hash = getHash();
+
+    tlen = __int64_t_encode_array(buf, offset + pos, maxlen - pos, &hash, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = this->_encodeNoHash(buf, offset + pos, maxlen - pos);
+    if (tlen < 0) return tlen; else pos += tlen;
+
+    return pos;
+}
+
+int FrameTransform::encodeTo(std::vector<uint8_t> &buf) const
+{
+    dimos_lcm::vector_writer out(buf);
+    int64_t hash = getHash();
+    out.put(&hash, 1);
+    this->_writeNoHash(out);
+    return static_cast<int>(out.size());
+}
+
+int FrameTransform::decode(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, thislen;
+
+    int64_t msg_hash;
+    thislen = __int64_t_decode_array(buf, offset + pos, maxlen - pos, &msg_hash, 1);
+    if (thislen < 0) return thislen; else pos += thislen;
+    if (msg_hash != getHash()) return -1;
+
+    thislen = this->_decodeNoHash(buf, offset + pos, maxlen - pos);
+    if (thislen < 0) return thislen; else pos += thislen;
+
+    return pos;
+}
+
+template <uint64_t Mask>
+int FrameTransform::decodeFields(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, thislen;
+
+    int64_t msg_hash;
+    thislen = __int64_t_decode_array(buf, offset + pos, maxlen - pos, &msg_hash, 1);
+    if (thislen < 0) return thislen; else pos += thislen;
+    if (msg_hash != getHash()) return -1;
+
+    thislen = this->_decodeFieldsNoHash<Mask>(buf, offset + pos, maxlen - pos);
+    if (thislen < 0) return thislen; else pos += thislen;
+
+    return pos;
+}
+
+int FrameTransform::getEncodedSize() const
+{
+    return 8 + _getEncodedSizeNoHash();
+}
+
+int64_t FrameTransform::getHash()
+{
+    return kHash;
+}
+
+const char* FrameTransform::getTypeName()
+{
+    return "FrameTransform";
+}
+
+int FrameTransform::_encodeNoHash(void *buf, int offset, int maxlen) const
+{
+    int pos = 0, tlen;
+
+    tlen = this->timestamp._encodeNoHash(buf, offset + pos, maxlen - pos);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    char* parent_frame_id_cstr = const_cast<char*>(this->parent_frame_id.c_str());
+    tlen = __string_encode_array(
+        buf, offset + pos, maxlen - pos, &parent_frame_id_cstr, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    char* child_frame_id_cstr = const_cast<char*>(this->child_frame_id.c_str());
+    tlen = __string_encode_array(
+        buf, offset + pos, maxlen - pos, &child_frame_id_cstr, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = this->translation._encodeNoHash(buf, offset + pos, maxlen - pos);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = this->rotation._encodeNoHash(buf, offset + pos, maxlen - pos);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    return pos;
+}
+
+template <typename Writer>
+void FrameTransform::_writeNoHash(Writer &out) const
+{
+    this->timestamp._writeNoHash(out);
+    out.put(this->parent_frame_id);
+    out.put(this->child_frame_id);
+    this->translation._writeNoHash(out);
+    this->rotation._writeNoHash(out);
+}
+
+int FrameTransform::_decodeNoHash(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, tlen;
+
+    tlen = this->timestamp._decodeNoHash(buf, offset + pos, maxlen - pos);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    int32_t __parent_frame_id_len__;
+    tlen = __int32_t_decode_array(
+        buf, offset + pos, maxlen - pos, &__parent_frame_id_len__, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+    if(__parent_frame_id_len__ < 1 || __parent_frame_id_len__ > maxlen - pos) return -1;
+    this->parent_frame_id.assign(
+        static_cast<const char*>(buf) + offset + pos, __parent_frame_id_len__ - 1);
+    pos += __parent_frame_id_len__;
+
+    int32_t __child_frame_id_len__;
+    tlen = __int32_t_decode_array(
+        buf, offset + pos, maxlen - pos, &__child_frame_id_len__, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+    if(__child_frame_id_len__ < 1 || __child_frame_id_len__ > maxlen - pos) return -1;
+    this->child_frame_id.assign(
+        static_cast<const char*>(buf) + offset + pos, __child_frame_id_len__ - 1);
+    pos += __child_frame_id_len__;
+
+    tlen = this->translation._decodeNoHash(buf, offset + pos, maxlen - pos);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = this->rotation._decodeNoHash(buf, offset + pos, maxlen - pos);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    return pos;
+}
+
+template <uint64_t Mask>
+int FrameTransform::_decodeFieldsNoHash(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, tlen;
+
+    if ((Mask & Fields::timestamp) != 0) {
+        tlen = this->timestamp._decodeNoHash(buf, offset + pos, maxlen - pos);
+        if(tlen < 0) return tlen; else pos += tlen;
+    } else {
+        tlen = builtin_interfaces::pmr::Time::_skipNoHash(buf, offset + pos, maxlen - pos);
+        if(tlen < 0) return tlen; else pos += tlen;
+    }
+
+    if ((Mask & Fields::parent_frame_id) != 0) {
+        int32_t __parent_frame_id_len__;
+        tlen = __int32_t_decode_array(
+            buf, offset + pos, maxlen - pos, &__parent_frame_id_len__, 1);
+        if(tlen < 0) return tlen; else pos += tlen;
+        if(__parent_frame_id_len__ < 1 || __parent_frame_id_len__ > maxlen - pos) return -1;
+        this->parent_frame_id.assign(
+            static_cast<const char*>(buf) + offset + pos, __parent_frame_id_len__ - 1);
+        pos += __parent_frame_id_len__;
+    } else {
+        int32_t __parent_frame_id_len__;
+        tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &__parent_frame_id_len__, 1);
+        if(tlen < 0) return tlen; else pos += tlen;
+        if(__parent_frame_id_len__ < 0 || __parent_frame_id_len__ > maxlen - pos) return -1;
+        pos += __parent_frame_id_len__;
+    }
+
+    if ((Mask & Fields::child_frame_id) != 0) {
+        int32_t __child_frame_id_len__;
+        tlen = __int32_t_decode_array(
+            buf, offset + pos, maxlen - pos, &__child_frame_id_len__, 1);
+        if(tlen < 0) return tlen; else pos += tlen;
+        if(__child_frame_id_len__ < 1 || __child_frame_id_len__ > maxlen - pos) return -1;
+        this->child_frame_id.assign(
+            static_cast<const char*>(buf) + offset + pos, __child_frame_id_len__ - 1);
+        pos += __child_frame_id_len__;
+    } else {
+        int32_t __child_frame_id_len__;
+        tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &__child_frame_id_len__, 1);
+        if(tlen < 0) return tlen; else pos += tlen;
+        if(__child_frame_id_len__ < 0 || __child_frame_id_len__ > maxlen - pos) return -1;
+        pos += __child_frame_id_len__;
+    }
+
+    if ((Mask & Fields::translation) != 0) {
+        tlen = this->translation._decodeNoHash(buf, offset + pos, maxlen - pos);
+        if(tlen < 0) return tlen; else pos += tlen;
+    } else {
+        tlen = geometry_msgs::pmr::Vector3::_skipNoHash(buf, offset + pos, maxlen - pos);
+        if(tlen < 0) return tlen; else pos += tlen;
+    }
+
+    if ((Mask & Fields::rotation) != 0) {
+        tlen = this->rotation._decodeNoHash(buf, offset + pos, maxlen - pos);
+        if(tlen < 0) return tlen; else pos += tlen;
+    } else {
+        tlen = geometry_msgs::pmr::Quaternion::_skipNoHash(buf, offset + pos, maxlen - pos);
+        if(tlen < 0) return tlen; else pos += tlen;
+    }
+
+    return pos;
+}
+
+int FrameTransform::_getEncodedSizeNoHash() const
+{
+    int enc_size = 0;
+    enc_size += this->timestamp._getEncodedSizeNoHash();
+    enc_size += this->parent_frame_id.size() + 4 + 1;
+    enc_size += this->child_frame_id.size() + 4 + 1;
+    enc_size += this->translation._getEncodedSizeNoHash();
+    enc_size += this->rotation._getEncodedSizeNoHash();
+    return enc_size;
+}
+
+int FrameTransform::_skipNoHash(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, tlen;
+    tlen = builtin_interfaces::pmr::Time::_skipNoHash(buf, offset + pos, maxlen - pos);
+    if(tlen < 0) return tlen; else pos += tlen;
+    int32_t __parent_frame_id_len__;
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &__parent_frame_id_len__, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+    if(__parent_frame_id_len__ < 0 || __parent_frame_id_len__ > maxlen - pos) return -1;
+    pos += __parent_frame_id_len__;
+    int32_t __child_frame_id_len__;
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &__child_frame_id_len__, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+    if(__child_frame_id_len__ < 0 || __child_frame_id_len__ > maxlen - pos) return -1;
+    pos += __child_frame_id_len__;
+    tlen = geometry_msgs::pmr::Vector3::_skipNoHash(buf, offset + pos, maxlen - pos);
+    if(tlen < 0) return tlen; else pos += tlen;
+    tlen = geometry_msgs::pmr::Quaternion::_skipNoHash(buf, offset + pos, maxlen - pos);
+    if(tlen < 0) return tlen; else pos += tlen;
+    if(pos > maxlen) return -1;
+    return pos;
+}
+
+template <typename Self, typename Visitor>
+void FrameTransform::_forEachField(Self &self, Visitor &visitor)
+{
+    visitor(kFields[0], self.timestamp);
+    visitor(kFields[1], self.parent_frame_id);
+    visitor(kFields[2], self.child_frame_id);
+    visitor(kFields[3], self.translation);
+    visitor(kFields[4], self.rotation);
+}
+
+uint64_t FrameTransform::_computeHash(const __lcm_hash_ptr *p)
+{
+    const __lcm_hash_ptr *fp;
+    for(fp = p; fp != NULL; fp = fp->parent)
+        if(fp->v == FrameTransform::getHash)
+            return 0;
+    const __lcm_hash_ptr cp = { p, FrameTransform::getHash };
+
+    uint64_t hash = 0x16cb223d6329d1f0LL +
+         builtin_interfaces::pmr::Time::_computeHash(&cp) +
+         geometry_msgs::pmr::Vector3::_computeHash(&cp) +
+         geometry_msgs::pmr::Quaternion::_computeHash(&cp);
+
+    return (hash<<1) + ((hash>>63)&1);
+}
+
+}
+}
+
+#endif
@@ -0,0 +1,373 @@
+/** THIS IS AN AUTOMATICALLY GENERATED FILE.  DO NOT MODIFY
+ * BY HAND!!
+ *
+ * Generated by lcm-cpp (tools/cpp/gen)
+ **/
+
+#ifndef __foxglove_msgs_pmr_KeyValuePair_hpp__
+#define __foxglove_msgs_pmr_KeyValuePair_hpp__
+
+#include <lcm/lcm_coretypes.h>
+
+#include <array>
+#include <memory_resource>
+#include <utility>
+#include <string>
+#include "dimos_lcm/writer.hpp"
+#include "dimos_lcm/fingerprint.hpp"
+#include "dimos_lcm/reflection.hpp"
+
+namespace foxglove_msgs
+{
+namespace pmr
+{
+
+class KeyValuePair
+{
+    public:
+        std::pmr::string key;
+
+        std::pmr::string value;
+
+    public:
+        typedef std::pmr::polymorphic_allocator<char> allocator_type;
+
+        /**
+         * Construct a message whose strings and arrays, and those of the
+         * messages it nests, allocate from @p alloc. Scalars are zeroed.
+         */
+        inline explicit KeyValuePair(const allocator_type &alloc = allocator_type());
+
+        /**
+         * Copy or move @p other into a message that allocates from @p alloc.
+         * With allocator_type, these let std::pmr containers of KeyValuePair pass
+         * their memory resource on to their elements.
+         */
+        inline KeyValuePair(const KeyValuePair &other, const allocator_type &alloc);
+        inline KeyValuePair(KeyValuePair &&other, const allocator_type &alloc);
+
+        /**
+         * Encode a message into binary form.
+         *
+         * @param buf The output buffer.
+         * @param offset Encoding starts at thie byte offset into @p buf.
+         * @param maxlen Maximum number of bytes to write.  This should generally be
+         *  equal to getEncodedSize().
+         * @return The number of bytes encoded, or <0 on error.
+         */
+        inline int encode(void *buf, int offset, int maxlen) const;
+
+        /**
+         * Encode a message by appending it to @p buf, walking the message once
+         * instead of sizing it with getEncodedSize() first. @p buf grows
+         * geometrically; reuse it across calls to avoid reallocating.
+         *
+         * @return The number of bytes appended.
+         */
+        inline int encodeTo(std::vector<uint8_t> &buf) const;
+
+        /**
+         * Check how many bytes are required to encode this message.
+         */
+        inline int getEncodedSize() const;
+
+        /**
+         * Decode a message from binary form into this instance.
+         *
+         * @param buf The buffer containing the encoded message.
+         * @param offset The byte offset into @p buf where the encoded message starts.
+         * @param maxlen The maximum number of bytes to read while decoding.
+         * @return The number of bytes decoded, or <0 if an error occured.
+         */
+        inline int decode(const void *buf, int offset, int maxlen);
+
+        /**
+         * Field bits for decodeFields().
+         */
+        struct Fields
+        {
+            static constexpr uint64_t key = 1ULL << 0;
+            static constexpr uint64_t value = 1ULL << 1;
+            static constexpr uint64_t all = (1ULL << 2) - 1;
+        };
+
+        /**
+         * Decode only the fields selected by @p Mask, a bitwise or of Fields
+         * values. Strings, arrays and nested structs that are not selected are
+         * skipped over by their length prefixes without being allocated, and
+         * keep their previous value. Scalar fields are always decoded: they
+         * cost nothing to read and array lengths depend on them.
+         *
+         * @return The number of bytes decoded, or <0 if an error occured.
+         */
+        template <uint64_t Mask>
+        inline int decodeFields(const void *buf, int offset, int maxlen);
+
+        /**
+         * Retrieve the 64-bit fingerprint identifying the structure of the message.
+         * Note that the fingerprint is the same for all instances of the same
+         * message type, and is a fingerprint on the message type definition, not on
+         * the message contents.
+         */
+        inline static int64_t getHash();
+
+        /**
+         * The fingerprint returned by getHash(), as a compile-time constant.
+         */
+        static constexpr int64_t kHash = static_cast<int64_t>(0x2eae802baa5ddbbdULL);
+
+        /**
+         * Returns "KeyValuePair"
+         */
+        inline static const char* getTypeName();
+
+        /**
+         * Name, LCM type and array dimensions of each field, in wire order.
+         * See dimos_lcm::for_each_field() for visiting the fields themselves.
+         */
+        static constexpr std::array<dimos_lcm::field_info, 2> kFields = {{
+            { "key", "string", true, 0, 0, NULL },
+            { "value", "string", true, 0, 0, NULL },
+        }};
+
+        // LCM support functions. Users should not call these
+        inline int _encodeNoHash(void *buf, int offset, int maxlen) const;
+        template <typename Writer>
+        inline void _writeNoHash(Writer &out) const;
+        inline int _getEncodedSizeNoHash() const;
+        inline int _decodeNoHash(const void *buf, int offset, int maxlen);
+        template <uint64_t Mask>
+        inline int _decodeFieldsNoHash(const void *buf, int offset, int maxlen);
+        template <typename Self, typename Visitor>
+        inline static void _forEachField(Self &self, Visitor &visitor);
+        inline static int _skipNoHash(const void *buf, int offset, int maxlen);
+        inline static uint64_t _computeHash(const __lcm_hash_ptr *p);
+};
+
+static_assert(KeyValuePair::kHash == dimos_lcm::fingerprint(
+    dimos_lcm::signature_hash()
+        .member("key", "string", 0)
+        .member("value", "string", 0)
+        .value()),
+    "foxglove_msgs::pmr::KeyValuePair fingerprint does not match its definition");
+
+KeyValuePair::KeyValuePair(const allocator_type &alloc) :
+    key(alloc),
+    value(alloc)
+{
+}
+
+KeyValuePair::KeyValuePair(const KeyValuePair &other, const allocator_type &alloc) :
+    KeyValuePair(alloc)
+{
+    *this = other;
+}
+
+KeyValuePair::KeyValuePair(KeyValuePair &&other, const allocator_type &alloc) :
+    KeyValuePair(alloc)
+{
+    *this = std::move(other);
+}
+
+int KeyValuePair::encode(void *buf, int offset, int maxlen) const
+{
+    int pos = 0, tlen;
+    int64_t hash = getHash();
+
+    tlen = __int64_t_encode_array(buf, offset + pos, maxlen - pos, &hash, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = this->_encodeNoHash(buf, offset + pos, maxlen - pos);
+    if (tlen < 0) return tlen; else pos += tlen;
+
+    return pos;
+}
+
+int KeyValuePair::encodeTo(std::vector<uint8_t> &buf) const
+{
+    dimos_lcm::vector_writer out(buf);
+    int64_t hash = getHash();
+    out.put(&hash, 1);
+    this->_writeNoHash(out);
+    return static_cast<int>(out.size());
+}
+
+int KeyValuePair::decode(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, thislen;
+
+    int64_t msg_hash;
+    thislen = __int64_t_decode_array(buf, offset + pos, maxlen - pos, &msg_hash, 1);
+    if (thislen < 0) return thislen; else pos += thislen;
+    if (msg_hash != getHash()) return -1;
+
+    thislen = this->_decodeNoHash(buf, offset + pos, maxlen - pos);
+    if (thislen < 0) return thislen; else pos += thislen;
+
+    return pos;
+}
+
+template <uint64_t Mask>
+int KeyValuePair::decodeFields(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, thislen;
+
+    int64_t msg_hash;
+    thislen = __int64_t_decode_array(buf, offset + pos, maxlen - pos, &msg_hash, 1);
+    if (thislen < 0) return thislen; else pos += thislen;
+    if (msg_hash != getHash()) return -1;
+
+    thislen = this->_decodeFieldsNoHash<Mask>(buf, offset + pos, maxlen - pos);
+    if (thislen < 0) return thislen; else pos += thislen;
+
+    return pos;
+}
+
+int KeyValuePair::getEncodedSize() const
+{
+    return 8 + _getEncodedSizeNoHash();
+}
+
+int64_t KeyValuePair::getHash()
+{
+    return kHash;
+}
+
+const char* KeyValuePair::getTypeName()
+{
+    return "KeyValuePair";
+}
+
+int KeyValuePair::_encodeNoHash(void *buf, int offset, int maxlen) const
+{
+    int pos = 0, tlen;
+
+    char* key_cstr = const_cast<char*>(this->key.c_str());
+    tlen = __string_encode_array(
+        buf, offset + pos, maxlen - pos, &key_cstr, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    char* value_cstr = const_cast<char*>(this->value.c_str());
+    tlen = __string_encode_array(
+        buf, offset + pos, maxlen - pos, &value_cstr, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    return pos;
+}
+
+template <typename Writer>
+void KeyValuePair::_writeNoHash(Writer &out) const
+{
+    out.put(this->key);
+    out.put(this->value);
+}
+
+int KeyValuePair::_decodeNoHash(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, tlen;
+
+    int32_t __key_len__;
+    tlen = __int32_t_decode_array(
+        buf, offset + pos, maxlen - pos, &__key_len__, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+    if(__key_len__ < 1 || __key_len__ > maxlen - pos) return -1;
+    this->key.assign(
+        static_cast<const char*>(buf) + offset + pos, __key_len__ - 1);
+    pos += __key_len__;
+
+    int32_t __value_len__;
+    tlen = __int32_t_decode_array(
+        buf, offset + pos, maxlen - pos, &__value_len__, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+    if(__value_len__ < 1 || __value_len__ > maxlen - pos) return -1;
+    this->value.assign(
+        static_cast<const char*>(buf) + offset + pos, __value_len__ - 1);
+    pos += __value_len__;
+
+    return pos;
+}
+
+template <uint64_t Mask>
+int KeyValuePair::_decodeFieldsNoHash(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, tlen;
+
+    if ((Mask & Fields::key) != 0) {
+        int32_t __key_len__;
+        tlen = __int32_t_decode_array(
+            buf, offset + pos, maxlen - pos, &__key_len__, 1);
+        if(tlen < 0) return tlen; else pos += tlen;
+        if(__key_len__ < 1 || __key_len__ > maxlen - pos) return -1;
+        this->key.assign(
+            static_cast<const char*>(buf) + offset + pos, __key_len__ - 1);
+        pos += __key_len__;
+    } else {
+        int32_t __key_len__;
+        tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &__key_len__, 1);
+        if(tlen < 0) return tlen; else pos += tlen;
+        if(__key_len__ < 0 || __key_len__ > maxlen - pos) return -1;
+        pos += __key_len__;
+    }
+
+    if ((Mask & Fields::value) != 0) {
+        int32_t __value_len__;
+        tlen = __int32_t_decode_array(
+            buf, offset + pos, maxlen - pos, &__value_len__, 1);
+        if(tlen < 0) return tlen; else pos += tlen;
+        if(__value_len__ < 1 || __value_len__ > maxlen - pos) return -1;
+        this->value.assign(
+            static_cast<const char*>(buf) + offset + pos, __value_len__ - 1);
+        pos += __value_len__;
+    } else {
+        int32_t __value_len__;
+        tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &__value_len__, 1);
+        if(tlen < 0) return tlen; else pos += tlen;
+        if(__value_len__ < 0 || __value_len__ > maxlen - pos) return -1;
+        pos += __value_len__;
+    }
+
+    return pos;
+}
+
+int KeyValuePair::_getEncodedSizeNoHash() const
+{
+    int enc_size = 0;
+    enc_size += this->key.size() + 4 + 1;
+    enc_size += this->value.size() + 4 + 1;
+    return enc_size;
+}
+
+int KeyValuePair::_skipNoHash(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, tlen;
+    int32_t __key_len__;
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &__key_len__, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+    if(__key_len__ < 0 || __key_len__ > maxlen - pos) return -1;
+    pos += __key_len__;
+    int32_t __value_len__;
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &__value_len__, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+    if(__value_len__ < 0 || __value_len__ > maxlen - pos) return -1;
+    pos += __value_len__;
+    if(pos > maxlen) return -1;
+    return pos;
+}
+
+template <typename Self, typename Visitor>
+void KeyValuePair::_forEachField(Self &self, Visitor &visitor)
+{
+    visitor(kFields[0], self.key);
+    visitor(kFields[1], self.value);
+}
+
+uint64_t KeyValuePair::_computeHash(const __lcm_hash_ptr *)
+{
+    uint64_t hash = 0x97574015d52eeddeLL;
+    return (hash<<1) + ((hash>>63)&1);
+}
+
+}
+}
+
+#endif
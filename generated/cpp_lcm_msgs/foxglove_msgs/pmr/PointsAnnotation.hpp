@@ -0,0 +1,608 @@
+/** THIS IS AN AUTOMATICALLY GENERATED FILE.  DO NOT MODIFY
+ * BY HAND!!
+ *
+ * Generated by lcm-cpp (tools/cpp/gen)
+ **/
+
+#ifndef __foxglove_msgs_pmr_PointsAnnotation_hpp__
+#define __foxglove_msgs_pmr_PointsAnnotation_hpp__
+
+#include <lcm/lcm_coretypes.h>
+
+#include <array>
+#include <memory_resource>
+#include <utility>
+#include <vector>
+#include "dimos_lcm/writer.hpp"
+#include "dimos_lcm/fingerprint.hpp"
+#include "dimos_lcm/reflection.hpp"
+#include "builtin_interfaces/pmr/Time.hpp"
+#include "foxglove_msgs/pmr/Point2.hpp"
+#include "foxglove_msgs/pmr/Color.hpp"
+
+namespace foxglove_msgs
+{
+namespace pmr
+{
+
+class PointsAnnotation
+{
+    public:
+        int32_t    points_length;
+
+        int32_t    outline_colors_length;
+
+        builtin_interfaces::pmr::Time timestamp;
+
+        uint8_t    type;
+
+        /**
+         * LCM Type: foxglove_msgs.Point2[points_length]
+         */
+        std::pmr::vector< foxglove_msgs::pmr::Point2 > points;
+
+        foxglove_msgs::pmr::Color outline_color;
+
+        /**
+         * LCM Type: foxglove_msgs.Color[outline_colors_length]
+         */
+        std::pmr::vector< foxglove_msgs::pmr::Color > outline_colors;
+
+        foxglove_msgs::pmr::Color fill_color;
+
+        double     thickness;
+
+    public:
+        // If you're using C++11 and are getting compiler errors saying
+        // things like ‘constexpr’ needed for in-class initialization of
+        // static data member then re-run lcm-gen with '--cpp-std=c++11'
+        // to generate code that is compliant with C++11
+        static const int8_t   UNKNOWN = 0;
+        // If you're using C++11 and are getting compiler errors saying
+        // things like ‘constexpr’ needed for in-class initialization of
+        // static data member then re-run lcm-gen with '--cpp-std=c++11'
+        // to generate code that is compliant with C++11
+        static const int8_t   POINTS = 1;
+        // If you're using C++11 and are getting compiler errors saying
+        // things like ‘constexpr’ needed for in-class initialization of
+        // static data member then re-run lcm-gen with '--cpp-std=c++11'
+        // to generate code that is compliant with C++11
+        static const int8_t   LINE_LOOP = 2;
+        // If you're using C++11 and are getting compiler errors saying
+        // things like ‘constexpr’ needed for in-class initialization of
+        // static data member then re-run lcm-gen with '--cpp-std=c++11'
+        // to generate code that is compliant with C++11
+        static const int8_t   LINE_STRIP = 3;
+        // If you're using C++11 and are getting compiler errors saying
+        // things like ‘constexpr’ needed for in-class initialization of
+        // static data member then re-run lcm-gen with '--cpp-std=c++11'
+        // to generate code that is compliant with C++11
+        static const int8_t   LINE_LIST = 4;
+
+    public:
+        typedef std::pmr::polymorphic_allocator<char> allocator_type;
+
+        /**
+         * Construct a message whose strings and arrays, and those of the
+         * messages it nests, allocate from @p alloc. Scalars are zeroed.
+         */
+        inline explicit PointsAnnotation(const allocator_type &alloc = allocator_type());
+
+        /**
+         * Copy or move @p other into a message that allocates from @p alloc.
+         * With allocator_type, these let std::pmr containers of PointsAnnotation pass
+         * their memory resource on to their elements.
+         */
+        inline PointsAnnotation(const PointsAnnotation &other, const allocator_type &alloc);
+        inline PointsAnnotation(PointsAnnotation &&other, const allocator_type &alloc);
+
+        /**
+         * Encode a message into binary form.
+         *
+         * @param buf The output buffer.
+         * @param offset Encoding starts at thie byte offset into @p buf.
+         * @param maxlen Maximum number of bytes to write.  This should generally be
+         *  equal to getEncodedSize().
+         * @return The number of bytes encoded, or <0 on error.
+         */
+        inline int encode(void *buf, int offset, int maxlen) const;
+
+        /**
+         * Encode a message by appending it to @p buf, walking the message once
+         * instead of sizing it with getEncodedSize() first. @p buf grows
+         * geometrically; reuse it across calls to avoid reallocating.
+         *
+         * @return The number of bytes appended.
+         */
+        inline int encodeTo(std::vector<uint8_t> &buf) const;
+
+        /**
+         * Check how many bytes are required to encode this message.
+         */
+        inline int getEncodedSize() const;
+
+        /**
+         * Decode a message from binary form into this instance.
+         *
+         * @param buf The buffer containing the encoded message.
+         * @param offset The byte offset into @p buf where the encoded message starts.
+         * @param maxlen The maximum number of bytes to read while decoding.
+         * @return The number of bytes decoded, or <0 if an error occured.
+         */
+        inline int decode(const void *buf, int offset, int maxlen);
+
+        /**
+         * Field bits for decodeFields().
+         */
+        struct Fields
+        {
+            static constexpr uint64_t points_length = 1ULL << 0;
+            static constexpr uint64_t outline_colors_length = 1ULL << 1;
+            static constexpr uint64_t timestamp = 1ULL << 2;
+            static constexpr uint64_t type = 1ULL << 3;
+            static constexpr uint64_t points = 1ULL << 4;
+            static constexpr uint64_t outline_color = 1ULL << 5;
+            static constexpr uint64_t outline_colors = 1ULL << 6;
+            static constexpr uint64_t fill_color = 1ULL << 7;
+            static constexpr uint64_t thickness = 1ULL << 8;
+            static constexpr uint64_t all = (1ULL << 9) - 1;
+        };
+
+        /**
+         * Decode only the fields selected by @p Mask, a bitwise or of Fields
+         * values. Strings, arrays and nested structs that are not selected are
+         * skipped over by their length prefixes without being allocated, and
+         * keep their previous value. Scalar fields are always decoded: they
+         * cost nothing to read and array lengths depend on them.
+         *
+         * @return The number of bytes decoded, or <0 if an error occured.
+         */
+        template <uint64_t Mask>
+        inline int decodeFields(const void *buf, int offset, int maxlen);
+
+        /**
+         * Upper bound on the length of every variable-length array of this
+         * type, checked by decode() before anything is allocated; messages
+         * exceeding it fail to decode. It does not apply to nested types,
+         * which have their own. Set it once at startup, before decoding.
+         * Before C++17 it is a constant with no limit.
+         */
+#if __cplusplus >= 201703L
+        static inline int32_t maxArrayLength = INT32_MAX;
+#else
+        static constexpr int32_t maxArrayLength = INT32_MAX;
+#endif
+
+        /**
+         * Retrieve the 64-bit fingerprint identifying the structure of the message.
+         * Note that the fingerprint is the same for all instances of the same
+         * message type, and is a fingerprint on the message type definition, not on
+         * the message contents.
+         */
+        inline static int64_t getHash();
+
+        /**
+         * The fingerprint returned by getHash(), as a compile-time constant.
+         */
+        static constexpr int64_t kHash = static_cast<int64_t>(0x42fd5c4dfe5d66e4ULL);
+
+        /**
+         * Returns "PointsAnnotation"
+         */
+        inline static const char* getTypeName();
+
+        /**
+         * Name, LCM type and array dimensions of each field, in wire order.
+         * See dimos_lcm::for_each_field() for visiting the fields themselves.
+         */
+        static constexpr std::array<dimos_lcm::field_info, 9> kFields = {{
+            { "points_length", "int32_t", true, 0, 0, NULL },
+            { "outline_colors_length", "int32_t", true, 0, 0, NULL },
+            { "timestamp", "builtin_interfaces.Time", false, 0, 0, NULL },
+            { "type", "byte", true, 0, 0, NULL },
+            { "points", "foxglove_msgs.Point2", false, 1, -1, "points_length" },
+            { "outline_color", "foxglove_msgs.Color", false, 0, 0, NULL },
+            { "outline_colors", "foxglove_msgs.Color", false, 1, -1, "outline_colors_length" },
+            { "fill_color", "foxglove_msgs.Color", false, 0, 0, NULL },
+            { "thickness", "double", true, 0, 0, NULL },
+        }};
+
+        // LCM support functions. Users should not call these
+        inline int _encodeNoHash(void *buf, int offset, int maxlen) const;
+        template <typename Writer>
+        inline void _writeNoHash(Writer &out) const;
+        inline int _getEncodedSizeNoHash() const;
+        inline int _decodeNoHash(const void *buf, int offset, int maxlen);
+        template <uint64_t Mask>
+        inline int _decodeFieldsNoHash(const void *buf, int offset, int maxlen);
+        template <typename Self, typename Visitor>
+        inline static void _forEachField(Self &self, Visitor &visitor);
+        inline static int _skipNoHash(const void *buf, int offset, int maxlen);
+        inline static uint64_t _computeHash(const __lcm_hash_ptr *p);
+};
+
+static_assert(PointsAnnotation::kHash == dimos_lcm::fingerprint(
+    dimos_lcm::signature_hash()
+        .member("points_length", "int32_t", 0)
+        .member("outline_colors_length", "int32_t", 0)
+        .member("timestamp", NULL, 0)
+        .member("type", "byte", 0)
+        .member("points", NULL, 1).dim(true, "points_length")
+        .member("outline_color", NULL, 0)
+        .member("outline_colors", NULL, 1).dim(true, "outline_colors_length")
+        .member("fill_color", NULL, 0)
+        .member("thickness", "double", 0)
+        .value(),
+    builtin_interfaces::pmr::Time::kHash,
+    foxglove_msgs::pmr::Point2::kHash,
+    foxglove_msgs::pmr::Color::kHash,
+    foxglove_msgs::pmr::Color::kHash,
+    foxglove_msgs::pmr::Color::kHash),
+    "foxglove_msgs::pmr::PointsAnnotation fingerprint does not match its definition");
+
+PointsAnnotation::PointsAnnotation(const allocator_type &alloc) :
+    points_length(),
+    outline_colors_length(),
+    timestamp(),
+    type(),
+    points(alloc),
+    outline_color(),
+    outline_colors(alloc),
+    fill_color(),
+    thickness()
+{
+}
+
+PointsAnnotation::PointsAnnotation(const PointsAnnotation &other, const allocator_type &alloc) :
+    PointsAnnotation(alloc)
+{
+    *this = other;
+}
+
+PointsAnnotation::PointsAnnotation(PointsAnnotation &&other, const allocator_type &alloc) :
+    PointsAnnotation(alloc)
+{
+    *this = std::move(other);
+}
+
+int PointsAnnotation::encode(void *buf, int offset, int maxlen) const
+{
+    int pos = 0, tlen;
+    int64_t hash = getHash();
+
+    tlen = __int64_t_encode_array(buf, offset + pos, maxlen - pos, &hash, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = this->_encodeNoHash(buf, offset + pos, maxlen - pos);
+    if (tlen < 0) return tlen; else pos += tlen;
+
+    return pos;
+}
+
+int PointsAnnotation::encodeTo(std::vector<uint8_t> &buf) const
+{
+    dimos_lcm::vector_writer out(buf);
+    int64_t hash = getHash();
+    out.put(&hash, 1);
+    this->_writeNoHash(out);
+    return static_cast<int>(out.size());
+}
+
+int PointsAnnotation::decode(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, thislen;
+
+    int64_t msg_hash;
+    thislen = __int64_t_decode_array(buf, offset + pos, maxlen - pos, &msg_hash, 1);
+    if (thislen < 0) return thislen; else pos += thislen;
+    if (msg_hash != getHash()) return -1;
+
+    thislen = this->_decodeNoHash(buf, offset + pos, maxlen - pos);
+    if (thislen < 0) return thislen; else pos += thislen;
+
+    return pos;
+}
+
+template <uint64_t Mask>
+int PointsAnnotation::decodeFields(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, thislen;
+
+    int64_t msg_hash;
+    thislen = __int64_t_decode_array(buf, offset + pos, maxlen - pos, &msg_hash, 1);
+    if (thislen < 0) return thislen; else pos += thislen;
+    if (msg_hash != getHash()) return -1;
+
+    thislen = this->_decodeFieldsNoHash<Mask>(buf, offset + pos, maxlen - pos);
+    if (thislen < 0) return thislen; else pos += thislen;
+
+    return pos;
+}
+
+int PointsAnnotation::getEncodedSize() const
+{
+    return 8 + _getEncodedSizeNoHash();
+}
+
+int64_t PointsAnnotation::getHash()
+{
+    return kHash;
+}
+
+const char* PointsAnnotation::getTypeName()
+{
+    return "PointsAnnotation";
+}
+
+int PointsAnnotation::_encodeNoHash(void *buf, int offset, int maxlen) const
+{
+    int pos = 0, tlen;
+
+    tlen = __int32_t_encode_array(buf, offset + pos, maxlen - pos, &this->points_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = __int32_t_encode_array(buf, offset + pos, maxlen - pos, &this->outline_colors_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = this->timestamp._encodeNoHash(buf, offset + pos, maxlen - pos);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = __byte_encode_array(buf, offset + pos, maxlen - pos, &this->type, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    for (int a0 = 0; a0 < this->points_length; a0++) {
+        tlen = this->points[a0]._encodeNoHash(buf, offset + pos, maxlen - pos);
+        if(tlen < 0) return tlen; else pos += tlen;
+    }
+
+    tlen = this->outline_color._encodeNoHash(buf, offset + pos, maxlen - pos);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    for (int a0 = 0; a0 < this->outline_colors_length; a0++) {
+        tlen = this->outline_colors[a0]._encodeNoHash(buf, offset + pos, maxlen - pos);
+        if(tlen < 0) return tlen; else pos += tlen;
+    }
+
+    tlen = this->fill_color._encodeNoHash(buf, offset + pos, maxlen - pos);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = __double_encode_array(buf, offset + pos, maxlen - pos, &this->thickness, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    return pos;
+}
+
+template <typename Writer>
+void PointsAnnotation::_writeNoHash(Writer &out) const
+{
+    out.put(&this->points_length, 1);
+    out.put(&this->outline_colors_length, 1);
+    this->timestamp._writeNoHash(out);
+    out.put(&this->type, 1);
+    if(this->points_length > 0)
+        out.putStructArray(&this->points[0], this->points_length);
+    this->outline_color._writeNoHash(out);
+    if(this->outline_colors_length > 0)
+        out.putStructArray(&this->outline_colors[0], this->outline_colors_length);
+    this->fill_color._writeNoHash(out);
+    out.put(&this->thickness, 1);
+}
+
+int PointsAnnotation::_decodeNoHash(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, tlen;
+
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &this->points_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &this->outline_colors_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = this->timestamp._decodeNoHash(buf, offset + pos, maxlen - pos);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = __byte_decode_array(buf, offset + pos, maxlen - pos, &this->type, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    if(this->points_length < 0 || this->points_length > (maxlen - pos) / 16 || this->points_length > maxArrayLength) return -1;
+    try {
+        this->points.resize(this->points_length);
+    } catch (...) {
+        return -1;
+    }
+    for (int a0 = 0; a0 < this->points_length; a0++) {
+        tlen = this->points[a0]._decodeNoHash(buf, offset + pos, maxlen - pos);
+        if(tlen < 0) return tlen; else pos += tlen;
+    }
+
+    tlen = this->outline_color._decodeNoHash(buf, offset + pos, maxlen - pos);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    if(this->outline_colors_length < 0 || this->outline_colors_length > (maxlen - pos) / 32 || this->outline_colors_length > maxArrayLength) return -1;
+    try {
+        this->outline_colors.resize(this->outline_colors_length);
+    } catch (...) {
+        return -1;
+    }
+    for (int a0 = 0; a0 < this->outline_colors_length; a0++) {
+        tlen = this->outline_colors[a0]._decodeNoHash(buf, offset + pos, maxlen - pos);
+        if(tlen < 0) return tlen; else pos += tlen;
+    }
+
+    tlen = this->fill_color._decodeNoHash(buf, offset + pos, maxlen - pos);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = __double_decode_array(buf, offset + pos, maxlen - pos, &this->thickness, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    return pos;
+}
+
+template <uint64_t Mask>
+int PointsAnnotation::_decodeFieldsNoHash(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, tlen;
+
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &this->points_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &this->outline_colors_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    if ((Mask & Fields::timestamp) != 0) {
+        tlen = this->timestamp._decodeNoHash(buf, offset + pos, maxlen - pos);
+        if(tlen < 0) return tlen; else pos += tlen;
+    } else {
+        tlen = builtin_interfaces::pmr::Time::_skipNoHash(buf, offset + pos, maxlen - pos);
+        if(tlen < 0) return tlen; else pos += tlen;
+    }
+
+    tlen = __byte_decode_array(buf, offset + pos, maxlen - pos, &this->type, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    if ((Mask & Fields::points) != 0) {
+        if(this->points_length < 0 || this->points_length > (maxlen - pos) / 16 || this->points_length > maxArrayLength) return -1;
+        try {
+            this->points.resize(this->points_length);
+        } catch (...) {
+            return -1;
+        }
+        for (int a0 = 0; a0 < this->points_length; a0++) {
+            tlen = this->points[a0]._decodeNoHash(buf, offset + pos, maxlen - pos);
+            if(tlen < 0) return tlen; else pos += tlen;
+        }
+    } else {
+        if(this->points_length < 0) return -1;
+        for (int a0 = 0; a0 < this->points_length; a0++) {
+            tlen = foxglove_msgs::pmr::Point2::_skipNoHash(buf, offset + pos, maxlen - pos);
+            if(tlen < 0) return tlen; else pos += tlen;
+        }
+    }
+
+    if ((Mask & Fields::outline_color) != 0) {
+        tlen = this->outline_color._decodeNoHash(buf, offset + pos, maxlen - pos);
+        if(tlen < 0) return tlen; else pos += tlen;
+    } else {
+        tlen = foxglove_msgs::pmr::Color::_skipNoHash(buf, offset + pos, maxlen - pos);
+        if(tlen < 0) return tlen; else pos += tlen;
+    }
+
+    if ((Mask & Fields::outline_colors) != 0) {
+        if(this->outline_colors_length < 0 || this->outline_colors_length > (maxlen - pos) / 32 || this->outline_colors_length > maxArrayLength) return -1;
+        try {
+            this->outline_colors.resize(this->outline_colors_length);
+        } catch (...) {
+            return -1;
+        }
+        for (int a0 = 0; a0 < this->outline_colors_length; a0++) {
+            tlen = this->outline_colors[a0]._decodeNoHash(buf, offset + pos, maxlen - pos);
+            if(tlen < 0) return tlen; else pos += tlen;
+        }
+    } else {
+        if(this->outline_colors_length < 0) return -1;
+        for (int a0 = 0; a0 < this->outline_colors_length; a0++) {
+            tlen = foxglove_msgs::pmr::Color::_skipNoHash(buf, offset + pos, maxlen - pos);
+            if(tlen < 0) return tlen; else pos += tlen;
+        }
+    }
+
+    if ((Mask & Fields::fill_color) != 0) {
+        tlen = this->fill_color._decodeNoHash(buf, offset + pos, maxlen - pos);
+        if(tlen < 0) return tlen; else pos += tlen;
+    } else {
+        tlen = foxglove_msgs::pmr::Color::_skipNoHash(buf, offset + pos, maxlen - pos);
+        if(tlen < 0) return tlen; else pos += tlen;
+    }
+
+    tlen = __double_decode_array(buf, offset + pos, maxlen - pos, &this->thickness, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    return pos;
+}
+
+int PointsAnnotation::_getEncodedSizeNoHash() const
+{
+    int enc_size = 0;
+    enc_size += __int32_t_encoded_array_size(NULL, 1);
+    enc_size += __int32_t_encoded_array_size(NULL, 1);
+    enc_size += this->timestamp._getEncodedSizeNoHash();
+    enc_size += __byte_encoded_array_size(NULL, 1);
+    for (int a0 = 0; a0 < this->points_length; a0++) {
+        enc_size += this->points[a0]._getEncodedSizeNoHash();
+    }
+    enc_size += this->outline_color._getEncodedSizeNoHash();
+    for (int a0 = 0; a0 < this->outline_colors_length; a0++) {
+        enc_size += this->outline_colors[a0]._getEncodedSizeNoHash();
+    }
+    enc_size += this->fill_color._getEncodedSizeNoHash();
+    enc_size += __double_encoded_array_size(NULL, 1);
+    return enc_size;
+}
+
+int PointsAnnotation::_skipNoHash(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, tlen;
+    int32_t points_length;
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &points_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+    int32_t outline_colors_length;
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &outline_colors_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+    tlen = builtin_interfaces::pmr::Time::_skipNoHash(buf, offset + pos, maxlen - pos);
+    if(tlen < 0) return tlen; else pos += tlen;
+    pos += 1;
+    if(points_length < 0) return -1;
+    for (int a0 = 0; a0 < points_length; a0++) {
+        tlen = foxglove_msgs::pmr::Point2::_skipNoHash(buf, offset + pos, maxlen - pos);
+        if(tlen < 0) return tlen; else pos += tlen;
+    }
+    tlen = foxglove_msgs::pmr::Color::_skipNoHash(buf, offset + pos, maxlen - pos);
+    if(tlen < 0) return tlen; else pos += tlen;
+    if(outline_colors_length < 0) return -1;
+    for (int a0 = 0; a0 < outline_colors_length; a0++) {
+        tlen = foxglove_msgs::pmr::Color::_skipNoHash(buf, offset + pos, maxlen - pos);
+        if(tlen < 0) return tlen; else pos += tlen;
+    }
+    tlen = foxglove_msgs::pmr::Color::_skipNoHash(buf, offset + pos, maxlen - pos);
+    if(tlen < 0) return tlen; else pos += tlen;
+    pos += 8;
+    if(pos > maxlen) return -1;
+    return pos;
+}
+
+template <typename Self, typename Visitor>
+void PointsAnnotation::_forEachField(Self &self, Visitor &visitor)
+{
+    visitor(kFields[0], self.points_length);
+    visitor(kFields[1], self.outline_colors_length);
+    visitor(kFields[2], self.timestamp);
+    visitor(kFields[3], self.type);
+    visitor(kFields[4], self.points);
+    visitor(kFields[5], self.outline_color);
+    visitor(kFields[6], self.outline_colors);
+    visitor(kFields[7], self.fill_color);
+    visitor(kFields[8], self.thickness);
+}
+
+uint64_t PointsAnnotation::_computeHash(const __lcm_hash_ptr *p)
+{
+    const __lcm_hash_ptr *fp;
+    for(fp = p; fp != NULL; fp = fp->parent)
+        if(fp->v == PointsAnnotation::getHash)
+            return 0;
+    const __lcm_hash_ptr cp = { p, PointsAnnotation::getHash };
+
+    uint64_t hash = 0x97465363cc7c2a18LL +
+         builtin_interfaces::pmr::Time::_computeHash(&cp) +
+         foxglove_msgs::pmr::Point2::_computeHash(&cp) +
+         foxglove_msgs::pmr::Color::_computeHash(&cp) +
+         foxglove_msgs::pmr::Color::_computeHash(&cp) +
+         foxglove_msgs::pmr::Color::_computeHash(&cp);
+
+    return (hash<<1) + ((hash>>63)&1);
+}
+
+}
+}
+
+#endif
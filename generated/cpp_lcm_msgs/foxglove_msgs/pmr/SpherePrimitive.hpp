@@ -0,0 +1,23 @@
+/** THIS IS AN AUTOMATICALLY GENERATED FILE.  DO NOT MODIFY
+ * BY HAND!!
+ *
+ * Generated by lcm-cpp (tools/cpp/gen)
+ **/
+
+#ifndef __foxglove_msgs_pmr_SpherePrimitive_hpp__
+#define __foxglove_msgs_pmr_SpherePrimitive_hpp__
+
+#include "foxglove_msgs/SpherePrimitive.hpp"
+
+namespace foxglove_msgs
+{
+namespace pmr
+{
+
+// SpherePrimitive has no strings or variable-length arrays, so it never allocates
+typedef foxglove_msgs::SpherePrimitive SpherePrimitive;
+
+}
+}
+
+#endif
@@ -0,0 +1,23 @@
+/** THIS IS AN AUTOMATICALLY GENERATED FILE.  DO NOT MODIFY
+ * BY HAND!!
+ *
+ * Generated by lcm-cpp (tools/cpp/gen)
+ **/
+
+#ifndef __foxglove_msgs_pmr_Vector2_hpp__
+#define __foxglove_msgs_pmr_Vector2_hpp__
+
+#include "foxglove_msgs/Vector2.hpp"
+
+namespace foxglove_msgs
+{
+namespace pmr
+{
+
+// Vector2 has no strings or variable-length arrays, so it never allocates
+typedef foxglove_msgs::Vector2 Vector2;
+
+}
+}
+
+#endif
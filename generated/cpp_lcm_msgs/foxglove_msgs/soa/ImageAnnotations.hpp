@@ -0,0 +1,462 @@
+/** THIS IS AN AUTOMATICALLY GENERATED FILE.  DO NOT MODIFY
+ * BY HAND!!
+ *
+ * Generated by lcm-cpp (tools/cpp/gen)
+ **/
+
+#ifndef __foxglove_msgs_soa_ImageAnnotations_hpp__
+#define __foxglove_msgs_soa_ImageAnnotations_hpp__
+
+#include <lcm/lcm_coretypes.h>
+
+#include <array>
+#include <vector>
+#include "dimos_lcm/writer.hpp"
+#include "dimos_lcm/fingerprint.hpp"
+#include "dimos_lcm/reflection.hpp"
+#include "foxglove_msgs/CircleAnnotationColumns.hpp"
+#include "foxglove_msgs/soa/PointsAnnotation.hpp"
+#include "foxglove_msgs/TextAnnotationColumns.hpp"
+
+namespace foxglove_msgs
+{
+namespace soa
+{
+
+class ImageAnnotations
+{
+    public:
+        int32_t    circles_length;
+
+        int32_t    points_length;
+
+        int32_t    texts_length;
+
+        /**
+         * LCM Type: foxglove_msgs.CircleAnnotation[circles_length]
+         */
+        foxglove_msgs::CircleAnnotationColumns circles;
+
+        /**
+         * LCM Type: foxglove_msgs.PointsAnnotation[points_length]
+         */
+        std::vector< foxglove_msgs::soa::PointsAnnotation > points;
+
+        /**
+         * LCM Type: foxglove_msgs.TextAnnotation[texts_length]
+         */
+        foxglove_msgs::TextAnnotationColumns texts;
+
+    public:
+        /**
+         * Encode a message into binary form.
+         *
+         * @param buf The output buffer.
+         * @param offset Encoding starts at thie byte offset into @p buf.
+         * @param maxlen Maximum number of bytes to write.  This should generally be
+         *  equal to getEncodedSize().
+         * @return The number of bytes encoded, or <0 on error.
+         */
+        inline int encode(void *buf, int offset, int maxlen) const;
+
+        /**
+         * Encode a message by appending it to @p buf, walking the message once
+         * instead of sizing it with getEncodedSize() first. @p buf grows
+         * geometrically; reuse it across calls to avoid reallocating.
+         *
+         * @return The number of bytes appended.
+         */
+        inline int encodeTo(std::vector<uint8_t> &buf) const;
+
+        /**
+         * Check how many bytes are required to encode this message.
+         */
+        inline int getEncodedSize() const;
+
+        /**
+         * Decode a message from binary form into this instance.
+         *
+         * @param buf The buffer containing the encoded message.
+         * @param offset The byte offset into @p buf where the encoded message starts.
+         * @param maxlen The maximum number of bytes to read while decoding.
+         * @return The number of bytes decoded, or <0 if an error occured.
+         */
+        inline int decode(const void *buf, int offset, int maxlen);
+
+        /**
+         * Field bits for decodeFields().
+         */
+        struct Fields
+        {
+            static constexpr uint64_t circles_length = 1ULL << 0;
+            static constexpr uint64_t points_length = 1ULL << 1;
+            static constexpr uint64_t texts_length = 1ULL << 2;
+            static constexpr uint64_t circles = 1ULL << 3;
+            static constexpr uint64_t points = 1ULL << 4;
+            static constexpr uint64_t texts = 1ULL << 5;
+            static constexpr uint64_t all = (1ULL << 6) - 1;
+        };
+
+        /**
+         * Decode only the fields selected by @p Mask, a bitwise or of Fields
+         * values. Strings, arrays and nested structs that are not selected are
+         * skipped over by their length prefixes without being allocated, and
+         * keep their previous value. Scalar fields are always decoded: they
+         * cost nothing to read and array lengths depend on them.
+         *
+         * @return The number of bytes decoded, or <0 if an error occured.
+         */
+        template <uint64_t Mask>
+        inline int decodeFields(const void *buf, int offset, int maxlen);
+
+        /**
+         * Upper bound on the length of every variable-length array of this
+         * type, checked by decode() before anything is allocated; messages
+         * exceeding it fail to decode. It does not apply to nested types,
+         * which have their own. Set it once at startup, before decoding.
+         * Before C++17 it is a constant with no limit.
+         */
+#if __cplusplus >= 201703L
+        static inline int32_t maxArrayLength = INT32_MAX;
+#else
+        static constexpr int32_t maxArrayLength = INT32_MAX;
+#endif
+
+        /**
+         * Retrieve the 64-bit fingerprint identifying the structure of the message.
+         * Note that the fingerprint is the same for all instances of the same
+         * message type, and is a fingerprint on the message type definition, not on
+         * the message contents.
+         */
+        inline static int64_t getHash();
+
+        /**
+         * The fingerprint returned by getHash(), as a compile-time constant.
+         */
+        static constexpr int64_t kHash = static_cast<int64_t>(0x0c39f37be51c3424ULL);
+
+        /**
+         * Returns "ImageAnnotations"
+         */
+        inline static const char* getTypeName();
+
+        /**
+         * Name, LCM type and array dimensions of each field, in wire order.
+         * See dimos_lcm::for_each_field() for visiting the fields themselves.
+         */
+        static constexpr std::array<dimos_lcm::field_info, 6> kFields = {{
+            { "circles_length", "int32_t", true, 0, 0, NULL },
+            { "points_length", "int32_t", true, 0, 0, NULL },
+            { "texts_length", "int32_t", true, 0, 0, NULL },
+            { "circles", "foxglove_msgs.CircleAnnotation", false, 1, -1, "circles_length" },
+            { "points", "foxglove_msgs.PointsAnnotation", false, 1, -1, "points_length" },
+            { "texts", "foxglove_msgs.TextAnnotation", false, 1, -1, "texts_length" },
+        }};
+
+        // LCM support functions. Users should not call these
+        inline int _encodeNoHash(void *buf, int offset, int maxlen) const;
+        template <typename Writer>
+        inline void _writeNoHash(Writer &out) const;
+        inline int _getEncodedSizeNoHash() const;
+        inline int _decodeNoHash(const void *buf, int offset, int maxlen);
+        template <uint64_t Mask>
+        inline int _decodeFieldsNoHash(const void *buf, int offset, int maxlen);
+        template <typename Self, typename Visitor>
+        inline static void _forEachField(Self &self, Visitor &visitor);
+        inline static int _skipNoHash(const void *buf, int offset, int maxlen);
+        inline static uint64_t _computeHash(const __lcm_hash_ptr *p);
+};
+
+static_assert(ImageAnnotations::kHash == dimos_lcm::fingerprint(
+    dimos_lcm::signature_hash()
+        .member("circles_length", "int32_t", 0)
+        .member("points_length", "int32_t", 0)
+        .member("texts_length", "int32_t", 0)
+        .member("circles", NULL, 1).dim(true, "circles_length")
+        .member("points", NULL, 1).dim(true, "points_length")
+        .member("texts", NULL, 1).dim(true, "texts_length")
+        .value(),
+    foxglove_msgs::CircleAnnotation::kHash,
+    foxglove_msgs::soa::PointsAnnotation::kHash,
+    foxglove_msgs::TextAnnotation::kHash),
+    "foxglove_msgs::soa::ImageAnnotations fingerprint does not match its definition");
+
+int ImageAnnotations::encode(void *buf, int offset, int maxlen) const
+{
+    int pos = 0, tlen;
+    int64_t hash = getHash();
+
+    tlen = __int64_t_encode_array(buf, offset + pos, maxlen - pos, &hash, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = this->_encodeNoHash(buf, offset + pos, maxlen - pos);
+    if (tlen < 0) return tlen; else pos += tlen;
+
+    return pos;
+}
+
+int ImageAnnotations::encodeTo(std::vector<uint8_t> &buf) const
+{
+    dimos_lcm::vector_writer out(buf);
+    int64_t hash = getHash();
+    out.put(&hash, 1);
+    this->_writeNoHash(out);
+    return static_cast<int>(out.size());
+}
+
+int ImageAnnotations::decode(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, thislen;
+
+    int64_t msg_hash;
+    thislen = __int64_t_decode_array(buf, offset + pos, maxlen - pos, &msg_hash, 1);
+    if (thislen < 0) return thislen; else pos += thislen;
+    if (msg_hash != getHash()) return -1;
+
+    thislen = this->_decodeNoHash(buf, offset + pos, maxlen - pos);
+    if (thislen < 0) return thislen; else pos += thislen;
+
+    return pos;
+}
+
+template <uint64_t Mask>
+int ImageAnnotations::decodeFields(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, thislen;
+
+    int64_t msg_hash;
+    thislen = __int64_t_decode_array(buf, offset + pos, maxlen - pos, &msg_hash, 1);
+    if (thislen < 0) return thislen; else pos += thislen;
+    if (msg_hash != getHash()) return -1;
+
+    thislen = this->_decodeFieldsNoHash<Mask>(buf, offset + pos, maxlen - pos);
+    if (thislen < 0) return thislen; else pos += thislen;
+
+    return pos;
+}
+
+int ImageAnnotations::getEncodedSize() const
+{
+    return 8 + _getEncodedSizeNoHash();
+}
+
+int64_t ImageAnnotations::getHash()
+{
+    return kHash;
+}
+
+const char* ImageAnnotations::getTypeName()
+{
+    return "ImageAnnotations";
+}
+
+int ImageAnnotations::_encodeNoHash(void *buf, int offset, int maxlen) const
+{
+    int pos = 0, tlen;
+
+    tlen = __int32_t_encode_array(buf, offset + pos, maxlen - pos, &this->circles_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = __int32_t_encode_array(buf, offset + pos, maxlen - pos, &this->points_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = __int32_t_encode_array(buf, offset + pos, maxlen - pos, &this->texts_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = this->circles._encodeNoHash(buf, offset + pos, maxlen - pos, this->circles_length);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    for (int a0 = 0; a0 < this->points_length; a0++) {
+        tlen = this->points[a0]._encodeNoHash(buf, offset + pos, maxlen - pos);
+        if(tlen < 0) return tlen; else pos += tlen;
+    }
+
+    tlen = this->texts._encodeNoHash(buf, offset + pos, maxlen - pos, this->texts_length);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    return pos;
+}
+
+template <typename Writer>
+void ImageAnnotations::_writeNoHash(Writer &out) const
+{
+    out.put(&this->circles_length, 1);
+    out.put(&this->points_length, 1);
+    out.put(&this->texts_length, 1);
+    this->circles._writeNoHash(out, this->circles_length);
+    for (int a0 = 0; a0 < this->points_length; a0++)
+        this->points[a0]._writeNoHash(out);
+    this->texts._writeNoHash(out, this->texts_length);
+}
+
+int ImageAnnotations::_decodeNoHash(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, tlen;
+
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &this->circles_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &this->points_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &this->texts_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    if(this->circles_length < 0 || this->circles_length > (maxlen - pos) / 104 || this->circles_length > maxArrayLength) return -1;
+    tlen = this->circles._decodeNoHash(buf, offset + pos, maxlen - pos, this->circles_length);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    if(this->points_length < 0 || this->points_length > (maxlen - pos) / 89 || this->points_length > maxArrayLength) return -1;
+    try {
+        this->points.resize(this->points_length);
+    } catch (...) {
+        return -1;
+    }
+    for (int a0 = 0; a0 < this->points_length; a0++) {
+        tlen = this->points[a0]._decodeNoHash(buf, offset + pos, maxlen - pos);
+        if(tlen < 0) return tlen; else pos += tlen;
+    }
+
+    if(this->texts_length < 0 || this->texts_length > (maxlen - pos) / 101 || this->texts_length > maxArrayLength) return -1;
+    tlen = this->texts._decodeNoHash(buf, offset + pos, maxlen - pos, this->texts_length);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    return pos;
+}
+
+template <uint64_t Mask>
+int ImageAnnotations::_decodeFieldsNoHash(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, tlen;
+
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &this->circles_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &this->points_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &this->texts_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    if ((Mask & Fields::circles) != 0) {
+        if(this->circles_length < 0 || this->circles_length > (maxlen - pos) / 104 || this->circles_length > maxArrayLength) return -1;
+        tlen = this->circles._decodeNoHash(buf, offset + pos, maxlen - pos, this->circles_length);
+        if(tlen < 0) return tlen; else pos += tlen;
+    } else {
+        if(this->circles_length < 0) return -1;
+        for (int a0 = 0; a0 < this->circles_length; a0++) {
+            tlen = foxglove_msgs::CircleAnnotation::_skipNoHash(buf, offset + pos, maxlen - pos);
+            if(tlen < 0) return tlen; else pos += tlen;
+        }
+    }
+
+    if ((Mask & Fields::points) != 0) {
+        if(this->points_length < 0 || this->points_length > (maxlen - pos) / 89 || this->points_length > maxArrayLength) return -1;
+        try {
+            this->points.resize(this->points_length);
+        } catch (...) {
+            return -1;
+        }
+        for (int a0 = 0; a0 < this->points_length; a0++) {
+            tlen = this->points[a0]._decodeNoHash(buf, offset + pos, maxlen - pos);
+            if(tlen < 0) return tlen; else pos += tlen;
+        }
+    } else {
+        if(this->points_length < 0) return -1;
+        for (int a0 = 0; a0 < this->points_length; a0++) {
+            tlen = foxglove_msgs::soa::PointsAnnotation::_skipNoHash(buf, offset + pos, maxlen - pos);
+            if(tlen < 0) return tlen; else pos += tlen;
+        }
+    }
+
+    if ((Mask & Fields::texts) != 0) {
+        if(this->texts_length < 0 || this->texts_length > (maxlen - pos) / 101 || this->texts_length > maxArrayLength) return -1;
+        tlen = this->texts._decodeNoHash(buf, offset + pos, maxlen - pos, this->texts_length);
+        if(tlen < 0) return tlen; else pos += tlen;
+    } else {
+        if(this->texts_length < 0) return -1;
+        for (int a0 = 0; a0 < this->texts_length; a0++) {
+            tlen = foxglove_msgs::TextAnnotation::_skipNoHash(buf, offset + pos, maxlen - pos);
+            if(tlen < 0) return tlen; else pos += tlen;
+        }
+    }
+
+    return pos;
+}
+
+int ImageAnnotations::_getEncodedSizeNoHash() const
+{
+    int enc_size = 0;
+    enc_size += __int32_t_encoded_array_size(NULL, 1);
+    enc_size += __int32_t_encoded_array_size(NULL, 1);
+    enc_size += __int32_t_encoded_array_size(NULL, 1);
+    enc_size += this->circles._getEncodedSizeNoHash(this->circles_length);
+    for (int a0 = 0; a0 < this->points_length; a0++) {
+        enc_size += this->points[a0]._getEncodedSizeNoHash();
+    }
+    enc_size += this->texts._getEncodedSizeNoHash(this->texts_length);
+    return enc_size;
+}
+
+int ImageAnnotations::_skipNoHash(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, tlen;
+    int32_t circles_length;
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &circles_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+    int32_t points_length;
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &points_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+    int32_t texts_length;
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &texts_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+    if(circles_length < 0) return -1;
+    for (int a0 = 0; a0 < circles_length; a0++) {
+        tlen = foxglove_msgs::CircleAnnotation::_skipNoHash(buf, offset + pos, maxlen - pos);
+        if(tlen < 0) return tlen; else pos += tlen;
+    }
+    if(points_length < 0) return -1;
+    for (int a0 = 0; a0 < points_length; a0++) {
+        tlen = foxglove_msgs::soa::PointsAnnotation::_skipNoHash(buf, offset + pos, maxlen - pos);
+        if(tlen < 0) return tlen; else pos += tlen;
+    }
+    if(texts_length < 0) return -1;
+    for (int a0 = 0; a0 < texts_length; a0++) {
+        tlen = foxglove_msgs::TextAnnotation::_skipNoHash(buf, offset + pos, maxlen - pos);
+        if(tlen < 0) return tlen; else pos += tlen;
+    }
+    if(pos > maxlen) return -1;
+    return pos;
+}
+
+template <typename Self, typename Visitor>
+void ImageAnnotations::_forEachField(Self &self, Visitor &visitor)
+{
+    visitor(kFields[0], self.circles_length);
+    visitor(kFields[1], self.points_length);
+    visitor(kFields[2], self.texts_length);
+    visitor(kFields[3], self.circles);
+    visitor(kFields[4], self.points);
+    visitor(kFields[5], self.texts);
+}
+
+uint64_t ImageAnnotations::_computeHash(const __lcm_hash_ptr *p)
+{
+    const __lcm_hash_ptr *fp;
+    for(fp = p; fp != NULL; fp = fp->parent)
+        if(fp->v == ImageAnnotations::getHash)
+            return 0;
+    const __lcm_hash_ptr cp = { p, ImageAnnotations::getHash };
+
+    uint64_t hash = 0x8b3a52c632c59b07LL +
+         foxglove_msgs::CircleAnnotation::_computeHash(&cp) +
+         foxglove_msgs::soa::PointsAnnotation::_computeHash(&cp) +
+         foxglove_msgs::TextAnnotation::_computeHash(&cp);
+
+    return (hash<<1) + ((hash>>63)&1);
+}
+
+}
+}
+
+#endif
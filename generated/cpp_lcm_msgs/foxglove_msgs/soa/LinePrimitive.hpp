@@ -0,0 +1,573 @@
+/** THIS IS AN AUTOMATICALLY GENERATED FILE.  DO NOT MODIFY
+ * BY HAND!!
+ *
+ * Generated by lcm-cpp (tools/cpp/gen)
+ **/
+
+#ifndef __foxglove_msgs_soa_LinePrimitive_hpp__
+#define __foxglove_msgs_soa_LinePrimitive_hpp__
+
+#include <lcm/lcm_coretypes.h>
+
+#include <array>
+#include <vector>
+#include "dimos_lcm/bulk_codec.hpp"
+#include "dimos_lcm/writer.hpp"
+#include "dimos_lcm/fingerprint.hpp"
+#include "dimos_lcm/reflection.hpp"
+#include "geometry_msgs/Pose.hpp"
+#include "geometry_msgs/PointColumns.hpp"
+#include "foxglove_msgs/Color.hpp"
+#include "foxglove_msgs/ColorColumns.hpp"
+
+namespace foxglove_msgs
+{
+namespace soa
+{
+
+class LinePrimitive
+{
+    public:
+        int32_t    points_length;
+
+        int32_t    colors_length;
+
+        int32_t    indices_length;
+
+        uint8_t    type;
+
+        geometry_msgs::Pose pose;
+
+        double     thickness;
+
+        int8_t     scale_invariant;
+
+        /**
+         * LCM Type: geometry_msgs.Point[points_length]
+         */
+        geometry_msgs::PointColumns points;
+
+        foxglove_msgs::Color color;
+
+        /**
+         * LCM Type: foxglove_msgs.Color[colors_length]
+         */
+        foxglove_msgs::ColorColumns colors;
+
+        /**
+         * LCM Type: int32_t[indices_length]
+         */
+        std::vector< int32_t > indices;
+
+    public:
+        // If you're using C++11 and are getting compiler errors saying
+        // things like ‘constexpr’ needed for in-class initialization of
+        // static data member then re-run lcm-gen with '--cpp-std=c++11'
+        // to generate code that is compliant with C++11
+        static const int8_t   LINE_STRIP = 0;
+        // If you're using C++11 and are getting compiler errors saying
+        // things like ‘constexpr’ needed for in-class initialization of
+        // static data member then re-run lcm-gen with '--cpp-std=c++11'
+        // to generate code that is compliant with C++11
+        static const int8_t   LINE_LOOP = 1;
+        // If you're using C++11 and are getting compiler errors saying
+        // things like ‘constexpr’ needed for in-class initialization of
+        // static data member then re-run lcm-gen with '--cpp-std=c++11'
+        // to generate code that is compliant with C++11
+        static const int8_t   LINE_LIST = 2;
+
+    public:
+        /**
+         * Encode a message into binary form.
+         *
+         * @param buf The output buffer.
+         * @param offset Encoding starts at thie byte offset into @p buf.
+         * @param maxlen Maximum number of bytes to write.  This should generally be
+         *  equal to getEncodedSize().
+         * @return The number of bytes encoded, or <0 on error.
+         */
+        inline int encode(void *buf, int offset, int maxlen) const;
+
+        /**
+         * Encode a message by appending it to @p buf, walking the message once
+         * instead of sizing it with getEncodedSize() first. @p buf grows
+         * geometrically; reuse it across calls to avoid reallocating.
+         *
+         * @return The number of bytes appended.
+         */
+        inline int encodeTo(std::vector<uint8_t> &buf) const;
+
+        /**
+         * Check how many bytes are required to encode this message.
+         */
+        inline int getEncodedSize() const;
+
+        /**
+         * Decode a message from binary form into this instance.
+         *
+         * @param buf The buffer containing the encoded message.
+         * @param offset The byte offset into @p buf where the encoded message starts.
+         * @param maxlen The maximum number of bytes to read while decoding.
+         * @return The number of bytes decoded, or <0 if an error occured.
+         */
+        inline int decode(const void *buf, int offset, int maxlen);
+
+        /**
+         * Field bits for decodeFields().
+         */
+        struct Fields
+        {
+            static constexpr uint64_t points_length = 1ULL << 0;
+            static constexpr uint64_t colors_length = 1ULL << 1;
+            static constexpr uint64_t indices_length = 1ULL << 2;
+            static constexpr uint64_t type = 1ULL << 3;
+            static constexpr uint64_t pose = 1ULL << 4;
+            static constexpr uint64_t thickness = 1ULL << 5;
+            static constexpr uint64_t scale_invariant = 1ULL << 6;
+            static constexpr uint64_t points = 1ULL << 7;
+            static constexpr uint64_t color = 1ULL << 8;
+            static constexpr uint64_t colors = 1ULL << 9;
+            static constexpr uint64_t indices = 1ULL << 10;
+            static constexpr uint64_t all = (1ULL << 11) - 1;
+        };
+
+        /**
+         * Decode only the fields selected by @p Mask, a bitwise or of Fields
+         * values. Strings, arrays and nested structs that are not selected are
+         * skipped over by their length prefixes without being allocated, and
+         * keep their previous value. Scalar fields are always decoded: they
+         * cost nothing to read and array lengths depend on them.
+         *
+         * @return The number of bytes decoded, or <0 if an error occured.
+         */
+        template <uint64_t Mask>
+        inline int decodeFields(const void *buf, int offset, int maxlen);
+
+        /**
+         * Upper bound on the length of every variable-length array of this
+         * type, checked by decode() before anything is allocated; messages
+         * exceeding it fail to decode. It does not apply to nested types,
+         * which have their own. Set it once at startup, before decoding.
+         * Before C++17 it is a constant with no limit.
+         */
+#if __cplusplus >= 201703L
+        static inline int32_t maxArrayLength = INT32_MAX;
+#else
+        static constexpr int32_t maxArrayLength = INT32_MAX;
+#endif
+
+        /**
+         * Retrieve the 64-bit fingerprint identifying the structure of the message.
+         * Note that the fingerprint is the same for all instances of the same
+         * message type, and is a fingerprint on the message type definition, not on
+         * the message contents.
+         */
+        inline static int64_t getHash();
+
+        /**
+         * The fingerprint returned by getHash(), as a compile-time constant.
+         */
+        static constexpr int64_t kHash = static_cast<int64_t>(0xe826cb5c9850d4daULL);
+
+        /**
+         * Returns "LinePrimitive"
+         */
+        inline static const char* getTypeName();
+
+        /**
+         * Name, LCM type and array dimensions of each field, in wire order.
+         * See dimos_lcm::for_each_field() for visiting the fields themselves.
+         */
+        static constexpr std::array<dimos_lcm::field_info, 11> kFields = {{
+            { "points_length", "int32_t", true, 0, 0, NULL },
+            { "colors_length", "int32_t", true, 0, 0, NULL },
+            { "indices_length", "int32_t", true, 0, 0, NULL },
+            { "type", "byte", true, 0, 0, NULL },
+            { "pose", "geometry_msgs.Pose", false, 0, 0, NULL },
+            { "thickness", "double", true, 0, 0, NULL },
+            { "scale_invariant", "boolean", true, 0, 0, NULL },
+            { "points", "geometry_msgs.Point", false, 1, -1, "points_length" },
+            { "color", "foxglove_msgs.Color", false, 0, 0, NULL },
+            { "colors", "foxglove_msgs.Color", false, 1, -1, "colors_length" },
+            { "indices", "int32_t", true, 1, -1, "indices_length" },
+        }};
+
+        // LCM support functions. Users should not call these
+        inline int _encodeNoHash(void *buf, int offset, int maxlen) const;
+        template <typename Writer>
+        inline void _writeNoHash(Writer &out) const;
+        inline int _getEncodedSizeNoHash() const;
+        inline int _decodeNoHash(const void *buf, int offset, int maxlen);
+        template <uint64_t Mask>
+        inline int _decodeFieldsNoHash(const void *buf, int offset, int maxlen);
+        template <typename Self, typename Visitor>
+        inline static void _forEachField(Self &self, Visitor &visitor);
+        inline static int _skipNoHash(const void *buf, int offset, int maxlen);
+        inline static uint64_t _computeHash(const __lcm_hash_ptr *p);
+};
+
+static_assert(LinePrimitive::kHash == dimos_lcm::fingerprint(
+    dimos_lcm::signature_hash()
+        .member("points_length", "int32_t", 0)
+        .member("colors_length", "int32_t", 0)
+        .member("indices_length", "int32_t", 0)
+        .member("type", "byte", 0)
+        .member("pose", NULL, 0)
+        .member("thickness", "double", 0)
+        .member("scale_invariant", "boolean", 0)
+        .member("points", NULL, 1).dim(true, "points_length")
+        .member("color", NULL, 0)
+        .member("colors", NULL, 1).dim(true, "colors_length")
+        .member("indices", "int32_t", 1).dim(true, "indices_length")
+        .value(),
+    geometry_msgs::Pose::kHash,
+    geometry_msgs::Point::kHash,
+    foxglove_msgs::Color::kHash,
+    foxglove_msgs::Color::kHash),
+    "foxglove_msgs::soa::LinePrimitive fingerprint does not match its definition");
+
+int LinePrimitive::encode(void *buf, int offset, int maxlen) const
+{
+    int pos = 0, tlen;
+    int64_t hash = getHash();
+
+    tlen = __int64_t_encode_array(buf, offset + pos, maxlen - pos, &hash, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = this->_encodeNoHash(buf, offset + pos, maxlen - pos);
+    if (tlen < 0) return tlen; else pos += tlen;
+
+    return pos;
+}
+
+int LinePrimitive::encodeTo(std::vector<uint8_t> &buf) const
+{
+    dimos_lcm::vector_writer out(buf);
+    int64_t hash = getHash();
+    out.put(&hash, 1);
+    this->_writeNoHash(out);
+    return static_cast<int>(out.size());
+}
+
+int LinePrimitive::decode(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, thislen;
+
+    int64_t msg_hash;
+    thislen = __int64_t_decode_array(buf, offset + pos, maxlen - pos, &msg_hash, 1);
+    if (thislen < 0) return thislen; else pos += thislen;
+    if (msg_hash != getHash()) return -1;
+
+    thislen = this->_decodeNoHash(buf, offset + pos, maxlen - pos);
+    if (thislen < 0) return thislen; else pos += thislen;
+
+    return pos;
+}
+
+template <uint64_t Mask>
+int LinePrimitive::decodeFields(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, thislen;
+
+    int64_t msg_hash;
+    thislen = __int64_t_decode_array(buf, offset + pos, maxlen - pos, &msg_hash, 1);
+    if (thislen < 0) return thislen; else pos += thislen;
+    if (msg_hash != getHash()) return -1;
+
+    thislen = this->_decodeFieldsNoHash<Mask>(buf, offset + pos, maxlen - pos);
+    if (thislen < 0) return thislen; else pos += thislen;
+
+    return pos;
+}
+
+int LinePrimitive::getEncodedSize() const
+{
+    return 8 + _getEncodedSizeNoHash();
+}
+
+int64_t LinePrimitive::getHash()
+{
+    return kHash;
+}
+
+const char* LinePrimitive::getTypeName()
+{
+    return "LinePrimitive";
+}
+
+int LinePrimitive::_encodeNoHash(void *buf, int offset, int maxlen) const
+{
+    int pos = 0, tlen;
+
+    tlen = __int32_t_encode_array(buf, offset + pos, maxlen - pos, &this->points_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = __int32_t_encode_array(buf, offset + pos, maxlen - pos, &this->colors_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = __int32_t_encode_array(buf, offset + pos, maxlen - pos, &this->indices_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = __byte_encode_array(buf, offset + pos, maxlen - pos, &this->type, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = this->pose._encodeNoHash(buf, offset + pos, maxlen - pos);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = __double_encode_array(buf, offset + pos, maxlen - pos, &this->thickness, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = __boolean_encode_array(buf, offset + pos, maxlen - pos, &this->scale_invariant, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = this->points._encodeNoHash(buf, offset + pos, maxlen - pos, this->points_length);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = this->color._encodeNoHash(buf, offset + pos, maxlen - pos);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = this->colors._encodeNoHash(buf, offset + pos, maxlen - pos, this->colors_length);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    if(this->indices_length > 0) {
+        tlen = dimos_lcm::bulk_encode_array(buf, offset + pos, maxlen - pos, &this->indices[0], this->indices_length);
+        if(tlen < 0) return tlen; else pos += tlen;
+    }
+
+    return pos;
+}
+
+template <typename Writer>
+void LinePrimitive::_writeNoHash(Writer &out) const
+{
+    out.put(&this->points_length, 1);
+    out.put(&this->colors_length, 1);
+    out.put(&this->indices_length, 1);
+    out.put(&this->type, 1);
+    this->pose._writeNoHash(out);
+    out.put(&this->thickness, 1);
+    out.put(&this->scale_invariant, 1);
+    this->points._writeNoHash(out, this->points_length);
+    this->color._writeNoHash(out);
+    this->colors._writeNoHash(out, this->colors_length);
+    if(this->indices_length > 0)
+        out.put(&this->indices[0], this->indices_length);
+}
+
+int LinePrimitive::_decodeNoHash(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, tlen;
+
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &this->points_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &this->colors_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &this->indices_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = __byte_decode_array(buf, offset + pos, maxlen - pos, &this->type, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = this->pose._decodeNoHash(buf, offset + pos, maxlen - pos);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = __double_decode_array(buf, offset + pos, maxlen - pos, &this->thickness, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = __boolean_decode_array(buf, offset + pos, maxlen - pos, &this->scale_invariant, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    if(this->points_length < 0 || this->points_length > (maxlen - pos) / 24 || this->points_length > maxArrayLength) return -1;
+    tlen = this->points._decodeNoHash(buf, offset + pos, maxlen - pos, this->points_length);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = this->color._decodeNoHash(buf, offset + pos, maxlen - pos);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    if(this->colors_length < 0 || this->colors_length > (maxlen - pos) / 32 || this->colors_length > maxArrayLength) return -1;
+    tlen = this->colors._decodeNoHash(buf, offset + pos, maxlen - pos, this->colors_length);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    if(this->indices_length) {
+        if(this->indices_length < 0 || this->indices_length > (maxlen - pos) / 4 || this->indices_length > maxArrayLength) return -1;
+        this->indices.resize(this->indices_length);
+        tlen = dimos_lcm::bulk_decode_array(buf, offset + pos, maxlen - pos, &this->indices[0], this->indices_length);
+        if(tlen < 0) return tlen; else pos += tlen;
+    } else {
+        this->indices.clear();
+    }
+
+    return pos;
+}
+
+template <uint64_t Mask>
+int LinePrimitive::_decodeFieldsNoHash(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, tlen;
+
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &this->points_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &this->colors_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &this->indices_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = __byte_decode_array(buf, offset + pos, maxlen - pos, &this->type, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    if ((Mask & Fields::pose) != 0) {
+        tlen = this->pose._decodeNoHash(buf, offset + pos, maxlen - pos);
+        if(tlen < 0) return tlen; else pos += tlen;
+    } else {
+        tlen = geometry_msgs::Pose::_skipNoHash(buf, offset + pos, maxlen - pos);
+        if(tlen < 0) return tlen; else pos += tlen;
+    }
+
+    tlen = __double_decode_array(buf, offset + pos, maxlen - pos, &this->thickness, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = __boolean_decode_array(buf, offset + pos, maxlen - pos, &this->scale_invariant, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    if ((Mask & Fields::points) != 0) {
+        if(this->points_length < 0 || this->points_length > (maxlen - pos) / 24 || this->points_length > maxArrayLength) return -1;
+        tlen = this->points._decodeNoHash(buf, offset + pos, maxlen - pos, this->points_length);
+        if(tlen < 0) return tlen; else pos += tlen;
+    } else {
+        if(this->points_length < 0) return -1;
+        for (int a0 = 0; a0 < this->points_length; a0++) {
+            tlen = geometry_msgs::Point::_skipNoHash(buf, offset + pos, maxlen - pos);
+            if(tlen < 0) return tlen; else pos += tlen;
+        }
+    }
+
+    if ((Mask & Fields::color) != 0) {
+        tlen = this->color._decodeNoHash(buf, offset + pos, maxlen - pos);
+        if(tlen < 0) return tlen; else pos += tlen;
+    } else {
+        tlen = foxglove_msgs::Color::_skipNoHash(buf, offset + pos, maxlen - pos);
+        if(tlen < 0) return tlen; else pos += tlen;
+    }
+
+    if ((Mask & Fields::colors) != 0) {
+        if(this->colors_length < 0 || this->colors_length > (maxlen - pos) / 32 || this->colors_length > maxArrayLength) return -1;
+        tlen = this->colors._decodeNoHash(buf, offset + pos, maxlen - pos, this->colors_length);
+        if(tlen < 0) return tlen; else pos += tlen;
+    } else {
+        if(this->colors_length < 0) return -1;
+        for (int a0 = 0; a0 < this->colors_length; a0++) {
+            tlen = foxglove_msgs::Color::_skipNoHash(buf, offset + pos, maxlen - pos);
+            if(tlen < 0) return tlen; else pos += tlen;
+        }
+    }
+
+    if ((Mask & Fields::indices) != 0) {
+        if(this->indices_length) {
+            if(this->indices_length < 0 || this->indices_length > (maxlen - pos) / 4 || this->indices_length > maxArrayLength) return -1;
+            this->indices.resize(this->indices_length);
+            tlen = dimos_lcm::bulk_decode_array(buf, offset + pos, maxlen - pos, &this->indices[0], this->indices_length);
+            if(tlen < 0) return tlen; else pos += tlen;
+        } else {
+            this->indices.clear();
+        }
+    } else {
+        if(this->indices_length < 0 || this->indices_length > (maxlen - pos) / 4) return -1;
+        pos += this->indices_length * 4;
+    }
+
+    return pos;
+}
+
+int LinePrimitive::_getEncodedSizeNoHash() const
+{
+    int enc_size = 0;
+    enc_size += __int32_t_encoded_array_size(NULL, 1);
+    enc_size += __int32_t_encoded_array_size(NULL, 1);
+    enc_size += __int32_t_encoded_array_size(NULL, 1);
+    enc_size += __byte_encoded_array_size(NULL, 1);
+    enc_size += this->pose._getEncodedSizeNoHash();
+    enc_size += __double_encoded_array_size(NULL, 1);
+    enc_size += __boolean_encoded_array_size(NULL, 1);
+    enc_size += this->points._getEncodedSizeNoHash(this->points_length);
+    enc_size += this->color._getEncodedSizeNoHash();
+    enc_size += this->colors._getEncodedSizeNoHash(this->colors_length);
+    enc_size += __int32_t_encoded_array_size(NULL, this->indices_length);
+    return enc_size;
+}
+
+int LinePrimitive::_skipNoHash(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, tlen;
+    int32_t points_length;
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &points_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+    int32_t colors_length;
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &colors_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+    int32_t indices_length;
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &indices_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+    pos += 1;
+    tlen = geometry_msgs::Pose::_skipNoHash(buf, offset + pos, maxlen - pos);
+    if(tlen < 0) return tlen; else pos += tlen;
+    pos += 8;
+    pos += 1;
+    if(points_length < 0) return -1;
+    for (int a0 = 0; a0 < points_length; a0++) {
+        tlen = geometry_msgs::Point::_skipNoHash(buf, offset + pos, maxlen - pos);
+        if(tlen < 0) return tlen; else pos += tlen;
+    }
+    tlen = foxglove_msgs::Color::_skipNoHash(buf, offset + pos, maxlen - pos);
+    if(tlen < 0) return tlen; else pos += tlen;
+    if(colors_length < 0) return -1;
+    for (int a0 = 0; a0 < colors_length; a0++) {
+        tlen = foxglove_msgs::Color::_skipNoHash(buf, offset + pos, maxlen - pos);
+        if(tlen < 0) return tlen; else pos += tlen;
+    }
+    if(indices_length < 0 || indices_length > (maxlen - pos) / 4) return -1;
+    pos += indices_length * 4;
+    if(pos > maxlen) return -1;
+    return pos;
+}
+
+template <typename Self, typename Visitor>
+void LinePrimitive::_forEachField(Self &self, Visitor &visitor)
+{
+    visitor(kFields[0], self.points_length);
+    visitor(kFields[1], self.colors_length);
+    visitor(kFields[2], self.indices_length);
+    visitor(kFields[3], self.type);
+    visitor(kFields[4], self.pose);
+    visitor(kFields[5], self.thickness);
+    visitor(kFields[6], self.scale_invariant);
+    visitor(kFields[7], self.points);
+    visitor(kFields[8], self.color);
+    visitor(kFields[9], self.colors);
+    visitor(kFields[10], self.indices);
+}
+
+uint64_t LinePrimitive::_computeHash(const __lcm_hash_ptr *p)
+{
+    const __lcm_hash_ptr *fp;
+    for(fp = p; fp != NULL; fp = fp->parent)
+        if(fp->v == LinePrimitive::getHash)
+            return 0;
+    const __lcm_hash_ptr cp = { p, LinePrimitive::getHash };
+
+    uint64_t hash = 0x3b39f8eb653b3cd3LL +
+         geometry_msgs::Pose::_computeHash(&cp) +
+         geometry_msgs::Point::_computeHash(&cp) +
+         foxglove_msgs::Color::_computeHash(&cp) +
+         foxglove_msgs::Color::_computeHash(&cp);
+
+    return (hash<<1) + ((hash>>63)&1);
+}
+
+}
+}
+
+#endif
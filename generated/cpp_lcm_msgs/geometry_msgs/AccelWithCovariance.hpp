@@ -1,7 +1,7 @@
 /** THIS IS AN AUTOMATICALLY GENERATED FILE.  DO NOT MODIFY
  * BY HAND!!
  *
- * Generated by lcm-gen 1.5.2
+ * Generated by lcm-cpp (tools/cpp/gen)
  **/
 
 #ifndef __geometry_msgs_AccelWithCovariance_hpp__
@@ -9,6 +9,11 @@
 
 #include <lcm/lcm_coretypes.h>
 
+#include <array>
+#include "dimos_lcm/fixed_codec.hpp"
+#include "dimos_lcm/writer.hpp"
+#include "dimos_lcm/fingerprint.hpp"
+#include "dimos_lcm/reflection.hpp"
 #include "geometry_msgs/Accel.hpp"
 
 namespace geometry_msgs
@@ -36,11 +41,26 @@ class AccelWithCovariance
          */
         inline int encode(void *buf, int offset, int maxlen) const;
 
+        /**
+         * Encode a message by appending it to @p buf, walking the message once
+         * instead of sizing it with getEncodedSize() first. @p buf grows
+         * geometrically; reuse it across calls to avoid reallocating.
+         *
+         * @return The number of bytes appended.
+         */
+        inline int encodeTo(std::vector<uint8_t> &buf) const;
+
         /**
          * Check how many bytes are required to encode this message.
          */
         inline int getEncodedSize() const;
 
+        /**
+         * getEncodedSize() of every instance: the type has no strings or
+         * variable-length arrays.
+         */
+        static constexpr int kEncodedSize = 344;
+
         /**
          * Decode a message from binary form into this instance.
          *
@@ -59,18 +79,45 @@ class AccelWithCovariance
          */
         inline static int64_t getHash();
 
+        /**
+         * The fingerprint returned by getHash(), as a compile-time constant.
+         */
+        static constexpr int64_t kHash = static_cast<int64_t>(0x05b6be8b991eea89ULL);
+
         /**
          * Returns "AccelWithCovariance"
          */
         inline static const char* getTypeName();
 
+        /**
+         * Name, LCM type and array dimensions of each field, in wire order.
+         * See dimos_lcm::for_each_field() for visiting the fields themselves.
+         */
+        static constexpr std::array<dimos_lcm::field_info, 2> kFields = {{
+            { "accel", "geometry_msgs.Accel", false, 0, 0, NULL },
+            { "covariance", "double", true, 1, 36, NULL },
+        }};
+
         // LCM support functions. Users should not call these
         inline int _encodeNoHash(void *buf, int offset, int maxlen) const;
+        template <typename Writer>
+        inline void _writeNoHash(Writer &out) const;
         inline int _getEncodedSizeNoHash() const;
         inline int _decodeNoHash(const void *buf, int offset, int maxlen);
+        template <typename Self, typename Visitor>
+        inline static void _forEachField(Self &self, Visitor &visitor);
+        inline static int _skipNoHash(const void *buf, int offset, int maxlen);
         inline static uint64_t _computeHash(const __lcm_hash_ptr *p);
 };
 
+static_assert(AccelWithCovariance::kHash == dimos_lcm::fingerprint(
+    dimos_lcm::signature_hash()
+        .member("accel", NULL, 0)
+        .member("covariance", "double", 1).dim(false, "36")
+        .value(),
+    geometry_msgs::Accel::kHash),
+    "geometry_msgs::AccelWithCovariance fingerprint does not match its definition");
+
 int AccelWithCovariance::encode(void *buf, int offset, int maxlen) const
 {
     int pos = 0, tlen;
@@ -85,6 +132,15 @@ int AccelWithCovariance::encode(void *buf, int offset, int maxlen) const
     return pos;
 }
 
+int AccelWithCovariance::encodeTo(std::vector<uint8_t> &buf) const
+{
+    dimos_lcm::vector_writer out(buf);
+    int64_t hash = getHash();
+    out.put(&hash, 1);
+    this->_writeNoHash(out);
+    return static_cast<int>(out.size());
+}
+
 int AccelWithCovariance::decode(const void *buf, int offset, int maxlen)
 {
     int pos = 0, thislen;
@@ -107,8 +163,7 @@ int AccelWithCovariance::getEncodedSize() const
 
 int64_t AccelWithCovariance::getHash()
 {
-    static int64_t hash = static_cast<int64_t>(_computeHash(NULL));
-    return hash;
+    return kHash;
 }
 
 const char* AccelWithCovariance::getTypeName()
@@ -118,36 +173,53 @@ const char* AccelWithCovariance::getTypeName()
 
 int AccelWithCovariance::_encodeNoHash(void *buf, int offset, int maxlen) const
 {
-    int pos = 0, tlen;
-
-    tlen = this->accel._encodeNoHash(buf, offset + pos, maxlen - pos);
-    if(tlen < 0) return tlen; else pos += tlen;
-
-    tlen = __double_encode_array(buf, offset + pos, maxlen - pos, &this->covariance[0], 36);
-    if(tlen < 0) return tlen; else pos += tlen;
+    if(maxlen < kEncodedSize - 8) return -1;
+    uint8_t *p = static_cast<uint8_t*>(buf) + offset;
+    dimos_lcm::store_be(p + 0, this->accel.linear.x);
+    dimos_lcm::store_be(p + 8, this->accel.linear.y);
+    dimos_lcm::store_be(p + 16, this->accel.linear.z);
+    dimos_lcm::store_be(p + 24, this->accel.angular.x);
+    dimos_lcm::store_be(p + 32, this->accel.angular.y);
+    dimos_lcm::store_be(p + 40, this->accel.angular.z);
+    dimos_lcm::store_be_array(p + 48, &this->covariance[0], 36);
+    return kEncodedSize - 8;
+}
 
-    return pos;
+template <typename Writer>
+void AccelWithCovariance::_writeNoHash(Writer &out) const
+{
+    out.putStruct(*this);
 }
 
 int AccelWithCovariance::_decodeNoHash(const void *buf, int offset, int maxlen)
 {
-    int pos = 0, tlen;
-
-    tlen = this->accel._decodeNoHash(buf, offset + pos, maxlen - pos);
-    if(tlen < 0) return tlen; else pos += tlen;
+    if(maxlen < kEncodedSize - 8) return -1;
+    const uint8_t *p = static_cast<const uint8_t*>(buf) + offset;
+    dimos_lcm::load_be(p + 0, this->accel.linear.x);
+    dimos_lcm::load_be(p + 8, this->accel.linear.y);
+    dimos_lcm::load_be(p + 16, this->accel.linear.z);
+    dimos_lcm::load_be(p + 24, this->accel.angular.x);
+    dimos_lcm::load_be(p + 32, this->accel.angular.y);
+    dimos_lcm::load_be(p + 40, this->accel.angular.z);
+    dimos_lcm::load_be_array(p + 48, &this->covariance[0], 36);
+    return kEncodedSize - 8;
+}
 
-    tlen = __double_decode_array(buf, offset + pos, maxlen - pos, &this->covariance[0], 36);
-    if(tlen < 0) return tlen; else pos += tlen;
+int AccelWithCovariance::_getEncodedSizeNoHash() const
+{
+    return kEncodedSize - 8;
+}
 
-    return pos;
+int AccelWithCovariance::_skipNoHash(const void *, int, int maxlen)
+{
+    return maxlen < kEncodedSize - 8 ? -1 : kEncodedSize - 8;
 }
 
-int AccelWithCovariance::_getEncodedSizeNoHash() const
+template <typename Self, typename Visitor>
+void AccelWithCovariance::_forEachField(Self &self, Visitor &visitor)
 {
-    int enc_size = 0;
-    enc_size += this->accel._getEncodedSizeNoHash();
-    enc_size += __double_encoded_array_size(NULL, 36);
-    return enc_size;
+    visitor(kFields[0], self.accel);
+    visitor(kFields[1], self.covariance);
 }
 
 uint64_t AccelWithCovariance::_computeHash(const __lcm_hash_ptr *p)
@@ -1,7 +1,7 @@
 /** THIS IS AN AUTOMATICALLY GENERATED FILE.  DO NOT MODIFY
  * BY HAND!!
  *
- * Generated by lcm-gen 1.5.2
+ * Generated by lcm-cpp (tools/cpp/gen)
  **/
 
 #ifndef __geometry_msgs_Inertia_hpp__
@@ -9,6 +9,11 @@
 
 #include <lcm/lcm_coretypes.h>
 
+#include <array>
+#include "dimos_lcm/fixed_codec.hpp"
+#include "dimos_lcm/writer.hpp"
+#include "dimos_lcm/fingerprint.hpp"
+#include "dimos_lcm/reflection.hpp"
 #include "geometry_msgs/Vector3.hpp"
 
 namespace geometry_msgs
@@ -45,11 +50,26 @@ class Inertia
          */
         inline int encode(void *buf, int offset, int maxlen) const;
 
+        /**
+         * Encode a message by appending it to @p buf, walking the message once
+         * instead of sizing it with getEncodedSize() first. @p buf grows
+         * geometrically; reuse it across calls to avoid reallocating.
+         *
+         * @return The number of bytes appended.
+         */
+        inline int encodeTo(std::vector<uint8_t> &buf) const;
+
         /**
          * Check how many bytes are required to encode this message.
          */
         inline int getEncodedSize() const;
 
+        /**
+         * getEncodedSize() of every instance: the type has no strings or
+         * variable-length arrays.
+         */
+        static constexpr int kEncodedSize = 88;
+
         /**
          * Decode a message from binary form into this instance.
          *
@@ -68,18 +88,57 @@ class Inertia
          */
         inline static int64_t getHash();
 
+        /**
+         * The fingerprint returned by getHash(), as a compile-time constant.
+         */
+        static constexpr int64_t kHash = static_cast<int64_t>(0xda50f3c956baa7fcULL);
+
         /**
          * Returns "Inertia"
          */
         inline static const char* getTypeName();
 
+        /**
+         * Name, LCM type and array dimensions of each field, in wire order.
+         * See dimos_lcm::for_each_field() for visiting the fields themselves.
+         */
+        static constexpr std::array<dimos_lcm::field_info, 8> kFields = {{
+            { "m", "double", true, 0, 0, NULL },
+            { "com", "geometry_msgs.Vector3", false, 0, 0, NULL },
+            { "ixx", "double", true, 0, 0, NULL },
+            { "ixy", "double", true, 0, 0, NULL },
+            { "ixz", "double", true, 0, 0, NULL },
+            { "iyy", "double", true, 0, 0, NULL },
+            { "iyz", "double", true, 0, 0, NULL },
+            { "izz", "double", true, 0, 0, NULL },
+        }};
+
         // LCM support functions. Users should not call these
         inline int _encodeNoHash(void *buf, int offset, int maxlen) const;
+        template <typename Writer>
+        inline void _writeNoHash(Writer &out) const;
         inline int _getEncodedSizeNoHash() const;
         inline int _decodeNoHash(const void *buf, int offset, int maxlen);
+        template <typename Self, typename Visitor>
+        inline static void _forEachField(Self &self, Visitor &visitor);
+        inline static int _skipNoHash(const void *buf, int offset, int maxlen);
         inline static uint64_t _computeHash(const __lcm_hash_ptr *p);
 };
 
+static_assert(Inertia::kHash == dimos_lcm::fingerprint(
+    dimos_lcm::signature_hash()
+        .member("m", "double", 0)
+        .member("com", NULL, 0)
+        .member("ixx", "double", 0)
+        .member("ixy", "double", 0)
+        .member("ixz", "double", 0)
+        .member("iyy", "double", 0)
+        .member("iyz", "double", 0)
+        .member("izz", "double", 0)
+        .value(),
+    geometry_msgs::Vector3::kHash),
+    "geometry_msgs::Inertia fingerprint does not match its definition");
+
 int Inertia::encode(void *buf, int offset, int maxlen) const
 {
     int pos = 0, tlen;
@@ -94,6 +153,15 @@ int Inertia::encode(void *buf, int offset, int maxlen) const
     return pos;
 }
 
+int Inertia::encodeTo(std::vector<uint8_t> &buf) const
+{
+    dimos_lcm::vector_writer out(buf);
+    int64_t hash = getHash();
+    out.put(&hash, 1);
+    this->_writeNoHash(out);
+    return static_cast<int>(out.size());
+}
+
 int Inertia::decode(const void *buf, int offset, int maxlen)
 {
     int pos = 0, thislen;
@@ -116,8 +184,7 @@ int Inertia::getEncodedSize() const
 
 int64_t Inertia::getHash()
 {
-    static int64_t hash = static_cast<int64_t>(_computeHash(NULL));
-    return hash;
+    return kHash;
 }
 
 const char* Inertia::getTypeName()
@@ -127,78 +194,65 @@ const char* Inertia::getTypeName()
 
 int Inertia::_encodeNoHash(void *buf, int offset, int maxlen) const
 {
-    int pos = 0, tlen;
-
-    tlen = __double_encode_array(buf, offset + pos, maxlen - pos, &this->m, 1);
-    if(tlen < 0) return tlen; else pos += tlen;
-
-    tlen = this->com._encodeNoHash(buf, offset + pos, maxlen - pos);
-    if(tlen < 0) return tlen; else pos += tlen;
-
-    tlen = __double_encode_array(buf, offset + pos, maxlen - pos, &this->ixx, 1);
-    if(tlen < 0) return tlen; else pos += tlen;
-
-    tlen = __double_encode_array(buf, offset + pos, maxlen - pos, &this->ixy, 1);
-    if(tlen < 0) return tlen; else pos += tlen;
-
-    tlen = __double_encode_array(buf, offset + pos, maxlen - pos, &this->ixz, 1);
-    if(tlen < 0) return tlen; else pos += tlen;
-
-    tlen = __double_encode_array(buf, offset + pos, maxlen - pos, &this->iyy, 1);
-    if(tlen < 0) return tlen; else pos += tlen;
-
-    tlen = __double_encode_array(buf, offset + pos, maxlen - pos, &this->iyz, 1);
-    if(tlen < 0) return tlen; else pos += tlen;
-
-    tlen = __double_encode_array(buf, offset + pos, maxlen - pos, &this->izz, 1);
-    if(tlen < 0) return tlen; else pos += tlen;
+    if(maxlen < kEncodedSize - 8) return -1;
+    uint8_t *p = static_cast<uint8_t*>(buf) + offset;
+    dimos_lcm::store_be(p + 0, this->m);
+    dimos_lcm::store_be(p + 8, this->com.x);
+    dimos_lcm::store_be(p + 16, this->com.y);
+    dimos_lcm::store_be(p + 24, this->com.z);
+    dimos_lcm::store_be(p + 32, this->ixx);
+    dimos_lcm::store_be(p + 40, this->ixy);
+    dimos_lcm::store_be(p + 48, this->ixz);
+    dimos_lcm::store_be(p + 56, this->iyy);
+    dimos_lcm::store_be(p + 64, this->iyz);
+    dimos_lcm::store_be(p + 72, this->izz);
+    return kEncodedSize - 8;
+}
 
-    return pos;
+template <typename Writer>
+void Inertia::_writeNoHash(Writer &out) const
+{
+    out.putStruct(*this);
 }
 
 int Inertia::_decodeNoHash(const void *buf, int offset, int maxlen)
 {
-    int pos = 0, tlen;
-
-    tlen = __double_decode_array(buf, offset + pos, maxlen - pos, &this->m, 1);
-    if(tlen < 0) return tlen; else pos += tlen;
-
-    tlen = this->com._decodeNoHash(buf, offset + pos, maxlen - pos);
-    if(tlen < 0) return tlen; else pos += tlen;
-
-    tlen = __double_decode_array(buf, offset + pos, maxlen - pos, &this->ixx, 1);
-    if(tlen < 0) return tlen; else pos += tlen;
-
-    tlen = __double_decode_array(buf, offset + pos, maxlen - pos, &this->ixy, 1);
-    if(tlen < 0) return tlen; else pos += tlen;
-
-    tlen = __double_decode_array(buf, offset + pos, maxlen - pos, &this->ixz, 1);
-    if(tlen < 0) return tlen; else pos += tlen;
-
-    tlen = __double_decode_array(buf, offset + pos, maxlen - pos, &this->iyy, 1);
-    if(tlen < 0) return tlen; else pos += tlen;
-
-    tlen = __double_decode_array(buf, offset + pos, maxlen - pos, &this->iyz, 1);
-    if(tlen < 0) return tlen; else pos += tlen;
+    if(maxlen < kEncodedSize - 8) return -1;
+    const uint8_t *p = static_cast<const uint8_t*>(buf) + offset;
+    dimos_lcm::load_be(p + 0, this->m);
+    dimos_lcm::load_be(p + 8, this->com.x);
+    dimos_lcm::load_be(p + 16, this->com.y);
+    dimos_lcm::load_be(p + 24, this->com.z);
+    dimos_lcm::load_be(p + 32, this->ixx);
+    dimos_lcm::load_be(p + 40, this->ixy);
+    dimos_lcm::load_be(p + 48, this->ixz);
+    dimos_lcm::load_be(p + 56, this->iyy);
+    dimos_lcm::load_be(p + 64, this->iyz);
+    dimos_lcm::load_be(p + 72, this->izz);
+    return kEncodedSize - 8;
+}
 
-    tlen = __double_decode_array(buf, offset + pos, maxlen - pos, &this->izz, 1);
-    if(tlen < 0) return tlen; else pos += tlen;
+int Inertia::_getEncodedSizeNoHash() const
+{
+    return kEncodedSize - 8;
+}
 
-    return pos;
+int Inertia::_skipNoHash(const void *, int, int maxlen)
+{
+    return maxlen < kEncodedSize - 8 ? -1 : kEncodedSize - 8;
 }
 
-int Inertia::_getEncodedSizeNoHash() const
+template <typename Self, typename Visitor>
+void Inertia::_forEachField(Self &self, Visitor &visitor)
 {
-    int enc_size = 0;
-    enc_size += __double_encoded_array_size(NULL, 1);
-    enc_size += this->com._getEncodedSizeNoHash();
-    enc_size += __double_encoded_array_size(NULL, 1);
-    enc_size += __double_encoded_array_size(NULL, 1);
-    enc_size += __double_encoded_array_size(NULL, 1);
-    enc_size += __double_encoded_array_size(NULL, 1);
-    enc_size += __double_encoded_array_size(NULL, 1);
-    enc_size += __double_encoded_array_size(NULL, 1);
-    return enc_size;
+    visitor(kFields[0], self.m);
+    visitor(kFields[1], self.com);
+    visitor(kFields[2], self.ixx);
+    visitor(kFields[3], self.ixy);
+    visitor(kFields[4], self.ixz);
+    visitor(kFields[5], self.iyy);
+    visitor(kFields[6], self.iyz);
+    visitor(kFields[7], self.izz);
 }
 
 uint64_t Inertia::_computeHash(const __lcm_hash_ptr *p)
@@ -1,7 +1,7 @@
 /** THIS IS AN AUTOMATICALLY GENERATED FILE.  DO NOT MODIFY
  * BY HAND!!
  *
- * Generated by lcm-gen 1.5.2
+ * Generated by lcm-cpp (tools/cpp/gen)
  **/
 
 #ifndef __geometry_msgs_Point32_hpp__
@@ -9,6 +9,11 @@
 
 #include <lcm/lcm_coretypes.h>
 
+#include <array>
+#include "dimos_lcm/fixed_codec.hpp"
+#include "dimos_lcm/writer.hpp"
+#include "dimos_lcm/fingerprint.hpp"
+#include "dimos_lcm/reflection.hpp"
 
 namespace geometry_msgs
 {
@@ -34,11 +39,26 @@ class Point32
          */
         inline int encode(void *buf, int offset, int maxlen) const;
 
+        /**
+         * Encode a message by appending it to @p buf, walking the message once
+         * instead of sizing it with getEncodedSize() first. @p buf grows
+         * geometrically; reuse it across calls to avoid reallocating.
+         *
+         * @return The number of bytes appended.
+         */
+        inline int encodeTo(std::vector<uint8_t> &buf) const;
+
         /**
          * Check how many bytes are required to encode this message.
          */
         inline int getEncodedSize() const;
 
+        /**
+         * getEncodedSize() of every instance: the type has no strings or
+         * variable-length arrays.
+         */
+        static constexpr int kEncodedSize = 20;
+
         /**
          * Decode a message from binary form into this instance.
          *
@@ -57,18 +77,46 @@ class Point32
          */
         inline static int64_t getHash();
 
+        /**
+         * The fingerprint returned by getHash(), as a compile-time constant.
+         */
+        static constexpr int64_t kHash = static_cast<int64_t>(0x5429e22584a75818ULL);
+
         /**
          * Returns "Point32"
          */
         inline static const char* getTypeName();
 
+        /**
+         * Name, LCM type and array dimensions of each field, in wire order.
+         * See dimos_lcm::for_each_field() for visiting the fields themselves.
+         */
+        static constexpr std::array<dimos_lcm::field_info, 3> kFields = {{
+            { "x", "float", true, 0, 0, NULL },
+            { "y", "float", true, 0, 0, NULL },
+            { "z", "float", true, 0, 0, NULL },
+        }};
+
         // LCM support functions. Users should not call these
         inline int _encodeNoHash(void *buf, int offset, int maxlen) const;
+        template <typename Writer>
+        inline void _writeNoHash(Writer &out) const;
         inline int _getEncodedSizeNoHash() const;
         inline int _decodeNoHash(const void *buf, int offset, int maxlen);
+        template <typename Self, typename Visitor>
+        inline static void _forEachField(Self &self, Visitor &visitor);
+        inline static int _skipNoHash(const void *buf, int offset, int maxlen);
         inline static uint64_t _computeHash(const __lcm_hash_ptr *p);
 };
 
+static_assert(Point32::kHash == dimos_lcm::fingerprint(
+    dimos_lcm::signature_hash()
+        .member("x", "float", 0)
+        .member("y", "float", 0)
+        .member("z", "float", 0)
+        .value()),
+    "geometry_msgs::Point32 fingerprint does not match its definition");
+
 int Point32::encode(void *buf, int offset, int maxlen) const
 {
     int pos = 0, tlen;
@@ -83,6 +131,15 @@ int Point32::encode(void *buf, int offset, int maxlen) const
     return pos;
 }
 
+int Point32::encodeTo(std::vector<uint8_t> &buf) const
+{
+    dimos_lcm::vector_writer out(buf);
+    int64_t hash = getHash();
+    out.put(&hash, 1);
+    this->_writeNoHash(out);
+    return static_cast<int>(out.size());
+}
+
 int Point32::decode(const void *buf, int offset, int maxlen)
 {
     int pos = 0, thislen;
@@ -105,8 +162,7 @@ int Point32::getEncodedSize() const
 
 int64_t Point32::getHash()
 {
-    static int64_t hash = static_cast<int64_t>(_computeHash(NULL));
-    return hash;
+    return kHash;
 }
 
 const char* Point32::getTypeName()
@@ -116,43 +172,46 @@ const char* Point32::getTypeName()
 
 int Point32::_encodeNoHash(void *buf, int offset, int maxlen) const
 {
-    int pos = 0, tlen;
-
-    tlen = __float_encode_array(buf, offset + pos, maxlen - pos, &this->x, 1);
-    if(tlen < 0) return tlen; else pos += tlen;
-
-    tlen = __float_encode_array(buf, offset + pos, maxlen - pos, &this->y, 1);
-    if(tlen < 0) return tlen; else pos += tlen;
-
-    tlen = __float_encode_array(buf, offset + pos, maxlen - pos, &this->z, 1);
-    if(tlen < 0) return tlen; else pos += tlen;
+    if(maxlen < kEncodedSize - 8) return -1;
+    uint8_t *p = static_cast<uint8_t*>(buf) + offset;
+    dimos_lcm::store_be(p + 0, this->x);
+    dimos_lcm::store_be(p + 4, this->y);
+    dimos_lcm::store_be(p + 8, this->z);
+    return kEncodedSize - 8;
+}
 
-    return pos;
+template <typename Writer>
+void Point32::_writeNoHash(Writer &out) const
+{
+    out.putStruct(*this);
 }
 
 int Point32::_decodeNoHash(const void *buf, int offset, int maxlen)
 {
-    int pos = 0, tlen;
-
-    tlen = __float_decode_array(buf, offset + pos, maxlen - pos, &this->x, 1);
-    if(tlen < 0) return tlen; else pos += tlen;
-
-    tlen = __float_decode_array(buf, offset + pos, maxlen - pos, &this->y, 1);
-    if(tlen < 0) return tlen; else pos += tlen;
+    if(maxlen < kEncodedSize - 8) return -1;
+    const uint8_t *p = static_cast<const uint8_t*>(buf) + offset;
+    dimos_lcm::load_be(p + 0, this->x);
+    dimos_lcm::load_be(p + 4, this->y);
+    dimos_lcm::load_be(p + 8, this->z);
+    return kEncodedSize - 8;
+}
 
-    tlen = __float_decode_array(buf, offset + pos, maxlen - pos, &this->z, 1);
-    if(tlen < 0) return tlen; else pos += tlen;
+int Point32::_getEncodedSizeNoHash() const
+{
+    return kEncodedSize - 8;
+}
 
-    return pos;
+int Point32::_skipNoHash(const void *, int, int maxlen)
+{
+    return maxlen < kEncodedSize - 8 ? -1 : kEncodedSize - 8;
 }
 
-int Point32::_getEncodedSizeNoHash() const
+template <typename Self, typename Visitor>
+void Point32::_forEachField(Self &self, Visitor &visitor)
 {
-    int enc_size = 0;
-    enc_size += __float_encoded_array_size(NULL, 1);
-    enc_size += __float_encoded_array_size(NULL, 1);
-    enc_size += __float_encoded_array_size(NULL, 1);
-    return enc_size;
+    visitor(kFields[0], self.x);
+    visitor(kFields[1], self.y);
+    visitor(kFields[2], self.z);
 }
 
 uint64_t Point32::_computeHash(const __lcm_hash_ptr *)
@@ -0,0 +1,140 @@
+/** THIS IS AN AUTOMATICALLY GENERATED FILE.  DO NOT MODIFY
+ * BY HAND!!
+ *
+ * Generated by lcm-cpp (tools/cpp/gen)
+ **/
+
+#ifndef __geometry_msgs_Point32Columns_hpp__
+#define __geometry_msgs_Point32Columns_hpp__
+
+#include <lcm/lcm_coretypes.h>
+
+#include <vector>
+#include "dimos_lcm/fixed_codec.hpp"
+#include "geometry_msgs/Point32.hpp"
+
+namespace geometry_msgs
+{
+
+/**
+ * Structure-of-arrays storage for a sequence of geometry_msgs.Point32: one
+ * contiguous array per field, with nested fields flattened and named by their
+ * path (x, y, ...). The soa:: message classes hold their
+ * Point32 arrays this way and decode them straight into the columns.
+ */
+class Point32Columns
+{
+    public:
+        std::vector< float > x;
+
+        std::vector< float > y;
+
+        std::vector< float > z;
+
+    public:
+        /**
+         * Number of elements.
+         */
+        inline int size() const;
+
+        /**
+         * Resize every column to @p n elements.
+         */
+        inline void resize(int n);
+
+        /**
+         * Gather element @p i into a Point32.
+         */
+        inline geometry_msgs::Point32 get(int i) const;
+
+        /**
+         * Scatter @p msg into element @p i.
+         */
+        inline void set(int i, const geometry_msgs::Point32 &msg);
+
+        // LCM support functions. Users should not call these
+        inline int _encodeNoHash(void *buf, int offset, int maxlen, int n) const;
+        template <typename Writer>
+        inline void _writeNoHash(Writer &out, int n) const;
+        inline int _getEncodedSizeNoHash(int n) const;
+        inline int _decodeNoHash(const void *buf, int offset, int maxlen, int n);
+};
+
+int Point32Columns::size() const
+{
+    return static_cast<int>(this->x.size());
+}
+
+void Point32Columns::resize(int n)
+{
+    this->x.resize(n);
+    this->y.resize(n);
+    this->z.resize(n);
+}
+
+geometry_msgs::Point32 Point32Columns::get(int i) const
+{
+    geometry_msgs::Point32 msg;
+    msg.x = this->x[i];
+    msg.y = this->y[i];
+    msg.z = this->z[i];
+    return msg;
+}
+
+void Point32Columns::set(int i, const geometry_msgs::Point32 &msg)
+{
+    this->x[i] = msg.x;
+    this->y[i] = msg.y;
+    this->z[i] = msg.z;
+}
+
+int Point32Columns::_encodeNoHash(void *buf, int offset, int maxlen, int n) const
+{
+    uint8_t *p = static_cast<uint8_t*>(buf) + offset;
+    int pos = 0;
+    for (int i = 0; i < n; i++) {
+        if(maxlen - pos < 12) return -1;
+        dimos_lcm::store_be(p + pos + 0, this->x[i]);
+        dimos_lcm::store_be(p + pos + 4, this->y[i]);
+        dimos_lcm::store_be(p + pos + 8, this->z[i]);
+        pos += 12;
+    }
+    return pos;
+}
+
+template <typename Writer>
+void Point32Columns::_writeNoHash(Writer &out, int n) const
+{
+    if(n <= 0) return;
+    uint8_t *p = out.extend(static_cast<size_t>(n) * 12);
+    for (int i = 0; i < n; i++, p += 12) {
+        dimos_lcm::store_be(p + 0, this->x[i]);
+        dimos_lcm::store_be(p + 4, this->y[i]);
+        dimos_lcm::store_be(p + 8, this->z[i]);
+    }
+}
+
+int Point32Columns::_getEncodedSizeNoHash(int n) const
+{
+    return n * 12;
+}
+
+int Point32Columns::_decodeNoHash(const void *buf, int offset, int maxlen, int n)
+{
+    if(n < 0 || n > maxlen / 12) return -1;
+    this->resize(n);
+    const uint8_t *p = static_cast<const uint8_t*>(buf) + offset;
+    float *x = this->x.data();
+    float *y = this->y.data();
+    float *z = this->z.data();
+    for (int i = 0; i < n; i++, p += 12) {
+        dimos_lcm::load_be(p + 0, x[i]);
+        dimos_lcm::load_be(p + 4, y[i]);
+        dimos_lcm::load_be(p + 8, z[i]);
+    }
+    return n * 12;
+}
+
+}
+
+#endif
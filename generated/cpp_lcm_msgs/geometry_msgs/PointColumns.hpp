@@ -0,0 +1,140 @@
+/** THIS IS AN AUTOMATICALLY GENERATED FILE.  DO NOT MODIFY
+ * BY HAND!!
+ *
+ * Generated by lcm-cpp (tools/cpp/gen)
+ **/
+
+#ifndef __geometry_msgs_PointColumns_hpp__
+#define __geometry_msgs_PointColumns_hpp__
+
+#include <lcm/lcm_coretypes.h>
+
+#include <vector>
+#include "dimos_lcm/fixed_codec.hpp"
+#include "geometry_msgs/Point.hpp"
+
+namespace geometry_msgs
+{
+
+/**
+ * Structure-of-arrays storage for a sequence of geometry_msgs.Point: one
+ * contiguous array per field, with nested fields flattened and named by their
+ * path (x, y, ...). The soa:: message classes hold their
+ * Point arrays this way and decode them straight into the columns.
+ */
+class PointColumns
+{
+    public:
+        std::vector< double > x;
+
+        std::vector< double > y;
+
+        std::vector< double > z;
+
+    public:
+        /**
+         * Number of elements.
+         */
+        inline int size() const;
+
+        /**
+         * Resize every column to @p n elements.
+         */
+        inline void resize(int n);
+
+        /**
+         * Gather element @p i into a Point.
+         */
+        inline geometry_msgs::Point get(int i) const;
+
+        /**
+         * Scatter @p msg into element @p i.
+         */
+        inline void set(int i, const geometry_msgs::Point &msg);
+
+        // LCM support functions. Users should not call these
+        inline int _encodeNoHash(void *buf, int offset, int maxlen, int n) const;
+        template <typename Writer>
+        inline void _writeNoHash(Writer &out, int n) const;
+        inline int _getEncodedSizeNoHash(int n) const;
+        inline int _decodeNoHash(const void *buf, int offset, int maxlen, int n);
+};
+
+int PointColumns::size() const
+{
+    return static_cast<int>(this->x.size());
+}
+
+void PointColumns::resize(int n)
+{
+    this->x.resize(n);
+    this->y.resize(n);
+    this->z.resize(n);
+}
+
+geometry_msgs::Point PointColumns::get(int i) const
+{
+    geometry_msgs::Point msg;
+    msg.x = this->x[i];
+    msg.y = this->y[i];
+    msg.z = this->z[i];
+    return msg;
+}
+
+void PointColumns::set(int i, const geometry_msgs::Point &msg)
+{
+    this->x[i] = msg.x;
+    this->y[i] = msg.y;
+    this->z[i] = msg.z;
+}
+
+int PointColumns::_encodeNoHash(void *buf, int offset, int maxlen, int n) const
+{
+    uint8_t *p = static_cast<uint8_t*>(buf) + offset;
+    int pos = 0;
+    for (int i = 0; i < n; i++) {
+        if(maxlen - pos < 24) return -1;
+        dimos_lcm::store_be(p + pos + 0, this->x[i]);
+        dimos_lcm::store_be(p + pos + 8, this->y[i]);
+        dimos_lcm::store_be(p + pos + 16, this->z[i]);
+        pos += 24;
+    }
+    return pos;
+}
+
+template <typename Writer>
+void PointColumns::_writeNoHash(Writer &out, int n) const
+{
+    if(n <= 0) return;
+    uint8_t *p = out.extend(static_cast<size_t>(n) * 24);
+    for (int i = 0; i < n; i++, p += 24) {
+        dimos_lcm::store_be(p + 0, this->x[i]);
+        dimos_lcm::store_be(p + 8, this->y[i]);
+        dimos_lcm::store_be(p + 16, this->z[i]);
+    }
+}
+
+int PointColumns::_getEncodedSizeNoHash(int n) const
+{
+    return n * 24;
+}
+
+int PointColumns::_decodeNoHash(const void *buf, int offset, int maxlen, int n)
+{
+    if(n < 0 || n > maxlen / 24) return -1;
+    this->resize(n);
+    const uint8_t *p = static_cast<const uint8_t*>(buf) + offset;
+    double *x = this->x.data();
+    double *y = this->y.data();
+    double *z = this->z.data();
+    for (int i = 0; i < n; i++, p += 24) {
+        dimos_lcm::load_be(p + 0, x[i]);
+        dimos_lcm::load_be(p + 8, y[i]);
+        dimos_lcm::load_be(p + 16, z[i]);
+    }
+    return n * 24;
+}
+
+}
+
+#endif
@@ -1,7 +1,7 @@
 /** THIS IS AN AUTOMATICALLY GENERATED FILE.  DO NOT MODIFY
  * BY HAND!!
  *
- * Generated by lcm-gen 1.5.2
+ * Generated by lcm-cpp (tools/cpp/gen)
  **/
 
 #ifndef __geometry_msgs_Pose_hpp__
@@ -9,6 +9,11 @@
 
 #include <lcm/lcm_coretypes.h>
 
+#include <array>
+#include "dimos_lcm/fixed_codec.hpp"
+#include "dimos_lcm/writer.hpp"
+#include "dimos_lcm/fingerprint.hpp"
+#include "dimos_lcm/reflection.hpp"
 #include "geometry_msgs/Point.hpp"
 #include "geometry_msgs/Quaternion.hpp"
 
@@ -34,11 +39,26 @@ class Pose
          */
         inline int encode(void *buf, int offset, int maxlen) const;
 
+        /**
+         * Encode a message by appending it to @p buf, walking the message once
+         * instead of sizing it with getEncodedSize() first. @p buf grows
+         * geometrically; reuse it across calls to avoid reallocating.
+         *
+         * @return The number of bytes appended.
+         */
+        inline int encodeTo(std::vector<uint8_t> &buf) const;
+
         /**
          * Check how many bytes are required to encode this message.
          */
         inline int getEncodedSize() const;
 
+        /**
+         * getEncodedSize() of every instance: the type has no strings or
+         * variable-length arrays.
+         */
+        static constexpr int kEncodedSize = 64;
+
         /**
          * Decode a message from binary form into this instance.
          *
@@ -57,18 +77,46 @@ class Pose
          */
         inline static int64_t getHash();
 
+        /**
+         * The fingerprint returned by getHash(), as a compile-time constant.
+         */
+        static constexpr int64_t kHash = static_cast<int64_t>(0x245634ae2ab17b76ULL);
+
         /**
          * Returns "Pose"
          */
         inline static const char* getTypeName();
 
+        /**
+         * Name, LCM type and array dimensions of each field, in wire order.
+         * See dimos_lcm::for_each_field() for visiting the fields themselves.
+         */
+        static constexpr std::array<dimos_lcm::field_info, 2> kFields = {{
+            { "position", "geometry_msgs.Point", false, 0, 0, NULL },
+            { "orientation", "geometry_msgs.Quaternion", false, 0, 0, NULL },
+        }};
+
         // LCM support functions. Users should not call these
         inline int _encodeNoHash(void *buf, int offset, int maxlen) const;
+        template <typename Writer>
+        inline void _writeNoHash(Writer &out) const;
         inline int _getEncodedSizeNoHash() const;
         inline int _decodeNoHash(const void *buf, int offset, int maxlen);
+        template <typename Self, typename Visitor>
+        inline static void _forEachField(Self &self, Visitor &visitor);
+        inline static int _skipNoHash(const void *buf, int offset, int maxlen);
         inline static uint64_t _computeHash(const __lcm_hash_ptr *p);
 };
 
+static_assert(Pose::kHash == dimos_lcm::fingerprint(
+    dimos_lcm::signature_hash()
+        .member("position", NULL, 0)
+        .member("orientation", NULL, 0)
+        .value(),
+    geometry_msgs::Point::kHash,
+    geometry_msgs::Quaternion::kHash),
+    "geometry_msgs::Pose fingerprint does not match its definition");
+
 int Pose::encode(void *buf, int offset, int maxlen) const
 {
     int pos = 0, tlen;
@@ -83,6 +131,15 @@ int Pose::encode(void *buf, int offset, int maxlen) const
     return pos;
 }
 
+int Pose::encodeTo(std::vector<uint8_t> &buf) const
+{
+    dimos_lcm::vector_writer out(buf);
+    int64_t hash = getHash();
+    out.put(&hash, 1);
+    this->_writeNoHash(out);
+    return static_cast<int>(out.size());
+}
+
 int Pose::decode(const void *buf, int offset, int maxlen)
 {
     int pos = 0, thislen;
@@ -105,8 +162,7 @@ int Pose::getEncodedSize() const
 
 int64_t Pose::getHash()
 {
-    static int64_t hash = static_cast<int64_t>(_computeHash(NULL));
-    return hash;
+    return kHash;
 }
 
 const char* Pose::getTypeName()
@@ -116,36 +172,53 @@ const char* Pose::getTypeName()
 
 int Pose::_encodeNoHash(void *buf, int offset, int maxlen) const
 {
-    int pos = 0, tlen;
-
-    tlen = this->position._encodeNoHash(buf, offset + pos, maxlen - pos);
-    if(tlen < 0) return tlen; else pos += tlen;
-
-    tlen = this->orientation._encodeNoHash(buf, offset + pos, maxlen - pos);
-    if(tlen < 0) return tlen; else pos += tlen;
+    if(maxlen < kEncodedSize - 8) return -1;
+    uint8_t *p = static_cast<uint8_t*>(buf) + offset;
+    dimos_lcm::store_be(p + 0, this->position.x);
+    dimos_lcm::store_be(p + 8, this->position.y);
+    dimos_lcm::store_be(p + 16, this->position.z);
+    dimos_lcm::store_be(p + 24, this->orientation.x);
+    dimos_lcm::store_be(p + 32, this->orientation.y);
+    dimos_lcm::store_be(p + 40, this->orientation.z);
+    dimos_lcm::store_be(p + 48, this->orientation.w);
+    return kEncodedSize - 8;
+}
 
-    return pos;
+template <typename Writer>
+void Pose::_writeNoHash(Writer &out) const
+{
+    out.putStruct(*this);
 }
 
 int Pose::_decodeNoHash(const void *buf, int offset, int maxlen)
 {
-    int pos = 0, tlen;
-
-    tlen = this->position._decodeNoHash(buf, offset + pos, maxlen - pos);
-    if(tlen < 0) return tlen; else pos += tlen;
+    if(maxlen < kEncodedSize - 8) return -1;
+    const uint8_t *p = static_cast<const uint8_t*>(buf) + offset;
+    dimos_lcm::load_be(p + 0, this->position.x);
+    dimos_lcm::load_be(p + 8, this->position.y);
+    dimos_lcm::load_be(p + 16, this->position.z);
+    dimos_lcm::load_be(p + 24, this->orientation.x);
+    dimos_lcm::load_be(p + 32, this->orientation.y);
+    dimos_lcm::load_be(p + 40, this->orientation.z);
+    dimos_lcm::load_be(p + 48, this->orientation.w);
+    return kEncodedSize - 8;
+}
 
-    tlen = this->orientation._decodeNoHash(buf, offset + pos, maxlen - pos);
-    if(tlen < 0) return tlen; else pos += tlen;
+int Pose::_getEncodedSizeNoHash() const
+{
+    return kEncodedSize - 8;
+}
 
-    return pos;
+int Pose::_skipNoHash(const void *, int, int maxlen)
+{
+    return maxlen < kEncodedSize - 8 ? -1 : kEncodedSize - 8;
 }
 
-int Pose::_getEncodedSizeNoHash() const
+template <typename Self, typename Visitor>
+void Pose::_forEachField(Self &self, Visitor &visitor)
 {
-    int enc_size = 0;
-    enc_size += this->position._getEncodedSizeNoHash();
-    enc_size += this->orientation._getEncodedSizeNoHash();
-    return enc_size;
+    visitor(kFields[0], self.position);
+    visitor(kFields[1], self.orientation);
 }
 
 uint64_t Pose::_computeHash(const __lcm_hash_ptr *p)
@@ -0,0 +1,183 @@
+/** THIS IS AN AUTOMATICALLY GENERATED FILE.  DO NOT MODIFY
+ * BY HAND!!
+ *
+ * Generated by lcm-cpp (tools/cpp/gen)
+ **/
+
+#ifndef __geometry_msgs_PoseColumns_hpp__
+#define __geometry_msgs_PoseColumns_hpp__
+
+#include <lcm/lcm_coretypes.h>
+
+#include <vector>
+#include "dimos_lcm/fixed_codec.hpp"
+#include "geometry_msgs/Pose.hpp"
+
+namespace geometry_msgs
+{
+
+/**
+ * Structure-of-arrays storage for a sequence of geometry_msgs.Pose: one
+ * contiguous array per field, with nested fields flattened and named by their
+ * path (position_x, position_y, ...). The soa:: message classes hold their
+ * Pose arrays this way and decode them straight into the columns.
+ */
+class PoseColumns
+{
+    public:
+        // position.x
+        std::vector< double > position_x;
+
+        // position.y
+        std::vector< double > position_y;
+
+        // position.z
+        std::vector< double > position_z;
+
+        // orientation.x
+        std::vector< double > orientation_x;
+
+        // orientation.y
+        std::vector< double > orientation_y;
+
+        // orientation.z
+        std::vector< double > orientation_z;
+
+        // orientation.w
+        std::vector< double > orientation_w;
+
+    public:
+        /**
+         * Number of elements.
+         */
+        inline int size() const;
+
+        /**
+         * Resize every column to @p n elements.
+         */
+        inline void resize(int n);
+
+        /**
+         * Gather element @p i into a Pose.
+         */
+        inline geometry_msgs::Pose get(int i) const;
+
+        /**
+         * Scatter @p msg into element @p i.
+         */
+        inline void set(int i, const geometry_msgs::Pose &msg);
+
+        // LCM support functions. Users should not call these
+        inline int _encodeNoHash(void *buf, int offset, int maxlen, int n) const;
+        template <typename Writer>
+        inline void _writeNoHash(Writer &out, int n) const;
+        inline int _getEncodedSizeNoHash(int n) const;
+        inline int _decodeNoHash(const void *buf, int offset, int maxlen, int n);
+};
+
+int PoseColumns::size() const
+{
+    return static_cast<int>(this->position_x.size());
+}
+
+void PoseColumns::resize(int n)
+{
+    this->position_x.resize(n);
+    this->position_y.resize(n);
+    this->position_z.resize(n);
+    this->orientation_x.resize(n);
+    this->orientation_y.resize(n);
+    this->orientation_z.resize(n);
+    this->orientation_w.resize(n);
+}
+
+geometry_msgs::Pose PoseColumns::get(int i) const
+{
+    geometry_msgs::Pose msg;
+    msg.position.x = this->position_x[i];
+    msg.position.y = this->position_y[i];
+    msg.position.z = this->position_z[i];
+    msg.orientation.x = this->orientation_x[i];
+    msg.orientation.y = this->orientation_y[i];
+    msg.orientation.z = this->orientation_z[i];
+    msg.orientation.w = this->orientation_w[i];
+    return msg;
+}
+
+void PoseColumns::set(int i, const geometry_msgs::Pose &msg)
+{
+    this->position_x[i] = msg.position.x;
+    this->position_y[i] = msg.position.y;
+    this->position_z[i] = msg.position.z;
+    this->orientation_x[i] = msg.orientation.x;
+    this->orientation_y[i] = msg.orientation.y;
+    this->orientation_z[i] = msg.orientation.z;
+    this->orientation_w[i] = msg.orientation.w;
+}
+
+int PoseColumns::_encodeNoHash(void *buf, int offset, int maxlen, int n) const
+{
+    uint8_t *p = static_cast<uint8_t*>(buf) + offset;
+    int pos = 0;
+    for (int i = 0; i < n; i++) {
+        if(maxlen - pos < 56) return -1;
+        dimos_lcm::store_be(p + pos + 0, this->position_x[i]);
+        dimos_lcm::store_be(p + pos + 8, this->position_y[i]);
+        dimos_lcm::store_be(p + pos + 16, this->position_z[i]);
+        dimos_lcm::store_be(p + pos + 24, this->orientation_x[i]);
+        dimos_lcm::store_be(p + pos + 32, this->orientation_y[i]);
+        dimos_lcm::store_be(p + pos + 40, this->orientation_z[i]);
+        dimos_lcm::store_be(p + pos + 48, this->orientation_w[i]);
+        pos += 56;
+    }
+    return pos;
+}
+
+template <typename Writer>
+void PoseColumns::_writeNoHash(Writer &out, int n) const
+{
+    if(n <= 0) return;
+    uint8_t *p = out.extend(static_cast<size_t>(n) * 56);
+    for (int i = 0; i < n; i++, p += 56) {
+        dimos_lcm::store_be(p + 0, this->position_x[i]);
+        dimos_lcm::store_be(p + 8, this->position_y[i]);
+        dimos_lcm::store_be(p + 16, this->position_z[i]);
+        dimos_lcm::store_be(p + 24, this->orientation_x[i]);
+        dimos_lcm::store_be(p + 32, this->orientation_y[i]);
+        dimos_lcm::store_be(p + 40, this->orientation_z[i]);
+        dimos_lcm::store_be(p + 48, this->orientation_w[i]);
+    }
+}
+
+int PoseColumns::_getEncodedSizeNoHash(int n) const
+{
+    return n * 56;
+}
+
+int PoseColumns::_decodeNoHash(const void *buf, int offset, int maxlen, int n)
+{
+    if(n < 0 || n > maxlen / 56) return -1;
+    this->resize(n);
+    const uint8_t *p = static_cast<const uint8_t*>(buf) + offset;
+    double *position_x = this->position_x.data();
+    double *position_y = this->position_y.data();
+    double *position_z = this->position_z.data();
+    double *orientation_x = this->orientation_x.data();
+    double *orientation_y = this->orientation_y.data();
+    double *orientation_z = this->orientation_z.data();
+    double *orientation_w = this->orientation_w.data();
+    for (int i = 0; i < n; i++, p += 56) {
+        dimos_lcm::load_be(p + 0, position_x[i]);
+        dimos_lcm::load_be(p + 8, position_y[i]);
+        dimos_lcm::load_be(p + 16, position_z[i]);
+        dimos_lcm::load_be(p + 24, orientation_x[i]);
+        dimos_lcm::load_be(p + 32, orientation_y[i]);
+        dimos_lcm::load_be(p + 40, orientation_z[i]);
+        dimos_lcm::load_be(p + 48, orientation_w[i]);
+    }
+    return n * 56;
+}
+
+}
+
+#endif
@@ -1,7 +1,7 @@
 /** THIS IS AN AUTOMATICALLY GENERATED FILE.  DO NOT MODIFY
  * BY HAND!!
  *
- * Generated by lcm-gen 1.5.2
+ * Generated by lcm-cpp (tools/cpp/gen)
  **/
 
 #ifndef __geometry_msgs_Transform_hpp__
@@ -9,6 +9,11 @@
 
 #include <lcm/lcm_coretypes.h>
 
+#include <array>
+#include "dimos_lcm/fixed_codec.hpp"
+#include "dimos_lcm/writer.hpp"
+#include "dimos_lcm/fingerprint.hpp"
+#include "dimos_lcm/reflection.hpp"
 #include "geometry_msgs/Vector3.hpp"
 #include "geometry_msgs/Quaternion.hpp"
 
@@ -34,11 +39,26 @@ class Transform
          */
         inline int encode(void *buf, int offset, int maxlen) const;
 
+        /**
+         * Encode a message by appending it to @p buf, walking the message once
+         * instead of sizing it with getEncodedSize() first. @p buf grows
+         * geometrically; reuse it across calls to avoid reallocating.
+         *
+         * @return The number of bytes appended.
+         */
+        inline int encodeTo(std::vector<uint8_t> &buf) const;
+
         /**
          * Check how many bytes are required to encode this message.
          */
         inline int getEncodedSize() const;
 
+        /**
+         * getEncodedSize() of every instance: the type has no strings or
+         * variable-length arrays.
+         */
+        static constexpr int kEncodedSize = 64;
+
         /**
          * Decode a message from binary form into this instance.
          *
@@ -57,18 +77,46 @@ class Transform
          */
         inline static int64_t getHash();
 
+        /**
+         * The fingerprint returned by getHash(), as a compile-time constant.
+         */
+        static constexpr int64_t kHash = static_cast<int64_t>(0xee5ff42647bf3f91ULL);
+
         /**
          * Returns "Transform"
          */
         inline static const char* getTypeName();
 
+        /**
+         * Name, LCM type and array dimensions of each field, in wire order.
+         * See dimos_lcm::for_each_field() for visiting the fields themselves.
+         */
+        static constexpr std::array<dimos_lcm::field_info, 2> kFields = {{
+            { "translation", "geometry_msgs.Vector3", false, 0, 0, NULL },
+            { "rotation", "geometry_msgs.Quaternion", false, 0, 0, NULL },
+        }};
+
         // LCM support functions. Users should not call these
         inline int _encodeNoHash(void *buf, int offset, int maxlen) const;
+        template <typename Writer>
+        inline void _writeNoHash(Writer &out) const;
         inline int _getEncodedSizeNoHash() const;
         inline int _decodeNoHash(const void *buf, int offset, int maxlen);
+        template <typename Self, typename Visitor>
+        inline static void _forEachField(Self &self, Visitor &visitor);
+        inline static int _skipNoHash(const void *buf, int offset, int maxlen);
         inline static uint64_t _computeHash(const __lcm_hash_ptr *p);
 };
 
+static_assert(Transform::kHash == dimos_lcm::fingerprint(
+    dimos_lcm::signature_hash()
+        .member("translation", NULL, 0)
+        .member("rotation", NULL, 0)
+        .value(),
+    geometry_msgs::Vector3::kHash,
+    geometry_msgs::Quaternion::kHash),
+    "geometry_msgs::Transform fingerprint does not match its definition");
+
 int Transform::encode(void *buf, int offset, int maxlen) const
 {
     int pos = 0, tlen;
@@ -83,6 +131,15 @@ int Transform::encode(void *buf, int offset, int maxlen) const
     return pos;
 }
 
+int Transform::encodeTo(std::vector<uint8_t> &buf) const
+{
+    dimos_lcm::vector_writer out(buf);
+    int64_t hash = getHash();
+    out.put(&hash, 1);
+    this->_writeNoHash(out);
+    return static_cast<int>(out.size());
+}
+
 int Transform::decode(const void *buf, int offset, int maxlen)
 {
     int pos = 0, thislen;
@@ -105,8 +162,7 @@ int Transform::getEncodedSize() const
 
 int64_t Transform::getHash()
 {
-    static int64_t hash = static_cast<int64_t>(_computeHash(NULL));
-    return hash;
+    return kHash;
 }
 
 const char* Transform::getTypeName()
@@ -116,36 +172,53 @@ const char* Transform::getTypeName()
 
 int Transform::_encodeNoHash(void *buf, int offset, int maxlen) const
 {
-    int pos = 0, tlen;
-
-    tlen = this->translation._encodeNoHash(buf, offset + pos, maxlen - pos);
-    if(tlen < 0) return tlen; else pos += tlen;
-
-    tlen = this->rotation._encodeNoHash(buf, offset + pos, maxlen - pos);
-    if(tlen < 0) return tlen; else pos += tlen;
+    if(maxlen < kEncodedSize - 8) return -1;
+    uint8_t *p = static_cast<uint8_t*>(buf) + offset;
+    dimos_lcm::store_be(p + 0, this->translation.x);
+    dimos_lcm::store_be(p + 8, this->translation.y);
+    dimos_lcm::store_be(p + 16, this->translation.z);
+    dimos_lcm::store_be(p + 24, this->rotation.x);
+    dimos_lcm::store_be(p + 32, this->rotation.y);
+    dimos_lcm::store_be(p + 40, this->rotation.z);
+    dimos_lcm::store_be(p + 48, this->rotation.w);
+    return kEncodedSize - 8;
+}
 
-    return pos;
+template <typename Writer>
+void Transform::_writeNoHash(Writer &out) const
+{
+    out.putStruct(*this);
 }
 
 int Transform::_decodeNoHash(const void *buf, int offset, int maxlen)
 {
-    int pos = 0, tlen;
-
-    tlen = this->translation._decodeNoHash(buf, offset + pos, maxlen - pos);
-    if(tlen < 0) return tlen; else pos += tlen;
+    if(maxlen < kEncodedSize - 8) return -1;
+    const uint8_t *p = static_cast<const uint8_t*>(buf) + offset;
+    dimos_lcm::load_be(p + 0, this->translation.x);
+    dimos_lcm::load_be(p + 8, this->translation.y);
+    dimos_lcm::load_be(p + 16, this->translation.z);
+    dimos_lcm::load_be(p + 24, this->rotation.x);
+    dimos_lcm::load_be(p + 32, this->rotation.y);
+    dimos_lcm::load_be(p + 40, this->rotation.z);
+    dimos_lcm::load_be(p + 48, this->rotation.w);
+    return kEncodedSize - 8;
+}
 
-    tlen = this->rotation._decodeNoHash(buf, offset + pos, maxlen - pos);
-    if(tlen < 0) return tlen; else pos += tlen;
+int Transform::_getEncodedSizeNoHash() const
+{
+    return kEncodedSize - 8;
+}
 
-    return pos;
+int Transform::_skipNoHash(const void *, int, int maxlen)
+{
+    return maxlen < kEncodedSize - 8 ? -1 : kEncodedSize - 8;
 }
 
-int Transform::_getEncodedSizeNoHash() const
+template <typename Self, typename Visitor>
+void Transform::_forEachField(Self &self, Visitor &visitor)
 {
-    int enc_size = 0;
-    enc_size += this->translation._getEncodedSizeNoHash();
-    enc_size += this->rotation._getEncodedSizeNoHash();
-    return enc_size;
+    visitor(kFields[0], self.translation);
+    visitor(kFields[1], self.rotation);
 }
 
 uint64_t Transform::_computeHash(const __lcm_hash_ptr *p)
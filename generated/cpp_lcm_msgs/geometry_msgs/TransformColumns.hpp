@@ -0,0 +1,183 @@
+/** THIS IS AN AUTOMATICALLY GENERATED FILE.  DO NOT MODIFY
+ * BY HAND!!
+ *
+ * Generated by lcm-cpp (tools/cpp/gen)
+ **/
+
+#ifndef __geometry_msgs_TransformColumns_hpp__
+#define __geometry_msgs_TransformColumns_hpp__
+
+#include <lcm/lcm_coretypes.h>
+
+#include <vector>
+#include "dimos_lcm/fixed_codec.hpp"
+#include "geometry_msgs/Transform.hpp"
+
+namespace geometry_msgs
+{
+
+/**
+ * Structure-of-arrays storage for a sequence of geometry_msgs.Transform: one
+ * contiguous array per field, with nested fields flattened and named by their
+ * path (translation_x, translation_y, ...). The soa:: message classes hold their
+ * Transform arrays this way and decode them straight into the columns.
+ */
+class TransformColumns
+{
+    public:
+        // translation.x
+        std::vector< double > translation_x;
+
+        // translation.y
+        std::vector< double > translation_y;
+
+        // translation.z
+        std::vector< double > translation_z;
+
+        // rotation.x
+        std::vector< double > rotation_x;
+
+        // rotation.y
+        std::vector< double > rotation_y;
+
+        // rotation.z
+        std::vector< double > rotation_z;
+
+        // rotation.w
+        std::vector< double > rotation_w;
+
+    public:
+        /**
+         * Number of elements.
+         */
+        inline int size() const;
+
+        /**
+         * Resize every column to @p n elements.
+         */
+        inline void resize(int n);
+
+        /**
+         * Gather element @p i into a Transform.
+         */
+        inline geometry_msgs::Transform get(int i) const;
+
+        /**
+         * Scatter @p msg into element @p i.
+         */
+        inline void set(int i, const geometry_msgs::Transform &msg);
+
+        // LCM support functions. Users should not call these
+        inline int _encodeNoHash(void *buf, int offset, int maxlen, int n) const;
+        template <typename Writer>
+        inline void _writeNoHash(Writer &out, int n) const;
+        inline int _getEncodedSizeNoHash(int n) const;
+        inline int _decodeNoHash(const void *buf, int offset, int maxlen, int n);
+};
+
+int TransformColumns::size() const
+{
+    return static_cast<int>(this->translation_x.size());
+}
+
+void TransformColumns::resize(int n)
+{
+    this->translation_x.resize(n);
+    this->translation_y.resize(n);
+    this->translation_z.resize(n);
+    this->rotation_x.resize(n);
+    this->rotation_y.resize(n);
+    this->rotation_z.resize(n);
+    this->rotation_w.resize(n);
+}
+
+geometry_msgs::Transform TransformColumns::get(int i) const
+{
+    geometry_msgs::Transform msg;
+    msg.translation.x = this->translation_x[i];
+    msg.translation.y = this->translation_y[i];
+    msg.translation.z = this->translation_z[i];
+    msg.rotation.x = this->rotation_x[i];
+    msg.rotation.y = this->rotation_y[i];
+    msg.rotation.z = this->rotation_z[i];
+    msg.rotation.w = this->rotation_w[i];
+    return msg;
+}
+
+void TransformColumns::set(int i, const geometry_msgs::Transform &msg)
+{
+    this->translation_x[i] = msg.translation.x;
+    this->translation_y[i] = msg.translation.y;
+    this->translation_z[i] = msg.translation.z;
+    this->rotation_x[i] = msg.rotation.x;
+    this->rotation_y[i] = msg.rotation.y;
+    this->rotation_z[i] = msg.rotation.z;
+    this->rotation_w[i] = msg.rotation.w;
+}
+
+int TransformColumns::_encodeNoHash(void *buf, int offset, int maxlen, int n) const
+{
+    uint8_t *p = static_cast<uint8_t*>(buf) + offset;
+    int pos = 0;
+    for (int i = 0; i < n; i++) {
+        if(maxlen - pos < 56) return -1;
+        dimos_lcm::store_be(p + pos + 0, this->translation_x[i]);
+        dimos_lcm::store_be(p + pos + 8, this->translation_y[i]);
+        dimos_lcm::store_be(p + pos + 16, this->translation_z[i]);
+        dimos_lcm::store_be(p + pos + 24, this->rotation_x[i]);
+        dimos_lcm::store_be(p + pos + 32, this->rotation_y[i]);
+        dimos_lcm::store_be(p + pos + 40, this->rotation_z[i]);
+        dimos_lcm::store_be(p + pos + 48, this->rotation_w[i]);
+        pos += 56;
+    }
+    return pos;
+}
+
+template <typename Writer>
+void TransformColumns::_writeNoHash(Writer &out, int n) const
+{
+    if(n <= 0) return;
+    uint8_t *p = out.extend(static_cast<size_t>(n) * 56);
+    for (int i = 0; i < n; i++, p += 56) {
+        dimos_lcm::store_be(p + 0, this->translation_x[i]);
+        dimos_lcm::store_be(p + 8, this->translation_y[i]);
+        dimos_lcm::store_be(p + 16, this->translation_z[i]);
+        dimos_lcm::store_be(p + 24, this->rotation_x[i]);
+        dimos_lcm::store_be(p + 32, this->rotation_y[i]);
+        dimos_lcm::store_be(p + 40, this->rotation_z[i]);
+        dimos_lcm::store_be(p + 48, this->rotation_w[i]);
+    }
+}
+
+int TransformColumns::_getEncodedSizeNoHash(int n) const
+{
+    return n * 56;
+}
+
+int TransformColumns::_decodeNoHash(const void *buf, int offset, int maxlen, int n)
+{
+    if(n < 0 || n > maxlen / 56) return -1;
+    this->resize(n);
+    const uint8_t *p = static_cast<const uint8_t*>(buf) + offset;
+    double *translation_x = this->translation_x.data();
+    double *translation_y = this->translation_y.data();
+    double *translation_z = this->translation_z.data();
+    double *rotation_x = this->rotation_x.data();
+    double *rotation_y = this->rotation_y.data();
+    double *rotation_z = this->rotation_z.data();
+    double *rotation_w = this->rotation_w.data();
+    for (int i = 0; i < n; i++, p += 56) {
+        dimos_lcm::load_be(p + 0, translation_x[i]);
+        dimos_lcm::load_be(p + 8, translation_y[i]);
+        dimos_lcm::load_be(p + 16, translation_z[i]);
+        dimos_lcm::load_be(p + 24, rotation_x[i]);
+        dimos_lcm::load_be(p + 32, rotation_y[i]);
+        dimos_lcm::load_be(p + 40, rotation_z[i]);
+        dimos_lcm::load_be(p + 48, rotation_w[i]);
+    }
+    return n * 56;
+}
+
+}
+
+#endif
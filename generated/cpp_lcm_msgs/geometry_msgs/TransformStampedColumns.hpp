@@ -0,0 +1,255 @@
+/** THIS IS AN AUTOMATICALLY GENERATED FILE.  DO NOT MODIFY
+ * BY HAND!!
+ *
+ * Generated by lcm-cpp (tools/cpp/gen)
+ **/
+
+#ifndef __geometry_msgs_TransformStampedColumns_hpp__
+#define __geometry_msgs_TransformStampedColumns_hpp__
+
+#include <lcm/lcm_coretypes.h>
+
+#include <string>
+#include <vector>
+#include "dimos_lcm/fixed_codec.hpp"
+#include "geometry_msgs/TransformStamped.hpp"
+
+namespace geometry_msgs
+{
+
+/**
+ * Structure-of-arrays storage for a sequence of geometry_msgs.TransformStamped: one
+ * contiguous array per field, with nested fields flattened and named by their
+ * path (header_seq, header_stamp_sec, ...). The soa:: message classes hold their
+ * TransformStamped arrays this way and decode them straight into the columns.
+ */
+class TransformStampedColumns
+{
+    public:
+        // header.seq
+        std::vector< int32_t > header_seq;
+
+        // header.stamp.sec
+        std::vector< int32_t > header_stamp_sec;
+
+        // header.stamp.nsec
+        std::vector< int32_t > header_stamp_nsec;
+
+        // header.frame_id
+        std::vector< std::string > header_frame_id;
+
+        std::vector< std::string > child_frame_id;
+
+        // transform.translation.x
+        std::vector< double > transform_translation_x;
+
+        // transform.translation.y
+        std::vector< double > transform_translation_y;
+
+        // transform.translation.z
+        std::vector< double > transform_translation_z;
+
+        // transform.rotation.x
+        std::vector< double > transform_rotation_x;
+
+        // transform.rotation.y
+        std::vector< double > transform_rotation_y;
+
+        // transform.rotation.z
+        std::vector< double > transform_rotation_z;
+
+        // transform.rotation.w
+        std::vector< double > transform_rotation_w;
+
+    public:
+        /**
+         * Number of elements.
+         */
+        inline int size() const;
+
+        /**
+         * Resize every column to @p n elements.
+         */
+        inline void resize(int n);
+
+        /**
+         * Gather element @p i into a TransformStamped.
+         */
+        inline geometry_msgs::TransformStamped get(int i) const;
+
+        /**
+         * Scatter @p msg into element @p i.
+         */
+        inline void set(int i, const geometry_msgs::TransformStamped &msg);
+
+        // LCM support functions. Users should not call these
+        inline int _encodeNoHash(void *buf, int offset, int maxlen, int n) const;
+        template <typename Writer>
+        inline void _writeNoHash(Writer &out, int n) const;
+        inline int _getEncodedSizeNoHash(int n) const;
+        inline int _decodeNoHash(const void *buf, int offset, int maxlen, int n);
+};
+
+int TransformStampedColumns::size() const
+{
+    return static_cast<int>(this->header_seq.size());
+}
+
+void TransformStampedColumns::resize(int n)
+{
+    this->header_seq.resize(n);
+    this->header_stamp_sec.resize(n);
+    this->header_stamp_nsec.resize(n);
+    this->header_frame_id.resize(n);
+    this->child_frame_id.resize(n);
+    this->transform_translation_x.resize(n);
+    this->transform_translation_y.resize(n);
+    this->transform_translation_z.resize(n);
+    this->transform_rotation_x.resize(n);
+    this->transform_rotation_y.resize(n);
+    this->transform_rotation_z.resize(n);
+    this->transform_rotation_w.resize(n);
+}
+
+geometry_msgs::TransformStamped TransformStampedColumns::get(int i) const
+{
+    geometry_msgs::TransformStamped msg;
+    msg.header.seq = this->header_seq[i];
+    msg.header.stamp.sec = this->header_stamp_sec[i];
+    msg.header.stamp.nsec = this->header_stamp_nsec[i];
+    msg.header.frame_id = this->header_frame_id[i];
+    msg.child_frame_id = this->child_frame_id[i];
+    msg.transform.translation.x = this->transform_translation_x[i];
+    msg.transform.translation.y = this->transform_translation_y[i];
+    msg.transform.translation.z = this->transform_translation_z[i];
+    msg.transform.rotation.x = this->transform_rotation_x[i];
+    msg.transform.rotation.y = this->transform_rotation_y[i];
+    msg.transform.rotation.z = this->transform_rotation_z[i];
+    msg.transform.rotation.w = this->transform_rotation_w[i];
+    return msg;
+}
+
+void TransformStampedColumns::set(int i, const geometry_msgs::TransformStamped &msg)
+{
+    this->header_seq[i] = msg.header.seq;
+    this->header_stamp_sec[i] = msg.header.stamp.sec;
+    this->header_stamp_nsec[i] = msg.header.stamp.nsec;
+    this->header_frame_id[i] = msg.header.frame_id;
+    this->child_frame_id[i] = msg.child_frame_id;
+    this->transform_translation_x[i] = msg.transform.translation.x;
+    this->transform_translation_y[i] = msg.transform.translation.y;
+    this->transform_translation_z[i] = msg.transform.translation.z;
+    this->transform_rotation_x[i] = msg.transform.rotation.x;
+    this->transform_rotation_y[i] = msg.transform.rotation.y;
+    this->transform_rotation_z[i] = msg.transform.rotation.z;
+    this->transform_rotation_w[i] = msg.transform.rotation.w;
+}
+
+int TransformStampedColumns::_encodeNoHash(void *buf, int offset, int maxlen, int n) const
+{
+    uint8_t *p = static_cast<uint8_t*>(buf) + offset;
+    int pos = 0;
+    for (int i = 0; i < n; i++) {
+        if(maxlen - pos < 12) return -1;
+        dimos_lcm::store_be(p + pos + 0, this->header_seq[i]);
+        dimos_lcm::store_be(p + pos + 4, this->header_stamp_sec[i]);
+        dimos_lcm::store_be(p + pos + 8, this->header_stamp_nsec[i]);
+        pos += 12;
+        int32_t __header_frame_id_len__ = static_cast<int32_t>(this->header_frame_id[i].size()) + 1;
+        if(maxlen - pos < 4 || __header_frame_id_len__ > maxlen - pos - 4) return -1;
+        dimos_lcm::store_be(p + pos, __header_frame_id_len__);
+        memcpy(p + pos + 4, this->header_frame_id[i].c_str(), __header_frame_id_len__);
+        pos += 4 + __header_frame_id_len__;
+        int32_t __child_frame_id_len__ = static_cast<int32_t>(this->child_frame_id[i].size()) + 1;
+        if(maxlen - pos < 4 || __child_frame_id_len__ > maxlen - pos - 4) return -1;
+        dimos_lcm::store_be(p + pos, __child_frame_id_len__);
+        memcpy(p + pos + 4, this->child_frame_id[i].c_str(), __child_frame_id_len__);
+        pos += 4 + __child_frame_id_len__;
+        if(maxlen - pos < 56) return -1;
+        dimos_lcm::store_be(p + pos + 0, this->transform_translation_x[i]);
+        dimos_lcm::store_be(p + pos + 8, this->transform_translation_y[i]);
+        dimos_lcm::store_be(p + pos + 16, this->transform_translation_z[i]);
+        dimos_lcm::store_be(p + pos + 24, this->transform_rotation_x[i]);
+        dimos_lcm::store_be(p + pos + 32, this->transform_rotation_y[i]);
+        dimos_lcm::store_be(p + pos + 40, this->transform_rotation_z[i]);
+        dimos_lcm::store_be(p + pos + 48, this->transform_rotation_w[i]);
+        pos += 56;
+    }
+    return pos;
+}
+
+template <typename Writer>
+void TransformStampedColumns::_writeNoHash(Writer &out, int n) const
+{
+    for (int i = 0; i < n; i++) {
+        {
+            uint8_t *p = out.extend(12);
+            dimos_lcm::store_be(p + 0, this->header_seq[i]);
+            dimos_lcm::store_be(p + 4, this->header_stamp_sec[i]);
+            dimos_lcm::store_be(p + 8, this->header_stamp_nsec[i]);
+        }
+        out.put(this->header_frame_id[i]);
+        out.put(this->child_frame_id[i]);
+        {
+            uint8_t *p = out.extend(56);
+            dimos_lcm::store_be(p + 0, this->transform_translation_x[i]);
+            dimos_lcm::store_be(p + 8, this->transform_translation_y[i]);
+            dimos_lcm::store_be(p + 16, this->transform_translation_z[i]);
+            dimos_lcm::store_be(p + 24, this->transform_rotation_x[i]);
+            dimos_lcm::store_be(p + 32, this->transform_rotation_y[i]);
+            dimos_lcm::store_be(p + 40, this->transform_rotation_z[i]);
+            dimos_lcm::store_be(p + 48, this->transform_rotation_w[i]);
+        }
+    }
+}
+
+int TransformStampedColumns::_getEncodedSizeNoHash(int n) const
+{
+    int size = n * 78;
+    for (int i = 0; i < n; i++)
+        size += this->header_frame_id[i].size() + this->child_frame_id[i].size();
+    return size;
+}
+
+int TransformStampedColumns::_decodeNoHash(const void *buf, int offset, int maxlen, int n)
+{
+    if(n < 0 || n > maxlen / 78) return -1;
+    this->resize(n);
+    const uint8_t *p = static_cast<const uint8_t*>(buf) + offset;
+    int pos = 0;
+    for (int i = 0; i < n; i++) {
+        if(maxlen - pos < 12) return -1;
+        dimos_lcm::load_be(p + pos + 0, this->header_seq[i]);
+        dimos_lcm::load_be(p + pos + 4, this->header_stamp_sec[i]);
+        dimos_lcm::load_be(p + pos + 8, this->header_stamp_nsec[i]);
+        pos += 12;
+        int32_t __header_frame_id_len__;
+        if(maxlen - pos < 4) return -1;
+        dimos_lcm::load_be(p + pos, __header_frame_id_len__);
+        pos += 4;
+        if(__header_frame_id_len__ < 1 || __header_frame_id_len__ > maxlen - pos) return -1;
+        this->header_frame_id[i].assign(reinterpret_cast<const char*>(p) + pos, __header_frame_id_len__ - 1);
+        pos += __header_frame_id_len__;
+        int32_t __child_frame_id_len__;
+        if(maxlen - pos < 4) return -1;
+        dimos_lcm::load_be(p + pos, __child_frame_id_len__);
+        pos += 4;
+        if(__child_frame_id_len__ < 1 || __child_frame_id_len__ > maxlen - pos) return -1;
+        this->child_frame_id[i].assign(reinterpret_cast<const char*>(p) + pos, __child_frame_id_len__ - 1);
+        pos += __child_frame_id_len__;
+        if(maxlen - pos < 56) return -1;
+        dimos_lcm::load_be(p + pos + 0, this->transform_translation_x[i]);
+        dimos_lcm::load_be(p + pos + 8, this->transform_translation_y[i]);
+        dimos_lcm::load_be(p + pos + 16, this->transform_translation_z[i]);
+        dimos_lcm::load_be(p + pos + 24, this->transform_rotation_x[i]);
+        dimos_lcm::load_be(p + pos + 32, this->transform_rotation_y[i]);
+        dimos_lcm::load_be(p + pos + 40, this->transform_rotation_z[i]);
+        dimos_lcm::load_be(p + pos + 48, this->transform_rotation_w[i]);
+        pos += 56;
+    }
+    return pos;
+}
+
+}
+
+#endif
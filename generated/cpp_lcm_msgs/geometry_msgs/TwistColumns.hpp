@@ -0,0 +1,173 @@
+/** THIS IS AN AUTOMATICALLY GENERATED FILE.  DO NOT MODIFY
+ * BY HAND!!
+ *
+ * Generated by lcm-cpp (tools/cpp/gen)
+ **/
+
+#ifndef __geometry_msgs_TwistColumns_hpp__
+#define __geometry_msgs_TwistColumns_hpp__
+
+#include <lcm/lcm_coretypes.h>
+
+#include <vector>
+#include "dimos_lcm/fixed_codec.hpp"
+#include "geometry_msgs/Twist.hpp"
+
+namespace geometry_msgs
+{
+
+/**
+ * Structure-of-arrays storage for a sequence of geometry_msgs.Twist: one
+ * contiguous array per field, with nested fields flattened and named by their
+ * path (linear_x, linear_y, ...). The soa:: message classes hold their
+ * Twist arrays this way and decode them straight into the columns.
+ */
+class TwistColumns
+{
+    public:
+        // linear.x
+        std::vector< double > linear_x;
+
+        // linear.y
+        std::vector< double > linear_y;
+
+        // linear.z
+        std::vector< double > linear_z;
+
+        // angular.x
+        std::vector< double > angular_x;
+
+        // angular.y
+        std::vector< double > angular_y;
+
+        // angular.z
+        std::vector< double > angular_z;
+
+    public:
+        /**
+         * Number of elements.
+         */
+        inline int size() const;
+
+        /**
+         * Resize every column to @p n elements.
+         */
+        inline void resize(int n);
+
+        /**
+         * Gather element @p i into a Twist.
+         */
+        inline geometry_msgs::Twist get(int i) const;
+
+        /**
+         * Scatter @p msg into element @p i.
+         */
+        inline void set(int i, const geometry_msgs::Twist &msg);
+
+        // LCM support functions. Users should not call these
+        inline int _encodeNoHash(void *buf, int offset, int maxlen, int n) const;
+        template <typename Writer>
+        inline void _writeNoHash(Writer &out, int n) const;
+        inline int _getEncodedSizeNoHash(int n) const;
+        inline int _decodeNoHash(const void *buf, int offset, int maxlen, int n);
+};
+
+int TwistColumns::size() const
+{
+    return static_cast<int>(this->linear_x.size());
+}
+
+void TwistColumns::resize(int n)
+{
+    this->linear_x.resize(n);
+    this->linear_y.resize(n);
+    this->linear_z.resize(n);
+    this->angular_x.resize(n);
+    this->angular_y.resize(n);
+    this->angular_z.resize(n);
+}
+
+geometry_msgs::Twist TwistColumns::get(int i) const
+{
+    geometry_msgs::Twist msg;
+    msg.linear.x = this->linear_x[i];
+    msg.linear.y = this->linear_y[i];
+    msg.linear.z = this->linear_z[i];
+    msg.angular.x = this->angular_x[i];
+    msg.angular.y = this->angular_y[i];
+    msg.angular.z = this->angular_z[i];
+    return msg;
+}
+
+void TwistColumns::set(int i, const geometry_msgs::Twist &msg)
+{
+    this->linear_x[i] = msg.linear.x;
+    this->linear_y[i] = msg.linear.y;
+    this->linear_z[i] = msg.linear.z;
+    this->angular_x[i] = msg.angular.x;
+    this->angular_y[i] = msg.angular.y;
+    this->angular_z[i] = msg.angular.z;
+}
+
+int TwistColumns::_encodeNoHash(void *buf, int offset, int maxlen, int n) const
+{
+    uint8_t *p = static_cast<uint8_t*>(buf) + offset;
+    int pos = 0;
+    for (int i = 0; i < n; i++) {
+        if(maxlen - pos < 48) return -1;
+        dimos_lcm::store_be(p + pos + 0, this->linear_x[i]);
+        dimos_lcm::store_be(p + pos + 8, this->linear_y[i]);
+        dimos_lcm::store_be(p + pos + 16, this->linear_z[i]);
+        dimos_lcm::store_be(p + pos + 24, this->angular_x[i]);
+        dimos_lcm::store_be(p + pos + 32, this->angular_y[i]);
+        dimos_lcm::store_be(p + pos + 40, this->angular_z[i]);
+        pos += 48;
+    }
+    return pos;
+}
+
+template <typename Writer>
+void TwistColumns::_writeNoHash(Writer &out, int n) const
+{
+    if(n <= 0) return;
+    uint8_t *p = out.extend(static_cast<size_t>(n) * 48);
+    for (int i = 0; i < n; i++, p += 48) {
+        dimos_lcm::store_be(p + 0, this->linear_x[i]);
+        dimos_lcm::store_be(p + 8, this->linear_y[i]);
+        dimos_lcm::store_be(p + 16, this->linear_z[i]);
+        dimos_lcm::store_be(p + 24, this->angular_x[i]);
+        dimos_lcm::store_be(p + 32, this->angular_y[i]);
+        dimos_lcm::store_be(p + 40, this->angular_z[i]);
+    }
+}
+
+int TwistColumns::_getEncodedSizeNoHash(int n) const
+{
+    return n * 48;
+}
+
+int TwistColumns::_decodeNoHash(const void *buf, int offset, int maxlen, int n)
+{
+    if(n < 0 || n > maxlen / 48) return -1;
+    this->resize(n);
+    const uint8_t *p = static_cast<const uint8_t*>(buf) + offset;
+    double *linear_x = this->linear_x.data();
+    double *linear_y = this->linear_y.data();
+    double *linear_z = this->linear_z.data();
+    double *angular_x = this->angular_x.data();
+    double *angular_y = this->angular_y.data();
+    double *angular_z = this->angular_z.data();
+    for (int i = 0; i < n; i++, p += 48) {
+        dimos_lcm::load_be(p + 0, linear_x[i]);
+        dimos_lcm::load_be(p + 8, linear_y[i]);
+        dimos_lcm::load_be(p + 16, linear_z[i]);
+        dimos_lcm::load_be(p + 24, angular_x[i]);
+        dimos_lcm::load_be(p + 32, angular_y[i]);
+        dimos_lcm::load_be(p + 40, angular_z[i]);
+    }
+    return n * 48;
+}
+
+}
+
+#endif
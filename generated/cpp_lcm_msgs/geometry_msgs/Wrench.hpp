@@ -1,7 +1,7 @@
 /** THIS IS AN AUTOMATICALLY GENERATED FILE.  DO NOT MODIFY
  * BY HAND!!
  *
- * Generated by lcm-gen 1.5.2
+ * Generated by lcm-cpp (tools/cpp/gen)
  **/
 
 #ifndef __geometry_msgs_Wrench_hpp__
@@ -9,7 +9,11 @@
 
 #include <lcm/lcm_coretypes.h>
 
-#include "geometry_msgs/Vector3.hpp"
+#include <array>
+#include "dimos_lcm/fixed_codec.hpp"
+#include "dimos_lcm/writer.hpp"
+#include "dimos_lcm/fingerprint.hpp"
+#include "dimos_lcm/reflection.hpp"
 #include "geometry_msgs/Vector3.hpp"
 
 namespace geometry_msgs
@@ -34,11 +38,26 @@ class Wrench
          */
         inline int encode(void *buf, int offset, int maxlen) const;
 
+        /**
+         * Encode a message by appending it to @p buf, walking the message once
+         * instead of sizing it with getEncodedSize() first. @p buf grows
+         * geometrically; reuse it across calls to avoid reallocating.
+         *
+         * @return The number of bytes appended.
+         */
+        inline int encodeTo(std::vector<uint8_t> &buf) const;
+
         /**
          * Check how many bytes are required to encode this message.
          */
         inline int getEncodedSize() const;
 
+        /**
+         * getEncodedSize() of every instance: the type has no strings or
+         * variable-length arrays.
+         */
+        static constexpr int kEncodedSize = 56;
+
         /**
          * Decode a message from binary form into this instance.
          *
@@ -57,18 +76,46 @@ class Wrench
          */
         inline static int64_t getHash();
 
+        /**
+         * The fingerprint returned by getHash(), as a compile-time constant.
+         */
+        static constexpr int64_t kHash = static_cast<int64_t>(0xccfb0646cebc17c4ULL);
+
         /**
          * Returns "Wrench"
          */
         inline static const char* getTypeName();
 
+        /**
+         * Name, LCM type and array dimensions of each field, in wire order.
+         * See dimos_lcm::for_each_field() for visiting the fields themselves.
+         */
+        static constexpr std::array<dimos_lcm::field_info, 2> kFields = {{
+            { "force", "geometry_msgs.Vector3", false, 0, 0, NULL },
+            { "torque", "geometry_msgs.Vector3", false, 0, 0, NULL },
+        }};
+
         // LCM support functions. Users should not call these
         inline int _encodeNoHash(void *buf, int offset, int maxlen) const;
+        template <typename Writer>
+        inline void _writeNoHash(Writer &out) const;
         inline int _getEncodedSizeNoHash() const;
         inline int _decodeNoHash(const void *buf, int offset, int maxlen);
+        template <typename Self, typename Visitor>
+        inline static void _forEachField(Self &self, Visitor &visitor);
+        inline static int _skipNoHash(const void *buf, int offset, int maxlen);
         inline static uint64_t _computeHash(const __lcm_hash_ptr *p);
 };
 
+static_assert(Wrench::kHash == dimos_lcm::fingerprint(
+    dimos_lcm::signature_hash()
+        .member("force", NULL, 0)
+        .member("torque", NULL, 0)
+        .value(),
+    geometry_msgs::Vector3::kHash,
+    geometry_msgs::Vector3::kHash),
+    "geometry_msgs::Wrench fingerprint does not match its definition");
+
 int Wrench::encode(void *buf, int offset, int maxlen) const
 {
     int pos = 0, tlen;
@@ -83,6 +130,15 @@ int Wrench::encode(void *buf, int offset, int maxlen) const
     return pos;
 }
 
+int Wrench::encodeTo(std::vector<uint8_t> &buf) const
+{
+    dimos_lcm::vector_writer out(buf);
+    int64_t hash = getHash();
+    out.put(&hash, 1);
+    this->_writeNoHash(out);
+    return static_cast<int>(out.size());
+}
+
 int Wrench::decode(const void *buf, int offset, int maxlen)
 {
     int pos = 0, thislen;
@@ -105,8 +161,7 @@ int Wrench::getEncodedSize() const
 
 int64_t Wrench::getHash()
 {
-    static int64_t hash = static_cast<int64_t>(_computeHash(NULL));
-    return hash;
+    return kHash;
 }
 
 const char* Wrench::getTypeName()
@@ -116,36 +171,51 @@ const char* Wrench::getTypeName()
 
 int Wrench::_encodeNoHash(void *buf, int offset, int maxlen) const
 {
-    int pos = 0, tlen;
-
-    tlen = this->force._encodeNoHash(buf, offset + pos, maxlen - pos);
-    if(tlen < 0) return tlen; else pos += tlen;
-
-    tlen = this->torque._encodeNoHash(buf, offset + pos, maxlen - pos);
-    if(tlen < 0) return tlen; else pos += tlen;
+    if(maxlen < kEncodedSize - 8) return -1;
+    uint8_t *p = static_cast<uint8_t*>(buf) + offset;
+    dimos_lcm::store_be(p + 0, this->force.x);
+    dimos_lcm::store_be(p + 8, this->force.y);
+    dimos_lcm::store_be(p + 16, this->force.z);
+    dimos_lcm::store_be(p + 24, this->torque.x);
+    dimos_lcm::store_be(p + 32, this->torque.y);
+    dimos_lcm::store_be(p + 40, this->torque.z);
+    return kEncodedSize - 8;
+}
 
-    return pos;
+template <typename Writer>
+void Wrench::_writeNoHash(Writer &out) const
+{
+    out.putStruct(*this);
 }
 
 int Wrench::_decodeNoHash(const void *buf, int offset, int maxlen)
 {
-    int pos = 0, tlen;
-
-    tlen = this->force._decodeNoHash(buf, offset + pos, maxlen - pos);
-    if(tlen < 0) return tlen; else pos += tlen;
+    if(maxlen < kEncodedSize - 8) return -1;
+    const uint8_t *p = static_cast<const uint8_t*>(buf) + offset;
+    dimos_lcm::load_be(p + 0, this->force.x);
+    dimos_lcm::load_be(p + 8, this->force.y);
+    dimos_lcm::load_be(p + 16, this->force.z);
+    dimos_lcm::load_be(p + 24, this->torque.x);
+    dimos_lcm::load_be(p + 32, this->torque.y);
+    dimos_lcm::load_be(p + 40, this->torque.z);
+    return kEncodedSize - 8;
+}
 
-    tlen = this->torque._decodeNoHash(buf, offset + pos, maxlen - pos);
-    if(tlen < 0) return tlen; else pos += tlen;
+int Wrench::_getEncodedSizeNoHash() const
+{
+    return kEncodedSize - 8;
+}
 
-    return pos;
+int Wrench::_skipNoHash(const void *, int, int maxlen)
+{
+    return maxlen < kEncodedSize - 8 ? -1 : kEncodedSize - 8;
 }
 
-int Wrench::_getEncodedSizeNoHash() const
+template <typename Self, typename Visitor>
+void Wrench::_forEachField(Self &self, Visitor &visitor)
 {
-    int enc_size = 0;
-    enc_size += this->force._getEncodedSizeNoHash();
-    enc_size += this->torque._getEncodedSizeNoHash();
-    return enc_size;
+    visitor(kFields[0], self.force);
+    visitor(kFields[1], self.torque);
 }
 
 uint64_t Wrench::_computeHash(const __lcm_hash_ptr *p)
@@ -0,0 +1,173 @@
+/** THIS IS AN AUTOMATICALLY GENERATED FILE.  DO NOT MODIFY
+ * BY HAND!!
+ *
+ * Generated by lcm-cpp (tools/cpp/gen)
+ **/
+
+#ifndef __geometry_msgs_WrenchColumns_hpp__
+#define __geometry_msgs_WrenchColumns_hpp__
+
+#include <lcm/lcm_coretypes.h>
+
+#include <vector>
+#include "dimos_lcm/fixed_codec.hpp"
+#include "geometry_msgs/Wrench.hpp"
+
+namespace geometry_msgs
+{
+
+/**
+ * Structure-of-arrays storage for a sequence of geometry_msgs.Wrench: one
+ * contiguous array per field, with nested fields flattened and named by their
+ * path (force_x, force_y, ...). The soa:: message classes hold their
+ * Wrench arrays this way and decode them straight into the columns.
+ */
+class WrenchColumns
+{
+    public:
+        // force.x
+        std::vector< double > force_x;
+
+        // force.y
+        std::vector< double > force_y;
+
+        // force.z
+        std::vector< double > force_z;
+
+        // torque.x
+        std::vector< double > torque_x;
+
+        // torque.y
+        std::vector< double > torque_y;
+
+        // torque.z
+        std::vector< double > torque_z;
+
+    public:
+        /**
+         * Number of elements.
+         */
+        inline int size() const;
+
+        /**
+         * Resize every column to @p n elements.
+         */
+        inline void resize(int n);
+
+        /**
+         * Gather element @p i into a Wrench.
+         */
+        inline geometry_msgs::Wrench get(int i) const;
+
+        /**
+         * Scatter @p msg into element @p i.
+         */
+        inline void set(int i, const geometry_msgs::Wrench &msg);
+
+        // LCM support functions. Users should not call these
+        inline int _encodeNoHash(void *buf, int offset, int maxlen, int n) const;
+        template <typename Writer>
+        inline void _writeNoHash(Writer &out, int n) const;
+        inline int _getEncodedSizeNoHash(int n) const;
+        inline int _decodeNoHash(const void *buf, int offset, int maxlen, int n);
+};
+
+int WrenchColumns::size() const
+{
+    return static_cast<int>(this->force_x.size());
+}
+
+void WrenchColumns::resize(int n)
+{
+    this->force_x.resize(n);
+    this->force_y.resize(n);
+    this->force_z.resize(n);
+    this->torque_x.resize(n);
+    this->torque_y.resize(n);
+    this->torque_z.resize(n);
+}
+
+geometry_msgs::Wrench WrenchColumns::get(int i) const
+{
+    geometry_msgs::Wrench msg;
+    msg.force.x = this->force_x[i];
+    msg.force.y = this->force_y[i];
+    msg.force.z = this->force_z[i];
+    msg.torque.x = this->torque_x[i];
+    msg.torque.y = this->torque_y[i];
+    msg.torque.z = this->torque_z[i];
+    return msg;
+}
+
+void WrenchColumns::set(int i, const geometry_msgs::Wrench &msg)
+{
+    this->force_x[i] = msg.force.x;
+    this->force_y[i] = msg.force.y;
+    this->force_z[i] = msg.force.z;
+    this->torque_x[i] = msg.torque.x;
+    this->torque_y[i] = msg.torque.y;
+    this->torque_z[i] = msg.torque.z;
+}
+
+int WrenchColumns::_encodeNoHash(void *buf, int offset, int maxlen, int n) const
+{
+    uint8_t *p = static_cast<uint8_t*>(buf) + offset;
+    int pos = 0;
+    for (int i = 0; i < n; i++) {
+        if(maxlen - pos < 48) return -1;
+        dimos_lcm::store_be(p + pos + 0, this->force_x[i]);
+        dimos_lcm::store_be(p + pos + 8, this->force_y[i]);
+        dimos_lcm::store_be(p + pos + 16, this->force_z[i]);
+        dimos_lcm::store_be(p + pos + 24, this->torque_x[i]);
+        dimos_lcm::store_be(p + pos + 32, this->torque_y[i]);
+        dimos_lcm::store_be(p + pos + 40, this->torque_z[i]);
+        pos += 48;
+    }
+    return pos;
+}
+
+template <typename Writer>
+void WrenchColumns::_writeNoHash(Writer &out, int n) const
+{
+    if(n <= 0) return;
+    uint8_t *p = out.extend(static_cast<size_t>(n) * 48);
+    for (int i = 0; i < n; i++, p += 48) {
+        dimos_lcm::store_be(p + 0, this->force_x[i]);
+        dimos_lcm::store_be(p + 8, this->force_y[i]);
+        dimos_lcm::store_be(p + 16, this->force_z[i]);
+        dimos_lcm::store_be(p + 24, this->torque_x[i]);
+        dimos_lcm::store_be(p + 32, this->torque_y[i]);
+        dimos_lcm::store_be(p + 40, this->torque_z[i]);
+    }
+}
+
+int WrenchColumns::_getEncodedSizeNoHash(int n) const
+{
+    return n * 48;
+}
+
+int WrenchColumns::_decodeNoHash(const void *buf, int offset, int maxlen, int n)
+{
+    if(n < 0 || n > maxlen / 48) return -1;
+    this->resize(n);
+    const uint8_t *p = static_cast<const uint8_t*>(buf) + offset;
+    double *force_x = this->force_x.data();
+    double *force_y = this->force_y.data();
+    double *force_z = this->force_z.data();
+    double *torque_x = this->torque_x.data();
+    double *torque_y = this->torque_y.data();
+    double *torque_z = this->torque_z.data();
+    for (int i = 0; i < n; i++, p += 48) {
+        dimos_lcm::load_be(p + 0, force_x[i]);
+        dimos_lcm::load_be(p + 8, force_y[i]);
+        dimos_lcm::load_be(p + 16, force_z[i]);
+        dimos_lcm::load_be(p + 24, torque_x[i]);
+        dimos_lcm::load_be(p + 32, torque_y[i]);
+        dimos_lcm::load_be(p + 40, torque_z[i]);
+    }
+    return n * 48;
+}
+
+}
+
+#endif
@@ -0,0 +1,23 @@
+/** THIS IS AN AUTOMATICALLY GENERATED FILE.  DO NOT MODIFY
+ * BY HAND!!
+ *
+ * Generated by lcm-cpp (tools/cpp/gen)
+ **/
+
+#ifndef __geometry_msgs_pmr_Point_hpp__
+#define __geometry_msgs_pmr_Point_hpp__
+
+#include "geometry_msgs/Point.hpp"
+
+namespace geometry_msgs
+{
+namespace pmr
+{
+
+// Point has no strings or variable-length arrays, so it never allocates
+typedef geometry_msgs::Point Point;
+
+}
+}
+
+#endif
@@ -1,7 +1,7 @@
 /** THIS IS AN AUTOMATICALLY GENERATED FILE.  DO NOT MODIFY
  * BY HAND!!
  *
- * Generated by lcm-gen 1.5.2
+ * Generated by lcm-cpp (tools/cpp/gen)
  **/
 
 #ifndef __nav_msgs_GridCells_hpp__
@@ -9,9 +9,16 @@
 
 #include <lcm/lcm_coretypes.h>
 
+#include <array>
 #include <vector>
+#include "dimos_lcm/writer.hpp"
+#include "dimos_lcm/fingerprint.hpp"
+#include "dimos_lcm/reflection.hpp"
 #include "std_msgs/Header.hpp"
 #include "geometry_msgs/Point.hpp"
+#if __cplusplus >= 201703L
+#include "std_msgs/HeaderView.hpp"
+#endif
 
 namespace nav_msgs
 {
@@ -44,6 +51,15 @@ class GridCells
          */
         inline int encode(void *buf, int offset, int maxlen) const;
 
+        /**
+         * Encode a message by appending it to @p buf, walking the message once
+         * instead of sizing it with getEncodedSize() first. @p buf grows
+         * geometrically; reuse it across calls to avoid reallocating.
+         *
+         * @return The number of bytes appended.
+         */
+        inline int encodeTo(std::vector<uint8_t> &buf) const;
+
         /**
          * Check how many bytes are required to encode this message.
          */
@@ -59,6 +75,62 @@ class GridCells
          */
         inline int decode(const void *buf, int offset, int maxlen);
 
+#if __cplusplus >= 201703L
+        /**
+         * Decode only the header field of an encoded message, leaving the
+         * rest of it untouched. The field sits at a fixed offset, so this costs
+         * the same for any payload size. The view points into @p buf.
+         *
+         * @param buf The buffer containing the encoded message.
+         * @param offset The byte offset into @p buf where the encoded message starts.
+         * @param maxlen The maximum number of bytes to read while decoding.
+         * @param header Receives the decoded header.
+         * @return The number of bytes of the field decoded, or <0 if @p buf does
+         *  not hold a GridCells or is truncated.
+         *
+         * Needs C++17, for the std::string_view of the view.
+         */
+        inline static int peekHeader(const void *buf, int offset, int maxlen, std_msgs::HeaderView &header);
+#endif
+
+        /**
+         * Field bits for decodeFields().
+         */
+        struct Fields
+        {
+            static constexpr uint64_t cells_length = 1ULL << 0;
+            static constexpr uint64_t header = 1ULL << 1;
+            static constexpr uint64_t cell_width = 1ULL << 2;
+            static constexpr uint64_t cell_height = 1ULL << 3;
+            static constexpr uint64_t cells = 1ULL << 4;
+            static constexpr uint64_t all = (1ULL << 5) - 1;
+        };
+
+        /**
+         * Decode only the fields selected by @p Mask, a bitwise or of Fields
+         * values. Strings, arrays and nested structs that are not selected are
+         * skipped over by their length prefixes without being allocated, and
+         * keep their previous value. Scalar fields are always decoded: they
+         * cost nothing to read and array lengths depend on them.
+         *
+         * @return The number of bytes decoded, or <0 if an error occured.
+         */
+        template <uint64_t Mask>
+        inline int decodeFields(const void *buf, int offset, int maxlen);
+
+        /**
+         * Upper bound on the length of every variable-length array of this
+         * type, checked by decode() before anything is allocated; messages
+         * exceeding it fail to decode. It does not apply to nested types,
+         * which have their own. Set it once at startup, before decoding.
+         * Before C++17 it is a constant with no limit.
+         */
+#if __cplusplus >= 201703L
+        static inline int32_t maxArrayLength = INT32_MAX;
+#else
+        static constexpr int32_t maxArrayLength = INT32_MAX;
+#endif
+
         /**
          * Retrieve the 64-bit fingerprint identifying the structure of the message.
          * Note that the fingerprint is the same for all instances of the same
@@ -67,18 +139,54 @@ class GridCells
          */
         inline static int64_t getHash();
 
+        /**
+         * The fingerprint returned by getHash(), as a compile-time constant.
+         */
+        static constexpr int64_t kHash = static_cast<int64_t>(0x2d5d46c99bb226cbULL);
+
         /**
          * Returns "GridCells"
          */
         inline static const char* getTypeName();
 
+        /**
+         * Name, LCM type and array dimensions of each field, in wire order.
+         * See dimos_lcm::for_each_field() for visiting the fields themselves.
+         */
+        static constexpr std::array<dimos_lcm::field_info, 5> kFields = {{
+            { "cells_length", "int32_t", true, 0, 0, NULL },
+            { "header", "std_msgs.Header", false, 0, 0, NULL },
+            { "cell_width", "float", true, 0, 0, NULL },
+            { "cell_height", "float", true, 0, 0, NULL },
+            { "cells", "geometry_msgs.Point", false, 1, -1, "cells_length" },
+        }};
+
         // LCM support functions. Users should not call these
         inline int _encodeNoHash(void *buf, int offset, int maxlen) const;
+        template <typename Writer>
+        inline void _writeNoHash(Writer &out) const;
         inline int _getEncodedSizeNoHash() const;
         inline int _decodeNoHash(const void *buf, int offset, int maxlen);
+        template <uint64_t Mask>
+        inline int _decodeFieldsNoHash(const void *buf, int offset, int maxlen);
+        template <typename Self, typename Visitor>
+        inline static void _forEachField(Self &self, Visitor &visitor);
+        inline static int _skipNoHash(const void *buf, int offset, int maxlen);
         inline static uint64_t _computeHash(const __lcm_hash_ptr *p);
 };
 
+static_assert(GridCells::kHash == dimos_lcm::fingerprint(
+    dimos_lcm::signature_hash()
+        .member("cells_length", "int32_t", 0)
+        .member("header", NULL, 0)
+        .member("cell_width", "float", 0)
+        .member("cell_height", "float", 0)
+        .member("cells", NULL, 1).dim(true, "cells_length")
+        .value(),
+    std_msgs::Header::kHash,
+    geometry_msgs::Point::kHash),
+    "nav_msgs::GridCells fingerprint does not match its definition");
+
 int GridCells::encode(void *buf, int offset, int maxlen) const
 {
     int pos = 0, tlen;
@@ -93,6 +201,15 @@ int GridCells::encode(void *buf, int offset, int maxlen) const
     return pos;
 }
 
+int GridCells::encodeTo(std::vector<uint8_t> &buf) const
+{
+    dimos_lcm::vector_writer out(buf);
+    int64_t hash = getHash();
+    out.put(&hash, 1);
+    this->_writeNoHash(out);
+    return static_cast<int>(out.size());
+}
+
 int GridCells::decode(const void *buf, int offset, int maxlen)
 {
     int pos = 0, thislen;
@@ -108,6 +225,34 @@ int GridCells::decode(const void *buf, int offset, int maxlen)
     return pos;
 }
 
+#if __cplusplus >= 201703L
+int GridCells::peekHeader(const void *buf, int offset, int maxlen, std_msgs::HeaderView &header)
+{
+    int64_t msg_hash;
+    if (__int64_t_decode_array(buf, offset, maxlen, &msg_hash, 1) < 0) return -1;
+    if (msg_hash != kHash) return -1;
+
+    // header follows the hash and 4 bytes of fixed-size fields
+    return header._decodeNoHash(buf, offset + 12, maxlen - 12);
+}
+#endif
+
+template <uint64_t Mask>
+int GridCells::decodeFields(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, thislen;
+
+    int64_t msg_hash;
+    thislen = __int64_t_decode_array(buf, offset + pos, maxlen - pos, &msg_hash, 1);
+    if (thislen < 0) return thislen; else pos += thislen;
+    if (msg_hash != getHash()) return -1;
+
+    thislen = this->_decodeFieldsNoHash<Mask>(buf, offset + pos, maxlen - pos);
+    if (thislen < 0) return thislen; else pos += thislen;
+
+    return pos;
+}
+
 int GridCells::getEncodedSize() const
 {
     return 8 + _getEncodedSizeNoHash();
@@ -115,8 +260,7 @@ int GridCells::getEncodedSize() const
 
 int64_t GridCells::getHash()
 {
-    static int64_t hash = static_cast<int64_t>(_computeHash(NULL));
-    return hash;
+    return kHash;
 }
 
 const char* GridCells::getTypeName()
@@ -148,6 +292,17 @@ int GridCells::_encodeNoHash(void *buf, int offset, int maxlen) const
     return pos;
 }
 
+template <typename Writer>
+void GridCells::_writeNoHash(Writer &out) const
+{
+    out.put(&this->cells_length, 1);
+    this->header._writeNoHash(out);
+    out.put(&this->cell_width, 1);
+    out.put(&this->cell_height, 1);
+    if(this->cells_length > 0)
+        out.putStructArray(&this->cells[0], this->cells_length);
+}
+
 int GridCells::_decodeNoHash(const void *buf, int offset, int maxlen)
 {
     int pos = 0, tlen;
@@ -164,6 +319,7 @@ int GridCells::_decodeNoHash(const void *buf, int offset, int maxlen)
     tlen = __float_decode_array(buf, offset + pos, maxlen - pos, &this->cell_height, 1);
     if(tlen < 0) return tlen; else pos += tlen;
 
+    if(this->cells_length < 0 || this->cells_length > (maxlen - pos) / 24 || this->cells_length > maxArrayLength) return -1;
     try {
         this->cells.resize(this->cells_length);
     } catch (...) {
@@ -177,6 +333,50 @@ int GridCells::_decodeNoHash(const void *buf, int offset, int maxlen)
     return pos;
 }
 
+template <uint64_t Mask>
+int GridCells::_decodeFieldsNoHash(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, tlen;
+
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &this->cells_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    if ((Mask & Fields::header) != 0) {
+        tlen = this->header._decodeNoHash(buf, offset + pos, maxlen - pos);
+        if(tlen < 0) return tlen; else pos += tlen;
+    } else {
+        tlen = std_msgs::Header::_skipNoHash(buf, offset + pos, maxlen - pos);
+        if(tlen < 0) return tlen; else pos += tlen;
+    }
+
+    tlen = __float_decode_array(buf, offset + pos, maxlen - pos, &this->cell_width, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = __float_decode_array(buf, offset + pos, maxlen - pos, &this->cell_height, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    if ((Mask & Fields::cells) != 0) {
+        if(this->cells_length < 0 || this->cells_length > (maxlen - pos) / 24 || this->cells_length > maxArrayLength) return -1;
+        try {
+            this->cells.resize(this->cells_length);
+        } catch (...) {
+            return -1;
+        }
+        for (int a0 = 0; a0 < this->cells_length; a0++) {
+            tlen = this->cells[a0]._decodeNoHash(buf, offset + pos, maxlen - pos);
+            if(tlen < 0) return tlen; else pos += tlen;
+        }
+    } else {
+        if(this->cells_length < 0) return -1;
+        for (int a0 = 0; a0 < this->cells_length; a0++) {
+            tlen = geometry_msgs::Point::_skipNoHash(buf, offset + pos, maxlen - pos);
+            if(tlen < 0) return tlen; else pos += tlen;
+        }
+    }
+
+    return pos;
+}
+
 int GridCells::_getEncodedSizeNoHash() const
 {
     int enc_size = 0;
@@ -190,6 +390,35 @@ int GridCells::_getEncodedSizeNoHash() const
     return enc_size;
 }
 
+int GridCells::_skipNoHash(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, tlen;
+    int32_t cells_length;
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &cells_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+    tlen = std_msgs::Header::_skipNoHash(buf, offset + pos, maxlen - pos);
+    if(tlen < 0) return tlen; else pos += tlen;
+    pos += 4;
+    pos += 4;
+    if(cells_length < 0) return -1;
+    for (int a0 = 0; a0 < cells_length; a0++) {
+        tlen = geometry_msgs::Point::_skipNoHash(buf, offset + pos, maxlen - pos);
+        if(tlen < 0) return tlen; else pos += tlen;
+    }
+    if(pos > maxlen) return -1;
+    return pos;
+}
+
+template <typename Self, typename Visitor>
+void GridCells::_forEachField(Self &self, Visitor &visitor)
+{
+    visitor(kFields[0], self.cells_length);
+    visitor(kFields[1], self.header);
+    visitor(kFields[2], self.cell_width);
+    visitor(kFields[3], self.cell_height);
+    visitor(kFields[4], self.cells);
+}
+
 uint64_t GridCells::_computeHash(const __lcm_hash_ptr *p)
 {
     const __lcm_hash_ptr *fp;
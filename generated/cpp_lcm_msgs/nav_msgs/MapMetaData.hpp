@@ -1,7 +1,7 @@
 /** THIS IS AN AUTOMATICALLY GENERATED FILE.  DO NOT MODIFY
  * BY HAND!!
  *
- * Generated by lcm-gen 1.5.2
+ * Generated by lcm-cpp (tools/cpp/gen)
  **/
 
 #ifndef __nav_msgs_MapMetaData_hpp__
@@ -9,6 +9,11 @@
 
 #include <lcm/lcm_coretypes.h>
 
+#include <array>
+#include "dimos_lcm/fixed_codec.hpp"
+#include "dimos_lcm/writer.hpp"
+#include "dimos_lcm/fingerprint.hpp"
+#include "dimos_lcm/reflection.hpp"
 #include "std_msgs/Time.hpp"
 #include "geometry_msgs/Pose.hpp"
 
@@ -40,11 +45,26 @@ class MapMetaData
          */
         inline int encode(void *buf, int offset, int maxlen) const;
 
+        /**
+         * Encode a message by appending it to @p buf, walking the message once
+         * instead of sizing it with getEncodedSize() first. @p buf grows
+         * geometrically; reuse it across calls to avoid reallocating.
+         *
+         * @return The number of bytes appended.
+         */
+        inline int encodeTo(std::vector<uint8_t> &buf) const;
+
         /**
          * Check how many bytes are required to encode this message.
          */
         inline int getEncodedSize() const;
 
+        /**
+         * getEncodedSize() of every instance: the type has no strings or
+         * variable-length arrays.
+         */
+        static constexpr int kEncodedSize = 84;
+
         /**
          * Decode a message from binary form into this instance.
          *
@@ -63,18 +83,52 @@ class MapMetaData
          */
         inline static int64_t getHash();
 
+        /**
+         * The fingerprint returned by getHash(), as a compile-time constant.
+         */
+        static constexpr int64_t kHash = static_cast<int64_t>(0x25ace38661e74534ULL);
+
         /**
          * Returns "MapMetaData"
          */
         inline static const char* getTypeName();
 
+        /**
+         * Name, LCM type and array dimensions of each field, in wire order.
+         * See dimos_lcm::for_each_field() for visiting the fields themselves.
+         */
+        static constexpr std::array<dimos_lcm::field_info, 5> kFields = {{
+            { "map_load_time", "std_msgs.Time", false, 0, 0, NULL },
+            { "resolution", "float", true, 0, 0, NULL },
+            { "width", "int32_t", true, 0, 0, NULL },
+            { "height", "int32_t", true, 0, 0, NULL },
+            { "origin", "geometry_msgs.Pose", false, 0, 0, NULL },
+        }};
+
         // LCM support functions. Users should not call these
         inline int _encodeNoHash(void *buf, int offset, int maxlen) const;
+        template <typename Writer>
+        inline void _writeNoHash(Writer &out) const;
         inline int _getEncodedSizeNoHash() const;
         inline int _decodeNoHash(const void *buf, int offset, int maxlen);
+        template <typename Self, typename Visitor>
+        inline static void _forEachField(Self &self, Visitor &visitor);
+        inline static int _skipNoHash(const void *buf, int offset, int maxlen);
         inline static uint64_t _computeHash(const __lcm_hash_ptr *p);
 };
 
+static_assert(MapMetaData::kHash == dimos_lcm::fingerprint(
+    dimos_lcm::signature_hash()
+        .member("map_load_time", NULL, 0)
+        .member("resolution", "float", 0)
+        .member("width", "int32_t", 0)
+        .member("height", "int32_t", 0)
+        .member("origin", NULL, 0)
+        .value(),
+    std_msgs::Time::kHash,
+    geometry_msgs::Pose::kHash),
+    "nav_msgs::MapMetaData fingerprint does not match its definition");
+
 int MapMetaData::encode(void *buf, int offset, int maxlen) const
 {
     int pos = 0, tlen;
@@ -89,6 +143,15 @@ int MapMetaData::encode(void *buf, int offset, int maxlen) const
     return pos;
 }
 
+int MapMetaData::encodeTo(std::vector<uint8_t> &buf) const
+{
+    dimos_lcm::vector_writer out(buf);
+    int64_t hash = getHash();
+    out.put(&hash, 1);
+    this->_writeNoHash(out);
+    return static_cast<int>(out.size());
+}
+
 int MapMetaData::decode(const void *buf, int offset, int maxlen)
 {
     int pos = 0, thislen;
@@ -111,8 +174,7 @@ int MapMetaData::getEncodedSize() const
 
 int64_t MapMetaData::getHash()
 {
-    static int64_t hash = static_cast<int64_t>(_computeHash(NULL));
-    return hash;
+    return kHash;
 }
 
 const char* MapMetaData::getTypeName()
@@ -122,57 +184,66 @@ const char* MapMetaData::getTypeName()
 
 int MapMetaData::_encodeNoHash(void *buf, int offset, int maxlen) const
 {
-    int pos = 0, tlen;
-
-    tlen = this->map_load_time._encodeNoHash(buf, offset + pos, maxlen - pos);
-    if(tlen < 0) return tlen; else pos += tlen;
-
-    tlen = __float_encode_array(buf, offset + pos, maxlen - pos, &this->resolution, 1);
-    if(tlen < 0) return tlen; else pos += tlen;
-
-    tlen = __int32_t_encode_array(buf, offset + pos, maxlen - pos, &this->width, 1);
-    if(tlen < 0) return tlen; else pos += tlen;
-
-    tlen = __int32_t_encode_array(buf, offset + pos, maxlen - pos, &this->height, 1);
-    if(tlen < 0) return tlen; else pos += tlen;
-
-    tlen = this->origin._encodeNoHash(buf, offset + pos, maxlen - pos);
-    if(tlen < 0) return tlen; else pos += tlen;
+    if(maxlen < kEncodedSize - 8) return -1;
+    uint8_t *p = static_cast<uint8_t*>(buf) + offset;
+    dimos_lcm::store_be(p + 0, this->map_load_time.sec);
+    dimos_lcm::store_be(p + 4, this->map_load_time.nsec);
+    dimos_lcm::store_be(p + 8, this->resolution);
+    dimos_lcm::store_be(p + 12, this->width);
+    dimos_lcm::store_be(p + 16, this->height);
+    dimos_lcm::store_be(p + 20, this->origin.position.x);
+    dimos_lcm::store_be(p + 28, this->origin.position.y);
+    dimos_lcm::store_be(p + 36, this->origin.position.z);
+    dimos_lcm::store_be(p + 44, this->origin.orientation.x);
+    dimos_lcm::store_be(p + 52, this->origin.orientation.y);
+    dimos_lcm::store_be(p + 60, this->origin.orientation.z);
+    dimos_lcm::store_be(p + 68, this->origin.orientation.w);
+    return kEncodedSize - 8;
+}
 
-    return pos;
+template <typename Writer>
+void MapMetaData::_writeNoHash(Writer &out) const
+{
+    out.putStruct(*this);
 }
 
 int MapMetaData::_decodeNoHash(const void *buf, int offset, int maxlen)
 {
-    int pos = 0, tlen;
-
-    tlen = this->map_load_time._decodeNoHash(buf, offset + pos, maxlen - pos);
-    if(tlen < 0) return tlen; else pos += tlen;
-
-    tlen = __float_decode_array(buf, offset + pos, maxlen - pos, &this->resolution, 1);
-    if(tlen < 0) return tlen; else pos += tlen;
-
-    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &this->width, 1);
-    if(tlen < 0) return tlen; else pos += tlen;
-
-    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &this->height, 1);
-    if(tlen < 0) return tlen; else pos += tlen;
+    if(maxlen < kEncodedSize - 8) return -1;
+    const uint8_t *p = static_cast<const uint8_t*>(buf) + offset;
+    dimos_lcm::load_be(p + 0, this->map_load_time.sec);
+    dimos_lcm::load_be(p + 4, this->map_load_time.nsec);
+    dimos_lcm::load_be(p + 8, this->resolution);
+    dimos_lcm::load_be(p + 12, this->width);
+    dimos_lcm::load_be(p + 16, this->height);
+    dimos_lcm::load_be(p + 20, this->origin.position.x);
+    dimos_lcm::load_be(p + 28, this->origin.position.y);
+    dimos_lcm::load_be(p + 36, this->origin.position.z);
+    dimos_lcm::load_be(p + 44, this->origin.orientation.x);
+    dimos_lcm::load_be(p + 52, this->origin.orientation.y);
+    dimos_lcm::load_be(p + 60, this->origin.orientation.z);
+    dimos_lcm::load_be(p + 68, this->origin.orientation.w);
+    return kEncodedSize - 8;
+}
 
-    tlen = this->origin._decodeNoHash(buf, offset + pos, maxlen - pos);
-    if(tlen < 0) return tlen; else pos += tlen;
+int MapMetaData::_getEncodedSizeNoHash() const
+{
+    return kEncodedSize - 8;
+}
 
-    return pos;
+int MapMetaData::_skipNoHash(const void *, int, int maxlen)
+{
+    return maxlen < kEncodedSize - 8 ? -1 : kEncodedSize - 8;
 }
 
-int MapMetaData::_getEncodedSizeNoHash() const
+template <typename Self, typename Visitor>
+void MapMetaData::_forEachField(Self &self, Visitor &visitor)
 {
-    int enc_size = 0;
-    enc_size += this->map_load_time._getEncodedSizeNoHash();
-    enc_size += __float_encoded_array_size(NULL, 1);
-    enc_size += __int32_t_encoded_array_size(NULL, 1);
-    enc_size += __int32_t_encoded_array_size(NULL, 1);
-    enc_size += this->origin._getEncodedSizeNoHash();
-    return enc_size;
+    visitor(kFields[0], self.map_load_time);
+    visitor(kFields[1], self.resolution);
+    visitor(kFields[2], self.width);
+    visitor(kFields[3], self.height);
+    visitor(kFields[4], self.origin);
 }
 
 uint64_t MapMetaData::_computeHash(const __lcm_hash_ptr *p)
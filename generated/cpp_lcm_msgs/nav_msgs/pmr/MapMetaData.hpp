@@ -0,0 +1,23 @@
+/** THIS IS AN AUTOMATICALLY GENERATED FILE.  DO NOT MODIFY
+ * BY HAND!!
+ *
+ * Generated by lcm-cpp (tools/cpp/gen)
+ **/
+
+#ifndef __nav_msgs_pmr_MapMetaData_hpp__
+#define __nav_msgs_pmr_MapMetaData_hpp__
+
+#include "nav_msgs/MapMetaData.hpp"
+
+namespace nav_msgs
+{
+namespace pmr
+{
+
+// MapMetaData has no strings or variable-length arrays, so it never allocates
+typedef nav_msgs::MapMetaData MapMetaData;
+
+}
+}
+
+#endif
@@ -1,7 +1,7 @@
 /** THIS IS AN AUTOMATICALLY GENERATED FILE.  DO NOT MODIFY
  * BY HAND!!
  *
- * Generated by lcm-gen 1.5.2
+ * Generated by lcm-cpp (tools/cpp/gen)
  **/
 
 #ifndef __sensor_msgs_CameraInfo_hpp__
@@ -9,10 +9,18 @@
 
 #include <lcm/lcm_coretypes.h>
 
+#include <array>
 #include <string>
 #include <vector>
+#include "dimos_lcm/bulk_codec.hpp"
+#include "dimos_lcm/writer.hpp"
+#include "dimos_lcm/fingerprint.hpp"
+#include "dimos_lcm/reflection.hpp"
 #include "std_msgs/Header.hpp"
 #include "sensor_msgs/RegionOfInterest.hpp"
+#if __cplusplus >= 201703L
+#include "std_msgs/HeaderView.hpp"
+#endif
 
 namespace sensor_msgs
 {
@@ -68,6 +76,15 @@ class CameraInfo
          */
         inline int encode(void *buf, int offset, int maxlen) const;
 
+        /**
+         * Encode a message by appending it to @p buf, walking the message once
+         * instead of sizing it with getEncodedSize() first. @p buf grows
+         * geometrically; reuse it across calls to avoid reallocating.
+         *
+         * @return The number of bytes appended.
+         */
+        inline int encodeTo(std::vector<uint8_t> &buf) const;
+
         /**
          * Check how many bytes are required to encode this message.
          */
@@ -83,6 +100,69 @@ class CameraInfo
          */
         inline int decode(const void *buf, int offset, int maxlen);
 
+#if __cplusplus >= 201703L
+        /**
+         * Decode only the header field of an encoded message, leaving the
+         * rest of it untouched. The field sits at a fixed offset, so this costs
+         * the same for any payload size. The view points into @p buf.
+         *
+         * @param buf The buffer containing the encoded message.
+         * @param offset The byte offset into @p buf where the encoded message starts.
+         * @param maxlen The maximum number of bytes to read while decoding.
+         * @param header Receives the decoded header.
+         * @return The number of bytes of the field decoded, or <0 if @p buf does
+         *  not hold a CameraInfo or is truncated.
+         *
+         * Needs C++17, for the std::string_view of the view.
+         */
+        inline static int peekHeader(const void *buf, int offset, int maxlen, std_msgs::HeaderView &header);
+#endif
+
+        /**
+         * Field bits for decodeFields().
+         */
+        struct Fields
+        {
+            static constexpr uint64_t D_length = 1ULL << 0;
+            static constexpr uint64_t header = 1ULL << 1;
+            static constexpr uint64_t height = 1ULL << 2;
+            static constexpr uint64_t width = 1ULL << 3;
+            static constexpr uint64_t distortion_model = 1ULL << 4;
+            static constexpr uint64_t D = 1ULL << 5;
+            static constexpr uint64_t K = 1ULL << 6;
+            static constexpr uint64_t R = 1ULL << 7;
+            static constexpr uint64_t P = 1ULL << 8;
+            static constexpr uint64_t binning_x = 1ULL << 9;
+            static constexpr uint64_t binning_y = 1ULL << 10;
+            static constexpr uint64_t roi = 1ULL << 11;
+            static constexpr uint64_t all = (1ULL << 12) - 1;
+        };
+
+        /**
+         * Decode only the fields selected by @p Mask, a bitwise or of Fields
+         * values. Strings, arrays and nested structs that are not selected are
+         * skipped over by their length prefixes without being allocated, and
+         * keep their previous value. Scalar fields are always decoded: they
+         * cost nothing to read and array lengths depend on them.
+         *
+         * @return The number of bytes decoded, or <0 if an error occured.
+         */
+        template <uint64_t Mask>
+        inline int decodeFields(const void *buf, int offset, int maxlen);
+
+        /**
+         * Upper bound on the length of every variable-length array of this
+         * type, checked by decode() before anything is allocated; messages
+         * exceeding it fail to decode. It does not apply to nested types,
+         * which have their own. Set it once at startup, before decoding.
+         * Before C++17 it is a constant with no limit.
+         */
+#if __cplusplus >= 201703L
+        static inline int32_t maxArrayLength = INT32_MAX;
+#else
+        static constexpr int32_t maxArrayLength = INT32_MAX;
+#endif
+
         /**
          * Retrieve the 64-bit fingerprint identifying the structure of the message.
          * Note that the fingerprint is the same for all instances of the same
@@ -91,18 +171,68 @@ class CameraInfo
          */
         inline static int64_t getHash();
 
+        /**
+         * The fingerprint returned by getHash(), as a compile-time constant.
+         */
+        static constexpr int64_t kHash = static_cast<int64_t>(0xafb501b00707a02aULL);
+
         /**
          * Returns "CameraInfo"
          */
         inline static const char* getTypeName();
 
+        /**
+         * Name, LCM type and array dimensions of each field, in wire order.
+         * See dimos_lcm::for_each_field() for visiting the fields themselves.
+         */
+        static constexpr std::array<dimos_lcm::field_info, 12> kFields = {{
+            { "D_length", "int32_t", true, 0, 0, NULL },
+            { "header", "std_msgs.Header", false, 0, 0, NULL },
+            { "height", "int32_t", true, 0, 0, NULL },
+            { "width", "int32_t", true, 0, 0, NULL },
+            { "distortion_model", "string", true, 0, 0, NULL },
+            { "D", "double", true, 1, -1, "D_length" },
+            { "K", "double", true, 1, 9, NULL },
+            { "R", "double", true, 1, 9, NULL },
+            { "P", "double", true, 1, 12, NULL },
+            { "binning_x", "int32_t", true, 0, 0, NULL },
+            { "binning_y", "int32_t", true, 0, 0, NULL },
+            { "roi", "sensor_msgs.RegionOfInterest", false, 0, 0, NULL },
+        }};
+
         // LCM support functions. Users should not call these
         inline int _encodeNoHash(void *buf, int offset, int maxlen) const;
+        template <typename Writer>
+        inline void _writeNoHash(Writer &out) const;
         inline int _getEncodedSizeNoHash() const;
         inline int _decodeNoHash(const void *buf, int offset, int maxlen);
+        template <uint64_t Mask>
+        inline int _decodeFieldsNoHash(const void *buf, int offset, int maxlen);
+        template <typename Self, typename Visitor>
+        inline static void _forEachField(Self &self, Visitor &visitor);
+        inline static int _skipNoHash(const void *buf, int offset, int maxlen);
         inline static uint64_t _computeHash(const __lcm_hash_ptr *p);
 };
 
+static_assert(CameraInfo::kHash == dimos_lcm::fingerprint(
+    dimos_lcm::signature_hash()
+        .member("D_length", "int32_t", 0)
+        .member("header", NULL, 0)
+        .member("height", "int32_t", 0)
+        .member("width", "int32_t", 0)
+        .member("distortion_model", "string", 0)
+        .member("D", "double", 1).dim(true, "D_length")
+        .member("K", "double", 1).dim(false, "9")
+        .member("R", "double", 1).dim(false, "9")
+        .member("P", "double", 1).dim(false, "12")
+        .member("binning_x", "int32_t", 0)
+        .member("binning_y", "int32_t", 0)
+        .member("roi", NULL, 0)
+        .value(),
+    std_msgs::Header::kHash,
+    sensor_msgs::RegionOfInterest::kHash),
+    "sensor_msgs::CameraInfo fingerprint does not match its definition");
+
 int CameraInfo::encode(void *buf, int offset, int maxlen) const
 {
     int pos = 0, tlen;
@@ -117,6 +247,15 @@ int CameraInfo::encode(void *buf, int offset, int maxlen) const
     return pos;
 }
 
+int CameraInfo::encodeTo(std::vector<uint8_t> &buf) const
+{
+    dimos_lcm::vector_writer out(buf);
+    int64_t hash = getHash();
+    out.put(&hash, 1);
+    this->_writeNoHash(out);
+    return static_cast<int>(out.size());
+}
+
 int CameraInfo::decode(const void *buf, int offset, int maxlen)
 {
     int pos = 0, thislen;
@@ -132,6 +271,34 @@ int CameraInfo::decode(const void *buf, int offset, int maxlen)
     return pos;
 }
 
+#if __cplusplus >= 201703L
+int CameraInfo::peekHeader(const void *buf, int offset, int maxlen, std_msgs::HeaderView &header)
+{
+    int64_t msg_hash;
+    if (__int64_t_decode_array(buf, offset, maxlen, &msg_hash, 1) < 0) return -1;
+    if (msg_hash != kHash) return -1;
+
+    // header follows the hash and 4 bytes of fixed-size fields
+    return header._decodeNoHash(buf, offset + 12, maxlen - 12);
+}
+#endif
+
+template <uint64_t Mask>
+int CameraInfo::decodeFields(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, thislen;
+
+    int64_t msg_hash;
+    thislen = __int64_t_decode_array(buf, offset + pos, maxlen - pos, &msg_hash, 1);
+    if (thislen < 0) return thislen; else pos += thislen;
+    if (msg_hash != getHash()) return -1;
+
+    thislen = this->_decodeFieldsNoHash<Mask>(buf, offset + pos, maxlen - pos);
+    if (thislen < 0) return thislen; else pos += thislen;
+
+    return pos;
+}
+
 int CameraInfo::getEncodedSize() const
 {
     return 8 + _getEncodedSizeNoHash();
@@ -139,8 +306,7 @@ int CameraInfo::getEncodedSize() const
 
 int64_t CameraInfo::getHash()
 {
-    static int64_t hash = static_cast<int64_t>(_computeHash(NULL));
-    return hash;
+    return kHash;
 }
 
 const char* CameraInfo::getTypeName()
@@ -170,17 +336,17 @@ int CameraInfo::_encodeNoHash(void *buf, int offset, int maxlen) const
     if(tlen < 0) return tlen; else pos += tlen;
 
     if(this->D_length > 0) {
-        tlen = __double_encode_array(buf, offset + pos, maxlen - pos, &this->D[0], this->D_length);
+        tlen = dimos_lcm::bulk_encode_array(buf, offset + pos, maxlen - pos, &this->D[0], this->D_length);
         if(tlen < 0) return tlen; else pos += tlen;
     }
 
-    tlen = __double_encode_array(buf, offset + pos, maxlen - pos, &this->K[0], 9);
+    tlen = dimos_lcm::bulk_encode_array(buf, offset + pos, maxlen - pos, &this->K[0], 9);
     if(tlen < 0) return tlen; else pos += tlen;
 
-    tlen = __double_encode_array(buf, offset + pos, maxlen - pos, &this->R[0], 9);
+    tlen = dimos_lcm::bulk_encode_array(buf, offset + pos, maxlen - pos, &this->R[0], 9);
     if(tlen < 0) return tlen; else pos += tlen;
 
-    tlen = __double_encode_array(buf, offset + pos, maxlen - pos, &this->P[0], 12);
+    tlen = dimos_lcm::bulk_encode_array(buf, offset + pos, maxlen - pos, &this->P[0], 12);
     if(tlen < 0) return tlen; else pos += tlen;
 
     tlen = __int32_t_encode_array(buf, offset + pos, maxlen - pos, &this->binning_x, 1);
@@ -195,6 +361,24 @@ int CameraInfo::_encodeNoHash(void *buf, int offset, int maxlen) const
     return pos;
 }
 
+template <typename Writer>
+void CameraInfo::_writeNoHash(Writer &out) const
+{
+    out.put(&this->D_length, 1);
+    this->header._writeNoHash(out);
+    out.put(&this->height, 1);
+    out.put(&this->width, 1);
+    out.put(this->distortion_model);
+    if(this->D_length > 0)
+        out.put(&this->D[0], this->D_length);
+    out.put(&this->K[0], 9);
+    out.put(&this->R[0], 9);
+    out.put(&this->P[0], 12);
+    out.put(&this->binning_x, 1);
+    out.put(&this->binning_y, 1);
+    this->roi._writeNoHash(out);
+}
+
 int CameraInfo::_decodeNoHash(const void *buf, int offset, int maxlen)
 {
     int pos = 0, tlen;
@@ -215,24 +399,27 @@ int CameraInfo::_decodeNoHash(const void *buf, int offset, int maxlen)
     tlen = __int32_t_decode_array(
         buf, offset + pos, maxlen - pos, &__distortion_model_len__, 1);
     if(tlen < 0) return tlen; else pos += tlen;
-    if(__distortion_model_len__ > maxlen - pos) return -1;
+    if(__distortion_model_len__ < 1 || __distortion_model_len__ > maxlen - pos) return -1;
     this->distortion_model.assign(
         static_cast<const char*>(buf) + offset + pos, __distortion_model_len__ - 1);
     pos += __distortion_model_len__;
 
     if(this->D_length) {
+        if(this->D_length < 0 || this->D_length > (maxlen - pos) / 8 || this->D_length > maxArrayLength) return -1;
         this->D.resize(this->D_length);
-        tlen = __double_decode_array(buf, offset + pos, maxlen - pos, &this->D[0], this->D_length);
+        tlen = dimos_lcm::bulk_decode_array(buf, offset + pos, maxlen - pos, &this->D[0], this->D_length);
         if(tlen < 0) return tlen; else pos += tlen;
+    } else {
+        this->D.clear();
     }
 
-    tlen = __double_decode_array(buf, offset + pos, maxlen - pos, &this->K[0], 9);
+    tlen = dimos_lcm::bulk_decode_array(buf, offset + pos, maxlen - pos, &this->K[0], 9);
     if(tlen < 0) return tlen; else pos += tlen;
 
-    tlen = __double_decode_array(buf, offset + pos, maxlen - pos, &this->R[0], 9);
+    tlen = dimos_lcm::bulk_decode_array(buf, offset + pos, maxlen - pos, &this->R[0], 9);
     if(tlen < 0) return tlen; else pos += tlen;
 
-    tlen = __double_decode_array(buf, offset + pos, maxlen - pos, &this->P[0], 12);
+    tlen = dimos_lcm::bulk_decode_array(buf, offset + pos, maxlen - pos, &this->P[0], 12);
     if(tlen < 0) return tlen; else pos += tlen;
 
     tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &this->binning_x, 1);
@@ -247,6 +434,97 @@ int CameraInfo::_decodeNoHash(const void *buf, int offset, int maxlen)
     return pos;
 }
 
+template <uint64_t Mask>
+int CameraInfo::_decodeFieldsNoHash(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, tlen;
+
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &this->D_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    if ((Mask & Fields::header) != 0) {
+        tlen = this->header._decodeNoHash(buf, offset + pos, maxlen - pos);
+        if(tlen < 0) return tlen; else pos += tlen;
+    } else {
+        tlen = std_msgs::Header::_skipNoHash(buf, offset + pos, maxlen - pos);
+        if(tlen < 0) return tlen; else pos += tlen;
+    }
+
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &this->height, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &this->width, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    if ((Mask & Fields::distortion_model) != 0) {
+        int32_t __distortion_model_len__;
+        tlen = __int32_t_decode_array(
+            buf, offset + pos, maxlen - pos, &__distortion_model_len__, 1);
+        if(tlen < 0) return tlen; else pos += tlen;
+        if(__distortion_model_len__ < 1 || __distortion_model_len__ > maxlen - pos) return -1;
+        this->distortion_model.assign(
+            static_cast<const char*>(buf) + offset + pos, __distortion_model_len__ - 1);
+        pos += __distortion_model_len__;
+    } else {
+        int32_t __distortion_model_len__;
+        tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &__distortion_model_len__, 1);
+        if(tlen < 0) return tlen; else pos += tlen;
+        if(__distortion_model_len__ < 0 || __distortion_model_len__ > maxlen - pos) return -1;
+        pos += __distortion_model_len__;
+    }
+
+    if ((Mask & Fields::D) != 0) {
+        if(this->D_length) {
+            if(this->D_length < 0 || this->D_length > (maxlen - pos) / 8 || this->D_length > maxArrayLength) return -1;
+            this->D.resize(this->D_length);
+            tlen = dimos_lcm::bulk_decode_array(buf, offset + pos, maxlen - pos, &this->D[0], this->D_length);
+            if(tlen < 0) return tlen; else pos += tlen;
+        } else {
+            this->D.clear();
+        }
+    } else {
+        if(this->D_length < 0 || this->D_length > (maxlen - pos) / 8) return -1;
+        pos += this->D_length * 8;
+    }
+
+    if ((Mask & Fields::K) != 0) {
+        tlen = dimos_lcm::bulk_decode_array(buf, offset + pos, maxlen - pos, &this->K[0], 9);
+        if(tlen < 0) return tlen; else pos += tlen;
+    } else {
+        pos += 72;
+    }
+
+    if ((Mask & Fields::R) != 0) {
+        tlen = dimos_lcm::bulk_decode_array(buf, offset + pos, maxlen - pos, &this->R[0], 9);
+        if(tlen < 0) return tlen; else pos += tlen;
+    } else {
+        pos += 72;
+    }
+
+    if ((Mask & Fields::P) != 0) {
+        tlen = dimos_lcm::bulk_decode_array(buf, offset + pos, maxlen - pos, &this->P[0], 12);
+        if(tlen < 0) return tlen; else pos += tlen;
+    } else {
+        pos += 96;
+    }
+
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &this->binning_x, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &this->binning_y, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    if ((Mask & Fields::roi) != 0) {
+        tlen = this->roi._decodeNoHash(buf, offset + pos, maxlen - pos);
+        if(tlen < 0) return tlen; else pos += tlen;
+    } else {
+        tlen = sensor_msgs::RegionOfInterest::_skipNoHash(buf, offset + pos, maxlen - pos);
+        if(tlen < 0) return tlen; else pos += tlen;
+    }
+
+    return pos;
+}
+
 int CameraInfo::_getEncodedSizeNoHash() const
 {
     int enc_size = 0;
@@ -265,6 +543,51 @@ int CameraInfo::_getEncodedSizeNoHash() const
     return enc_size;
 }
 
+int CameraInfo::_skipNoHash(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, tlen;
+    int32_t D_length;
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &D_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+    tlen = std_msgs::Header::_skipNoHash(buf, offset + pos, maxlen - pos);
+    if(tlen < 0) return tlen; else pos += tlen;
+    pos += 4;
+    pos += 4;
+    int32_t __distortion_model_len__;
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &__distortion_model_len__, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+    if(__distortion_model_len__ < 0 || __distortion_model_len__ > maxlen - pos) return -1;
+    pos += __distortion_model_len__;
+    if(D_length < 0 || D_length > (maxlen - pos) / 8) return -1;
+    pos += D_length * 8;
+    pos += 72;
+    pos += 72;
+    pos += 96;
+    pos += 4;
+    pos += 4;
+    tlen = sensor_msgs::RegionOfInterest::_skipNoHash(buf, offset + pos, maxlen - pos);
+    if(tlen < 0) return tlen; else pos += tlen;
+    if(pos > maxlen) return -1;
+    return pos;
+}
+
+template <typename Self, typename Visitor>
+void CameraInfo::_forEachField(Self &self, Visitor &visitor)
+{
+    visitor(kFields[0], self.D_length);
+    visitor(kFields[1], self.header);
+    visitor(kFields[2], self.height);
+    visitor(kFields[3], self.width);
+    visitor(kFields[4], self.distortion_model);
+    visitor(kFields[5], self.D);
+    visitor(kFields[6], self.K);
+    visitor(kFields[7], self.R);
+    visitor(kFields[8], self.P);
+    visitor(kFields[9], self.binning_x);
+    visitor(kFields[10], self.binning_y);
+    visitor(kFields[11], self.roi);
+}
+
 uint64_t CameraInfo::_computeHash(const __lcm_hash_ptr *p)
 {
     const __lcm_hash_ptr *fp;
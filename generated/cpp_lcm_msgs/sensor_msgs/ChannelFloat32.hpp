@@ -1,7 +1,7 @@
 /** THIS IS AN AUTOMATICALLY GENERATED FILE.  DO NOT MODIFY
  * BY HAND!!
  *
- * Generated by lcm-gen 1.5.2
+ * Generated by lcm-cpp (tools/cpp/gen)
  **/
 
 #ifndef __sensor_msgs_ChannelFloat32_hpp__
@@ -9,8 +9,13 @@
 
 #include <lcm/lcm_coretypes.h>
 
+#include <array>
 #include <string>
 #include <vector>
+#include "dimos_lcm/bulk_codec.hpp"
+#include "dimos_lcm/writer.hpp"
+#include "dimos_lcm/fingerprint.hpp"
+#include "dimos_lcm/reflection.hpp"
 
 namespace sensor_msgs
 {
@@ -39,6 +44,15 @@ class ChannelFloat32
          */
         inline int encode(void *buf, int offset, int maxlen) const;
 
+        /**
+         * Encode a message by appending it to @p buf, walking the message once
+         * instead of sizing it with getEncodedSize() first. @p buf grows
+         * geometrically; reuse it across calls to avoid reallocating.
+         *
+         * @return The number of bytes appended.
+         */
+        inline int encodeTo(std::vector<uint8_t> &buf) const;
+
         /**
          * Check how many bytes are required to encode this message.
          */
@@ -54,6 +68,42 @@ class ChannelFloat32
          */
         inline int decode(const void *buf, int offset, int maxlen);
 
+        /**
+         * Field bits for decodeFields().
+         */
+        struct Fields
+        {
+            static constexpr uint64_t values_length = 1ULL << 0;
+            static constexpr uint64_t name = 1ULL << 1;
+            static constexpr uint64_t values = 1ULL << 2;
+            static constexpr uint64_t all = (1ULL << 3) - 1;
+        };
+
+        /**
+         * Decode only the fields selected by @p Mask, a bitwise or of Fields
+         * values. Strings, arrays and nested structs that are not selected are
+         * skipped over by their length prefixes without being allocated, and
+         * keep their previous value. Scalar fields are always decoded: they
+         * cost nothing to read and array lengths depend on them.
+         *
+         * @return The number of bytes decoded, or <0 if an error occured.
+         */
+        template <uint64_t Mask>
+        inline int decodeFields(const void *buf, int offset, int maxlen);
+
+        /**
+         * Upper bound on the length of every variable-length array of this
+         * type, checked by decode() before anything is allocated; messages
+         * exceeding it fail to decode. It does not apply to nested types,
+         * which have their own. Set it once at startup, before decoding.
+         * Before C++17 it is a constant with no limit.
+         */
+#if __cplusplus >= 201703L
+        static inline int32_t maxArrayLength = INT32_MAX;
+#else
+        static constexpr int32_t maxArrayLength = INT32_MAX;
+#endif
+
         /**
          * Retrieve the 64-bit fingerprint identifying the structure of the message.
          * Note that the fingerprint is the same for all instances of the same
@@ -62,18 +112,48 @@ class ChannelFloat32
          */
         inline static int64_t getHash();
 
+        /**
+         * The fingerprint returned by getHash(), as a compile-time constant.
+         */
+        static constexpr int64_t kHash = static_cast<int64_t>(0x197c8912a7d7e0e7ULL);
+
         /**
          * Returns "ChannelFloat32"
          */
         inline static const char* getTypeName();
 
+        /**
+         * Name, LCM type and array dimensions of each field, in wire order.
+         * See dimos_lcm::for_each_field() for visiting the fields themselves.
+         */
+        static constexpr std::array<dimos_lcm::field_info, 3> kFields = {{
+            { "values_length", "int32_t", true, 0, 0, NULL },
+            { "name", "string", true, 0, 0, NULL },
+            { "values", "float", true, 1, -1, "values_length" },
+        }};
+
         // LCM support functions. Users should not call these
         inline int _encodeNoHash(void *buf, int offset, int maxlen) const;
+        template <typename Writer>
+        inline void _writeNoHash(Writer &out) const;
         inline int _getEncodedSizeNoHash() const;
         inline int _decodeNoHash(const void *buf, int offset, int maxlen);
+        template <uint64_t Mask>
+        inline int _decodeFieldsNoHash(const void *buf, int offset, int maxlen);
+        template <typename Self, typename Visitor>
+        inline static void _forEachField(Self &self, Visitor &visitor);
+        inline static int _skipNoHash(const void *buf, int offset, int maxlen);
         inline static uint64_t _computeHash(const __lcm_hash_ptr *p);
 };
 
+static_assert(ChannelFloat32::kHash == dimos_lcm::fingerprint(
+    dimos_lcm::signature_hash()
+        .member("values_length", "int32_t", 0)
+        .member("name", "string", 0)
+        .member("values", "float", 1).dim(true, "values_length")
+        .value()),
+    "sensor_msgs::ChannelFloat32 fingerprint does not match its definition");
+
 int ChannelFloat32::encode(void *buf, int offset, int maxlen) const
 {
     int pos = 0, tlen;
@@ -88,6 +168,15 @@ int ChannelFloat32::encode(void *buf, int offset, int maxlen) const
     return pos;
 }
 
+int ChannelFloat32::encodeTo(std::vector<uint8_t> &buf) const
+{
+    dimos_lcm::vector_writer out(buf);
+    int64_t hash = getHash();
+    out.put(&hash, 1);
+    this->_writeNoHash(out);
+    return static_cast<int>(out.size());
+}
+
 int ChannelFloat32::decode(const void *buf, int offset, int maxlen)
 {
     int pos = 0, thislen;
@@ -103,6 +192,22 @@ int ChannelFloat32::decode(const void *buf, int offset, int maxlen)
     return pos;
 }
 
+template <uint64_t Mask>
+int ChannelFloat32::decodeFields(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, thislen;
+
+    int64_t msg_hash;
+    thislen = __int64_t_decode_array(buf, offset + pos, maxlen - pos, &msg_hash, 1);
+    if (thislen < 0) return thislen; else pos += thislen;
+    if (msg_hash != getHash()) return -1;
+
+    thislen = this->_decodeFieldsNoHash<Mask>(buf, offset + pos, maxlen - pos);
+    if (thislen < 0) return thislen; else pos += thislen;
+
+    return pos;
+}
+
 int ChannelFloat32::getEncodedSize() const
 {
     return 8 + _getEncodedSizeNoHash();
@@ -110,8 +215,7 @@ int ChannelFloat32::getEncodedSize() const
 
 int64_t ChannelFloat32::getHash()
 {
-    static int64_t hash = static_cast<int64_t>(_computeHash(NULL));
-    return hash;
+    return kHash;
 }
 
 const char* ChannelFloat32::getTypeName()
@@ -132,13 +236,22 @@ int ChannelFloat32::_encodeNoHash(void *buf, int offset, int maxlen) const
     if(tlen < 0) return tlen; else pos += tlen;
 
     if(this->values_length > 0) {
-        tlen = __float_encode_array(buf, offset + pos, maxlen - pos, &this->values[0], this->values_length);
+        tlen = dimos_lcm::bulk_encode_array(buf, offset + pos, maxlen - pos, &this->values[0], this->values_length);
         if(tlen < 0) return tlen; else pos += tlen;
     }
 
     return pos;
 }
 
+template <typename Writer>
+void ChannelFloat32::_writeNoHash(Writer &out) const
+{
+    out.put(&this->values_length, 1);
+    out.put(this->name);
+    if(this->values_length > 0)
+        out.put(&this->values[0], this->values_length);
+}
+
 int ChannelFloat32::_decodeNoHash(const void *buf, int offset, int maxlen)
 {
     int pos = 0, tlen;
@@ -150,15 +263,60 @@ int ChannelFloat32::_decodeNoHash(const void *buf, int offset, int maxlen)
     tlen = __int32_t_decode_array(
         buf, offset + pos, maxlen - pos, &__name_len__, 1);
     if(tlen < 0) return tlen; else pos += tlen;
-    if(__name_len__ > maxlen - pos) return -1;
+    if(__name_len__ < 1 || __name_len__ > maxlen - pos) return -1;
     this->name.assign(
         static_cast<const char*>(buf) + offset + pos, __name_len__ - 1);
     pos += __name_len__;
 
     if(this->values_length) {
+        if(this->values_length < 0 || this->values_length > (maxlen - pos) / 4 || this->values_length > maxArrayLength) return -1;
         this->values.resize(this->values_length);
-        tlen = __float_decode_array(buf, offset + pos, maxlen - pos, &this->values[0], this->values_length);
+        tlen = dimos_lcm::bulk_decode_array(buf, offset + pos, maxlen - pos, &this->values[0], this->values_length);
         if(tlen < 0) return tlen; else pos += tlen;
+    } else {
+        this->values.clear();
+    }
+
+    return pos;
+}
+
+template <uint64_t Mask>
+int ChannelFloat32::_decodeFieldsNoHash(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, tlen;
+
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &this->values_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    if ((Mask & Fields::name) != 0) {
+        int32_t __name_len__;
+        tlen = __int32_t_decode_array(
+            buf, offset + pos, maxlen - pos, &__name_len__, 1);
+        if(tlen < 0) return tlen; else pos += tlen;
+        if(__name_len__ < 1 || __name_len__ > maxlen - pos) return -1;
+        this->name.assign(
+            static_cast<const char*>(buf) + offset + pos, __name_len__ - 1);
+        pos += __name_len__;
+    } else {
+        int32_t __name_len__;
+        tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &__name_len__, 1);
+        if(tlen < 0) return tlen; else pos += tlen;
+        if(__name_len__ < 0 || __name_len__ > maxlen - pos) return -1;
+        pos += __name_len__;
+    }
+
+    if ((Mask & Fields::values) != 0) {
+        if(this->values_length) {
+            if(this->values_length < 0 || this->values_length > (maxlen - pos) / 4 || this->values_length > maxArrayLength) return -1;
+            this->values.resize(this->values_length);
+            tlen = dimos_lcm::bulk_decode_array(buf, offset + pos, maxlen - pos, &this->values[0], this->values_length);
+            if(tlen < 0) return tlen; else pos += tlen;
+        } else {
+            this->values.clear();
+        }
+    } else {
+        if(this->values_length < 0 || this->values_length > (maxlen - pos) / 4) return -1;
+        pos += this->values_length * 4;
     }
 
     return pos;
@@ -173,6 +331,31 @@ int ChannelFloat32::_getEncodedSizeNoHash() const
     return enc_size;
 }
 
+int ChannelFloat32::_skipNoHash(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, tlen;
+    int32_t values_length;
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &values_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+    int32_t __name_len__;
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &__name_len__, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+    if(__name_len__ < 0 || __name_len__ > maxlen - pos) return -1;
+    pos += __name_len__;
+    if(values_length < 0 || values_length > (maxlen - pos) / 4) return -1;
+    pos += values_length * 4;
+    if(pos > maxlen) return -1;
+    return pos;
+}
+
+template <typename Self, typename Visitor>
+void ChannelFloat32::_forEachField(Self &self, Visitor &visitor)
+{
+    visitor(kFields[0], self.values_length);
+    visitor(kFields[1], self.name);
+    visitor(kFields[2], self.values);
+}
+
 uint64_t ChannelFloat32::_computeHash(const __lcm_hash_ptr *)
 {
     uint64_t hash = 0x8cbe448953ebf073LL;
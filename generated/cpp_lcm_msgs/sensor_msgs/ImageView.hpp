@@ -0,0 +1,158 @@
+/** THIS IS AN AUTOMATICALLY GENERATED FILE.  DO NOT MODIFY
+ * BY HAND!!
+ *
+ * Generated by lcm-cpp (tools/cpp/gen)
+ **/
+
+#ifndef __sensor_msgs_ImageView_hpp__
+#define __sensor_msgs_ImageView_hpp__
+
+#include <lcm/lcm_coretypes.h>
+
+#include <string_view>
+#include "dimos_lcm/view.hpp"
+#include "sensor_msgs/Image.hpp"
+#include "std_msgs/HeaderView.hpp"
+
+namespace sensor_msgs
+{
+
+/**
+ * Zero-copy read-only view of an encoded sensor_msgs.Image.
+ *
+ * Strings and variable-length arrays point into the buffer given to decode(),
+ * which must outlive the view. Decoding validates the whole message once and
+ * never allocates.
+ */
+class ImageView
+{
+    public:
+        int32_t    data_length;
+
+        std_msgs::HeaderView header;
+
+        int32_t    height;
+
+        int32_t    width;
+
+        std::string_view encoding;
+
+        uint8_t    is_bigendian;
+
+        int32_t    step;
+
+        /**
+         * LCM Type: byte[data_length]
+         */
+        dimos_lcm::span< const uint8_t > data;
+
+    public:
+        /**
+         * Decode a view over a message in binary form.
+         *
+         * @param buf The buffer containing the encoded message. It must outlive
+         *  this view.
+         * @param offset The byte offset into @p buf where the encoded message starts.
+         * @param maxlen The maximum number of bytes to read while decoding.
+         * @return The number of bytes decoded, or <0 if an error occured.
+         */
+        inline int decode(const void *buf, int offset, int maxlen);
+
+        /**
+         * Copy the viewed message into an owning Image.
+         */
+        inline void copyTo(Image &msg) const;
+
+        /**
+         * Returns Image::getHash()
+         */
+        inline static int64_t getHash();
+
+        /**
+         * Returns "Image"
+         */
+        inline static const char* getTypeName();
+
+        // LCM support functions. Users should not call these
+        inline int _decodeNoHash(const void *buf, int offset, int maxlen);
+};
+
+int ImageView::decode(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, thislen;
+
+    int64_t msg_hash;
+    thislen = __int64_t_decode_array(buf, offset + pos, maxlen - pos, &msg_hash, 1);
+    if (thislen < 0) return thislen; else pos += thislen;
+    if (msg_hash != getHash()) return -1;
+
+    thislen = this->_decodeNoHash(buf, offset + pos, maxlen - pos);
+    if (thislen < 0) return thislen; else pos += thislen;
+
+    return pos;
+}
+
+void ImageView::copyTo(Image &msg) const
+{
+    msg.data_length = this->data_length;
+    this->header.copyTo(msg.header);
+    msg.height = this->height;
+    msg.width = this->width;
+    msg.encoding.assign(this->encoding.data(), this->encoding.size());
+    msg.is_bigendian = this->is_bigendian;
+    msg.step = this->step;
+    msg.data.assign(this->data.begin(), this->data.end());
+}
+
+int64_t ImageView::getHash()
+{
+    return Image::getHash();
+}
+
+const char* ImageView::getTypeName()
+{
+    return "Image";
+}
+
+int ImageView::_decodeNoHash(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, tlen;
+
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &this->data_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = this->header._decodeNoHash(buf, offset + pos, maxlen - pos);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &this->height, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &this->width, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    int32_t __encoding_len__;
+    tlen = __int32_t_decode_array(
+        buf, offset + pos, maxlen - pos, &__encoding_len__, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+    if(__encoding_len__ < 1 || __encoding_len__ > maxlen - pos) return -1;
+    this->encoding = std::string_view(
+        static_cast<const char*>(buf) + offset + pos, __encoding_len__ - 1);
+    pos += __encoding_len__;
+
+    tlen = __byte_decode_array(buf, offset + pos, maxlen - pos, &this->is_bigendian, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &this->step, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    if(this->data_length < 0 || this->data_length > maxlen - pos) return -1;
+    this->data = dimos_lcm::span< const uint8_t >(
+        static_cast<const uint8_t*>(buf) + offset + pos, this->data_length);
+    pos += this->data_length;
+
+    return pos;
+}
+
+}
+
+#endif
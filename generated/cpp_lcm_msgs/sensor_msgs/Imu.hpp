@@ -1,7 +1,7 @@
 /** THIS IS AN AUTOMATICALLY GENERATED FILE.  DO NOT MODIFY
  * BY HAND!!
  *
- * Generated by lcm-gen 1.5.2
+ * Generated by lcm-cpp (tools/cpp/gen)
  **/
 
 #ifndef __sensor_msgs_Imu_hpp__
@@ -9,10 +9,17 @@
 
 #include <lcm/lcm_coretypes.h>
 
+#include <array>
+#include "dimos_lcm/bulk_codec.hpp"
+#include "dimos_lcm/writer.hpp"
+#include "dimos_lcm/fingerprint.hpp"
+#include "dimos_lcm/reflection.hpp"
 #include "std_msgs/Header.hpp"
 #include "geometry_msgs/Quaternion.hpp"
 #include "geometry_msgs/Vector3.hpp"
-#include "geometry_msgs/Vector3.hpp"
+#if __cplusplus >= 201703L
+#include "std_msgs/HeaderView.hpp"
+#endif
 
 namespace sensor_msgs
 {
@@ -55,6 +62,15 @@ class Imu
          */
         inline int encode(void *buf, int offset, int maxlen) const;
 
+        /**
+         * Encode a message by appending it to @p buf, walking the message once
+         * instead of sizing it with getEncodedSize() first. @p buf grows
+         * geometrically; reuse it across calls to avoid reallocating.
+         *
+         * @return The number of bytes appended.
+         */
+        inline int encodeTo(std::vector<uint8_t> &buf) const;
+
         /**
          * Check how many bytes are required to encode this message.
          */
@@ -70,6 +86,51 @@ class Imu
          */
         inline int decode(const void *buf, int offset, int maxlen);
 
+#if __cplusplus >= 201703L
+        /**
+         * Decode only the header field of an encoded message, leaving the
+         * rest of it untouched. The field sits at a fixed offset, so this costs
+         * the same for any payload size. The view points into @p buf.
+         *
+         * @param buf The buffer containing the encoded message.
+         * @param offset The byte offset into @p buf where the encoded message starts.
+         * @param maxlen The maximum number of bytes to read while decoding.
+         * @param header Receives the decoded header.
+         * @return The number of bytes of the field decoded, or <0 if @p buf does
+         *  not hold a Imu or is truncated.
+         *
+         * Needs C++17, for the std::string_view of the view.
+         */
+        inline static int peekHeader(const void *buf, int offset, int maxlen, std_msgs::HeaderView &header);
+#endif
+
+        /**
+         * Field bits for decodeFields().
+         */
+        struct Fields
+        {
+            static constexpr uint64_t header = 1ULL << 0;
+            static constexpr uint64_t orientation = 1ULL << 1;
+            static constexpr uint64_t orientation_covariance = 1ULL << 2;
+            static constexpr uint64_t angular_velocity = 1ULL << 3;
+            static constexpr uint64_t angular_velocity_covariance = 1ULL << 4;
+            static constexpr uint64_t linear_acceleration = 1ULL << 5;
+            static constexpr uint64_t linear_acceleration_covariance = 1ULL << 6;
+            static constexpr uint64_t all = (1ULL << 7) - 1;
+        };
+
+        /**
+         * Decode only the fields selected by @p Mask, a bitwise or of Fields
+         * values. Strings, arrays and nested structs that are not selected are
+         * skipped over by their length prefixes without being allocated, and
+         * keep their previous value. Scalar fields are always decoded: they
+         * cost nothing to read and array lengths depend on them.
+         *
+         * @return The number of bytes decoded, or <0 if an error occured.
+         */
+        template <uint64_t Mask>
+        inline int decodeFields(const void *buf, int offset, int maxlen);
+
         /**
          * Retrieve the 64-bit fingerprint identifying the structure of the message.
          * Note that the fingerprint is the same for all instances of the same
@@ -78,18 +139,60 @@ class Imu
          */
         inline static int64_t getHash();
 
+        /**
+         * The fingerprint returned by getHash(), as a compile-time constant.
+         */
+        static constexpr int64_t kHash = static_cast<int64_t>(0x31ab205c8dd57aa8ULL);
+
         /**
          * Returns "Imu"
          */
         inline static const char* getTypeName();
 
+        /**
+         * Name, LCM type and array dimensions of each field, in wire order.
+         * See dimos_lcm::for_each_field() for visiting the fields themselves.
+         */
+        static constexpr std::array<dimos_lcm::field_info, 7> kFields = {{
+            { "header", "std_msgs.Header", false, 0, 0, NULL },
+            { "orientation", "geometry_msgs.Quaternion", false, 0, 0, NULL },
+            { "orientation_covariance", "double", true, 1, 9, NULL },
+            { "angular_velocity", "geometry_msgs.Vector3", false, 0, 0, NULL },
+            { "angular_velocity_covariance", "double", true, 1, 9, NULL },
+            { "linear_acceleration", "geometry_msgs.Vector3", false, 0, 0, NULL },
+            { "linear_acceleration_covariance", "double", true, 1, 9, NULL },
+        }};
+
         // LCM support functions. Users should not call these
         inline int _encodeNoHash(void *buf, int offset, int maxlen) const;
+        template <typename Writer>
+        inline void _writeNoHash(Writer &out) const;
         inline int _getEncodedSizeNoHash() const;
         inline int _decodeNoHash(const void *buf, int offset, int maxlen);
+        template <uint64_t Mask>
+        inline int _decodeFieldsNoHash(const void *buf, int offset, int maxlen);
+        template <typename Self, typename Visitor>
+        inline static void _forEachField(Self &self, Visitor &visitor);
+        inline static int _skipNoHash(const void *buf, int offset, int maxlen);
         inline static uint64_t _computeHash(const __lcm_hash_ptr *p);
 };
 
+static_assert(Imu::kHash == dimos_lcm::fingerprint(
+    dimos_lcm::signature_hash()
+        .member("header", NULL, 0)
+        .member("orientation", NULL, 0)
+        .member("orientation_covariance", "double", 1).dim(false, "9")
+        .member("angular_velocity", NULL, 0)
+        .member("angular_velocity_covariance", "double", 1).dim(false, "9")
+        .member("linear_acceleration", NULL, 0)
+        .member("linear_acceleration_covariance", "double", 1).dim(false, "9")
+        .value(),
+    std_msgs::Header::kHash,
+    geometry_msgs::Quaternion::kHash,
+    geometry_msgs::Vector3::kHash,
+    geometry_msgs::Vector3::kHash),
+    "sensor_msgs::Imu fingerprint does not match its definition");
+
 int Imu::encode(void *buf, int offset, int maxlen) const
 {
     int pos = 0, tlen;
@@ -104,6 +207,15 @@ int Imu::encode(void *buf, int offset, int maxlen) const
     return pos;
 }
 
+int Imu::encodeTo(std::vector<uint8_t> &buf) const
+{
+    dimos_lcm::vector_writer out(buf);
+    int64_t hash = getHash();
+    out.put(&hash, 1);
+    this->_writeNoHash(out);
+    return static_cast<int>(out.size());
+}
+
 int Imu::decode(const void *buf, int offset, int maxlen)
 {
     int pos = 0, thislen;
@@ -119,6 +231,34 @@ int Imu::decode(const void *buf, int offset, int maxlen)
     return pos;
 }
 
+#if __cplusplus >= 201703L
+int Imu::peekHeader(const void *buf, int offset, int maxlen, std_msgs::HeaderView &header)
+{
+    int64_t msg_hash;
+    if (__int64_t_decode_array(buf, offset, maxlen, &msg_hash, 1) < 0) return -1;
+    if (msg_hash != kHash) return -1;
+
+    // header follows the hash and 0 bytes of fixed-size fields
+    return header._decodeNoHash(buf, offset + 8, maxlen - 8);
+}
+#endif
+
+template <uint64_t Mask>
+int Imu::decodeFields(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, thislen;
+
+    int64_t msg_hash;
+    thislen = __int64_t_decode_array(buf, offset + pos, maxlen - pos, &msg_hash, 1);
+    if (thislen < 0) return thislen; else pos += thislen;
+    if (msg_hash != getHash()) return -1;
+
+    thislen = this->_decodeFieldsNoHash<Mask>(buf, offset + pos, maxlen - pos);
+    if (thislen < 0) return thislen; else pos += thislen;
+
+    return pos;
+}
+
 int Imu::getEncodedSize() const
 {
     return 8 + _getEncodedSizeNoHash();
@@ -126,8 +266,7 @@ int Imu::getEncodedSize() const
 
 int64_t Imu::getHash()
 {
-    static int64_t hash = static_cast<int64_t>(_computeHash(NULL));
-    return hash;
+    return kHash;
 }
 
 const char* Imu::getTypeName()
@@ -145,24 +284,36 @@ int Imu::_encodeNoHash(void *buf, int offset, int maxlen) const
     tlen = this->orientation._encodeNoHash(buf, offset + pos, maxlen - pos);
     if(tlen < 0) return tlen; else pos += tlen;
 
-    tlen = __double_encode_array(buf, offset + pos, maxlen - pos, &this->orientation_covariance[0], 9);
+    tlen = dimos_lcm::bulk_encode_array(buf, offset + pos, maxlen - pos, &this->orientation_covariance[0], 9);
     if(tlen < 0) return tlen; else pos += tlen;
 
     tlen = this->angular_velocity._encodeNoHash(buf, offset + pos, maxlen - pos);
     if(tlen < 0) return tlen; else pos += tlen;
 
-    tlen = __double_encode_array(buf, offset + pos, maxlen - pos, &this->angular_velocity_covariance[0], 9);
+    tlen = dimos_lcm::bulk_encode_array(buf, offset + pos, maxlen - pos, &this->angular_velocity_covariance[0], 9);
     if(tlen < 0) return tlen; else pos += tlen;
 
     tlen = this->linear_acceleration._encodeNoHash(buf, offset + pos, maxlen - pos);
     if(tlen < 0) return tlen; else pos += tlen;
 
-    tlen = __double_encode_array(buf, offset + pos, maxlen - pos, &this->linear_acceleration_covariance[0], 9);
+    tlen = dimos_lcm::bulk_encode_array(buf, offset + pos, maxlen - pos, &this->linear_acceleration_covariance[0], 9);
     if(tlen < 0) return tlen; else pos += tlen;
 
     return pos;
 }
 
+template <typename Writer>
+void Imu::_writeNoHash(Writer &out) const
+{
+    this->header._writeNoHash(out);
+    this->orientation._writeNoHash(out);
+    out.put(&this->orientation_covariance[0], 9);
+    this->angular_velocity._writeNoHash(out);
+    out.put(&this->angular_velocity_covariance[0], 9);
+    this->linear_acceleration._writeNoHash(out);
+    out.put(&this->linear_acceleration_covariance[0], 9);
+}
+
 int Imu::_decodeNoHash(const void *buf, int offset, int maxlen)
 {
     int pos = 0, tlen;
@@ -173,24 +324,85 @@ int Imu::_decodeNoHash(const void *buf, int offset, int maxlen)
     tlen = this->orientation._decodeNoHash(buf, offset + pos, maxlen - pos);
     if(tlen < 0) return tlen; else pos += tlen;
 
-    tlen = __double_decode_array(buf, offset + pos, maxlen - pos, &this->orientation_covariance[0], 9);
+    tlen = dimos_lcm::bulk_decode_array(buf, offset + pos, maxlen - pos, &this->orientation_covariance[0], 9);
     if(tlen < 0) return tlen; else pos += tlen;
 
     tlen = this->angular_velocity._decodeNoHash(buf, offset + pos, maxlen - pos);
     if(tlen < 0) return tlen; else pos += tlen;
 
-    tlen = __double_decode_array(buf, offset + pos, maxlen - pos, &this->angular_velocity_covariance[0], 9);
+    tlen = dimos_lcm::bulk_decode_array(buf, offset + pos, maxlen - pos, &this->angular_velocity_covariance[0], 9);
     if(tlen < 0) return tlen; else pos += tlen;
 
     tlen = this->linear_acceleration._decodeNoHash(buf, offset + pos, maxlen - pos);
     if(tlen < 0) return tlen; else pos += tlen;
 
-    tlen = __double_decode_array(buf, offset + pos, maxlen - pos, &this->linear_acceleration_covariance[0], 9);
+    tlen = dimos_lcm::bulk_decode_array(buf, offset + pos, maxlen - pos, &this->linear_acceleration_covariance[0], 9);
     if(tlen < 0) return tlen; else pos += tlen;
 
     return pos;
 }
 
+template <uint64_t Mask>
+int Imu::_decodeFieldsNoHash(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, tlen;
+
+    if ((Mask & Fields::header) != 0) {
+        tlen = this->header._decodeNoHash(buf, offset + pos, maxlen - pos);
+        if(tlen < 0) return tlen; else pos += tlen;
+    } else {
+        tlen = std_msgs::Header::_skipNoHash(buf, offset + pos, maxlen - pos);
+        if(tlen < 0) return tlen; else pos += tlen;
+    }
+
+    if ((Mask & Fields::orientation) != 0) {
+        tlen = this->orientation._decodeNoHash(buf, offset + pos, maxlen - pos);
+        if(tlen < 0) return tlen; else pos += tlen;
+    } else {
+        tlen = geometry_msgs::Quaternion::_skipNoHash(buf, offset + pos, maxlen - pos);
+        if(tlen < 0) return tlen; else pos += tlen;
+    }
+
+    if ((Mask & Fields::orientation_covariance) != 0) {
+        tlen = dimos_lcm::bulk_decode_array(buf, offset + pos, maxlen - pos, &this->orientation_covariance[0], 9);
+        if(tlen < 0) return tlen; else pos += tlen;
+    } else {
+        pos += 72;
+    }
+
+    if ((Mask & Fields::angular_velocity) != 0) {
+        tlen = this->angular_velocity._decodeNoHash(buf, offset + pos, maxlen - pos);
+        if(tlen < 0) return tlen; else pos += tlen;
+    } else {
+        tlen = geometry_msgs::Vector3::_skipNoHash(buf, offset + pos, maxlen - pos);
+        if(tlen < 0) return tlen; else pos += tlen;
+    }
+
+    if ((Mask & Fields::angular_velocity_covariance) != 0) {
+        tlen = dimos_lcm::bulk_decode_array(buf, offset + pos, maxlen - pos, &this->angular_velocity_covariance[0], 9);
+        if(tlen < 0) return tlen; else pos += tlen;
+    } else {
+        pos += 72;
+    }
+
+    if ((Mask & Fields::linear_acceleration) != 0) {
+        tlen = this->linear_acceleration._decodeNoHash(buf, offset + pos, maxlen - pos);
+        if(tlen < 0) return tlen; else pos += tlen;
+    } else {
+        tlen = geometry_msgs::Vector3::_skipNoHash(buf, offset + pos, maxlen - pos);
+        if(tlen < 0) return tlen; else pos += tlen;
+    }
+
+    if ((Mask & Fields::linear_acceleration_covariance) != 0) {
+        tlen = dimos_lcm::bulk_decode_array(buf, offset + pos, maxlen - pos, &this->linear_acceleration_covariance[0], 9);
+        if(tlen < 0) return tlen; else pos += tlen;
+    } else {
+        pos += 72;
+    }
+
+    return pos;
+}
+
 int Imu::_getEncodedSizeNoHash() const
 {
     int enc_size = 0;
@@ -204,6 +416,36 @@ int Imu::_getEncodedSizeNoHash() const
     return enc_size;
 }
 
+int Imu::_skipNoHash(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, tlen;
+    tlen = std_msgs::Header::_skipNoHash(buf, offset + pos, maxlen - pos);
+    if(tlen < 0) return tlen; else pos += tlen;
+    tlen = geometry_msgs::Quaternion::_skipNoHash(buf, offset + pos, maxlen - pos);
+    if(tlen < 0) return tlen; else pos += tlen;
+    pos += 72;
+    tlen = geometry_msgs::Vector3::_skipNoHash(buf, offset + pos, maxlen - pos);
+    if(tlen < 0) return tlen; else pos += tlen;
+    pos += 72;
+    tlen = geometry_msgs::Vector3::_skipNoHash(buf, offset + pos, maxlen - pos);
+    if(tlen < 0) return tlen; else pos += tlen;
+    pos += 72;
+    if(pos > maxlen) return -1;
+    return pos;
+}
+
+template <typename Self, typename Visitor>
+void Imu::_forEachField(Self &self, Visitor &visitor)
+{
+    visitor(kFields[0], self.header);
+    visitor(kFields[1], self.orientation);
+    visitor(kFields[2], self.orientation_covariance);
+    visitor(kFields[3], self.angular_velocity);
+    visitor(kFields[4], self.angular_velocity_covariance);
+    visitor(kFields[5], self.linear_acceleration);
+    visitor(kFields[6], self.linear_acceleration_covariance);
+}
+
 uint64_t Imu::_computeHash(const __lcm_hash_ptr *p)
 {
     const __lcm_hash_ptr *fp;
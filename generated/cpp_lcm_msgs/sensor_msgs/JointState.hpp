@@ -1,7 +1,7 @@
 /** THIS IS AN AUTOMATICALLY GENERATED FILE.  DO NOT MODIFY
  * BY HAND!!
  *
- * Generated by lcm-gen 1.5.2
+ * Generated by lcm-cpp (tools/cpp/gen)
  **/
 
 #ifndef __sensor_msgs_JointState_hpp__
@@ -9,9 +9,17 @@
 
 #include <lcm/lcm_coretypes.h>
 
+#include <array>
 #include <vector>
 #include <string>
+#include "dimos_lcm/bulk_codec.hpp"
+#include "dimos_lcm/writer.hpp"
+#include "dimos_lcm/fingerprint.hpp"
+#include "dimos_lcm/reflection.hpp"
 #include "std_msgs/Header.hpp"
+#if __cplusplus >= 201703L
+#include "std_msgs/HeaderView.hpp"
+#endif
 
 namespace sensor_msgs
 {
@@ -61,6 +69,15 @@ class JointState
          */
         inline int encode(void *buf, int offset, int maxlen) const;
 
+        /**
+         * Encode a message by appending it to @p buf, walking the message once
+         * instead of sizing it with getEncodedSize() first. @p buf grows
+         * geometrically; reuse it across calls to avoid reallocating.
+         *
+         * @return The number of bytes appended.
+         */
+        inline int encodeTo(std::vector<uint8_t> &buf) const;
+
         /**
          * Check how many bytes are required to encode this message.
          */
@@ -76,6 +93,66 @@ class JointState
          */
         inline int decode(const void *buf, int offset, int maxlen);
 
+#if __cplusplus >= 201703L
+        /**
+         * Decode only the header field of an encoded message, leaving the
+         * rest of it untouched. The field sits at a fixed offset, so this costs
+         * the same for any payload size. The view points into @p buf.
+         *
+         * @param buf The buffer containing the encoded message.
+         * @param offset The byte offset into @p buf where the encoded message starts.
+         * @param maxlen The maximum number of bytes to read while decoding.
+         * @param header Receives the decoded header.
+         * @return The number of bytes of the field decoded, or <0 if @p buf does
+         *  not hold a JointState or is truncated.
+         *
+         * Needs C++17, for the std::string_view of the view.
+         */
+        inline static int peekHeader(const void *buf, int offset, int maxlen, std_msgs::HeaderView &header);
+#endif
+
+        /**
+         * Field bits for decodeFields().
+         */
+        struct Fields
+        {
+            static constexpr uint64_t name_length = 1ULL << 0;
+            static constexpr uint64_t position_length = 1ULL << 1;
+            static constexpr uint64_t velocity_length = 1ULL << 2;
+            static constexpr uint64_t effort_length = 1ULL << 3;
+            static constexpr uint64_t header = 1ULL << 4;
+            static constexpr uint64_t name = 1ULL << 5;
+            static constexpr uint64_t position = 1ULL << 6;
+            static constexpr uint64_t velocity = 1ULL << 7;
+            static constexpr uint64_t effort = 1ULL << 8;
+            static constexpr uint64_t all = (1ULL << 9) - 1;
+        };
+
+        /**
+         * Decode only the fields selected by @p Mask, a bitwise or of Fields
+         * values. Strings, arrays and nested structs that are not selected are
+         * skipped over by their length prefixes without being allocated, and
+         * keep their previous value. Scalar fields are always decoded: they
+         * cost nothing to read and array lengths depend on them.
+         *
+         * @return The number of bytes decoded, or <0 if an error occured.
+         */
+        template <uint64_t Mask>
+        inline int decodeFields(const void *buf, int offset, int maxlen);
+
+        /**
+         * Upper bound on the length of every variable-length array of this
+         * type, checked by decode() before anything is allocated; messages
+         * exceeding it fail to decode. It does not apply to nested types,
+         * which have their own. Set it once at startup, before decoding.
+         * Before C++17 it is a constant with no limit.
+         */
+#if __cplusplus >= 201703L
+        static inline int32_t maxArrayLength = INT32_MAX;
+#else
+        static constexpr int32_t maxArrayLength = INT32_MAX;
+#endif
+
         /**
          * Retrieve the 64-bit fingerprint identifying the structure of the message.
          * Note that the fingerprint is the same for all instances of the same
@@ -84,18 +161,61 @@ class JointState
          */
         inline static int64_t getHash();
 
+        /**
+         * The fingerprint returned by getHash(), as a compile-time constant.
+         */
+        static constexpr int64_t kHash = static_cast<int64_t>(0xccefa8a492b967e3ULL);
+
         /**
          * Returns "JointState"
          */
         inline static const char* getTypeName();
 
+        /**
+         * Name, LCM type and array dimensions of each field, in wire order.
+         * See dimos_lcm::for_each_field() for visiting the fields themselves.
+         */
+        static constexpr std::array<dimos_lcm::field_info, 9> kFields = {{
+            { "name_length", "int32_t", true, 0, 0, NULL },
+            { "position_length", "int32_t", true, 0, 0, NULL },
+            { "velocity_length", "int32_t", true, 0, 0, NULL },
+            { "effort_length", "int32_t", true, 0, 0, NULL },
+            { "header", "std_msgs.Header", false, 0, 0, NULL },
+            { "name", "string", true, 1, -1, "name_length" },
+            { "position", "double", true, 1, -1, "position_length" },
+            { "velocity", "double", true, 1, -1, "velocity_length" },
+            { "effort", "double", true, 1, -1, "effort_length" },
+        }};
+
         // LCM support functions. Users should not call these
         inline int _encodeNoHash(void *buf, int offset, int maxlen) const;
+        template <typename Writer>
+        inline void _writeNoHash(Writer &out) const;
         inline int _getEncodedSizeNoHash() const;
         inline int _decodeNoHash(const void *buf, int offset, int maxlen);
+        template <uint64_t Mask>
+        inline int _decodeFieldsNoHash(const void *buf, int offset, int maxlen);
+        template <typename Self, typename Visitor>
+        inline static void _forEachField(Self &self, Visitor &visitor);
+        inline static int _skipNoHash(const void *buf, int offset, int maxlen);
         inline static uint64_t _computeHash(const __lcm_hash_ptr *p);
 };
 
+static_assert(JointState::kHash == dimos_lcm::fingerprint(
+    dimos_lcm::signature_hash()
+        .member("name_length", "int32_t", 0)
+        .member("position_length", "int32_t", 0)
+        .member("velocity_length", "int32_t", 0)
+        .member("effort_length", "int32_t", 0)
+        .member("header", NULL, 0)
+        .member("name", "string", 1).dim(true, "name_length")
+        .member("position", "double", 1).dim(true, "position_length")
+        .member("velocity", "double", 1).dim(true, "velocity_length")
+        .member("effort", "double", 1).dim(true, "effort_length")
+        .value(),
+    std_msgs::Header::kHash),
+    "sensor_msgs::JointState fingerprint does not match its definition");
+
 int JointState::encode(void *buf, int offset, int maxlen) const
 {
     int pos = 0, tlen;
@@ -110,6 +230,15 @@ int JointState::encode(void *buf, int offset, int maxlen) const
     return pos;
 }
 
+int JointState::encodeTo(std::vector<uint8_t> &buf) const
+{
+    dimos_lcm::vector_writer out(buf);
+    int64_t hash = getHash();
+    out.put(&hash, 1);
+    this->_writeNoHash(out);
+    return static_cast<int>(out.size());
+}
+
 int JointState::decode(const void *buf, int offset, int maxlen)
 {
     int pos = 0, thislen;
@@ -125,6 +254,34 @@ int JointState::decode(const void *buf, int offset, int maxlen)
     return pos;
 }
 
+#if __cplusplus >= 201703L
+int JointState::peekHeader(const void *buf, int offset, int maxlen, std_msgs::HeaderView &header)
+{
+    int64_t msg_hash;
+    if (__int64_t_decode_array(buf, offset, maxlen, &msg_hash, 1) < 0) return -1;
+    if (msg_hash != kHash) return -1;
+
+    // header follows the hash and 16 bytes of fixed-size fields
+    return header._decodeNoHash(buf, offset + 24, maxlen - 24);
+}
+#endif
+
+template <uint64_t Mask>
+int JointState::decodeFields(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, thislen;
+
+    int64_t msg_hash;
+    thislen = __int64_t_decode_array(buf, offset + pos, maxlen - pos, &msg_hash, 1);
+    if (thislen < 0) return thislen; else pos += thislen;
+    if (msg_hash != getHash()) return -1;
+
+    thislen = this->_decodeFieldsNoHash<Mask>(buf, offset + pos, maxlen - pos);
+    if (thislen < 0) return thislen; else pos += thislen;
+
+    return pos;
+}
+
 int JointState::getEncodedSize() const
 {
     return 8 + _getEncodedSizeNoHash();
@@ -132,8 +289,7 @@ int JointState::getEncodedSize() const
 
 int64_t JointState::getHash()
 {
-    static int64_t hash = static_cast<int64_t>(_computeHash(NULL));
-    return hash;
+    return kHash;
 }
 
 const char* JointState::getTypeName()
@@ -168,23 +324,41 @@ int JointState::_encodeNoHash(void *buf, int offset, int maxlen) const
     }
 
     if(this->position_length > 0) {
-        tlen = __double_encode_array(buf, offset + pos, maxlen - pos, &this->position[0], this->position_length);
+        tlen = dimos_lcm::bulk_encode_array(buf, offset + pos, maxlen - pos, &this->position[0], this->position_length);
         if(tlen < 0) return tlen; else pos += tlen;
     }
 
     if(this->velocity_length > 0) {
-        tlen = __double_encode_array(buf, offset + pos, maxlen - pos, &this->velocity[0], this->velocity_length);
+        tlen = dimos_lcm::bulk_encode_array(buf, offset + pos, maxlen - pos, &this->velocity[0], this->velocity_length);
         if(tlen < 0) return tlen; else pos += tlen;
     }
 
     if(this->effort_length > 0) {
-        tlen = __double_encode_array(buf, offset + pos, maxlen - pos, &this->effort[0], this->effort_length);
+        tlen = dimos_lcm::bulk_encode_array(buf, offset + pos, maxlen - pos, &this->effort[0], this->effort_length);
         if(tlen < 0) return tlen; else pos += tlen;
     }
 
     return pos;
 }
 
+template <typename Writer>
+void JointState::_writeNoHash(Writer &out) const
+{
+    out.put(&this->name_length, 1);
+    out.put(&this->position_length, 1);
+    out.put(&this->velocity_length, 1);
+    out.put(&this->effort_length, 1);
+    this->header._writeNoHash(out);
+    for (int a0 = 0; a0 < this->name_length; a0++)
+        out.put(this->name[a0]);
+    if(this->position_length > 0)
+        out.put(&this->position[0], this->position_length);
+    if(this->velocity_length > 0)
+        out.put(&this->velocity[0], this->velocity_length);
+    if(this->effort_length > 0)
+        out.put(&this->effort[0], this->effort_length);
+}
+
 int JointState::_decodeNoHash(const void *buf, int offset, int maxlen)
 {
     int pos = 0, tlen;
@@ -204,6 +378,7 @@ int JointState::_decodeNoHash(const void *buf, int offset, int maxlen)
     tlen = this->header._decodeNoHash(buf, offset + pos, maxlen - pos);
     if(tlen < 0) return tlen; else pos += tlen;
 
+    if(this->name_length < 0 || this->name_length > (maxlen - pos) / 5 || this->name_length > maxArrayLength) return -1;
     try {
         this->name.resize(this->name_length);
     } catch (...) {
@@ -214,27 +389,133 @@ int JointState::_decodeNoHash(const void *buf, int offset, int maxlen)
         tlen = __int32_t_decode_array(
             buf, offset + pos, maxlen - pos, &__elem_len, 1);
         if(tlen < 0) return tlen; else pos += tlen;
-        if(__elem_len > maxlen - pos) return -1;
+        if(__elem_len < 1 || __elem_len > maxlen - pos) return -1;
         this->name[a0].assign(static_cast<const char*>(buf) + offset + pos, __elem_len -  1);
         pos += __elem_len;
     }
 
     if(this->position_length) {
+        if(this->position_length < 0 || this->position_length > (maxlen - pos) / 8 || this->position_length > maxArrayLength) return -1;
         this->position.resize(this->position_length);
-        tlen = __double_decode_array(buf, offset + pos, maxlen - pos, &this->position[0], this->position_length);
+        tlen = dimos_lcm::bulk_decode_array(buf, offset + pos, maxlen - pos, &this->position[0], this->position_length);
         if(tlen < 0) return tlen; else pos += tlen;
+    } else {
+        this->position.clear();
     }
 
     if(this->velocity_length) {
+        if(this->velocity_length < 0 || this->velocity_length > (maxlen - pos) / 8 || this->velocity_length > maxArrayLength) return -1;
         this->velocity.resize(this->velocity_length);
-        tlen = __double_decode_array(buf, offset + pos, maxlen - pos, &this->velocity[0], this->velocity_length);
+        tlen = dimos_lcm::bulk_decode_array(buf, offset + pos, maxlen - pos, &this->velocity[0], this->velocity_length);
         if(tlen < 0) return tlen; else pos += tlen;
+    } else {
+        this->velocity.clear();
     }
 
     if(this->effort_length) {
+        if(this->effort_length < 0 || this->effort_length > (maxlen - pos) / 8 || this->effort_length > maxArrayLength) return -1;
         this->effort.resize(this->effort_length);
-        tlen = __double_decode_array(buf, offset + pos, maxlen - pos, &this->effort[0], this->effort_length);
+        tlen = dimos_lcm::bulk_decode_array(buf, offset + pos, maxlen - pos, &this->effort[0], this->effort_length);
+        if(tlen < 0) return tlen; else pos += tlen;
+    } else {
+        this->effort.clear();
+    }
+
+    return pos;
+}
+
+template <uint64_t Mask>
+int JointState::_decodeFieldsNoHash(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, tlen;
+
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &this->name_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &this->position_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &this->velocity_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &this->effort_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    if ((Mask & Fields::header) != 0) {
+        tlen = this->header._decodeNoHash(buf, offset + pos, maxlen - pos);
         if(tlen < 0) return tlen; else pos += tlen;
+    } else {
+        tlen = std_msgs::Header::_skipNoHash(buf, offset + pos, maxlen - pos);
+        if(tlen < 0) return tlen; else pos += tlen;
+    }
+
+    if ((Mask & Fields::name) != 0) {
+        if(this->name_length < 0 || this->name_length > (maxlen - pos) / 5 || this->name_length > maxArrayLength) return -1;
+        try {
+            this->name.resize(this->name_length);
+        } catch (...) {
+            return -1;
+        }
+        for (int a0 = 0; a0 < this->name_length; a0++) {
+            int32_t __elem_len;
+            tlen = __int32_t_decode_array(
+                buf, offset + pos, maxlen - pos, &__elem_len, 1);
+            if(tlen < 0) return tlen; else pos += tlen;
+            if(__elem_len < 1 || __elem_len > maxlen - pos) return -1;
+            this->name[a0].assign(static_cast<const char*>(buf) + offset + pos, __elem_len -  1);
+            pos += __elem_len;
+        }
+    } else {
+        if(this->name_length < 0) return -1;
+        for (int a0 = 0; a0 < this->name_length; a0++) {
+            int32_t __name_len__;
+            tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &__name_len__, 1);
+            if(tlen < 0) return tlen; else pos += tlen;
+            if(__name_len__ < 0 || __name_len__ > maxlen - pos) return -1;
+            pos += __name_len__;
+        }
+    }
+
+    if ((Mask & Fields::position) != 0) {
+        if(this->position_length) {
+            if(this->position_length < 0 || this->position_length > (maxlen - pos) / 8 || this->position_length > maxArrayLength) return -1;
+            this->position.resize(this->position_length);
+            tlen = dimos_lcm::bulk_decode_array(buf, offset + pos, maxlen - pos, &this->position[0], this->position_length);
+            if(tlen < 0) return tlen; else pos += tlen;
+        } else {
+            this->position.clear();
+        }
+    } else {
+        if(this->position_length < 0 || this->position_length > (maxlen - pos) / 8) return -1;
+        pos += this->position_length * 8;
+    }
+
+    if ((Mask & Fields::velocity) != 0) {
+        if(this->velocity_length) {
+            if(this->velocity_length < 0 || this->velocity_length > (maxlen - pos) / 8 || this->velocity_length > maxArrayLength) return -1;
+            this->velocity.resize(this->velocity_length);
+            tlen = dimos_lcm::bulk_decode_array(buf, offset + pos, maxlen - pos, &this->velocity[0], this->velocity_length);
+            if(tlen < 0) return tlen; else pos += tlen;
+        } else {
+            this->velocity.clear();
+        }
+    } else {
+        if(this->velocity_length < 0 || this->velocity_length > (maxlen - pos) / 8) return -1;
+        pos += this->velocity_length * 8;
+    }
+
+    if ((Mask & Fields::effort) != 0) {
+        if(this->effort_length) {
+            if(this->effort_length < 0 || this->effort_length > (maxlen - pos) / 8 || this->effort_length > maxArrayLength) return -1;
+            this->effort.resize(this->effort_length);
+            tlen = dimos_lcm::bulk_decode_array(buf, offset + pos, maxlen - pos, &this->effort[0], this->effort_length);
+            if(tlen < 0) return tlen; else pos += tlen;
+        } else {
+            this->effort.clear();
+        }
+    } else {
+        if(this->effort_length < 0 || this->effort_length > (maxlen - pos) / 8) return -1;
+        pos += this->effort_length * 8;
     }
 
     return pos;
@@ -257,6 +538,55 @@ int JointState::_getEncodedSizeNoHash() const
     return enc_size;
 }
 
+int JointState::_skipNoHash(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, tlen;
+    int32_t name_length;
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &name_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+    int32_t position_length;
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &position_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+    int32_t velocity_length;
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &velocity_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+    int32_t effort_length;
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &effort_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+    tlen = std_msgs::Header::_skipNoHash(buf, offset + pos, maxlen - pos);
+    if(tlen < 0) return tlen; else pos += tlen;
+    if(name_length < 0) return -1;
+    for (int a0 = 0; a0 < name_length; a0++) {
+        int32_t __name_len__;
+        tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &__name_len__, 1);
+        if(tlen < 0) return tlen; else pos += tlen;
+        if(__name_len__ < 0 || __name_len__ > maxlen - pos) return -1;
+        pos += __name_len__;
+    }
+    if(position_length < 0 || position_length > (maxlen - pos) / 8) return -1;
+    pos += position_length * 8;
+    if(velocity_length < 0 || velocity_length > (maxlen - pos) / 8) return -1;
+    pos += velocity_length * 8;
+    if(effort_length < 0 || effort_length > (maxlen - pos) / 8) return -1;
+    pos += effort_length * 8;
+    if(pos > maxlen) return -1;
+    return pos;
+}
+
+template <typename Self, typename Visitor>
+void JointState::_forEachField(Self &self, Visitor &visitor)
+{
+    visitor(kFields[0], self.name_length);
+    visitor(kFields[1], self.position_length);
+    visitor(kFields[2], self.velocity_length);
+    visitor(kFields[3], self.effort_length);
+    visitor(kFields[4], self.header);
+    visitor(kFields[5], self.name);
+    visitor(kFields[6], self.position);
+    visitor(kFields[7], self.velocity);
+    visitor(kFields[8], self.effort);
+}
+
 uint64_t JointState::_computeHash(const __lcm_hash_ptr *p)
 {
     const __lcm_hash_ptr *fp;
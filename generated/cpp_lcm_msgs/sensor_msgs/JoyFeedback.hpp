@@ -1,7 +1,7 @@
 /** THIS IS AN AUTOMATICALLY GENERATED FILE.  DO NOT MODIFY
  * BY HAND!!
  *
- * Generated by lcm-gen 1.5.2
+ * Generated by lcm-cpp (tools/cpp/gen)
  **/
 
 #ifndef __sensor_msgs_JoyFeedback_hpp__
@@ -9,6 +9,11 @@
 
 #include <lcm/lcm_coretypes.h>
 
+#include <array>
+#include "dimos_lcm/fixed_codec.hpp"
+#include "dimos_lcm/writer.hpp"
+#include "dimos_lcm/fingerprint.hpp"
+#include "dimos_lcm/reflection.hpp"
 
 namespace sensor_msgs
 {
@@ -51,11 +56,26 @@ class JoyFeedback
          */
         inline int encode(void *buf, int offset, int maxlen) const;
 
+        /**
+         * Encode a message by appending it to @p buf, walking the message once
+         * instead of sizing it with getEncodedSize() first. @p buf grows
+         * geometrically; reuse it across calls to avoid reallocating.
+         *
+         * @return The number of bytes appended.
+         */
+        inline int encodeTo(std::vector<uint8_t> &buf) const;
+
         /**
          * Check how many bytes are required to encode this message.
          */
         inline int getEncodedSize() const;
 
+        /**
+         * getEncodedSize() of every instance: the type has no strings or
+         * variable-length arrays.
+         */
+        static constexpr int kEncodedSize = 14;
+
         /**
          * Decode a message from binary form into this instance.
          *
@@ -74,18 +94,46 @@ class JoyFeedback
          */
         inline static int64_t getHash();
 
+        /**
+         * The fingerprint returned by getHash(), as a compile-time constant.
+         */
+        static constexpr int64_t kHash = static_cast<int64_t>(0x4896485f09c2842aULL);
+
         /**
          * Returns "JoyFeedback"
          */
         inline static const char* getTypeName();
 
+        /**
+         * Name, LCM type and array dimensions of each field, in wire order.
+         * See dimos_lcm::for_each_field() for visiting the fields themselves.
+         */
+        static constexpr std::array<dimos_lcm::field_info, 3> kFields = {{
+            { "type", "byte", true, 0, 0, NULL },
+            { "id", "byte", true, 0, 0, NULL },
+            { "intensity", "float", true, 0, 0, NULL },
+        }};
+
         // LCM support functions. Users should not call these
         inline int _encodeNoHash(void *buf, int offset, int maxlen) const;
+        template <typename Writer>
+        inline void _writeNoHash(Writer &out) const;
         inline int _getEncodedSizeNoHash() const;
         inline int _decodeNoHash(const void *buf, int offset, int maxlen);
+        template <typename Self, typename Visitor>
+        inline static void _forEachField(Self &self, Visitor &visitor);
+        inline static int _skipNoHash(const void *buf, int offset, int maxlen);
         inline static uint64_t _computeHash(const __lcm_hash_ptr *p);
 };
 
+static_assert(JoyFeedback::kHash == dimos_lcm::fingerprint(
+    dimos_lcm::signature_hash()
+        .member("type", "byte", 0)
+        .member("id", "byte", 0)
+        .member("intensity", "float", 0)
+        .value()),
+    "sensor_msgs::JoyFeedback fingerprint does not match its definition");
+
 int JoyFeedback::encode(void *buf, int offset, int maxlen) const
 {
     int pos = 0, tlen;
@@ -100,6 +148,15 @@ int JoyFeedback::encode(void *buf, int offset, int maxlen) const
     return pos;
 }
 
+int JoyFeedback::encodeTo(std::vector<uint8_t> &buf) const
+{
+    dimos_lcm::vector_writer out(buf);
+    int64_t hash = getHash();
+    out.put(&hash, 1);
+    this->_writeNoHash(out);
+    return static_cast<int>(out.size());
+}
+
 int JoyFeedback::decode(const void *buf, int offset, int maxlen)
 {
     int pos = 0, thislen;
@@ -122,8 +179,7 @@ int JoyFeedback::getEncodedSize() const
 
 int64_t JoyFeedback::getHash()
 {
-    static int64_t hash = static_cast<int64_t>(_computeHash(NULL));
-    return hash;
+    return kHash;
 }
 
 const char* JoyFeedback::getTypeName()
@@ -133,43 +189,46 @@ const char* JoyFeedback::getTypeName()
 
 int JoyFeedback::_encodeNoHash(void *buf, int offset, int maxlen) const
 {
-    int pos = 0, tlen;
-
-    tlen = __byte_encode_array(buf, offset + pos, maxlen - pos, &this->type, 1);
-    if(tlen < 0) return tlen; else pos += tlen;
-
-    tlen = __byte_encode_array(buf, offset + pos, maxlen - pos, &this->id, 1);
-    if(tlen < 0) return tlen; else pos += tlen;
-
-    tlen = __float_encode_array(buf, offset + pos, maxlen - pos, &this->intensity, 1);
-    if(tlen < 0) return tlen; else pos += tlen;
+    if(maxlen < kEncodedSize - 8) return -1;
+    uint8_t *p = static_cast<uint8_t*>(buf) + offset;
+    dimos_lcm::store_be(p + 0, this->type);
+    dimos_lcm::store_be(p + 1, this->id);
+    dimos_lcm::store_be(p + 2, this->intensity);
+    return kEncodedSize - 8;
+}
 
-    return pos;
+template <typename Writer>
+void JoyFeedback::_writeNoHash(Writer &out) const
+{
+    out.putStruct(*this);
 }
 
 int JoyFeedback::_decodeNoHash(const void *buf, int offset, int maxlen)
 {
-    int pos = 0, tlen;
-
-    tlen = __byte_decode_array(buf, offset + pos, maxlen - pos, &this->type, 1);
-    if(tlen < 0) return tlen; else pos += tlen;
-
-    tlen = __byte_decode_array(buf, offset + pos, maxlen - pos, &this->id, 1);
-    if(tlen < 0) return tlen; else pos += tlen;
+    if(maxlen < kEncodedSize - 8) return -1;
+    const uint8_t *p = static_cast<const uint8_t*>(buf) + offset;
+    dimos_lcm::load_be(p + 0, this->type);
+    dimos_lcm::load_be(p + 1, this->id);
+    dimos_lcm::load_be(p + 2, this->intensity);
+    return kEncodedSize - 8;
+}
 
-    tlen = __float_decode_array(buf, offset + pos, maxlen - pos, &this->intensity, 1);
-    if(tlen < 0) return tlen; else pos += tlen;
+int JoyFeedback::_getEncodedSizeNoHash() const
+{
+    return kEncodedSize - 8;
+}
 
-    return pos;
+int JoyFeedback::_skipNoHash(const void *, int, int maxlen)
+{
+    return maxlen < kEncodedSize - 8 ? -1 : kEncodedSize - 8;
 }
 
-int JoyFeedback::_getEncodedSizeNoHash() const
+template <typename Self, typename Visitor>
+void JoyFeedback::_forEachField(Self &self, Visitor &visitor)
 {
-    int enc_size = 0;
-    enc_size += __byte_encoded_array_size(NULL, 1);
-    enc_size += __byte_encoded_array_size(NULL, 1);
-    enc_size += __float_encoded_array_size(NULL, 1);
-    return enc_size;
+    visitor(kFields[0], self.type);
+    visitor(kFields[1], self.id);
+    visitor(kFields[2], self.intensity);
 }
 
 uint64_t JoyFeedback::_computeHash(const __lcm_hash_ptr *)
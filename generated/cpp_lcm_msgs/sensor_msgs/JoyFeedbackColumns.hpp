@@ -0,0 +1,140 @@
+/** THIS IS AN AUTOMATICALLY GENERATED FILE.  DO NOT MODIFY
+ * BY HAND!!
+ *
+ * Generated by lcm-cpp (tools/cpp/gen)
+ **/
+
+#ifndef __sensor_msgs_JoyFeedbackColumns_hpp__
+#define __sensor_msgs_JoyFeedbackColumns_hpp__
+
+#include <lcm/lcm_coretypes.h>
+
+#include <vector>
+#include "dimos_lcm/fixed_codec.hpp"
+#include "sensor_msgs/JoyFeedback.hpp"
+
+namespace sensor_msgs
+{
+
+/**
+ * Structure-of-arrays storage for a sequence of sensor_msgs.JoyFeedback: one
+ * contiguous array per field, with nested fields flattened and named by their
+ * path (type, id, ...). The soa:: message classes hold their
+ * JoyFeedback arrays this way and decode them straight into the columns.
+ */
+class JoyFeedbackColumns
+{
+    public:
+        std::vector< uint8_t > type;
+
+        std::vector< uint8_t > id;
+
+        std::vector< float > intensity;
+
+    public:
+        /**
+         * Number of elements.
+         */
+        inline int size() const;
+
+        /**
+         * Resize every column to @p n elements.
+         */
+        inline void resize(int n);
+
+        /**
+         * Gather element @p i into a JoyFeedback.
+         */
+        inline sensor_msgs::JoyFeedback get(int i) const;
+
+        /**
+         * Scatter @p msg into element @p i.
+         */
+        inline void set(int i, const sensor_msgs::JoyFeedback &msg);
+
+        // LCM support functions. Users should not call these
+        inline int _encodeNoHash(void *buf, int offset, int maxlen, int n) const;
+        template <typename Writer>
+        inline void _writeNoHash(Writer &out, int n) const;
+        inline int _getEncodedSizeNoHash(int n) const;
+        inline int _decodeNoHash(const void *buf, int offset, int maxlen, int n);
+};
+
+int JoyFeedbackColumns::size() const
+{
+    return static_cast<int>(this->type.size());
+}
+
+void JoyFeedbackColumns::resize(int n)
+{
+    this->type.resize(n);
+    this->id.resize(n);
+    this->intensity.resize(n);
+}
+
+sensor_msgs::JoyFeedback JoyFeedbackColumns::get(int i) const
+{
+    sensor_msgs::JoyFeedback msg;
+    msg.type = this->type[i];
+    msg.id = this->id[i];
+    msg.intensity = this->intensity[i];
+    return msg;
+}
+
+void JoyFeedbackColumns::set(int i, const sensor_msgs::JoyFeedback &msg)
+{
+    this->type[i] = msg.type;
+    this->id[i] = msg.id;
+    this->intensity[i] = msg.intensity;
+}
+
+int JoyFeedbackColumns::_encodeNoHash(void *buf, int offset, int maxlen, int n) const
+{
+    uint8_t *p = static_cast<uint8_t*>(buf) + offset;
+    int pos = 0;
+    for (int i = 0; i < n; i++) {
+        if(maxlen - pos < 6) return -1;
+        dimos_lcm::store_be(p + pos + 0, this->type[i]);
+        dimos_lcm::store_be(p + pos + 1, this->id[i]);
+        dimos_lcm::store_be(p + pos + 2, this->intensity[i]);
+        pos += 6;
+    }
+    return pos;
+}
+
+template <typename Writer>
+void JoyFeedbackColumns::_writeNoHash(Writer &out, int n) const
+{
+    if(n <= 0) return;
+    uint8_t *p = out.extend(static_cast<size_t>(n) * 6);
+    for (int i = 0; i < n; i++, p += 6) {
+        dimos_lcm::store_be(p + 0, this->type[i]);
+        dimos_lcm::store_be(p + 1, this->id[i]);
+        dimos_lcm::store_be(p + 2, this->intensity[i]);
+    }
+}
+
+int JoyFeedbackColumns::_getEncodedSizeNoHash(int n) const
+{
+    return n * 6;
+}
+
+int JoyFeedbackColumns::_decodeNoHash(const void *buf, int offset, int maxlen, int n)
+{
+    if(n < 0 || n > maxlen / 6) return -1;
+    this->resize(n);
+    const uint8_t *p = static_cast<const uint8_t*>(buf) + offset;
+    uint8_t *type = this->type.data();
+    uint8_t *id = this->id.data();
+    float *intensity = this->intensity.data();
+    for (int i = 0; i < n; i++, p += 6) {
+        dimos_lcm::load_be(p + 0, type[i]);
+        dimos_lcm::load_be(p + 1, id[i]);
+        dimos_lcm::load_be(p + 2, intensity[i]);
+    }
+    return n * 6;
+}
+
+}
+
+#endif
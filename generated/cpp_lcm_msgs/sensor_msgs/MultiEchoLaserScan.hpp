@@ -1,7 +1,7 @@
 /** THIS IS AN AUTOMATICALLY GENERATED FILE.  DO NOT MODIFY
  * BY HAND!!
  *
- * Generated by lcm-gen 1.5.2
+ * Generated by lcm-cpp (tools/cpp/gen)
  **/
 
 #ifndef __sensor_msgs_MultiEchoLaserScan_hpp__
@@ -9,10 +9,16 @@
 
 #include <lcm/lcm_coretypes.h>
 
+#include <array>
 #include <vector>
+#include "dimos_lcm/writer.hpp"
+#include "dimos_lcm/fingerprint.hpp"
+#include "dimos_lcm/reflection.hpp"
 #include "std_msgs/Header.hpp"
 #include "sensor_msgs/LaserEcho.hpp"
-#include "sensor_msgs/LaserEcho.hpp"
+#if __cplusplus >= 201703L
+#include "std_msgs/HeaderView.hpp"
+#endif
 
 namespace sensor_msgs
 {
@@ -62,6 +68,15 @@ class MultiEchoLaserScan
          */
         inline int encode(void *buf, int offset, int maxlen) const;
 
+        /**
+         * Encode a message by appending it to @p buf, walking the message once
+         * instead of sizing it with getEncodedSize() first. @p buf grows
+         * geometrically; reuse it across calls to avoid reallocating.
+         *
+         * @return The number of bytes appended.
+         */
+        inline int encodeTo(std::vector<uint8_t> &buf) const;
+
         /**
          * Check how many bytes are required to encode this message.
          */
@@ -77,6 +92,69 @@ class MultiEchoLaserScan
          */
         inline int decode(const void *buf, int offset, int maxlen);
 
+#if __cplusplus >= 201703L
+        /**
+         * Decode only the header field of an encoded message, leaving the
+         * rest of it untouched. The field sits at a fixed offset, so this costs
+         * the same for any payload size. The view points into @p buf.
+         *
+         * @param buf The buffer containing the encoded message.
+         * @param offset The byte offset into @p buf where the encoded message starts.
+         * @param maxlen The maximum number of bytes to read while decoding.
+         * @param header Receives the decoded header.
+         * @return The number of bytes of the field decoded, or <0 if @p buf does
+         *  not hold a MultiEchoLaserScan or is truncated.
+         *
+         * Needs C++17, for the std::string_view of the view.
+         */
+        inline static int peekHeader(const void *buf, int offset, int maxlen, std_msgs::HeaderView &header);
+#endif
+
+        /**
+         * Field bits for decodeFields().
+         */
+        struct Fields
+        {
+            static constexpr uint64_t ranges_length = 1ULL << 0;
+            static constexpr uint64_t intensities_length = 1ULL << 1;
+            static constexpr uint64_t header = 1ULL << 2;
+            static constexpr uint64_t angle_min = 1ULL << 3;
+            static constexpr uint64_t angle_max = 1ULL << 4;
+            static constexpr uint64_t angle_increment = 1ULL << 5;
+            static constexpr uint64_t time_increment = 1ULL << 6;
+            static constexpr uint64_t scan_time = 1ULL << 7;
+            static constexpr uint64_t range_min = 1ULL << 8;
+            static constexpr uint64_t range_max = 1ULL << 9;
+            static constexpr uint64_t ranges = 1ULL << 10;
+            static constexpr uint64_t intensities = 1ULL << 11;
+            static constexpr uint64_t all = (1ULL << 12) - 1;
+        };
+
+        /**
+         * Decode only the fields selected by @p Mask, a bitwise or of Fields
+         * values. Strings, arrays and nested structs that are not selected are
+         * skipped over by their length prefixes without being allocated, and
+         * keep their previous value. Scalar fields are always decoded: they
+         * cost nothing to read and array lengths depend on them.
+         *
+         * @return The number of bytes decoded, or <0 if an error occured.
+         */
+        template <uint64_t Mask>
+        inline int decodeFields(const void *buf, int offset, int maxlen);
+
+        /**
+         * Upper bound on the length of every variable-length array of this
+         * type, checked by decode() before anything is allocated; messages
+         * exceeding it fail to decode. It does not apply to nested types,
+         * which have their own. Set it once at startup, before decoding.
+         * Before C++17 it is a constant with no limit.
+         */
+#if __cplusplus >= 201703L
+        static inline int32_t maxArrayLength = INT32_MAX;
+#else
+        static constexpr int32_t maxArrayLength = INT32_MAX;
+#endif
+
         /**
          * Retrieve the 64-bit fingerprint identifying the structure of the message.
          * Note that the fingerprint is the same for all instances of the same
@@ -85,18 +163,69 @@ class MultiEchoLaserScan
          */
         inline static int64_t getHash();
 
+        /**
+         * The fingerprint returned by getHash(), as a compile-time constant.
+         */
+        static constexpr int64_t kHash = static_cast<int64_t>(0x62c2f7bce4ef1926ULL);
+
         /**
          * Returns "MultiEchoLaserScan"
          */
         inline static const char* getTypeName();
 
+        /**
+         * Name, LCM type and array dimensions of each field, in wire order.
+         * See dimos_lcm::for_each_field() for visiting the fields themselves.
+         */
+        static constexpr std::array<dimos_lcm::field_info, 12> kFields = {{
+            { "ranges_length", "int32_t", true, 0, 0, NULL },
+            { "intensities_length", "int32_t", true, 0, 0, NULL },
+            { "header", "std_msgs.Header", false, 0, 0, NULL },
+            { "angle_min", "float", true, 0, 0, NULL },
+            { "angle_max", "float", true, 0, 0, NULL },
+            { "angle_increment", "float", true, 0, 0, NULL },
+            { "time_increment", "float", true, 0, 0, NULL },
+            { "scan_time", "float", true, 0, 0, NULL },
+            { "range_min", "float", true, 0, 0, NULL },
+            { "range_max", "float", true, 0, 0, NULL },
+            { "ranges", "sensor_msgs.LaserEcho", false, 1, -1, "ranges_length" },
+            { "intensities", "sensor_msgs.LaserEcho", false, 1, -1, "intensities_length" },
+        }};
+
         // LCM support functions. Users should not call these
         inline int _encodeNoHash(void *buf, int offset, int maxlen) const;
+        template <typename Writer>
+        inline void _writeNoHash(Writer &out) const;
         inline int _getEncodedSizeNoHash() const;
         inline int _decodeNoHash(const void *buf, int offset, int maxlen);
+        template <uint64_t Mask>
+        inline int _decodeFieldsNoHash(const void *buf, int offset, int maxlen);
+        template <typename Self, typename Visitor>
+        inline static void _forEachField(Self &self, Visitor &visitor);
+        inline static int _skipNoHash(const void *buf, int offset, int maxlen);
         inline static uint64_t _computeHash(const __lcm_hash_ptr *p);
 };
 
+static_assert(MultiEchoLaserScan::kHash == dimos_lcm::fingerprint(
+    dimos_lcm::signature_hash()
+        .member("ranges_length", "int32_t", 0)
+        .member("intensities_length", "int32_t", 0)
+        .member("header", NULL, 0)
+        .member("angle_min", "float", 0)
+        .member("angle_max", "float", 0)
+        .member("angle_increment", "float", 0)
+        .member("time_increment", "float", 0)
+        .member("scan_time", "float", 0)
+        .member("range_min", "float", 0)
+        .member("range_max", "float", 0)
+        .member("ranges", NULL, 1).dim(true, "ranges_length")
+        .member("intensities", NULL, 1).dim(true, "intensities_length")
+        .value(),
+    std_msgs::Header::kHash,
+    sensor_msgs::LaserEcho::kHash,
+    sensor_msgs::LaserEcho::kHash),
+    "sensor_msgs::MultiEchoLaserScan fingerprint does not match its definition");
+
 int MultiEchoLaserScan::encode(void *buf, int offset, int maxlen) const
 {
     int pos = 0, tlen;
@@ -111,6 +240,15 @@ int MultiEchoLaserScan::encode(void *buf, int offset, int maxlen) const
     return pos;
 }
 
+int MultiEchoLaserScan::encodeTo(std::vector<uint8_t> &buf) const
+{
+    dimos_lcm::vector_writer out(buf);
+    int64_t hash = getHash();
+    out.put(&hash, 1);
+    this->_writeNoHash(out);
+    return static_cast<int>(out.size());
+}
+
 int MultiEchoLaserScan::decode(const void *buf, int offset, int maxlen)
 {
     int pos = 0, thislen;
@@ -126,6 +264,34 @@ int MultiEchoLaserScan::decode(const void *buf, int offset, int maxlen)
     return pos;
 }
 
+#if __cplusplus >= 201703L
+int MultiEchoLaserScan::peekHeader(const void *buf, int offset, int maxlen, std_msgs::HeaderView &header)
+{
+    int64_t msg_hash;
+    if (__int64_t_decode_array(buf, offset, maxlen, &msg_hash, 1) < 0) return -1;
+    if (msg_hash != kHash) return -1;
+
+    // header follows the hash and 8 bytes of fixed-size fields
+    return header._decodeNoHash(buf, offset + 16, maxlen - 16);
+}
+#endif
+
+template <uint64_t Mask>
+int MultiEchoLaserScan::decodeFields(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, thislen;
+
+    int64_t msg_hash;
+    thislen = __int64_t_decode_array(buf, offset + pos, maxlen - pos, &msg_hash, 1);
+    if (thislen < 0) return thislen; else pos += thislen;
+    if (msg_hash != getHash()) return -1;
+
+    thislen = this->_decodeFieldsNoHash<Mask>(buf, offset + pos, maxlen - pos);
+    if (thislen < 0) return thislen; else pos += thislen;
+
+    return pos;
+}
+
 int MultiEchoLaserScan::getEncodedSize() const
 {
     return 8 + _getEncodedSizeNoHash();
@@ -133,8 +299,7 @@ int MultiEchoLaserScan::getEncodedSize() const
 
 int64_t MultiEchoLaserScan::getHash()
 {
-    static int64_t hash = static_cast<int64_t>(_computeHash(NULL));
-    return hash;
+    return kHash;
 }
 
 const char* MultiEchoLaserScan::getTypeName()
@@ -189,6 +354,25 @@ int MultiEchoLaserScan::_encodeNoHash(void *buf, int offset, int maxlen) const
     return pos;
 }
 
+template <typename Writer>
+void MultiEchoLaserScan::_writeNoHash(Writer &out) const
+{
+    out.put(&this->ranges_length, 1);
+    out.put(&this->intensities_length, 1);
+    this->header._writeNoHash(out);
+    out.put(&this->angle_min, 1);
+    out.put(&this->angle_max, 1);
+    out.put(&this->angle_increment, 1);
+    out.put(&this->time_increment, 1);
+    out.put(&this->scan_time, 1);
+    out.put(&this->range_min, 1);
+    out.put(&this->range_max, 1);
+    for (int a0 = 0; a0 < this->ranges_length; a0++)
+        this->ranges[a0]._writeNoHash(out);
+    for (int a0 = 0; a0 < this->intensities_length; a0++)
+        this->intensities[a0]._writeNoHash(out);
+}
+
 int MultiEchoLaserScan::_decodeNoHash(const void *buf, int offset, int maxlen)
 {
     int pos = 0, tlen;
@@ -223,6 +407,7 @@ int MultiEchoLaserScan::_decodeNoHash(const void *buf, int offset, int maxlen)
     tlen = __float_decode_array(buf, offset + pos, maxlen - pos, &this->range_max, 1);
     if(tlen < 0) return tlen; else pos += tlen;
 
+    if(this->ranges_length < 0 || this->ranges_length > (maxlen - pos) / 4 || this->ranges_length > maxArrayLength) return -1;
     try {
         this->ranges.resize(this->ranges_length);
     } catch (...) {
@@ -233,6 +418,7 @@ int MultiEchoLaserScan::_decodeNoHash(const void *buf, int offset, int maxlen)
         if(tlen < 0) return tlen; else pos += tlen;
     }
 
+    if(this->intensities_length < 0 || this->intensities_length > (maxlen - pos) / 4 || this->intensities_length > maxArrayLength) return -1;
     try {
         this->intensities.resize(this->intensities_length);
     } catch (...) {
@@ -246,6 +432,87 @@ int MultiEchoLaserScan::_decodeNoHash(const void *buf, int offset, int maxlen)
     return pos;
 }
 
+template <uint64_t Mask>
+int MultiEchoLaserScan::_decodeFieldsNoHash(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, tlen;
+
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &this->ranges_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &this->intensities_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    if ((Mask & Fields::header) != 0) {
+        tlen = this->header._decodeNoHash(buf, offset + pos, maxlen - pos);
+        if(tlen < 0) return tlen; else pos += tlen;
+    } else {
+        tlen = std_msgs::Header::_skipNoHash(buf, offset + pos, maxlen - pos);
+        if(tlen < 0) return tlen; else pos += tlen;
+    }
+
+    tlen = __float_decode_array(buf, offset + pos, maxlen - pos, &this->angle_min, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = __float_decode_array(buf, offset + pos, maxlen - pos, &this->angle_max, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = __float_decode_array(buf, offset + pos, maxlen - pos, &this->angle_increment, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = __float_decode_array(buf, offset + pos, maxlen - pos, &this->time_increment, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = __float_decode_array(buf, offset + pos, maxlen - pos, &this->scan_time, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = __float_decode_array(buf, offset + pos, maxlen - pos, &this->range_min, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = __float_decode_array(buf, offset + pos, maxlen - pos, &this->range_max, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    if ((Mask & Fields::ranges) != 0) {
+        if(this->ranges_length < 0 || this->ranges_length > (maxlen - pos) / 4 || this->ranges_length > maxArrayLength) return -1;
+        try {
+            this->ranges.resize(this->ranges_length);
+        } catch (...) {
+            return -1;
+        }
+        for (int a0 = 0; a0 < this->ranges_length; a0++) {
+            tlen = this->ranges[a0]._decodeNoHash(buf, offset + pos, maxlen - pos);
+            if(tlen < 0) return tlen; else pos += tlen;
+        }
+    } else {
+        if(this->ranges_length < 0) return -1;
+        for (int a0 = 0; a0 < this->ranges_length; a0++) {
+            tlen = sensor_msgs::LaserEcho::_skipNoHash(buf, offset + pos, maxlen - pos);
+            if(tlen < 0) return tlen; else pos += tlen;
+        }
+    }
+
+    if ((Mask & Fields::intensities) != 0) {
+        if(this->intensities_length < 0 || this->intensities_length > (maxlen - pos) / 4 || this->intensities_length > maxArrayLength) return -1;
+        try {
+            this->intensities.resize(this->intensities_length);
+        } catch (...) {
+            return -1;
+        }
+        for (int a0 = 0; a0 < this->intensities_length; a0++) {
+            tlen = this->intensities[a0]._decodeNoHash(buf, offset + pos, maxlen - pos);
+            if(tlen < 0) return tlen; else pos += tlen;
+        }
+    } else {
+        if(this->intensities_length < 0) return -1;
+        for (int a0 = 0; a0 < this->intensities_length; a0++) {
+            tlen = sensor_msgs::LaserEcho::_skipNoHash(buf, offset + pos, maxlen - pos);
+            if(tlen < 0) return tlen; else pos += tlen;
+        }
+    }
+
+    return pos;
+}
+
 int MultiEchoLaserScan::_getEncodedSizeNoHash() const
 {
     int enc_size = 0;
@@ -268,6 +535,55 @@ int MultiEchoLaserScan::_getEncodedSizeNoHash() const
     return enc_size;
 }
 
+int MultiEchoLaserScan::_skipNoHash(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, tlen;
+    int32_t ranges_length;
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &ranges_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+    int32_t intensities_length;
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &intensities_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+    tlen = std_msgs::Header::_skipNoHash(buf, offset + pos, maxlen - pos);
+    if(tlen < 0) return tlen; else pos += tlen;
+    pos += 4;
+    pos += 4;
+    pos += 4;
+    pos += 4;
+    pos += 4;
+    pos += 4;
+    pos += 4;
+    if(ranges_length < 0) return -1;
+    for (int a0 = 0; a0 < ranges_length; a0++) {
+        tlen = sensor_msgs::LaserEcho::_skipNoHash(buf, offset + pos, maxlen - pos);
+        if(tlen < 0) return tlen; else pos += tlen;
+    }
+    if(intensities_length < 0) return -1;
+    for (int a0 = 0; a0 < intensities_length; a0++) {
+        tlen = sensor_msgs::LaserEcho::_skipNoHash(buf, offset + pos, maxlen - pos);
+        if(tlen < 0) return tlen; else pos += tlen;
+    }
+    if(pos > maxlen) return -1;
+    return pos;
+}
+
+template <typename Self, typename Visitor>
+void MultiEchoLaserScan::_forEachField(Self &self, Visitor &visitor)
+{
+    visitor(kFields[0], self.ranges_length);
+    visitor(kFields[1], self.intensities_length);
+    visitor(kFields[2], self.header);
+    visitor(kFields[3], self.angle_min);
+    visitor(kFields[4], self.angle_max);
+    visitor(kFields[5], self.angle_increment);
+    visitor(kFields[6], self.time_increment);
+    visitor(kFields[7], self.scan_time);
+    visitor(kFields[8], self.range_min);
+    visitor(kFields[9], self.range_max);
+    visitor(kFields[10], self.ranges);
+    visitor(kFields[11], self.intensities);
+}
+
 uint64_t MultiEchoLaserScan::_computeHash(const __lcm_hash_ptr *p)
 {
     const __lcm_hash_ptr *fp;
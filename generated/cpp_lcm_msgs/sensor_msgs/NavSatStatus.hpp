@@ -1,7 +1,7 @@
 /** THIS IS AN AUTOMATICALLY GENERATED FILE.  DO NOT MODIFY
  * BY HAND!!
  *
- * Generated by lcm-gen 1.5.2
+ * Generated by lcm-cpp (tools/cpp/gen)
  **/
 
 #ifndef __sensor_msgs_NavSatStatus_hpp__
@@ -9,6 +9,11 @@
 
 #include <lcm/lcm_coretypes.h>
 
+#include <array>
+#include "dimos_lcm/fixed_codec.hpp"
+#include "dimos_lcm/writer.hpp"
+#include "dimos_lcm/fingerprint.hpp"
+#include "dimos_lcm/reflection.hpp"
 
 namespace sensor_msgs
 {
@@ -74,11 +79,26 @@ class NavSatStatus
          */
         inline int encode(void *buf, int offset, int maxlen) const;
 
+        /**
+         * Encode a message by appending it to @p buf, walking the message once
+         * instead of sizing it with getEncodedSize() first. @p buf grows
+         * geometrically; reuse it across calls to avoid reallocating.
+         *
+         * @return The number of bytes appended.
+         */
+        inline int encodeTo(std::vector<uint8_t> &buf) const;
+
         /**
          * Check how many bytes are required to encode this message.
          */
         inline int getEncodedSize() const;
 
+        /**
+         * getEncodedSize() of every instance: the type has no strings or
+         * variable-length arrays.
+         */
+        static constexpr int kEncodedSize = 11;
+
         /**
          * Decode a message from binary form into this instance.
          *
@@ -97,18 +117,44 @@ class NavSatStatus
          */
         inline static int64_t getHash();
 
+        /**
+         * The fingerprint returned by getHash(), as a compile-time constant.
+         */
+        static constexpr int64_t kHash = static_cast<int64_t>(0xed646cb240eb83b6ULL);
+
         /**
          * Returns "NavSatStatus"
          */
         inline static const char* getTypeName();
 
+        /**
+         * Name, LCM type and array dimensions of each field, in wire order.
+         * See dimos_lcm::for_each_field() for visiting the fields themselves.
+         */
+        static constexpr std::array<dimos_lcm::field_info, 2> kFields = {{
+            { "status", "int8_t", true, 0, 0, NULL },
+            { "service", "int16_t", true, 0, 0, NULL },
+        }};
+
         // LCM support functions. Users should not call these
         inline int _encodeNoHash(void *buf, int offset, int maxlen) const;
+        template <typename Writer>
+        inline void _writeNoHash(Writer &out) const;
         inline int _getEncodedSizeNoHash() const;
         inline int _decodeNoHash(const void *buf, int offset, int maxlen);
+        template <typename Self, typename Visitor>
+        inline static void _forEachField(Self &self, Visitor &visitor);
+        inline static int _skipNoHash(const void *buf, int offset, int maxlen);
         inline static uint64_t _computeHash(const __lcm_hash_ptr *p);
 };
 
+static_assert(NavSatStatus::kHash == dimos_lcm::fingerprint(
+    dimos_lcm::signature_hash()
+        .member("status", "int8_t", 0)
+        .member("service", "int16_t", 0)
+        .value()),
+    "sensor_msgs::NavSatStatus fingerprint does not match its definition");
+
 int NavSatStatus::encode(void *buf, int offset, int maxlen) const
 {
     int pos = 0, tlen;
@@ -123,6 +169,15 @@ int NavSatStatus::encode(void *buf, int offset, int maxlen) const
     return pos;
 }
 
+int NavSatStatus::encodeTo(std::vector<uint8_t> &buf) const
+{
+    dimos_lcm::vector_writer out(buf);
+    int64_t hash = getHash();
+    out.put(&hash, 1);
+    this->_writeNoHash(out);
+    return static_cast<int>(out.size());
+}
+
 int NavSatStatus::decode(const void *buf, int offset, int maxlen)
 {
     int pos = 0, thislen;
@@ -145,8 +200,7 @@ int NavSatStatus::getEncodedSize() const
 
 int64_t NavSatStatus::getHash()
 {
-    static int64_t hash = static_cast<int64_t>(_computeHash(NULL));
-    return hash;
+    return kHash;
 }
 
 const char* NavSatStatus::getTypeName()
@@ -156,36 +210,43 @@ const char* NavSatStatus::getTypeName()
 
 int NavSatStatus::_encodeNoHash(void *buf, int offset, int maxlen) const
 {
-    int pos = 0, tlen;
-
-    tlen = __int8_t_encode_array(buf, offset + pos, maxlen - pos, &this->status, 1);
-    if(tlen < 0) return tlen; else pos += tlen;
-
-    tlen = __int16_t_encode_array(buf, offset + pos, maxlen - pos, &this->service, 1);
-    if(tlen < 0) return tlen; else pos += tlen;
+    if(maxlen < kEncodedSize - 8) return -1;
+    uint8_t *p = static_cast<uint8_t*>(buf) + offset;
+    dimos_lcm::store_be(p + 0, this->status);
+    dimos_lcm::store_be(p + 1, this->service);
+    return kEncodedSize - 8;
+}
 
-    return pos;
+template <typename Writer>
+void NavSatStatus::_writeNoHash(Writer &out) const
+{
+    out.putStruct(*this);
 }
 
 int NavSatStatus::_decodeNoHash(const void *buf, int offset, int maxlen)
 {
-    int pos = 0, tlen;
-
-    tlen = __int8_t_decode_array(buf, offset + pos, maxlen - pos, &this->status, 1);
-    if(tlen < 0) return tlen; else pos += tlen;
+    if(maxlen < kEncodedSize - 8) return -1;
+    const uint8_t *p = static_cast<const uint8_t*>(buf) + offset;
+    dimos_lcm::load_be(p + 0, this->status);
+    dimos_lcm::load_be(p + 1, this->service);
+    return kEncodedSize - 8;
+}
 
-    tlen = __int16_t_decode_array(buf, offset + pos, maxlen - pos, &this->service, 1);
-    if(tlen < 0) return tlen; else pos += tlen;
+int NavSatStatus::_getEncodedSizeNoHash() const
+{
+    return kEncodedSize - 8;
+}
 
-    return pos;
+int NavSatStatus::_skipNoHash(const void *, int, int maxlen)
+{
+    return maxlen < kEncodedSize - 8 ? -1 : kEncodedSize - 8;
 }
 
-int NavSatStatus::_getEncodedSizeNoHash() const
+template <typename Self, typename Visitor>
+void NavSatStatus::_forEachField(Self &self, Visitor &visitor)
 {
-    int enc_size = 0;
-    enc_size += __int8_t_encoded_array_size(NULL, 1);
-    enc_size += __int16_t_encoded_array_size(NULL, 1);
-    return enc_size;
+    visitor(kFields[0], self.status);
+    visitor(kFields[1], self.service);
 }
 
 uint64_t NavSatStatus::_computeHash(const __lcm_hash_ptr *)
@@ -0,0 +1,179 @@
+/** THIS IS AN AUTOMATICALLY GENERATED FILE.  DO NOT MODIFY
+ * BY HAND!!
+ *
+ * Generated by lcm-cpp (tools/cpp/gen)
+ **/
+
+#ifndef __sensor_msgs_PointCloud2View_hpp__
+#define __sensor_msgs_PointCloud2View_hpp__
+
+#include <lcm/lcm_coretypes.h>
+
+#include "dimos_lcm/view.hpp"
+#include "sensor_msgs/PointCloud2.hpp"
+#include "std_msgs/HeaderView.hpp"
+#include "sensor_msgs/PointFieldView.hpp"
+
+namespace sensor_msgs
+{
+
+/**
+ * Zero-copy read-only view of an encoded sensor_msgs.PointCloud2.
+ *
+ * Strings and variable-length arrays point into the buffer given to decode(),
+ * which must outlive the view. Decoding validates the whole message once and
+ * never allocates.
+ */
+class PointCloud2View
+{
+    public:
+        int32_t    fields_length;
+
+        int32_t    data_length;
+
+        std_msgs::HeaderView header;
+
+        int32_t    height;
+
+        int32_t    width;
+
+        /**
+         * LCM Type: sensor_msgs.PointField[fields_length]
+         */
+        dimos_lcm::view_array< sensor_msgs::PointFieldView > fields;
+
+        int8_t     is_bigendian;
+
+        int32_t    point_step;
+
+        int32_t    row_step;
+
+        /**
+         * LCM Type: byte[data_length]
+         */
+        dimos_lcm::span< const uint8_t > data;
+
+        int8_t     is_dense;
+
+    public:
+        /**
+         * Decode a view over a message in binary form.
+         *
+         * @param buf The buffer containing the encoded message. It must outlive
+         *  this view.
+         * @param offset The byte offset into @p buf where the encoded message starts.
+         * @param maxlen The maximum number of bytes to read while decoding.
+         * @return The number of bytes decoded, or <0 if an error occured.
+         */
+        inline int decode(const void *buf, int offset, int maxlen);
+
+        /**
+         * Copy the viewed message into an owning PointCloud2.
+         */
+        inline void copyTo(PointCloud2 &msg) const;
+
+        /**
+         * Returns PointCloud2::getHash()
+         */
+        inline static int64_t getHash();
+
+        /**
+         * Returns "PointCloud2"
+         */
+        inline static const char* getTypeName();
+
+        // LCM support functions. Users should not call these
+        inline int _decodeNoHash(const void *buf, int offset, int maxlen);
+};
+
+int PointCloud2View::decode(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, thislen;
+
+    int64_t msg_hash;
+    thislen = __int64_t_decode_array(buf, offset + pos, maxlen - pos, &msg_hash, 1);
+    if (thislen < 0) return thislen; else pos += thislen;
+    if (msg_hash != getHash()) return -1;
+
+    thislen = this->_decodeNoHash(buf, offset + pos, maxlen - pos);
+    if (thislen < 0) return thislen; else pos += thislen;
+
+    return pos;
+}
+
+void PointCloud2View::copyTo(PointCloud2 &msg) const
+{
+    msg.fields_length = this->fields_length;
+    msg.data_length = this->data_length;
+    this->header.copyTo(msg.header);
+    msg.height = this->height;
+    msg.width = this->width;
+    msg.fields.resize(this->fields.size());
+    {
+        int a0 = 0;
+        for (dimos_lcm::view_array< sensor_msgs::PointFieldView >::iterator it = this->fields.begin();
+            it != this->fields.end(); ++it, a0++)
+            it->copyTo(msg.fields[a0]);
+    }
+    msg.is_bigendian = this->is_bigendian;
+    msg.point_step = this->point_step;
+    msg.row_step = this->row_step;
+    msg.data.assign(this->data.begin(), this->data.end());
+    msg.is_dense = this->is_dense;
+}
+
+int64_t PointCloud2View::getHash()
+{
+    return PointCloud2::getHash();
+}
+
+const char* PointCloud2View::getTypeName()
+{
+    return "PointCloud2";
+}
+
+int PointCloud2View::_decodeNoHash(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, tlen;
+
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &this->fields_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &this->data_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = this->header._decodeNoHash(buf, offset + pos, maxlen - pos);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &this->height, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &this->width, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = this->fields._decodeNoHash(buf, offset + pos, maxlen - pos, this->fields_length);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = __boolean_decode_array(buf, offset + pos, maxlen - pos, &this->is_bigendian, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &this->point_step, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &this->row_step, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    if(this->data_length < 0 || this->data_length > maxlen - pos) return -1;
+    this->data = dimos_lcm::span< const uint8_t >(
+        static_cast<const uint8_t*>(buf) + offset + pos, this->data_length);
+    pos += this->data_length;
+
+    tlen = __boolean_decode_array(buf, offset + pos, maxlen - pos, &this->is_dense, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    return pos;
+}
+
+}
+
+#endif
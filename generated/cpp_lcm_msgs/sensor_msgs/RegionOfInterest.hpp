@@ -1,7 +1,7 @@
 /** THIS IS AN AUTOMATICALLY GENERATED FILE.  DO NOT MODIFY
  * BY HAND!!
  *
- * Generated by lcm-gen 1.5.2
+ * Generated by lcm-cpp (tools/cpp/gen)
  **/
 
 #ifndef __sensor_msgs_RegionOfInterest_hpp__
@@ -9,6 +9,11 @@
 
 #include <lcm/lcm_coretypes.h>
 
+#include <array>
+#include "dimos_lcm/fixed_codec.hpp"
+#include "dimos_lcm/writer.hpp"
+#include "dimos_lcm/fingerprint.hpp"
+#include "dimos_lcm/reflection.hpp"
 
 namespace sensor_msgs
 {
@@ -38,11 +43,26 @@ class RegionOfInterest
          */
         inline int encode(void *buf, int offset, int maxlen) const;
 
+        /**
+         * Encode a message by appending it to @p buf, walking the message once
+         * instead of sizing it with getEncodedSize() first. @p buf grows
+         * geometrically; reuse it across calls to avoid reallocating.
+         *
+         * @return The number of bytes appended.
+         */
+        inline int encodeTo(std::vector<uint8_t> &buf) const;
+
         /**
          * Check how many bytes are required to encode this message.
          */
         inline int getEncodedSize() const;
 
+        /**
+         * getEncodedSize() of every instance: the type has no strings or
+         * variable-length arrays.
+         */
+        static constexpr int kEncodedSize = 25;
+
         /**
          * Decode a message from binary form into this instance.
          *
@@ -61,18 +81,50 @@ class RegionOfInterest
          */
         inline static int64_t getHash();
 
+        /**
+         * The fingerprint returned by getHash(), as a compile-time constant.
+         */
+        static constexpr int64_t kHash = static_cast<int64_t>(0x73150d3a0b307e1cULL);
+
         /**
          * Returns "RegionOfInterest"
          */
         inline static const char* getTypeName();
 
+        /**
+         * Name, LCM type and array dimensions of each field, in wire order.
+         * See dimos_lcm::for_each_field() for visiting the fields themselves.
+         */
+        static constexpr std::array<dimos_lcm::field_info, 5> kFields = {{
+            { "x_offset", "int32_t", true, 0, 0, NULL },
+            { "y_offset", "int32_t", true, 0, 0, NULL },
+            { "height", "int32_t", true, 0, 0, NULL },
+            { "width", "int32_t", true, 0, 0, NULL },
+            { "do_rectify", "boolean", true, 0, 0, NULL },
+        }};
+
         // LCM support functions. Users should not call these
         inline int _encodeNoHash(void *buf, int offset, int maxlen) const;
+        template <typename Writer>
+        inline void _writeNoHash(Writer &out) const;
         inline int _getEncodedSizeNoHash() const;
         inline int _decodeNoHash(const void *buf, int offset, int maxlen);
+        template <typename Self, typename Visitor>
+        inline static void _forEachField(Self &self, Visitor &visitor);
+        inline static int _skipNoHash(const void *buf, int offset, int maxlen);
         inline static uint64_t _computeHash(const __lcm_hash_ptr *p);
 };
 
+static_assert(RegionOfInterest::kHash == dimos_lcm::fingerprint(
+    dimos_lcm::signature_hash()
+        .member("x_offset", "int32_t", 0)
+        .member("y_offset", "int32_t", 0)
+        .member("height", "int32_t", 0)
+        .member("width", "int32_t", 0)
+        .member("do_rectify", "boolean", 0)
+        .value()),
+    "sensor_msgs::RegionOfInterest fingerprint does not match its definition");
+
 int RegionOfInterest::encode(void *buf, int offset, int maxlen) const
 {
     int pos = 0, tlen;
@@ -87,6 +139,15 @@ int RegionOfInterest::encode(void *buf, int offset, int maxlen) const
     return pos;
 }
 
+int RegionOfInterest::encodeTo(std::vector<uint8_t> &buf) const
+{
+    dimos_lcm::vector_writer out(buf);
+    int64_t hash = getHash();
+    out.put(&hash, 1);
+    this->_writeNoHash(out);
+    return static_cast<int>(out.size());
+}
+
 int RegionOfInterest::decode(const void *buf, int offset, int maxlen)
 {
     int pos = 0, thislen;
@@ -109,8 +170,7 @@ int RegionOfInterest::getEncodedSize() const
 
 int64_t RegionOfInterest::getHash()
 {
-    static int64_t hash = static_cast<int64_t>(_computeHash(NULL));
-    return hash;
+    return kHash;
 }
 
 const char* RegionOfInterest::getTypeName()
@@ -120,57 +180,52 @@ const char* RegionOfInterest::getTypeName()
 
 int RegionOfInterest::_encodeNoHash(void *buf, int offset, int maxlen) const
 {
-    int pos = 0, tlen;
-
-    tlen = __int32_t_encode_array(buf, offset + pos, maxlen - pos, &this->x_offset, 1);
-    if(tlen < 0) return tlen; else pos += tlen;
-
-    tlen = __int32_t_encode_array(buf, offset + pos, maxlen - pos, &this->y_offset, 1);
-    if(tlen < 0) return tlen; else pos += tlen;
-
-    tlen = __int32_t_encode_array(buf, offset + pos, maxlen - pos, &this->height, 1);
-    if(tlen < 0) return tlen; else pos += tlen;
-
-    tlen = __int32_t_encode_array(buf, offset + pos, maxlen - pos, &this->width, 1);
-    if(tlen < 0) return tlen; else pos += tlen;
-
-    tlen = __boolean_encode_array(buf, offset + pos, maxlen - pos, &this->do_rectify, 1);
-    if(tlen < 0) return tlen; else pos += tlen;
+    if(maxlen < kEncodedSize - 8) return -1;
+    uint8_t *p = static_cast<uint8_t*>(buf) + offset;
+    dimos_lcm::store_be(p + 0, this->x_offset);
+    dimos_lcm::store_be(p + 4, this->y_offset);
+    dimos_lcm::store_be(p + 8, this->height);
+    dimos_lcm::store_be(p + 12, this->width);
+    dimos_lcm::store_be(p + 16, this->do_rectify);
+    return kEncodedSize - 8;
+}
 
-    return pos;
+template <typename Writer>
+void RegionOfInterest::_writeNoHash(Writer &out) const
+{
+    out.putStruct(*this);
 }
 
 int RegionOfInterest::_decodeNoHash(const void *buf, int offset, int maxlen)
 {
-    int pos = 0, tlen;
-
-    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &this->x_offset, 1);
-    if(tlen < 0) return tlen; else pos += tlen;
-
-    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &this->y_offset, 1);
-    if(tlen < 0) return tlen; else pos += tlen;
-
-    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &this->height, 1);
-    if(tlen < 0) return tlen; else pos += tlen;
-
-    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &this->width, 1);
-    if(tlen < 0) return tlen; else pos += tlen;
+    if(maxlen < kEncodedSize - 8) return -1;
+    const uint8_t *p = static_cast<const uint8_t*>(buf) + offset;
+    dimos_lcm::load_be(p + 0, this->x_offset);
+    dimos_lcm::load_be(p + 4, this->y_offset);
+    dimos_lcm::load_be(p + 8, this->height);
+    dimos_lcm::load_be(p + 12, this->width);
+    dimos_lcm::load_be(p + 16, this->do_rectify);
+    return kEncodedSize - 8;
+}
 
-    tlen = __boolean_decode_array(buf, offset + pos, maxlen - pos, &this->do_rectify, 1);
-    if(tlen < 0) return tlen; else pos += tlen;
+int RegionOfInterest::_getEncodedSizeNoHash() const
+{
+    return kEncodedSize - 8;
+}
 
-    return pos;
+int RegionOfInterest::_skipNoHash(const void *, int, int maxlen)
+{
+    return maxlen < kEncodedSize - 8 ? -1 : kEncodedSize - 8;
 }
 
-int RegionOfInterest::_getEncodedSizeNoHash() const
+template <typename Self, typename Visitor>
+void RegionOfInterest::_forEachField(Self &self, Visitor &visitor)
 {
-    int enc_size = 0;
-    enc_size += __int32_t_encoded_array_size(NULL, 1);
-    enc_size += __int32_t_encoded_array_size(NULL, 1);
-    enc_size += __int32_t_encoded_array_size(NULL, 1);
-    enc_size += __int32_t_encoded_array_size(NULL, 1);
-    enc_size += __boolean_encoded_array_size(NULL, 1);
-    return enc_size;
+    visitor(kFields[0], self.x_offset);
+    visitor(kFields[1], self.y_offset);
+    visitor(kFields[2], self.height);
+    visitor(kFields[3], self.width);
+    visitor(kFields[4], self.do_rectify);
 }
 
 uint64_t RegionOfInterest::_computeHash(const __lcm_hash_ptr *)
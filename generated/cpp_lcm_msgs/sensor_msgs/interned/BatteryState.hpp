@@ -0,0 +1,848 @@
+/** THIS IS AN AUTOMATICALLY GENERATED FILE.  DO NOT MODIFY
+ * BY HAND!!
+ *
+ * Generated by lcm-cpp (tools/cpp/gen)
+ **/
+
+#ifndef __sensor_msgs_interned_BatteryState_hpp__
+#define __sensor_msgs_interned_BatteryState_hpp__
+
+#include <lcm/lcm_coretypes.h>
+
+#include <array>
+#include <vector>
+#include <string>
+#include "dimos_lcm/bulk_codec.hpp"
+#include "dimos_lcm/writer.hpp"
+#include "dimos_lcm/fingerprint.hpp"
+#include "dimos_lcm/reflection.hpp"
+#include "std_msgs/interned/Header.hpp"
+#if __cplusplus >= 201703L
+#include "std_msgs/HeaderView.hpp"
+#endif
+
+namespace sensor_msgs
+{
+namespace interned
+{
+
+class BatteryState
+{
+    public:
+        int32_t    cell_voltage_length;
+
+        int32_t    cell_temperature_length;
+
+        std_msgs::interned::Header header;
+
+        float      voltage;
+
+        float      temperature;
+
+        float      current;
+
+        float      charge;
+
+        float      capacity;
+
+        float      design_capacity;
+
+        float      percentage;
+
+        uint8_t    power_supply_status;
+
+        uint8_t    power_supply_health;
+
+        uint8_t    power_supply_technology;
+
+        int8_t     present;
+
+        /**
+         * LCM Type: float[cell_voltage_length]
+         */
+        std::vector< float > cell_voltage;
+
+        /**
+         * LCM Type: float[cell_temperature_length]
+         */
+        std::vector< float > cell_temperature;
+
+        std::string location;
+
+        std::string serial_number;
+
+    public:
+        // If you're using C++11 and are getting compiler errors saying
+        // things like ‘constexpr’ needed for in-class initialization of
+        // static data member then re-run lcm-gen with '--cpp-std=c++11'
+        // to generate code that is compliant with C++11
+        static const int8_t   POWER_SUPPLY_STATUS_UNKNOWN = 0;
+        // If you're using C++11 and are getting compiler errors saying
+        // things like ‘constexpr’ needed for in-class initialization of
+        // static data member then re-run lcm-gen with '--cpp-std=c++11'
+        // to generate code that is compliant with C++11
+        static const int8_t   POWER_SUPPLY_STATUS_CHARGING = 1;
+        // If you're using C++11 and are getting compiler errors saying
+        // things like ‘constexpr’ needed for in-class initialization of
+        // static data member then re-run lcm-gen with '--cpp-std=c++11'
+        // to generate code that is compliant with C++11
+        static const int8_t   POWER_SUPPLY_STATUS_DISCHARGING = 2;
+        // If you're using C++11 and are getting compiler errors saying
+        // things like ‘constexpr’ needed for in-class initialization of
+        // static data member then re-run lcm-gen with '--cpp-std=c++11'
+        // to generate code that is compliant with C++11
+        static const int8_t   POWER_SUPPLY_STATUS_NOT_CHARGING = 3;
+        // If you're using C++11 and are getting compiler errors saying
+        // things like ‘constexpr’ needed for in-class initialization of
+        // static data member then re-run lcm-gen with '--cpp-std=c++11'
+        // to generate code that is compliant with C++11
+        static const int8_t   POWER_SUPPLY_STATUS_FULL = 4;
+        // If you're using C++11 and are getting compiler errors saying
+        // things like ‘constexpr’ needed for in-class initialization of
+        // static data member then re-run lcm-gen with '--cpp-std=c++11'
+        // to generate code that is compliant with C++11
+        static const int8_t   POWER_SUPPLY_HEALTH_UNKNOWN = 0;
+        // If you're using C++11 and are getting compiler errors saying
+        // things like ‘constexpr’ needed for in-class initialization of
+        // static data member then re-run lcm-gen with '--cpp-std=c++11'
+        // to generate code that is compliant with C++11
+        static const int8_t   POWER_SUPPLY_HEALTH_GOOD = 1;
+        // If you're using C++11 and are getting compiler errors saying
+        // things like ‘constexpr’ needed for in-class initialization of
+        // static data member then re-run lcm-gen with '--cpp-std=c++11'
+        // to generate code that is compliant with C++11
+        static const int8_t   POWER_SUPPLY_HEALTH_OVERHEAT = 2;
+        // If you're using C++11 and are getting compiler errors saying
+        // things like ‘constexpr’ needed for in-class initialization of
+        // static data member then re-run lcm-gen with '--cpp-std=c++11'
+        // to generate code that is compliant with C++11
+        static const int8_t   POWER_SUPPLY_HEALTH_DEAD = 3;
+        // If you're using C++11 and are getting compiler errors saying
+        // things like ‘constexpr’ needed for in-class initialization of
+        // static data member then re-run lcm-gen with '--cpp-std=c++11'
+        // to generate code that is compliant with C++11
+        static const int8_t   POWER_SUPPLY_HEALTH_OVERVOLTAGE = 4;
+        // If you're using C++11 and are getting compiler errors saying
+        // things like ‘constexpr’ needed for in-class initialization of
+        // static data member then re-run lcm-gen with '--cpp-std=c++11'
+        // to generate code that is compliant with C++11
+        static const int8_t   POWER_SUPPLY_HEALTH_UNSPEC_FAILURE = 5;
+        // If you're using C++11 and are getting compiler errors saying
+        // things like ‘constexpr’ needed for in-class initialization of
+        // static data member then re-run lcm-gen with '--cpp-std=c++11'
+        // to generate code that is compliant with C++11
+        static const int8_t   POWER_SUPPLY_HEALTH_COLD = 6;
+        // If you're using C++11 and are getting compiler errors saying
+        // things like ‘constexpr’ needed for in-class initialization of
+        // static data member then re-run lcm-gen with '--cpp-std=c++11'
+        // to generate code that is compliant with C++11
+        static const int8_t   POWER_SUPPLY_HEALTH_WATCHDOG_TIMER_EXPIRE = 7;
+        // If you're using C++11 and are getting compiler errors saying
+        // things like ‘constexpr’ needed for in-class initialization of
+        // static data member then re-run lcm-gen with '--cpp-std=c++11'
+        // to generate code that is compliant with C++11
+        static const int8_t   POWER_SUPPLY_HEALTH_SAFETY_TIMER_EXPIRE = 8;
+        // If you're using C++11 and are getting compiler errors saying
+        // things like ‘constexpr’ needed for in-class initialization of
+        // static data member then re-run lcm-gen with '--cpp-std=c++11'
+        // to generate code that is compliant with C++11
+        static const int8_t   POWER_SUPPLY_TECHNOLOGY_UNKNOWN = 0;
+        // If you're using C++11 and are getting compiler errors saying
+        // things like ‘constexpr’ needed for in-class initialization of
+        // static data member then re-run lcm-gen with '--cpp-std=c++11'
+        // to generate code that is compliant with C++11
+        static const int8_t   POWER_SUPPLY_TECHNOLOGY_NIMH = 1;
+        // If you're using C++11 and are getting compiler errors saying
+        // things like ‘constexpr’ needed for in-class initialization of
+        // static data member then re-run lcm-gen with '--cpp-std=c++11'
+        // to generate code that is compliant with C++11
+        static const int8_t   POWER_SUPPLY_TECHNOLOGY_LION = 2;
+        // If you're using C++11 and are getting compiler errors saying
+        // things like ‘constexpr’ needed for in-class initialization of
+        // static data member then re-run lcm-gen with '--cpp-std=c++11'
+        // to generate code that is compliant with C++11
+        static const int8_t   POWER_SUPPLY_TECHNOLOGY_LIPO = 3;
+        // If you're using C++11 and are getting compiler errors saying
+        // things like ‘constexpr’ needed for in-class initialization of
+        // static data member then re-run lcm-gen with '--cpp-std=c++11'
+        // to generate code that is compliant with C++11
+        static const int8_t   POWER_SUPPLY_TECHNOLOGY_LIFE = 4;
+        // If you're using C++11 and are getting compiler errors saying
+        // things like ‘constexpr’ needed for in-class initialization of
+        // static data member then re-run lcm-gen with '--cpp-std=c++11'
+        // to generate code that is compliant with C++11
+        static const int8_t   POWER_SUPPLY_TECHNOLOGY_NICD = 5;
+        // If you're using C++11 and are getting compiler errors saying
+        // things like ‘constexpr’ needed for in-class initialization of
+        // static data member then re-run lcm-gen with '--cpp-std=c++11'
+        // to generate code that is compliant with C++11
+        static const int8_t   POWER_SUPPLY_TECHNOLOGY_LIMN = 6;
+
+    public:
+        /**
+         * Encode a message into binary form.
+         *
+         * @param buf The output buffer.
+         * @param offset Encoding starts at thie byte offset into @p buf.
+         * @param maxlen Maximum number of bytes to write.  This should generally be
+         *  equal to getEncodedSize().
+         * @return The number of bytes encoded, or <0 on error.
+         */
+        inline int encode(void *buf, int offset, int maxlen) const;
+
+        /**
+         * Encode a message by appending it to @p buf, walking the message once
+         * instead of sizing it with getEncodedSize() first. @p buf grows
+         * geometrically; reuse it across calls to avoid reallocating.
+         *
+         * @return The number of bytes appended.
+         */
+        inline int encodeTo(std::vector<uint8_t> &buf) const;
+
+        /**
+         * Check how many bytes are required to encode this message.
+         */
+        inline int getEncodedSize() const;
+
+        /**
+         * Decode a message from binary form into this instance.
+         *
+         * @param buf The buffer containing the encoded message.
+         * @param offset The byte offset into @p buf where the encoded message starts.
+         * @param maxlen The maximum number of bytes to read while decoding.
+         * @return The number of bytes decoded, or <0 if an error occured.
+         */
+        inline int decode(const void *buf, int offset, int maxlen);
+
+#if __cplusplus >= 201703L
+        /**
+         * Decode only the header field of an encoded message, leaving the
+         * rest of it untouched. The field sits at a fixed offset, so this costs
+         * the same for any payload size. The view points into @p buf.
+         *
+         * @param buf The buffer containing the encoded message.
+         * @param offset The byte offset into @p buf where the encoded message starts.
+         * @param maxlen The maximum number of bytes to read while decoding.
+         * @param header Receives the decoded header.
+         * @return The number of bytes of the field decoded, or <0 if @p buf does
+         *  not hold a BatteryState or is truncated.
+         *
+         * Needs C++17, for the std::string_view of the view.
+         */
+        inline static int peekHeader(const void *buf, int offset, int maxlen, std_msgs::HeaderView &header);
+#endif
+
+        /**
+         * Field bits for decodeFields().
+         */
+        struct Fields
+        {
+            static constexpr uint64_t cell_voltage_length = 1ULL << 0;
+            static constexpr uint64_t cell_temperature_length = 1ULL << 1;
+            static constexpr uint64_t header = 1ULL << 2;
+            static constexpr uint64_t voltage = 1ULL << 3;
+            static constexpr uint64_t temperature = 1ULL << 4;
+            static constexpr uint64_t current = 1ULL << 5;
+            static constexpr uint64_t charge = 1ULL << 6;
+            static constexpr uint64_t capacity = 1ULL << 7;
+            static constexpr uint64_t design_capacity = 1ULL << 8;
+            static constexpr uint64_t percentage = 1ULL << 9;
+            static constexpr uint64_t power_supply_status = 1ULL << 10;
+            static constexpr uint64_t power_supply_health = 1ULL << 11;
+            static constexpr uint64_t power_supply_technology = 1ULL << 12;
+            static constexpr uint64_t present = 1ULL << 13;
+            static constexpr uint64_t cell_voltage = 1ULL << 14;
+            static constexpr uint64_t cell_temperature = 1ULL << 15;
+            static constexpr uint64_t location = 1ULL << 16;
+            static constexpr uint64_t serial_number = 1ULL << 17;
+            static constexpr uint64_t all = (1ULL << 18) - 1;
+        };
+
+        /**
+         * Decode only the fields selected by @p Mask, a bitwise or of Fields
+         * values. Strings, arrays and nested structs that are not selected are
+         * skipped over by their length prefixes without being allocated, and
+         * keep their previous value. Scalar fields are always decoded: they
+         * cost nothing to read and array lengths depend on them.
+         *
+         * @return The number of bytes decoded, or <0 if an error occured.
+         */
+        template <uint64_t Mask>
+        inline int decodeFields(const void *buf, int offset, int maxlen);
+
+        /**
+         * Upper bound on the length of every variable-length array of this
+         * type, checked by decode() before anything is allocated; messages
+         * exceeding it fail to decode. It does not apply to nested types,
+         * which have their own. Set it once at startup, before decoding.
+         * Before C++17 it is a constant with no limit.
+         */
+#if __cplusplus >= 201703L
+        static inline int32_t maxArrayLength = INT32_MAX;
+#else
+        static constexpr int32_t maxArrayLength = INT32_MAX;
+#endif
+
+        /**
+         * Retrieve the 64-bit fingerprint identifying the structure of the message.
+         * Note that the fingerprint is the same for all instances of the same
+         * message type, and is a fingerprint on the message type definition, not on
+         * the message contents.
+         */
+        inline static int64_t getHash();
+
+        /**
+         * The fingerprint returned by getHash(), as a compile-time constant.
+         */
+        static constexpr int64_t kHash = static_cast<int64_t>(0x7e3961fd10438489ULL);
+
+        /**
+         * Returns "BatteryState"
+         */
+        inline static const char* getTypeName();
+
+        /**
+         * Name, LCM type and array dimensions of each field, in wire order.
+         * See dimos_lcm::for_each_field() for visiting the fields themselves.
+         */
+        static constexpr std::array<dimos_lcm::field_info, 18> kFields = {{
+            { "cell_voltage_length", "int32_t", true, 0, 0, NULL },
+            { "cell_temperature_length", "int32_t", true, 0, 0, NULL },
+            { "header", "std_msgs.Header", false, 0, 0, NULL },
+            { "voltage", "float", true, 0, 0, NULL },
+            { "temperature", "float", true, 0, 0, NULL },
+            { "current", "float", true, 0, 0, NULL },
+            { "charge", "float", true, 0, 0, NULL },
+            { "capacity", "float", true, 0, 0, NULL },
+            { "design_capacity", "float", true, 0, 0, NULL },
+            { "percentage", "float", true, 0, 0, NULL },
+            { "power_supply_status", "byte", true, 0, 0, NULL },
+            { "power_supply_health", "byte", true, 0, 0, NULL },
+            { "power_supply_technology", "byte", true, 0, 0, NULL },
+            { "present", "boolean", true, 0, 0, NULL },
+            { "cell_voltage", "float", true, 1, -1, "cell_voltage_length" },
+            { "cell_temperature", "float", true, 1, -1, "cell_temperature_length" },
+            { "location", "string", true, 0, 0, NULL },
+            { "serial_number", "string", true, 0, 0, NULL },
+        }};
+
+        // LCM support functions. Users should not call these
+        inline int _encodeNoHash(void *buf, int offset, int maxlen) const;
+        template <typename Writer>
+        inline void _writeNoHash(Writer &out) const;
+        inline int _getEncodedSizeNoHash() const;
+        inline int _decodeNoHash(const void *buf, int offset, int maxlen);
+        template <uint64_t Mask>
+        inline int _decodeFieldsNoHash(const void *buf, int offset, int maxlen);
+        template <typename Self, typename Visitor>
+        inline static void _forEachField(Self &self, Visitor &visitor);
+        inline static int _skipNoHash(const void *buf, int offset, int maxlen);
+        inline static uint64_t _computeHash(const __lcm_hash_ptr *p);
+};
+
+static_assert(BatteryState::kHash == dimos_lcm::fingerprint(
+    dimos_lcm::signature_hash()
+        .member("cell_voltage_length", "int32_t", 0)
+        .member("cell_temperature_length", "int32_t", 0)
+        .member("header", NULL, 0)
+        .member("voltage", "float", 0)
+        .member("temperature", "float", 0)
+        .member("current", "float", 0)
+        .member("charge", "float", 0)
+        .member("capacity", "float", 0)
+        .member("design_capacity", "float", 0)
+        .member("percentage", "float", 0)
+        .member("power_supply_status", "byte", 0)
+        .member("power_supply_health", "byte", 0)
+        .member("power_supply_technology", "byte", 0)
+        .member("present", "boolean", 0)
+        .member("cell_voltage", "float", 1).dim(true, "cell_voltage_length")
+        .member("cell_temperature", "float", 1).dim(true, "cell_temperature_length")
+        .member("location", "string", 0)
+        .member("serial_number", "string", 0)
+        .value(),
+    std_msgs::interned::Header::kHash),
+    "sensor_msgs::interned::BatteryState fingerprint does not match its definition");
+
+int BatteryState::encode(void *buf, int offset, int maxlen) const
+{
+    int pos = 0, tlen;
+    int64_t hash = getHash();
+
+    tlen = __int64_t_encode_array(buf, offset + pos, maxlen - pos, &hash, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = this->_encodeNoHash(buf, offset + pos, maxlen - pos);
+    if (tlen < 0) return tlen; else pos += tlen;
+
+    return pos;
+}
+
+int BatteryState::encodeTo(std::vector<uint8_t> &buf) const
+{
+    dimos_lcm::vector_writer out(buf);
+    int64_t hash = getHash();
+    out.put(&hash, 1);
+    this->_writeNoHash(out);
+    return static_cast<int>(out.size());
+}
+
+int BatteryState::decode(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, thislen;
+
+    int64_t msg_hash;
+    thislen = __int64_t_decode_array(buf, offset + pos, maxlen - pos, &msg_hash, 1);
+    if (thislen < 0) return thislen; else pos += thislen;
+    if (msg_hash != getHash()) return -1;
+
+    thislen = this->_decodeNoHash(buf, offset + pos, maxlen - pos);
+    if (thislen < 0) return thislen; else pos += thislen;
+
+    return pos;
+}
+
+#if __cplusplus >= 201703L
+int BatteryState::peekHeader(const void *buf, int offset, int maxlen, std_msgs::HeaderView &header)
+{
+    int64_t msg_hash;
+    if (__int64_t_decode_array(buf, offset, maxlen, &msg_hash, 1) < 0) return -1;
+    if (msg_hash != kHash) return -1;
+
+    // header follows the hash and 8 bytes of fixed-size fields
+    return header._decodeNoHash(buf, offset + 16, maxlen - 16);
+}
+#endif
+
+template <uint64_t Mask>
+int BatteryState::decodeFields(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, thislen;
+
+    int64_t msg_hash;
+    thislen = __int64_t_decode_array(buf, offset + pos, maxlen - pos, &msg_hash, 1);
+    if (thislen < 0) return thislen; else pos += thislen;
+    if (msg_hash != getHash()) return -1;
+
+    thislen = this->_decodeFieldsNoHash<Mask>(buf, offset + pos, maxlen - pos);
+    if (thislen < 0) return thislen; else pos += thislen;
+
+    return pos;
+}
+
+int BatteryState::getEncodedSize() const
+{
+    return 8 + _getEncodedSizeNoHash();
+}
+
+int64_t BatteryState::getHash()
+{
+    return kHash;
+}
+
+const char* BatteryState::getTypeName()
+{
+    return "BatteryState";
+}
+
+int BatteryState::_encodeNoHash(void *buf, int offset, int maxlen) const
+{
+    int pos = 0, tlen;
+
+    tlen = __int32_t_encode_array(buf, offset + pos, maxlen - pos, &this->cell_voltage_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = __int32_t_encode_array(buf, offset + pos, maxlen - pos, &this->cell_temperature_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = this->header._encodeNoHash(buf, offset + pos, maxlen - pos);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = __float_encode_array(buf, offset + pos, maxlen - pos, &this->voltage, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = __float_encode_array(buf, offset + pos, maxlen - pos, &this->temperature, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = __float_encode_array(buf, offset + pos, maxlen - pos, &this->current, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = __float_encode_array(buf, offset + pos, maxlen - pos, &this->charge, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = __float_encode_array(buf, offset + pos, maxlen - pos, &this->capacity, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = __float_encode_array(buf, offset + pos, maxlen - pos, &this->design_capacity, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = __float_encode_array(buf, offset + pos, maxlen - pos, &this->percentage, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = __byte_encode_array(buf, offset + pos, maxlen - pos, &this->power_supply_status, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = __byte_encode_array(buf, offset + pos, maxlen - pos, &this->power_supply_health, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = __byte_encode_array(buf, offset + pos, maxlen - pos, &this->power_supply_technology, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = __boolean_encode_array(buf, offset + pos, maxlen - pos, &this->present, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    if(this->cell_voltage_length > 0) {
+        tlen = dimos_lcm::bulk_encode_array(buf, offset + pos, maxlen - pos, &this->cell_voltage[0], this->cell_voltage_length);
+        if(tlen < 0) return tlen; else pos += tlen;
+    }
+
+    if(this->cell_temperature_length > 0) {
+        tlen = dimos_lcm::bulk_encode_array(buf, offset + pos, maxlen - pos, &this->cell_temperature[0], this->cell_temperature_length);
+        if(tlen < 0) return tlen; else pos += tlen;
+    }
+
+    char* location_cstr = const_cast<char*>(this->location.c_str());
+    tlen = __string_encode_array(
+        buf, offset + pos, maxlen - pos, &location_cstr, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    char* serial_number_cstr = const_cast<char*>(this->serial_number.c_str());
+    tlen = __string_encode_array(
+        buf, offset + pos, maxlen - pos, &serial_number_cstr, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    return pos;
+}
+
+template <typename Writer>
+void BatteryState::_writeNoHash(Writer &out) const
+{
+    out.put(&this->cell_voltage_length, 1);
+    out.put(&this->cell_temperature_length, 1);
+    this->header._writeNoHash(out);
+    out.put(&this->voltage, 1);
+    out.put(&this->temperature, 1);
+    out.put(&this->current, 1);
+    out.put(&this->charge, 1);
+    out.put(&this->capacity, 1);
+    out.put(&this->design_capacity, 1);
+    out.put(&this->percentage, 1);
+    out.put(&this->power_supply_status, 1);
+    out.put(&this->power_supply_health, 1);
+    out.put(&this->power_supply_technology, 1);
+    out.put(&this->present, 1);
+    if(this->cell_voltage_length > 0)
+        out.put(&this->cell_voltage[0], this->cell_voltage_length);
+    if(this->cell_temperature_length > 0)
+        out.put(&this->cell_temperature[0], this->cell_temperature_length);
+    out.put(this->location);
+    out.put(this->serial_number);
+}
+
+int BatteryState::_decodeNoHash(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, tlen;
+
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &this->cell_voltage_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &this->cell_temperature_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = this->header._decodeNoHash(buf, offset + pos, maxlen - pos);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = __float_decode_array(buf, offset + pos, maxlen - pos, &this->voltage, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = __float_decode_array(buf, offset + pos, maxlen - pos, &this->temperature, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = __float_decode_array(buf, offset + pos, maxlen - pos, &this->current, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = __float_decode_array(buf, offset + pos, maxlen - pos, &this->charge, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = __float_decode_array(buf, offset + pos, maxlen - pos, &this->capacity, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = __float_decode_array(buf, offset + pos, maxlen - pos, &this->design_capacity, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = __float_decode_array(buf, offset + pos, maxlen - pos, &this->percentage, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = __byte_decode_array(buf, offset + pos, maxlen - pos, &this->power_supply_status, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = __byte_decode_array(buf, offset + pos, maxlen - pos, &this->power_supply_health, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = __byte_decode_array(buf, offset + pos, maxlen - pos, &this->power_supply_technology, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = __boolean_decode_array(buf, offset + pos, maxlen - pos, &this->present, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    if(this->cell_voltage_length) {
+        if(this->cell_voltage_length < 0 || this->cell_voltage_length > (maxlen - pos) / 4 || this->cell_voltage_length > maxArrayLength) return -1;
+        this->cell_voltage.resize(this->cell_voltage_length);
+        tlen = dimos_lcm::bulk_decode_array(buf, offset + pos, maxlen - pos, &this->cell_voltage[0], this->cell_voltage_length);
+        if(tlen < 0) return tlen; else pos += tlen;
+    } else {
+        this->cell_voltage.clear();
+    }
+
+    if(this->cell_temperature_length) {
+        if(this->cell_temperature_length < 0 || this->cell_temperature_length > (maxlen - pos) / 4 || this->cell_temperature_length > maxArrayLength) return -1;
+        this->cell_temperature.resize(this->cell_temperature_length);
+        tlen = dimos_lcm::bulk_decode_array(buf, offset + pos, maxlen - pos, &this->cell_temperature[0], this->cell_temperature_length);
+        if(tlen < 0) return tlen; else pos += tlen;
+    } else {
+        this->cell_temperature.clear();
+    }
+
+    int32_t __location_len__;
+    tlen = __int32_t_decode_array(
+        buf, offset + pos, maxlen - pos, &__location_len__, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+    if(__location_len__ < 1 || __location_len__ > maxlen - pos) return -1;
+    this->location.assign(
+        static_cast<const char*>(buf) + offset + pos, __location_len__ - 1);
+    pos += __location_len__;
+
+    int32_t __serial_number_len__;
+    tlen = __int32_t_decode_array(
+        buf, offset + pos, maxlen - pos, &__serial_number_len__, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+    if(__serial_number_len__ < 1 || __serial_number_len__ > maxlen - pos) return -1;
+    this->serial_number.assign(
+        static_cast<const char*>(buf) + offset + pos, __serial_number_len__ - 1);
+    pos += __serial_number_len__;
+
+    return pos;
+}
+
+template <uint64_t Mask>
+int BatteryState::_decodeFieldsNoHash(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, tlen;
+
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &this->cell_voltage_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &this->cell_temperature_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    if ((Mask & Fields::header) != 0) {
+        tlen = this->header._decodeNoHash(buf, offset + pos, maxlen - pos);
+        if(tlen < 0) return tlen; else pos += tlen;
+    } else {
+        tlen = std_msgs::interned::Header::_skipNoHash(buf, offset + pos, maxlen - pos);
+        if(tlen < 0) return tlen; else pos += tlen;
+    }
+
+    tlen = __float_decode_array(buf, offset + pos, maxlen - pos, &this->voltage, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = __float_decode_array(buf, offset + pos, maxlen - pos, &this->temperature, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = __float_decode_array(buf, offset + pos, maxlen - pos, &this->current, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = __float_decode_array(buf, offset + pos, maxlen - pos, &this->charge, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = __float_decode_array(buf, offset + pos, maxlen - pos, &this->capacity, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = __float_decode_array(buf, offset + pos, maxlen - pos, &this->design_capacity, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = __float_decode_array(buf, offset + pos, maxlen - pos, &this->percentage, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = __byte_decode_array(buf, offset + pos, maxlen - pos, &this->power_supply_status, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = __byte_decode_array(buf, offset + pos, maxlen - pos, &this->power_supply_health, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = __byte_decode_array(buf, offset + pos, maxlen - pos, &this->power_supply_technology, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = __boolean_decode_array(buf, offset + pos, maxlen - pos, &this->present, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    if ((Mask & Fields::cell_voltage) != 0) {
+        if(this->cell_voltage_length) {
+            if(this->cell_voltage_length < 0 || this->cell_voltage_length > (maxlen - pos) / 4 || this->cell_voltage_length > maxArrayLength) return -1;
+            this->cell_voltage.resize(this->cell_voltage_length);
+            tlen = dimos_lcm::bulk_decode_array(buf, offset + pos, maxlen - pos, &this->cell_voltage[0], this->cell_voltage_length);
+            if(tlen < 0) return tlen; else pos += tlen;
+        } else {
+            this->cell_voltage.clear();
+        }
+    } else {
+        if(this->cell_voltage_length < 0 || this->cell_voltage_length > (maxlen - pos) / 4) return -1;
+        pos += this->cell_voltage_length * 4;
+    }
+
+    if ((Mask & Fields::cell_temperature) != 0) {
+        if(this->cell_temperature_length) {
+            if(this->cell_temperature_length < 0 || this->cell_temperature_length > (maxlen - pos) / 4 || this->cell_temperature_length > maxArrayLength) return -1;
+            this->cell_temperature.resize(this->cell_temperature_length);
+            tlen = dimos_lcm::bulk_decode_array(buf, offset + pos, maxlen - pos, &this->cell_temperature[0], this->cell_temperature_length);
+            if(tlen < 0) return tlen; else pos += tlen;
+        } else {
+            this->cell_temperature.clear();
+        }
+    } else {
+        if(this->cell_temperature_length < 0 || this->cell_temperature_length > (maxlen - pos) / 4) return -1;
+        pos += this->cell_temperature_length * 4;
+    }
+
+    if ((Mask & Fields::location) != 0) {
+        int32_t __location_len__;
+        tlen = __int32_t_decode_array(
+            buf, offset + pos, maxlen - pos, &__location_len__, 1);
+        if(tlen < 0) return tlen; else pos += tlen;
+        if(__location_len__ < 1 || __location_len__ > maxlen - pos) return -1;
+        this->location.assign(
+            static_cast<const char*>(buf) + offset + pos, __location_len__ - 1);
+        pos += __location_len__;
+    } else {
+        int32_t __location_len__;
+        tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &__location_len__, 1);
+        if(tlen < 0) return tlen; else pos += tlen;
+        if(__location_len__ < 0 || __location_len__ > maxlen - pos) return -1;
+        pos += __location_len__;
+    }
+
+    if ((Mask & Fields::serial_number) != 0) {
+        int32_t __serial_number_len__;
+        tlen = __int32_t_decode_array(
+            buf, offset + pos, maxlen - pos, &__serial_number_len__, 1);
+        if(tlen < 0) return tlen; else pos += tlen;
+        if(__serial_number_len__ < 1 || __serial_number_len__ > maxlen - pos) return -1;
+        this->serial_number.assign(
+            static_cast<const char*>(buf) + offset + pos, __serial_number_len__ - 1);
+        pos += __serial_number_len__;
+    } else {
+        int32_t __serial_number_len__;
+        tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &__serial_number_len__, 1);
+        if(tlen < 0) return tlen; else pos += tlen;
+        if(__serial_number_len__ < 0 || __serial_number_len__ > maxlen - pos) return -1;
+        pos += __serial_number_len__;
+    }
+
+    return pos;
+}
+
+int BatteryState::_getEncodedSizeNoHash() const
+{
+    int enc_size = 0;
+    enc_size += __int32_t_encoded_array_size(NULL, 1);
+    enc_size += __int32_t_encoded_array_size(NULL, 1);
+    enc_size += this->header._getEncodedSizeNoHash();
+    enc_size += __float_encoded_array_size(NULL, 1);
+    enc_size += __float_encoded_array_size(NULL, 1);
+    enc_size += __float_encoded_array_size(NULL, 1);
+    enc_size += __float_encoded_array_size(NULL, 1);
+    enc_size += __float_encoded_array_size(NULL, 1);
+    enc_size += __float_encoded_array_size(NULL, 1);
+    enc_size += __float_encoded_array_size(NULL, 1);
+    enc_size += __byte_encoded_array_size(NULL, 1);
+    enc_size += __byte_encoded_array_size(NULL, 1);
+    enc_size += __byte_encoded_array_size(NULL, 1);
+    enc_size += __boolean_encoded_array_size(NULL, 1);
+    enc_size += __float_encoded_array_size(NULL, this->cell_voltage_length);
+    enc_size += __float_encoded_array_size(NULL, this->cell_temperature_length);
+    enc_size += this->location.size() + 4 + 1;
+    enc_size += this->serial_number.size() + 4 + 1;
+    return enc_size;
+}
+
+int BatteryState::_skipNoHash(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, tlen;
+    int32_t cell_voltage_length;
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &cell_voltage_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+    int32_t cell_temperature_length;
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &cell_temperature_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+    tlen = std_msgs::interned::Header::_skipNoHash(buf, offset + pos, maxlen - pos);
+    if(tlen < 0) return tlen; else pos += tlen;
+    pos += 4;
+    pos += 4;
+    pos += 4;
+    pos += 4;
+    pos += 4;
+    pos += 4;
+    pos += 4;
+    pos += 1;
+    pos += 1;
+    pos += 1;
+    pos += 1;
+    if(cell_voltage_length < 0 || cell_voltage_length > (maxlen - pos) / 4) return -1;
+    pos += cell_voltage_length * 4;
+    if(cell_temperature_length < 0 || cell_temperature_length > (maxlen - pos) / 4) return -1;
+    pos += cell_temperature_length * 4;
+    int32_t __location_len__;
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &__location_len__, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+    if(__location_len__ < 0 || __location_len__ > maxlen - pos) return -1;
+    pos += __location_len__;
+    int32_t __serial_number_len__;
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &__serial_number_len__, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+    if(__serial_number_len__ < 0 || __serial_number_len__ > maxlen - pos) return -1;
+    pos += __serial_number_len__;
+    if(pos > maxlen) return -1;
+    return pos;
+}
+
+template <typename Self, typename Visitor>
+void BatteryState::_forEachField(Self &self, Visitor &visitor)
+{
+    visitor(kFields[0], self.cell_voltage_length);
+    visitor(kFields[1], self.cell_temperature_length);
+    visitor(kFields[2], self.header);
+    visitor(kFields[3], self.voltage);
+    visitor(kFields[4], self.temperature);
+    visitor(kFields[5], self.current);
+    visitor(kFields[6], self.charge);
+    visitor(kFields[7], self.capacity);
+    visitor(kFields[8], self.design_capacity);
+    visitor(kFields[9], self.percentage);
+    visitor(kFields[10], self.power_supply_status);
+    visitor(kFields[11], self.power_supply_health);
+    visitor(kFields[12], self.power_supply_technology);
+    visitor(kFields[13], self.present);
+    visitor(kFields[14], self.cell_voltage);
+    visitor(kFields[15], self.cell_temperature);
+    visitor(kFields[16], self.location);
+    visitor(kFields[17], self.serial_number);
+}
+
+uint64_t BatteryState::_computeHash(const __lcm_hash_ptr *p)
+{
+    const __lcm_hash_ptr *fp;
+    for(fp = p; fp != NULL; fp = fp->parent)
+        if(fp->v == BatteryState::getHash)
+            return 0;
+    const __lcm_hash_ptr cp = { p, BatteryState::getHash };
+
+    uint64_t hash = 0x8f419fb94c3b774dLL +
+         std_msgs::interned::Header::_computeHash(&cp);
+
+    return (hash<<1) + ((hash>>63)&1);
+}
+
+}
+}
+
+#endif
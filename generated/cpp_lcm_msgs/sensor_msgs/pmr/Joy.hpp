@@ -0,0 +1,493 @@
+/** THIS IS AN AUTOMATICALLY GENERATED FILE.  DO NOT MODIFY
+ * BY HAND!!
+ *
+ * Generated by lcm-cpp (tools/cpp/gen)
+ **/
+
+#ifndef __sensor_msgs_pmr_Joy_hpp__
+#define __sensor_msgs_pmr_Joy_hpp__
+
+#include <lcm/lcm_coretypes.h>
+
+#include <array>
+#include <memory_resource>
+#include <utility>
+#include <vector>
+#include "dimos_lcm/bulk_codec.hpp"
+#include "dimos_lcm/writer.hpp"
+#include "dimos_lcm/fingerprint.hpp"
+#include "dimos_lcm/reflection.hpp"
+#include "std_msgs/pmr/Header.hpp"
+#if __cplusplus >= 201703L
+#include "std_msgs/HeaderView.hpp"
+#endif
+
+namespace sensor_msgs
+{
+namespace pmr
+{
+
+class Joy
+{
+    public:
+        int32_t    axes_length;
+
+        int32_t    buttons_length;
+
+        std_msgs::pmr::Header header;
+
+        /**
+         * LCM Type: float[axes_length]
+         */
+        std::pmr::vector< float > axes;
+
+        /**
+         * LCM Type: int32_t[buttons_length]
+         */
+        std::pmr::vector< int32_t > buttons;
+
+    public:
+        typedef std::pmr::polymorphic_allocator<char> allocator_type;
+
+        /**
+         * Construct a message whose strings and arrays, and those of the
+         * messages it nests, allocate from @p alloc. Scalars are zeroed.
+         */
+        inline explicit Joy(const allocator_type &alloc = allocator_type());
+
+        /**
+         * Copy or move @p other into a message that allocates from @p alloc.
+         * With allocator_type, these let std::pmr containers of Joy pass
+         * their memory resource on to their elements.
+         */
+        inline Joy(const Joy &other, const allocator_type &alloc);
+        inline Joy(Joy &&other, const allocator_type &alloc);
+
+        /**
+         * Encode a message into binary form.
+         *
+         * @param buf The output buffer.
+         * @param offset Encoding starts at thie byte offset into @p buf.
+         * @param maxlen Maximum number of bytes to write.  This should generally be
+         *  equal to getEncodedSize().
+         * @return The number of bytes encoded, or <0 on error.
+         */
+        inline int encode(void *buf, int offset, int maxlen) const;
+
+        /**
+         * Encode a message by appending it to @p buf, walking the message once
+         * instead of sizing it with getEncodedSize() first. @p buf grows
+         * geometrically; reuse it across calls to avoid reallocating.
+         *
+         * @return The number of bytes appended.
+         */
+        inline int encodeTo(std::vector<uint8_t> &buf) const;
+
+        /**
+         * Check how many bytes are required to encode this message.
+         */
+        inline int getEncodedSize() const;
+
+        /**
+         * Decode a message from binary form into this instance.
+         *
+         * @param buf The buffer containing the encoded message.
+         * @param offset The byte offset into @p buf where the encoded message starts.
+         * @param maxlen The maximum number of bytes to read while decoding.
+         * @return The number of bytes decoded, or <0 if an error occured.
+         */
+        inline int decode(const void *buf, int offset, int maxlen);
+
+#if __cplusplus >= 201703L
+        /**
+         * Decode only the header field of an encoded message, leaving the
+         * rest of it untouched. The field sits at a fixed offset, so this costs
+         * the same for any payload size. The view points into @p buf.
+         *
+         * @param buf The buffer containing the encoded message.
+         * @param offset The byte offset into @p buf where the encoded message starts.
+         * @param maxlen The maximum number of bytes to read while decoding.
+         * @param header Receives the decoded header.
+         * @return The number of bytes of the field decoded, or <0 if @p buf does
+         *  not hold a Joy or is truncated.
+         *
+         * Needs C++17, for the std::string_view of the view.
+         */
+        inline static int peekHeader(const void *buf, int offset, int maxlen, std_msgs::HeaderView &header);
+#endif
+
+        /**
+         * Field bits for decodeFields().
+         */
+        struct Fields
+        {
+            static constexpr uint64_t axes_length = 1ULL << 0;
+            static constexpr uint64_t buttons_length = 1ULL << 1;
+            static constexpr uint64_t header = 1ULL << 2;
+            static constexpr uint64_t axes = 1ULL << 3;
+            static constexpr uint64_t buttons = 1ULL << 4;
+            static constexpr uint64_t all = (1ULL << 5) - 1;
+        };
+
+        /**
+         * Decode only the fields selected by @p Mask, a bitwise or of Fields
+         * values. Strings, arrays and nested structs that are not selected are
+         * skipped over by their length prefixes without being allocated, and
+         * keep their previous value. Scalar fields are always decoded: they
+         * cost nothing to read and array lengths depend on them.
+         *
+         * @return The number of bytes decoded, or <0 if an error occured.
+         */
+        template <uint64_t Mask>
+        inline int decodeFields(const void *buf, int offset, int maxlen);
+
+        /**
+         * Upper bound on the length of every variable-length array of this
+         * type, checked by decode() before anything is allocated; messages
+         * exceeding it fail to decode. It does not apply to nested types,
+         * which have their own. Set it once at startup, before decoding.
+         * Before C++17 it is a constant with no limit.
+         */
+#if __cplusplus >= 201703L
+        static inline int32_t maxArrayLength = INT32_MAX;
+#else
+        static constexpr int32_t maxArrayLength = INT32_MAX;
+#endif
+
+        /**
+         * Retrieve the 64-bit fingerprint identifying the structure of the message.
+         * Note that the fingerprint is the same for all instances of the same
+         * message type, and is a fingerprint on the message type definition, not on
+         * the message contents.
+         */
+        inline static int64_t getHash();
+
+        /**
+         * The fingerprint returned by getHash(), as a compile-time constant.
+         */
+        static constexpr int64_t kHash = static_cast<int64_t>(0xa0f07abc86c1684cULL);
+
+        /**
+         * Returns "Joy"
+         */
+        inline static const char* getTypeName();
+
+        /**
+         * Name, LCM type and array dimensions of each field, in wire order.
+         * See dimos_lcm::for_each_field() for visiting the fields themselves.
+         */
+        static constexpr std::array<dimos_lcm::field_info, 5> kFields = {{
+            { "axes_length", "int32_t", true, 0, 0, NULL },
+            { "buttons_length", "int32_t", true, 0, 0, NULL },
+            { "header", "std_msgs.Header", false, 0, 0, NULL },
+            { "axes", "float", true, 1, -1, "axes_length" },
+            { "buttons", "int32_t", true, 1, -1, "buttons_length" },
+        }};
+
+        // LCM support functions. Users should not call these
+        inline int _encodeNoHash(void *buf, int offset, int maxlen) const;
+        template <typename Writer>
+        inline void _writeNoHash(Writer &out) const;
+        inline int _getEncodedSizeNoHash() const;
+        inline int _decodeNoHash(const void *buf, int offset, int maxlen);
+        template <uint64_t Mask>
+        inline int _decodeFieldsNoHash(const void *buf, int offset, int maxlen);
+        template <typename Self, typename Visitor>
+        inline static void _forEachField(Self &self, Visitor &visitor);
+        inline static int _skipNoHash(const void *buf, int offset, int maxlen);
+        inline static uint64_t _computeHash(const __lcm_hash_ptr *p);
+};
+
+static_assert(Joy::kHash == dimos_lcm::fingerprint(
+    dimos_lcm::signature_hash()
+        .member("axes_length", "int32_t", 0)
+        .member("buttons_length", "int32_t", 0)
+        .member("header", NULL, 0)
+        .member("axes", "float", 1).dim(true, "axes_length")
+        .member("buttons", "int32_t", 1).dim(true, "buttons_length")
+        .value(),
+    std_msgs::pmr::Header::kHash),
+    "sensor_msgs::pmr::Joy fingerprint does not match its definition");
+
+Joy::Joy(const allocator_type &alloc) :
+    axes_length(),
+    buttons_length(),
+    header(alloc),
+    axes(alloc),
+    buttons(alloc)
+{
+}
+
+Joy::Joy(const Joy &other, const allocator_type &alloc) :
+    Joy(alloc)
+{
+    *this = other;
+}
+
+Joy::Joy(Joy &&other, const allocator_type &alloc) :
+    Joy(alloc)
+{
+    *this = std::move(other);
+}
+
+int Joy::encode(void *buf, int offset, int maxlen) const
+{
+    int pos = 0, tlen;
+    int64_t hash = getHash();
+
+    tlen = __int64_t_encode_array(buf, offset + pos, maxlen - pos, &hash, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = this->_encodeNoHash(buf, offset + pos, maxlen - pos);
+    if (tlen < 0) return tlen; else pos += tlen;
+
+    return pos;
+}
+
+int Joy::encodeTo(std::vector<uint8_t> &buf) const
+{
+    dimos_lcm::vector_writer out(buf);
+    int64_t hash = getHash();
+    out.put(&hash, 1);
+    this->_writeNoHash(out);
+    return static_cast<int>(out.size());
+}
+
+int Joy::decode(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, thislen;
+
+    int64_t msg_hash;
+    thislen = __int64_t_decode_array(buf, offset + pos, maxlen - pos, &msg_hash, 1);
+    if (thislen < 0) return thislen; else pos += thislen;
+    if (msg_hash != getHash()) return -1;
+
+    thislen = this->_decodeNoHash(buf, offset + pos, maxlen - pos);
+    if (thislen < 0) return thislen; else pos += thislen;
+
+    return pos;
+}
+
+#if __cplusplus >= 201703L
+int Joy::peekHeader(const void *buf, int offset, int maxlen, std_msgs::HeaderView &header)
+{
+    int64_t msg_hash;
+    if (__int64_t_decode_array(buf, offset, maxlen, &msg_hash, 1) < 0) return -1;
+    if (msg_hash != kHash) return -1;
+
+    // header follows the hash and 8 bytes of fixed-size fields
+    return header._decodeNoHash(buf, offset + 16, maxlen - 16);
+}
+#endif
+
+template <uint64_t Mask>
+int Joy::decodeFields(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, thislen;
+
+    int64_t msg_hash;
+    thislen = __int64_t_decode_array(buf, offset + pos, maxlen - pos, &msg_hash, 1);
+    if (thislen < 0) return thislen; else pos += thislen;
+    if (msg_hash != getHash()) return -1;
+
+    thislen = this->_decodeFieldsNoHash<Mask>(buf, offset + pos, maxlen - pos);
+    if (thislen < 0) return thislen; else pos += thislen;
+
+    return pos;
+}
+
+int Joy::getEncodedSize() const
+{
+    return 8 + _getEncodedSizeNoHash();
+}
+
+int64_t Joy::getHash()
+{
+    return kHash;
+}
+
+const char* Joy::getTypeName()
+{
+    return "Joy";
+}
+
+int Joy::_encodeNoHash(void *buf, int offset, int maxlen) const
+{
+    int pos = 0, tlen;
+
+    tlen = __int32_t_encode_array(buf, offset + pos, maxlen - pos, &this->axes_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = __int32_t_encode_array(buf, offset + pos, maxlen - pos, &this->buttons_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = this->header._encodeNoHash(buf, offset + pos, maxlen - pos);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    if(this->axes_length > 0) {
+        tlen = dimos_lcm::bulk_encode_array(buf, offset + pos, maxlen - pos, &this->axes[0], this->axes_length);
+        if(tlen < 0) return tlen; else pos += tlen;
+    }
+
+    if(this->buttons_length > 0) {
+        tlen = dimos_lcm::bulk_encode_array(buf, offset + pos, maxlen - pos, &this->buttons[0], this->buttons_length);
+        if(tlen < 0) return tlen; else pos += tlen;
+    }
+
+    return pos;
+}
+
+template <typename Writer>
+void Joy::_writeNoHash(Writer &out) const
+{
+    out.put(&this->axes_length, 1);
+    out.put(&this->buttons_length, 1);
+    this->header._writeNoHash(out);
+    if(this->axes_length > 0)
+        out.put(&this->axes[0], this->axes_length);
+    if(this->buttons_length > 0)
+        out.put(&this->buttons[0], this->buttons_length);
+}
+
+int Joy::_decodeNoHash(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, tlen;
+
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &this->axes_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &this->buttons_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = this->header._decodeNoHash(buf, offset + pos, maxlen - pos);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    if(this->axes_length) {
+        if(this->axes_length < 0 || this->axes_length > (maxlen - pos) / 4 || this->axes_length > maxArrayLength) return -1;
+        this->axes.resize(this->axes_length);
+        tlen = dimos_lcm::bulk_decode_array(buf, offset + pos, maxlen - pos, &this->axes[0], this->axes_length);
+        if(tlen < 0) return tlen; else pos += tlen;
+    } else {
+        this->axes.clear();
+    }
+
+    if(this->buttons_length) {
+        if(this->buttons_length < 0 || this->buttons_length > (maxlen - pos) / 4 || this->buttons_length > maxArrayLength) return -1;
+        this->buttons.resize(this->buttons_length);
+        tlen = dimos_lcm::bulk_decode_array(buf, offset + pos, maxlen - pos, &this->buttons[0], this->buttons_length);
+        if(tlen < 0) return tlen; else pos += tlen;
+    } else {
+        this->buttons.clear();
+    }
+
+    return pos;
+}
+
+template <uint64_t Mask>
+int Joy::_decodeFieldsNoHash(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, tlen;
+
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &this->axes_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &this->buttons_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    if ((Mask & Fields::header) != 0) {
+        tlen = this->header._decodeNoHash(buf, offset + pos, maxlen - pos);
+        if(tlen < 0) return tlen; else pos += tlen;
+    } else {
+        tlen = std_msgs::pmr::Header::_skipNoHash(buf, offset + pos, maxlen - pos);
+        if(tlen < 0) return tlen; else pos += tlen;
+    }
+
+    if ((Mask & Fields::axes) != 0) {
+        if(this->axes_length) {
+            if(this->axes_length < 0 || this->axes_length > (maxlen - pos) / 4 || this->axes_length > maxArrayLength) return -1;
+            this->axes.resize(this->axes_length);
+            tlen = dimos_lcm::bulk_decode_array(buf, offset + pos, maxlen - pos, &this->axes[0], this->axes_length);
+            if(tlen < 0) return tlen; else pos += tlen;
+        } else {
+            this->axes.clear();
+        }
+    } else {
+        if(this->axes_length < 0 || this->axes_length > (maxlen - pos) / 4) return -1;
+        pos += this->axes_length * 4;
+    }
+
+    if ((Mask & Fields::buttons) != 0) {
+        if(this->buttons_length) {
+            if(this->buttons_length < 0 || this->buttons_length > (maxlen - pos) / 4 || this->buttons_length > maxArrayLength) return -1;
+            this->buttons.resize(this->buttons_length);
+            tlen = dimos_lcm::bulk_decode_array(buf, offset + pos, maxlen - pos, &this->buttons[0], this->buttons_length);
+            if(tlen < 0) return tlen; else pos += tlen;
+        } else {
+            this->buttons.clear();
+        }
+    } else {
+        if(this->buttons_length < 0 || this->buttons_length > (maxlen - pos) / 4) return -1;
+        pos += this->buttons_length * 4;
+    }
+
+    return pos;
+}
+
+int Joy::_getEncodedSizeNoHash() const
+{
+    int enc_size = 0;
+    enc_size += __int32_t_encoded_array_size(NULL, 1);
+    enc_size += __int32_t_encoded_array_size(NULL, 1);
+    enc_size += this->header._getEncodedSizeNoHash();
+    enc_size += __float_encoded_array_size(NULL, this->axes_length);
+    enc_size += __int32_t_encoded_array_size(NULL, this->buttons_length);
+    return enc_size;
+}
+
+int Joy::_skipNoHash(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, tlen;
+    int32_t axes_length;
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &axes_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+    int32_t buttons_length;
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &buttons_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+    tlen = std_msgs::pmr::Header::_skipNoHash(buf, offset + pos, maxlen - pos);
+    if(tlen < 0) return tlen; else pos += tlen;
+    if(axes_length < 0 || axes_length > (maxlen - pos) / 4) return -1;
+    pos += axes_length * 4;
+    if(buttons_length < 0 || buttons_length > (maxlen - pos) / 4) return -1;
+    pos += buttons_length * 4;
+    if(pos > maxlen) return -1;
+    return pos;
+}
+
+template <typename Self, typename Visitor>
+void Joy::_forEachField(Self &self, Visitor &visitor)
+{
+    visitor(kFields[0], self.axes_length);
+    visitor(kFields[1], self.buttons_length);
+    visitor(kFields[2], self.header);
+    visitor(kFields[3], self.axes);
+    visitor(kFields[4], self.buttons);
+}
+
+uint64_t Joy::_computeHash(const __lcm_hash_ptr *p)
+{
+    const __lcm_hash_ptr *fp;
+    for(fp = p; fp != NULL; fp = fp->parent)
+        if(fp->v == Joy::getHash)
+            return 0;
+    const __lcm_hash_ptr cp = { p, Joy::getHash };
+
+    uint64_t hash = 0x209d2c19077a692fLL +
+         std_msgs::pmr::Header::_computeHash(&cp);
+
+    return (hash<<1) + ((hash>>63)&1);
+}
+
+}
+}
+
+#endif
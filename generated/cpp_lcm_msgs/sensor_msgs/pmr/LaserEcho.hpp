@@ -0,0 +1,361 @@
+/** THIS IS AN AUTOMATICALLY GENERATED FILE.  DO NOT MODIFY
+ * BY HAND!!
+ *
+ * Generated by lcm-cpp (tools/cpp/gen)
+ **/
+
+#ifndef __sensor_msgs_pmr_LaserEcho_hpp__
+#define __sensor_msgs_pmr_LaserEcho_hpp__
+
+#include <lcm/lcm_coretypes.h>
+
+#include <array>
+#include <memory_resource>
+#include <utility>
+#include <vector>
+#include "dimos_lcm/bulk_codec.hpp"
+#include "dimos_lcm/writer.hpp"
+#include "dimos_lcm/fingerprint.hpp"
+#include "dimos_lcm/reflection.hpp"
+
+namespace sensor_msgs
+{
+namespace pmr
+{
+
+class LaserEcho
+{
+    public:
+        int32_t    echoes_length;
+
+        /**
+         * LCM Type: float[echoes_length]
+         */
+        std::pmr::vector< float > echoes;
+
+    public:
+        typedef std::pmr::polymorphic_allocator<char> allocator_type;
+
+        /**
+         * Construct a message whose strings and arrays, and those of the
+         * messages it nests, allocate from @p alloc. Scalars are zeroed.
+         */
+        inline explicit LaserEcho(const allocator_type &alloc = allocator_type());
+
+        /**
+         * Copy or move @p other into a message that allocates from @p alloc.
+         * With allocator_type, these let std::pmr containers of LaserEcho pass
+         * their memory resource on to their elements.
+         */
+        inline LaserEcho(const LaserEcho &other, const allocator_type &alloc);
+        inline LaserEcho(LaserEcho &&other, const allocator_type &alloc);
+
+        /**
+         * Encode a message into binary form.
+         *
+         * @param buf The output buffer.
+         * @param offset Encoding starts at thie byte offset into @p buf.
+         * @param maxlen Maximum number of bytes to write.  This should generally be
+         *  equal to getEncodedSize().
+         * @return The number of bytes encoded, or <0 on error.
+         */
+        inline int encode(void *buf, int offset, int maxlen) const;
+
+        /**
+         * Encode a message by appending it to @p buf, walking the message once
+         * instead of sizing it with getEncodedSize() first. @p buf grows
+         * geometrically; reuse it across calls to avoid reallocating.
+         *
+         * @return The number of bytes appended.
+         */
+        inline int encodeTo(std::vector<uint8_t> &buf) const;
+
+        /**
+         * Check how many bytes are required to encode this message.
+         */
+        inline int getEncodedSize() const;
+
+        /**
+         * Decode a message from binary form into this instance.
+         *
+         * @param buf The buffer containing the encoded message.
+         * @param offset The byte offset into @p buf where the encoded message starts.
+         * @param maxlen The maximum number of bytes to read while decoding.
+         * @return The number of bytes decoded, or <0 if an error occured.
+         */
+        inline int decode(const void *buf, int offset, int maxlen);
+
+        /**
+         * Field bits for decodeFields().
+         */
+        struct Fields
+        {
+            static constexpr uint64_t echoes_length = 1ULL << 0;
+            static constexpr uint64_t echoes = 1ULL << 1;
+            static constexpr uint64_t all = (1ULL << 2) - 1;
+        };
+
+        /**
+         * Decode only the fields selected by @p Mask, a bitwise or of Fields
+         * values. Strings, arrays and nested structs that are not selected are
+         * skipped over by their length prefixes without being allocated, and
+         * keep their previous value. Scalar fields are always decoded: they
+         * cost nothing to read and array lengths depend on them.
+         *
+         * @return The number of bytes decoded, or <0 if an error occured.
+         */
+        template <uint64_t Mask>
+        inline int decodeFields(const void *buf, int offset, int maxlen);
+
+        /**
+         * Upper bound on the length of every variable-length array of this
+         * type, checked by decode() before anything is allocated; messages
+         * exceeding it fail to decode. It does not apply to nested types,
+         * which have their own. Set it once at startup, before decoding.
+         * Before C++17 it is a constant with no limit.
+         */
+#if __cplusplus >= 201703L
+        static inline int32_t maxArrayLength = INT32_MAX;
+#else
+        static constexpr int32_t maxArrayLength = INT32_MAX;
+#endif
+
+        /**
+         * Retrieve the 64-bit fingerprint identifying the structure of the message.
+         * Note that the fingerprint is the same for all instances of the same
+         * message type, and is a fingerprint on the message type definition, not on
+         * the message contents.
+         */
+        inline static int64_t getHash();
+
+        /**
+         * The fingerprint returned by getHash(), as a compile-time constant.
+         */
+        static constexpr int64_t kHash = static_cast<int64_t>(0x88ae0422d8fa145dULL);
+
+        /**
+         * Returns "LaserEcho"
+         */
+        inline static const char* getTypeName();
+
+        /**
+         * Name, LCM type and array dimensions of each field, in wire order.
+         * See dimos_lcm::for_each_field() for visiting the fields themselves.
+         */
+        static constexpr std::array<dimos_lcm::field_info, 2> kFields = {{
+            { "echoes_length", "int32_t", true, 0, 0, NULL },
+            { "echoes", "float", true, 1, -1, "echoes_length" },
+        }};
+
+        // LCM support functions. Users should not call these
+        inline int _encodeNoHash(void *buf, int offset, int maxlen) const;
+        template <typename Writer>
+        inline void _writeNoHash(Writer &out) const;
+        inline int _getEncodedSizeNoHash() const;
+        inline int _decodeNoHash(const void *buf, int offset, int maxlen);
+        template <uint64_t Mask>
+        inline int _decodeFieldsNoHash(const void *buf, int offset, int maxlen);
+        template <typename Self, typename Visitor>
+        inline static void _forEachField(Self &self, Visitor &visitor);
+        inline static int _skipNoHash(const void *buf, int offset, int maxlen);
+        inline static uint64_t _computeHash(const __lcm_hash_ptr *p);
+};
+
+static_assert(LaserEcho::kHash == dimos_lcm::fingerprint(
+    dimos_lcm::signature_hash()
+        .member("echoes_length", "int32_t", 0)
+        .member("echoes", "float", 1).dim(true, "echoes_length")
+        .value()),
+    "sensor_msgs::pmr::LaserEcho fingerprint does not match its definition");
+
+LaserEcho::LaserEcho(const allocator_type &alloc) :
+    echoes_length(),
+    echoes(alloc)
+{
+}
+
+LaserEcho::LaserEcho(const LaserEcho &other, const allocator_type &alloc) :
+    LaserEcho(alloc)
+{
+    *this = other;
+}
+
+LaserEcho::LaserEcho(LaserEcho &&other, const allocator_type &alloc) :
+    LaserEcho(alloc)
+{
+    *this = std::move(other);
+}
+
+int LaserEcho::encode(void *buf, int offset, int maxlen) const
+{
+    int pos = 0, tlen;
+    int64_t hash = getHash();
+
+    tlen = __int64_t_encode_array(buf, offset + pos, maxlen - pos, &hash, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = this->_encodeNoHash(buf, offset + pos, maxlen - pos);
+    if (tlen < 0) return tlen; else pos += tlen;
+
+    return pos;
+}
+
+int LaserEcho::encodeTo(std::vector<uint8_t> &buf) const
+{
+    dimos_lcm::vector_writer out(buf);
+    int64_t hash = getHash();
+    out.put(&hash, 1);
+    this->_writeNoHash(out);
+    return static_cast<int>(out.size());
+}
+
+int LaserEcho::decode(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, thislen;
+
+    int64_t msg_hash;
+    thislen = __int64_t_decode_array(buf, offset + pos, maxlen - pos, &msg_hash, 1);
+    if (thislen < 0) return thislen; else pos += thislen;
+    if (msg_hash != getHash()) return -1;
+
+    thislen = this->_decodeNoHash(buf, offset + pos, maxlen - pos);
+    if (thislen < 0) return thislen; else pos += thislen;
+
+    return pos;
+}
+
+template <uint64_t Mask>
+int LaserEcho::decodeFields(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, thislen;
+
+    int64_t msg_hash;
+    thislen = __int64_t_decode_array(buf, offset + pos, maxlen - pos, &msg_hash, 1);
+    if (thislen < 0) return thislen; else pos += thislen;
+    if (msg_hash != getHash()) return -1;
+
+    thislen = this->_decodeFieldsNoHash<Mask>(buf, offset + pos, maxlen - pos);
+    if (thislen < 0) return thislen; else pos += thislen;
+
+    return pos;
+}
+
+int LaserEcho::getEncodedSize() const
+{
+    return 8 + _getEncodedSizeNoHash();
+}
+
+int64_t LaserEcho::getHash()
+{
+    return kHash;
+}
+
+const char* LaserEcho::getTypeName()
+{
+    return "LaserEcho";
+}
+
+int LaserEcho::_encodeNoHash(void *buf, int offset, int maxlen) const
+{
+    int pos = 0, tlen;
+
+    tlen = __int32_t_encode_array(buf, offset + pos, maxlen - pos, &this->echoes_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    if(this->echoes_length > 0) {
+        tlen = dimos_lcm::bulk_encode_array(buf, offset + pos, maxlen - pos, &this->echoes[0], this->echoes_length);
+        if(tlen < 0) return tlen; else pos += tlen;
+    }
+
+    return pos;
+}
+
+template <typename Writer>
+void LaserEcho::_writeNoHash(Writer &out) const
+{
+    out.put(&this->echoes_length, 1);
+    if(this->echoes_length > 0)
+        out.put(&this->echoes[0], this->echoes_length);
+}
+
+int LaserEcho::_decodeNoHash(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, tlen;
+
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &this->echoes_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    if(this->echoes_length) {
+        if(this->echoes_length < 0 || this->echoes_length > (maxlen - pos) / 4 || this->echoes_length > maxArrayLength) return -1;
+        this->echoes.resize(this->echoes_length);
+        tlen = dimos_lcm::bulk_decode_array(buf, offset + pos, maxlen - pos, &this->echoes[0], this->echoes_length);
+        if(tlen < 0) return tlen; else pos += tlen;
+    } else {
+        this->echoes.clear();
+    }
+
+    return pos;
+}
+
+template <uint64_t Mask>
+int LaserEcho::_decodeFieldsNoHash(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, tlen;
+
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &this->echoes_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    if ((Mask & Fields::echoes) != 0) {
+        if(this->echoes_length) {
+            if(this->echoes_length < 0 || this->echoes_length > (maxlen - pos) / 4 || this->echoes_length > maxArrayLength) return -1;
+            this->echoes.resize(this->echoes_length);
+            tlen = dimos_lcm::bulk_decode_array(buf, offset + pos, maxlen - pos, &this->echoes[0], this->echoes_length);
+            if(tlen < 0) return tlen; else pos += tlen;
+        } else {
+            this->echoes.clear();
+        }
+    } else {
+        if(this->echoes_length < 0 || this->echoes_length > (maxlen - pos) / 4) return -1;
+        pos += this->echoes_length * 4;
+    }
+
+    return pos;
+}
+
+int LaserEcho::_getEncodedSizeNoHash() const
+{
+    int enc_size = 0;
+    enc_size += __int32_t_encoded_array_size(NULL, 1);
+    enc_size += __float_encoded_array_size(NULL, this->echoes_length);
+    return enc_size;
+}
+
+int LaserEcho::_skipNoHash(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, tlen;
+    int32_t echoes_length;
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &echoes_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+    if(echoes_length < 0 || echoes_length > (maxlen - pos) / 4) return -1;
+    pos += echoes_length * 4;
+    if(pos > maxlen) return -1;
+    return pos;
+}
+
+template <typename Self, typename Visitor>
+void LaserEcho::_forEachField(Self &self, Visitor &visitor)
+{
+    visitor(kFields[0], self.echoes_length);
+    visitor(kFields[1], self.echoes);
+}
+
+uint64_t LaserEcho::_computeHash(const __lcm_hash_ptr *)
+{
+    uint64_t hash = 0xc45702116c7d0a2eLL;
+    return (hash<<1) + ((hash>>63)&1);
+}
+
+}
+}
+
+#endif
@@ -0,0 +1,23 @@
+/** THIS IS AN AUTOMATICALLY GENERATED FILE.  DO NOT MODIFY
+ * BY HAND!!
+ *
+ * Generated by lcm-cpp (tools/cpp/gen)
+ **/
+
+#ifndef __sensor_msgs_pmr_RegionOfInterest_hpp__
+#define __sensor_msgs_pmr_RegionOfInterest_hpp__
+
+#include "sensor_msgs/RegionOfInterest.hpp"
+
+namespace sensor_msgs
+{
+namespace pmr
+{
+
+// RegionOfInterest has no strings or variable-length arrays, so it never allocates
+typedef sensor_msgs::RegionOfInterest RegionOfInterest;
+
+}
+}
+
+#endif
@@ -0,0 +1,596 @@
+/** THIS IS AN AUTOMATICALLY GENERATED FILE.  DO NOT MODIFY
+ * BY HAND!!
+ *
+ * Generated by lcm-cpp (tools/cpp/gen)
+ **/
+
+#ifndef __sensor_msgs_soa_MultiDOFJointState_hpp__
+#define __sensor_msgs_soa_MultiDOFJointState_hpp__
+
+#include <lcm/lcm_coretypes.h>
+
+#include <array>
+#include <vector>
+#include <string>
+#include "dimos_lcm/writer.hpp"
+#include "dimos_lcm/fingerprint.hpp"
+#include "dimos_lcm/reflection.hpp"
+#include "std_msgs/Header.hpp"
+#include "geometry_msgs/TransformColumns.hpp"
+#include "geometry_msgs/TwistColumns.hpp"
+#include "geometry_msgs/WrenchColumns.hpp"
+#if __cplusplus >= 201703L
+#include "std_msgs/HeaderView.hpp"
+#endif
+
+namespace sensor_msgs
+{
+namespace soa
+{
+
+class MultiDOFJointState
+{
+    public:
+        int32_t    joint_names_length;
+
+        int32_t    transforms_length;
+
+        int32_t    twist_length;
+
+        int32_t    wrench_length;
+
+        std_msgs::Header header;
+
+        /**
+         * LCM Type: string[joint_names_length]
+         */
+        std::vector< std::string > joint_names;
+
+        /**
+         * LCM Type: geometry_msgs.Transform[transforms_length]
+         */
+        geometry_msgs::TransformColumns transforms;
+
+        /**
+         * LCM Type: geometry_msgs.Twist[twist_length]
+         */
+        geometry_msgs::TwistColumns twist;
+
+        /**
+         * LCM Type: geometry_msgs.Wrench[wrench_length]
+         */
+        geometry_msgs::WrenchColumns wrench;
+
+    public:
+        /**
+         * Encode a message into binary form.
+         *
+         * @param buf The output buffer.
+         * @param offset Encoding starts at thie byte offset into @p buf.
+         * @param maxlen Maximum number of bytes to write.  This should generally be
+         *  equal to getEncodedSize().
+         * @return The number of bytes encoded, or <0 on error.
+         */
+        inline int encode(void *buf, int offset, int maxlen) const;
+
+        /**
+         * Encode a message by appending it to @p buf, walking the message once
+         * instead of sizing it with getEncodedSize() first. @p buf grows
+         * geometrically; reuse it across calls to avoid reallocating.
+         *
+         * @return The number of bytes appended.
+         */
+        inline int encodeTo(std::vector<uint8_t> &buf) const;
+
+        /**
+         * Check how many bytes are required to encode this message.
+         */
+        inline int getEncodedSize() const;
+
+        /**
+         * Decode a message from binary form into this instance.
+         *
+         * @param buf The buffer containing the encoded message.
+         * @param offset The byte offset into @p buf where the encoded message starts.
+         * @param maxlen The maximum number of bytes to read while decoding.
+         * @return The number of bytes decoded, or <0 if an error occured.
+         */
+        inline int decode(const void *buf, int offset, int maxlen);
+
+#if __cplusplus >= 201703L
+        /**
+         * Decode only the header field of an encoded message, leaving the
+         * rest of it untouched. The field sits at a fixed offset, so this costs
+         * the same for any payload size. The view points into @p buf.
+         *
+         * @param buf The buffer containing the encoded message.
+         * @param offset The byte offset into @p buf where the encoded message starts.
+         * @param maxlen The maximum number of bytes to read while decoding.
+         * @param header Receives the decoded header.
+         * @return The number of bytes of the field decoded, or <0 if @p buf does
+         *  not hold a MultiDOFJointState or is truncated.
+         *
+         * Needs C++17, for the std::string_view of the view.
+         */
+        inline static int peekHeader(const void *buf, int offset, int maxlen, std_msgs::HeaderView &header);
+#endif
+
+        /**
+         * Field bits for decodeFields().
+         */
+        struct Fields
+        {
+            static constexpr uint64_t joint_names_length = 1ULL << 0;
+            static constexpr uint64_t transforms_length = 1ULL << 1;
+            static constexpr uint64_t twist_length = 1ULL << 2;
+            static constexpr uint64_t wrench_length = 1ULL << 3;
+            static constexpr uint64_t header = 1ULL << 4;
+            static constexpr uint64_t joint_names = 1ULL << 5;
+            static constexpr uint64_t transforms = 1ULL << 6;
+            static constexpr uint64_t twist = 1ULL << 7;
+            static constexpr uint64_t wrench = 1ULL << 8;
+            static constexpr uint64_t all = (1ULL << 9) - 1;
+        };
+
+        /**
+         * Decode only the fields selected by @p Mask, a bitwise or of Fields
+         * values. Strings, arrays and nested structs that are not selected are
+         * skipped over by their length prefixes without being allocated, and
+         * keep their previous value. Scalar fields are always decoded: they
+         * cost nothing to read and array lengths depend on them.
+         *
+         * @return The number of bytes decoded, or <0 if an error occured.
+         */
+        template <uint64_t Mask>
+        inline int decodeFields(const void *buf, int offset, int maxlen);
+
+        /**
+         * Upper bound on the length of every variable-length array of this
+         * type, checked by decode() before anything is allocated; messages
+         * exceeding it fail to decode. It does not apply to nested types,
+         * which have their own. Set it once at startup, before decoding.
+         * Before C++17 it is a constant with no limit.
+         */
+#if __cplusplus >= 201703L
+        static inline int32_t maxArrayLength = INT32_MAX;
+#else
+        static constexpr int32_t maxArrayLength = INT32_MAX;
+#endif
+
+        /**
+         * Retrieve the 64-bit fingerprint identifying the structure of the message.
+         * Note that the fingerprint is the same for all instances of the same
+         * message type, and is a fingerprint on the message type definition, not on
+         * the message contents.
+         */
+        inline static int64_t getHash();
+
+        /**
+         * The fingerprint returned by getHash(), as a compile-time constant.
+         */
+        static constexpr int64_t kHash = static_cast<int64_t>(0x5ef88d531ff1a45eULL);
+
+        /**
+         * Returns "MultiDOFJointState"
+         */
+        inline static const char* getTypeName();
+
+        /**
+         * Name, LCM type and array dimensions of each field, in wire order.
+         * See dimos_lcm::for_each_field() for visiting the fields themselves.
+         */
+        static constexpr std::array<dimos_lcm::field_info, 9> kFields = {{
+            { "joint_names_length", "int32_t", true, 0, 0, NULL },
+            { "transforms_length", "int32_t", true, 0, 0, NULL },
+            { "twist_length", "int32_t", true, 0, 0, NULL },
+            { "wrench_length", "int32_t", true, 0, 0, NULL },
+            { "header", "std_msgs.Header", false, 0, 0, NULL },
+            { "joint_names", "string", true, 1, -1, "joint_names_length" },
+            { "transforms", "geometry_msgs.Transform", false, 1, -1, "transforms_length" },
+            { "twist", "geometry_msgs.Twist", false, 1, -1, "twist_length" },
+            { "wrench", "geometry_msgs.Wrench", false, 1, -1, "wrench_length" },
+        }};
+
+        // LCM support functions. Users should not call these
+        inline int _encodeNoHash(void *buf, int offset, int maxlen) const;
+        template <typename Writer>
+        inline void _writeNoHash(Writer &out) const;
+        inline int _getEncodedSizeNoHash() const;
+        inline int _decodeNoHash(const void *buf, int offset, int maxlen);
+        template <uint64_t Mask>
+        inline int _decodeFieldsNoHash(const void *buf, int offset, int maxlen);
+        template <typename Self, typename Visitor>
+        inline static void _forEachField(Self &self, Visitor &visitor);
+        inline static int _skipNoHash(const void *buf, int offset, int maxlen);
+        inline static uint64_t _computeHash(const __lcm_hash_ptr *p);
+};
+
+static_assert(MultiDOFJointState::kHash == dimos_lcm::fingerprint(
+    dimos_lcm::signature_hash()
+        .member("joint_names_length", "int32_t", 0)
+        .member("transforms_length", "int32_t", 0)
+        .member("twist_length", "int32_t", 0)
+        .member("wrench_length", "int32_t", 0)
+        .member("header", NULL, 0)
+        .member("joint_names", "string", 1).dim(true, "joint_names_length")
+        .member("transforms", NULL, 1).dim(true, "transforms_length")
+        .member("twist", NULL, 1).dim(true, "twist_length")
+        .member("wrench", NULL, 1).dim(true, "wrench_length")
+        .value(),
+    std_msgs::Header::kHash,
+    geometry_msgs::Transform::kHash,
+    geometry_msgs::Twist::kHash,
+    geometry_msgs::Wrench::kHash),
+    "sensor_msgs::soa::MultiDOFJointState fingerprint does not match its definition");
+
+int MultiDOFJointState::encode(void *buf, int offset, int maxlen) const
+{
+    int pos = 0, tlen;
+    int64_t hash = getHash();
+
+    tlen = __int64_t_encode_array(buf, offset + pos, maxlen - pos, &hash, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = this->_encodeNoHash(buf, offset + pos, maxlen - pos);
+    if (tlen < 0) return tlen; else pos += tlen;
+
+    return pos;
+}
+
+int MultiDOFJointState::encodeTo(std::vector<uint8_t> &buf) const
+{
+    dimos_lcm::vector_writer out(buf);
+    int64_t hash = getHash();
+    out.put(&hash, 1);
+    this->_writeNoHash(out);
+    return static_cast<int>(out.size());
+}
+
+int MultiDOFJointState::decode(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, thislen;
+
+    int64_t msg_hash;
+    thislen = __int64_t_decode_array(buf, offset + pos, maxlen - pos, &msg_hash, 1);
+    if (thislen < 0) return thislen; else pos += thislen;
+    if (msg_hash != getHash()) return -1;
+
+    thislen = this->_decodeNoHash(buf, offset + pos, maxlen - pos);
+    if (thislen < 0) return thislen; else pos += thislen;
+
+    return pos;
+}
+
+#if __cplusplus >= 201703L
+int MultiDOFJointState::peekHeader(const void *buf, int offset, int maxlen, std_msgs::HeaderView &header)
+{
+    int64_t msg_hash;
+    if (__int64_t_decode_array(buf, offset, maxlen, &msg_hash, 1) < 0) return -1;
+    if (msg_hash != kHash) return -1;
+
+    // header follows the hash and 16 bytes of fixed-size fields
+    return header._decodeNoHash(buf, offset + 24, maxlen - 24);
+}
+#endif
+
+template <uint64_t Mask>
+int MultiDOFJointState::decodeFields(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, thislen;
+
+    int64_t msg_hash;
+    thislen = __int64_t_decode_array(buf, offset + pos, maxlen - pos, &msg_hash, 1);
+    if (thislen < 0) return thislen; else pos += thislen;
+    if (msg_hash != getHash()) return -1;
+
+    thislen = this->_decodeFieldsNoHash<Mask>(buf, offset + pos, maxlen - pos);
+    if (thislen < 0) return thislen; else pos += thislen;
+
+    return pos;
+}
+
+int MultiDOFJointState::getEncodedSize() const
+{
+    return 8 + _getEncodedSizeNoHash();
+}
+
+int64_t MultiDOFJointState::getHash()
+{
+    return kHash;
+}
+
+const char* MultiDOFJointState::getTypeName()
+{
+    return "MultiDOFJointState";
+}
+
+int MultiDOFJointState::_encodeNoHash(void *buf, int offset, int maxlen) const
+{
+    int pos = 0, tlen;
+
+    tlen = __int32_t_encode_array(buf, offset + pos, maxlen - pos, &this->joint_names_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = __int32_t_encode_array(buf, offset + pos, maxlen - pos, &this->transforms_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = __int32_t_encode_array(buf, offset + pos, maxlen - pos, &this->twist_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = __int32_t_encode_array(buf, offset + pos, maxlen - pos, &this->wrench_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = this->header._encodeNoHash(buf, offset + pos, maxlen - pos);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    for (int a0 = 0; a0 < this->joint_names_length; a0++) {
+        char* __cstr = const_cast<char*>(this->joint_names[a0].c_str());
+        tlen = __string_encode_array(
+            buf, offset + pos, maxlen - pos, &__cstr, 1);
+        if(tlen < 0) return tlen; else pos += tlen;
+    }
+
+    tlen = this->transforms._encodeNoHash(buf, offset + pos, maxlen - pos, this->transforms_length);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = this->twist._encodeNoHash(buf, offset + pos, maxlen - pos, this->twist_length);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = this->wrench._encodeNoHash(buf, offset + pos, maxlen - pos, this->wrench_length);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    return pos;
+}
+
+template <typename Writer>
+void MultiDOFJointState::_writeNoHash(Writer &out) const
+{
+    out.put(&this->joint_names_length, 1);
+    out.put(&this->transforms_length, 1);
+    out.put(&this->twist_length, 1);
+    out.put(&this->wrench_length, 1);
+    this->header._writeNoHash(out);
+    for (int a0 = 0; a0 < this->joint_names_length; a0++)
+        out.put(this->joint_names[a0]);
+    this->transforms._writeNoHash(out, this->transforms_length);
+    this->twist._writeNoHash(out, this->twist_length);
+    this->wrench._writeNoHash(out, this->wrench_length);
+}
+
+int MultiDOFJointState::_decodeNoHash(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, tlen;
+
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &this->joint_names_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &this->transforms_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &this->twist_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &this->wrench_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = this->header._decodeNoHash(buf, offset + pos, maxlen - pos);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    if(this->joint_names_length < 0 || this->joint_names_length > (maxlen - pos) / 5 || this->joint_names_length > maxArrayLength) return -1;
+    try {
+        this->joint_names.resize(this->joint_names_length);
+    } catch (...) {
+        return -1;
+    }
+    for (int a0 = 0; a0 < this->joint_names_length; a0++) {
+        int32_t __elem_len;
+        tlen = __int32_t_decode_array(
+            buf, offset + pos, maxlen - pos, &__elem_len, 1);
+        if(tlen < 0) return tlen; else pos += tlen;
+        if(__elem_len < 1 || __elem_len > maxlen - pos) return -1;
+        this->joint_names[a0].assign(static_cast<const char*>(buf) + offset + pos, __elem_len -  1);
+        pos += __elem_len;
+    }
+
+    if(this->transforms_length < 0 || this->transforms_length > (maxlen - pos) / 56 || this->transforms_length > maxArrayLength) return -1;
+    tlen = this->transforms._decodeNoHash(buf, offset + pos, maxlen - pos, this->transforms_length);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    if(this->twist_length < 0 || this->twist_length > (maxlen - pos) / 48 || this->twist_length > maxArrayLength) return -1;
+    tlen = this->twist._decodeNoHash(buf, offset + pos, maxlen - pos, this->twist_length);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    if(this->wrench_length < 0 || this->wrench_length > (maxlen - pos) / 48 || this->wrench_length > maxArrayLength) return -1;
+    tlen = this->wrench._decodeNoHash(buf, offset + pos, maxlen - pos, this->wrench_length);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    return pos;
+}
+
+template <uint64_t Mask>
+int MultiDOFJointState::_decodeFieldsNoHash(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, tlen;
+
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &this->joint_names_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &this->transforms_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &this->twist_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &this->wrench_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    if ((Mask & Fields::header) != 0) {
+        tlen = this->header._decodeNoHash(buf, offset + pos, maxlen - pos);
+        if(tlen < 0) return tlen; else pos += tlen;
+    } else {
+        tlen = std_msgs::Header::_skipNoHash(buf, offset + pos, maxlen - pos);
+        if(tlen < 0) return tlen; else pos += tlen;
+    }
+
+    if ((Mask & Fields::joint_names) != 0) {
+        if(this->joint_names_length < 0 || this->joint_names_length > (maxlen - pos) / 5 || this->joint_names_length > maxArrayLength) return -1;
+        try {
+            this->joint_names.resize(this->joint_names_length);
+        } catch (...) {
+            return -1;
+        }
+        for (int a0 = 0; a0 < this->joint_names_length; a0++) {
+            int32_t __elem_len;
+            tlen = __int32_t_decode_array(
+                buf, offset + pos, maxlen - pos, &__elem_len, 1);
+            if(tlen < 0) return tlen; else pos += tlen;
+            if(__elem_len < 1 || __elem_len > maxlen - pos) return -1;
+            this->joint_names[a0].assign(static_cast<const char*>(buf) + offset + pos, __elem_len -  1);
+            pos += __elem_len;
+        }
+    } else {
+        if(this->joint_names_length < 0) return -1;
+        for (int a0 = 0; a0 < this->joint_names_length; a0++) {
+            int32_t __joint_names_len__;
+            tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &__joint_names_len__, 1);
+            if(tlen < 0) return tlen; else pos += tlen;
+            if(__joint_names_len__ < 0 || __joint_names_len__ > maxlen - pos) return -1;
+            pos += __joint_names_len__;
+        }
+    }
+
+    if ((Mask & Fields::transforms) != 0) {
+        if(this->transforms_length < 0 || this->transforms_length > (maxlen - pos) / 56 || this->transforms_length > maxArrayLength) return -1;
+        tlen = this->transforms._decodeNoHash(buf, offset + pos, maxlen - pos, this->transforms_length);
+        if(tlen < 0) return tlen; else pos += tlen;
+    } else {
+        if(this->transforms_length < 0) return -1;
+        for (int a0 = 0; a0 < this->transforms_length; a0++) {
+            tlen = geometry_msgs::Transform::_skipNoHash(buf, offset + pos, maxlen - pos);
+            if(tlen < 0) return tlen; else pos += tlen;
+        }
+    }
+
+    if ((Mask & Fields::twist) != 0) {
+        if(this->twist_length < 0 || this->twist_length > (maxlen - pos) / 48 || this->twist_length > maxArrayLength) return -1;
+        tlen = this->twist._decodeNoHash(buf, offset + pos, maxlen - pos, this->twist_length);
+        if(tlen < 0) return tlen; else pos += tlen;
+    } else {
+        if(this->twist_length < 0) return -1;
+        for (int a0 = 0; a0 < this->twist_length; a0++) {
+            tlen = geometry_msgs::Twist::_skipNoHash(buf, offset + pos, maxlen - pos);
+            if(tlen < 0) return tlen; else pos += tlen;
+        }
+    }
+
+    if ((Mask & Fields::wrench) != 0) {
+        if(this->wrench_length < 0 || this->wrench_length > (maxlen - pos) / 48 || this->wrench_length > maxArrayLength) return -1;
+        tlen = this->wrench._decodeNoHash(buf, offset + pos, maxlen - pos, this->wrench_length);
+        if(tlen < 0) return tlen; else pos += tlen;
+    } else {
+        if(this->wrench_length < 0) return -1;
+        for (int a0 = 0; a0 < this->wrench_length; a0++) {
+            tlen = geometry_msgs::Wrench::_skipNoHash(buf, offset + pos, maxlen - pos);
+            if(tlen < 0) return tlen; else pos += tlen;
+        }
+    }
+
+    return pos;
+}
+
+int MultiDOFJointState::_getEncodedSizeNoHash() const
+{
+    int enc_size = 0;
+    enc_size += __int32_t_encoded_array_size(NULL, 1);
+    enc_size += __int32_t_encoded_array_size(NULL, 1);
+    enc_size += __int32_t_encoded_array_size(NULL, 1);
+    enc_size += __int32_t_encoded_array_size(NULL, 1);
+    enc_size += this->header._getEncodedSizeNoHash();
+    for (int a0 = 0; a0 < this->joint_names_length; a0++) {
+        enc_size += this->joint_names[a0].size() + 4 + 1;
+    }
+    enc_size += this->transforms._getEncodedSizeNoHash(this->transforms_length);
+    enc_size += this->twist._getEncodedSizeNoHash(this->twist_length);
+    enc_size += this->wrench._getEncodedSizeNoHash(this->wrench_length);
+    return enc_size;
+}
+
+int MultiDOFJointState::_skipNoHash(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, tlen;
+    int32_t joint_names_length;
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &joint_names_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+    int32_t transforms_length;
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &transforms_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+    int32_t twist_length;
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &twist_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+    int32_t wrench_length;
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &wrench_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+    tlen = std_msgs::Header::_skipNoHash(buf, offset + pos, maxlen - pos);
+    if(tlen < 0) return tlen; else pos += tlen;
+    if(joint_names_length < 0) return -1;
+    for (int a0 = 0; a0 < joint_names_length; a0++) {
+        int32_t __joint_names_len__;
+        tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &__joint_names_len__, 1);
+        if(tlen < 0) return tlen; else pos += tlen;
+        if(__joint_names_len__ < 0 || __joint_names_len__ > maxlen - pos) return -1;
+        pos += __joint_names_len__;
+    }
+    if(transforms_length < 0) return -1;
+    for (int a0 = 0; a0 < transforms_length; a0++) {
+        tlen = geometry_msgs::Transform::_skipNoHash(buf, offset + pos, maxlen - pos);
+        if(tlen < 0) return tlen; else pos += tlen;
+    }
+    if(twist_length < 0) return -1;
+    for (int a0 = 0; a0 < twist_length; a0++) {
+        tlen = geometry_msgs::Twist::_skipNoHash(buf, offset + pos, maxlen - pos);
+        if(tlen < 0) return tlen; else pos += tlen;
+    }
+    if(wrench_length < 0) return -1;
+    for (int a0 = 0; a0 < wrench_length; a0++) {
+        tlen = geometry_msgs::Wrench::_skipNoHash(buf, offset + pos, maxlen - pos);
+        if(tlen < 0) return tlen; else pos += tlen;
+    }
+    if(pos > maxlen) return -1;
+    return pos;
+}
+
+template <typename Self, typename Visitor>
+void MultiDOFJointState::_forEachField(Self &self, Visitor &visitor)
+{
+    visitor(kFields[0], self.joint_names_length);
+    visitor(kFields[1], self.transforms_length);
+    visitor(kFields[2], self.twist_length);
+    visitor(kFields[3], self.wrench_length);
+    visitor(kFields[4], self.header);
+    visitor(kFields[5], self.joint_names);
+    visitor(kFields[6], self.transforms);
+    visitor(kFields[7], self.twist);
+    visitor(kFields[8], self.wrench);
+}
+
+uint64_t MultiDOFJointState::_computeHash(const __lcm_hash_ptr *p)
+{
+    const __lcm_hash_ptr *fp;
+    for(fp = p; fp != NULL; fp = fp->parent)
+        if(fp->v == MultiDOFJointState::getHash)
+            return 0;
+    const __lcm_hash_ptr cp = { p, MultiDOFJointState::getHash };
+
+    uint64_t hash = 0x15ca331f6f9f4fbcLL +
+         std_msgs::Header::_computeHash(&cp) +
+         geometry_msgs::Transform::_computeHash(&cp) +
+         geometry_msgs::Twist::_computeHash(&cp) +
+         geometry_msgs::Wrench::_computeHash(&cp);
+
+    return (hash<<1) + ((hash>>63)&1);
+}
+
+}
+}
+
+#endif
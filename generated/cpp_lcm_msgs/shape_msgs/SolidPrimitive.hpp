@@ -1,7 +1,7 @@
 /** THIS IS AN AUTOMATICALLY GENERATED FILE.  DO NOT MODIFY
  * BY HAND!!
  *
- * Generated by lcm-gen 1.5.2
+ * Generated by lcm-cpp (tools/cpp/gen)
  **/
 
 #ifndef __shape_msgs_SolidPrimitive_hpp__
@@ -9,7 +9,12 @@
 
 #include <lcm/lcm_coretypes.h>
 
+#include <array>
 #include <vector>
+#include "dimos_lcm/bulk_codec.hpp"
+#include "dimos_lcm/writer.hpp"
+#include "dimos_lcm/fingerprint.hpp"
+#include "dimos_lcm/reflection.hpp"
 
 namespace shape_msgs
 {
@@ -100,6 +105,15 @@ class SolidPrimitive
          */
         inline int encode(void *buf, int offset, int maxlen) const;
 
+        /**
+         * Encode a message by appending it to @p buf, walking the message once
+         * instead of sizing it with getEncodedSize() first. @p buf grows
+         * geometrically; reuse it across calls to avoid reallocating.
+         *
+         * @return The number of bytes appended.
+         */
+        inline int encodeTo(std::vector<uint8_t> &buf) const;
+
         /**
          * Check how many bytes are required to encode this message.
          */
@@ -115,6 +129,42 @@ class SolidPrimitive
          */
         inline int decode(const void *buf, int offset, int maxlen);
 
+        /**
+         * Field bits for decodeFields().
+         */
+        struct Fields
+        {
+            static constexpr uint64_t dimensions_length = 1ULL << 0;
+            static constexpr uint64_t type = 1ULL << 1;
+            static constexpr uint64_t dimensions = 1ULL << 2;
+            static constexpr uint64_t all = (1ULL << 3) - 1;
+        };
+
+        /**
+         * Decode only the fields selected by @p Mask, a bitwise or of Fields
+         * values. Strings, arrays and nested structs that are not selected are
+         * skipped over by their length prefixes without being allocated, and
+         * keep their previous value. Scalar fields are always decoded: they
+         * cost nothing to read and array lengths depend on them.
+         *
+         * @return The number of bytes decoded, or <0 if an error occured.
+         */
+        template <uint64_t Mask>
+        inline int decodeFields(const void *buf, int offset, int maxlen);
+
+        /**
+         * Upper bound on the length of every variable-length array of this
+         * type, checked by decode() before anything is allocated; messages
+         * exceeding it fail to decode. It does not apply to nested types,
+         * which have their own. Set it once at startup, before decoding.
+         * Before C++17 it is a constant with no limit.
+         */
+#if __cplusplus >= 201703L
+        static inline int32_t maxArrayLength = INT32_MAX;
+#else
+        static constexpr int32_t maxArrayLength = INT32_MAX;
+#endif
+
         /**
          * Retrieve the 64-bit fingerprint identifying the structure of the message.
          * Note that the fingerprint is the same for all instances of the same
@@ -123,18 +173,48 @@ class SolidPrimitive
          */
         inline static int64_t getHash();
 
+        /**
+         * The fingerprint returned by getHash(), as a compile-time constant.
+         */
+        static constexpr int64_t kHash = static_cast<int64_t>(0x7151ce2f19560f59ULL);
+
         /**
          * Returns "SolidPrimitive"
          */
         inline static const char* getTypeName();
 
+        /**
+         * Name, LCM type and array dimensions of each field, in wire order.
+         * See dimos_lcm::for_each_field() for visiting the fields themselves.
+         */
+        static constexpr std::array<dimos_lcm::field_info, 3> kFields = {{
+            { "dimensions_length", "int32_t", true, 0, 0, NULL },
+            { "type", "byte", true, 0, 0, NULL },
+            { "dimensions", "double", true, 1, -1, "dimensions_length" },
+        }};
+
         // LCM support functions. Users should not call these
         inline int _encodeNoHash(void *buf, int offset, int maxlen) const;
+        template <typename Writer>
+        inline void _writeNoHash(Writer &out) const;
         inline int _getEncodedSizeNoHash() const;
         inline int _decodeNoHash(const void *buf, int offset, int maxlen);
+        template <uint64_t Mask>
+        inline int _decodeFieldsNoHash(const void *buf, int offset, int maxlen);
+        template <typename Self, typename Visitor>
+        inline static void _forEachField(Self &self, Visitor &visitor);
+        inline static int _skipNoHash(const void *buf, int offset, int maxlen);
         inline static uint64_t _computeHash(const __lcm_hash_ptr *p);
 };
 
+static_assert(SolidPrimitive::kHash == dimos_lcm::fingerprint(
+    dimos_lcm::signature_hash()
+        .member("dimensions_length", "int32_t", 0)
+        .member("type", "byte", 0)
+        .member("dimensions", "double", 1).dim(true, "dimensions_length")
+        .value()),
+    "shape_msgs::SolidPrimitive fingerprint does not match its definition");
+
 int SolidPrimitive::encode(void *buf, int offset, int maxlen) const
 {
     int pos = 0, tlen;
@@ -149,6 +229,15 @@ int SolidPrimitive::encode(void *buf, int offset, int maxlen) const
     return pos;
 }
 
+int SolidPrimitive::encodeTo(std::vector<uint8_t> &buf) const
+{
+    dimos_lcm::vector_writer out(buf);
+    int64_t hash = getHash();
+    out.put(&hash, 1);
+    this->_writeNoHash(out);
+    return static_cast<int>(out.size());
+}
+
 int SolidPrimitive::decode(const void *buf, int offset, int maxlen)
 {
     int pos = 0, thislen;
@@ -164,6 +253,22 @@ int SolidPrimitive::decode(const void *buf, int offset, int maxlen)
     return pos;
 }
 
+template <uint64_t Mask>
+int SolidPrimitive::decodeFields(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, thislen;
+
+    int64_t msg_hash;
+    thislen = __int64_t_decode_array(buf, offset + pos, maxlen - pos, &msg_hash, 1);
+    if (thislen < 0) return thislen; else pos += thislen;
+    if (msg_hash != getHash()) return -1;
+
+    thislen = this->_decodeFieldsNoHash<Mask>(buf, offset + pos, maxlen - pos);
+    if (thislen < 0) return thislen; else pos += thislen;
+
+    return pos;
+}
+
 int SolidPrimitive::getEncodedSize() const
 {
     return 8 + _getEncodedSizeNoHash();
@@ -171,8 +276,7 @@ int SolidPrimitive::getEncodedSize() const
 
 int64_t SolidPrimitive::getHash()
 {
-    static int64_t hash = static_cast<int64_t>(_computeHash(NULL));
-    return hash;
+    return kHash;
 }
 
 const char* SolidPrimitive::getTypeName()
@@ -191,13 +295,22 @@ int SolidPrimitive::_encodeNoHash(void *buf, int offset, int maxlen) const
     if(tlen < 0) return tlen; else pos += tlen;
 
     if(this->dimensions_length > 0) {
-        tlen = __double_encode_array(buf, offset + pos, maxlen - pos, &this->dimensions[0], this->dimensions_length);
+        tlen = dimos_lcm::bulk_encode_array(buf, offset + pos, maxlen - pos, &this->dimensions[0], this->dimensions_length);
         if(tlen < 0) return tlen; else pos += tlen;
     }
 
     return pos;
 }
 
+template <typename Writer>
+void SolidPrimitive::_writeNoHash(Writer &out) const
+{
+    out.put(&this->dimensions_length, 1);
+    out.put(&this->type, 1);
+    if(this->dimensions_length > 0)
+        out.put(&this->dimensions[0], this->dimensions_length);
+}
+
 int SolidPrimitive::_decodeNoHash(const void *buf, int offset, int maxlen)
 {
     int pos = 0, tlen;
@@ -209,9 +322,40 @@ int SolidPrimitive::_decodeNoHash(const void *buf, int offset, int maxlen)
     if(tlen < 0) return tlen; else pos += tlen;
 
     if(this->dimensions_length) {
+        if(this->dimensions_length < 0 || this->dimensions_length > (maxlen - pos) / 8 || this->dimensions_length > maxArrayLength) return -1;
         this->dimensions.resize(this->dimensions_length);
-        tlen = __double_decode_array(buf, offset + pos, maxlen - pos, &this->dimensions[0], this->dimensions_length);
+        tlen = dimos_lcm::bulk_decode_array(buf, offset + pos, maxlen - pos, &this->dimensions[0], this->dimensions_length);
         if(tlen < 0) return tlen; else pos += tlen;
+    } else {
+        this->dimensions.clear();
+    }
+
+    return pos;
+}
+
+template <uint64_t Mask>
+int SolidPrimitive::_decodeFieldsNoHash(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, tlen;
+
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &this->dimensions_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = __byte_decode_array(buf, offset + pos, maxlen - pos, &this->type, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    if ((Mask & Fields::dimensions) != 0) {
+        if(this->dimensions_length) {
+            if(this->dimensions_length < 0 || this->dimensions_length > (maxlen - pos) / 8 || this->dimensions_length > maxArrayLength) return -1;
+            this->dimensions.resize(this->dimensions_length);
+            tlen = dimos_lcm::bulk_decode_array(buf, offset + pos, maxlen - pos, &this->dimensions[0], this->dimensions_length);
+            if(tlen < 0) return tlen; else pos += tlen;
+        } else {
+            this->dimensions.clear();
+        }
+    } else {
+        if(this->dimensions_length < 0 || this->dimensions_length > (maxlen - pos) / 8) return -1;
+        pos += this->dimensions_length * 8;
     }
 
     return pos;
@@ -226,6 +370,27 @@ int SolidPrimitive::_getEncodedSizeNoHash() const
     return enc_size;
 }
 
+int SolidPrimitive::_skipNoHash(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, tlen;
+    int32_t dimensions_length;
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &dimensions_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+    pos += 1;
+    if(dimensions_length < 0 || dimensions_length > (maxlen - pos) / 8) return -1;
+    pos += dimensions_length * 8;
+    if(pos > maxlen) return -1;
+    return pos;
+}
+
+template <typename Self, typename Visitor>
+void SolidPrimitive::_forEachField(Self &self, Visitor &visitor)
+{
+    visitor(kFields[0], self.dimensions_length);
+    visitor(kFields[1], self.type);
+    visitor(kFields[2], self.dimensions);
+}
+
 uint64_t SolidPrimitive::_computeHash(const __lcm_hash_ptr *)
 {
     uint64_t hash = 0xb8a8e7178cab07acLL;
@@ -0,0 +1,461 @@
+/** THIS IS AN AUTOMATICALLY GENERATED FILE.  DO NOT MODIFY
+ * BY HAND!!
+ *
+ * Generated by lcm-cpp (tools/cpp/gen)
+ **/
+
+#ifndef __shape_msgs_pmr_Mesh_hpp__
+#define __shape_msgs_pmr_Mesh_hpp__
+
+#include <lcm/lcm_coretypes.h>
+
+#include <array>
+#include <memory_resource>
+#include <utility>
+#include <vector>
+#include "dimos_lcm/writer.hpp"
+#include "dimos_lcm/fingerprint.hpp"
+#include "dimos_lcm/reflection.hpp"
+#include "shape_msgs/pmr/MeshTriangle.hpp"
+#include "geometry_msgs/pmr/Point.hpp"
+
+namespace shape_msgs
+{
+namespace pmr
+{
+
+class Mesh
+{
+    public:
+        int32_t    triangles_length;
+
+        int32_t    vertices_length;
+
+        /**
+         * LCM Type: shape_msgs.MeshTriangle[triangles_length]
+         */
+        std::pmr::vector< shape_msgs::pmr::MeshTriangle > triangles;
+
+        /**
+         * LCM Type: geometry_msgs.Point[vertices_length]
+         */
+        std::pmr::vector< geometry_msgs::pmr::Point > vertices;
+
+    public:
+        typedef std::pmr::polymorphic_allocator<char> allocator_type;
+
+        /**
+         * Construct a message whose strings and arrays, and those of the
+         * messages it nests, allocate from @p alloc. Scalars are zeroed.
+         */
+        inline explicit Mesh(const allocator_type &alloc = allocator_type());
+
+        /**
+         * Copy or move @p other into a message that allocates from @p alloc.
+         * With allocator_type, these let std::pmr containers of Mesh pass
+         * their memory resource on to their elements.
+         */
+        inline Mesh(const Mesh &other, const allocator_type &alloc);
+        inline Mesh(Mesh &&other, const allocator_type &alloc);
+
+        /**
+         * Encode a message into binary form.
+         *
+         * @param buf The output buffer.
+         * @param offset Encoding starts at thie byte offset into @p buf.
+         * @param maxlen Maximum number of bytes to write.  This should generally be
+         *  equal to getEncodedSize().
+         * @return The number of bytes encoded, or <0 on error.
+         */
+        inline int encode(void *buf, int offset, int maxlen) const;
+
+        /**
+         * Encode a message by appending it to @p buf, walking the message once
+         * instead of sizing it with getEncodedSize() first. @p buf grows
+         * geometrically; reuse it across calls to avoid reallocating.
+         *
+         * @return The number of bytes appended.
+         */
+        inline int encodeTo(std::vector<uint8_t> &buf) const;
+
+        /**
+         * Check how many bytes are required to encode this message.
+         */
+        inline int getEncodedSize() const;
+
+        /**
+         * Decode a message from binary form into this instance.
+         *
+         * @param buf The buffer containing the encoded message.
+         * @param offset The byte offset into @p buf where the encoded message starts.
+         * @param maxlen The maximum number of bytes to read while decoding.
+         * @return The number of bytes decoded, or <0 if an error occured.
+         */
+        inline int decode(const void *buf, int offset, int maxlen);
+
+        /**
+         * Field bits for decodeFields().
+         */
+        struct Fields
+        {
+            static constexpr uint64_t triangles_length = 1ULL << 0;
+            static constexpr uint64_t vertices_length = 1ULL << 1;
+            static constexpr uint64_t triangles = 1ULL << 2;
+            static constexpr uint64_t vertices = 1ULL << 3;
+            static constexpr uint64_t all = (1ULL << 4) - 1;
+        };
+
+        /**
+         * Decode only the fields selected by @p Mask, a bitwise or of Fields
+         * values. Strings, arrays and nested structs that are not selected are
+         * skipped over by their length prefixes without being allocated, and
+         * keep their previous value. Scalar fields are always decoded: they
+         * cost nothing to read and array lengths depend on them.
+         *
+         * @return The number of bytes decoded, or <0 if an error occured.
+         */
+        template <uint64_t Mask>
+        inline int decodeFields(const void *buf, int offset, int maxlen);
+
+        /**
+         * Upper bound on the length of every variable-length array of this
+         * type, checked by decode() before anything is allocated; messages
+         * exceeding it fail to decode. It does not apply to nested types,
+         * which have their own. Set it once at startup, before decoding.
+         * Before C++17 it is a constant with no limit.
+         */
+#if __cplusplus >= 201703L
+        static inline int32_t maxArrayLength = INT32_MAX;
+#else
+        static constexpr int32_t maxArrayLength = INT32_MAX;
+#endif
+
+        /**
+         * Retrieve the 64-bit fingerprint identifying the structure of the message.
+         * Note that the fingerprint is the same for all instances of the same
+         * message type, and is a fingerprint on the message type definition, not on
+         * the message contents.
+         */
+        inline static int64_t getHash();
+
+        /**
+         * The fingerprint returned by getHash(), as a compile-time constant.
+         */
+        static constexpr int64_t kHash = static_cast<int64_t>(0xd5c0bfcf9f73bde3ULL);
+
+        /**
+         * Returns "Mesh"
+         */
+        inline static const char* getTypeName();
+
+        /**
+         * Name, LCM type and array dimensions of each field, in wire order.
+         * See dimos_lcm::for_each_field() for visiting the fields themselves.
+         */
+        static constexpr std::array<dimos_lcm::field_info, 4> kFields = {{
+            { "triangles_length", "int32_t", true, 0, 0, NULL },
+            { "vertices_length", "int32_t", true, 0, 0, NULL },
+            { "triangles", "shape_msgs.MeshTriangle", false, 1, -1, "triangles_length" },
+            { "vertices", "geometry_msgs.Point", false, 1, -1, "vertices_length" },
+        }};
+
+        // LCM support functions. Users should not call these
+        inline int _encodeNoHash(void *buf, int offset, int maxlen) const;
+        template <typename Writer>
+        inline void _writeNoHash(Writer &out) const;
+        inline int _getEncodedSizeNoHash() const;
+        inline int _decodeNoHash(const void *buf, int offset, int maxlen);
+        template <uint64_t Mask>
+        inline int _decodeFieldsNoHash(const void *buf, int offset, int maxlen);
+        template <typename Self, typename Visitor>
+        inline static void _forEachField(Self &self, Visitor &visitor);
+        inline static int _skipNoHash(const void *buf, int offset, int maxlen);
+        inline static uint64_t _computeHash(const __lcm_hash_ptr *p);
+};
+
+static_assert(Mesh::kHash == dimos_lcm::fingerprint(
+    dimos_lcm::signature_hash()
+        .member("triangles_length", "int32_t", 0)
+        .member("vertices_length", "int32_t", 0)
+        .member("triangles", NULL, 1).dim(true, "triangles_length")
+        .member("vertices", NULL, 1).dim(true, "vertices_length")
+        .value(),
+    shape_msgs::pmr::MeshTriangle::kHash,
+    geometry_msgs::pmr::Point::kHash),
+    "shape_msgs::pmr::Mesh fingerprint does not match its definition");
+
+Mesh::Mesh(const allocator_type &alloc) :
+    triangles_length(),
+    vertices_length(),
+    triangles(alloc),
+    vertices(alloc)
+{
+}
+
+Mesh::Mesh(const Mesh &other, const allocator_type &alloc) :
+    Mesh(alloc)
+{
+    *this = other;
+}
+
+Mesh::Mesh(Mesh &&other, const allocator_type &alloc) :
+    Mesh(alloc)
+{
+    *this = std::move(other);
+}
+
+int Mesh::encode(void *buf, int offset, int maxlen) const
+{
+    int pos = 0, tlen;
+    int64_t hash = getHash();
+
+    tlen = __int64_t_encode_array(buf, offset + pos, maxlen - pos, &hash, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = this->_encodeNoHash(buf, offset + pos, maxlen - pos);
+    if (tlen < 0) return tlen; else pos += tlen;
+
+    return pos;
+}
+
+int Mesh::encodeTo(std::vector<uint8_t> &buf) const
+{
+    dimos_lcm::vector_writer out(buf);
+    int64_t hash = getHash();
+    out.put(&hash, 1);
+    this->_writeNoHash(out);
+    return static_cast<int>(out.size());
+}
+
+int Mesh::decode(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, thislen;
+
+    int64_t msg_hash;
+    thislen = __int64_t_decode_array(buf, offset + pos, maxlen - pos, &msg_hash, 1);
+    if (thislen < 0) return thislen; else pos += thislen;
+    if (msg_hash != getHash()) return -1;
+
+    thislen = this->_decodeNoHash(buf, offset + pos, maxlen - pos);
+    if (thislen < 0) return thislen; else pos += thislen;
+
+    return pos;
+}
+
+template <uint64_t Mask>
+int Mesh::decodeFields(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, thislen;
+
+    int64_t msg_hash;
+    thislen = __int64_t_decode_array(buf, offset + pos, maxlen - pos, &msg_hash, 1);
+    if (thislen < 0) return thislen; else pos += thislen;
+    if (msg_hash != getHash()) return -1;
+
+    thislen = this->_decodeFieldsNoHash<Mask>(buf, offset + pos, maxlen - pos);
+    if (thislen < 0) return thislen; else pos += thislen;
+
+    return pos;
+}
+
+int Mesh::getEncodedSize() const
+{
+    return 8 + _getEncodedSizeNoHash();
+}
+
+int64_t Mesh::getHash()
+{
+    return kHash;
+}
+
+const char* Mesh::getTypeName()
+{
+    return "Mesh";
+}
+
+int Mesh::_encodeNoHash(void *buf, int offset, int maxlen) const
+{
+    int pos = 0, tlen;
+
+    tlen = __int32_t_encode_array(buf, offset + pos, maxlen - pos, &this->triangles_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = __int32_t_encode_array(buf, offset + pos, maxlen - pos, &this->vertices_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    for (int a0 = 0; a0 < this->triangles_length; a0++) {
+        tlen = this->triangles[a0]._encodeNoHash(buf, offset + pos, maxlen - pos);
+        if(tlen < 0) return tlen; else pos += tlen;
+    }
+
+    for (int a0 = 0; a0 < this->vertices_length; a0++) {
+        tlen = this->vertices[a0]._encodeNoHash(buf, offset + pos, maxlen - pos);
+        if(tlen < 0) return tlen; else pos += tlen;
+    }
+
+    return pos;
+}
+
+template <typename Writer>
+void Mesh::_writeNoHash(Writer &out) const
+{
+    out.put(&this->triangles_length, 1);
+    out.put(&this->vertices_length, 1);
+    if(this->triangles_length > 0)
+        out.putStructArray(&this->triangles[0], this->triangles_length);
+    if(this->vertices_length > 0)
+        out.putStructArray(&this->vertices[0], this->vertices_length);
+}
+
+int Mesh::_decodeNoHash(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, tlen;
+
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &this->triangles_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &this->vertices_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    if(this->triangles_length < 0 || this->triangles_length > (maxlen - pos) / 12 || this->triangles_length > maxArrayLength) return -1;
+    try {
+        this->triangles.resize(this->triangles_length);
+    } catch (...) {
+        return -1;
+    }
+    for (int a0 = 0; a0 < this->triangles_length; a0++) {
+        tlen = this->triangles[a0]._decodeNoHash(buf, offset + pos, maxlen - pos);
+        if(tlen < 0) return tlen; else pos += tlen;
+    }
+
+    if(this->vertices_length < 0 || this->vertices_length > (maxlen - pos) / 24 || this->vertices_length > maxArrayLength) return -1;
+    try {
+        this->vertices.resize(this->vertices_length);
+    } catch (...) {
+        return -1;
+    }
+    for (int a0 = 0; a0 < this->vertices_length; a0++) {
+        tlen = this->vertices[a0]._decodeNoHash(buf, offset + pos, maxlen - pos);
+        if(tlen < 0) return tlen; else pos += tlen;
+    }
+
+    return pos;
+}
+
+template <uint64_t Mask>
+int Mesh::_decodeFieldsNoHash(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, tlen;
+
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &this->triangles_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &this->vertices_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    if ((Mask & Fields::triangles) != 0) {
+        if(this->triangles_length < 0 || this->triangles_length > (maxlen - pos) / 12 || this->triangles_length > maxArrayLength) return -1;
+        try {
+            this->triangles.resize(this->triangles_length);
+        } catch (...) {
+            return -1;
+        }
+        for (int a0 = 0; a0 < this->triangles_length; a0++) {
+            tlen = this->triangles[a0]._decodeNoHash(buf, offset + pos, maxlen - pos);
+            if(tlen < 0) return tlen; else pos += tlen;
+        }
+    } else {
+        if(this->triangles_length < 0) return -1;
+        for (int a0 = 0; a0 < this->triangles_length; a0++) {
+            tlen = shape_msgs::pmr::MeshTriangle::_skipNoHash(buf, offset + pos, maxlen - pos);
+            if(tlen < 0) return tlen; else pos += tlen;
+        }
+    }
+
+    if ((Mask & Fields::vertices) != 0) {
+        if(this->vertices_length < 0 || this->vertices_length > (maxlen - pos) / 24 || this->vertices_length > maxArrayLength) return -1;
+        try {
+            this->vertices.resize(this->vertices_length);
+        } catch (...) {
+            return -1;
+        }
+        for (int a0 = 0; a0 < this->vertices_length; a0++) {
+            tlen = this->vertices[a0]._decodeNoHash(buf, offset + pos, maxlen - pos);
+            if(tlen < 0) return tlen; else pos += tlen;
+        }
+    } else {
+        if(this->vertices_length < 0) return -1;
+        for (int a0 = 0; a0 < this->vertices_length; a0++) {
+            tlen = geometry_msgs::pmr::Point::_skipNoHash(buf, offset + pos, maxlen - pos);
+            if(tlen < 0) return tlen; else pos += tlen;
+        }
+    }
+
+    return pos;
+}
+
+int Mesh::_getEncodedSizeNoHash() const
+{
+    int enc_size = 0;
+    enc_size += __int32_t_encoded_array_size(NULL, 1);
+    enc_size += __int32_t_encoded_array_size(NULL, 1);
+    for (int a0 = 0; a0 < this->triangles_length; a0++) {
+        enc_size += this->triangles[a0]._getEncodedSizeNoHash();
+    }
+    for (int a0 = 0; a0 < this->vertices_length; a0++) {
+        enc_size += this->vertices[a0]._getEncodedSizeNoHash();
+    }
+    return enc_size;
+}
+
+int Mesh::_skipNoHash(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, tlen;
+    int32_t triangles_length;
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &triangles_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+    int32_t vertices_length;
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &vertices_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+    if(triangles_length < 0) return -1;
+    for (int a0 = 0; a0 < triangles_length; a0++) {
+        tlen = shape_msgs::pmr::MeshTriangle::_skipNoHash(buf, offset + pos, maxlen - pos);
+        if(tlen < 0) return tlen; else pos += tlen;
+    }
+    if(vertices_length < 0) return -1;
+    for (int a0 = 0; a0 < vertices_length; a0++) {
+        tlen = geometry_msgs::pmr::Point::_skipNoHash(buf, offset + pos, maxlen - pos);
+        if(tlen < 0) return tlen; else pos += tlen;
+    }
+    if(pos > maxlen) return -1;
+    return pos;
+}
+
+template <typename Self, typename Visitor>
+void Mesh::_forEachField(Self &self, Visitor &visitor)
+{
+    visitor(kFields[0], self.triangles_length);
+    visitor(kFields[1], self.vertices_length);
+    visitor(kFields[2], self.triangles);
+    visitor(kFields[3], self.vertices);
+}
+
+uint64_t Mesh::_computeHash(const __lcm_hash_ptr *p)
+{
+    const __lcm_hash_ptr *fp;
+    for(fp = p; fp != NULL; fp = fp->parent)
+        if(fp->v == Mesh::getHash)
+            return 0;
+    const __lcm_hash_ptr cp = { p, Mesh::getHash };
+
+    uint64_t hash = 0xdc739fb8d2f81ab9LL +
+         shape_msgs::pmr::MeshTriangle::_computeHash(&cp) +
+         geometry_msgs::pmr::Point::_computeHash(&cp);
+
+    return (hash<<1) + ((hash>>63)&1);
+}
+
+}
+}
+
+#endif
@@ -0,0 +1,23 @@
+/** THIS IS AN AUTOMATICALLY GENERATED FILE.  DO NOT MODIFY
+ * BY HAND!!
+ *
+ * Generated by lcm-cpp (tools/cpp/gen)
+ **/
+
+#ifndef __shape_msgs_pmr_MeshTriangle_hpp__
+#define __shape_msgs_pmr_MeshTriangle_hpp__
+
+#include "shape_msgs/MeshTriangle.hpp"
+
+namespace shape_msgs
+{
+namespace pmr
+{
+
+// MeshTriangle has no strings or variable-length arrays, so it never allocates
+typedef shape_msgs::MeshTriangle MeshTriangle;
+
+}
+}
+
+#endif
@@ -1,7 +1,7 @@
 /** THIS IS AN AUTOMATICALLY GENERATED FILE.  DO NOT MODIFY
  * BY HAND!!
  *
- * Generated by lcm-gen 1.5.2
+ * Generated by lcm-cpp (tools/cpp/gen)
  **/
 
 #ifndef __std_msgs_Bool_hpp__
@@ -9,6 +9,11 @@
 
 #include <lcm/lcm_coretypes.h>
 
+#include <array>
+#include "dimos_lcm/fixed_codec.hpp"
+#include "dimos_lcm/writer.hpp"
+#include "dimos_lcm/fingerprint.hpp"
+#include "dimos_lcm/reflection.hpp"
 
 namespace std_msgs
 {
@@ -30,11 +35,26 @@ class Bool
          */
         inline int encode(void *buf, int offset, int maxlen) const;
 
+        /**
+         * Encode a message by appending it to @p buf, walking the message once
+         * instead of sizing it with getEncodedSize() first. @p buf grows
+         * geometrically; reuse it across calls to avoid reallocating.
+         *
+         * @return The number of bytes appended.
+         */
+        inline int encodeTo(std::vector<uint8_t> &buf) const;
+
         /**
          * Check how many bytes are required to encode this message.
          */
         inline int getEncodedSize() const;
 
+        /**
+         * getEncodedSize() of every instance: the type has no strings or
+         * variable-length arrays.
+         */
+        static constexpr int kEncodedSize = 9;
+
         /**
          * Decode a message from binary form into this instance.
          *
@@ -53,18 +73,42 @@ class Bool
          */
         inline static int64_t getHash();
 
+        /**
+         * The fingerprint returned by getHash(), as a compile-time constant.
+         */
+        static constexpr int64_t kHash = static_cast<int64_t>(0x1ebef06a50950e3eULL);
+
         /**
          * Returns "Bool"
          */
         inline static const char* getTypeName();
 
+        /**
+         * Name, LCM type and array dimensions of each field, in wire order.
+         * See dimos_lcm::for_each_field() for visiting the fields themselves.
+         */
+        static constexpr std::array<dimos_lcm::field_info, 1> kFields = {{
+            { "data", "boolean", true, 0, 0, NULL },
+        }};
+
         // LCM support functions. Users should not call these
         inline int _encodeNoHash(void *buf, int offset, int maxlen) const;
+        template <typename Writer>
+        inline void _writeNoHash(Writer &out) const;
         inline int _getEncodedSizeNoHash() const;
         inline int _decodeNoHash(const void *buf, int offset, int maxlen);
+        template <typename Self, typename Visitor>
+        inline static void _forEachField(Self &self, Visitor &visitor);
+        inline static int _skipNoHash(const void *buf, int offset, int maxlen);
         inline static uint64_t _computeHash(const __lcm_hash_ptr *p);
 };
 
+static_assert(Bool::kHash == dimos_lcm::fingerprint(
+    dimos_lcm::signature_hash()
+        .member("data", "boolean", 0)
+        .value()),
+    "std_msgs::Bool fingerprint does not match its definition");
+
 int Bool::encode(void *buf, int offset, int maxlen) const
 {
     int pos = 0, tlen;
@@ -79,6 +123,15 @@ int Bool::encode(void *buf, int offset, int maxlen) const
     return pos;
 }
 
+int Bool::encodeTo(std::vector<uint8_t> &buf) const
+{
+    dimos_lcm::vector_writer out(buf);
+    int64_t hash = getHash();
+    out.put(&hash, 1);
+    this->_writeNoHash(out);
+    return static_cast<int>(out.size());
+}
+
 int Bool::decode(const void *buf, int offset, int maxlen)
 {
     int pos = 0, thislen;
@@ -101,8 +154,7 @@ int Bool::getEncodedSize() const
 
 int64_t Bool::getHash()
 {
-    static int64_t hash = static_cast<int64_t>(_computeHash(NULL));
-    return hash;
+    return kHash;
 }
 
 const char* Bool::getTypeName()
@@ -112,29 +164,40 @@ const char* Bool::getTypeName()
 
 int Bool::_encodeNoHash(void *buf, int offset, int maxlen) const
 {
-    int pos = 0, tlen;
-
-    tlen = __boolean_encode_array(buf, offset + pos, maxlen - pos, &this->data, 1);
-    if(tlen < 0) return tlen; else pos += tlen;
+    if(maxlen < kEncodedSize - 8) return -1;
+    uint8_t *p = static_cast<uint8_t*>(buf) + offset;
+    dimos_lcm::store_be(p + 0, this->data);
+    return kEncodedSize - 8;
+}
 
-    return pos;
+template <typename Writer>
+void Bool::_writeNoHash(Writer &out) const
+{
+    out.putStruct(*this);
 }
 
 int Bool::_decodeNoHash(const void *buf, int offset, int maxlen)
 {
-    int pos = 0, tlen;
+    if(maxlen < kEncodedSize - 8) return -1;
+    const uint8_t *p = static_cast<const uint8_t*>(buf) + offset;
+    dimos_lcm::load_be(p + 0, this->data);
+    return kEncodedSize - 8;
+}
 
-    tlen = __boolean_decode_array(buf, offset + pos, maxlen - pos, &this->data, 1);
-    if(tlen < 0) return tlen; else pos += tlen;
+int Bool::_getEncodedSizeNoHash() const
+{
+    return kEncodedSize - 8;
+}
 
-    return pos;
+int Bool::_skipNoHash(const void *, int, int maxlen)
+{
+    return maxlen < kEncodedSize - 8 ? -1 : kEncodedSize - 8;
 }
 
-int Bool::_getEncodedSizeNoHash() const
+template <typename Self, typename Visitor>
+void Bool::_forEachField(Self &self, Visitor &visitor)
 {
-    int enc_size = 0;
-    enc_size += __boolean_encoded_array_size(NULL, 1);
-    return enc_size;
+    visitor(kFields[0], self.data);
 }
 
 uint64_t Bool::_computeHash(const __lcm_hash_ptr *)
@@ -0,0 +1,121 @@
+/** THIS IS AN AUTOMATICALLY GENERATED FILE.  DO NOT MODIFY
+ * BY HAND!!
+ *
+ * Generated by lcm-cpp (tools/cpp/gen)
+ **/
+
+#ifndef __std_msgs_ByteMultiArrayView_hpp__
+#define __std_msgs_ByteMultiArrayView_hpp__
+
+#include <lcm/lcm_coretypes.h>
+
+#include "dimos_lcm/view.hpp"
+#include "std_msgs/ByteMultiArray.hpp"
+#include "std_msgs/MultiArrayLayoutView.hpp"
+
+namespace std_msgs
+{
+
+/**
+ * Zero-copy read-only view of an encoded std_msgs.ByteMultiArray.
+ *
+ * Strings and variable-length arrays point into the buffer given to decode(),
+ * which must outlive the view. Decoding validates the whole message once and
+ * never allocates.
+ */
+class ByteMultiArrayView
+{
+    public:
+        int32_t    data_length;
+
+        std_msgs::MultiArrayLayoutView layout;
+
+        /**
+         * LCM Type: int8_t[data_length]
+         */
+        dimos_lcm::span< const int8_t > data;
+
+    public:
+        /**
+         * Decode a view over a message in binary form.
+         *
+         * @param buf The buffer containing the encoded message. It must outlive
+         *  this view.
+         * @param offset The byte offset into @p buf where the encoded message starts.
+         * @param maxlen The maximum number of bytes to read while decoding.
+         * @return The number of bytes decoded, or <0 if an error occured.
+         */
+        inline int decode(const void *buf, int offset, int maxlen);
+
+        /**
+         * Copy the viewed message into an owning ByteMultiArray.
+         */
+        inline void copyTo(ByteMultiArray &msg) const;
+
+        /**
+         * Returns ByteMultiArray::getHash()
+         */
+        inline static int64_t getHash();
+
+        /**
+         * Returns "ByteMultiArray"
+         */
+        inline static const char* getTypeName();
+
+        // LCM support functions. Users should not call these
+        inline int _decodeNoHash(const void *buf, int offset, int maxlen);
+};
+
+int ByteMultiArrayView::decode(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, thislen;
+
+    int64_t msg_hash;
+    thislen = __int64_t_decode_array(buf, offset + pos, maxlen - pos, &msg_hash, 1);
+    if (thislen < 0) return thislen; else pos += thislen;
+    if (msg_hash != getHash()) return -1;
+
+    thislen = this->_decodeNoHash(buf, offset + pos, maxlen - pos);
+    if (thislen < 0) return thislen; else pos += thislen;
+
+    return pos;
+}
+
+void ByteMultiArrayView::copyTo(ByteMultiArray &msg) const
+{
+    msg.data_length = this->data_length;
+    this->layout.copyTo(msg.layout);
+    msg.data.assign(this->data.begin(), this->data.end());
+}
+
+int64_t ByteMultiArrayView::getHash()
+{
+    return ByteMultiArray::getHash();
+}
+
+const char* ByteMultiArrayView::getTypeName()
+{
+    return "ByteMultiArray";
+}
+
+int ByteMultiArrayView::_decodeNoHash(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, tlen;
+
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &this->data_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = this->layout._decodeNoHash(buf, offset + pos, maxlen - pos);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    if(this->data_length < 0 || this->data_length > maxlen - pos) return -1;
+    this->data = dimos_lcm::span< const int8_t >(
+        static_cast<const int8_t*>(buf) + offset + pos, this->data_length);
+    pos += this->data_length;
+
+    return pos;
+}
+
+}
+
+#endif
@@ -0,0 +1,149 @@
+/** THIS IS AN AUTOMATICALLY GENERATED FILE.  DO NOT MODIFY
+ * BY HAND!!
+ *
+ * Generated by lcm-cpp (tools/cpp/gen)
+ **/
+
+#ifndef __std_msgs_ColorRGBAColumns_hpp__
+#define __std_msgs_ColorRGBAColumns_hpp__
+
+#include <lcm/lcm_coretypes.h>
+
+#include <vector>
+#include "dimos_lcm/fixed_codec.hpp"
+#include "std_msgs/ColorRGBA.hpp"
+
+namespace std_msgs
+{
+
+/**
+ * Structure-of-arrays storage for a sequence of std_msgs.ColorRGBA: one
+ * contiguous array per field, with nested fields flattened and named by their
+ * path (r, g, ...). The soa:: message classes hold their
+ * ColorRGBA arrays this way and decode them straight into the columns.
+ */
+class ColorRGBAColumns
+{
+    public:
+        std::vector< float > r;
+
+        std::vector< float > g;
+
+        std::vector< float > b;
+
+        std::vector< float > a;
+
+    public:
+        /**
+         * Number of elements.
+         */
+        inline int size() const;
+
+        /**
+         * Resize every column to @p n elements.
+         */
+        inline void resize(int n);
+
+        /**
+         * Gather element @p i into a ColorRGBA.
+         */
+        inline std_msgs::ColorRGBA get(int i) const;
+
+        /**
+         * Scatter @p msg into element @p i.
+         */
+        inline void set(int i, const std_msgs::ColorRGBA &msg);
+
+        // LCM support functions. Users should not call these
+        inline int _encodeNoHash(void *buf, int offset, int maxlen, int n) const;
+        template <typename Writer>
+        inline void _writeNoHash(Writer &out, int n) const;
+        inline int _getEncodedSizeNoHash(int n) const;
+        inline int _decodeNoHash(const void *buf, int offset, int maxlen, int n);
+};
+
+int ColorRGBAColumns::size() const
+{
+    return static_cast<int>(this->r.size());
+}
+
+void ColorRGBAColumns::resize(int n)
+{
+    this->r.resize(n);
+    this->g.resize(n);
+    this->b.resize(n);
+    this->a.resize(n);
+}
+
+std_msgs::ColorRGBA ColorRGBAColumns::get(int i) const
+{
+    std_msgs::ColorRGBA msg;
+    msg.r = this->r[i];
+    msg.g = this->g[i];
+    msg.b = this->b[i];
+    msg.a = this->a[i];
+    return msg;
+}
+
+void ColorRGBAColumns::set(int i, const std_msgs::ColorRGBA &msg)
+{
+    this->r[i] = msg.r;
+    this->g[i] = msg.g;
+    this->b[i] = msg.b;
+    this->a[i] = msg.a;
+}
+
+int ColorRGBAColumns::_encodeNoHash(void *buf, int offset, int maxlen, int n) const
+{
+    uint8_t *p = static_cast<uint8_t*>(buf) + offset;
+    int pos = 0;
+    for (int i = 0; i < n; i++) {
+        if(maxlen - pos < 16) return -1;
+        dimos_lcm::store_be(p + pos + 0, this->r[i]);
+        dimos_lcm::store_be(p + pos + 4, this->g[i]);
+        dimos_lcm::store_be(p + pos + 8, this->b[i]);
+        dimos_lcm::store_be(p + pos + 12, this->a[i]);
+        pos += 16;
+    }
+    return pos;
+}
+
+template <typename Writer>
+void ColorRGBAColumns::_writeNoHash(Writer &out, int n) const
+{
+    if(n <= 0) return;
+    uint8_t *p = out.extend(static_cast<size_t>(n) * 16);
+    for (int i = 0; i < n; i++, p += 16) {
+        dimos_lcm::store_be(p + 0, this->r[i]);
+        dimos_lcm::store_be(p + 4, this->g[i]);
+        dimos_lcm::store_be(p + 8, this->b[i]);
+        dimos_lcm::store_be(p + 12, this->a[i]);
+    }
+}
+
+int ColorRGBAColumns::_getEncodedSizeNoHash(int n) const
+{
+    return n * 16;
+}
+
+int ColorRGBAColumns::_decodeNoHash(const void *buf, int offset, int maxlen, int n)
+{
+    if(n < 0 || n > maxlen / 16) return -1;
+    this->resize(n);
+    const uint8_t *p = static_cast<const uint8_t*>(buf) + offset;
+    float *r = this->r.data();
+    float *g = this->g.data();
+    float *b = this->b.data();
+    float *a = this->a.data();
+    for (int i = 0; i < n; i++, p += 16) {
+        dimos_lcm::load_be(p + 0, r[i]);
+        dimos_lcm::load_be(p + 4, g[i]);
+        dimos_lcm::load_be(p + 8, b[i]);
+        dimos_lcm::load_be(p + 12, a[i]);
+    }
+    return n * 16;
+}
+
+}
+
+#endif
@@ -1,7 +1,7 @@
 /** THIS IS AN AUTOMATICALLY GENERATED FILE.  DO NOT MODIFY
  * BY HAND!!
  *
- * Generated by lcm-gen 1.5.2
+ * Generated by lcm-cpp (tools/cpp/gen)
  **/
 
 #ifndef __std_msgs_Empty_hpp__
@@ -9,6 +9,10 @@
 
 #include <lcm/lcm_coretypes.h>
 
+#include <array>
+#include "dimos_lcm/writer.hpp"
+#include "dimos_lcm/fingerprint.hpp"
+#include "dimos_lcm/reflection.hpp"
 
 namespace std_msgs
 {
@@ -27,11 +31,26 @@ class Empty
          */
         inline int encode(void *buf, int offset, int maxlen) const;
 
+        /**
+         * Encode a message by appending it to @p buf, walking the message once
+         * instead of sizing it with getEncodedSize() first. @p buf grows
+         * geometrically; reuse it across calls to avoid reallocating.
+         *
+         * @return The number of bytes appended.
+         */
+        inline int encodeTo(std::vector<uint8_t> &buf) const;
+
         /**
          * Check how many bytes are required to encode this message.
          */
         inline int getEncodedSize() const;
 
+        /**
+         * getEncodedSize() of every instance: the type has no strings or
+         * variable-length arrays.
+         */
+        static constexpr int kEncodedSize = 8;
+
         /**
          * Decode a message from binary form into this instance.
          *
@@ -50,18 +69,40 @@ class Empty
          */
         inline static int64_t getHash();
 
+        /**
+         * The fingerprint returned by getHash(), as a compile-time constant.
+         */
+        static constexpr int64_t kHash = static_cast<int64_t>(0x000000002468acf0ULL);
+
         /**
          * Returns "Empty"
          */
         inline static const char* getTypeName();
 
+        /**
+         * Name, LCM type and array dimensions of each field, in wire order.
+         * See dimos_lcm::for_each_field() for visiting the fields themselves.
+         */
+        static constexpr std::array<dimos_lcm::field_info, 0> kFields = {{
+        }};
+
         // LCM support functions. Users should not call these
         inline int _encodeNoHash(void *buf, int offset, int maxlen) const;
+        template <typename Writer>
+        inline void _writeNoHash(Writer &out) const;
         inline int _getEncodedSizeNoHash() const;
         inline int _decodeNoHash(const void *buf, int offset, int maxlen);
+        template <typename Self, typename Visitor>
+        inline static void _forEachField(Self &self, Visitor &visitor);
+        inline static int _skipNoHash(const void *buf, int offset, int maxlen);
         inline static uint64_t _computeHash(const __lcm_hash_ptr *p);
 };
 
+static_assert(Empty::kHash == dimos_lcm::fingerprint(
+    dimos_lcm::signature_hash()
+        .value()),
+    "std_msgs::Empty fingerprint does not match its definition");
+
 int Empty::encode(void *buf, int offset, int maxlen) const
 {
     int pos = 0, tlen;
@@ -76,6 +117,15 @@ int Empty::encode(void *buf, int offset, int maxlen) const
     return pos;
 }
 
+int Empty::encodeTo(std::vector<uint8_t> &buf) const
+{
+    dimos_lcm::vector_writer out(buf);
+    int64_t hash = getHash();
+    out.put(&hash, 1);
+    this->_writeNoHash(out);
+    return static_cast<int>(out.size());
+}
+
 int Empty::decode(const void *buf, int offset, int maxlen)
 {
     int pos = 0, thislen;
@@ -98,8 +148,7 @@ int Empty::getEncodedSize() const
 
 int64_t Empty::getHash()
 {
-    static int64_t hash = static_cast<int64_t>(_computeHash(NULL));
-    return hash;
+    return kHash;
 }
 
 const char* Empty::getTypeName()
@@ -112,6 +161,11 @@ int Empty::_encodeNoHash(void *, int, int) const
     return 0;
 }
 
+template <typename Writer>
+void Empty::_writeNoHash(Writer &) const
+{
+}
+
 int Empty::_decodeNoHash(const void *, int, int)
 {
     return 0;
@@ -122,6 +176,16 @@ int Empty::_getEncodedSizeNoHash() const
     return 0;
 }
 
+int Empty::_skipNoHash(const void *, int, int)
+{
+    return 0;
+}
+
+template <typename Self, typename Visitor>
+void Empty::_forEachField(Self &, Visitor &)
+{
+}
+
 uint64_t Empty::_computeHash(const __lcm_hash_ptr *)
 {
     uint64_t hash = 0x0000000012345678LL;
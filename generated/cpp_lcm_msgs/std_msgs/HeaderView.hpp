@@ -0,0 +1,122 @@
+/** THIS IS AN AUTOMATICALLY GENERATED FILE.  DO NOT MODIFY
+ * BY HAND!!
+ *
+ * Generated by lcm-cpp (tools/cpp/gen)
+ **/
+
+#ifndef __std_msgs_HeaderView_hpp__
+#define __std_msgs_HeaderView_hpp__
+
+#include <lcm/lcm_coretypes.h>
+
+#include <string_view>
+#include "dimos_lcm/view.hpp"
+#include "std_msgs/Header.hpp"
+
+namespace std_msgs
+{
+
+/**
+ * Zero-copy read-only view of an encoded std_msgs.Header.
+ *
+ * Strings and variable-length arrays point into the buffer given to decode(),
+ * which must outlive the view. Decoding validates the whole message once and
+ * never allocates.
+ */
+class HeaderView
+{
+    public:
+        int32_t    seq;
+
+        std_msgs::Time stamp;
+
+        std::string_view frame_id;
+
+    public:
+        /**
+         * Decode a view over a message in binary form.
+         *
+         * @param buf The buffer containing the encoded message. It must outlive
+         *  this view.
+         * @param offset The byte offset into @p buf where the encoded message starts.
+         * @param maxlen The maximum number of bytes to read while decoding.
+         * @return The number of bytes decoded, or <0 if an error occured.
+         */
+        inline int decode(const void *buf, int offset, int maxlen);
+
+        /**
+         * Copy the viewed message into an owning Header.
+         */
+        inline void copyTo(Header &msg) const;
+
+        /**
+         * Returns Header::getHash()
+         */
+        inline static int64_t getHash();
+
+        /**
+         * Returns "Header"
+         */
+        inline static const char* getTypeName();
+
+        // LCM support functions. Users should not call these
+        inline int _decodeNoHash(const void *buf, int offset, int maxlen);
+};
+
+int HeaderView::decode(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, thislen;
+
+    int64_t msg_hash;
+    thislen = __int64_t_decode_array(buf, offset + pos, maxlen - pos, &msg_hash, 1);
+    if (thislen < 0) return thislen; else pos += thislen;
+    if (msg_hash != getHash()) return -1;
+
+    thislen = this->_decodeNoHash(buf, offset + pos, maxlen - pos);
+    if (thislen < 0) return thislen; else pos += thislen;
+
+    return pos;
+}
+
+void HeaderView::copyTo(Header &msg) const
+{
+    msg.seq = this->seq;
+    msg.stamp = this->stamp;
+    msg.frame_id.assign(this->frame_id.data(), this->frame_id.size());
+}
+
+int64_t HeaderView::getHash()
+{
+    return Header::getHash();
+}
+
+const char* HeaderView::getTypeName()
+{
+    return "Header";
+}
+
+int HeaderView::_decodeNoHash(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, tlen;
+
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &this->seq, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = this->stamp._decodeNoHash(buf, offset + pos, maxlen - pos);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    int32_t __frame_id_len__;
+    tlen = __int32_t_decode_array(
+        buf, offset + pos, maxlen - pos, &__frame_id_len__, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+    if(__frame_id_len__ < 1 || __frame_id_len__ > maxlen - pos) return -1;
+    this->frame_id = std::string_view(
+        static_cast<const char*>(buf) + offset + pos, __frame_id_len__ - 1);
+    pos += __frame_id_len__;
+
+    return pos;
+}
+
+}
+
+#endif
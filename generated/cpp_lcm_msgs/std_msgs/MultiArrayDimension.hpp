@@ -1,7 +1,7 @@
 /** THIS IS AN AUTOMATICALLY GENERATED FILE.  DO NOT MODIFY
  * BY HAND!!
  *
- * Generated by lcm-gen 1.5.2
+ * Generated by lcm-cpp (tools/cpp/gen)
  **/
 
 #ifndef __std_msgs_MultiArrayDimension_hpp__
@@ -9,7 +9,11 @@
 
 #include <lcm/lcm_coretypes.h>
 
+#include <array>
 #include <string>
+#include "dimos_lcm/writer.hpp"
+#include "dimos_lcm/fingerprint.hpp"
+#include "dimos_lcm/reflection.hpp"
 
 namespace std_msgs
 {
@@ -35,6 +39,15 @@ class MultiArrayDimension
          */
         inline int encode(void *buf, int offset, int maxlen) const;
 
+        /**
+         * Encode a message by appending it to @p buf, walking the message once
+         * instead of sizing it with getEncodedSize() first. @p buf grows
+         * geometrically; reuse it across calls to avoid reallocating.
+         *
+         * @return The number of bytes appended.
+         */
+        inline int encodeTo(std::vector<uint8_t> &buf) const;
+
         /**
          * Check how many bytes are required to encode this message.
          */
@@ -50,6 +63,29 @@ class MultiArrayDimension
          */
         inline int decode(const void *buf, int offset, int maxlen);
 
+        /**
+         * Field bits for decodeFields().
+         */
+        struct Fields
+        {
+            static constexpr uint64_t label = 1ULL << 0;
+            static constexpr uint64_t size = 1ULL << 1;
+            static constexpr uint64_t stride = 1ULL << 2;
+            static constexpr uint64_t all = (1ULL << 3) - 1;
+        };
+
+        /**
+         * Decode only the fields selected by @p Mask, a bitwise or of Fields
+         * values. Strings, arrays and nested structs that are not selected are
+         * skipped over by their length prefixes without being allocated, and
+         * keep their previous value. Scalar fields are always decoded: they
+         * cost nothing to read and array lengths depend on them.
+         *
+         * @return The number of bytes decoded, or <0 if an error occured.
+         */
+        template <uint64_t Mask>
+        inline int decodeFields(const void *buf, int offset, int maxlen);
+
         /**
          * Retrieve the 64-bit fingerprint identifying the structure of the message.
          * Note that the fingerprint is the same for all instances of the same
@@ -58,18 +94,48 @@ class MultiArrayDimension
          */
         inline static int64_t getHash();
 
+        /**
+         * The fingerprint returned by getHash(), as a compile-time constant.
+         */
+        static constexpr int64_t kHash = static_cast<int64_t>(0x9d8373d3b0d1df2fULL);
+
         /**
          * Returns "MultiArrayDimension"
          */
         inline static const char* getTypeName();
 
+        /**
+         * Name, LCM type and array dimensions of each field, in wire order.
+         * See dimos_lcm::for_each_field() for visiting the fields themselves.
+         */
+        static constexpr std::array<dimos_lcm::field_info, 3> kFields = {{
+            { "label", "string", true, 0, 0, NULL },
+            { "size", "int32_t", true, 0, 0, NULL },
+            { "stride", "int32_t", true, 0, 0, NULL },
+        }};
+
         // LCM support functions. Users should not call these
         inline int _encodeNoHash(void *buf, int offset, int maxlen) const;
+        template <typename Writer>
+        inline void _writeNoHash(Writer &out) const;
         inline int _getEncodedSizeNoHash() const;
         inline int _decodeNoHash(const void *buf, int offset, int maxlen);
+        template <uint64_t Mask>
+        inline int _decodeFieldsNoHash(const void *buf, int offset, int maxlen);
+        template <typename Self, typename Visitor>
+        inline static void _forEachField(Self &self, Visitor &visitor);
+        inline static int _skipNoHash(const void *buf, int offset, int maxlen);
         inline static uint64_t _computeHash(const __lcm_hash_ptr *p);
 };
 
+static_assert(MultiArrayDimension::kHash == dimos_lcm::fingerprint(
+    dimos_lcm::signature_hash()
+        .member("label", "string", 0)
+        .member("size", "int32_t", 0)
+        .member("stride", "int32_t", 0)
+        .value()),
+    "std_msgs::MultiArrayDimension fingerprint does not match its definition");
+
 int MultiArrayDimension::encode(void *buf, int offset, int maxlen) const
 {
     int pos = 0, tlen;
@@ -84,6 +150,15 @@ int MultiArrayDimension::encode(void *buf, int offset, int maxlen) const
     return pos;
 }
 
+int MultiArrayDimension::encodeTo(std::vector<uint8_t> &buf) const
+{
+    dimos_lcm::vector_writer out(buf);
+    int64_t hash = getHash();
+    out.put(&hash, 1);
+    this->_writeNoHash(out);
+    return static_cast<int>(out.size());
+}
+
 int MultiArrayDimension::decode(const void *buf, int offset, int maxlen)
 {
     int pos = 0, thislen;
@@ -99,6 +174,22 @@ int MultiArrayDimension::decode(const void *buf, int offset, int maxlen)
     return pos;
 }
 
+template <uint64_t Mask>
+int MultiArrayDimension::decodeFields(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, thislen;
+
+    int64_t msg_hash;
+    thislen = __int64_t_decode_array(buf, offset + pos, maxlen - pos, &msg_hash, 1);
+    if (thislen < 0) return thislen; else pos += thislen;
+    if (msg_hash != getHash()) return -1;
+
+    thislen = this->_decodeFieldsNoHash<Mask>(buf, offset + pos, maxlen - pos);
+    if (thislen < 0) return thislen; else pos += thislen;
+
+    return pos;
+}
+
 int MultiArrayDimension::getEncodedSize() const
 {
     return 8 + _getEncodedSizeNoHash();
@@ -106,8 +197,7 @@ int MultiArrayDimension::getEncodedSize() const
 
 int64_t MultiArrayDimension::getHash()
 {
-    static int64_t hash = static_cast<int64_t>(_computeHash(NULL));
-    return hash;
+    return kHash;
 }
 
 const char* MultiArrayDimension::getTypeName()
@@ -133,6 +223,14 @@ int MultiArrayDimension::_encodeNoHash(void *buf, int offset, int maxlen) const
     return pos;
 }
 
+template <typename Writer>
+void MultiArrayDimension::_writeNoHash(Writer &out) const
+{
+    out.put(this->label);
+    out.put(&this->size, 1);
+    out.put(&this->stride, 1);
+}
+
 int MultiArrayDimension::_decodeNoHash(const void *buf, int offset, int maxlen)
 {
     int pos = 0, tlen;
@@ -141,7 +239,7 @@ int MultiArrayDimension::_decodeNoHash(const void *buf, int offset, int maxlen)
     tlen = __int32_t_decode_array(
         buf, offset + pos, maxlen - pos, &__label_len__, 1);
     if(tlen < 0) return tlen; else pos += tlen;
-    if(__label_len__ > maxlen - pos) return -1;
+    if(__label_len__ < 1 || __label_len__ > maxlen - pos) return -1;
     this->label.assign(
         static_cast<const char*>(buf) + offset + pos, __label_len__ - 1);
     pos += __label_len__;
@@ -155,6 +253,37 @@ int MultiArrayDimension::_decodeNoHash(const void *buf, int offset, int maxlen)
     return pos;
 }
 
+template <uint64_t Mask>
+int MultiArrayDimension::_decodeFieldsNoHash(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, tlen;
+
+    if ((Mask & Fields::label) != 0) {
+        int32_t __label_len__;
+        tlen = __int32_t_decode_array(
+            buf, offset + pos, maxlen - pos, &__label_len__, 1);
+        if(tlen < 0) return tlen; else pos += tlen;
+        if(__label_len__ < 1 || __label_len__ > maxlen - pos) return -1;
+        this->label.assign(
+            static_cast<const char*>(buf) + offset + pos, __label_len__ - 1);
+        pos += __label_len__;
+    } else {
+        int32_t __label_len__;
+        tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &__label_len__, 1);
+        if(tlen < 0) return tlen; else pos += tlen;
+        if(__label_len__ < 0 || __label_len__ > maxlen - pos) return -1;
+        pos += __label_len__;
+    }
+
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &this->size, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &this->stride, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    return pos;
+}
+
 int MultiArrayDimension::_getEncodedSizeNoHash() const
 {
     int enc_size = 0;
@@ -164,6 +293,28 @@ int MultiArrayDimension::_getEncodedSizeNoHash() const
     return enc_size;
 }
 
+int MultiArrayDimension::_skipNoHash(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, tlen;
+    int32_t __label_len__;
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &__label_len__, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+    if(__label_len__ < 0 || __label_len__ > maxlen - pos) return -1;
+    pos += __label_len__;
+    pos += 4;
+    pos += 4;
+    if(pos > maxlen) return -1;
+    return pos;
+}
+
+template <typename Self, typename Visitor>
+void MultiArrayDimension::_forEachField(Self &self, Visitor &visitor)
+{
+    visitor(kFields[0], self.label);
+    visitor(kFields[1], self.size);
+    visitor(kFields[2], self.stride);
+}
+
 uint64_t MultiArrayDimension::_computeHash(const __lcm_hash_ptr *)
 {
     uint64_t hash = 0xcec1b9e9d868ef97LL;
@@ -0,0 +1,122 @@
+/** THIS IS AN AUTOMATICALLY GENERATED FILE.  DO NOT MODIFY
+ * BY HAND!!
+ *
+ * Generated by lcm-cpp (tools/cpp/gen)
+ **/
+
+#ifndef __std_msgs_MultiArrayDimensionView_hpp__
+#define __std_msgs_MultiArrayDimensionView_hpp__
+
+#include <lcm/lcm_coretypes.h>
+
+#include <string_view>
+#include "dimos_lcm/view.hpp"
+#include "std_msgs/MultiArrayDimension.hpp"
+
+namespace std_msgs
+{
+
+/**
+ * Zero-copy read-only view of an encoded std_msgs.MultiArrayDimension.
+ *
+ * Strings and variable-length arrays point into the buffer given to decode(),
+ * which must outlive the view. Decoding validates the whole message once and
+ * never allocates.
+ */
+class MultiArrayDimensionView
+{
+    public:
+        std::string_view label;
+
+        int32_t    size;
+
+        int32_t    stride;
+
+    public:
+        /**
+         * Decode a view over a message in binary form.
+         *
+         * @param buf The buffer containing the encoded message. It must outlive
+         *  this view.
+         * @param offset The byte offset into @p buf where the encoded message starts.
+         * @param maxlen The maximum number of bytes to read while decoding.
+         * @return The number of bytes decoded, or <0 if an error occured.
+         */
+        inline int decode(const void *buf, int offset, int maxlen);
+
+        /**
+         * Copy the viewed message into an owning MultiArrayDimension.
+         */
+        inline void copyTo(MultiArrayDimension &msg) const;
+
+        /**
+         * Returns MultiArrayDimension::getHash()
+         */
+        inline static int64_t getHash();
+
+        /**
+         * Returns "MultiArrayDimension"
+         */
+        inline static const char* getTypeName();
+
+        // LCM support functions. Users should not call these
+        inline int _decodeNoHash(const void *buf, int offset, int maxlen);
+};
+
+int MultiArrayDimensionView::decode(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, thislen;
+
+    int64_t msg_hash;
+    thislen = __int64_t_decode_array(buf, offset + pos, maxlen - pos, &msg_hash, 1);
+    if (thislen < 0) return thislen; else pos += thislen;
+    if (msg_hash != getHash()) return -1;
+
+    thislen = this->_decodeNoHash(buf, offset + pos, maxlen - pos);
+    if (thislen < 0) return thislen; else pos += thislen;
+
+    return pos;
+}
+
+void MultiArrayDimensionView::copyTo(MultiArrayDimension &msg) const
+{
+    msg.label.assign(this->label.data(), this->label.size());
+    msg.size = this->size;
+    msg.stride = this->stride;
+}
+
+int64_t MultiArrayDimensionView::getHash()
+{
+    return MultiArrayDimension::getHash();
+}
+
+const char* MultiArrayDimensionView::getTypeName()
+{
+    return "MultiArrayDimension";
+}
+
+int MultiArrayDimensionView::_decodeNoHash(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, tlen;
+
+    int32_t __label_len__;
+    tlen = __int32_t_decode_array(
+        buf, offset + pos, maxlen - pos, &__label_len__, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+    if(__label_len__ < 1 || __label_len__ > maxlen - pos) return -1;
+    this->label = std::string_view(
+        static_cast<const char*>(buf) + offset + pos, __label_len__ - 1);
+    pos += __label_len__;
+
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &this->size, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &this->stride, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    return pos;
+}
+
+}
+
+#endif
@@ -1,7 +1,7 @@
 /** THIS IS AN AUTOMATICALLY GENERATED FILE.  DO NOT MODIFY
  * BY HAND!!
  *
- * Generated by lcm-gen 1.5.2
+ * Generated by lcm-cpp (tools/cpp/gen)
  **/
 
 #ifndef __std_msgs_MultiArrayLayout_hpp__
@@ -9,7 +9,11 @@
 
 #include <lcm/lcm_coretypes.h>
 
+#include <array>
 #include <vector>
+#include "dimos_lcm/writer.hpp"
+#include "dimos_lcm/fingerprint.hpp"
+#include "dimos_lcm/reflection.hpp"
 #include "std_msgs/MultiArrayDimension.hpp"
 
 namespace std_msgs
@@ -39,6 +43,15 @@ class MultiArrayLayout
          */
         inline int encode(void *buf, int offset, int maxlen) const;
 
+        /**
+         * Encode a message by appending it to @p buf, walking the message once
+         * instead of sizing it with getEncodedSize() first. @p buf grows
+         * geometrically; reuse it across calls to avoid reallocating.
+         *
+         * @return The number of bytes appended.
+         */
+        inline int encodeTo(std::vector<uint8_t> &buf) const;
+
         /**
          * Check how many bytes are required to encode this message.
          */
@@ -54,6 +67,42 @@ class MultiArrayLayout
          */
         inline int decode(const void *buf, int offset, int maxlen);
 
+        /**
+         * Field bits for decodeFields().
+         */
+        struct Fields
+        {
+            static constexpr uint64_t dim_length = 1ULL << 0;
+            static constexpr uint64_t dim = 1ULL << 1;
+            static constexpr uint64_t data_offset = 1ULL << 2;
+            static constexpr uint64_t all = (1ULL << 3) - 1;
+        };
+
+        /**
+         * Decode only the fields selected by @p Mask, a bitwise or of Fields
+         * values. Strings, arrays and nested structs that are not selected are
+         * skipped over by their length prefixes without being allocated, and
+         * keep their previous value. Scalar fields are always decoded: they
+         * cost nothing to read and array lengths depend on them.
+         *
+         * @return The number of bytes decoded, or <0 if an error occured.
+         */
+        template <uint64_t Mask>
+        inline int decodeFields(const void *buf, int offset, int maxlen);
+
+        /**
+         * Upper bound on the length of every variable-length array of this
+         * type, checked by decode() before anything is allocated; messages
+         * exceeding it fail to decode. It does not apply to nested types,
+         * which have their own. Set it once at startup, before decoding.
+         * Before C++17 it is a constant with no limit.
+         */
+#if __cplusplus >= 201703L
+        static inline int32_t maxArrayLength = INT32_MAX;
+#else
+        static constexpr int32_t maxArrayLength = INT32_MAX;
+#endif
+
         /**
          * Retrieve the 64-bit fingerprint identifying the structure of the message.
          * Note that the fingerprint is the same for all instances of the same
@@ -62,18 +111,49 @@ class MultiArrayLayout
          */
         inline static int64_t getHash();
 
+        /**
+         * The fingerprint returned by getHash(), as a compile-time constant.
+         */
+        static constexpr int64_t kHash = static_cast<int64_t>(0x52f05213caa764a1ULL);
+
         /**
          * Returns "MultiArrayLayout"
          */
         inline static const char* getTypeName();
 
+        /**
+         * Name, LCM type and array dimensions of each field, in wire order.
+         * See dimos_lcm::for_each_field() for visiting the fields themselves.
+         */
+        static constexpr std::array<dimos_lcm::field_info, 3> kFields = {{
+            { "dim_length", "int32_t", true, 0, 0, NULL },
+            { "dim", "std_msgs.MultiArrayDimension", false, 1, -1, "dim_length" },
+            { "data_offset", "int32_t", true, 0, 0, NULL },
+        }};
+
         // LCM support functions. Users should not call these
         inline int _encodeNoHash(void *buf, int offset, int maxlen) const;
+        template <typename Writer>
+        inline void _writeNoHash(Writer &out) const;
         inline int _getEncodedSizeNoHash() const;
         inline int _decodeNoHash(const void *buf, int offset, int maxlen);
+        template <uint64_t Mask>
+        inline int _decodeFieldsNoHash(const void *buf, int offset, int maxlen);
+        template <typename Self, typename Visitor>
+        inline static void _forEachField(Self &self, Visitor &visitor);
+        inline static int _skipNoHash(const void *buf, int offset, int maxlen);
         inline static uint64_t _computeHash(const __lcm_hash_ptr *p);
 };
 
+static_assert(MultiArrayLayout::kHash == dimos_lcm::fingerprint(
+    dimos_lcm::signature_hash()
+        .member("dim_length", "int32_t", 0)
+        .member("dim", NULL, 1).dim(true, "dim_length")
+        .member("data_offset", "int32_t", 0)
+        .value(),
+    std_msgs::MultiArrayDimension::kHash),
+    "std_msgs::MultiArrayLayout fingerprint does not match its definition");
+
 int MultiArrayLayout::encode(void *buf, int offset, int maxlen) const
 {
     int pos = 0, tlen;
@@ -88,6 +168,15 @@ int MultiArrayLayout::encode(void *buf, int offset, int maxlen) const
     return pos;
 }
 
+int MultiArrayLayout::encodeTo(std::vector<uint8_t> &buf) const
+{
+    dimos_lcm::vector_writer out(buf);
+    int64_t hash = getHash();
+    out.put(&hash, 1);
+    this->_writeNoHash(out);
+    return static_cast<int>(out.size());
+}
+
 int MultiArrayLayout::decode(const void *buf, int offset, int maxlen)
 {
     int pos = 0, thislen;
@@ -103,6 +192,22 @@ int MultiArrayLayout::decode(const void *buf, int offset, int maxlen)
     return pos;
 }
 
+template <uint64_t Mask>
+int MultiArrayLayout::decodeFields(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, thislen;
+
+    int64_t msg_hash;
+    thislen = __int64_t_decode_array(buf, offset + pos, maxlen - pos, &msg_hash, 1);
+    if (thislen < 0) return thislen; else pos += thislen;
+    if (msg_hash != getHash()) return -1;
+
+    thislen = this->_decodeFieldsNoHash<Mask>(buf, offset + pos, maxlen - pos);
+    if (thislen < 0) return thislen; else pos += thislen;
+
+    return pos;
+}
+
 int MultiArrayLayout::getEncodedSize() const
 {
     return 8 + _getEncodedSizeNoHash();
@@ -110,8 +215,7 @@ int MultiArrayLayout::getEncodedSize() const
 
 int64_t MultiArrayLayout::getHash()
 {
-    static int64_t hash = static_cast<int64_t>(_computeHash(NULL));
-    return hash;
+    return kHash;
 }
 
 const char* MultiArrayLayout::getTypeName()
@@ -137,6 +241,15 @@ int MultiArrayLayout::_encodeNoHash(void *buf, int offset, int maxlen) const
     return pos;
 }
 
+template <typename Writer>
+void MultiArrayLayout::_writeNoHash(Writer &out) const
+{
+    out.put(&this->dim_length, 1);
+    for (int a0 = 0; a0 < this->dim_length; a0++)
+        this->dim[a0]._writeNoHash(out);
+    out.put(&this->data_offset, 1);
+}
+
 int MultiArrayLayout::_decodeNoHash(const void *buf, int offset, int maxlen)
 {
     int pos = 0, tlen;
@@ -144,6 +257,7 @@ int MultiArrayLayout::_decodeNoHash(const void *buf, int offset, int maxlen)
     tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &this->dim_length, 1);
     if(tlen < 0) return tlen; else pos += tlen;
 
+    if(this->dim_length < 0 || this->dim_length > (maxlen - pos) / 13 || this->dim_length > maxArrayLength) return -1;
     try {
         this->dim.resize(this->dim_length);
     } catch (...) {
@@ -160,6 +274,39 @@ int MultiArrayLayout::_decodeNoHash(const void *buf, int offset, int maxlen)
     return pos;
 }
 
+template <uint64_t Mask>
+int MultiArrayLayout::_decodeFieldsNoHash(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, tlen;
+
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &this->dim_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    if ((Mask & Fields::dim) != 0) {
+        if(this->dim_length < 0 || this->dim_length > (maxlen - pos) / 13 || this->dim_length > maxArrayLength) return -1;
+        try {
+            this->dim.resize(this->dim_length);
+        } catch (...) {
+            return -1;
+        }
+        for (int a0 = 0; a0 < this->dim_length; a0++) {
+            tlen = this->dim[a0]._decodeNoHash(buf, offset + pos, maxlen - pos);
+            if(tlen < 0) return tlen; else pos += tlen;
+        }
+    } else {
+        if(this->dim_length < 0) return -1;
+        for (int a0 = 0; a0 < this->dim_length; a0++) {
+            tlen = std_msgs::MultiArrayDimension::_skipNoHash(buf, offset + pos, maxlen - pos);
+            if(tlen < 0) return tlen; else pos += tlen;
+        }
+    }
+
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &this->data_offset, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    return pos;
+}
+
 int MultiArrayLayout::_getEncodedSizeNoHash() const
 {
     int enc_size = 0;
@@ -171,6 +318,30 @@ int MultiArrayLayout::_getEncodedSizeNoHash() const
     return enc_size;
 }
 
+int MultiArrayLayout::_skipNoHash(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, tlen;
+    int32_t dim_length;
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &dim_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+    if(dim_length < 0) return -1;
+    for (int a0 = 0; a0 < dim_length; a0++) {
+        tlen = std_msgs::MultiArrayDimension::_skipNoHash(buf, offset + pos, maxlen - pos);
+        if(tlen < 0) return tlen; else pos += tlen;
+    }
+    pos += 4;
+    if(pos > maxlen) return -1;
+    return pos;
+}
+
+template <typename Self, typename Visitor>
+void MultiArrayLayout::_forEachField(Self &self, Visitor &visitor)
+{
+    visitor(kFields[0], self.dim_length);
+    visitor(kFields[1], self.dim);
+    visitor(kFields[2], self.data_offset);
+}
+
 uint64_t MultiArrayLayout::_computeHash(const __lcm_hash_ptr *p)
 {
     const __lcm_hash_ptr *fp;
@@ -0,0 +1,125 @@
+/** THIS IS AN AUTOMATICALLY GENERATED FILE.  DO NOT MODIFY
+ * BY HAND!!
+ *
+ * Generated by lcm-cpp (tools/cpp/gen)
+ **/
+
+#ifndef __std_msgs_MultiArrayLayoutView_hpp__
+#define __std_msgs_MultiArrayLayoutView_hpp__
+
+#include <lcm/lcm_coretypes.h>
+
+#include "dimos_lcm/view.hpp"
+#include "std_msgs/MultiArrayLayout.hpp"
+#include "std_msgs/MultiArrayDimensionView.hpp"
+
+namespace std_msgs
+{
+
+/**
+ * Zero-copy read-only view of an encoded std_msgs.MultiArrayLayout.
+ *
+ * Strings and variable-length arrays point into the buffer given to decode(),
+ * which must outlive the view. Decoding validates the whole message once and
+ * never allocates.
+ */
+class MultiArrayLayoutView
+{
+    public:
+        int32_t    dim_length;
+
+        /**
+         * LCM Type: std_msgs.MultiArrayDimension[dim_length]
+         */
+        dimos_lcm::view_array< std_msgs::MultiArrayDimensionView > dim;
+
+        int32_t    data_offset;
+
+    public:
+        /**
+         * Decode a view over a message in binary form.
+         *
+         * @param buf The buffer containing the encoded message. It must outlive
+         *  this view.
+         * @param offset The byte offset into @p buf where the encoded message starts.
+         * @param maxlen The maximum number of bytes to read while decoding.
+         * @return The number of bytes decoded, or <0 if an error occured.
+         */
+        inline int decode(const void *buf, int offset, int maxlen);
+
+        /**
+         * Copy the viewed message into an owning MultiArrayLayout.
+         */
+        inline void copyTo(MultiArrayLayout &msg) const;
+
+        /**
+         * Returns MultiArrayLayout::getHash()
+         */
+        inline static int64_t getHash();
+
+        /**
+         * Returns "MultiArrayLayout"
+         */
+        inline static const char* getTypeName();
+
+        // LCM support functions. Users should not call these
+        inline int _decodeNoHash(const void *buf, int offset, int maxlen);
+};
+
+int MultiArrayLayoutView::decode(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, thislen;
+
+    int64_t msg_hash;
+    thislen = __int64_t_decode_array(buf, offset + pos, maxlen - pos, &msg_hash, 1);
+    if (thislen < 0) return thislen; else pos += thislen;
+    if (msg_hash != getHash()) return -1;
+
+    thislen = this->_decodeNoHash(buf, offset + pos, maxlen - pos);
+    if (thislen < 0) return thislen; else pos += thislen;
+
+    return pos;
+}
+
+void MultiArrayLayoutView::copyTo(MultiArrayLayout &msg) const
+{
+    msg.dim_length = this->dim_length;
+    msg.dim.resize(this->dim.size());
+    {
+        int a0 = 0;
+        for (dimos_lcm::view_array< std_msgs::MultiArrayDimensionView >::iterator it = this->dim.begin();
+            it != this->dim.end(); ++it, a0++)
+            it->copyTo(msg.dim[a0]);
+    }
+    msg.data_offset = this->data_offset;
+}
+
+int64_t MultiArrayLayoutView::getHash()
+{
+    return MultiArrayLayout::getHash();
+}
+
+const char* MultiArrayLayoutView::getTypeName()
+{
+    return "MultiArrayLayout";
+}
+
+int MultiArrayLayoutView::_decodeNoHash(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, tlen;
+
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &this->dim_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = this->dim._decodeNoHash(buf, offset + pos, maxlen - pos, this->dim_length);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &this->data_offset, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    return pos;
+}
+
+}
+
+#endif
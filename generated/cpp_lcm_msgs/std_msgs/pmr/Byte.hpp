@@ -0,0 +1,23 @@
+/** THIS IS AN AUTOMATICALLY GENERATED FILE.  DO NOT MODIFY
+ * BY HAND!!
+ *
+ * Generated by lcm-cpp (tools/cpp/gen)
+ **/
+
+#ifndef __std_msgs_pmr_Byte_hpp__
+#define __std_msgs_pmr_Byte_hpp__
+
+#include "std_msgs/Byte.hpp"
+
+namespace std_msgs
+{
+namespace pmr
+{
+
+// Byte has no strings or variable-length arrays, so it never allocates
+typedef std_msgs::Byte Byte;
+
+}
+}
+
+#endif
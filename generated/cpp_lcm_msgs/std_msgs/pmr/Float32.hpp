@@ -0,0 +1,23 @@
+/** THIS IS AN AUTOMATICALLY GENERATED FILE.  DO NOT MODIFY
+ * BY HAND!!
+ *
+ * Generated by lcm-cpp (tools/cpp/gen)
+ **/
+
+#ifndef __std_msgs_pmr_Float32_hpp__
+#define __std_msgs_pmr_Float32_hpp__
+
+#include "std_msgs/Float32.hpp"
+
+namespace std_msgs
+{
+namespace pmr
+{
+
+// Float32 has no strings or variable-length arrays, so it never allocates
+typedef std_msgs::Float32 Float32;
+
+}
+}
+
+#endif
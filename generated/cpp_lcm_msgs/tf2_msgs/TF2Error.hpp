@@ -1,7 +1,7 @@
 /** THIS IS AN AUTOMATICALLY GENERATED FILE.  DO NOT MODIFY
  * BY HAND!!
  *
- * Generated by lcm-gen 1.5.2
+ * Generated by lcm-cpp (tools/cpp/gen)
  **/
 
 #ifndef __tf2_msgs_TF2Error_hpp__
@@ -9,7 +9,11 @@
 
 #include <lcm/lcm_coretypes.h>
 
+#include <array>
 #include <string>
+#include "dimos_lcm/writer.hpp"
+#include "dimos_lcm/fingerprint.hpp"
+#include "dimos_lcm/reflection.hpp"
 
 namespace tf2_msgs
 {
@@ -70,6 +74,15 @@ class TF2Error
          */
         inline int encode(void *buf, int offset, int maxlen) const;
 
+        /**
+         * Encode a message by appending it to @p buf, walking the message once
+         * instead of sizing it with getEncodedSize() first. @p buf grows
+         * geometrically; reuse it across calls to avoid reallocating.
+         *
+         * @return The number of bytes appended.
+         */
+        inline int encodeTo(std::vector<uint8_t> &buf) const;
+
         /**
          * Check how many bytes are required to encode this message.
          */
@@ -85,6 +98,28 @@ class TF2Error
          */
         inline int decode(const void *buf, int offset, int maxlen);
 
+        /**
+         * Field bits for decodeFields().
+         */
+        struct Fields
+        {
+            static constexpr uint64_t error = 1ULL << 0;
+            static constexpr uint64_t error_string = 1ULL << 1;
+            static constexpr uint64_t all = (1ULL << 2) - 1;
+        };
+
+        /**
+         * Decode only the fields selected by @p Mask, a bitwise or of Fields
+         * values. Strings, arrays and nested structs that are not selected are
+         * skipped over by their length prefixes without being allocated, and
+         * keep their previous value. Scalar fields are always decoded: they
+         * cost nothing to read and array lengths depend on them.
+         *
+         * @return The number of bytes decoded, or <0 if an error occured.
+         */
+        template <uint64_t Mask>
+        inline int decodeFields(const void *buf, int offset, int maxlen);
+
         /**
          * Retrieve the 64-bit fingerprint identifying the structure of the message.
          * Note that the fingerprint is the same for all instances of the same
@@ -93,18 +128,46 @@ class TF2Error
          */
         inline static int64_t getHash();
 
+        /**
+         * The fingerprint returned by getHash(), as a compile-time constant.
+         */
+        static constexpr int64_t kHash = static_cast<int64_t>(0x3d1fe1b01a05dcaaULL);
+
         /**
          * Returns "TF2Error"
          */
         inline static const char* getTypeName();
 
+        /**
+         * Name, LCM type and array dimensions of each field, in wire order.
+         * See dimos_lcm::for_each_field() for visiting the fields themselves.
+         */
+        static constexpr std::array<dimos_lcm::field_info, 2> kFields = {{
+            { "error", "byte", true, 0, 0, NULL },
+            { "error_string", "string", true, 0, 0, NULL },
+        }};
+
         // LCM support functions. Users should not call these
         inline int _encodeNoHash(void *buf, int offset, int maxlen) const;
+        template <typename Writer>
+        inline void _writeNoHash(Writer &out) const;
         inline int _getEncodedSizeNoHash() const;
         inline int _decodeNoHash(const void *buf, int offset, int maxlen);
+        template <uint64_t Mask>
+        inline int _decodeFieldsNoHash(const void *buf, int offset, int maxlen);
+        template <typename Self, typename Visitor>
+        inline static void _forEachField(Self &self, Visitor &visitor);
+        inline static int _skipNoHash(const void *buf, int offset, int maxlen);
         inline static uint64_t _computeHash(const __lcm_hash_ptr *p);
 };
 
+static_assert(TF2Error::kHash == dimos_lcm::fingerprint(
+    dimos_lcm::signature_hash()
+        .member("error", "byte", 0)
+        .member("error_string", "string", 0)
+        .value()),
+    "tf2_msgs::TF2Error fingerprint does not match its definition");
+
 int TF2Error::encode(void *buf, int offset, int maxlen) const
 {
     int pos = 0, tlen;
@@ -119,6 +182,15 @@ int TF2Error::encode(void *buf, int offset, int maxlen) const
     return pos;
 }
 
+int TF2Error::encodeTo(std::vector<uint8_t> &buf) const
+{
+    dimos_lcm::vector_writer out(buf);
+    int64_t hash = getHash();
+    out.put(&hash, 1);
+    this->_writeNoHash(out);
+    return static_cast<int>(out.size());
+}
+
 int TF2Error::decode(const void *buf, int offset, int maxlen)
 {
     int pos = 0, thislen;
@@ -134,6 +206,22 @@ int TF2Error::decode(const void *buf, int offset, int maxlen)
     return pos;
 }
 
+template <uint64_t Mask>
+int TF2Error::decodeFields(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, thislen;
+
+    int64_t msg_hash;
+    thislen = __int64_t_decode_array(buf, offset + pos, maxlen - pos, &msg_hash, 1);
+    if (thislen < 0) return thislen; else pos += thislen;
+    if (msg_hash != getHash()) return -1;
+
+    thislen = this->_decodeFieldsNoHash<Mask>(buf, offset + pos, maxlen - pos);
+    if (thislen < 0) return thislen; else pos += thislen;
+
+    return pos;
+}
+
 int TF2Error::getEncodedSize() const
 {
     return 8 + _getEncodedSizeNoHash();
@@ -141,8 +229,7 @@ int TF2Error::getEncodedSize() const
 
 int64_t TF2Error::getHash()
 {
-    static int64_t hash = static_cast<int64_t>(_computeHash(NULL));
-    return hash;
+    return kHash;
 }
 
 const char* TF2Error::getTypeName()
@@ -165,6 +252,13 @@ int TF2Error::_encodeNoHash(void *buf, int offset, int maxlen) const
     return pos;
 }
 
+template <typename Writer>
+void TF2Error::_writeNoHash(Writer &out) const
+{
+    out.put(&this->error, 1);
+    out.put(this->error_string);
+}
+
 int TF2Error::_decodeNoHash(const void *buf, int offset, int maxlen)
 {
     int pos = 0, tlen;
@@ -176,7 +270,7 @@ int TF2Error::_decodeNoHash(const void *buf, int offset, int maxlen)
     tlen = __int32_t_decode_array(
         buf, offset + pos, maxlen - pos, &__error_string_len__, 1);
     if(tlen < 0) return tlen; else pos += tlen;
-    if(__error_string_len__ > maxlen - pos) return -1;
+    if(__error_string_len__ < 1 || __error_string_len__ > maxlen - pos) return -1;
     this->error_string.assign(
         static_cast<const char*>(buf) + offset + pos, __error_string_len__ - 1);
     pos += __error_string_len__;
@@ -184,6 +278,34 @@ int TF2Error::_decodeNoHash(const void *buf, int offset, int maxlen)
     return pos;
 }
 
+template <uint64_t Mask>
+int TF2Error::_decodeFieldsNoHash(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, tlen;
+
+    tlen = __byte_decode_array(buf, offset + pos, maxlen - pos, &this->error, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    if ((Mask & Fields::error_string) != 0) {
+        int32_t __error_string_len__;
+        tlen = __int32_t_decode_array(
+            buf, offset + pos, maxlen - pos, &__error_string_len__, 1);
+        if(tlen < 0) return tlen; else pos += tlen;
+        if(__error_string_len__ < 1 || __error_string_len__ > maxlen - pos) return -1;
+        this->error_string.assign(
+            static_cast<const char*>(buf) + offset + pos, __error_string_len__ - 1);
+        pos += __error_string_len__;
+    } else {
+        int32_t __error_string_len__;
+        tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &__error_string_len__, 1);
+        if(tlen < 0) return tlen; else pos += tlen;
+        if(__error_string_len__ < 0 || __error_string_len__ > maxlen - pos) return -1;
+        pos += __error_string_len__;
+    }
+
+    return pos;
+}
+
 int TF2Error::_getEncodedSizeNoHash() const
 {
     int enc_size = 0;
@@ -192,6 +314,26 @@ int TF2Error::_getEncodedSizeNoHash() const
     return enc_size;
 }
 
+int TF2Error::_skipNoHash(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, tlen;
+    pos += 1;
+    int32_t __error_string_len__;
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &__error_string_len__, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+    if(__error_string_len__ < 0 || __error_string_len__ > maxlen - pos) return -1;
+    pos += __error_string_len__;
+    if(pos > maxlen) return -1;
+    return pos;
+}
+
+template <typename Self, typename Visitor>
+void TF2Error::_forEachField(Self &self, Visitor &visitor)
+{
+    visitor(kFields[0], self.error);
+    visitor(kFields[1], self.error_string);
+}
+
 uint64_t TF2Error::_computeHash(const __lcm_hash_ptr *)
 {
     uint64_t hash = 0x1e8ff0d80d02ee55LL;
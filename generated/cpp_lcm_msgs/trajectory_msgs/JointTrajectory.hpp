@@ -1,7 +1,7 @@
 /** THIS IS AN AUTOMATICALLY GENERATED FILE.  DO NOT MODIFY
  * BY HAND!!
  *
- * Generated by lcm-gen 1.5.2
+ * Generated by lcm-cpp (tools/cpp/gen)
  **/
 
 #ifndef __trajectory_msgs_JointTrajectory_hpp__
@@ -9,10 +9,17 @@
 
 #include <lcm/lcm_coretypes.h>
 
+#include <array>
 #include <vector>
 #include <string>
+#include "dimos_lcm/writer.hpp"
+#include "dimos_lcm/fingerprint.hpp"
+#include "dimos_lcm/reflection.hpp"
 #include "std_msgs/Header.hpp"
 #include "trajectory_msgs/JointTrajectoryPoint.hpp"
+#if __cplusplus >= 201703L
+#include "std_msgs/HeaderView.hpp"
+#endif
 
 namespace trajectory_msgs
 {
@@ -48,6 +55,15 @@ class JointTrajectory
          */
         inline int encode(void *buf, int offset, int maxlen) const;
 
+        /**
+         * Encode a message by appending it to @p buf, walking the message once
+         * instead of sizing it with getEncodedSize() first. @p buf grows
+         * geometrically; reuse it across calls to avoid reallocating.
+         *
+         * @return The number of bytes appended.
+         */
+        inline int encodeTo(std::vector<uint8_t> &buf) const;
+
         /**
          * Check how many bytes are required to encode this message.
          */
@@ -63,6 +79,62 @@ class JointTrajectory
          */
         inline int decode(const void *buf, int offset, int maxlen);
 
+#if __cplusplus >= 201703L
+        /**
+         * Decode only the header field of an encoded message, leaving the
+         * rest of it untouched. The field sits at a fixed offset, so this costs
+         * the same for any payload size. The view points into @p buf.
+         *
+         * @param buf The buffer containing the encoded message.
+         * @param offset The byte offset into @p buf where the encoded message starts.
+         * @param maxlen The maximum number of bytes to read while decoding.
+         * @param header Receives the decoded header.
+         * @return The number of bytes of the field decoded, or <0 if @p buf does
+         *  not hold a JointTrajectory or is truncated.
+         *
+         * Needs C++17, for the std::string_view of the view.
+         */
+        inline static int peekHeader(const void *buf, int offset, int maxlen, std_msgs::HeaderView &header);
+#endif
+
+        /**
+         * Field bits for decodeFields().
+         */
+        struct Fields
+        {
+            static constexpr uint64_t joint_names_length = 1ULL << 0;
+            static constexpr uint64_t points_length = 1ULL << 1;
+            static constexpr uint64_t header = 1ULL << 2;
+            static constexpr uint64_t joint_names = 1ULL << 3;
+            static constexpr uint64_t points = 1ULL << 4;
+            static constexpr uint64_t all = (1ULL << 5) - 1;
+        };
+
+        /**
+         * Decode only the fields selected by @p Mask, a bitwise or of Fields
+         * values. Strings, arrays and nested structs that are not selected are
+         * skipped over by their length prefixes without being allocated, and
+         * keep their previous value. Scalar fields are always decoded: they
+         * cost nothing to read and array lengths depend on them.
+         *
+         * @return The number of bytes decoded, or <0 if an error occured.
+         */
+        template <uint64_t Mask>
+        inline int decodeFields(const void *buf, int offset, int maxlen);
+
+        /**
+         * Upper bound on the length of every variable-length array of this
+         * type, checked by decode() before anything is allocated; messages
+         * exceeding it fail to decode. It does not apply to nested types,
+         * which have their own. Set it once at startup, before decoding.
+         * Before C++17 it is a constant with no limit.
+         */
+#if __cplusplus >= 201703L
+        static inline int32_t maxArrayLength = INT32_MAX;
+#else
+        static constexpr int32_t maxArrayLength = INT32_MAX;
+#endif
+
         /**
          * Retrieve the 64-bit fingerprint identifying the structure of the message.
          * Note that the fingerprint is the same for all instances of the same
@@ -71,18 +143,54 @@ class JointTrajectory
          */
         inline static int64_t getHash();
 
+        /**
+         * The fingerprint returned by getHash(), as a compile-time constant.
+         */
+        static constexpr int64_t kHash = static_cast<int64_t>(0xae3a209832c6d386ULL);
+
         /**
          * Returns "JointTrajectory"
          */
         inline static const char* getTypeName();
 
+        /**
+         * Name, LCM type and array dimensions of each field, in wire order.
+         * See dimos_lcm::for_each_field() for visiting the fields themselves.
+         */
+        static constexpr std::array<dimos_lcm::field_info, 5> kFields = {{
+            { "joint_names_length", "int32_t", true, 0, 0, NULL },
+            { "points_length", "int32_t", true, 0, 0, NULL },
+            { "header", "std_msgs.Header", false, 0, 0, NULL },
+            { "joint_names", "string", true, 1, -1, "joint_names_length" },
+            { "points", "trajectory_msgs.JointTrajectoryPoint", false, 1, -1, "points_length" },
+        }};
+
         // LCM support functions. Users should not call these
         inline int _encodeNoHash(void *buf, int offset, int maxlen) const;
+        template <typename Writer>
+        inline void _writeNoHash(Writer &out) const;
         inline int _getEncodedSizeNoHash() const;
         inline int _decodeNoHash(const void *buf, int offset, int maxlen);
+        template <uint64_t Mask>
+        inline int _decodeFieldsNoHash(const void *buf, int offset, int maxlen);
+        template <typename Self, typename Visitor>
+        inline static void _forEachField(Self &self, Visitor &visitor);
+        inline static int _skipNoHash(const void *buf, int offset, int maxlen);
         inline static uint64_t _computeHash(const __lcm_hash_ptr *p);
 };
 
+static_assert(JointTrajectory::kHash == dimos_lcm::fingerprint(
+    dimos_lcm::signature_hash()
+        .member("joint_names_length", "int32_t", 0)
+        .member("points_length", "int32_t", 0)
+        .member("header", NULL, 0)
+        .member("joint_names", "string", 1).dim(true, "joint_names_length")
+        .member("points", NULL, 1).dim(true, "points_length")
+        .value(),
+    std_msgs::Header::kHash,
+    trajectory_msgs::JointTrajectoryPoint::kHash),
+    "trajectory_msgs::JointTrajectory fingerprint does not match its definition");
+
 int JointTrajectory::encode(void *buf, int offset, int maxlen) const
 {
     int pos = 0, tlen;
@@ -97,6 +205,15 @@ int JointTrajectory::encode(void *buf, int offset, int maxlen) const
     return pos;
 }
 
+int JointTrajectory::encodeTo(std::vector<uint8_t> &buf) const
+{
+    dimos_lcm::vector_writer out(buf);
+    int64_t hash = getHash();
+    out.put(&hash, 1);
+    this->_writeNoHash(out);
+    return static_cast<int>(out.size());
+}
+
 int JointTrajectory::decode(const void *buf, int offset, int maxlen)
 {
     int pos = 0, thislen;
@@ -112,6 +229,34 @@ int JointTrajectory::decode(const void *buf, int offset, int maxlen)
     return pos;
 }
 
+#if __cplusplus >= 201703L
+int JointTrajectory::peekHeader(const void *buf, int offset, int maxlen, std_msgs::HeaderView &header)
+{
+    int64_t msg_hash;
+    if (__int64_t_decode_array(buf, offset, maxlen, &msg_hash, 1) < 0) return -1;
+    if (msg_hash != kHash) return -1;
+
+    // header follows the hash and 8 bytes of fixed-size fields
+    return header._decodeNoHash(buf, offset + 16, maxlen - 16);
+}
+#endif
+
+template <uint64_t Mask>
+int JointTrajectory::decodeFields(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, thislen;
+
+    int64_t msg_hash;
+    thislen = __int64_t_decode_array(buf, offset + pos, maxlen - pos, &msg_hash, 1);
+    if (thislen < 0) return thislen; else pos += thislen;
+    if (msg_hash != getHash()) return -1;
+
+    thislen = this->_decodeFieldsNoHash<Mask>(buf, offset + pos, maxlen - pos);
+    if (thislen < 0) return thislen; else pos += thislen;
+
+    return pos;
+}
+
 int JointTrajectory::getEncodedSize() const
 {
     return 8 + _getEncodedSizeNoHash();
@@ -119,8 +264,7 @@ int JointTrajectory::getEncodedSize() const
 
 int64_t JointTrajectory::getHash()
 {
-    static int64_t hash = static_cast<int64_t>(_computeHash(NULL));
-    return hash;
+    return kHash;
 }
 
 const char* JointTrajectory::getTypeName()
@@ -156,6 +300,18 @@ int JointTrajectory::_encodeNoHash(void *buf, int offset, int maxlen) const
     return pos;
 }
 
+template <typename Writer>
+void JointTrajectory::_writeNoHash(Writer &out) const
+{
+    out.put(&this->joint_names_length, 1);
+    out.put(&this->points_length, 1);
+    this->header._writeNoHash(out);
+    for (int a0 = 0; a0 < this->joint_names_length; a0++)
+        out.put(this->joint_names[a0]);
+    for (int a0 = 0; a0 < this->points_length; a0++)
+        this->points[a0]._writeNoHash(out);
+}
+
 int JointTrajectory::_decodeNoHash(const void *buf, int offset, int maxlen)
 {
     int pos = 0, tlen;
@@ -169,6 +325,7 @@ int JointTrajectory::_decodeNoHash(const void *buf, int offset, int maxlen)
     tlen = this->header._decodeNoHash(buf, offset + pos, maxlen - pos);
     if(tlen < 0) return tlen; else pos += tlen;
 
+    if(this->joint_names_length < 0 || this->joint_names_length > (maxlen - pos) / 5 || this->joint_names_length > maxArrayLength) return -1;
     try {
         this->joint_names.resize(this->joint_names_length);
     } catch (...) {
@@ -179,11 +336,12 @@ int JointTrajectory::_decodeNoHash(const void *buf, int offset, int maxlen)
         tlen = __int32_t_decode_array(
             buf, offset + pos, maxlen - pos, &__elem_len, 1);
         if(tlen < 0) return tlen; else pos += tlen;
-        if(__elem_len > maxlen - pos) return -1;
+        if(__elem_len < 1 || __elem_len > maxlen - pos) return -1;
         this->joint_names[a0].assign(static_cast<const char*>(buf) + offset + pos, __elem_len -  1);
         pos += __elem_len;
     }
 
+    if(this->points_length < 0 || this->points_length > (maxlen - pos) / 24 || this->points_length > maxArrayLength) return -1;
     try {
         this->points.resize(this->points_length);
     } catch (...) {
@@ -197,6 +355,74 @@ int JointTrajectory::_decodeNoHash(const void *buf, int offset, int maxlen)
     return pos;
 }
 
+template <uint64_t Mask>
+int JointTrajectory::_decodeFieldsNoHash(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, tlen;
+
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &this->joint_names_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &this->points_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    if ((Mask & Fields::header) != 0) {
+        tlen = this->header._decodeNoHash(buf, offset + pos, maxlen - pos);
+        if(tlen < 0) return tlen; else pos += tlen;
+    } else {
+        tlen = std_msgs::Header::_skipNoHash(buf, offset + pos, maxlen - pos);
+        if(tlen < 0) return tlen; else pos += tlen;
+    }
+
+    if ((Mask & Fields::joint_names) != 0) {
+        if(this->joint_names_length < 0 || this->joint_names_length > (maxlen - pos) / 5 || this->joint_names_length > maxArrayLength) return -1;
+        try {
+            this->joint_names.resize(this->joint_names_length);
+        } catch (...) {
+            return -1;
+        }
+        for (int a0 = 0; a0 < this->joint_names_length; a0++) {
+            int32_t __elem_len;
+            tlen = __int32_t_decode_array(
+                buf, offset + pos, maxlen - pos, &__elem_len, 1);
+            if(tlen < 0) return tlen; else pos += tlen;
+            if(__elem_len < 1 || __elem_len > maxlen - pos) return -1;
+            this->joint_names[a0].assign(static_cast<const char*>(buf) + offset + pos, __elem_len -  1);
+            pos += __elem_len;
+        }
+    } else {
+        if(this->joint_names_length < 0) return -1;
+        for (int a0 = 0; a0 < this->joint_names_length; a0++) {
+            int32_t __joint_names_len__;
+            tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &__joint_names_len__, 1);
+            if(tlen < 0) return tlen; else pos += tlen;
+            if(__joint_names_len__ < 0 || __joint_names_len__ > maxlen - pos) return -1;
+            pos += __joint_names_len__;
+        }
+    }
+
+    if ((Mask & Fields::points) != 0) {
+        if(this->points_length < 0 || this->points_length > (maxlen - pos) / 24 || this->points_length > maxArrayLength) return -1;
+        try {
+            this->points.resize(this->points_length);
+        } catch (...) {
+            return -1;
+        }
+        for (int a0 = 0; a0 < this->points_length; a0++) {
+            tlen = this->points[a0]._decodeNoHash(buf, offset + pos, maxlen - pos);
+            if(tlen < 0) return tlen; else pos += tlen;
+        }
+    } else {
+        if(this->points_length < 0) return -1;
+        for (int a0 = 0; a0 < this->points_length; a0++) {
+            tlen = trajectory_msgs::JointTrajectoryPoint::_skipNoHash(buf, offset + pos, maxlen - pos);
+            if(tlen < 0) return tlen; else pos += tlen;
+        }
+    }
+
+    return pos;
+}
+
 int JointTrajectory::_getEncodedSizeNoHash() const
 {
     int enc_size = 0;
@@ -212,6 +438,44 @@ int JointTrajectory::_getEncodedSizeNoHash() const
     return enc_size;
 }
 
+int JointTrajectory::_skipNoHash(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, tlen;
+    int32_t joint_names_length;
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &joint_names_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+    int32_t points_length;
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &points_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+    tlen = std_msgs::Header::_skipNoHash(buf, offset + pos, maxlen - pos);
+    if(tlen < 0) return tlen; else pos += tlen;
+    if(joint_names_length < 0) return -1;
+    for (int a0 = 0; a0 < joint_names_length; a0++) {
+        int32_t __joint_names_len__;
+        tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &__joint_names_len__, 1);
+        if(tlen < 0) return tlen; else pos += tlen;
+        if(__joint_names_len__ < 0 || __joint_names_len__ > maxlen - pos) return -1;
+        pos += __joint_names_len__;
+    }
+    if(points_length < 0) return -1;
+    for (int a0 = 0; a0 < points_length; a0++) {
+        tlen = trajectory_msgs::JointTrajectoryPoint::_skipNoHash(buf, offset + pos, maxlen - pos);
+        if(tlen < 0) return tlen; else pos += tlen;
+    }
+    if(pos > maxlen) return -1;
+    return pos;
+}
+
+template <typename Self, typename Visitor>
+void JointTrajectory::_forEachField(Self &self, Visitor &visitor)
+{
+    visitor(kFields[0], self.joint_names_length);
+    visitor(kFields[1], self.points_length);
+    visitor(kFields[2], self.header);
+    visitor(kFields[3], self.joint_names);
+    visitor(kFields[4], self.points);
+}
+
 uint64_t JointTrajectory::_computeHash(const __lcm_hash_ptr *p)
 {
     const __lcm_hash_ptr *fp;
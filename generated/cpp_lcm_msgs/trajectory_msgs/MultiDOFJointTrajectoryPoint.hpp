@@ -1,7 +1,7 @@
 /** THIS IS AN AUTOMATICALLY GENERATED FILE.  DO NOT MODIFY
  * BY HAND!!
  *
- * Generated by lcm-gen 1.5.2
+ * Generated by lcm-cpp (tools/cpp/gen)
  **/
 
 #ifndef __trajectory_msgs_MultiDOFJointTrajectoryPoint_hpp__
@@ -9,10 +9,13 @@
 
 #include <lcm/lcm_coretypes.h>
 
+#include <array>
 #include <vector>
+#include "dimos_lcm/writer.hpp"
+#include "dimos_lcm/fingerprint.hpp"
+#include "dimos_lcm/reflection.hpp"
 #include "geometry_msgs/Transform.hpp"
 #include "geometry_msgs/Twist.hpp"
-#include "geometry_msgs/Twist.hpp"
 #include "std_msgs/Duration.hpp"
 
 namespace trajectory_msgs
@@ -56,6 +59,15 @@ class MultiDOFJointTrajectoryPoint
          */
         inline int encode(void *buf, int offset, int maxlen) const;
 
+        /**
+         * Encode a message by appending it to @p buf, walking the message once
+         * instead of sizing it with getEncodedSize() first. @p buf grows
+         * geometrically; reuse it across calls to avoid reallocating.
+         *
+         * @return The number of bytes appended.
+         */
+        inline int encodeTo(std::vector<uint8_t> &buf) const;
+
         /**
          * Check how many bytes are required to encode this message.
          */
@@ -71,6 +83,46 @@ class MultiDOFJointTrajectoryPoint
          */
         inline int decode(const void *buf, int offset, int maxlen);
 
+        /**
+         * Field bits for decodeFields().
+         */
+        struct Fields
+        {
+            static constexpr uint64_t transforms_length = 1ULL << 0;
+            static constexpr uint64_t velocities_length = 1ULL << 1;
+            static constexpr uint64_t accelerations_length = 1ULL << 2;
+            static constexpr uint64_t transforms = 1ULL << 3;
+            static constexpr uint64_t velocities = 1ULL << 4;
+            static constexpr uint64_t accelerations = 1ULL << 5;
+            static constexpr uint64_t time_from_start = 1ULL << 6;
+            static constexpr uint64_t all = (1ULL << 7) - 1;
+        };
+
+        /**
+         * Decode only the fields selected by @p Mask, a bitwise or of Fields
+         * values. Strings, arrays and nested structs that are not selected are
+         * skipped over by their length prefixes without being allocated, and
+         * keep their previous value. Scalar fields are always decoded: they
+         * cost nothing to read and array lengths depend on them.
+         *
+         * @return The number of bytes decoded, or <0 if an error occured.
+         */
+        template <uint64_t Mask>
+        inline int decodeFields(const void *buf, int offset, int maxlen);
+
+        /**
+         * Upper bound on the length of every variable-length array of this
+         * type, checked by decode() before anything is allocated; messages
+         * exceeding it fail to decode. It does not apply to nested types,
+         * which have their own. Set it once at startup, before decoding.
+         * Before C++17 it is a constant with no limit.
+         */
+#if __cplusplus >= 201703L
+        static inline int32_t maxArrayLength = INT32_MAX;
+#else
+        static constexpr int32_t maxArrayLength = INT32_MAX;
+#endif
+
         /**
          * Retrieve the 64-bit fingerprint identifying the structure of the message.
          * Note that the fingerprint is the same for all instances of the same
@@ -79,18 +131,60 @@ class MultiDOFJointTrajectoryPoint
          */
         inline static int64_t getHash();
 
+        /**
+         * The fingerprint returned by getHash(), as a compile-time constant.
+         */
+        static constexpr int64_t kHash = static_cast<int64_t>(0xe51adccf8f4f72d4ULL);
+
         /**
          * Returns "MultiDOFJointTrajectoryPoint"
          */
         inline static const char* getTypeName();
 
+        /**
+         * Name, LCM type and array dimensions of each field, in wire order.
+         * See dimos_lcm::for_each_field() for visiting the fields themselves.
+         */
+        static constexpr std::array<dimos_lcm::field_info, 7> kFields = {{
+            { "transforms_length", "int32_t", true, 0, 0, NULL },
+            { "velocities_length", "int32_t", true, 0, 0, NULL },
+            { "accelerations_length", "int32_t", true, 0, 0, NULL },
+            { "transforms", "geometry_msgs.Transform", false, 1, -1, "transforms_length" },
+            { "velocities", "geometry_msgs.Twist", false, 1, -1, "velocities_length" },
+            { "accelerations", "geometry_msgs.Twist", false, 1, -1, "accelerations_length" },
+            { "time_from_start", "std_msgs.Duration", false, 0, 0, NULL },
+        }};
+
         // LCM support functions. Users should not call these
         inline int _encodeNoHash(void *buf, int offset, int maxlen) const;
+        template <typename Writer>
+        inline void _writeNoHash(Writer &out) const;
         inline int _getEncodedSizeNoHash() const;
         inline int _decodeNoHash(const void *buf, int offset, int maxlen);
+        template <uint64_t Mask>
+        inline int _decodeFieldsNoHash(const void *buf, int offset, int maxlen);
+        template <typename Self, typename Visitor>
+        inline static void _forEachField(Self &self, Visitor &visitor);
+        inline static int _skipNoHash(const void *buf, int offset, int maxlen);
         inline static uint64_t _computeHash(const __lcm_hash_ptr *p);
 };
 
+static_assert(MultiDOFJointTrajectoryPoint::kHash == dimos_lcm::fingerprint(
+    dimos_lcm::signature_hash()
+        .member("transforms_length", "int32_t", 0)
+        .member("velocities_length", "int32_t", 0)
+        .member("accelerations_length", "int32_t", 0)
+        .member("transforms", NULL, 1).dim(true, "transforms_length")
+        .member("velocities", NULL, 1).dim(true, "velocities_length")
+        .member("accelerations", NULL, 1).dim(true, "accelerations_length")
+        .member("time_from_start", NULL, 0)
+        .value(),
+    geometry_msgs::Transform::kHash,
+    geometry_msgs::Twist::kHash,
+    geometry_msgs::Twist::kHash,
+    std_msgs::Duration::kHash),
+    "trajectory_msgs::MultiDOFJointTrajectoryPoint fingerprint does not match its definition");
+
 int MultiDOFJointTrajectoryPoint::encode(void *buf, int offset, int maxlen) const
 {
     int pos = 0, tlen;
@@ -105,6 +199,15 @@ int MultiDOFJointTrajectoryPoint::encode(void *buf, int offset, int maxlen) cons
     return pos;
 }
 
+int MultiDOFJointTrajectoryPoint::encodeTo(std::vector<uint8_t> &buf) const
+{
+    dimos_lcm::vector_writer out(buf);
+    int64_t hash = getHash();
+    out.put(&hash, 1);
+    this->_writeNoHash(out);
+    return static_cast<int>(out.size());
+}
+
 int MultiDOFJointTrajectoryPoint::decode(const void *buf, int offset, int maxlen)
 {
     int pos = 0, thislen;
@@ -120,6 +223,22 @@ int MultiDOFJointTrajectoryPoint::decode(const void *buf, int offset, int maxlen
     return pos;
 }
 
+template <uint64_t Mask>
+int MultiDOFJointTrajectoryPoint::decodeFields(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, thislen;
+
+    int64_t msg_hash;
+    thislen = __int64_t_decode_array(buf, offset + pos, maxlen - pos, &msg_hash, 1);
+    if (thislen < 0) return thislen; else pos += thislen;
+    if (msg_hash != getHash()) return -1;
+
+    thislen = this->_decodeFieldsNoHash<Mask>(buf, offset + pos, maxlen - pos);
+    if (thislen < 0) return thislen; else pos += thislen;
+
+    return pos;
+}
+
 int MultiDOFJointTrajectoryPoint::getEncodedSize() const
 {
     return 8 + _getEncodedSizeNoHash();
@@ -127,8 +246,7 @@ int MultiDOFJointTrajectoryPoint::getEncodedSize() const
 
 int64_t MultiDOFJointTrajectoryPoint::getHash()
 {
-    static int64_t hash = static_cast<int64_t>(_computeHash(NULL));
-    return hash;
+    return kHash;
 }
 
 const char* MultiDOFJointTrajectoryPoint::getTypeName()
@@ -170,6 +288,21 @@ int MultiDOFJointTrajectoryPoint::_encodeNoHash(void *buf, int offset, int maxle
     return pos;
 }
 
+template <typename Writer>
+void MultiDOFJointTrajectoryPoint::_writeNoHash(Writer &out) const
+{
+    out.put(&this->transforms_length, 1);
+    out.put(&this->velocities_length, 1);
+    out.put(&this->accelerations_length, 1);
+    if(this->transforms_length > 0)
+        out.putStructArray(&this->transforms[0], this->transforms_length);
+    if(this->velocities_length > 0)
+        out.putStructArray(&this->velocities[0], this->velocities_length);
+    if(this->accelerations_length > 0)
+        out.putStructArray(&this->accelerations[0], this->accelerations_length);
+    this->time_from_start._writeNoHash(out);
+}
+
 int MultiDOFJointTrajectoryPoint::_decodeNoHash(const void *buf, int offset, int maxlen)
 {
     int pos = 0, tlen;
@@ -183,6 +316,7 @@ int MultiDOFJointTrajectoryPoint::_decodeNoHash(const void *buf, int offset, int
     tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &this->accelerations_length, 1);
     if(tlen < 0) return tlen; else pos += tlen;
 
+    if(this->transforms_length < 0 || this->transforms_length > (maxlen - pos) / 56 || this->transforms_length > maxArrayLength) return -1;
     try {
         this->transforms.resize(this->transforms_length);
     } catch (...) {
@@ -193,6 +327,7 @@ int MultiDOFJointTrajectoryPoint::_decodeNoHash(const void *buf, int offset, int
         if(tlen < 0) return tlen; else pos += tlen;
     }
 
+    if(this->velocities_length < 0 || this->velocities_length > (maxlen - pos) / 48 || this->velocities_length > maxArrayLength) return -1;
     try {
         this->velocities.resize(this->velocities_length);
     } catch (...) {
@@ -203,6 +338,7 @@ int MultiDOFJointTrajectoryPoint::_decodeNoHash(const void *buf, int offset, int
         if(tlen < 0) return tlen; else pos += tlen;
     }
 
+    if(this->accelerations_length < 0 || this->accelerations_length > (maxlen - pos) / 48 || this->accelerations_length > maxArrayLength) return -1;
     try {
         this->accelerations.resize(this->accelerations_length);
     } catch (...) {
@@ -219,6 +355,88 @@ int MultiDOFJointTrajectoryPoint::_decodeNoHash(const void *buf, int offset, int
     return pos;
 }
 
+template <uint64_t Mask>
+int MultiDOFJointTrajectoryPoint::_decodeFieldsNoHash(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, tlen;
+
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &this->transforms_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &this->velocities_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &this->accelerations_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    if ((Mask & Fields::transforms) != 0) {
+        if(this->transforms_length < 0 || this->transforms_length > (maxlen - pos) / 56 || this->transforms_length > maxArrayLength) return -1;
+        try {
+            this->transforms.resize(this->transforms_length);
+        } catch (...) {
+            return -1;
+        }
+        for (int a0 = 0; a0 < this->transforms_length; a0++) {
+            tlen = this->transforms[a0]._decodeNoHash(buf, offset + pos, maxlen - pos);
+            if(tlen < 0) return tlen; else pos += tlen;
+        }
+    } else {
+        if(this->transforms_length < 0) return -1;
+        for (int a0 = 0; a0 < this->transforms_length; a0++) {
+            tlen = geometry_msgs::Transform::_skipNoHash(buf, offset + pos, maxlen - pos);
+            if(tlen < 0) return tlen; else pos += tlen;
+        }
+    }
+
+    if ((Mask & Fields::velocities) != 0) {
+        if(this->velocities_length < 0 || this->velocities_length > (maxlen - pos) / 48 || this->velocities_length > maxArrayLength) return -1;
+        try {
+            this->velocities.resize(this->velocities_length);
+        } catch (...) {
+            return -1;
+        }
+        for (int a0 = 0; a0 < this->velocities_length; a0++) {
+            tlen = this->velocities[a0]._decodeNoHash(buf, offset + pos, maxlen - pos);
+            if(tlen < 0) return tlen; else pos += tlen;
+        }
+    } else {
+        if(this->velocities_length < 0) return -1;
+        for (int a0 = 0; a0 < this->velocities_length; a0++) {
+            tlen = geometry_msgs::Twist::_skipNoHash(buf, offset + pos, maxlen - pos);
+            if(tlen < 0) return tlen; else pos += tlen;
+        }
+    }
+
+    if ((Mask & Fields::accelerations) != 0) {
+        if(this->accelerations_length < 0 || this->accelerations_length > (maxlen - pos) / 48 || this->accelerations_length > maxArrayLength) return -1;
+        try {
+            this->accelerations.resize(this->accelerations_length);
+        } catch (...) {
+            return -1;
+        }
+        for (int a0 = 0; a0 < this->accelerations_length; a0++) {
+            tlen = this->accelerations[a0]._decodeNoHash(buf, offset + pos, maxlen - pos);
+            if(tlen < 0) return tlen; else pos += tlen;
+        }
+    } else {
+        if(this->accelerations_length < 0) return -1;
+        for (int a0 = 0; a0 < this->accelerations_length; a0++) {
+            tlen = geometry_msgs::Twist::_skipNoHash(buf, offset + pos, maxlen - pos);
+            if(tlen < 0) return tlen; else pos += tlen;
+        }
+    }
+
+    if ((Mask & Fields::time_from_start) != 0) {
+        tlen = this->time_from_start._decodeNoHash(buf, offset + pos, maxlen - pos);
+        if(tlen < 0) return tlen; else pos += tlen;
+    } else {
+        tlen = std_msgs::Duration::_skipNoHash(buf, offset + pos, maxlen - pos);
+        if(tlen < 0) return tlen; else pos += tlen;
+    }
+
+    return pos;
+}
+
 int MultiDOFJointTrajectoryPoint::_getEncodedSizeNoHash() const
 {
     int enc_size = 0;
@@ -238,6 +456,51 @@ int MultiDOFJointTrajectoryPoint::_getEncodedSizeNoHash() const
     return enc_size;
 }
 
+int MultiDOFJointTrajectoryPoint::_skipNoHash(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, tlen;
+    int32_t transforms_length;
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &transforms_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+    int32_t velocities_length;
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &velocities_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+    int32_t accelerations_length;
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &accelerations_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+    if(transforms_length < 0) return -1;
+    for (int a0 = 0; a0 < transforms_length; a0++) {
+        tlen = geometry_msgs::Transform::_skipNoHash(buf, offset + pos, maxlen - pos);
+        if(tlen < 0) return tlen; else pos += tlen;
+    }
+    if(velocities_length < 0) return -1;
+    for (int a0 = 0; a0 < velocities_length; a0++) {
+        tlen = geometry_msgs::Twist::_skipNoHash(buf, offset + pos, maxlen - pos);
+        if(tlen < 0) return tlen; else pos += tlen;
+    }
+    if(accelerations_length < 0) return -1;
+    for (int a0 = 0; a0 < accelerations_length; a0++) {
+        tlen = geometry_msgs::Twist::_skipNoHash(buf, offset + pos, maxlen - pos);
+        if(tlen < 0) return tlen; else pos += tlen;
+    }
+    tlen = std_msgs::Duration::_skipNoHash(buf, offset + pos, maxlen - pos);
+    if(tlen < 0) return tlen; else pos += tlen;
+    if(pos > maxlen) return -1;
+    return pos;
+}
+
+template <typename Self, typename Visitor>
+void MultiDOFJointTrajectoryPoint::_forEachField(Self &self, Visitor &visitor)
+{
+    visitor(kFields[0], self.transforms_length);
+    visitor(kFields[1], self.velocities_length);
+    visitor(kFields[2], self.accelerations_length);
+    visitor(kFields[3], self.transforms);
+    visitor(kFields[4], self.velocities);
+    visitor(kFields[5], self.accelerations);
+    visitor(kFields[6], self.time_from_start);
+}
+
 uint64_t MultiDOFJointTrajectoryPoint::_computeHash(const __lcm_hash_ptr *p)
 {
     const __lcm_hash_ptr *fp;
@@ -0,0 +1,588 @@
+/** THIS IS AN AUTOMATICALLY GENERATED FILE.  DO NOT MODIFY
+ * BY HAND!!
+ *
+ * Generated by lcm-cpp (tools/cpp/gen)
+ **/
+
+#ifndef __trajectory_msgs_pmr_JointTrajectoryPoint_hpp__
+#define __trajectory_msgs_pmr_JointTrajectoryPoint_hpp__
+
+#include <lcm/lcm_coretypes.h>
+
+#include <array>
+#include <memory_resource>
+#include <utility>
+#include <vector>
+#include "dimos_lcm/bulk_codec.hpp"
+#include "dimos_lcm/writer.hpp"
+#include "dimos_lcm/fingerprint.hpp"
+#include "dimos_lcm/reflection.hpp"
+#include "std_msgs/pmr/Duration.hpp"
+
+namespace trajectory_msgs
+{
+namespace pmr
+{
+
+class JointTrajectoryPoint
+{
+    public:
+        int32_t    positions_length;
+
+        int32_t    velocities_length;
+
+        int32_t    accelerations_length;
+
+        int32_t    effort_length;
+
+        /**
+         * LCM Type: double[positions_length]
+         */
+        std::pmr::vector< double > positions;
+
+        /**
+         * LCM Type: double[velocities_length]
+         */
+        std::pmr::vector< double > velocities;
+
+        /**
+         * LCM Type: double[accelerations_length]
+         */
+        std::pmr::vector< double > accelerations;
+
+        /**
+         * LCM Type: double[effort_length]
+         */
+        std::pmr::vector< double > effort;
+
+        std_msgs::pmr::Duration time_from_start;
+
+    public:
+        typedef std::pmr::polymorphic_allocator<char> allocator_type;
+
+        /**
+         * Construct a message whose strings and arrays, and those of the
+         * messages it nests, allocate from @p alloc. Scalars are zeroed.
+         */
+        inline explicit JointTrajectoryPoint(const allocator_type &alloc = allocator_type());
+
+        /**
+         * Copy or move @p other into a message that allocates from @p alloc.
+         * With allocator_type, these let std::pmr containers of JointTrajectoryPoint pass
+         * their memory resource on to their elements.
+         */
+        inline JointTrajectoryPoint(const JointTrajectoryPoint &other, const allocator_type &alloc);
+        inline JointTrajectoryPoint(JointTrajectoryPoint &&other, const allocator_type &alloc);
+
+        /**
+         * Encode a message into binary form.
+         *
+         * @param buf The output buffer.
+         * @param offset Encoding starts at thie byte offset into @p buf.
+         * @param maxlen Maximum number of bytes to write.  This should generally be
+         *  equal to getEncodedSize().
+         * @return The number of bytes encoded, or <0 on error.
+         */
+        inline int encode(void *buf, int offset, int maxlen) const;
+
+        /**
+         * Encode a message by appending it to @p buf, walking the message once
+         * instead of sizing it with getEncodedSize() first. @p buf grows
+         * geometrically; reuse it across calls to avoid reallocating.
+         *
+         * @return The number of bytes appended.
+         */
+        inline int encodeTo(std::vector<uint8_t> &buf) const;
+
+        /**
+         * Check how many bytes are required to encode this message.
+         */
+        inline int getEncodedSize() const;
+
+        /**
+         * Decode a message from binary form into this instance.
+         *
+         * @param buf The buffer containing the encoded message.
+         * @param offset The byte offset into @p buf where the encoded message starts.
+         * @param maxlen The maximum number of bytes to read while decoding.
+         * @return The number of bytes decoded, or <0 if an error occured.
+         */
+        inline int decode(const void *buf, int offset, int maxlen);
+
+        /**
+         * Field bits for decodeFields().
+         */
+        struct Fields
+        {
+            static constexpr uint64_t positions_length = 1ULL << 0;
+            static constexpr uint64_t velocities_length = 1ULL << 1;
+            static constexpr uint64_t accelerations_length = 1ULL << 2;
+            static constexpr uint64_t effort_length = 1ULL << 3;
+            static constexpr uint64_t positions = 1ULL << 4;
+            static constexpr uint64_t velocities = 1ULL << 5;
+            static constexpr uint64_t accelerations = 1ULL << 6;
+            static constexpr uint64_t effort = 1ULL << 7;
+            static constexpr uint64_t time_from_start = 1ULL << 8;
+            static constexpr uint64_t all = (1ULL << 9) - 1;
+        };
+
+        /**
+         * Decode only the fields selected by @p Mask, a bitwise or of Fields
+         * values. Strings, arrays and nested structs that are not selected are
+         * skipped over by their length prefixes without being allocated, and
+         * keep their previous value. Scalar fields are always decoded: they
+         * cost nothing to read and array lengths depend on them.
+         *
+         * @return The number of bytes decoded, or <0 if an error occured.
+         */
+        template <uint64_t Mask>
+        inline int decodeFields(const void *buf, int offset, int maxlen);
+
+        /**
+         * Upper bound on the length of every variable-length array of this
+         * type, checked by decode() before anything is allocated; messages
+         * exceeding it fail to decode. It does not apply to nested types,
+         * which have their own. Set it once at startup, before decoding.
+         * Before C++17 it is a constant with no limit.
+         */
+#if __cplusplus >= 201703L
+        static inline int32_t maxArrayLength = INT32_MAX;
+#else
+        static constexpr int32_t maxArrayLength = INT32_MAX;
+#endif
+
+        /**
+         * Retrieve the 64-bit fingerprint identifying the structure of the message.
+         * Note that the fingerprint is the same for all instances of the same
+         * message type, and is a fingerprint on the message type definition, not on
+         * the message contents.
+         */
+        inline static int64_t getHash();
+
+        /**
+         * The fingerprint returned by getHash(), as a compile-time constant.
+         */
+        static constexpr int64_t kHash = static_cast<int64_t>(0x36a44bebdf05de46ULL);
+
+        /**
+         * Returns "JointTrajectoryPoint"
+         */
+        inline static const char* getTypeName();
+
+        /**
+         * Name, LCM type and array dimensions of each field, in wire order.
+         * See dimos_lcm::for_each_field() for visiting the fields themselves.
+         */
+        static constexpr std::array<dimos_lcm::field_info, 9> kFields = {{
+            { "positions_length", "int32_t", true, 0, 0, NULL },
+            { "velocities_length", "int32_t", true, 0, 0, NULL },
+            { "accelerations_length", "int32_t", true, 0, 0, NULL },
+            { "effort_length", "int32_t", true, 0, 0, NULL },
+            { "positions", "double", true, 1, -1, "positions_length" },
+            { "velocities", "double", true, 1, -1, "velocities_length" },
+            { "accelerations", "double", true, 1, -1, "accelerations_length" },
+            { "effort", "double", true, 1, -1, "effort_length" },
+            { "time_from_start", "std_msgs.Duration", false, 0, 0, NULL },
+        }};
+
+        // LCM support functions. Users should not call these
+        inline int _encodeNoHash(void *buf, int offset, int maxlen) const;
+        template <typename Writer>
+        inline void _writeNoHash(Writer &out) const;
+        inline int _getEncodedSizeNoHash() const;
+        inline int _decodeNoHash(const void *buf, int offset, int maxlen);
+        template <uint64_t Mask>
+        inline int _decodeFieldsNoHash(const void *buf, int offset, int maxlen);
+        template <typename Self, typename Visitor>
+        inline static void _forEachField(Self &self, Visitor &visitor);
+        inline static int _skipNoHash(const void *buf, int offset, int maxlen);
+        inline static uint64_t _computeHash(const __lcm_hash_ptr *p);
+};
+
+static_assert(JointTrajectoryPoint::kHash == dimos_lcm::fingerprint(
+    dimos_lcm::signature_hash()
+        .member("positions_length", "int32_t", 0)
+        .member("velocities_length", "int32_t", 0)
+        .member("accelerations_length", "int32_t", 0)
+        .member("effort_length", "int32_t", 0)
+        .member("positions", "double", 1).dim(true, "positions_length")
+        .member("velocities", "double", 1).dim(true, "velocities_length")
+        .member("accelerations", "double", 1).dim(true, "accelerations_length")
+        .member("effort", "double", 1).dim(true, "effort_length")
+        .member("time_from_start", NULL, 0)
+        .value(),
+    std_msgs::pmr::Duration::kHash),
+    "trajectory_msgs::pmr::JointTrajectoryPoint fingerprint does not match its definition");
+
+JointTrajectoryPoint::JointTrajectoryPoint(const allocator_type &alloc) :
+    positions_length(),
+    velocities_length(),
+    accelerations_length(),
+    effort_length(),
+    positions(alloc),
+    velocities(alloc),
+    accelerations(alloc),
+    effort(alloc),
+    time_from_start()
+{
+}
+
+JointTrajectoryPoint::JointTrajectoryPoint(const JointTrajectoryPoint &other, const allocator_type &alloc) :
+    JointTrajectoryPoint(alloc)
+{
+    *this = other;
+}
+
+JointTrajectoryPoint::JointTrajectoryPoint(JointTrajectoryPoint &&other, const allocator_type &alloc) :
+    JointTrajectoryPoint(alloc)
+{
+    *this = std::move(other);
+}
+
+int JointTrajectoryPoint::encode(void *buf, int offset, int maxlen) const
+{
+    int pos = 0, tlen;
+    int64_t hash = getHash();
+
+    tlen = __int64_t_encode_array(buf, offset + pos, maxlen - pos, &hash, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = this->_encodeNoHash(buf, offset + pos, maxlen - pos);
+    if (tlen < 0) return tlen; else pos += tlen;
+
+    return pos;
+}
+
+int JointTrajectoryPoint::encodeTo(std::vector<uint8_t> &buf) const
+{
+    dimos_lcm::vector_writer out(buf);
+    int64_t hash = getHash();
+    out.put(&hash, 1);
+    this->_writeNoHash(out);
+    return static_cast<int>(out.size());
+}
+
+int JointTrajectoryPoint::decode(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, thislen;
+
+    int64_t msg_hash;
+    thislen = __int64_t_decode_array(buf, offset + pos, maxlen - pos, &msg_hash, 1);
+    if (thislen < 0) return thislen; else pos += thislen;
+    if (msg_hash != getHash()) return -1;
+
+    thislen = this->_decodeNoHash(buf, offset + pos, maxlen - pos);
+    if (thislen < 0) return thislen; else pos += thislen;
+
+    return pos;
+}
+
+template <uint64_t Mask>
+int JointTrajectoryPoint::decodeFields(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, thislen;
+
+    int64_t msg_hash;
+    thislen = __int64_t_decode_array(buf, offset + pos, maxlen - pos, &msg_hash, 1);
+    if (thislen < 0) return thislen; else pos += thislen;
+    if (msg_hash != getHash()) return -1;
+
+    thislen = this->_decodeFieldsNoHash<Mask>(buf, offset + pos, maxlen - pos);
+    if (thislen < 0) return thislen; else pos += thislen;
+
+    return pos;
+}
+
+int JointTrajectoryPoint::getEncodedSize() const
+{
+    return 8 + _getEncodedSizeNoHash();
+}
+
+int64_t JointTrajectoryPoint::getHash()
+{
+    return kHash;
+}
+
+const char* JointTrajectoryPoint::getTypeName()
+{
+    return "JointTrajectoryPoint";
+}
+
+int JointTrajectoryPoint::_encodeNoHash(void *buf, int offset, int maxlen) const
+{
+    int pos = 0, tlen;
+
+    tlen = __int32_t_encode_array(buf, offset + pos, maxlen - pos, &this->positions_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = __int32_t_encode_array(buf, offset + pos, maxlen - pos, &this->velocities_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = __int32_t_encode_array(buf, offset + pos, maxlen - pos, &this->accelerations_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = __int32_t_encode_array(buf, offset + pos, maxlen - pos, &this->effort_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    if(this->positions_length > 0) {
+        tlen = dimos_lcm::bulk_encode_array(buf, offset + pos, maxlen - pos, &this->positions[0], this->positions_length);
+        if(tlen < 0) return tlen; else pos += tlen;
+    }
+
+    if(this->velocities_length > 0) {
+        tlen = dimos_lcm::bulk_encode_array(buf, offset + pos, maxlen - pos, &this->velocities[0], this->velocities_length);
+        if(tlen < 0) return tlen; else pos += tlen;
+    }
+
+    if(this->accelerations_length > 0) {
+        tlen = dimos_lcm::bulk_encode_array(buf, offset + pos, maxlen - pos, &this->accelerations[0], this->accelerations_length);
+        if(tlen < 0) return tlen; else pos += tlen;
+    }
+
+    if(this->effort_length > 0) {
+        tlen = dimos_lcm::bulk_encode_array(buf, offset + pos, maxlen - pos, &this->effort[0], this->effort_length);
+        if(tlen < 0) return tlen; else pos += tlen;
+    }
+
+    tlen = this->time_from_start._encodeNoHash(buf, offset + pos, maxlen - pos);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    return pos;
+}
+
+template <typename Writer>
+void JointTrajectoryPoint::_writeNoHash(Writer &out) const
+{
+    out.put(&this->positions_length, 1);
+    out.put(&this->velocities_length, 1);
+    out.put(&this->accelerations_length, 1);
+    out.put(&this->effort_length, 1);
+    if(this->positions_length > 0)
+        out.put(&this->positions[0], this->positions_length);
+    if(this->velocities_length > 0)
+        out.put(&this->velocities[0], this->velocities_length);
+    if(this->accelerations_length > 0)
+        out.put(&this->accelerations[0], this->accelerations_length);
+    if(this->effort_length > 0)
+        out.put(&this->effort[0], this->effort_length);
+    this->time_from_start._writeNoHash(out);
+}
+
+int JointTrajectoryPoint::_decodeNoHash(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, tlen;
+
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &this->positions_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &this->velocities_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &this->accelerations_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &this->effort_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    if(this->positions_length) {
+        if(this->positions_length < 0 || this->positions_length > (maxlen - pos) / 8 || this->positions_length > maxArrayLength) return -1;
+        this->positions.resize(this->positions_length);
+        tlen = dimos_lcm::bulk_decode_array(buf, offset + pos, maxlen - pos, &this->positions[0], this->positions_length);
+        if(tlen < 0) return tlen; else pos += tlen;
+    } else {
+        this->positions.clear();
+    }
+
+    if(this->velocities_length) {
+        if(this->velocities_length < 0 || this->velocities_length > (maxlen - pos) / 8 || this->velocities_length > maxArrayLength) return -1;
+        this->velocities.resize(this->velocities_length);
+        tlen = dimos_lcm::bulk_decode_array(buf, offset + pos, maxlen - pos, &this->velocities[0], this->velocities_length);
+        if(tlen < 0) return tlen; else pos += tlen;
+    } else {
+        this->velocities.clear();
+    }
+
+    if(this->accelerations_length) {
+        if(this->accelerations_length < 0 || this->accelerations_length > (maxlen - pos) / 8 || this->accelerations_length > maxArrayLength) return -1;
+        this->accelerations.resize(this->accelerations_length);
+        tlen = dimos_lcm::bulk_decode_array(buf, offset + pos, maxlen - pos, &this->accelerations[0], this->accelerations_length);
+        if(tlen < 0) return tlen; else pos += tlen;
+    } else {
+        this->accelerations.clear();
+    }
+
+    if(this->effort_length) {
+        if(this->effort_length < 0 || this->effort_length > (maxlen - pos) / 8 || this->effort_length > maxArrayLength) return -1;
+        this->effort.resize(this->effort_length);
+        tlen = dimos_lcm::bulk_decode_array(buf, offset + pos, maxlen - pos, &this->effort[0], this->effort_length);
+        if(tlen < 0) return tlen; else pos += tlen;
+    } else {
+        this->effort.clear();
+    }
+
+    tlen = this->time_from_start._decodeNoHash(buf, offset + pos, maxlen - pos);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    return pos;
+}
+
+template <uint64_t Mask>
+int JointTrajectoryPoint::_decodeFieldsNoHash(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, tlen;
+
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &this->positions_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &this->velocities_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &this->accelerations_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &this->effort_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    if ((Mask & Fields::positions) != 0) {
+        if(this->positions_length) {
+            if(this->positions_length < 0 || this->positions_length > (maxlen - pos) / 8 || this->positions_length > maxArrayLength) return -1;
+            this->positions.resize(this->positions_length);
+            tlen = dimos_lcm::bulk_decode_array(buf, offset + pos, maxlen - pos, &this->positions[0], this->positions_length);
+            if(tlen < 0) return tlen; else pos += tlen;
+        } else {
+            this->positions.clear();
+        }
+    } else {
+        if(this->positions_length < 0 || this->positions_length > (maxlen - pos) / 8) return -1;
+        pos += this->positions_length * 8;
+    }
+
+    if ((Mask & Fields::velocities) != 0) {
+        if(this->velocities_length) {
+            if(this->velocities_length < 0 || this->velocities_length > (maxlen - pos) / 8 || this->velocities_length > maxArrayLength) return -1;
+            this->velocities.resize(this->velocities_length);
+            tlen = dimos_lcm::bulk_decode_array(buf, offset + pos, maxlen - pos, &this->velocities[0], this->velocities_length);
+            if(tlen < 0) return tlen; else pos += tlen;
+        } else {
+            this->velocities.clear();
+        }
+    } else {
+        if(this->velocities_length < 0 || this->velocities_length > (maxlen - pos) / 8) return -1;
+        pos += this->velocities_length * 8;
+    }
+
+    if ((Mask & Fields::accelerations) != 0) {
+        if(this->accelerations_length) {
+            if(this->accelerations_length < 0 || this->accelerations_length > (maxlen - pos) / 8 || this->accelerations_length > maxArrayLength) return -1;
+            this->accelerations.resize(this->accelerations_length);
+            tlen = dimos_lcm::bulk_decode_array(buf, offset + pos, maxlen - pos, &this->accelerations[0], this->accelerations_length);
+            if(tlen < 0) return tlen; else pos += tlen;
+        } else {
+            this->accelerations.clear();
+        }
+    } else {
+        if(this->accelerations_length < 0 || this->accelerations_length > (maxlen - pos) / 8) return -1;
+        pos += this->accelerations_length * 8;
+    }
+
+    if ((Mask & Fields::effort) != 0) {
+        if(this->effort_length) {
+            if(this->effort_length < 0 || this->effort_length > (maxlen - pos) / 8 || this->effort_length > maxArrayLength) return -1;
+            this->effort.resize(this->effort_length);
+            tlen = dimos_lcm::bulk_decode_array(buf, offset + pos, maxlen - pos, &this->effort[0], this->effort_length);
+            if(tlen < 0) return tlen; else pos += tlen;
+        } else {
+            this->effort.clear();
+        }
+    } else {
+        if(this->effort_length < 0 || this->effort_length > (maxlen - pos) / 8) return -1;
+        pos += this->effort_length * 8;
+    }
+
+    if ((Mask & Fields::time_from_start) != 0) {
+        tlen = this->time_from_start._decodeNoHash(buf, offset + pos, maxlen - pos);
+        if(tlen < 0) return tlen; else pos += tlen;
+    } else {
+        tlen = std_msgs::pmr::Duration::_skipNoHash(buf, offset + pos, maxlen - pos);
+        if(tlen < 0) return tlen; else pos += tlen;
+    }
+
+    return pos;
+}
+
+int JointTrajectoryPoint::_getEncodedSizeNoHash() const
+{
+    int enc_size = 0;
+    enc_size += __int32_t_encoded_array_size(NULL, 1);
+    enc_size += __int32_t_encoded_array_size(NULL, 1);
+    enc_size += __int32_t_encoded_array_size(NULL, 1);
+    enc_size += __int32_t_encoded_array_size(NULL, 1);
+    enc_size += __double_encoded_array_size(NULL, this->positions_length);
+    enc_size += __double_encoded_array_size(NULL, this->velocities_length);
+    enc_size += __double_encoded_array_size(NULL, this->accelerations_length);
+    enc_size += __double_encoded_array_size(NULL, this->effort_length);
+    enc_size += this->time_from_start._getEncodedSizeNoHash();
+    return enc_size;
+}
+
+int JointTrajectoryPoint::_skipNoHash(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, tlen;
+    int32_t positions_length;
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &positions_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+    int32_t velocities_length;
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &velocities_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+    int32_t accelerations_length;
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &accelerations_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+    int32_t effort_length;
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &effort_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+    if(positions_length < 0 || positions_length > (maxlen - pos) / 8) return -1;
+    pos += positions_length * 8;
+    if(velocities_length < 0 || velocities_length > (maxlen - pos) / 8) return -1;
+    pos += velocities_length * 8;
+    if(accelerations_length < 0 || accelerations_length > (maxlen - pos) / 8) return -1;
+    pos += accelerations_length * 8;
+    if(effort_length < 0 || effort_length > (maxlen - pos) / 8) return -1;
+    pos += effort_length * 8;
+    tlen = std_msgs::pmr::Duration::_skipNoHash(buf, offset + pos, maxlen - pos);
+    if(tlen < 0) return tlen; else pos += tlen;
+    if(pos > maxlen) return -1;
+    return pos;
+}
+
+template <typename Self, typename Visitor>
+void JointTrajectoryPoint::_forEachField(Self &self, Visitor &visitor)
+{
+    visitor(kFields[0], self.positions_length);
+    visitor(kFields[1], self.velocities_length);
+    visitor(kFields[2], self.accelerations_length);
+    visitor(kFields[3], self.effort_length);
+    visitor(kFields[4], self.positions);
+    visitor(kFields[5], self.velocities);
+    visitor(kFields[6], self.accelerations);
+    visitor(kFields[7], self.effort);
+    visitor(kFields[8], self.time_from_start);
+}
+
+uint64_t JointTrajectoryPoint::_computeHash(const __lcm_hash_ptr *p)
+{
+    const __lcm_hash_ptr *fp;
+    for(fp = p; fp != NULL; fp = fp->parent)
+        if(fp->v == JointTrajectoryPoint::getHash)
+            return 0;
+    const __lcm_hash_ptr cp = { p, JointTrajectoryPoint::getHash };
+
+    uint64_t hash = 0x5f17dcae9da98292LL +
+         std_msgs::pmr::Duration::_computeHash(&cp);
+
+    return (hash<<1) + ((hash>>63)&1);
+}
+
+}
+}
+
+#endif
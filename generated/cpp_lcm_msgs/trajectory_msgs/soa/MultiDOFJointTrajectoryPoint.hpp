@@ -0,0 +1,469 @@
+/** THIS IS AN AUTOMATICALLY GENERATED FILE.  DO NOT MODIFY
+ * BY HAND!!
+ *
+ * Generated by lcm-cpp (tools/cpp/gen)
+ **/
+
+#ifndef __trajectory_msgs_soa_MultiDOFJointTrajectoryPoint_hpp__
+#define __trajectory_msgs_soa_MultiDOFJointTrajectoryPoint_hpp__
+
+#include <lcm/lcm_coretypes.h>
+
+#include <array>
+#include <vector>
+#include "dimos_lcm/writer.hpp"
+#include "dimos_lcm/fingerprint.hpp"
+#include "dimos_lcm/reflection.hpp"
+#include "geometry_msgs/TransformColumns.hpp"
+#include "geometry_msgs/TwistColumns.hpp"
+#include "std_msgs/Duration.hpp"
+
+namespace trajectory_msgs
+{
+namespace soa
+{
+
+class MultiDOFJointTrajectoryPoint
+{
+    public:
+        int32_t    transforms_length;
+
+        int32_t    velocities_length;
+
+        int32_t    accelerations_length;
+
+        /**
+         * LCM Type: geometry_msgs.Transform[transforms_length]
+         */
+        geometry_msgs::TransformColumns transforms;
+
+        /**
+         * LCM Type: geometry_msgs.Twist[velocities_length]
+         */
+        geometry_msgs::TwistColumns velocities;
+
+        /**
+         * LCM Type: geometry_msgs.Twist[accelerations_length]
+         */
+        geometry_msgs::TwistColumns accelerations;
+
+        std_msgs::Duration time_from_start;
+
+    public:
+        /**
+         * Encode a message into binary form.
+         *
+         * @param buf The output buffer.
+         * @param offset Encoding starts at thie byte offset into @p buf.
+         * @param maxlen Maximum number of bytes to write.  This should generally be
+         *  equal to getEncodedSize().
+         * @return The number of bytes encoded, or <0 on error.
+         */
+        inline int encode(void *buf, int offset, int maxlen) const;
+
+        /**
+         * Encode a message by appending it to @p buf, walking the message once
+         * instead of sizing it with getEncodedSize() first. @p buf grows
+         * geometrically; reuse it across calls to avoid reallocating.
+         *
+         * @return The number of bytes appended.
+         */
+        inline int encodeTo(std::vector<uint8_t> &buf) const;
+
+        /**
+         * Check how many bytes are required to encode this message.
+         */
+        inline int getEncodedSize() const;
+
+        /**
+         * Decode a message from binary form into this instance.
+         *
+         * @param buf The buffer containing the encoded message.
+         * @param offset The byte offset into @p buf where the encoded message starts.
+         * @param maxlen The maximum number of bytes to read while decoding.
+         * @return The number of bytes decoded, or <0 if an error occured.
+         */
+        inline int decode(const void *buf, int offset, int maxlen);
+
+        /**
+         * Field bits for decodeFields().
+         */
+        struct Fields
+        {
+            static constexpr uint64_t transforms_length = 1ULL << 0;
+            static constexpr uint64_t velocities_length = 1ULL << 1;
+            static constexpr uint64_t accelerations_length = 1ULL << 2;
+            static constexpr uint64_t transforms = 1ULL << 3;
+            static constexpr uint64_t velocities = 1ULL << 4;
+            static constexpr uint64_t accelerations = 1ULL << 5;
+            static constexpr uint64_t time_from_start = 1ULL << 6;
+            static constexpr uint64_t all = (1ULL << 7) - 1;
+        };
+
+        /**
+         * Decode only the fields selected by @p Mask, a bitwise or of Fields
+         * values. Strings, arrays and nested structs that are not selected are
+         * skipped over by their length prefixes without being allocated, and
+         * keep their previous value. Scalar fields are always decoded: they
+         * cost nothing to read and array lengths depend on them.
+         *
+         * @return The number of bytes decoded, or <0 if an error occured.
+         */
+        template <uint64_t Mask>
+        inline int decodeFields(const void *buf, int offset, int maxlen);
+
+        /**
+         * Upper bound on the length of every variable-length array of this
+         * type, checked by decode() before anything is allocated; messages
+         * exceeding it fail to decode. It does not apply to nested types,
+         * which have their own. Set it once at startup, before decoding.
+         * Before C++17 it is a constant with no limit.
+         */
+#if __cplusplus >= 201703L
+        static inline int32_t maxArrayLength = INT32_MAX;
+#else
+        static constexpr int32_t maxArrayLength = INT32_MAX;
+#endif
+
+        /**
+         * Retrieve the 64-bit fingerprint identifying the structure of the message.
+         * Note that the fingerprint is the same for all instances of the same
+         * message type, and is a fingerprint on the message type definition, not on
+         * the message contents.
+         */
+        inline static int64_t getHash();
+
+        /**
+         * The fingerprint returned by getHash(), as a compile-time constant.
+         */
+        static constexpr int64_t kHash = static_cast<int64_t>(0xe51adccf8f4f72d4ULL);
+
+        /**
+         * Returns "MultiDOFJointTrajectoryPoint"
+         */
+        inline static const char* getTypeName();
+
+        /**
+         * Name, LCM type and array dimensions of each field, in wire order.
+         * See dimos_lcm::for_each_field() for visiting the fields themselves.
+         */
+        static constexpr std::array<dimos_lcm::field_info, 7> kFields = {{
+            { "transforms_length", "int32_t", true, 0, 0, NULL },
+            { "velocities_length", "int32_t", true, 0, 0, NULL },
+            { "accelerations_length", "int32_t", true, 0, 0, NULL },
+            { "transforms", "geometry_msgs.Transform", false, 1, -1, "transforms_length" },
+            { "velocities", "geometry_msgs.Twist", false, 1, -1, "velocities_length" },
+            { "accelerations", "geometry_msgs.Twist", false, 1, -1, "accelerations_length" },
+            { "time_from_start", "std_msgs.Duration", false, 0, 0, NULL },
+        }};
+
+        // LCM support functions. Users should not call these
+        inline int _encodeNoHash(void *buf, int offset, int maxlen) const;
+        template <typename Writer>
+        inline void _writeNoHash(Writer &out) const;
+        inline int _getEncodedSizeNoHash() const;
+        inline int _decodeNoHash(const void *buf, int offset, int maxlen);
+        template <uint64_t Mask>
+        inline int _decodeFieldsNoHash(const void *buf, int offset, int maxlen);
+        template <typename Self, typename Visitor>
+        inline static void _forEachField(Self &self, Visitor &visitor);
+        inline static int _skipNoHash(const void *buf, int offset, int maxlen);
+        inline static uint64_t _computeHash(const __lcm_hash_ptr *p);
+};
+
+static_assert(MultiDOFJointTrajectoryPoint::kHash == dimos_lcm::fingerprint(
+    dimos_lcm::signature_hash()
+        .member("transforms_length", "int32_t", 0)
+        .member("velocities_length", "int32_t", 0)
+        .member("accelerations_length", "int32_t", 0)
+        .member("transforms", NULL, 1).dim(true, "transforms_length")
+        .member("velocities", NULL, 1).dim(true, "velocities_length")
+        .member("accelerations", NULL, 1).dim(true, "accelerations_length")
+        .member("time_from_start", NULL, 0)
+        .value(),
+    geometry_msgs::Transform::kHash,
+    geometry_msgs::Twist::kHash,
+    geometry_msgs::Twist::kHash,
+    std_msgs::Duration::kHash),
+    "trajectory_msgs::soa::MultiDOFJointTrajectoryPoint fingerprint does not match its definition");
+
+int MultiDOFJointTrajectoryPoint::encode(void *buf, int offset, int maxlen) const
+{
+    int pos = 0, tlen;
+    int64_t hash = getHash();
+
+    tlen = __int64_t_encode_array(buf, offset + pos, maxlen - pos, &hash, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = this->_encodeNoHash(buf, offset + pos, maxlen - pos);
+    if (tlen < 0) return tlen; else pos += tlen;
+
+    return pos;
+}
+
+int MultiDOFJointTrajectoryPoint::encodeTo(std::vector<uint8_t> &buf) const
+{
+    dimos_lcm::vector_writer out(buf);
+    int64_t hash = getHash();
+    out.put(&hash, 1);
+    this->_writeNoHash(out);
+    return static_cast<int>(out.size());
+}
+
+int MultiDOFJointTrajectoryPoint::decode(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, thislen;
+
+    int64_t msg_hash;
+    thislen = __int64_t_decode_array(buf, offset + pos, maxlen - pos, &msg_hash, 1);
+    if (thislen < 0) return thislen; else pos += thislen;
+    if (msg_hash != getHash()) return -1;
+
+    thislen = this->_decodeNoHash(buf, offset + pos, maxlen - pos);
+    if (thislen < 0) return thislen; else pos += thislen;
+
+    return pos;
+}
+
+template <uint64_t Mask>
+int MultiDOFJointTrajectoryPoint::decodeFields(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, thislen;
+
+    int64_t msg_hash;
+    thislen = __int64_t_decode_array(buf, offset + pos, maxlen - pos, &msg_hash, 1);
+    if (thislen < 0) return thislen; else pos += thislen;
+    if (msg_hash != getHash()) return -1;
+
+    thislen = this->_decodeFieldsNoHash<Mask>(buf, offset + pos, maxlen - pos);
+    if (thislen < 0) return thislen; else pos += thislen;
+
+    return pos;
+}
+
+int MultiDOFJointTrajectoryPoint::getEncodedSize() const
+{
+    return 8 + _getEncodedSizeNoHash();
+}
+
+int64_t MultiDOFJointTrajectoryPoint::getHash()
+{
+    return kHash;
+}
+
+const char* MultiDOFJointTrajectoryPoint::getTypeName()
+{
+    return "MultiDOFJointTrajectoryPoint";
+}
+
+int MultiDOFJointTrajectoryPoint::_encodeNoHash(void *buf, int offset, int maxlen) const
+{
+    int pos = 0, tlen;
+
+    tlen = __int32_t_encode_array(buf, offset + pos, maxlen - pos, &this->transforms_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = __int32_t_encode_array(buf, offset + pos, maxlen - pos, &this->velocities_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = __int32_t_encode_array(buf, offset + pos, maxlen - pos, &this->accelerations_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = this->transforms._encodeNoHash(buf, offset + pos, maxlen - pos, this->transforms_length);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = this->velocities._encodeNoHash(buf, offset + pos, maxlen - pos, this->velocities_length);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = this->accelerations._encodeNoHash(buf, offset + pos, maxlen - pos, this->accelerations_length);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = this->time_from_start._encodeNoHash(buf, offset + pos, maxlen - pos);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    return pos;
+}
+
+template <typename Writer>
+void MultiDOFJointTrajectoryPoint::_writeNoHash(Writer &out) const
+{
+    out.put(&this->transforms_length, 1);
+    out.put(&this->velocities_length, 1);
+    out.put(&this->accelerations_length, 1);
+    this->transforms._writeNoHash(out, this->transforms_length);
+    this->velocities._writeNoHash(out, this->velocities_length);
+    this->accelerations._writeNoHash(out, this->accelerations_length);
+    this->time_from_start._writeNoHash(out);
+}
+
+int MultiDOFJointTrajectoryPoint::_decodeNoHash(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, tlen;
+
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &this->transforms_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &this->velocities_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &this->accelerations_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    if(this->transforms_length < 0 || this->transforms_length > (maxlen - pos) / 56 || this->transforms_length > maxArrayLength) return -1;
+    tlen = this->transforms._decodeNoHash(buf, offset + pos, maxlen - pos, this->transforms_length);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    if(this->velocities_length < 0 || this->velocities_length > (maxlen - pos) / 48 || this->velocities_length > maxArrayLength) return -1;
+    tlen = this->velocities._decodeNoHash(buf, offset + pos, maxlen - pos, this->velocities_length);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    if(this->accelerations_length < 0 || this->accelerations_length > (maxlen - pos) / 48 || this->accelerations_length > maxArrayLength) return -1;
+    tlen = this->accelerations._decodeNoHash(buf, offset + pos, maxlen - pos, this->accelerations_length);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = this->time_from_start._decodeNoHash(buf, offset + pos, maxlen - pos);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    return pos;
+}
+
+template <uint64_t Mask>
+int MultiDOFJointTrajectoryPoint::_decodeFieldsNoHash(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, tlen;
+
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &this->transforms_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &this->velocities_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &this->accelerations_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    if ((Mask & Fields::transforms) != 0) {
+        if(this->transforms_length < 0 || this->transforms_length > (maxlen - pos) / 56 || this->transforms_length > maxArrayLength) return -1;
+        tlen = this->transforms._decodeNoHash(buf, offset + pos, maxlen - pos, this->transforms_length);
+        if(tlen < 0) return tlen; else pos += tlen;
+    } else {
+        if(this->transforms_length < 0) return -1;
+        for (int a0 = 0; a0 < this->transforms_length; a0++) {
+            tlen = geometry_msgs::Transform::_skipNoHash(buf, offset + pos, maxlen - pos);
+            if(tlen < 0) return tlen; else pos += tlen;
+        }
+    }
+
+    if ((Mask & Fields::velocities) != 0) {
+        if(this->velocities_length < 0 || this->velocities_length > (maxlen - pos) / 48 || this->velocities_length > maxArrayLength) return -1;
+        tlen = this->velocities._decodeNoHash(buf, offset + pos, maxlen - pos, this->velocities_length);
+        if(tlen < 0) return tlen; else pos += tlen;
+    } else {
+        if(this->velocities_length < 0) return -1;
+        for (int a0 = 0; a0 < this->velocities_length; a0++) {
+            tlen = geometry_msgs::Twist::_skipNoHash(buf, offset + pos, maxlen - pos);
+            if(tlen < 0) return tlen; else pos += tlen;
+        }
+    }
+
+    if ((Mask & Fields::accelerations) != 0) {
+        if(this->accelerations_length < 0 || this->accelerations_length > (maxlen - pos) / 48 || this->accelerations_length > maxArrayLength) return -1;
+        tlen = this->accelerations._decodeNoHash(buf, offset + pos, maxlen - pos, this->accelerations_length);
+        if(tlen < 0) return tlen; else pos += tlen;
+    } else {
+        if(this->accelerations_length < 0) return -1;
+        for (int a0 = 0; a0 < this->accelerations_length; a0++) {
+            tlen = geometry_msgs::Twist::_skipNoHash(buf, offset + pos, maxlen - pos);
+            if(tlen < 0) return tlen; else pos += tlen;
+        }
+    }
+
+    if ((Mask & Fields::time_from_start) != 0) {
+        tlen = this->time_from_start._decodeNoHash(buf, offset + pos, maxlen - pos);
+        if(tlen < 0) return tlen; else pos += tlen;
+    } else {
+        tlen = std_msgs::Duration::_skipNoHash(buf, offset + pos, maxlen - pos);
+        if(tlen < 0) return tlen; else pos += tlen;
+    }
+
+    return pos;
+}
+
+int MultiDOFJointTrajectoryPoint::_getEncodedSizeNoHash() const
+{
+    int enc_size = 0;
+    enc_size += __int32_t_encoded_array_size(NULL, 1);
+    enc_size += __int32_t_encoded_array_size(NULL, 1);
+    enc_size += __int32_t_encoded_array_size(NULL, 1);
+    enc_size += this->transforms._getEncodedSizeNoHash(this->transforms_length);
+    enc_size += this->velocities._getEncodedSizeNoHash(this->velocities_length);
+    enc_size += this->accelerations._getEncodedSizeNoHash(this->accelerations_length);
+    enc_size += this->time_from_start._getEncodedSizeNoHash();
+    return enc_size;
+}
+
+int MultiDOFJointTrajectoryPoint::_skipNoHash(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, tlen;
+    int32_t transforms_length;
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &transforms_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+    int32_t velocities_length;
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &velocities_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+    int32_t accelerations_length;
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &accelerations_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+    if(transforms_length < 0) return -1;
+    for (int a0 = 0; a0 < transforms_length; a0++) {
+        tlen = geometry_msgs::Transform::_skipNoHash(buf, offset + pos, maxlen - pos);
+        if(tlen < 0) return tlen; else pos += tlen;
+    }
+    if(velocities_length < 0) return -1;
+    for (int a0 = 0; a0 < velocities_length; a0++) {
+        tlen = geometry_msgs::Twist::_skipNoHash(buf, offset + pos, maxlen - pos);
+        if(tlen < 0) return tlen; else pos += tlen;
+    }
+    if(accelerations_length < 0) return -1;
+    for (int a0 = 0; a0 < accelerations_length; a0++) {
+        tlen = geometry_msgs::Twist::_skipNoHash(buf, offset + pos, maxlen - pos);
+        if(tlen < 0) return tlen; else pos += tlen;
+    }
+    tlen = std_msgs::Duration::_skipNoHash(buf, offset + pos, maxlen - pos);
+    if(tlen < 0) return tlen; else pos += tlen;
+    if(pos > maxlen) return -1;
+    return pos;
+}
+
+template <typename Self, typename Visitor>
+void MultiDOFJointTrajectoryPoint::_forEachField(Self &self, Visitor &visitor)
+{
+    visitor(kFields[0], self.transforms_length);
+    visitor(kFields[1], self.velocities_length);
+    visitor(kFields[2], self.accelerations_length);
+    visitor(kFields[3], self.transforms);
+    visitor(kFields[4], self.velocities);
+    visitor(kFields[5], self.accelerations);
+    visitor(kFields[6], self.time_from_start);
+}
+
+uint64_t MultiDOFJointTrajectoryPoint::_computeHash(const __lcm_hash_ptr *p)
+{
+    const __lcm_hash_ptr *fp;
+    for(fp = p; fp != NULL; fp = fp->parent)
+        if(fp->v == MultiDOFJointTrajectoryPoint::getHash)
+            return 0;
+    const __lcm_hash_ptr cp = { p, MultiDOFJointTrajectoryPoint::getHash };
+
+    uint64_t hash = 0x6afb214a921f4cfaLL +
+         geometry_msgs::Transform::_computeHash(&cp) +
+         geometry_msgs::Twist::_computeHash(&cp) +
+         geometry_msgs::Twist::_computeHash(&cp) +
+         std_msgs::Duration::_computeHash(&cp);
+
+    return (hash<<1) + ((hash>>63)&1);
+}
+
+}
+}
+
+#endif
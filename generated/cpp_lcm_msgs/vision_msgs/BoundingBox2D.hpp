@@ -1,7 +1,7 @@
 /** THIS IS AN AUTOMATICALLY GENERATED FILE.  DO NOT MODIFY
  * BY HAND!!
  *
- * Generated by lcm-gen 1.5.2
+ * Generated by lcm-cpp (tools/cpp/gen)
  **/
 
 #ifndef __vision_msgs_BoundingBox2D_hpp__
@@ -9,6 +9,11 @@
 
 #include <lcm/lcm_coretypes.h>
 
+#include <array>
+#include "dimos_lcm/fixed_codec.hpp"
+#include "dimos_lcm/writer.hpp"
+#include "dimos_lcm/fingerprint.hpp"
+#include "dimos_lcm/reflection.hpp"
 #include "vision_msgs/Pose2D.hpp"
 
 namespace vision_msgs
@@ -35,11 +40,26 @@ class BoundingBox2D
          */
         inline int encode(void *buf, int offset, int maxlen) const;
 
+        /**
+         * Encode a message by appending it to @p buf, walking the message once
+         * instead of sizing it with getEncodedSize() first. @p buf grows
+         * geometrically; reuse it across calls to avoid reallocating.
+         *
+         * @return The number of bytes appended.
+         */
+        inline int encodeTo(std::vector<uint8_t> &buf) const;
+
         /**
          * Check how many bytes are required to encode this message.
          */
         inline int getEncodedSize() const;
 
+        /**
+         * getEncodedSize() of every instance: the type has no strings or
+         * variable-length arrays.
+         */
+        static constexpr int kEncodedSize = 48;
+
         /**
          * Decode a message from binary form into this instance.
          *
@@ -58,18 +78,47 @@ class BoundingBox2D
          */
         inline static int64_t getHash();
 
+        /**
+         * The fingerprint returned by getHash(), as a compile-time constant.
+         */
+        static constexpr int64_t kHash = static_cast<int64_t>(0x6282861b3a24521cULL);
+
         /**
          * Returns "BoundingBox2D"
          */
         inline static const char* getTypeName();
 
+        /**
+         * Name, LCM type and array dimensions of each field, in wire order.
+         * See dimos_lcm::for_each_field() for visiting the fields themselves.
+         */
+        static constexpr std::array<dimos_lcm::field_info, 3> kFields = {{
+            { "center", "vision_msgs.Pose2D", false, 0, 0, NULL },
+            { "size_x", "double", true, 0, 0, NULL },
+            { "size_y", "double", true, 0, 0, NULL },
+        }};
+
         // LCM support functions. Users should not call these
         inline int _encodeNoHash(void *buf, int offset, int maxlen) const;
+        template <typename Writer>
+        inline void _writeNoHash(Writer &out) const;
         inline int _getEncodedSizeNoHash() const;
         inline int _decodeNoHash(const void *buf, int offset, int maxlen);
+        template <typename Self, typename Visitor>
+        inline static void _forEachField(Self &self, Visitor &visitor);
+        inline static int _skipNoHash(const void *buf, int offset, int maxlen);
         inline static uint64_t _computeHash(const __lcm_hash_ptr *p);
 };
 
+static_assert(BoundingBox2D::kHash == dimos_lcm::fingerprint(
+    dimos_lcm::signature_hash()
+        .member("center", NULL, 0)
+        .member("size_x", "double", 0)
+        .member("size_y", "double", 0)
+        .value(),
+    vision_msgs::Pose2D::kHash),
+    "vision_msgs::BoundingBox2D fingerprint does not match its definition");
+
 int BoundingBox2D::encode(void *buf, int offset, int maxlen) const
 {
     int pos = 0, tlen;
@@ -84,6 +133,15 @@ int BoundingBox2D::encode(void *buf, int offset, int maxlen) const
     return pos;
 }
 
+int BoundingBox2D::encodeTo(std::vector<uint8_t> &buf) const
+{
+    dimos_lcm::vector_writer out(buf);
+    int64_t hash = getHash();
+    out.put(&hash, 1);
+    this->_writeNoHash(out);
+    return static_cast<int>(out.size());
+}
+
 int BoundingBox2D::decode(const void *buf, int offset, int maxlen)
 {
     int pos = 0, thislen;
@@ -106,8 +164,7 @@ int BoundingBox2D::getEncodedSize() const
 
 int64_t BoundingBox2D::getHash()
 {
-    static int64_t hash = static_cast<int64_t>(_computeHash(NULL));
-    return hash;
+    return kHash;
 }
 
 const char* BoundingBox2D::getTypeName()
@@ -117,43 +174,50 @@ const char* BoundingBox2D::getTypeName()
 
 int BoundingBox2D::_encodeNoHash(void *buf, int offset, int maxlen) const
 {
-    int pos = 0, tlen;
-
-    tlen = this->center._encodeNoHash(buf, offset + pos, maxlen - pos);
-    if(tlen < 0) return tlen; else pos += tlen;
-
-    tlen = __double_encode_array(buf, offset + pos, maxlen - pos, &this->size_x, 1);
-    if(tlen < 0) return tlen; else pos += tlen;
-
-    tlen = __double_encode_array(buf, offset + pos, maxlen - pos, &this->size_y, 1);
-    if(tlen < 0) return tlen; else pos += tlen;
+    if(maxlen < kEncodedSize - 8) return -1;
+    uint8_t *p = static_cast<uint8_t*>(buf) + offset;
+    dimos_lcm::store_be(p + 0, this->center.position.x);
+    dimos_lcm::store_be(p + 8, this->center.position.y);
+    dimos_lcm::store_be(p + 16, this->center.theta);
+    dimos_lcm::store_be(p + 24, this->size_x);
+    dimos_lcm::store_be(p + 32, this->size_y);
+    return kEncodedSize - 8;
+}
 
-    return pos;
+template <typename Writer>
+void BoundingBox2D::_writeNoHash(Writer &out) const
+{
+    out.putStruct(*this);
 }
 
 int BoundingBox2D::_decodeNoHash(const void *buf, int offset, int maxlen)
 {
-    int pos = 0, tlen;
-
-    tlen = this->center._decodeNoHash(buf, offset + pos, maxlen - pos);
-    if(tlen < 0) return tlen; else pos += tlen;
-
-    tlen = __double_decode_array(buf, offset + pos, maxlen - pos, &this->size_x, 1);
-    if(tlen < 0) return tlen; else pos += tlen;
+    if(maxlen < kEncodedSize - 8) return -1;
+    const uint8_t *p = static_cast<const uint8_t*>(buf) + offset;
+    dimos_lcm::load_be(p + 0, this->center.position.x);
+    dimos_lcm::load_be(p + 8, this->center.position.y);
+    dimos_lcm::load_be(p + 16, this->center.theta);
+    dimos_lcm::load_be(p + 24, this->size_x);
+    dimos_lcm::load_be(p + 32, this->size_y);
+    return kEncodedSize - 8;
+}
 
-    tlen = __double_decode_array(buf, offset + pos, maxlen - pos, &this->size_y, 1);
-    if(tlen < 0) return tlen; else pos += tlen;
+int BoundingBox2D::_getEncodedSizeNoHash() const
+{
+    return kEncodedSize - 8;
+}
 
-    return pos;
+int BoundingBox2D::_skipNoHash(const void *, int, int maxlen)
+{
+    return maxlen < kEncodedSize - 8 ? -1 : kEncodedSize - 8;
 }
 
-int BoundingBox2D::_getEncodedSizeNoHash() const
+template <typename Self, typename Visitor>
+void BoundingBox2D::_forEachField(Self &self, Visitor &visitor)
 {
-    int enc_size = 0;
-    enc_size += this->center._getEncodedSizeNoHash();
-    enc_size += __double_encoded_array_size(NULL, 1);
-    enc_size += __double_encoded_array_size(NULL, 1);
-    return enc_size;
+    visitor(kFields[0], self.center);
+    visitor(kFields[1], self.size_x);
+    visitor(kFields[2], self.size_y);
 }
 
 uint64_t BoundingBox2D::_computeHash(const __lcm_hash_ptr *p)
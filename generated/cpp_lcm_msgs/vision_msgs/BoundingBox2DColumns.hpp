@@ -0,0 +1,161 @@
+/** THIS IS AN AUTOMATICALLY GENERATED FILE.  DO NOT MODIFY
+ * BY HAND!!
+ *
+ * Generated by lcm-cpp (tools/cpp/gen)
+ **/
+
+#ifndef __vision_msgs_BoundingBox2DColumns_hpp__
+#define __vision_msgs_BoundingBox2DColumns_hpp__
+
+#include <lcm/lcm_coretypes.h>
+
+#include <vector>
+#include "dimos_lcm/fixed_codec.hpp"
+#include "vision_msgs/BoundingBox2D.hpp"
+
+namespace vision_msgs
+{
+
+/**
+ * Structure-of-arrays storage for a sequence of vision_msgs.BoundingBox2D: one
+ * contiguous array per field, with nested fields flattened and named by their
+ * path (center_position_x, center_position_y, ...). The soa:: message classes hold their
+ * BoundingBox2D arrays this way and decode them straight into the columns.
+ */
+class BoundingBox2DColumns
+{
+    public:
+        // center.position.x
+        std::vector< double > center_position_x;
+
+        // center.position.y
+        std::vector< double > center_position_y;
+
+        // center.theta
+        std::vector< double > center_theta;
+
+        std::vector< double > size_x;
+
+        std::vector< double > size_y;
+
+    public:
+        /**
+         * Number of elements.
+         */
+        inline int size() const;
+
+        /**
+         * Resize every column to @p n elements.
+         */
+        inline void resize(int n);
+
+        /**
+         * Gather element @p i into a BoundingBox2D.
+         */
+        inline vision_msgs::BoundingBox2D get(int i) const;
+
+        /**
+         * Scatter @p msg into element @p i.
+         */
+        inline void set(int i, const vision_msgs::BoundingBox2D &msg);
+
+        // LCM support functions. Users should not call these
+        inline int _encodeNoHash(void *buf, int offset, int maxlen, int n) const;
+        template <typename Writer>
+        inline void _writeNoHash(Writer &out, int n) const;
+        inline int _getEncodedSizeNoHash(int n) const;
+        inline int _decodeNoHash(const void *buf, int offset, int maxlen, int n);
+};
+
+int BoundingBox2DColumns::size() const
+{
+    return static_cast<int>(this->center_position_x.size());
+}
+
+void BoundingBox2DColumns::resize(int n)
+{
+    this->center_position_x.resize(n);
+    this->center_position_y.resize(n);
+    this->center_theta.resize(n);
+    this->size_x.resize(n);
+    this->size_y.resize(n);
+}
+
+vision_msgs::BoundingBox2D BoundingBox2DColumns::get(int i) const
+{
+    vision_msgs::BoundingBox2D msg;
+    msg.center.position.x = this->center_position_x[i];
+    msg.center.position.y = this->center_position_y[i];
+    msg.center.theta = this->center_theta[i];
+    msg.size_x = this->size_x[i];
+    msg.size_y = this->size_y[i];
+    return msg;
+}
+
+void BoundingBox2DColumns::set(int i, const vision_msgs::BoundingBox2D &msg)
+{
+    this->center_position_x[i] = msg.center.position.x;
+    this->center_position_y[i] = msg.center.position.y;
+    this->center_theta[i] = msg.center.theta;
+    this->size_x[i] = msg.size_x;
+    this->size_y[i] = msg.size_y;
+}
+
+int BoundingBox2DColumns::_encodeNoHash(void *buf, int offset, int maxlen, int n) const
+{
+    uint8_t *p = static_cast<uint8_t*>(buf) + offset;
+    int pos = 0;
+    for (int i = 0; i < n; i++) {
+        if(maxlen - pos < 40) return -1;
+        dimos_lcm::store_be(p + pos + 0, this->center_position_x[i]);
+        dimos_lcm::store_be(p + pos + 8, this->center_position_y[i]);
+        dimos_lcm::store_be(p + pos + 16, this->center_theta[i]);
+        dimos_lcm::store_be(p + pos + 24, this->size_x[i]);
+        dimos_lcm::store_be(p + pos + 32, this->size_y[i]);
+        pos += 40;
+    }
+    return pos;
+}
+
+template <typename Writer>
+void BoundingBox2DColumns::_writeNoHash(Writer &out, int n) const
+{
+    if(n <= 0) return;
+    uint8_t *p = out.extend(static_cast<size_t>(n) * 40);
+    for (int i = 0; i < n; i++, p += 40) {
+        dimos_lcm::store_be(p + 0, this->center_position_x[i]);
+        dimos_lcm::store_be(p + 8, this->center_position_y[i]);
+        dimos_lcm::store_be(p + 16, this->center_theta[i]);
+        dimos_lcm::store_be(p + 24, this->size_x[i]);
+        dimos_lcm::store_be(p + 32, this->size_y[i]);
+    }
+}
+
+int BoundingBox2DColumns::_getEncodedSizeNoHash(int n) const
+{
+    return n * 40;
+}
+
+int BoundingBox2DColumns::_decodeNoHash(const void *buf, int offset, int maxlen, int n)
+{
+    if(n < 0 || n > maxlen / 40) return -1;
+    this->resize(n);
+    const uint8_t *p = static_cast<const uint8_t*>(buf) + offset;
+    double *center_position_x = this->center_position_x.data();
+    double *center_position_y = this->center_position_y.data();
+    double *center_theta = this->center_theta.data();
+    double *size_x = this->size_x.data();
+    double *size_y = this->size_y.data();
+    for (int i = 0; i < n; i++, p += 40) {
+        dimos_lcm::load_be(p + 0, center_position_x[i]);
+        dimos_lcm::load_be(p + 8, center_position_y[i]);
+        dimos_lcm::load_be(p + 16, center_theta[i]);
+        dimos_lcm::load_be(p + 24, size_x[i]);
+        dimos_lcm::load_be(p + 32, size_y[i]);
+    }
+    return n * 40;
+}
+
+}
+
+#endif
@@ -0,0 +1,213 @@
+/** THIS IS AN AUTOMATICALLY GENERATED FILE.  DO NOT MODIFY
+ * BY HAND!!
+ *
+ * Generated by lcm-cpp (tools/cpp/gen)
+ **/
+
+#ifndef __vision_msgs_BoundingBox3DColumns_hpp__
+#define __vision_msgs_BoundingBox3DColumns_hpp__
+
+#include <lcm/lcm_coretypes.h>
+
+#include <vector>
+#include "dimos_lcm/fixed_codec.hpp"
+#include "vision_msgs/BoundingBox3D.hpp"
+
+namespace vision_msgs
+{
+
+/**
+ * Structure-of-arrays storage for a sequence of vision_msgs.BoundingBox3D: one
+ * contiguous array per field, with nested fields flattened and named by their
+ * path (center_position_x, center_position_y, ...). The soa:: message classes hold their
+ * BoundingBox3D arrays this way and decode them straight into the columns.
+ */
+class BoundingBox3DColumns
+{
+    public:
+        // center.position.x
+        std::vector< double > center_position_x;
+
+        // center.position.y
+        std::vector< double > center_position_y;
+
+        // center.position.z
+        std::vector< double > center_position_z;
+
+        // center.orientation.x
+        std::vector< double > center_orientation_x;
+
+        // center.orientation.y
+        std::vector< double > center_orientation_y;
+
+        // center.orientation.z
+        std::vector< double > center_orientation_z;
+
+        // center.orientation.w
+        std::vector< double > center_orientation_w;
+
+        // size.x
+        std::vector< double > size_x;
+
+        // size.y
+        std::vector< double > size_y;
+
+        // size.z
+        std::vector< double > size_z;
+
+    public:
+        /**
+         * Number of elements.
+         */
+        inline int size() const;
+
+        /**
+         * Resize every column to @p n elements.
+         */
+        inline void resize(int n);
+
+        /**
+         * Gather element @p i into a BoundingBox3D.
+         */
+        inline vision_msgs::BoundingBox3D get(int i) const;
+
+        /**
+         * Scatter @p msg into element @p i.
+         */
+        inline void set(int i, const vision_msgs::BoundingBox3D &msg);
+
+        // LCM support functions. Users should not call these
+        inline int _encodeNoHash(void *buf, int offset, int maxlen, int n) const;
+        template <typename Writer>
+        inline void _writeNoHash(Writer &out, int n) const;
+        inline int _getEncodedSizeNoHash(int n) const;
+        inline int _decodeNoHash(const void *buf, int offset, int maxlen, int n);
+};
+
+int BoundingBox3DColumns::size() const
+{
+    return static_cast<int>(this->center_position_x.size());
+}
+
+void BoundingBox3DColumns::resize(int n)
+{
+    this->center_position_x.resize(n);
+    this->center_position_y.resize(n);
+    this->center_position_z.resize(n);
+    this->center_orientation_x.resize(n);
+    this->center_orientation_y.resize(n);
+    this->center_orientation_z.resize(n);
+    this->center_orientation_w.resize(n);
+    this->size_x.resize(n);
+    this->size_y.resize(n);
+    this->size_z.resize(n);
+}
+
+vision_msgs::BoundingBox3D BoundingBox3DColumns::get(int i) const
+{
+    vision_msgs::BoundingBox3D msg;
+    msg.center.position.x = this->center_position_x[i];
+    msg.center.position.y = this->center_position_y[i];
+    msg.center.position.z = this->center_position_z[i];
+    msg.center.orientation.x = this->center_orientation_x[i];
+    msg.center.orientation.y = this->center_orientation_y[i];
+    msg.center.orientation.z = this->center_orientation_z[i];
+    msg.center.orientation.w = this->center_orientation_w[i];
+    msg.size.x = this->size_x[i];
+    msg.size.y = this->size_y[i];
+    msg.size.z = this->size_z[i];
+    return msg;
+}
+
+void BoundingBox3DColumns::set(int i, const vision_msgs::BoundingBox3D &msg)
+{
+    this->center_position_x[i] = msg.center.position.x;
+    this->center_position_y[i] = msg.center.position.y;
+    this->center_position_z[i] = msg.center.position.z;
+    this->center_orientation_x[i] = msg.center.orientation.x;
+    this->center_orientation_y[i] = msg.center.orientation.y;
+    this->center_orientation_z[i] = msg.center.orientation.z;
+    this->center_orientation_w[i] = msg.center.orientation.w;
+    this->size_x[i] = msg.size.x;
+    this->size_y[i] = msg.size.y;
+    this->size_z[i] = msg.size.z;
+}
+
+int BoundingBox3DColumns::_encodeNoHash(void *buf, int offset, int maxlen, int n) const
+{
+    uint8_t *p = static_cast<uint8_t*>(buf) + offset;
+    int pos = 0;
+    for (int i = 0; i < n; i++) {
+        if(maxlen - pos < 80) return -1;
+        dimos_lcm::store_be(p + pos + 0, this->center_position_x[i]);
+        dimos_lcm::store_be(p + pos + 8, this->center_position_y[i]);
+        dimos_lcm::store_be(p + pos + 16, this->center_position_z[i]);
+        dimos_lcm::store_be(p + pos + 24, this->center_orientation_x[i]);
+        dimos_lcm::store_be(p + pos + 32, this->center_orientation_y[i]);
+        dimos_lcm::store_be(p + pos + 40, this->center_orientation_z[i]);
+        dimos_lcm::store_be(p + pos + 48, this->center_orientation_w[i]);
+        dimos_lcm::store_be(p + pos + 56, this->size_x[i]);
+        dimos_lcm::store_be(p + pos + 64, this->size_y[i]);
+        dimos_lcm::store_be(p + pos + 72, this->size_z[i]);
+        pos += 80;
+    }
+    return pos;
+}
+
+template <typename Writer>
+void BoundingBox3DColumns::_writeNoHash(Writer &out, int n) const
+{
+    if(n <= 0) return;
+    uint8_t *p = out.extend(static_cast<size_t>(n) * 80);
+    for (int i = 0; i < n; i++, p += 80) {
+        dimos_lcm::store_be(p + 0, this->center_position_x[i]);
+        dimos_lcm::store_be(p + 8, this->center_position_y[i]);
+        dimos_lcm::store_be(p + 16, this->center_position_z[i]);
+        dimos_lcm::store_be(p + 24, this->center_orientation_x[i]);
+        dimos_lcm::store_be(p + 32, this->center_orientation_y[i]);
+        dimos_lcm::store_be(p + 40, this->center_orientation_z[i]);
+        dimos_lcm::store_be(p + 48, this->center_orientation_w[i]);
+        dimos_lcm::store_be(p + 56, this->size_x[i]);
+        dimos_lcm::store_be(p + 64, this->size_y[i]);
+        dimos_lcm::store_be(p + 72, this->size_z[i]);
+    }
+}
+
+int BoundingBox3DColumns::_getEncodedSizeNoHash(int n) const
+{
+    return n * 80;
+}
+
+int BoundingBox3DColumns::_decodeNoHash(const void *buf, int offset, int maxlen, int n)
+{
+    if(n < 0 || n > maxlen / 80) return -1;
+    this->resize(n);
+    const uint8_t *p = static_cast<const uint8_t*>(buf) + offset;
+    double *center_position_x = this->center_position_x.data();
+    double *center_position_y = this->center_position_y.data();
+    double *center_position_z = this->center_position_z.data();
+    double *center_orientation_x = this->center_orientation_x.data();
+    double *center_orientation_y = this->center_orientation_y.data();
+    double *center_orientation_z = this->center_orientation_z.data();
+    double *center_orientation_w = this->center_orientation_w.data();
+    double *size_x = this->size_x.data();
+    double *size_y = this->size_y.data();
+    double *size_z = this->size_z.data();
+    for (int i = 0; i < n; i++, p += 80) {
+        dimos_lcm::load_be(p + 0, center_position_x[i]);
+        dimos_lcm::load_be(p + 8, center_position_y[i]);
+        dimos_lcm::load_be(p + 16, center_position_z[i]);
+        dimos_lcm::load_be(p + 24, center_orientation_x[i]);
+        dimos_lcm::load_be(p + 32, center_orientation_y[i]);
+        dimos_lcm::load_be(p + 40, center_orientation_z[i]);
+        dimos_lcm::load_be(p + 48, center_orientation_w[i]);
+        dimos_lcm::load_be(p + 56, size_x[i]);
+        dimos_lcm::load_be(p + 64, size_y[i]);
+        dimos_lcm::load_be(p + 72, size_z[i]);
+    }
+    return n * 80;
+}
+
+}
+
+#endif
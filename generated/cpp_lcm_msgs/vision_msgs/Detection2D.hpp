@@ -1,7 +1,7 @@
 /** THIS IS AN AUTOMATICALLY GENERATED FILE.  DO NOT MODIFY
  * BY HAND!!
  *
- * Generated by lcm-gen 1.5.2
+ * Generated by lcm-cpp (tools/cpp/gen)
  **/
 
 #ifndef __vision_msgs_Detection2D_hpp__
@@ -9,11 +9,18 @@
 
 #include <lcm/lcm_coretypes.h>
 
+#include <array>
 #include <vector>
 #include <string>
+#include "dimos_lcm/writer.hpp"
+#include "dimos_lcm/fingerprint.hpp"
+#include "dimos_lcm/reflection.hpp"
 #include "std_msgs/Header.hpp"
 #include "vision_msgs/ObjectHypothesisWithPose.hpp"
 #include "vision_msgs/BoundingBox2D.hpp"
+#if __cplusplus >= 201703L
+#include "std_msgs/HeaderView.hpp"
+#endif
 
 namespace vision_msgs
 {
@@ -46,6 +53,15 @@ class Detection2D
          */
         inline int encode(void *buf, int offset, int maxlen) const;
 
+        /**
+         * Encode a message by appending it to @p buf, walking the message once
+         * instead of sizing it with getEncodedSize() first. @p buf grows
+         * geometrically; reuse it across calls to avoid reallocating.
+         *
+         * @return The number of bytes appended.
+         */
+        inline int encodeTo(std::vector<uint8_t> &buf) const;
+
         /**
          * Check how many bytes are required to encode this message.
          */
@@ -61,6 +77,62 @@ class Detection2D
          */
         inline int decode(const void *buf, int offset, int maxlen);
 
+#if __cplusplus >= 201703L
+        /**
+         * Decode only the header field of an encoded message, leaving the
+         * rest of it untouched. The field sits at a fixed offset, so this costs
+         * the same for any payload size. The view points into @p buf.
+         *
+         * @param buf The buffer containing the encoded message.
+         * @param offset The byte offset into @p buf where the encoded message starts.
+         * @param maxlen The maximum number of bytes to read while decoding.
+         * @param header Receives the decoded header.
+         * @return The number of bytes of the field decoded, or <0 if @p buf does
+         *  not hold a Detection2D or is truncated.
+         *
+         * Needs C++17, for the std::string_view of the view.
+         */
+        inline static int peekHeader(const void *buf, int offset, int maxlen, std_msgs::HeaderView &header);
+#endif
+
+        /**
+         * Field bits for decodeFields().
+         */
+        struct Fields
+        {
+            static constexpr uint64_t results_length = 1ULL << 0;
+            static constexpr uint64_t header = 1ULL << 1;
+            static constexpr uint64_t results = 1ULL << 2;
+            static constexpr uint64_t bbox = 1ULL << 3;
+            static constexpr uint64_t id = 1ULL << 4;
+            static constexpr uint64_t all = (1ULL << 5) - 1;
+        };
+
+        /**
+         * Decode only the fields selected by @p Mask, a bitwise or of Fields
+         * values. Strings, arrays and nested structs that are not selected are
+         * skipped over by their length prefixes without being allocated, and
+         * keep their previous value. Scalar fields are always decoded: they
+         * cost nothing to read and array lengths depend on them.
+         *
+         * @return The number of bytes decoded, or <0 if an error occured.
+         */
+        template <uint64_t Mask>
+        inline int decodeFields(const void *buf, int offset, int maxlen);
+
+        /**
+         * Upper bound on the length of every variable-length array of this
+         * type, checked by decode() before anything is allocated; messages
+         * exceeding it fail to decode. It does not apply to nested types,
+         * which have their own. Set it once at startup, before decoding.
+         * Before C++17 it is a constant with no limit.
+         */
+#if __cplusplus >= 201703L
+        static inline int32_t maxArrayLength = INT32_MAX;
+#else
+        static constexpr int32_t maxArrayLength = INT32_MAX;
+#endif
+
         /**
          * Retrieve the 64-bit fingerprint identifying the structure of the message.
          * Note that the fingerprint is the same for all instances of the same
@@ -69,18 +141,55 @@ class Detection2D
          */
         inline static int64_t getHash();
 
+        /**
+         * The fingerprint returned by getHash(), as a compile-time constant.
+         */
+        static constexpr int64_t kHash = static_cast<int64_t>(0xb4e48d74d9bf4510ULL);
+
         /**
          * Returns "Detection2D"
          */
         inline static const char* getTypeName();
 
+        /**
+         * Name, LCM type and array dimensions of each field, in wire order.
+         * See dimos_lcm::for_each_field() for visiting the fields themselves.
+         */
+        static constexpr std::array<dimos_lcm::field_info, 5> kFields = {{
+            { "results_length", "int32_t", true, 0, 0, NULL },
+            { "header", "std_msgs.Header", false, 0, 0, NULL },
+            { "results", "vision_msgs.ObjectHypothesisWithPose", false, 1, -1, "results_length" },
+            { "bbox", "vision_msgs.BoundingBox2D", false, 0, 0, NULL },
+            { "id", "string", true, 0, 0, NULL },
+        }};
+
         // LCM support functions. Users should not call these
         inline int _encodeNoHash(void *buf, int offset, int maxlen) const;
+        template <typename Writer>
+        inline void _writeNoHash(Writer &out) const;
         inline int _getEncodedSizeNoHash() const;
         inline int _decodeNoHash(const void *buf, int offset, int maxlen);
+        template <uint64_t Mask>
+        inline int _decodeFieldsNoHash(const void *buf, int offset, int maxlen);
+        template <typename Self, typename Visitor>
+        inline static void _forEachField(Self &self, Visitor &visitor);
+        inline static int _skipNoHash(const void *buf, int offset, int maxlen);
         inline static uint64_t _computeHash(const __lcm_hash_ptr *p);
 };
 
+static_assert(Detection2D::kHash == dimos_lcm::fingerprint(
+    dimos_lcm::signature_hash()
+        .member("results_length", "int32_t", 0)
+        .member("header", NULL, 0)
+        .member("results", NULL, 1).dim(true, "results_length")
+        .member("bbox", NULL, 0)
+        .member("id", "string", 0)
+        .value(),
+    std_msgs::Header::kHash,
+    vision_msgs::ObjectHypothesisWithPose::kHash,
+    vision_msgs::BoundingBox2D::kHash),
+    "vision_msgs::Detection2D fingerprint does not match its definition");
+
 int Detection2D::encode(void *buf, int offset, int maxlen) const
 {
     int pos = 0, tlen;
@@ -95,6 +204,15 @@ int Detection2D::encode(void *buf, int offset, int maxlen) const
     return pos;
 }
 
+int Detection2D::encodeTo(std::vector<uint8_t> &buf) const
+{
+    dimos_lcm::vector_writer out(buf);
+    int64_t hash = getHash();
+    out.put(&hash, 1);
+    this->_writeNoHash(out);
+    return static_cast<int>(out.size());
+}
+
 int Detection2D::decode(const void *buf, int offset, int maxlen)
 {
     int pos = 0, thislen;
@@ -110,6 +228,34 @@ int Detection2D::decode(const void *buf, int offset, int maxlen)
     return pos;
 }
 
+#if __cplusplus >= 201703L
+int Detection2D::peekHeader(const void *buf, int offset, int maxlen, std_msgs::HeaderView &header)
+{
+    int64_t msg_hash;
+    if (__int64_t_decode_array(buf, offset, maxlen, &msg_hash, 1) < 0) return -1;
+    if (msg_hash != kHash) return -1;
+
+    // header follows the hash and 4 bytes of fixed-size fields
+    return header._decodeNoHash(buf, offset + 12, maxlen - 12);
+}
+#endif
+
+template <uint64_t Mask>
+int Detection2D::decodeFields(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, thislen;
+
+    int64_t msg_hash;
+    thislen = __int64_t_decode_array(buf, offset + pos, maxlen - pos, &msg_hash, 1);
+    if (thislen < 0) return thislen; else pos += thislen;
+    if (msg_hash != getHash()) return -1;
+
+    thislen = this->_decodeFieldsNoHash<Mask>(buf, offset + pos, maxlen - pos);
+    if (thislen < 0) return thislen; else pos += thislen;
+
+    return pos;
+}
+
 int Detection2D::getEncodedSize() const
 {
     return 8 + _getEncodedSizeNoHash();
@@ -117,8 +263,7 @@ int Detection2D::getEncodedSize() const
 
 int64_t Detection2D::getHash()
 {
-    static int64_t hash = static_cast<int64_t>(_computeHash(NULL));
-    return hash;
+    return kHash;
 }
 
 const char* Detection2D::getTypeName()
@@ -152,6 +297,17 @@ int Detection2D::_encodeNoHash(void *buf, int offset, int maxlen) const
     return pos;
 }
 
+template <typename Writer>
+void Detection2D::_writeNoHash(Writer &out) const
+{
+    out.put(&this->results_length, 1);
+    this->header._writeNoHash(out);
+    for (int a0 = 0; a0 < this->results_length; a0++)
+        this->results[a0]._writeNoHash(out);
+    this->bbox._writeNoHash(out);
+    out.put(this->id);
+}
+
 int Detection2D::_decodeNoHash(const void *buf, int offset, int maxlen)
 {
     int pos = 0, tlen;
@@ -162,6 +318,7 @@ int Detection2D::_decodeNoHash(const void *buf, int offset, int maxlen)
     tlen = this->header._decodeNoHash(buf, offset + pos, maxlen - pos);
     if(tlen < 0) return tlen; else pos += tlen;
 
+    if(this->results_length < 0 || this->results_length > (maxlen - pos) / 357 || this->results_length > maxArrayLength) return -1;
     try {
         this->results.resize(this->results_length);
     } catch (...) {
@@ -179,7 +336,7 @@ int Detection2D::_decodeNoHash(const void *buf, int offset, int maxlen)
     tlen = __int32_t_decode_array(
         buf, offset + pos, maxlen - pos, &__id_len__, 1);
     if(tlen < 0) return tlen; else pos += tlen;
-    if(__id_len__ > maxlen - pos) return -1;
+    if(__id_len__ < 1 || __id_len__ > maxlen - pos) return -1;
     this->id.assign(
         static_cast<const char*>(buf) + offset + pos, __id_len__ - 1);
     pos += __id_len__;
@@ -187,6 +344,69 @@ int Detection2D::_decodeNoHash(const void *buf, int offset, int maxlen)
     return pos;
 }
 
+template <uint64_t Mask>
+int Detection2D::_decodeFieldsNoHash(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, tlen;
+
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &this->results_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    if ((Mask & Fields::header) != 0) {
+        tlen = this->header._decodeNoHash(buf, offset + pos, maxlen - pos);
+        if(tlen < 0) return tlen; else pos += tlen;
+    } else {
+        tlen = std_msgs::Header::_skipNoHash(buf, offset + pos, maxlen - pos);
+        if(tlen < 0) return tlen; else pos += tlen;
+    }
+
+    if ((Mask & Fields::results) != 0) {
+        if(this->results_length < 0 || this->results_length > (maxlen - pos) / 357 || this->results_length > maxArrayLength) return -1;
+        try {
+            this->results.resize(this->results_length);
+        } catch (...) {
+            return -1;
+        }
+        for (int a0 = 0; a0 < this->results_length; a0++) {
+            tlen = this->results[a0]._decodeNoHash(buf, offset + pos, maxlen - pos);
+            if(tlen < 0) return tlen; else pos += tlen;
+        }
+    } else {
+        if(this->results_length < 0) return -1;
+        for (int a0 = 0; a0 < this->results_length; a0++) {
+            tlen = vision_msgs::ObjectHypothesisWithPose::_skipNoHash(buf, offset + pos, maxlen - pos);
+            if(tlen < 0) return tlen; else pos += tlen;
+        }
+    }
+
+    if ((Mask & Fields::bbox) != 0) {
+        tlen = this->bbox._decodeNoHash(buf, offset + pos, maxlen - pos);
+        if(tlen < 0) return tlen; else pos += tlen;
+    } else {
+        tlen = vision_msgs::BoundingBox2D::_skipNoHash(buf, offset + pos, maxlen - pos);
+        if(tlen < 0) return tlen; else pos += tlen;
+    }
+
+    if ((Mask & Fields::id) != 0) {
+        int32_t __id_len__;
+        tlen = __int32_t_decode_array(
+            buf, offset + pos, maxlen - pos, &__id_len__, 1);
+        if(tlen < 0) return tlen; else pos += tlen;
+        if(__id_len__ < 1 || __id_len__ > maxlen - pos) return -1;
+        this->id.assign(
+            static_cast<const char*>(buf) + offset + pos, __id_len__ - 1);
+        pos += __id_len__;
+    } else {
+        int32_t __id_len__;
+        tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &__id_len__, 1);
+        if(tlen < 0) return tlen; else pos += tlen;
+        if(__id_len__ < 0 || __id_len__ > maxlen - pos) return -1;
+        pos += __id_len__;
+    }
+
+    return pos;
+}
+
 int Detection2D::_getEncodedSizeNoHash() const
 {
     int enc_size = 0;
@@ -200,6 +420,40 @@ int Detection2D::_getEncodedSizeNoHash() const
     return enc_size;
 }
 
+int Detection2D::_skipNoHash(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, tlen;
+    int32_t results_length;
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &results_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+    tlen = std_msgs::Header::_skipNoHash(buf, offset + pos, maxlen - pos);
+    if(tlen < 0) return tlen; else pos += tlen;
+    if(results_length < 0) return -1;
+    for (int a0 = 0; a0 < results_length; a0++) {
+        tlen = vision_msgs::ObjectHypothesisWithPose::_skipNoHash(buf, offset + pos, maxlen - pos);
+        if(tlen < 0) return tlen; else pos += tlen;
+    }
+    tlen = vision_msgs::BoundingBox2D::_skipNoHash(buf, offset + pos, maxlen - pos);
+    if(tlen < 0) return tlen; else pos += tlen;
+    int32_t __id_len__;
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &__id_len__, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+    if(__id_len__ < 0 || __id_len__ > maxlen - pos) return -1;
+    pos += __id_len__;
+    if(pos > maxlen) return -1;
+    return pos;
+}
+
+template <typename Self, typename Visitor>
+void Detection2D::_forEachField(Self &self, Visitor &visitor)
+{
+    visitor(kFields[0], self.results_length);
+    visitor(kFields[1], self.header);
+    visitor(kFields[2], self.results);
+    visitor(kFields[3], self.bbox);
+    visitor(kFields[4], self.id);
+}
+
 uint64_t Detection2D::_computeHash(const __lcm_hash_ptr *p)
 {
     const __lcm_hash_ptr *fp;
@@ -1,7 +1,7 @@
 /** THIS IS AN AUTOMATICALLY GENERATED FILE.  DO NOT MODIFY
  * BY HAND!!
  *
- * Generated by lcm-gen 1.5.2
+ * Generated by lcm-cpp (tools/cpp/gen)
  **/
 
 #ifndef __vision_msgs_ObjectHypothesis_hpp__
@@ -9,7 +9,11 @@
 
 #include <lcm/lcm_coretypes.h>
 
+#include <array>
 #include <string>
+#include "dimos_lcm/writer.hpp"
+#include "dimos_lcm/fingerprint.hpp"
+#include "dimos_lcm/reflection.hpp"
 
 namespace vision_msgs
 {
@@ -33,6 +37,15 @@ class ObjectHypothesis
          */
         inline int encode(void *buf, int offset, int maxlen) const;
 
+        /**
+         * Encode a message by appending it to @p buf, walking the message once
+         * instead of sizing it with getEncodedSize() first. @p buf grows
+         * geometrically; reuse it across calls to avoid reallocating.
+         *
+         * @return The number of bytes appended.
+         */
+        inline int encodeTo(std::vector<uint8_t> &buf) const;
+
         /**
          * Check how many bytes are required to encode this message.
          */
@@ -48,6 +61,28 @@ class ObjectHypothesis
          */
         inline int decode(const void *buf, int offset, int maxlen);
 
+        /**
+         * Field bits for decodeFields().
+         */
+        struct Fields
+        {
+            static constexpr uint64_t class_id = 1ULL << 0;
+            static constexpr uint64_t score = 1ULL << 1;
+            static constexpr uint64_t all = (1ULL << 2) - 1;
+        };
+
+        /**
+         * Decode only the fields selected by @p Mask, a bitwise or of Fields
+         * values. Strings, arrays and nested structs that are not selected are
+         * skipped over by their length prefixes without being allocated, and
+         * keep their previous value. Scalar fields are always decoded: they
+         * cost nothing to read and array lengths depend on them.
+         *
+         * @return The number of bytes decoded, or <0 if an error occured.
+         */
+        template <uint64_t Mask>
+        inline int decodeFields(const void *buf, int offset, int maxlen);
+
         /**
          * Retrieve the 64-bit fingerprint identifying the structure of the message.
          * Note that the fingerprint is the same for all instances of the same
@@ -56,18 +91,46 @@ class ObjectHypothesis
          */
         inline static int64_t getHash();
 
+        /**
+         * The fingerprint returned by getHash(), as a compile-time constant.
+         */
+        static constexpr int64_t kHash = static_cast<int64_t>(0x719359aa86271644ULL);
+
         /**
          * Returns "ObjectHypothesis"
          */
         inline static const char* getTypeName();
 
+        /**
+         * Name, LCM type and array dimensions of each field, in wire order.
+         * See dimos_lcm::for_each_field() for visiting the fields themselves.
+         */
+        static constexpr std::array<dimos_lcm::field_info, 2> kFields = {{
+            { "class_id", "string", true, 0, 0, NULL },
+            { "score", "double", true, 0, 0, NULL },
+        }};
+
         // LCM support functions. Users should not call these
         inline int _encodeNoHash(void *buf, int offset, int maxlen) const;
+        template <typename Writer>
+        inline void _writeNoHash(Writer &out) const;
         inline int _getEncodedSizeNoHash() const;
         inline int _decodeNoHash(const void *buf, int offset, int maxlen);
+        template <uint64_t Mask>
+        inline int _decodeFieldsNoHash(const void *buf, int offset, int maxlen);
+        template <typename Self, typename Visitor>
+        inline static void _forEachField(Self &self, Visitor &visitor);
+        inline static int _skipNoHash(const void *buf, int offset, int maxlen);
         inline static uint64_t _computeHash(const __lcm_hash_ptr *p);
 };
 
+static_assert(ObjectHypothesis::kHash == dimos_lcm::fingerprint(
+    dimos_lcm::signature_hash()
+        .member("class_id", "string", 0)
+        .member("score", "double", 0)
+        .value()),
+    "vision_msgs::ObjectHypothesis fingerprint does not match its definition");
+
 int ObjectHypothesis::encode(void *buf, int offset, int maxlen) const
 {
     int pos = 0, tlen;
@@ -82,6 +145,15 @@ int ObjectHypothesis::encode(void *buf, int offset, int maxlen) const
     return pos;
 }
 
+int ObjectHypothesis::encodeTo(std::vector<uint8_t> &buf) const
+{
+    dimos_lcm::vector_writer out(buf);
+    int64_t hash = getHash();
+    out.put(&hash, 1);
+    this->_writeNoHash(out);
+    return static_cast<int>(out.size());
+}
+
 int ObjectHypothesis::decode(const void *buf, int offset, int maxlen)
 {
     int pos = 0, thislen;
@@ -97,6 +169,22 @@ int ObjectHypothesis::decode(const void *buf, int offset, int maxlen)
     return pos;
 }
 
+template <uint64_t Mask>
+int ObjectHypothesis::decodeFields(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, thislen;
+
+    int64_t msg_hash;
+    thislen = __int64_t_decode_array(buf, offset + pos, maxlen - pos, &msg_hash, 1);
+    if (thislen < 0) return thislen; else pos += thislen;
+    if (msg_hash != getHash()) return -1;
+
+    thislen = this->_decodeFieldsNoHash<Mask>(buf, offset + pos, maxlen - pos);
+    if (thislen < 0) return thislen; else pos += thislen;
+
+    return pos;
+}
+
 int ObjectHypothesis::getEncodedSize() const
 {
     return 8 + _getEncodedSizeNoHash();
@@ -104,8 +192,7 @@ int ObjectHypothesis::getEncodedSize() const
 
 int64_t ObjectHypothesis::getHash()
 {
-    static int64_t hash = static_cast<int64_t>(_computeHash(NULL));
-    return hash;
+    return kHash;
 }
 
 const char* ObjectHypothesis::getTypeName()
@@ -128,6 +215,13 @@ int ObjectHypothesis::_encodeNoHash(void *buf, int offset, int maxlen) const
     return pos;
 }
 
+template <typename Writer>
+void ObjectHypothesis::_writeNoHash(Writer &out) const
+{
+    out.put(this->class_id);
+    out.put(&this->score, 1);
+}
+
 int ObjectHypothesis::_decodeNoHash(const void *buf, int offset, int maxlen)
 {
     int pos = 0, tlen;
@@ -136,7 +230,7 @@ int ObjectHypothesis::_decodeNoHash(const void *buf, int offset, int maxlen)
     tlen = __int32_t_decode_array(
         buf, offset + pos, maxlen - pos, &__class_id_len__, 1);
     if(tlen < 0) return tlen; else pos += tlen;
-    if(__class_id_len__ > maxlen - pos) return -1;
+    if(__class_id_len__ < 1 || __class_id_len__ > maxlen - pos) return -1;
     this->class_id.assign(
         static_cast<const char*>(buf) + offset + pos, __class_id_len__ - 1);
     pos += __class_id_len__;
@@ -147,6 +241,34 @@ int ObjectHypothesis::_decodeNoHash(const void *buf, int offset, int maxlen)
     return pos;
 }
 
+template <uint64_t Mask>
+int ObjectHypothesis::_decodeFieldsNoHash(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, tlen;
+
+    if ((Mask & Fields::class_id) != 0) {
+        int32_t __class_id_len__;
+        tlen = __int32_t_decode_array(
+            buf, offset + pos, maxlen - pos, &__class_id_len__, 1);
+        if(tlen < 0) return tlen; else pos += tlen;
+        if(__class_id_len__ < 1 || __class_id_len__ > maxlen - pos) return -1;
+        this->class_id.assign(
+            static_cast<const char*>(buf) + offset + pos, __class_id_len__ - 1);
+        pos += __class_id_len__;
+    } else {
+        int32_t __class_id_len__;
+        tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &__class_id_len__, 1);
+        if(tlen < 0) return tlen; else pos += tlen;
+        if(__class_id_len__ < 0 || __class_id_len__ > maxlen - pos) return -1;
+        pos += __class_id_len__;
+    }
+
+    tlen = __double_decode_array(buf, offset + pos, maxlen - pos, &this->score, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    return pos;
+}
+
 int ObjectHypothesis::_getEncodedSizeNoHash() const
 {
     int enc_size = 0;
@@ -155,6 +277,26 @@ int ObjectHypothesis::_getEncodedSizeNoHash() const
     return enc_size;
 }
 
+int ObjectHypothesis::_skipNoHash(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, tlen;
+    int32_t __class_id_len__;
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &__class_id_len__, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+    if(__class_id_len__ < 0 || __class_id_len__ > maxlen - pos) return -1;
+    pos += __class_id_len__;
+    pos += 8;
+    if(pos > maxlen) return -1;
+    return pos;
+}
+
+template <typename Self, typename Visitor>
+void ObjectHypothesis::_forEachField(Self &self, Visitor &visitor)
+{
+    visitor(kFields[0], self.class_id);
+    visitor(kFields[1], self.score);
+}
+
 uint64_t ObjectHypothesis::_computeHash(const __lcm_hash_ptr *)
 {
     uint64_t hash = 0x38c9acd543138b22LL;
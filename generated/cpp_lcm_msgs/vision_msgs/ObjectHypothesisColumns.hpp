@@ -0,0 +1,147 @@
+/** THIS IS AN AUTOMATICALLY GENERATED FILE.  DO NOT MODIFY
+ * BY HAND!!
+ *
+ * Generated by lcm-cpp (tools/cpp/gen)
+ **/
+
+#ifndef __vision_msgs_ObjectHypothesisColumns_hpp__
+#define __vision_msgs_ObjectHypothesisColumns_hpp__
+
+#include <lcm/lcm_coretypes.h>
+
+#include <string>
+#include <vector>
+#include "dimos_lcm/fixed_codec.hpp"
+#include "vision_msgs/ObjectHypothesis.hpp"
+
+namespace vision_msgs
+{
+
+/**
+ * Structure-of-arrays storage for a sequence of vision_msgs.ObjectHypothesis: one
+ * contiguous array per field, with nested fields flattened and named by their
+ * path (class_id, score, ...). The soa:: message classes hold their
+ * ObjectHypothesis arrays this way and decode them straight into the columns.
+ */
+class ObjectHypothesisColumns
+{
+    public:
+        std::vector< std::string > class_id;
+
+        std::vector< double > score;
+
+    public:
+        /**
+         * Number of elements.
+         */
+        inline int size() const;
+
+        /**
+         * Resize every column to @p n elements.
+         */
+        inline void resize(int n);
+
+        /**
+         * Gather element @p i into a ObjectHypothesis.
+         */
+        inline vision_msgs::ObjectHypothesis get(int i) const;
+
+        /**
+         * Scatter @p msg into element @p i.
+         */
+        inline void set(int i, const vision_msgs::ObjectHypothesis &msg);
+
+        // LCM support functions. Users should not call these
+        inline int _encodeNoHash(void *buf, int offset, int maxlen, int n) const;
+        template <typename Writer>
+        inline void _writeNoHash(Writer &out, int n) const;
+        inline int _getEncodedSizeNoHash(int n) const;
+        inline int _decodeNoHash(const void *buf, int offset, int maxlen, int n);
+};
+
+int ObjectHypothesisColumns::size() const
+{
+    return static_cast<int>(this->class_id.size());
+}
+
+void ObjectHypothesisColumns::resize(int n)
+{
+    this->class_id.resize(n);
+    this->score.resize(n);
+}
+
+vision_msgs::ObjectHypothesis ObjectHypothesisColumns::get(int i) const
+{
+    vision_msgs::ObjectHypothesis msg;
+    msg.class_id = this->class_id[i];
+    msg.score = this->score[i];
+    return msg;
+}
+
+void ObjectHypothesisColumns::set(int i, const vision_msgs::ObjectHypothesis &msg)
+{
+    this->class_id[i] = msg.class_id;
+    this->score[i] = msg.score;
+}
+
+int ObjectHypothesisColumns::_encodeNoHash(void *buf, int offset, int maxlen, int n) const
+{
+    uint8_t *p = static_cast<uint8_t*>(buf) + offset;
+    int pos = 0;
+    for (int i = 0; i < n; i++) {
+        int32_t __class_id_len__ = static_cast<int32_t>(this->class_id[i].size()) + 1;
+        if(maxlen - pos < 4 || __class_id_len__ > maxlen - pos - 4) return -1;
+        dimos_lcm::store_be(p + pos, __class_id_len__);
+        memcpy(p + pos + 4, this->class_id[i].c_str(), __class_id_len__);
+        pos += 4 + __class_id_len__;
+        if(maxlen - pos < 8) return -1;
+        dimos_lcm::store_be(p + pos + 0, this->score[i]);
+        pos += 8;
+    }
+    return pos;
+}
+
+template <typename Writer>
+void ObjectHypothesisColumns::_writeNoHash(Writer &out, int n) const
+{
+    for (int i = 0; i < n; i++) {
+        out.put(this->class_id[i]);
+        {
+            uint8_t *p = out.extend(8);
+            dimos_lcm::store_be(p + 0, this->score[i]);
+        }
+    }
+}
+
+int ObjectHypothesisColumns::_getEncodedSizeNoHash(int n) const
+{
+    int size = n * 13;
+    for (int i = 0; i < n; i++)
+        size += this->class_id[i].size();
+    return size;
+}
+
+int ObjectHypothesisColumns::_decodeNoHash(const void *buf, int offset, int maxlen, int n)
+{
+    if(n < 0 || n > maxlen / 13) return -1;
+    this->resize(n);
+    const uint8_t *p = static_cast<const uint8_t*>(buf) + offset;
+    int pos = 0;
+    for (int i = 0; i < n; i++) {
+        int32_t __class_id_len__;
+        if(maxlen - pos < 4) return -1;
+        dimos_lcm::load_be(p + pos, __class_id_len__);
+        pos += 4;
+        if(__class_id_len__ < 1 || __class_id_len__ > maxlen - pos) return -1;
+        this->class_id[i].assign(reinterpret_cast<const char*>(p) + pos, __class_id_len__ - 1);
+        pos += __class_id_len__;
+        if(maxlen - pos < 8) return -1;
+        dimos_lcm::load_be(p + pos + 0, this->score[i]);
+        pos += 8;
+    }
+    return pos;
+}
+
+}
+
+#endif
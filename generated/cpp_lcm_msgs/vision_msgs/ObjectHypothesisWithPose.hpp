@@ -1,7 +1,7 @@
 /** THIS IS AN AUTOMATICALLY GENERATED FILE.  DO NOT MODIFY
  * BY HAND!!
  *
- * Generated by lcm-gen 1.5.2
+ * Generated by lcm-cpp (tools/cpp/gen)
  **/
 
 #ifndef __vision_msgs_ObjectHypothesisWithPose_hpp__
@@ -9,6 +9,10 @@
 
 #include <lcm/lcm_coretypes.h>
 
+#include <array>
+#include "dimos_lcm/writer.hpp"
+#include "dimos_lcm/fingerprint.hpp"
+#include "dimos_lcm/reflection.hpp"
 #include "vision_msgs/ObjectHypothesis.hpp"
 #include "geometry_msgs/PoseWithCovariance.hpp"
 
@@ -34,6 +38,15 @@ class ObjectHypothesisWithPose
          */
         inline int encode(void *buf, int offset, int maxlen) const;
 
+        /**
+         * Encode a message by appending it to @p buf, walking the message once
+         * instead of sizing it with getEncodedSize() first. @p buf grows
+         * geometrically; reuse it across calls to avoid reallocating.
+         *
+         * @return The number of bytes appended.
+         */
+        inline int encodeTo(std::vector<uint8_t> &buf) const;
+
         /**
          * Check how many bytes are required to encode this message.
          */
@@ -49,6 +62,28 @@ class ObjectHypothesisWithPose
          */
         inline int decode(const void *buf, int offset, int maxlen);
 
+        /**
+         * Field bits for decodeFields().
+         */
+        struct Fields
+        {
+            static constexpr uint64_t hypothesis = 1ULL << 0;
+            static constexpr uint64_t pose = 1ULL << 1;
+            static constexpr uint64_t all = (1ULL << 2) - 1;
+        };
+
+        /**
+         * Decode only the fields selected by @p Mask, a bitwise or of Fields
+         * values. Strings, arrays and nested structs that are not selected are
+         * skipped over by their length prefixes without being allocated, and
+         * keep their previous value. Scalar fields are always decoded: they
+         * cost nothing to read and array lengths depend on them.
+         *
+         * @return The number of bytes decoded, or <0 if an error occured.
+         */
+        template <uint64_t Mask>
+        inline int decodeFields(const void *buf, int offset, int maxlen);
+
         /**
          * Retrieve the 64-bit fingerprint identifying the structure of the message.
          * Note that the fingerprint is the same for all instances of the same
@@ -57,18 +92,48 @@ class ObjectHypothesisWithPose
          */
         inline static int64_t getHash();
 
+        /**
+         * The fingerprint returned by getHash(), as a compile-time constant.
+         */
+        static constexpr int64_t kHash = static_cast<int64_t>(0x4bb2ad4de62d7853ULL);
+
         /**
          * Returns "ObjectHypothesisWithPose"
          */
         inline static const char* getTypeName();
 
+        /**
+         * Name, LCM type and array dimensions of each field, in wire order.
+         * See dimos_lcm::for_each_field() for visiting the fields themselves.
+         */
+        static constexpr std::array<dimos_lcm::field_info, 2> kFields = {{
+            { "hypothesis", "vision_msgs.ObjectHypothesis", false, 0, 0, NULL },
+            { "pose", "geometry_msgs.PoseWithCovariance", false, 0, 0, NULL },
+        }};
+
         // LCM support functions. Users should not call these
         inline int _encodeNoHash(void *buf, int offset, int maxlen) const;
+        template <typename Writer>
+        inline void _writeNoHash(Writer &out) const;
         inline int _getEncodedSizeNoHash() const;
         inline int _decodeNoHash(const void *buf, int offset, int maxlen);
+        template <uint64_t Mask>
+        inline int _decodeFieldsNoHash(const void *buf, int offset, int maxlen);
+        template <typename Self, typename Visitor>
+        inline static void _forEachField(Self &self, Visitor &visitor);
+        inline static int _skipNoHash(const void *buf, int offset, int maxlen);
         inline static uint64_t _computeHash(const __lcm_hash_ptr *p);
 };
 
+static_assert(ObjectHypothesisWithPose::kHash == dimos_lcm::fingerprint(
+    dimos_lcm::signature_hash()
+        .member("hypothesis", NULL, 0)
+        .member("pose", NULL, 0)
+        .value(),
+    vision_msgs::ObjectHypothesis::kHash,
+    geometry_msgs::PoseWithCovariance::kHash),
+    "vision_msgs::ObjectHypothesisWithPose fingerprint does not match its definition");
+
 int ObjectHypothesisWithPose::encode(void *buf, int offset, int maxlen) const
 {
     int pos = 0, tlen;
@@ -83,6 +148,15 @@ int ObjectHypothesisWithPose::encode(void *buf, int offset, int maxlen) const
     return pos;
 }
 
+int ObjectHypothesisWithPose::encodeTo(std::vector<uint8_t> &buf) const
+{
+    dimos_lcm::vector_writer out(buf);
+    int64_t hash = getHash();
+    out.put(&hash, 1);
+    this->_writeNoHash(out);
+    return static_cast<int>(out.size());
+}
+
 int ObjectHypothesisWithPose::decode(const void *buf, int offset, int maxlen)
 {
     int pos = 0, thislen;
@@ -98,6 +172,22 @@ int ObjectHypothesisWithPose::decode(const void *buf, int offset, int maxlen)
     return pos;
 }
 
+template <uint64_t Mask>
+int ObjectHypothesisWithPose::decodeFields(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, thislen;
+
+    int64_t msg_hash;
+    thislen = __int64_t_decode_array(buf, offset + pos, maxlen - pos, &msg_hash, 1);
+    if (thislen < 0) return thislen; else pos += thislen;
+    if (msg_hash != getHash()) return -1;
+
+    thislen = this->_decodeFieldsNoHash<Mask>(buf, offset + pos, maxlen - pos);
+    if (thislen < 0) return thislen; else pos += thislen;
+
+    return pos;
+}
+
 int ObjectHypothesisWithPose::getEncodedSize() const
 {
     return 8 + _getEncodedSizeNoHash();
@@ -105,8 +195,7 @@ int ObjectHypothesisWithPose::getEncodedSize() const
 
 int64_t ObjectHypothesisWithPose::getHash()
 {
-    static int64_t hash = static_cast<int64_t>(_computeHash(NULL));
-    return hash;
+    return kHash;
 }
 
 const char* ObjectHypothesisWithPose::getTypeName()
@@ -127,6 +216,13 @@ int ObjectHypothesisWithPose::_encodeNoHash(void *buf, int offset, int maxlen) c
     return pos;
 }
 
+template <typename Writer>
+void ObjectHypothesisWithPose::_writeNoHash(Writer &out) const
+{
+    this->hypothesis._writeNoHash(out);
+    this->pose._writeNoHash(out);
+}
+
 int ObjectHypothesisWithPose::_decodeNoHash(const void *buf, int offset, int maxlen)
 {
     int pos = 0, tlen;
@@ -140,6 +236,30 @@ int ObjectHypothesisWithPose::_decodeNoHash(const void *buf, int offset, int max
     return pos;
 }
 
+template <uint64_t Mask>
+int ObjectHypothesisWithPose::_decodeFieldsNoHash(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, tlen;
+
+    if ((Mask & Fields::hypothesis) != 0) {
+        tlen = this->hypothesis._decodeNoHash(buf, offset + pos, maxlen - pos);
+        if(tlen < 0) return tlen; else pos += tlen;
+    } else {
+        tlen = vision_msgs::ObjectHypothesis::_skipNoHash(buf, offset + pos, maxlen - pos);
+        if(tlen < 0) return tlen; else pos += tlen;
+    }
+
+    if ((Mask & Fields::pose) != 0) {
+        tlen = this->pose._decodeNoHash(buf, offset + pos, maxlen - pos);
+        if(tlen < 0) return tlen; else pos += tlen;
+    } else {
+        tlen = geometry_msgs::PoseWithCovariance::_skipNoHash(buf, offset + pos, maxlen - pos);
+        if(tlen < 0) return tlen; else pos += tlen;
+    }
+
+    return pos;
+}
+
 int ObjectHypothesisWithPose::_getEncodedSizeNoHash() const
 {
     int enc_size = 0;
@@ -148,6 +268,24 @@ int ObjectHypothesisWithPose::_getEncodedSizeNoHash() const
     return enc_size;
 }
 
+int ObjectHypothesisWithPose::_skipNoHash(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, tlen;
+    tlen = vision_msgs::ObjectHypothesis::_skipNoHash(buf, offset + pos, maxlen - pos);
+    if(tlen < 0) return tlen; else pos += tlen;
+    tlen = geometry_msgs::PoseWithCovariance::_skipNoHash(buf, offset + pos, maxlen - pos);
+    if(tlen < 0) return tlen; else pos += tlen;
+    if(pos > maxlen) return -1;
+    return pos;
+}
+
+template <typename Self, typename Visitor>
+void ObjectHypothesisWithPose::_forEachField(Self &self, Visitor &visitor)
+{
+    visitor(kFields[0], self.hypothesis);
+    visitor(kFields[1], self.pose);
+}
+
 uint64_t ObjectHypothesisWithPose::_computeHash(const __lcm_hash_ptr *p)
 {
     const __lcm_hash_ptr *fp;
@@ -0,0 +1,422 @@
+/** THIS IS AN AUTOMATICALLY GENERATED FILE.  DO NOT MODIFY
+ * BY HAND!!
+ *
+ * Generated by lcm-cpp (tools/cpp/gen)
+ **/
+
+#ifndef __vision_msgs_interned_VisionInfo_hpp__
+#define __vision_msgs_interned_VisionInfo_hpp__
+
+#include <lcm/lcm_coretypes.h>
+
+#include <array>
+#include <string>
+#include "dimos_lcm/writer.hpp"
+#include "dimos_lcm/fingerprint.hpp"
+#include "dimos_lcm/reflection.hpp"
+#include "std_msgs/interned/Header.hpp"
+#if __cplusplus >= 201703L
+#include "std_msgs/HeaderView.hpp"
+#endif
+
+namespace vision_msgs
+{
+namespace interned
+{
+
+class VisionInfo
+{
+    public:
+        std_msgs::interned::Header header;
+
+        std::string method;
+
+        std::string database_location;
+
+        int32_t    database_version;
+
+    public:
+        /**
+         * Encode a message into binary form.
+         *
+         * @param buf The output buffer.
+         * @param offset Encoding starts at thie byte offset into @p buf.
+         * @param maxlen Maximum number of bytes to write.  This should generally be
+         *  equal to getEncodedSize().
+         * @return The number of bytes encoded, or <0 on error.
+         */
+        inline int encode(void *buf, int offset, int maxlen) const;
+
+        /**
+         * Encode a message by appending it to @p buf, walking the message once
+         * instead of sizing it with getEncodedSize() first. @p buf grows
+         * geometrically; reuse it across calls to avoid reallocating.
+         *
+         * @return The number of bytes appended.
+         */
+        inline int encodeTo(std::vector<uint8_t> &buf) const;
+
+        /**
+         * Check how many bytes are required to encode this message.
+         */
+        inline int getEncodedSize() const;
+
+        /**
+         * Decode a message from binary form into this instance.
+         *
+         * @param buf The buffer containing the encoded message.
+         * @param offset The byte offset into @p buf where the encoded message starts.
+         * @param maxlen The maximum number of bytes to read while decoding.
+         * @return The number of bytes decoded, or <0 if an error occured.
+         */
+        inline int decode(const void *buf, int offset, int maxlen);
+
+#if __cplusplus >= 201703L
+        /**
+         * Decode only the header field of an encoded message, leaving the
+         * rest of it untouched. The field sits at a fixed offset, so this costs
+         * the same for any payload size. The view points into @p buf.
+         *
+         * @param buf The buffer containing the encoded message.
+         * @param offset The byte offset into @p buf where the encoded message starts.
+         * @param maxlen The maximum number of bytes to read while decoding.
+         * @param header Receives the decoded header.
+         * @return The number of bytes of the field decoded, or <0 if @p buf does
+         *  not hold a VisionInfo or is truncated.
+         *
+         * Needs C++17, for the std::string_view of the view.
+         */
+        inline static int peekHeader(const void *buf, int offset, int maxlen, std_msgs::HeaderView &header);
+#endif
+
+        /**
+         * Field bits for decodeFields().
+         */
+        struct Fields
+        {
+            static constexpr uint64_t header = 1ULL << 0;
+            static constexpr uint64_t method = 1ULL << 1;
+            static constexpr uint64_t database_location = 1ULL << 2;
+            static constexpr uint64_t database_version = 1ULL << 3;
+            static constexpr uint64_t all = (1ULL << 4) - 1;
+        };
+
+        /**
+         * Decode only the fields selected by @p Mask, a bitwise or of Fields
+         * values. Strings, arrays and nested structs that are not selected are
+         * skipped over by their length prefixes without being allocated, and
+         * keep their previous value. Scalar fields are always decoded: they
+         * cost nothing to read and array lengths depend on them.
+         *
+         * @return The number of bytes decoded, or <0 if an error occured.
+         */
+        template <uint64_t Mask>
+        inline int decodeFields(const void *buf, int offset, int maxlen);
+
+        /**
+         * Retrieve the 64-bit fingerprint identifying the structure of the message.
+         * Note that the fingerprint is the same for all instances of the same
+         * message type, and is a fingerprint on the message type definition, not on
+         * the message contents.
+         */
+        inline static int64_t getHash();
+
+        /**
+         * The fingerprint returned by getHash(), as a compile-time constant.
+         */
+        static constexpr int64_t kHash = static_cast<int64_t>(0x2539ba85fbfd3565ULL);
+
+        /**
+         * Returns "VisionInfo"
+         */
+        inline static const char* getTypeName();
+
+        /**
+         * Name, LCM type and array dimensions of each field, in wire order.
+         * See dimos_lcm::for_each_field() for visiting the fields themselves.
+         */
+        static constexpr std::array<dimos_lcm::field_info, 4> kFields = {{
+            { "header", "std_msgs.Header", false, 0, 0, NULL },
+            { "method", "string", true, 0, 0, NULL },
+            { "database_location", "string", true, 0, 0, NULL },
+            { "database_version", "int32_t", true, 0, 0, NULL },
+        }};
+
+        // LCM support functions. Users should not call these
+        inline int _encodeNoHash(void *buf, int offset, int maxlen) const;
+        template <typename Writer>
+        inline void _writeNoHash(Writer &out) const;
+        inline int _getEncodedSizeNoHash() const;
+        inline int _decodeNoHash(const void *buf, int offset, int maxlen);
+        template <uint64_t Mask>
+        inline int _decodeFieldsNoHash(const void *buf, int offset, int maxlen);
+        template <typename Self, typename Visitor>
+        inline static void _forEachField(Self &self, Visitor &visitor);
+        inline static int _skipNoHash(const void *buf, int offset, int maxlen);
+        inline static uint64_t _computeHash(const __lcm_hash_ptr *p);
+};
+
+static_assert(VisionInfo::kHash == dimos_lcm::fingerprint(
+    dimos_lcm::signature_hash()
+        .member("header", NULL, 0)
+        .member("method", "string", 0)
+        .member("database_location", "string", 0)
+        .member("database_version", "int32_t", 0)
+        .value(),
+    std_msgs::interned::Header::kHash),
+    "vision_msgs::interned::VisionInfo fingerprint does not match its definition");
+
+int VisionInfo::encode(void *buf, int offset, int maxlen) const
+{
+    int pos = 0, tlen;
+    int64_t hash = getHash();
+
+    tlen = __int64_t_encode_array(buf, offset + pos, maxlen - pos, &hash, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = this->_encodeNoHash(buf, offset + pos, maxlen - pos);
+    if (tlen < 0) return tlen; else pos += tlen;
+
+    return pos;
+}
+
+int VisionInfo::encodeTo(std::vector<uint8_t> &buf) const
+{
+    dimos_lcm::vector_writer out(buf);
+    int64_t hash = getHash();
+    out.put(&hash, 1);
+    this->_writeNoHash(out);
+    return static_cast<int>(out.size());
+}
+
+int VisionInfo::decode(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, thislen;
+
+    int64_t msg_hash;
+    thislen = __int64_t_decode_array(buf, offset + pos, maxlen - pos, &msg_hash, 1);
+    if (thislen < 0) return thislen; else pos += thislen;
+    if (msg_hash != getHash()) return -1;
+
+    thislen = this->_decodeNoHash(buf, offset + pos, maxlen - pos);
+    if (thislen < 0) return thislen; else pos += thislen;
+
+    return pos;
+}
+
+#if __cplusplus >= 201703L
+int VisionInfo::peekHeader(const void *buf, int offset, int maxlen, std_msgs::HeaderView &header)
+{
+    int64_t msg_hash;
+    if (__int64_t_decode_array(buf, offset, maxlen, &msg_hash, 1) < 0) return -1;
+    if (msg_hash != kHash) return -1;
+
+    // header follows the hash and 0 bytes of fixed-size fields
+    return header._decodeNoHash(buf, offset + 8, maxlen - 8);
+}
+#endif
+
+template <uint64_t Mask>
+int VisionInfo::decodeFields(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, thislen;
+
+    int64_t msg_hash;
+    thislen = __int64_t_decode_array(buf, offset + pos, maxlen - pos, &msg_hash, 1);
+    if (thislen < 0) return thislen; else pos += thislen;
+    if (msg_hash != getHash()) return -1;
+
+    thislen = this->_decodeFieldsNoHash<Mask>(buf, offset + pos, maxlen - pos);
+    if (thislen < 0) return thislen; else pos += thislen;
+
+    return pos;
+}
+
+int VisionInfo::getEncodedSize() const
+{
+    return 8 + _getEncodedSizeNoHash();
+}
+
+int64_t VisionInfo::getHash()
+{
+    return kHash;
+}
+
+const char* VisionInfo::getTypeName()
+{
+    return "VisionInfo";
+}
+
+int VisionInfo::_encodeNoHash(void *buf, int offset, int maxlen) const
+{
+    int pos = 0, tlen;
+
+    tlen = this->header._encodeNoHash(buf, offset + pos, maxlen - pos);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    char* method_cstr = const_cast<char*>(this->method.c_str());
+    tlen = __string_encode_array(
+        buf, offset + pos, maxlen - pos, &method_cstr, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    char* database_location_cstr = const_cast<char*>(this->database_location.c_str());
+    tlen = __string_encode_array(
+        buf, offset + pos, maxlen - pos, &database_location_cstr, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = __int32_t_encode_array(buf, offset + pos, maxlen - pos, &this->database_version, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    return pos;
+}
+
+template <typename Writer>
+void VisionInfo::_writeNoHash(Writer &out) const
+{
+    this->header._writeNoHash(out);
+    out.put(this->method);
+    out.put(this->database_location);
+    out.put(&this->database_version, 1);
+}
+
+int VisionInfo::_decodeNoHash(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, tlen;
+
+    tlen = this->header._decodeNoHash(buf, offset + pos, maxlen - pos);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    int32_t __method_len__;
+    tlen = __int32_t_decode_array(
+        buf, offset + pos, maxlen - pos, &__method_len__, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+    if(__method_len__ < 1 || __method_len__ > maxlen - pos) return -1;
+    this->method.assign(
+        static_cast<const char*>(buf) + offset + pos, __method_len__ - 1);
+    pos += __method_len__;
+
+    int32_t __database_location_len__;
+    tlen = __int32_t_decode_array(
+        buf, offset + pos, maxlen - pos, &__database_location_len__, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+    if(__database_location_len__ < 1 || __database_location_len__ > maxlen - pos) return -1;
+    this->database_location.assign(
+        static_cast<const char*>(buf) + offset + pos, __database_location_len__ - 1);
+    pos += __database_location_len__;
+
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &this->database_version, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    return pos;
+}
+
+template <uint64_t Mask>
+int VisionInfo::_decodeFieldsNoHash(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, tlen;
+
+    if ((Mask & Fields::header) != 0) {
+        tlen = this->header._decodeNoHash(buf, offset + pos, maxlen - pos);
+        if(tlen < 0) return tlen; else pos += tlen;
+    } else {
+        tlen = std_msgs::interned::Header::_skipNoHash(buf, offset + pos, maxlen - pos);
+        if(tlen < 0) return tlen; else pos += tlen;
+    }
+
+    if ((Mask & Fields::method) != 0) {
+        int32_t __method_len__;
+        tlen = __int32_t_decode_array(
+            buf, offset + pos, maxlen - pos, &__method_len__, 1);
+        if(tlen < 0) return tlen; else pos += tlen;
+        if(__method_len__ < 1 || __method_len__ > maxlen - pos) return -1;
+        this->method.assign(
+            static_cast<const char*>(buf) + offset + pos, __method_len__ - 1);
+        pos += __method_len__;
+    } else {
+        int32_t __method_len__;
+        tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &__method_len__, 1);
+        if(tlen < 0) return tlen; else pos += tlen;
+        if(__method_len__ < 0 || __method_len__ > maxlen - pos) return -1;
+        pos += __method_len__;
+    }
+
+    if ((Mask & Fields::database_location) != 0) {
+        int32_t __database_location_len__;
+        tlen = __int32_t_decode_array(
+            buf, offset + pos, maxlen - pos, &__database_location_len__, 1);
+        if(tlen < 0) return tlen; else pos += tlen;
+        if(__database_location_len__ < 1 || __database_location_len__ > maxlen - pos) return -1;
+        this->database_location.assign(
+            static_cast<const char*>(buf) + offset + pos, __database_location_len__ - 1);
+        pos += __database_location_len__;
+    } else {
+        int32_t __database_location_len__;
+        tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &__database_location_len__, 1);
+        if(tlen < 0) return tlen; else pos += tlen;
+        if(__database_location_len__ < 0 || __database_location_len__ > maxlen - pos) return -1;
+        pos += __database_location_len__;
+    }
+
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &this->database_version, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    return pos;
+}
+
+int VisionInfo::_getEncodedSizeNoHash() const
+{
+    int enc_size = 0;
+    enc_size += this->header._getEncodedSizeNoHash();
+    enc_size += this->method.size() + 4 + 1;
+    enc_size += this->database_location.size() + 4 + 1;
+    enc_size += __int32_t_encoded_array_size(NULL, 1);
+    return enc_size;
+}
+
+int VisionInfo::_skipNoHash(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, tlen;
+    tlen = std_msgs::interned::Header::_skipNoHash(buf, offset + pos, maxlen - pos);
+    if(tlen < 0) return tlen; else pos += tlen;
+    int32_t __method_len__;
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &__method_len__, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+    if(__method_len__ < 0 || __method_len__ > maxlen - pos) return -1;
+    pos += __method_len__;
+    int32_t __database_location_len__;
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &__database_location_len__, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+    if(__database_location_len__ < 0 || __database_location_len__ > maxlen - pos) return -1;
+    pos += __database_location_len__;
+    pos += 4;
+    if(pos > maxlen) return -1;
+    return pos;
+}
+
+template <typename Self, typename Visitor>
+void VisionInfo::_forEachField(Self &self, Visitor &visitor)
+{
+    visitor(kFields[0], self.header);
+    visitor(kFields[1], self.method);
+    visitor(kFields[2], self.database_location);
+    visitor(kFields[3], self.database_version);
+}
+
+uint64_t VisionInfo::_computeHash(const __lcm_hash_ptr *p)
+{
+    const __lcm_hash_ptr *fp;
+    for(fp = p; fp != NULL; fp = fp->parent)
+        if(fp->v == VisionInfo::getHash)
+            return 0;
+    const __lcm_hash_ptr cp = { p, VisionInfo::getHash };
+
+    uint64_t hash = 0x62c1cbfdc2184fbbLL +
+         std_msgs::interned::Header::_computeHash(&cp);
+
+    return (hash<<1) + ((hash>>63)&1);
+}
+
+}
+}
+
+#endif
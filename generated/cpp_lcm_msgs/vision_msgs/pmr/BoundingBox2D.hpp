@@ -0,0 +1,23 @@
+/** THIS IS AN AUTOMATICALLY GENERATED FILE.  DO NOT MODIFY
+ * BY HAND!!
+ *
+ * Generated by lcm-cpp (tools/cpp/gen)
+ **/
+
+#ifndef __vision_msgs_pmr_BoundingBox2D_hpp__
+#define __vision_msgs_pmr_BoundingBox2D_hpp__
+
+#include "vision_msgs/BoundingBox2D.hpp"
+
+namespace vision_msgs
+{
+namespace pmr
+{
+
+// BoundingBox2D has no strings or variable-length arrays, so it never allocates
+typedef vision_msgs::BoundingBox2D BoundingBox2D;
+
+}
+}
+
+#endif
@@ -0,0 +1,23 @@
+/** THIS IS AN AUTOMATICALLY GENERATED FILE.  DO NOT MODIFY
+ * BY HAND!!
+ *
+ * Generated by lcm-cpp (tools/cpp/gen)
+ **/
+
+#ifndef __vision_msgs_pmr_BoundingBox3D_hpp__
+#define __vision_msgs_pmr_BoundingBox3D_hpp__
+
+#include "vision_msgs/BoundingBox3D.hpp"
+
+namespace vision_msgs
+{
+namespace pmr
+{
+
+// BoundingBox3D has no strings or variable-length arrays, so it never allocates
+typedef vision_msgs::BoundingBox3D BoundingBox3D;
+
+}
+}
+
+#endif
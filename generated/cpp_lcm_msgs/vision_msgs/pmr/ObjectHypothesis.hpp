@@ -0,0 +1,347 @@
+/** THIS IS AN AUTOMATICALLY GENERATED FILE.  DO NOT MODIFY
+ * BY HAND!!
+ *
+ * Generated by lcm-cpp (tools/cpp/gen)
+ **/
+
+#ifndef __vision_msgs_pmr_ObjectHypothesis_hpp__
+#define __vision_msgs_pmr_ObjectHypothesis_hpp__
+
+#include <lcm/lcm_coretypes.h>
+
+#include <array>
+#include <memory_resource>
+#include <utility>
+#include <string>
+#include "dimos_lcm/writer.hpp"
+#include "dimos_lcm/fingerprint.hpp"
+#include "dimos_lcm/reflection.hpp"
+
+namespace vision_msgs
+{
+namespace pmr
+{
+
+class ObjectHypothesis
+{
+    public:
+        std::pmr::string class_id;
+
+        double     score;
+
+    public:
+        typedef std::pmr::polymorphic_allocator<char> allocator_type;
+
+        /**
+         * Construct a message whose strings and arrays, and those of the
+         * messages it nests, allocate from @p alloc. Scalars are zeroed.
+         */
+        inline explicit ObjectHypothesis(const allocator_type &alloc = allocator_type());
+
+        /**
+         * Copy or move @p other into a message that allocates from @p alloc.
+         * With allocator_type, these let std::pmr containers of ObjectHypothesis pass
+         * their memory resource on to their elements.
+         */
+        inline ObjectHypothesis(const ObjectHypothesis &other, const allocator_type &alloc);
+        inline ObjectHypothesis(ObjectHypothesis &&other, const allocator_type &alloc);
+
+        /**
+         * Encode a message into binary form.
+         *
+         * @param buf The output buffer.
+         * @param offset Encoding starts at thie byte offset into @p buf.
+         * @param maxlen Maximum number of bytes to write.  This should generally be
+         *  equal to getEncodedSize().
+         * @return The number of bytes encoded, or <0 on error.
+         */
+        inline int encode(void *buf, int offset, int maxlen) const;
+
+        /**
+         * Encode a message by appending it to @p buf, walking the message once
+         * instead of sizing it with getEncodedSize() first. @p buf grows
+         * geometrically; reuse it across calls to avoid reallocating.
+         *
+         * @return The number of bytes appended.
+         */
+        inline int encodeTo(std::vector<uint8_t> &buf) const;
+
+        /**
+         * Check how many bytes are required to encode this message.
+         */
+        inline int getEncodedSize() const;
+
+        /**
+         * Decode a message from binary form into this instance.
+         *
+         * @param buf The buffer containing the encoded message.
+         * @param offset The byte offset into @p buf where the encoded message starts.
+         * @param maxlen The maximum number of bytes to read while decoding.
+         * @return The number of bytes decoded, or <0 if an error occured.
+         */
+        inline int decode(const void *buf, int offset, int maxlen);
+
+        /**
+         * Field bits for decodeFields().
+         */
+        struct Fields
+        {
+            static constexpr uint64_t class_id = 1ULL << 0;
+            static constexpr uint64_t score = 1ULL << 1;
+            static constexpr uint64_t all = (1ULL << 2) - 1;
+        };
+
+        /**
+         * Decode only the fields selected by @p Mask, a bitwise or of Fields
+         * values. Strings, arrays and nested structs that are not selected are
+         * skipped over by their length prefixes without being allocated, and
+         * keep their previous value. Scalar fields are always decoded: they
+         * cost nothing to read and array lengths depend on them.
+         *
+         * @return The number of bytes decoded, or <0 if an error occured.
+         */
+        template <uint64_t Mask>
+        inline int decodeFields(const void *buf, int offset, int maxlen);
+
+        /**
+         * Retrieve the 64-bit fingerprint identifying the structure of the message.
+         * Note that the fingerprint is the same for all instances of the same
+         * message type, and is a fingerprint on the message type definition, not on
+         * the message contents.
+         */
+        inline static int64_t getHash();
+
+        /**
+         * The fingerprint returned by getHash(), as a compile-time constant.
+         */
+        static constexpr int64_t kHash = static_cast<int64_t>(0x719359aa86271644ULL);
+
+        /**
+         * Returns "ObjectHypothesis"
+         */
+        inline static const char* getTypeName();
+
+        /**
+         * Name, LCM type and array dimensions of each field, in wire order.
+         * See dimos_lcm::for_each_field() for visiting the fields themselves.
+         */
+        static constexpr std::array<dimos_lcm::field_info, 2> kFields = {{
+            { "class_id", "string", true, 0, 0, NULL },
+            { "score", "double", true, 0, 0, NULL },
+        }};
+
+        // LCM support functions. Users should not call these
+        inline int _encodeNoHash(void *buf, int offset, int maxlen) const;
+        template <typename Writer>
+        inline void _writeNoHash(Writer &out) const;
+        inline int _getEncodedSizeNoHash() const;
+        inline int _decodeNoHash(const void *buf, int offset, int maxlen);
+        template <uint64_t Mask>
+        inline int _decodeFieldsNoHash(const void *buf, int offset, int maxlen);
+        template <typename Self, typename Visitor>
+        inline static void _forEachField(Self &self, Visitor &visitor);
+        inline static int _skipNoHash(const void *buf, int offset, int maxlen);
+        inline static uint64_t _computeHash(const __lcm_hash_ptr *p);
+};
+
+static_assert(ObjectHypothesis::kHash == dimos_lcm::fingerprint(
+    dimos_lcm::signature_hash()
+        .member("class_id", "string", 0)
+        .member("score", "double", 0)
+        .value()),
+    "vision_msgs::pmr::ObjectHypothesis fingerprint does not match its definition");
+
+ObjectHypothesis::ObjectHypothesis(const allocator_type &alloc) :
+    class_id(alloc),
+    score()
+{
+}
+
+ObjectHypothesis::ObjectHypothesis(const ObjectHypothesis &other, const allocator_type &alloc) :
+    ObjectHypothesis(alloc)
+{
+    *this = other;
+}
+
+ObjectHypothesis::ObjectHypothesis(ObjectHypothesis &&other, const allocator_type &alloc) :
+    ObjectHypothesis(alloc)
+{
+    *this = std::move(other);
+}
+
+int ObjectHypothesis::encode(void *buf, int offset, int maxlen) const
+{
+    int pos = 0, tlen;
+    int64_t hash = getHash();
+
+    tlen = __int64_t_encode_array(buf, offset + pos, maxlen - pos, &hash, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = this->_encodeNoHash(buf, offset + pos, maxlen - pos);
+    if (tlen < 0) return tlen; else pos += tlen;
+
+    return pos;
+}
+
+int ObjectHypothesis::encodeTo(std::vector<uint8_t> &buf) const
+{
+    dimos_lcm::vector_writer out(buf);
+    int64_t hash = getHash();
+    out.put(&hash, 1);
+    this->_writeNoHash(out);
+    return static_cast<int>(out.size());
+}
+
+int ObjectHypothesis::decode(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, thislen;
+
+    int64_t msg_hash;
+    thislen = __int64_t_decode_array(buf, offset + pos, maxlen - pos, &msg_hash, 1);
+    if (thislen < 0) return thislen; else pos += thislen;
+    if (msg_hash != getHash()) return -1;
+
+    thislen = this->_decodeNoHash(buf, offset + pos, maxlen - pos);
+    if (thislen < 0) return thislen; else pos += thislen;
+
+    return pos;
+}
+
+template <uint64_t Mask>
+int ObjectHypothesis::decodeFields(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, thislen;
+
+    int64_t msg_hash;
+    thislen = __int64_t_decode_array(buf, offset + pos, maxlen - pos, &msg_hash, 1);
+    if (thislen < 0) return thislen; else pos += thislen;
+    if (msg_hash != getHash()) return -1;
+
+    thislen = this->_decodeFieldsNoHash<Mask>(buf, offset + pos, maxlen - pos);
+    if (thislen < 0) return thislen; else pos += thislen;
+
+    return pos;
+}
+
+int ObjectHypothesis::getEncodedSize() const
+{
+    return 8 + _getEncodedSizeNoHash();
+}
+
+int64_t ObjectHypothesis::getHash()
+{
+    return kHash;
+}
+
+const char* ObjectHypothesis::getTypeName()
+{
+    return "ObjectHypothesis";
+}
+
+int ObjectHypothesis::_encodeNoHash(void *buf, int offset, int maxlen) const
+{
+    int pos = 0, tlen;
+
+    char* class_id_cstr = const_cast<char*>(this->class_id.c_str());
+    tlen = __string_encode_array(
+        buf, offset + pos, maxlen - pos, &class_id_cstr, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = __double_encode_array(buf, offset + pos, maxlen - pos, &this->score, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    return pos;
+}
+
+template <typename Writer>
+void ObjectHypothesis::_writeNoHash(Writer &out) const
+{
+    out.put(this->class_id);
+    out.put(&this->score, 1);
+}
+
+int ObjectHypothesis::_decodeNoHash(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, tlen;
+
+    int32_t __class_id_len__;
+    tlen = __int32_t_decode_array(
+        buf, offset + pos, maxlen - pos, &__class_id_len__, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+    if(__class_id_len__ < 1 || __class_id_len__ > maxlen - pos) return -1;
+    this->class_id.assign(
+        static_cast<const char*>(buf) + offset + pos, __class_id_len__ - 1);
+    pos += __class_id_len__;
+
+    tlen = __double_decode_array(buf, offset + pos, maxlen - pos, &this->score, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    return pos;
+}
+
+template <uint64_t Mask>
+int ObjectHypothesis::_decodeFieldsNoHash(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, tlen;
+
+    if ((Mask & Fields::class_id) != 0) {
+        int32_t __class_id_len__;
+        tlen = __int32_t_decode_array(
+            buf, offset + pos, maxlen - pos, &__class_id_len__, 1);
+        if(tlen < 0) return tlen; else pos += tlen;
+        if(__class_id_len__ < 1 || __class_id_len__ > maxlen - pos) return -1;
+        this->class_id.assign(
+            static_cast<const char*>(buf) + offset + pos, __class_id_len__ - 1);
+        pos += __class_id_len__;
+    } else {
+        int32_t __class_id_len__;
+        tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &__class_id_len__, 1);
+        if(tlen < 0) return tlen; else pos += tlen;
+        if(__class_id_len__ < 0 || __class_id_len__ > maxlen - pos) return -1;
+        pos += __class_id_len__;
+    }
+
+    tlen = __double_decode_array(buf, offset + pos, maxlen - pos, &this->score, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    return pos;
+}
+
+int ObjectHypothesis::_getEncodedSizeNoHash() const
+{
+    int enc_size = 0;
+    enc_size += this->class_id.size() + 4 + 1;
+    enc_size += __double_encoded_array_size(NULL, 1);
+    return enc_size;
+}
+
+int ObjectHypothesis::_skipNoHash(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, tlen;
+    int32_t __class_id_len__;
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &__class_id_len__, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+    if(__class_id_len__ < 0 || __class_id_len__ > maxlen - pos) return -1;
+    pos += __class_id_len__;
+    pos += 8;
+    if(pos > maxlen) return -1;
+    return pos;
+}
+
+template <typename Self, typename Visitor>
+void ObjectHypothesis::_forEachField(Self &self, Visitor &visitor)
+{
+    visitor(kFields[0], self.class_id);
+    visitor(kFields[1], self.score);
+}
+
+uint64_t ObjectHypothesis::_computeHash(const __lcm_hash_ptr *)
+{
+    uint64_t hash = 0x38c9acd543138b22LL;
+    return (hash<<1) + ((hash>>63)&1);
+}
+
+}
+}
+
+#endif
@@ -1,7 +1,7 @@
 /** THIS IS AN AUTOMATICALLY GENERATED FILE.  DO NOT MODIFY
  * BY HAND!!
  *
- * Generated by lcm-gen 1.5.2
+ * Generated by lcm-cpp (tools/cpp/gen)
  **/
 
 #ifndef __visualization_msgs_ImageMarker_hpp__
@@ -9,15 +9,19 @@
 
 #include <lcm/lcm_coretypes.h>
 
+#include <array>
 #include <string>
 #include <vector>
+#include "dimos_lcm/writer.hpp"
+#include "dimos_lcm/fingerprint.hpp"
+#include "dimos_lcm/reflection.hpp"
 #include "std_msgs/Header.hpp"
 #include "geometry_msgs/Point.hpp"
 #include "std_msgs/ColorRGBA.hpp"
-#include "std_msgs/ColorRGBA.hpp"
 #include "std_msgs/Duration.hpp"
-#include "geometry_msgs/Point.hpp"
-#include "std_msgs/ColorRGBA.hpp"
+#if __cplusplus >= 201703L
+#include "std_msgs/HeaderView.hpp"
+#endif
 
 namespace visualization_msgs
 {
@@ -110,6 +114,15 @@ class ImageMarker
          */
         inline int encode(void *buf, int offset, int maxlen) const;
 
+        /**
+         * Encode a message by appending it to @p buf, walking the message once
+         * instead of sizing it with getEncodedSize() first. @p buf grows
+         * geometrically; reuse it across calls to avoid reallocating.
+         *
+         * @return The number of bytes appended.
+         */
+        inline int encodeTo(std::vector<uint8_t> &buf) const;
+
         /**
          * Check how many bytes are required to encode this message.
          */
@@ -125,6 +138,72 @@ class ImageMarker
          */
         inline int decode(const void *buf, int offset, int maxlen);
 
+#if __cplusplus >= 201703L
+        /**
+         * Decode only the header field of an encoded message, leaving the
+         * rest of it untouched. The field sits at a fixed offset, so this costs
+         * the same for any payload size. The view points into @p buf.
+         *
+         * @param buf The buffer containing the encoded message.
+         * @param offset The byte offset into @p buf where the encoded message starts.
+         * @param maxlen The maximum number of bytes to read while decoding.
+         * @param header Receives the decoded header.
+         * @return The number of bytes of the field decoded, or <0 if @p buf does
+         *  not hold a ImageMarker or is truncated.
+         *
+         * Needs C++17, for the std::string_view of the view.
+         */
+        inline static int peekHeader(const void *buf, int offset, int maxlen, std_msgs::HeaderView &header);
+#endif
+
+        /**
+         * Field bits for decodeFields().
+         */
+        struct Fields
+        {
+            static constexpr uint64_t points_length = 1ULL << 0;
+            static constexpr uint64_t outline_colors_length = 1ULL << 1;
+            static constexpr uint64_t header = 1ULL << 2;
+            static constexpr uint64_t ns = 1ULL << 3;
+            static constexpr uint64_t id = 1ULL << 4;
+            static constexpr uint64_t type = 1ULL << 5;
+            static constexpr uint64_t action = 1ULL << 6;
+            static constexpr uint64_t position = 1ULL << 7;
+            static constexpr uint64_t scale = 1ULL << 8;
+            static constexpr uint64_t outline_color = 1ULL << 9;
+            static constexpr uint64_t filled = 1ULL << 10;
+            static constexpr uint64_t fill_color = 1ULL << 11;
+            static constexpr uint64_t lifetime = 1ULL << 12;
+            static constexpr uint64_t points = 1ULL << 13;
+            static constexpr uint64_t outline_colors = 1ULL << 14;
+            static constexpr uint64_t all = (1ULL << 15) - 1;
+        };
+
+        /**
+         * Decode only the fields selected by @p Mask, a bitwise or of Fields
+         * values. Strings, arrays and nested structs that are not selected are
+         * skipped over by their length prefixes without being allocated, and
+         * keep their previous value. Scalar fields are always decoded: they
+         * cost nothing to read and array lengths depend on them.
+         *
+         * @return The number of bytes decoded, or <0 if an error occured.
+         */
+        template <uint64_t Mask>
+        inline int decodeFields(const void *buf, int offset, int maxlen);
+
+        /**
+         * Upper bound on the length of every variable-length array of this
+         * type, checked by decode() before anything is allocated; messages
+         * exceeding it fail to decode. It does not apply to nested types,
+         * which have their own. Set it once at startup, before decoding.
+         * Before C++17 it is a constant with no limit.
+         */
+#if __cplusplus >= 201703L
+        static inline int32_t maxArrayLength = INT32_MAX;
+#else
+        static constexpr int32_t maxArrayLength = INT32_MAX;
+#endif
+
         /**
          * Retrieve the 64-bit fingerprint identifying the structure of the message.
          * Note that the fingerprint is the same for all instances of the same
@@ -133,18 +212,79 @@ class ImageMarker
          */
         inline static int64_t getHash();
 
+        /**
+         * The fingerprint returned by getHash(), as a compile-time constant.
+         */
+        static constexpr int64_t kHash = static_cast<int64_t>(0x9bd07ba352bfb309ULL);
+
         /**
          * Returns "ImageMarker"
          */
         inline static const char* getTypeName();
 
+        /**
+         * Name, LCM type and array dimensions of each field, in wire order.
+         * See dimos_lcm::for_each_field() for visiting the fields themselves.
+         */
+        static constexpr std::array<dimos_lcm::field_info, 15> kFields = {{
+            { "points_length", "int32_t", true, 0, 0, NULL },
+            { "outline_colors_length", "int32_t", true, 0, 0, NULL },
+            { "header", "std_msgs.Header", false, 0, 0, NULL },
+            { "ns", "string", true, 0, 0, NULL },
+            { "id", "int32_t", true, 0, 0, NULL },
+            { "type", "int32_t", true, 0, 0, NULL },
+            { "action", "int32_t", true, 0, 0, NULL },
+            { "position", "geometry_msgs.Point", false, 0, 0, NULL },
+            { "scale", "float", true, 0, 0, NULL },
+            { "outline_color", "std_msgs.ColorRGBA", false, 0, 0, NULL },
+            { "filled", "byte", true, 0, 0, NULL },
+            { "fill_color", "std_msgs.ColorRGBA", false, 0, 0, NULL },
+            { "lifetime", "std_msgs.Duration", false, 0, 0, NULL },
+            { "points", "geometry_msgs.Point", false, 1, -1, "points_length" },
+            { "outline_colors", "std_msgs.ColorRGBA", false, 1, -1, "outline_colors_length" },
+        }};
+
         // LCM support functions. Users should not call these
         inline int _encodeNoHash(void *buf, int offset, int maxlen) const;
+        template <typename Writer>
+        inline void _writeNoHash(Writer &out) const;
         inline int _getEncodedSizeNoHash() const;
         inline int _decodeNoHash(const void *buf, int offset, int maxlen);
+        template <uint64_t Mask>
+        inline int _decodeFieldsNoHash(const void *buf, int offset, int maxlen);
+        template <typename Self, typename Visitor>
+        inline static void _forEachField(Self &self, Visitor &visitor);
+        inline static int _skipNoHash(const void *buf, int offset, int maxlen);
         inline static uint64_t _computeHash(const __lcm_hash_ptr *p);
 };
 
+static_assert(ImageMarker::kHash == dimos_lcm::fingerprint(
+    dimos_lcm::signature_hash()
+        .member("points_length", "int32_t", 0)
+        .member("outline_colors_length", "int32_t", 0)
+        .member("header", NULL, 0)
+        .member("ns", "string", 0)
+        .member("id", "int32_t", 0)
+        .member("type", "int32_t", 0)
+        .member("action", "int32_t", 0)
+        .member("position", NULL, 0)
+        .member("scale", "float", 0)
+        .member("outline_color", NULL, 0)
+        .member("filled", "byte", 0)
+        .member("fill_color", NULL, 0)
+        .member("lifetime", NULL, 0)
+        .member("points", NULL, 1).dim(true, "points_length")
+        .member("outline_colors", NULL, 1).dim(true, "outline_colors_length")
+        .value(),
+    std_msgs::Header::kHash,
+    geometry_msgs::Point::kHash,
+    std_msgs::ColorRGBA::kHash,
+    std_msgs::ColorRGBA::kHash,
+    std_msgs::Duration::kHash,
+    geometry_msgs::Point::kHash,
+    std_msgs::ColorRGBA::kHash),
+    "visualization_msgs::ImageMarker fingerprint does not match its definition");
+
 int ImageMarker::encode(void *buf, int offset, int maxlen) const
 {
     int pos = 0, tlen;
@@ -159,6 +299,15 @@ int ImageMarker::encode(void *buf, int offset, int maxlen) const
     return pos;
 }
 
+int ImageMarker::encodeTo(std::vector<uint8_t> &buf) const
+{
+    dimos_lcm::vector_writer out(buf);
+    int64_t hash = getHash();
+    out.put(&hash, 1);
+    this->_writeNoHash(out);
+    return static_cast<int>(out.size());
+}
+
 int ImageMarker::decode(const void *buf, int offset, int maxlen)
 {
     int pos = 0, thislen;
@@ -174,6 +323,34 @@ int ImageMarker::decode(const void *buf, int offset, int maxlen)
     return pos;
 }
 
+#if __cplusplus >= 201703L
+int ImageMarker::peekHeader(const void *buf, int offset, int maxlen, std_msgs::HeaderView &header)
+{
+    int64_t msg_hash;
+    if (__int64_t_decode_array(buf, offset, maxlen, &msg_hash, 1) < 0) return -1;
+    if (msg_hash != kHash) return -1;
+
+    // header follows the hash and 8 bytes of fixed-size fields
+    return header._decodeNoHash(buf, offset + 16, maxlen - 16);
+}
+#endif
+
+template <uint64_t Mask>
+int ImageMarker::decodeFields(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, thislen;
+
+    int64_t msg_hash;
+    thislen = __int64_t_decode_array(buf, offset + pos, maxlen - pos, &msg_hash, 1);
+    if (thislen < 0) return thislen; else pos += thislen;
+    if (msg_hash != getHash()) return -1;
+
+    thislen = this->_decodeFieldsNoHash<Mask>(buf, offset + pos, maxlen - pos);
+    if (thislen < 0) return thislen; else pos += thislen;
+
+    return pos;
+}
+
 int ImageMarker::getEncodedSize() const
 {
     return 8 + _getEncodedSizeNoHash();
@@ -181,8 +358,7 @@ int ImageMarker::getEncodedSize() const
 
 int64_t ImageMarker::getHash()
 {
-    static int64_t hash = static_cast<int64_t>(_computeHash(NULL));
-    return hash;
+    return kHash;
 }
 
 const char* ImageMarker::getTypeName()
@@ -248,6 +424,28 @@ int ImageMarker::_encodeNoHash(void *buf, int offset, int maxlen) const
     return pos;
 }
 
+template <typename Writer>
+void ImageMarker::_writeNoHash(Writer &out) const
+{
+    out.put(&this->points_length, 1);
+    out.put(&this->outline_colors_length, 1);
+    this->header._writeNoHash(out);
+    out.put(this->ns);
+    out.put(&this->id, 1);
+    out.put(&this->type, 1);
+    out.put(&this->action, 1);
+    this->position._writeNoHash(out);
+    out.put(&this->scale, 1);
+    this->outline_color._writeNoHash(out);
+    out.put(&this->filled, 1);
+    this->fill_color._writeNoHash(out);
+    this->lifetime._writeNoHash(out);
+    if(this->points_length > 0)
+        out.putStructArray(&this->points[0], this->points_length);
+    if(this->outline_colors_length > 0)
+        out.putStructArray(&this->outline_colors[0], this->outline_colors_length);
+}
+
 int ImageMarker::_decodeNoHash(const void *buf, int offset, int maxlen)
 {
     int pos = 0, tlen;
@@ -265,7 +463,7 @@ int ImageMarker::_decodeNoHash(const void *buf, int offset, int maxlen)
     tlen = __int32_t_decode_array(
         buf, offset + pos, maxlen - pos, &__ns_len__, 1);
     if(tlen < 0) return tlen; else pos += tlen;
-    if(__ns_len__ > maxlen - pos) return -1;
+    if(__ns_len__ < 1 || __ns_len__ > maxlen - pos) return -1;
     this->ns.assign(
         static_cast<const char*>(buf) + offset + pos, __ns_len__ - 1);
     pos += __ns_len__;
@@ -297,6 +495,7 @@ int ImageMarker::_decodeNoHash(const void *buf, int offset, int maxlen)
     tlen = this->lifetime._decodeNoHash(buf, offset + pos, maxlen - pos);
     if(tlen < 0) return tlen; else pos += tlen;
 
+    if(this->points_length < 0 || this->points_length > (maxlen - pos) / 24 || this->points_length > maxArrayLength) return -1;
     try {
         this->points.resize(this->points_length);
     } catch (...) {
@@ -307,6 +506,7 @@ int ImageMarker::_decodeNoHash(const void *buf, int offset, int maxlen)
         if(tlen < 0) return tlen; else pos += tlen;
     }
 
+    if(this->outline_colors_length < 0 || this->outline_colors_length > (maxlen - pos) / 16 || this->outline_colors_length > maxArrayLength) return -1;
     try {
         this->outline_colors.resize(this->outline_colors_length);
     } catch (...) {
@@ -320,6 +520,130 @@ int ImageMarker::_decodeNoHash(const void *buf, int offset, int maxlen)
     return pos;
 }
 
+template <uint64_t Mask>
+int ImageMarker::_decodeFieldsNoHash(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, tlen;
+
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &this->points_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &this->outline_colors_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    if ((Mask & Fields::header) != 0) {
+        tlen = this->header._decodeNoHash(buf, offset + pos, maxlen - pos);
+        if(tlen < 0) return tlen; else pos += tlen;
+    } else {
+        tlen = std_msgs::Header::_skipNoHash(buf, offset + pos, maxlen - pos);
+        if(tlen < 0) return tlen; else pos += tlen;
+    }
+
+    if ((Mask & Fields::ns) != 0) {
+        int32_t __ns_len__;
+        tlen = __int32_t_decode_array(
+            buf, offset + pos, maxlen - pos, &__ns_len__, 1);
+        if(tlen < 0) return tlen; else pos += tlen;
+        if(__ns_len__ < 1 || __ns_len__ > maxlen - pos) return -1;
+        this->ns.assign(
+            static_cast<const char*>(buf) + offset + pos, __ns_len__ - 1);
+        pos += __ns_len__;
+    } else {
+        int32_t __ns_len__;
+        tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &__ns_len__, 1);
+        if(tlen < 0) return tlen; else pos += tlen;
+        if(__ns_len__ < 0 || __ns_len__ > maxlen - pos) return -1;
+        pos += __ns_len__;
+    }
+
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &this->id, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &this->type, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &this->action, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    if ((Mask & Fields::position) != 0) {
+        tlen = this->position._decodeNoHash(buf, offset + pos, maxlen - pos);
+        if(tlen < 0) return tlen; else pos += tlen;
+    } else {
+        tlen = geometry_msgs::Point::_skipNoHash(buf, offset + pos, maxlen - pos);
+        if(tlen < 0) return tlen; else pos += tlen;
+    }
+
+    tlen = __float_decode_array(buf, offset + pos, maxlen - pos, &this->scale, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    if ((Mask & Fields::outline_color) != 0) {
+        tlen = this->outline_color._decodeNoHash(buf, offset + pos, maxlen - pos);
+        if(tlen < 0) return tlen; else pos += tlen;
+    } else {
+        tlen = std_msgs::ColorRGBA::_skipNoHash(buf, offset + pos, maxlen - pos);
+        if(tlen < 0) return tlen; else pos += tlen;
+    }
+
+    tlen = __byte_decode_array(buf, offset + pos, maxlen - pos, &this->filled, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    if ((Mask & Fields::fill_color) != 0) {
+        tlen = this->fill_color._decodeNoHash(buf, offset + pos, maxlen - pos);
+        if(tlen < 0) return tlen; else pos += tlen;
+    } else {
+        tlen = std_msgs::ColorRGBA::_skipNoHash(buf, offset + pos, maxlen - pos);
+        if(tlen < 0) return tlen; else pos += tlen;
+    }
+
+    if ((Mask & Fields::lifetime) != 0) {
+        tlen = this->lifetime._decodeNoHash(buf, offset + pos, maxlen - pos);
+        if(tlen < 0) return tlen; else pos += tlen;
+    } else {
+        tlen = std_msgs::Duration::_skipNoHash(buf, offset + pos, maxlen - pos);
+        if(tlen < 0) return tlen; else pos += tlen;
+    }
+
+    if ((Mask & Fields::points) != 0) {
+        if(this->points_length < 0 || this->points_length > (maxlen - pos) / 24 || this->points_length > maxArrayLength) return -1;
+        try {
+            this->points.resize(this->points_length);
+        } catch (...) {
+            return -1;
+        }
+        for (int a0 = 0; a0 < this->points_length; a0++) {
+            tlen = this->points[a0]._decodeNoHash(buf, offset + pos, maxlen - pos);
+            if(tlen < 0) return tlen; else pos += tlen;
+        }
+    } else {
+        if(this->points_length < 0) return -1;
+        for (int a0 = 0; a0 < this->points_length; a0++) {
+            tlen = geometry_msgs::Point::_skipNoHash(buf, offset + pos, maxlen - pos);
+            if(tlen < 0) return tlen; else pos += tlen;
+        }
+    }
+
+    if ((Mask & Fields::outline_colors) != 0) {
+        if(this->outline_colors_length < 0 || this->outline_colors_length > (maxlen - pos) / 16 || this->outline_colors_length > maxArrayLength) return -1;
+        try {
+            this->outline_colors.resize(this->outline_colors_length);
+        } catch (...) {
+            return -1;
+        }
+        for (int a0 = 0; a0 < this->outline_colors_length; a0++) {
+            tlen = this->outline_colors[a0]._decodeNoHash(buf, offset + pos, maxlen - pos);
+            if(tlen < 0) return tlen; else pos += tlen;
+        }
+    } else {
+        if(this->outline_colors_length < 0) return -1;
+        for (int a0 = 0; a0 < this->outline_colors_length; a0++) {
+            tlen = std_msgs::ColorRGBA::_skipNoHash(buf, offset + pos, maxlen - pos);
+            if(tlen < 0) return tlen; else pos += tlen;
+        }
+    }
+
+    return pos;
+}
+
 int ImageMarker::_getEncodedSizeNoHash() const
 {
     int enc_size = 0;
@@ -345,6 +669,69 @@ int ImageMarker::_getEncodedSizeNoHash() const
     return enc_size;
 }
 
+int ImageMarker::_skipNoHash(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, tlen;
+    int32_t points_length;
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &points_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+    int32_t outline_colors_length;
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &outline_colors_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+    tlen = std_msgs::Header::_skipNoHash(buf, offset + pos, maxlen - pos);
+    if(tlen < 0) return tlen; else pos += tlen;
+    int32_t __ns_len__;
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &__ns_len__, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+    if(__ns_len__ < 0 || __ns_len__ > maxlen - pos) return -1;
+    pos += __ns_len__;
+    pos += 4;
+    pos += 4;
+    pos += 4;
+    tlen = geometry_msgs::Point::_skipNoHash(buf, offset + pos, maxlen - pos);
+    if(tlen < 0) return tlen; else pos += tlen;
+    pos += 4;
+    tlen = std_msgs::ColorRGBA::_skipNoHash(buf, offset + pos, maxlen - pos);
+    if(tlen < 0) return tlen; else pos += tlen;
+    pos += 1;
+    tlen = std_msgs::ColorRGBA::_skipNoHash(buf, offset + pos, maxlen - pos);
+    if(tlen < 0) return tlen; else pos += tlen;
+    tlen = std_msgs::Duration::_skipNoHash(buf, offset + pos, maxlen - pos);
+    if(tlen < 0) return tlen; else pos += tlen;
+    if(points_length < 0) return -1;
+    for (int a0 = 0; a0 < points_length; a0++) {
+        tlen = geometry_msgs::Point::_skipNoHash(buf, offset + pos, maxlen - pos);
+        if(tlen < 0) return tlen; else pos += tlen;
+    }
+    if(outline_colors_length < 0) return -1;
+    for (int a0 = 0; a0 < outline_colors_length; a0++) {
+        tlen = std_msgs::ColorRGBA::_skipNoHash(buf, offset + pos, maxlen - pos);
+        if(tlen < 0) return tlen; else pos += tlen;
+    }
+    if(pos > maxlen) return -1;
+    return pos;
+}
+
+template <typename Self, typename Visitor>
+void ImageMarker::_forEachField(Self &self, Visitor &visitor)
+{
+    visitor(kFields[0], self.points_length);
+    visitor(kFields[1], self.outline_colors_length);
+    visitor(kFields[2], self.header);
+    visitor(kFields[3], self.ns);
+    visitor(kFields[4], self.id);
+    visitor(kFields[5], self.type);
+    visitor(kFields[6], self.action);
+    visitor(kFields[7], self.position);
+    visitor(kFields[8], self.scale);
+    visitor(kFields[9], self.outline_color);
+    visitor(kFields[10], self.filled);
+    visitor(kFields[11], self.fill_color);
+    visitor(kFields[12], self.lifetime);
+    visitor(kFields[13], self.points);
+    visitor(kFields[14], self.outline_colors);
+}
+
 uint64_t ImageMarker::_computeHash(const __lcm_hash_ptr *p)
 {
     const __lcm_hash_ptr *fp;
@@ -1,7 +1,7 @@
 /** THIS IS AN AUTOMATICALLY GENERATED FILE.  DO NOT MODIFY
  * BY HAND!!
  *
- * Generated by lcm-gen 1.5.2
+ * Generated by lcm-cpp (tools/cpp/gen)
  **/
 
 #ifndef __visualization_msgs_InteractiveMarkerInit_hpp__
@@ -9,8 +9,12 @@
 
 #include <lcm/lcm_coretypes.h>
 
+#include <array>
 #include <string>
 #include <vector>
+#include "dimos_lcm/writer.hpp"
+#include "dimos_lcm/fingerprint.hpp"
+#include "dimos_lcm/reflection.hpp"
 #include "visualization_msgs/InteractiveMarker.hpp"
 
 namespace visualization_msgs
@@ -42,6 +46,15 @@ class InteractiveMarkerInit
          */
         inline int encode(void *buf, int offset, int maxlen) const;
 
+        /**
+         * Encode a message by appending it to @p buf, walking the message once
+         * instead of sizing it with getEncodedSize() first. @p buf grows
+         * geometrically; reuse it across calls to avoid reallocating.
+         *
+         * @return The number of bytes appended.
+         */
+        inline int encodeTo(std::vector<uint8_t> &buf) const;
+
         /**
          * Check how many bytes are required to encode this message.
          */
@@ -57,6 +70,43 @@ class InteractiveMarkerInit
          */
         inline int decode(const void *buf, int offset, int maxlen);
 
+        /**
+         * Field bits for decodeFields().
+         */
+        struct Fields
+        {
+            static constexpr uint64_t markers_length = 1ULL << 0;
+            static constexpr uint64_t server_id = 1ULL << 1;
+            static constexpr uint64_t seq_num = 1ULL << 2;
+            static constexpr uint64_t markers = 1ULL << 3;
+            static constexpr uint64_t all = (1ULL << 4) - 1;
+        };
+
+        /**
+         * Decode only the fields selected by @p Mask, a bitwise or of Fields
+         * values. Strings, arrays and nested structs that are not selected are
+         * skipped over by their length prefixes without being allocated, and
+         * keep their previous value. Scalar fields are always decoded: they
+         * cost nothing to read and array lengths depend on them.
+         *
+         * @return The number of bytes decoded, or <0 if an error occured.
+         */
+        template <uint64_t Mask>
+        inline int decodeFields(const void *buf, int offset, int maxlen);
+
+        /**
+         * Upper bound on the length of every variable-length array of this
+         * type, checked by decode() before anything is allocated; messages
+         * exceeding it fail to decode. It does not apply to nested types,
+         * which have their own. Set it once at startup, before decoding.
+         * Before C++17 it is a constant with no limit.
+         */
+#if __cplusplus >= 201703L
+        static inline int32_t maxArrayLength = INT32_MAX;
+#else
+        static constexpr int32_t maxArrayLength = INT32_MAX;
+#endif
+
         /**
          * Retrieve the 64-bit fingerprint identifying the structure of the message.
          * Note that the fingerprint is the same for all instances of the same
@@ -65,18 +115,51 @@ class InteractiveMarkerInit
          */
         inline static int64_t getHash();
 
+        /**
+         * The fingerprint returned by getHash(), as a compile-time constant.
+         */
+        static constexpr int64_t kHash = static_cast<int64_t>(0x8e2e94edfd14536cULL);
+
         /**
          * Returns "InteractiveMarkerInit"
          */
         inline static const char* getTypeName();
 
+        /**
+         * Name, LCM type and array dimensions of each field, in wire order.
+         * See dimos_lcm::for_each_field() for visiting the fields themselves.
+         */
+        static constexpr std::array<dimos_lcm::field_info, 4> kFields = {{
+            { "markers_length", "int32_t", true, 0, 0, NULL },
+            { "server_id", "string", true, 0, 0, NULL },
+            { "seq_num", "int64_t", true, 0, 0, NULL },
+            { "markers", "visualization_msgs.InteractiveMarker", false, 1, -1, "markers_length" },
+        }};
+
         // LCM support functions. Users should not call these
         inline int _encodeNoHash(void *buf, int offset, int maxlen) const;
+        template <typename Writer>
+        inline void _writeNoHash(Writer &out) const;
         inline int _getEncodedSizeNoHash() const;
         inline int _decodeNoHash(const void *buf, int offset, int maxlen);
+        template <uint64_t Mask>
+        inline int _decodeFieldsNoHash(const void *buf, int offset, int maxlen);
+        template <typename Self, typename Visitor>
+        inline static void _forEachField(Self &self, Visitor &visitor);
+        inline static int _skipNoHash(const void *buf, int offset, int maxlen);
         inline static uint64_t _computeHash(const __lcm_hash_ptr *p);
 };
 
+static_assert(InteractiveMarkerInit::kHash == dimos_lcm::fingerprint(
+    dimos_lcm::signature_hash()
+        .member("markers_length", "int32_t", 0)
+        .member("server_id", "string", 0)
+        .member("seq_num", "int64_t", 0)
+        .member("markers", NULL, 1).dim(true, "markers_length")
+        .value(),
+    visualization_msgs::InteractiveMarker::kHash),
+    "visualization_msgs::InteractiveMarkerInit fingerprint does not match its definition");
+
 int InteractiveMarkerInit::encode(void *buf, int offset, int maxlen) const
 {
     int pos = 0, tlen;
@@ -91,6 +174,15 @@ int InteractiveMarkerInit::encode(void *buf, int offset, int maxlen) const
     return pos;
 }
 
+int InteractiveMarkerInit::encodeTo(std::vector<uint8_t> &buf) const
+{
+    dimos_lcm::vector_writer out(buf);
+    int64_t hash = getHash();
+    out.put(&hash, 1);
+    this->_writeNoHash(out);
+    return static_cast<int>(out.size());
+}
+
 int InteractiveMarkerInit::decode(const void *buf, int offset, int maxlen)
 {
     int pos = 0, thislen;
@@ -106,6 +198,22 @@ int InteractiveMarkerInit::decode(const void *buf, int offset, int maxlen)
     return pos;
 }
 
+template <uint64_t Mask>
+int InteractiveMarkerInit::decodeFields(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, thislen;
+
+    int64_t msg_hash;
+    thislen = __int64_t_decode_array(buf, offset + pos, maxlen - pos, &msg_hash, 1);
+    if (thislen < 0) return thislen; else pos += thislen;
+    if (msg_hash != getHash()) return -1;
+
+    thislen = this->_decodeFieldsNoHash<Mask>(buf, offset + pos, maxlen - pos);
+    if (thislen < 0) return thislen; else pos += thislen;
+
+    return pos;
+}
+
 int InteractiveMarkerInit::getEncodedSize() const
 {
     return 8 + _getEncodedSizeNoHash();
@@ -113,8 +221,7 @@ int InteractiveMarkerInit::getEncodedSize() const
 
 int64_t InteractiveMarkerInit::getHash()
 {
-    static int64_t hash = static_cast<int64_t>(_computeHash(NULL));
-    return hash;
+    return kHash;
 }
 
 const char* InteractiveMarkerInit::getTypeName()
@@ -145,6 +252,16 @@ int InteractiveMarkerInit::_encodeNoHash(void *buf, int offset, int maxlen) cons
     return pos;
 }
 
+template <typename Writer>
+void InteractiveMarkerInit::_writeNoHash(Writer &out) const
+{
+    out.put(&this->markers_length, 1);
+    out.put(this->server_id);
+    out.put(&this->seq_num, 1);
+    for (int a0 = 0; a0 < this->markers_length; a0++)
+        this->markers[a0]._writeNoHash(out);
+}
+
 int InteractiveMarkerInit::_decodeNoHash(const void *buf, int offset, int maxlen)
 {
     int pos = 0, tlen;
@@ -156,7 +273,7 @@ int InteractiveMarkerInit::_decodeNoHash(const void *buf, int offset, int maxlen
     tlen = __int32_t_decode_array(
         buf, offset + pos, maxlen - pos, &__server_id_len__, 1);
     if(tlen < 0) return tlen; else pos += tlen;
-    if(__server_id_len__ > maxlen - pos) return -1;
+    if(__server_id_len__ < 1 || __server_id_len__ > maxlen - pos) return -1;
     this->server_id.assign(
         static_cast<const char*>(buf) + offset + pos, __server_id_len__ - 1);
     pos += __server_id_len__;
@@ -164,6 +281,7 @@ int InteractiveMarkerInit::_decodeNoHash(const void *buf, int offset, int maxlen
     tlen = __int64_t_decode_array(buf, offset + pos, maxlen - pos, &this->seq_num, 1);
     if(tlen < 0) return tlen; else pos += tlen;
 
+    if(this->markers_length < 0 || this->markers_length > (maxlen - pos) / 95 || this->markers_length > maxArrayLength) return -1;
     try {
         this->markers.resize(this->markers_length);
     } catch (...) {
@@ -177,6 +295,56 @@ int InteractiveMarkerInit::_decodeNoHash(const void *buf, int offset, int maxlen
     return pos;
 }
 
+template <uint64_t Mask>
+int InteractiveMarkerInit::_decodeFieldsNoHash(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, tlen;
+
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &this->markers_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    if ((Mask & Fields::server_id) != 0) {
+        int32_t __server_id_len__;
+        tlen = __int32_t_decode_array(
+            buf, offset + pos, maxlen - pos, &__server_id_len__, 1);
+        if(tlen < 0) return tlen; else pos += tlen;
+        if(__server_id_len__ < 1 || __server_id_len__ > maxlen - pos) return -1;
+        this->server_id.assign(
+            static_cast<const char*>(buf) + offset + pos, __server_id_len__ - 1);
+        pos += __server_id_len__;
+    } else {
+        int32_t __server_id_len__;
+        tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &__server_id_len__, 1);
+        if(tlen < 0) return tlen; else pos += tlen;
+        if(__server_id_len__ < 0 || __server_id_len__ > maxlen - pos) return -1;
+        pos += __server_id_len__;
+    }
+
+    tlen = __int64_t_decode_array(buf, offset + pos, maxlen - pos, &this->seq_num, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    if ((Mask & Fields::markers) != 0) {
+        if(this->markers_length < 0 || this->markers_length > (maxlen - pos) / 95 || this->markers_length > maxArrayLength) return -1;
+        try {
+            this->markers.resize(this->markers_length);
+        } catch (...) {
+            return -1;
+        }
+        for (int a0 = 0; a0 < this->markers_length; a0++) {
+            tlen = this->markers[a0]._decodeNoHash(buf, offset + pos, maxlen - pos);
+            if(tlen < 0) return tlen; else pos += tlen;
+        }
+    } else {
+        if(this->markers_length < 0) return -1;
+        for (int a0 = 0; a0 < this->markers_length; a0++) {
+            tlen = visualization_msgs::InteractiveMarker::_skipNoHash(buf, offset + pos, maxlen - pos);
+            if(tlen < 0) return tlen; else pos += tlen;
+        }
+    }
+
+    return pos;
+}
+
 int InteractiveMarkerInit::_getEncodedSizeNoHash() const
 {
     int enc_size = 0;
@@ -189,6 +357,36 @@ int InteractiveMarkerInit::_getEncodedSizeNoHash() const
     return enc_size;
 }
 
+int InteractiveMarkerInit::_skipNoHash(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, tlen;
+    int32_t markers_length;
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &markers_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+    int32_t __server_id_len__;
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &__server_id_len__, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+    if(__server_id_len__ < 0 || __server_id_len__ > maxlen - pos) return -1;
+    pos += __server_id_len__;
+    pos += 8;
+    if(markers_length < 0) return -1;
+    for (int a0 = 0; a0 < markers_length; a0++) {
+        tlen = visualization_msgs::InteractiveMarker::_skipNoHash(buf, offset + pos, maxlen - pos);
+        if(tlen < 0) return tlen; else pos += tlen;
+    }
+    if(pos > maxlen) return -1;
+    return pos;
+}
+
+template <typename Self, typename Visitor>
+void InteractiveMarkerInit::_forEachField(Self &self, Visitor &visitor)
+{
+    visitor(kFields[0], self.markers_length);
+    visitor(kFields[1], self.server_id);
+    visitor(kFields[2], self.seq_num);
+    visitor(kFields[3], self.markers);
+}
+
 uint64_t InteractiveMarkerInit::_computeHash(const __lcm_hash_ptr *p)
 {
     const __lcm_hash_ptr *fp;
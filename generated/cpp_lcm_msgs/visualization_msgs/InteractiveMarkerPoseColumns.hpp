@@ -0,0 +1,255 @@
+/** THIS IS AN AUTOMATICALLY GENERATED FILE.  DO NOT MODIFY
+ * BY HAND!!
+ *
+ * Generated by lcm-cpp (tools/cpp/gen)
+ **/
+
+#ifndef __visualization_msgs_InteractiveMarkerPoseColumns_hpp__
+#define __visualization_msgs_InteractiveMarkerPoseColumns_hpp__
+
+#include <lcm/lcm_coretypes.h>
+
+#include <string>
+#include <vector>
+#include "dimos_lcm/fixed_codec.hpp"
+#include "visualization_msgs/InteractiveMarkerPose.hpp"
+
+namespace visualization_msgs
+{
+
+/**
+ * Structure-of-arrays storage for a sequence of visualization_msgs.InteractiveMarkerPose: one
+ * contiguous array per field, with nested fields flattened and named by their
+ * path (header_seq, header_stamp_sec, ...). The soa:: message classes hold their
+ * InteractiveMarkerPose arrays this way and decode them straight into the columns.
+ */
+class InteractiveMarkerPoseColumns
+{
+    public:
+        // header.seq
+        std::vector< int32_t > header_seq;
+
+        // header.stamp.sec
+        std::vector< int32_t > header_stamp_sec;
+
+        // header.stamp.nsec
+        std::vector< int32_t > header_stamp_nsec;
+
+        // header.frame_id
+        std::vector< std::string > header_frame_id;
+
+        // pose.position.x
+        std::vector< double > pose_position_x;
+
+        // pose.position.y
+        std::vector< double > pose_position_y;
+
+        // pose.position.z
+        std::vector< double > pose_position_z;
+
+        // pose.orientation.x
+        std::vector< double > pose_orientation_x;
+
+        // pose.orientation.y
+        std::vector< double > pose_orientation_y;
+
+        // pose.orientation.z
+        std::vector< double > pose_orientation_z;
+
+        // pose.orientation.w
+        std::vector< double > pose_orientation_w;
+
+        std::vector< std::string > name;
+
+    public:
+        /**
+         * Number of elements.
+         */
+        inline int size() const;
+
+        /**
+         * Resize every column to @p n elements.
+         */
+        inline void resize(int n);
+
+        /**
+         * Gather element @p i into a InteractiveMarkerPose.
+         */
+        inline visualization_msgs::InteractiveMarkerPose get(int i) const;
+
+        /**
+         * Scatter @p msg into element @p i.
+         */
+        inline void set(int i, const visualization_msgs::InteractiveMarkerPose &msg);
+
+        // LCM support functions. Users should not call these
+        inline int _encodeNoHash(void *buf, int offset, int maxlen, int n) const;
+        template <typename Writer>
+        inline void _writeNoHash(Writer &out, int n) const;
+        inline int _getEncodedSizeNoHash(int n) const;
+        inline int _decodeNoHash(const void *buf, int offset, int maxlen, int n);
+};
+
+int InteractiveMarkerPoseColumns::size() const
+{
+    return static_cast<int>(this->header_seq.size());
+}
+
+void InteractiveMarkerPoseColumns::resize(int n)
+{
+    this->header_seq.resize(n);
+    this->header_stamp_sec.resize(n);
+    this->header_stamp_nsec.resize(n);
+    this->header_frame_id.resize(n);
+    this->pose_position_x.resize(n);
+    this->pose_position_y.resize(n);
+    this->pose_position_z.resize(n);
+    this->pose_orientation_x.resize(n);
+    this->pose_orientation_y.resize(n);
+    this->pose_orientation_z.resize(n);
+    this->pose_orientation_w.resize(n);
+    this->name.resize(n);
+}
+
+visualization_msgs::InteractiveMarkerPose InteractiveMarkerPoseColumns::get(int i) const
+{
+    visualization_msgs::InteractiveMarkerPose msg;
+    msg.header.seq = this->header_seq[i];
+    msg.header.stamp.sec = this->header_stamp_sec[i];
+    msg.header.stamp.nsec = this->header_stamp_nsec[i];
+    msg.header.frame_id = this->header_frame_id[i];
+    msg.pose.position.x = this->pose_position_x[i];
+    msg.pose.position.y = this->pose_position_y[i];
+    msg.pose.position.z = this->pose_position_z[i];
+    msg.pose.orientation.x = this->pose_orientation_x[i];
+    msg.pose.orientation.y = this->pose_orientation_y[i];
+    msg.pose.orientation.z = this->pose_orientation_z[i];
+    msg.pose.orientation.w = this->pose_orientation_w[i];
+    msg.name = this->name[i];
+    return msg;
+}
+
+void InteractiveMarkerPoseColumns::set(int i, const visualization_msgs::InteractiveMarkerPose &msg)
+{
+    this->header_seq[i] = msg.header.seq;
+    this->header_stamp_sec[i] = msg.header.stamp.sec;
+    this->header_stamp_nsec[i] = msg.header.stamp.nsec;
+    this->header_frame_id[i] = msg.header.frame_id;
+    this->pose_position_x[i] = msg.pose.position.x;
+    this->pose_position_y[i] = msg.pose.position.y;
+    this->pose_position_z[i] = msg.pose.position.z;
+    this->pose_orientation_x[i] = msg.pose.orientation.x;
+    this->pose_orientation_y[i] = msg.pose.orientation.y;
+    this->pose_orientation_z[i] = msg.pose.orientation.z;
+    this->pose_orientation_w[i] = msg.pose.orientation.w;
+    this->name[i] = msg.name;
+}
+
+int InteractiveMarkerPoseColumns::_encodeNoHash(void *buf, int offset, int maxlen, int n) const
+{
+    uint8_t *p = static_cast<uint8_t*>(buf) + offset;
+    int pos = 0;
+    for (int i = 0; i < n; i++) {
+        if(maxlen - pos < 12) return -1;
+        dimos_lcm::store_be(p + pos + 0, this->header_seq[i]);
+        dimos_lcm::store_be(p + pos + 4, this->header_stamp_sec[i]);
+        dimos_lcm::store_be(p + pos + 8, this->header_stamp_nsec[i]);
+        pos += 12;
+        int32_t __header_frame_id_len__ = static_cast<int32_t>(this->header_frame_id[i].size()) + 1;
+        if(maxlen - pos < 4 || __header_frame_id_len__ > maxlen - pos - 4) return -1;
+        dimos_lcm::store_be(p + pos, __header_frame_id_len__);
+        memcpy(p + pos + 4, this->header_frame_id[i].c_str(), __header_frame_id_len__);
+        pos += 4 + __header_frame_id_len__;
+        if(maxlen - pos < 56) return -1;
+        dimos_lcm::store_be(p + pos + 0, this->pose_position_x[i]);
+        dimos_lcm::store_be(p + pos + 8, this->pose_position_y[i]);
+        dimos_lcm::store_be(p + pos + 16, this->pose_position_z[i]);
+        dimos_lcm::store_be(p + pos + 24, this->pose_orientation_x[i]);
+        dimos_lcm::store_be(p + pos + 32, this->pose_orientation_y[i]);
+        dimos_lcm::store_be(p + pos + 40, this->pose_orientation_z[i]);
+        dimos_lcm::store_be(p + pos + 48, this->pose_orientation_w[i]);
+        pos += 56;
+        int32_t __name_len__ = static_cast<int32_t>(this->name[i].size()) + 1;
+        if(maxlen - pos < 4 || __name_len__ > maxlen - pos - 4) return -1;
+        dimos_lcm::store_be(p + pos, __name_len__);
+        memcpy(p + pos + 4, this->name[i].c_str(), __name_len__);
+        pos += 4 + __name_len__;
+    }
+    return pos;
+}
+
+template <typename Writer>
+void InteractiveMarkerPoseColumns::_writeNoHash(Writer &out, int n) const
+{
+    for (int i = 0; i < n; i++) {
+        {
+            uint8_t *p = out.extend(12);
+            dimos_lcm::store_be(p + 0, this->header_seq[i]);
+            dimos_lcm::store_be(p + 4, this->header_stamp_sec[i]);
+            dimos_lcm::store_be(p + 8, this->header_stamp_nsec[i]);
+        }
+        out.put(this->header_frame_id[i]);
+        {
+            uint8_t *p = out.extend(56);
+            dimos_lcm::store_be(p + 0, this->pose_position_x[i]);
+            dimos_lcm::store_be(p + 8, this->pose_position_y[i]);
+            dimos_lcm::store_be(p + 16, this->pose_position_z[i]);
+            dimos_lcm::store_be(p + 24, this->pose_orientation_x[i]);
+            dimos_lcm::store_be(p + 32, this->pose_orientation_y[i]);
+            dimos_lcm::store_be(p + 40, this->pose_orientation_z[i]);
+            dimos_lcm::store_be(p + 48, this->pose_orientation_w[i]);
+        }
+        out.put(this->name[i]);
+    }
+}
+
+int InteractiveMarkerPoseColumns::_getEncodedSizeNoHash(int n) const
+{
+    int size = n * 78;
+    for (int i = 0; i < n; i++)
+        size += this->header_frame_id[i].size() + this->name[i].size();
+    return size;
+}
+
+int InteractiveMarkerPoseColumns::_decodeNoHash(const void *buf, int offset, int maxlen, int n)
+{
+    if(n < 0 || n > maxlen / 78) return -1;
+    this->resize(n);
+    const uint8_t *p = static_cast<const uint8_t*>(buf) + offset;
+    int pos = 0;
+    for (int i = 0; i < n; i++) {
+        if(maxlen - pos < 12) return -1;
+        dimos_lcm::load_be(p + pos + 0, this->header_seq[i]);
+        dimos_lcm::load_be(p + pos + 4, this->header_stamp_sec[i]);
+        dimos_lcm::load_be(p + pos + 8, this->header_stamp_nsec[i]);
+        pos += 12;
+        int32_t __header_frame_id_len__;
+        if(maxlen - pos < 4) return -1;
+        dimos_lcm::load_be(p + pos, __header_frame_id_len__);
+        pos += 4;
+        if(__header_frame_id_len__ < 1 || __header_frame_id_len__ > maxlen - pos) return -1;
+        this->header_frame_id[i].assign(reinterpret_cast<const char*>(p) + pos, __header_frame_id_len__ - 1);
+        pos += __header_frame_id_len__;
+        if(maxlen - pos < 56) return -1;
+        dimos_lcm::load_be(p + pos + 0, this->pose_position_x[i]);
+        dimos_lcm::load_be(p + pos + 8, this->pose_position_y[i]);
+        dimos_lcm::load_be(p + pos + 16, this->pose_position_z[i]);
+        dimos_lcm::load_be(p + pos + 24, this->pose_orientation_x[i]);
+        dimos_lcm::load_be(p + pos + 32, this->pose_orientation_y[i]);
+        dimos_lcm::load_be(p + pos + 40, this->pose_orientation_z[i]);
+        dimos_lcm::load_be(p + pos + 48, this->pose_orientation_w[i]);
+        pos += 56;
+        int32_t __name_len__;
+        if(maxlen - pos < 4) return -1;
+        dimos_lcm::load_be(p + pos, __name_len__);
+        pos += 4;
+        if(__name_len__ < 1 || __name_len__ > maxlen - pos) return -1;
+        this->name[i].assign(reinterpret_cast<const char*>(p) + pos, __name_len__ - 1);
+        pos += __name_len__;
+    }
+    return pos;
+}
+
+}
+
+#endif
@@ -1,7 +1,7 @@
 /** THIS IS AN AUTOMATICALLY GENERATED FILE.  DO NOT MODIFY
  * BY HAND!!
  *
- * Generated by lcm-gen 1.5.2
+ * Generated by lcm-cpp (tools/cpp/gen)
  **/
 
 #ifndef __visualization_msgs_MarkerArray_hpp__
@@ -9,7 +9,11 @@
 
 #include <lcm/lcm_coretypes.h>
 
+#include <array>
 #include <vector>
+#include "dimos_lcm/writer.hpp"
+#include "dimos_lcm/fingerprint.hpp"
+#include "dimos_lcm/reflection.hpp"
 #include "visualization_msgs/Marker.hpp"
 
 namespace visualization_msgs
@@ -37,6 +41,15 @@ class MarkerArray
          */
         inline int encode(void *buf, int offset, int maxlen) const;
 
+        /**
+         * Encode a message by appending it to @p buf, walking the message once
+         * instead of sizing it with getEncodedSize() first. @p buf grows
+         * geometrically; reuse it across calls to avoid reallocating.
+         *
+         * @return The number of bytes appended.
+         */
+        inline int encodeTo(std::vector<uint8_t> &buf) const;
+
         /**
          * Check how many bytes are required to encode this message.
          */
@@ -52,6 +65,41 @@ class MarkerArray
          */
         inline int decode(const void *buf, int offset, int maxlen);
 
+        /**
+         * Field bits for decodeFields().
+         */
+        struct Fields
+        {
+            static constexpr uint64_t markers_length = 1ULL << 0;
+            static constexpr uint64_t markers = 1ULL << 1;
+            static constexpr uint64_t all = (1ULL << 2) - 1;
+        };
+
+        /**
+         * Decode only the fields selected by @p Mask, a bitwise or of Fields
+         * values. Strings, arrays and nested structs that are not selected are
+         * skipped over by their length prefixes without being allocated, and
+         * keep their previous value. Scalar fields are always decoded: they
+         * cost nothing to read and array lengths depend on them.
+         *
+         * @return The number of bytes decoded, or <0 if an error occured.
+         */
+        template <uint64_t Mask>
+        inline int decodeFields(const void *buf, int offset, int maxlen);
+
+        /**
+         * Upper bound on the length of every variable-length array of this
+         * type, checked by decode() before anything is allocated; messages
+         * exceeding it fail to decode. It does not apply to nested types,
+         * which have their own. Set it once at startup, before decoding.
+         * Before C++17 it is a constant with no limit.
+         */
+#if __cplusplus >= 201703L
+        static inline int32_t maxArrayLength = INT32_MAX;
+#else
+        static constexpr int32_t maxArrayLength = INT32_MAX;
+#endif
+
         /**
          * Retrieve the 64-bit fingerprint identifying the structure of the message.
          * Note that the fingerprint is the same for all instances of the same
@@ -60,18 +108,47 @@ class MarkerArray
          */
         inline static int64_t getHash();
 
+        /**
+         * The fingerprint returned by getHash(), as a compile-time constant.
+         */
+        static constexpr int64_t kHash = static_cast<int64_t>(0x9cf4d95891a43112ULL);
+
         /**
          * Returns "MarkerArray"
          */
         inline static const char* getTypeName();
 
+        /**
+         * Name, LCM type and array dimensions of each field, in wire order.
+         * See dimos_lcm::for_each_field() for visiting the fields themselves.
+         */
+        static constexpr std::array<dimos_lcm::field_info, 2> kFields = {{
+            { "markers_length", "int32_t", true, 0, 0, NULL },
+            { "markers", "visualization_msgs.Marker", false, 1, -1, "markers_length" },
+        }};
+
         // LCM support functions. Users should not call these
         inline int _encodeNoHash(void *buf, int offset, int maxlen) const;
+        template <typename Writer>
+        inline void _writeNoHash(Writer &out) const;
         inline int _getEncodedSizeNoHash() const;
         inline int _decodeNoHash(const void *buf, int offset, int maxlen);
+        template <uint64_t Mask>
+        inline int _decodeFieldsNoHash(const void *buf, int offset, int maxlen);
+        template <typename Self, typename Visitor>
+        inline static void _forEachField(Self &self, Visitor &visitor);
+        inline static int _skipNoHash(const void *buf, int offset, int maxlen);
         inline static uint64_t _computeHash(const __lcm_hash_ptr *p);
 };
 
+static_assert(MarkerArray::kHash == dimos_lcm::fingerprint(
+    dimos_lcm::signature_hash()
+        .member("markers_length", "int32_t", 0)
+        .member("markers", NULL, 1).dim(true, "markers_length")
+        .value(),
+    visualization_msgs::Marker::kHash),
+    "visualization_msgs::MarkerArray fingerprint does not match its definition");
+
 int MarkerArray::encode(void *buf, int offset, int maxlen) const
 {
     int pos = 0, tlen;
@@ -86,6 +163,15 @@ int MarkerArray::encode(void *buf, int offset, int maxlen) const
     return pos;
 }
 
+int MarkerArray::encodeTo(std::vector<uint8_t> &buf) const
+{
+    dimos_lcm::vector_writer out(buf);
+    int64_t hash = getHash();
+    out.put(&hash, 1);
+    this->_writeNoHash(out);
+    return static_cast<int>(out.size());
+}
+
 int MarkerArray::decode(const void *buf, int offset, int maxlen)
 {
     int pos = 0, thislen;
@@ -101,6 +187,22 @@ int MarkerArray::decode(const void *buf, int offset, int maxlen)
     return pos;
 }
 
+template <uint64_t Mask>
+int MarkerArray::decodeFields(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, thislen;
+
+    int64_t msg_hash;
+    thislen = __int64_t_decode_array(buf, offset + pos, maxlen - pos, &msg_hash, 1);
+    if (thislen < 0) return thislen; else pos += thislen;
+    if (msg_hash != getHash()) return -1;
+
+    thislen = this->_decodeFieldsNoHash<Mask>(buf, offset + pos, maxlen - pos);
+    if (thislen < 0) return thislen; else pos += thislen;
+
+    return pos;
+}
+
 int MarkerArray::getEncodedSize() const
 {
     return 8 + _getEncodedSizeNoHash();
@@ -108,8 +210,7 @@ int MarkerArray::getEncodedSize() const
 
 int64_t MarkerArray::getHash()
 {
-    static int64_t hash = static_cast<int64_t>(_computeHash(NULL));
-    return hash;
+    return kHash;
 }
 
 const char* MarkerArray::getTypeName()
@@ -132,6 +233,14 @@ int MarkerArray::_encodeNoHash(void *buf, int offset, int maxlen) const
     return pos;
 }
 
+template <typename Writer>
+void MarkerArray::_writeNoHash(Writer &out) const
+{
+    out.put(&this->markers_length, 1);
+    for (int a0 = 0; a0 < this->markers_length; a0++)
+        this->markers[a0]._writeNoHash(out);
+}
+
 int MarkerArray::_decodeNoHash(const void *buf, int offset, int maxlen)
 {
     int pos = 0, tlen;
@@ -139,6 +248,7 @@ int MarkerArray::_decodeNoHash(const void *buf, int offset, int maxlen)
     tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &this->markers_length, 1);
     if(tlen < 0) return tlen; else pos += tlen;
 
+    if(this->markers_length < 0 || this->markers_length > (maxlen - pos) / 158 || this->markers_length > maxArrayLength) return -1;
     try {
         this->markers.resize(this->markers_length);
     } catch (...) {
@@ -152,6 +262,36 @@ int MarkerArray::_decodeNoHash(const void *buf, int offset, int maxlen)
     return pos;
 }
 
+template <uint64_t Mask>
+int MarkerArray::_decodeFieldsNoHash(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, tlen;
+
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &this->markers_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    if ((Mask & Fields::markers) != 0) {
+        if(this->markers_length < 0 || this->markers_length > (maxlen - pos) / 158 || this->markers_length > maxArrayLength) return -1;
+        try {
+            this->markers.resize(this->markers_length);
+        } catch (...) {
+            return -1;
+        }
+        for (int a0 = 0; a0 < this->markers_length; a0++) {
+            tlen = this->markers[a0]._decodeNoHash(buf, offset + pos, maxlen - pos);
+            if(tlen < 0) return tlen; else pos += tlen;
+        }
+    } else {
+        if(this->markers_length < 0) return -1;
+        for (int a0 = 0; a0 < this->markers_length; a0++) {
+            tlen = visualization_msgs::Marker::_skipNoHash(buf, offset + pos, maxlen - pos);
+            if(tlen < 0) return tlen; else pos += tlen;
+        }
+    }
+
+    return pos;
+}
+
 int MarkerArray::_getEncodedSizeNoHash() const
 {
     int enc_size = 0;
@@ -162,6 +302,28 @@ int MarkerArray::_getEncodedSizeNoHash() const
     return enc_size;
 }
 
+int MarkerArray::_skipNoHash(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, tlen;
+    int32_t markers_length;
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &markers_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+    if(markers_length < 0) return -1;
+    for (int a0 = 0; a0 < markers_length; a0++) {
+        tlen = visualization_msgs::Marker::_skipNoHash(buf, offset + pos, maxlen - pos);
+        if(tlen < 0) return tlen; else pos += tlen;
+    }
+    if(pos > maxlen) return -1;
+    return pos;
+}
+
+template <typename Self, typename Visitor>
+void MarkerArray::_forEachField(Self &self, Visitor &visitor)
+{
+    visitor(kFields[0], self.markers_length);
+    visitor(kFields[1], self.markers);
+}
+
 uint64_t MarkerArray::_computeHash(const __lcm_hash_ptr *p)
 {
     const __lcm_hash_ptr *fp;
@@ -0,0 +1,602 @@
+/** THIS IS AN AUTOMATICALLY GENERATED FILE.  DO NOT MODIFY
+ * BY HAND!!
+ *
+ * Generated by lcm-cpp (tools/cpp/gen)
+ **/
+
+#ifndef __visualization_msgs_interned_InteractiveMarkerControl_hpp__
+#define __visualization_msgs_interned_InteractiveMarkerControl_hpp__
+
+#include <lcm/lcm_coretypes.h>
+
+#include <array>
+#include <string>
+#include <vector>
+#include "dimos_lcm/interned_string.hpp"
+#include "dimos_lcm/writer.hpp"
+#include "dimos_lcm/fingerprint.hpp"
+#include "dimos_lcm/reflection.hpp"
+#include "geometry_msgs/Quaternion.hpp"
+#include "visualization_msgs/interned/Marker.hpp"
+
+namespace visualization_msgs
+{
+namespace interned
+{
+
+class InteractiveMarkerControl
+{
+    public:
+        int32_t    markers_length;
+
+        dimos_lcm::interned_string name;
+
+        geometry_msgs::Quaternion orientation;
+
+        uint8_t    orientation_mode;
+
+        uint8_t    interaction_mode;
+
+        int8_t     always_visible;
+
+        /**
+         * LCM Type: visualization_msgs.Marker[markers_length]
+         */
+        std::vector< visualization_msgs::interned::Marker > markers;
+
+        int8_t     independent_marker_orientation;
+
+        std::string description;
+
+    public:
+        // If you're using C++11 and are getting compiler errors saying
+        // things like ‘constexpr’ needed for in-class initialization of
+        // static data member then re-run lcm-gen with '--cpp-std=c++11'
+        // to generate code that is compliant with C++11
+        static const int8_t   INHERIT = 0;
+        // If you're using C++11 and are getting compiler errors saying
+        // things like ‘constexpr’ needed for in-class initialization of
+        // static data member then re-run lcm-gen with '--cpp-std=c++11'
+        // to generate code that is compliant with C++11
+        static const int8_t   FIXED = 1;
+        // If you're using C++11 and are getting compiler errors saying
+        // things like ‘constexpr’ needed for in-class initialization of
+        // static data member then re-run lcm-gen with '--cpp-std=c++11'
+        // to generate code that is compliant with C++11
+        static const int8_t   VIEW_FACING = 2;
+        // If you're using C++11 and are getting compiler errors saying
+        // things like ‘constexpr’ needed for in-class initialization of
+        // static data member then re-run lcm-gen with '--cpp-std=c++11'
+        // to generate code that is compliant with C++11
+        static const int8_t   NONE = 0;
+        // If you're using C++11 and are getting compiler errors saying
+        // things like ‘constexpr’ needed for in-class initialization of
+        // static data member then re-run lcm-gen with '--cpp-std=c++11'
+        // to generate code that is compliant with C++11
+        static const int8_t   MENU = 1;
+        // If you're using C++11 and are getting compiler errors saying
+        // things like ‘constexpr’ needed for in-class initialization of
+        // static data member then re-run lcm-gen with '--cpp-std=c++11'
+        // to generate code that is compliant with C++11
+        static const int8_t   BUTTON = 2;
+        // If you're using C++11 and are getting compiler errors saying
+        // things like ‘constexpr’ needed for in-class initialization of
+        // static data member then re-run lcm-gen with '--cpp-std=c++11'
+        // to generate code that is compliant with C++11
+        static const int8_t   MOVE_AXIS = 3;
+        // If you're using C++11 and are getting compiler errors saying
+        // things like ‘constexpr’ needed for in-class initialization of
+        // static data member then re-run lcm-gen with '--cpp-std=c++11'
+        // to generate code that is compliant with C++11
+        static const int8_t   MOVE_PLANE = 4;
+        // If you're using C++11 and are getting compiler errors saying
+        // things like ‘constexpr’ needed for in-class initialization of
+        // static data member then re-run lcm-gen with '--cpp-std=c++11'
+        // to generate code that is compliant with C++11
+        static const int8_t   ROTATE_AXIS = 5;
+        // If you're using C++11 and are getting compiler errors saying
+        // things like ‘constexpr’ needed for in-class initialization of
+        // static data member then re-run lcm-gen with '--cpp-std=c++11'
+        // to generate code that is compliant with C++11
+        static const int8_t   MOVE_ROTATE = 6;
+        // If you're using C++11 and are getting compiler errors saying
+        // things like ‘constexpr’ needed for in-class initialization of
+        // static data member then re-run lcm-gen with '--cpp-std=c++11'
+        // to generate code that is compliant with C++11
+        static const int8_t   MOVE_3D = 7;
+        // If you're using C++11 and are getting compiler errors saying
+        // things like ‘constexpr’ needed for in-class initialization of
+        // static data member then re-run lcm-gen with '--cpp-std=c++11'
+        // to generate code that is compliant with C++11
+        static const int8_t   ROTATE_3D = 8;
+        // If you're using C++11 and are getting compiler errors saying
+        // things like ‘constexpr’ needed for in-class initialization of
+        // static data member then re-run lcm-gen with '--cpp-std=c++11'
+        // to generate code that is compliant with C++11
+        static const int8_t   MOVE_ROTATE_3D = 9;
+
+    public:
+        /**
+         * Encode a message into binary form.
+         *
+         * @param buf The output buffer.
+         * @param offset Encoding starts at thie byte offset into @p buf.
+         * @param maxlen Maximum number of bytes to write.  This should generally be
+         *  equal to getEncodedSize().
+         * @return The number of bytes encoded, or <0 on error.
+         */
+        inline int encode(void *buf, int offset, int maxlen) const;
+
+        /**
+         * Encode a message by appending it to @p buf, walking the message once
+         * instead of sizing it with getEncodedSize() first. @p buf grows
+         * geometrically; reuse it across calls to avoid reallocating.
+         *
+         * @return The number of bytes appended.
+         */
+        inline int encodeTo(std::vector<uint8_t> &buf) const;
+
+        /**
+         * Check how many bytes are required to encode this message.
+         */
+        inline int getEncodedSize() const;
+
+        /**
+         * Decode a message from binary form into this instance.
+         *
+         * @param buf The buffer containing the encoded message.
+         * @param offset The byte offset into @p buf where the encoded message starts.
+         * @param maxlen The maximum number of bytes to read while decoding.
+         * @return The number of bytes decoded, or <0 if an error occured.
+         */
+        inline int decode(const void *buf, int offset, int maxlen);
+
+        /**
+         * Field bits for decodeFields().
+         */
+        struct Fields
+        {
+            static constexpr uint64_t markers_length = 1ULL << 0;
+            static constexpr uint64_t name = 1ULL << 1;
+            static constexpr uint64_t orientation = 1ULL << 2;
+            static constexpr uint64_t orientation_mode = 1ULL << 3;
+            static constexpr uint64_t interaction_mode = 1ULL << 4;
+            static constexpr uint64_t always_visible = 1ULL << 5;
+            static constexpr uint64_t markers = 1ULL << 6;
+            static constexpr uint64_t independent_marker_orientation = 1ULL << 7;
+            static constexpr uint64_t description = 1ULL << 8;
+            static constexpr uint64_t all = (1ULL << 9) - 1;
+        };
+
+        /**
+         * Decode only the fields selected by @p Mask, a bitwise or of Fields
+         * values. Strings, arrays and nested structs that are not selected are
+         * skipped over by their length prefixes without being allocated, and
+         * keep their previous value. Scalar fields are always decoded: they
+         * cost nothing to read and array lengths depend on them.
+         *
+         * @return The number of bytes decoded, or <0 if an error occured.
+         */
+        template <uint64_t Mask>
+        inline int decodeFields(const void *buf, int offset, int maxlen);
+
+        /**
+         * Upper bound on the length of every variable-length array of this
+         * type, checked by decode() before anything is allocated; messages
+         * exceeding it fail to decode. It does not apply to nested types,
+         * which have their own. Set it once at startup, before decoding.
+         * Before C++17 it is a constant with no limit.
+         */
+#if __cplusplus >= 201703L
+        static inline int32_t maxArrayLength = INT32_MAX;
+#else
+        static constexpr int32_t maxArrayLength = INT32_MAX;
+#endif
+
+        /**
+         * Retrieve the 64-bit fingerprint identifying the structure of the message.
+         * Note that the fingerprint is the same for all instances of the same
+         * message type, and is a fingerprint on the message type definition, not on
+         * the message contents.
+         */
+        inline static int64_t getHash();
+
+        /**
+         * The fingerprint returned by getHash(), as a compile-time constant.
+         */
+        static constexpr int64_t kHash = static_cast<int64_t>(0x91e0f94411b3763eULL);
+
+        /**
+         * Returns "InteractiveMarkerControl"
+         */
+        inline static const char* getTypeName();
+
+        /**
+         * Name, LCM type and array dimensions of each field, in wire order.
+         * See dimos_lcm::for_each_field() for visiting the fields themselves.
+         */
+        static constexpr std::array<dimos_lcm::field_info, 9> kFields = {{
+            { "markers_length", "int32_t", true, 0, 0, NULL },
+            { "name", "string", true, 0, 0, NULL },
+            { "orientation", "geometry_msgs.Quaternion", false, 0, 0, NULL },
+            { "orientation_mode", "byte", true, 0, 0, NULL },
+            { "interaction_mode", "byte", true, 0, 0, NULL },
+            { "always_visible", "boolean", true, 0, 0, NULL },
+            { "markers", "visualization_msgs.Marker", false, 1, -1, "markers_length" },
+            { "independent_marker_orientation", "boolean", true, 0, 0, NULL },
+            { "description", "string", true, 0, 0, NULL },
+        }};
+
+        // LCM support functions. Users should not call these
+        inline int _encodeNoHash(void *buf, int offset, int maxlen) const;
+        template <typename Writer>
+        inline void _writeNoHash(Writer &out) const;
+        inline int _getEncodedSizeNoHash() const;
+        inline int _decodeNoHash(const void *buf, int offset, int maxlen);
+        template <uint64_t Mask>
+        inline int _decodeFieldsNoHash(const void *buf, int offset, int maxlen);
+        template <typename Self, typename Visitor>
+        inline static void _forEachField(Self &self, Visitor &visitor);
+        inline static int _skipNoHash(const void *buf, int offset, int maxlen);
+        inline static uint64_t _computeHash(const __lcm_hash_ptr *p);
+};
+
+static_assert(InteractiveMarkerControl::kHash == dimos_lcm::fingerprint(
+    dimos_lcm::signature_hash()
+        .member("markers_length", "int32_t", 0)
+        .member("name", "string", 0)
+        .member("orientation", NULL, 0)
+        .member("orientation_mode", "byte", 0)
+        .member("interaction_mode", "byte", 0)
+        .member("always_visible", "boolean", 0)
+        .member("markers", NULL, 1).dim(true, "markers_length")
+        .member("independent_marker_orientation", "boolean", 0)
+        .member("description", "string", 0)
+        .value(),
+    geometry_msgs::Quaternion::kHash,
+    visualization_msgs::interned::Marker::kHash),
+    "visualization_msgs::interned::InteractiveMarkerControl fingerprint does not match its definition");
+
+int InteractiveMarkerControl::encode(void *buf, int offset, int maxlen) const
+{
+    int pos = 0, tlen;
+    int64_t hash = getHash();
+
+    tlen = __int64_t_encode_array(buf, offset + pos, maxlen - pos, &hash, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = this->_encodeNoHash(buf, offset + pos, maxlen - pos);
+    if (tlen < 0) return tlen; else pos += tlen;
+
+    return pos;
+}
+
+int InteractiveMarkerControl::encodeTo(std::vector<uint8_t> &buf) const
+{
+    dimos_lcm::vector_writer out(buf);
+    int64_t hash = getHash();
+    out.put(&hash, 1);
+    this->_writeNoHash(out);
+    return static_cast<int>(out.size());
+}
+
+int InteractiveMarkerControl::decode(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, thislen;
+
+    int64_t msg_hash;
+    thislen = __int64_t_decode_array(buf, offset + pos, maxlen - pos, &msg_hash, 1);
+    if (thislen < 0) return thislen; else pos += thislen;
+    if (msg_hash != getHash()) return -1;
+
+    thislen = this->_decodeNoHash(buf, offset + pos, maxlen - pos);
+    if (thislen < 0) return thislen; else pos += thislen;
+
+    return pos;
+}
+
+template <uint64_t Mask>
+int InteractiveMarkerControl::decodeFields(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, thislen;
+
+    int64_t msg_hash;
+    thislen = __int64_t_decode_array(buf, offset + pos, maxlen - pos, &msg_hash, 1);
+    if (thislen < 0) return thislen; else pos += thislen;
+    if (msg_hash != getHash()) return -1;
+
+    thislen = this->_decodeFieldsNoHash<Mask>(buf, offset + pos, maxlen - pos);
+    if (thislen < 0) return thislen; else pos += thislen;
+
+    return pos;
+}
+
+int InteractiveMarkerControl::getEncodedSize() const
+{
+    return 8 + _getEncodedSizeNoHash();
+}
+
+int64_t InteractiveMarkerControl::getHash()
+{
+    return kHash;
+}
+
+const char* InteractiveMarkerControl::getTypeName()
+{
+    return "InteractiveMarkerControl";
+}
+
+int InteractiveMarkerControl::_encodeNoHash(void *buf, int offset, int maxlen) const
+{
+    int pos = 0, tlen;
+
+    tlen = __int32_t_encode_array(buf, offset + pos, maxlen - pos, &this->markers_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    char* name_cstr = const_cast<char*>(this->name.c_str());
+    tlen = __string_encode_array(
+        buf, offset + pos, maxlen - pos, &name_cstr, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = this->orientation._encodeNoHash(buf, offset + pos, maxlen - pos);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = __byte_encode_array(buf, offset + pos, maxlen - pos, &this->orientation_mode, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = __byte_encode_array(buf, offset + pos, maxlen - pos, &this->interaction_mode, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = __boolean_encode_array(buf, offset + pos, maxlen - pos, &this->always_visible, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    for (int a0 = 0; a0 < this->markers_length; a0++) {
+        tlen = this->markers[a0]._encodeNoHash(buf, offset + pos, maxlen - pos);
+        if(tlen < 0) return tlen; else pos += tlen;
+    }
+
+    tlen = __boolean_encode_array(buf, offset + pos, maxlen - pos, &this->independent_marker_orientation, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    char* description_cstr = const_cast<char*>(this->description.c_str());
+    tlen = __string_encode_array(
+        buf, offset + pos, maxlen - pos, &description_cstr, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    return pos;
+}
+
+template <typename Writer>
+void InteractiveMarkerControl::_writeNoHash(Writer &out) const
+{
+    out.put(&this->markers_length, 1);
+    out.put(this->name);
+    this->orientation._writeNoHash(out);
+    out.put(&this->orientation_mode, 1);
+    out.put(&this->interaction_mode, 1);
+    out.put(&this->always_visible, 1);
+    for (int a0 = 0; a0 < this->markers_length; a0++)
+        this->markers[a0]._writeNoHash(out);
+    out.put(&this->independent_marker_orientation, 1);
+    out.put(this->description);
+}
+
+int InteractiveMarkerControl::_decodeNoHash(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, tlen;
+
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &this->markers_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    int32_t __name_len__;
+    tlen = __int32_t_decode_array(
+        buf, offset + pos, maxlen - pos, &__name_len__, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+    if(__name_len__ < 1 || __name_len__ > maxlen - pos) return -1;
+    this->name.assign(
+        static_cast<const char*>(buf) + offset + pos, __name_len__ - 1);
+    pos += __name_len__;
+
+    tlen = this->orientation._decodeNoHash(buf, offset + pos, maxlen - pos);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = __byte_decode_array(buf, offset + pos, maxlen - pos, &this->orientation_mode, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = __byte_decode_array(buf, offset + pos, maxlen - pos, &this->interaction_mode, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = __boolean_decode_array(buf, offset + pos, maxlen - pos, &this->always_visible, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    if(this->markers_length < 0 || this->markers_length > (maxlen - pos) / 158 || this->markers_length > maxArrayLength) return -1;
+    try {
+        this->markers.resize(this->markers_length);
+    } catch (...) {
+        return -1;
+    }
+    for (int a0 = 0; a0 < this->markers_length; a0++) {
+        tlen = this->markers[a0]._decodeNoHash(buf, offset + pos, maxlen - pos);
+        if(tlen < 0) return tlen; else pos += tlen;
+    }
+
+    tlen = __boolean_decode_array(buf, offset + pos, maxlen - pos, &this->independent_marker_orientation, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    int32_t __description_len__;
+    tlen = __int32_t_decode_array(
+        buf, offset + pos, maxlen - pos, &__description_len__, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+    if(__description_len__ < 1 || __description_len__ > maxlen - pos) return -1;
+    this->description.assign(
+        static_cast<const char*>(buf) + offset + pos, __description_len__ - 1);
+    pos += __description_len__;
+
+    return pos;
+}
+
+template <uint64_t Mask>
+int InteractiveMarkerControl::_decodeFieldsNoHash(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, tlen;
+
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &this->markers_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    if ((Mask & Fields::name) != 0) {
+        int32_t __name_len__;
+        tlen = __int32_t_decode_array(
+            buf, offset + pos, maxlen - pos, &__name_len__, 1);
+        if(tlen < 0) return tlen; else pos += tlen;
+        if(__name_len__ < 1 || __name_len__ > maxlen - pos) return -1;
+        this->name.assign(
+            static_cast<const char*>(buf) + offset + pos, __name_len__ - 1);
+        pos += __name_len__;
+    } else {
+        int32_t __name_len__;
+        tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &__name_len__, 1);
+        if(tlen < 0) return tlen; else pos += tlen;
+        if(__name_len__ < 0 || __name_len__ > maxlen - pos) return -1;
+        pos += __name_len__;
+    }
+
+    if ((Mask & Fields::orientation) != 0) {
+        tlen = this->orientation._decodeNoHash(buf, offset + pos, maxlen - pos);
+        if(tlen < 0) return tlen; else pos += tlen;
+    } else {
+        tlen = geometry_msgs::Quaternion::_skipNoHash(buf, offset + pos, maxlen - pos);
+        if(tlen < 0) return tlen; else pos += tlen;
+    }
+
+    tlen = __byte_decode_array(buf, offset + pos, maxlen - pos, &this->orientation_mode, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = __byte_decode_array(buf, offset + pos, maxlen - pos, &this->interaction_mode, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = __boolean_decode_array(buf, offset + pos, maxlen - pos, &this->always_visible, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    if ((Mask & Fields::markers) != 0) {
+        if(this->markers_length < 0 || this->markers_length > (maxlen - pos) / 158 || this->markers_length > maxArrayLength) return -1;
+        try {
+            this->markers.resize(this->markers_length);
+        } catch (...) {
+            return -1;
+        }
+        for (int a0 = 0; a0 < this->markers_length; a0++) {
+            tlen = this->markers[a0]._decodeNoHash(buf, offset + pos, maxlen - pos);
+            if(tlen < 0) return tlen; else pos += tlen;
+        }
+    } else {
+        if(this->markers_length < 0) return -1;
+        for (int a0 = 0; a0 < this->markers_length; a0++) {
+            tlen = visualization_msgs::interned::Marker::_skipNoHash(buf, offset + pos, maxlen - pos);
+            if(tlen < 0) return tlen; else pos += tlen;
+        }
+    }
+
+    tlen = __boolean_decode_array(buf, offset + pos, maxlen - pos, &this->independent_marker_orientation, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    if ((Mask & Fields::description) != 0) {
+        int32_t __description_len__;
+        tlen = __int32_t_decode_array(
+            buf, offset + pos, maxlen - pos, &__description_len__, 1);
+        if(tlen < 0) return tlen; else pos += tlen;
+        if(__description_len__ < 1 || __description_len__ > maxlen - pos) return -1;
+        this->description.assign(
+            static_cast<const char*>(buf) + offset + pos, __description_len__ - 1);
+        pos += __description_len__;
+    } else {
+        int32_t __description_len__;
+        tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &__description_len__, 1);
+        if(tlen < 0) return tlen; else pos += tlen;
+        if(__description_len__ < 0 || __description_len__ > maxlen - pos) return -1;
+        pos += __description_len__;
+    }
+
+    return pos;
+}
+
+int InteractiveMarkerControl::_getEncodedSizeNoHash() const
+{
+    int enc_size = 0;
+    enc_size += __int32_t_encoded_array_size(NULL, 1);
+    enc_size += this->name.size() + 4 + 1;
+    enc_size += this->orientation._getEncodedSizeNoHash();
+    enc_size += __byte_encoded_array_size(NULL, 1);
+    enc_size += __byte_encoded_array_size(NULL, 1);
+    enc_size += __boolean_encoded_array_size(NULL, 1);
+    for (int a0 = 0; a0 < this->markers_length; a0++) {
+        enc_size += this->markers[a0]._getEncodedSizeNoHash();
+    }
+    enc_size += __boolean_encoded_array_size(NULL, 1);
+    enc_size += this->description.size() + 4 + 1;
+    return enc_size;
+}
+
+int InteractiveMarkerControl::_skipNoHash(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, tlen;
+    int32_t markers_length;
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &markers_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+    int32_t __name_len__;
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &__name_len__, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+    if(__name_len__ < 0 || __name_len__ > maxlen - pos) return -1;
+    pos += __name_len__;
+    tlen = geometry_msgs::Quaternion::_skipNoHash(buf, offset + pos, maxlen - pos);
+    if(tlen < 0) return tlen; else pos += tlen;
+    pos += 1;
+    pos += 1;
+    pos += 1;
+    if(markers_length < 0) return -1;
+    for (int a0 = 0; a0 < markers_length; a0++) {
+        tlen = visualization_msgs::interned::Marker::_skipNoHash(buf, offset + pos, maxlen - pos);
+        if(tlen < 0) return tlen; else pos += tlen;
+    }
+    pos += 1;
+    int32_t __description_len__;
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &__description_len__, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+    if(__description_len__ < 0 || __description_len__ > maxlen - pos) return -1;
+    pos += __description_len__;
+    if(pos > maxlen) return -1;
+    return pos;
+}
+
+template <typename Self, typename Visitor>
+void InteractiveMarkerControl::_forEachField(Self &self, Visitor &visitor)
+{
+    visitor(kFields[0], self.markers_length);
+    visitor(kFields[1], self.name);
+    visitor(kFields[2], self.orientation);
+    visitor(kFields[3], self.orientation_mode);
+    visitor(kFields[4], self.interaction_mode);
+    visitor(kFields[5], self.always_visible);
+    visitor(kFields[6], self.markers);
+    visitor(kFields[7], self.independent_marker_orientation);
+    visitor(kFields[8], self.description);
+}
+
+uint64_t InteractiveMarkerControl::_computeHash(const __lcm_hash_ptr *p)
+{
+    const __lcm_hash_ptr *fp;
+    for(fp = p; fp != NULL; fp = fp->parent)
+        if(fp->v == InteractiveMarkerControl::getHash)
+            return 0;
+    const __lcm_hash_ptr cp = { p, InteractiveMarkerControl::getHash };
+
+    uint64_t hash = 0x9e1db7d7740da609LL +
+         geometry_msgs::Quaternion::_computeHash(&cp) +
+         visualization_msgs::interned::Marker::_computeHash(&cp);
+
+    return (hash<<1) + ((hash>>63)&1);
+}
+
+}
+}
+
+#endif
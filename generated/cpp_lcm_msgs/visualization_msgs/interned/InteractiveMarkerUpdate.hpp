@@ -0,0 +1,608 @@
+/** THIS IS AN AUTOMATICALLY GENERATED FILE.  DO NOT MODIFY
+ * BY HAND!!
+ *
+ * Generated by lcm-cpp (tools/cpp/gen)
+ **/
+
+#ifndef __visualization_msgs_interned_InteractiveMarkerUpdate_hpp__
+#define __visualization_msgs_interned_InteractiveMarkerUpdate_hpp__
+
+#include <lcm/lcm_coretypes.h>
+
+#include <array>
+#include <string>
+#include <vector>
+#include "dimos_lcm/writer.hpp"
+#include "dimos_lcm/fingerprint.hpp"
+#include "dimos_lcm/reflection.hpp"
+#include "visualization_msgs/interned/InteractiveMarker.hpp"
+#include "visualization_msgs/interned/InteractiveMarkerPose.hpp"
+
+namespace visualization_msgs
+{
+namespace interned
+{
+
+class InteractiveMarkerUpdate
+{
+    public:
+        int32_t    markers_length;
+
+        int32_t    poses_length;
+
+        int32_t    erases_length;
+
+        std::string server_id;
+
+        int64_t    seq_num;
+
+        uint8_t    type;
+
+        /**
+         * LCM Type: visualization_msgs.InteractiveMarker[markers_length]
+         */
+        std::vector< visualization_msgs::interned::InteractiveMarker > markers;
+
+        /**
+         * LCM Type: visualization_msgs.InteractiveMarkerPose[poses_length]
+         */
+        std::vector< visualization_msgs::interned::InteractiveMarkerPose > poses;
+
+        /**
+         * LCM Type: string[erases_length]
+         */
+        std::vector< std::string > erases;
+
+    public:
+        // If you're using C++11 and are getting compiler errors saying
+        // things like ‘constexpr’ needed for in-class initialization of
+        // static data member then re-run lcm-gen with '--cpp-std=c++11'
+        // to generate code that is compliant with C++11
+        static const int8_t   KEEP_ALIVE = 0;
+        // If you're using C++11 and are getting compiler errors saying
+        // things like ‘constexpr’ needed for in-class initialization of
+        // static data member then re-run lcm-gen with '--cpp-std=c++11'
+        // to generate code that is compliant with C++11
+        static const int8_t   UPDATE = 1;
+
+    public:
+        /**
+         * Encode a message into binary form.
+         *
+         * @param buf The output buffer.
+         * @param offset Encoding starts at thie byte offset into @p buf.
+         * @param maxlen Maximum number of bytes to write.  This should generally be
+         *  equal to getEncodedSize().
+         * @return The number of bytes encoded, or <0 on error.
+         */
+        inline int encode(void *buf, int offset, int maxlen) const;
+
+        /**
+         * Encode a message by appending it to @p buf, walking the message once
+         * instead of sizing it with getEncodedSize() first. @p buf grows
+         * geometrically; reuse it across calls to avoid reallocating.
+         *
+         * @return The number of bytes appended.
+         */
+        inline int encodeTo(std::vector<uint8_t> &buf) const;
+
+        /**
+         * Check how many bytes are required to encode this message.
+         */
+        inline int getEncodedSize() const;
+
+        /**
+         * Decode a message from binary form into this instance.
+         *
+         * @param buf The buffer containing the encoded message.
+         * @param offset The byte offset into @p buf where the encoded message starts.
+         * @param maxlen The maximum number of bytes to read while decoding.
+         * @return The number of bytes decoded, or <0 if an error occured.
+         */
+        inline int decode(const void *buf, int offset, int maxlen);
+
+        /**
+         * Field bits for decodeFields().
+         */
+        struct Fields
+        {
+            static constexpr uint64_t markers_length = 1ULL << 0;
+            static constexpr uint64_t poses_length = 1ULL << 1;
+            static constexpr uint64_t erases_length = 1ULL << 2;
+            static constexpr uint64_t server_id = 1ULL << 3;
+            static constexpr uint64_t seq_num = 1ULL << 4;
+            static constexpr uint64_t type = 1ULL << 5;
+            static constexpr uint64_t markers = 1ULL << 6;
+            static constexpr uint64_t poses = 1ULL << 7;
+            static constexpr uint64_t erases = 1ULL << 8;
+            static constexpr uint64_t all = (1ULL << 9) - 1;
+        };
+
+        /**
+         * Decode only the fields selected by @p Mask, a bitwise or of Fields
+         * values. Strings, arrays and nested structs that are not selected are
+         * skipped over by their length prefixes without being allocated, and
+         * keep their previous value. Scalar fields are always decoded: they
+         * cost nothing to read and array lengths depend on them.
+         *
+         * @return The number of bytes decoded, or <0 if an error occured.
+         */
+        template <uint64_t Mask>
+        inline int decodeFields(const void *buf, int offset, int maxlen);
+
+        /**
+         * Upper bound on the length of every variable-length array of this
+         * type, checked by decode() before anything is allocated; messages
+         * exceeding it fail to decode. It does not apply to nested types,
+         * which have their own. Set it once at startup, before decoding.
+         * Before C++17 it is a constant with no limit.
+         */
+#if __cplusplus >= 201703L
+        static inline int32_t maxArrayLength = INT32_MAX;
+#else
+        static constexpr int32_t maxArrayLength = INT32_MAX;
+#endif
+
+        /**
+         * Retrieve the 64-bit fingerprint identifying the structure of the message.
+         * Note that the fingerprint is the same for all instances of the same
+         * message type, and is a fingerprint on the message type definition, not on
+         * the message contents.
+         */
+        inline static int64_t getHash();
+
+        /**
+         * The fingerprint returned by getHash(), as a compile-time constant.
+         */
+        static constexpr int64_t kHash = static_cast<int64_t>(0xe498190e0276d93dULL);
+
+        /**
+         * Returns "InteractiveMarkerUpdate"
+         */
+        inline static const char* getTypeName();
+
+        /**
+         * Name, LCM type and array dimensions of each field, in wire order.
+         * See dimos_lcm::for_each_field() for visiting the fields themselves.
+         */
+        static constexpr std::array<dimos_lcm::field_info, 9> kFields = {{
+            { "markers_length", "int32_t", true, 0, 0, NULL },
+            { "poses_length", "int32_t", true, 0, 0, NULL },
+            { "erases_length", "int32_t", true, 0, 0, NULL },
+            { "server_id", "string", true, 0, 0, NULL },
+            { "seq_num", "int64_t", true, 0, 0, NULL },
+            { "type", "byte", true, 0, 0, NULL },
+            { "markers", "visualization_msgs.InteractiveMarker", false, 1, -1, "markers_length" },
+            { "poses", "visualization_msgs.InteractiveMarkerPose", false, 1, -1, "poses_length" },
+            { "erases", "string", true, 1, -1, "erases_length" },
+        }};
+
+        // LCM support functions. Users should not call these
+        inline int _encodeNoHash(void *buf, int offset, int maxlen) const;
+        template <typename Writer>
+        inline void _writeNoHash(Writer &out) const;
+        inline int _getEncodedSizeNoHash() const;
+        inline int _decodeNoHash(const void *buf, int offset, int maxlen);
+        template <uint64_t Mask>
+        inline int _decodeFieldsNoHash(const void *buf, int offset, int maxlen);
+        template <typename Self, typename Visitor>
+        inline static void _forEachField(Self &self, Visitor &visitor);
+        inline static int _skipNoHash(const void *buf, int offset, int maxlen);
+        inline static uint64_t _computeHash(const __lcm_hash_ptr *p);
+};
+
+static_assert(InteractiveMarkerUpdate::kHash == dimos_lcm::fingerprint(
+    dimos_lcm::signature_hash()
+        .member("markers_length", "int32_t", 0)
+        .member("poses_length", "int32_t", 0)
+        .member("erases_length", "int32_t", 0)
+        .member("server_id", "string", 0)
+        .member("seq_num", "int64_t", 0)
+        .member("type", "byte", 0)
+        .member("markers", NULL, 1).dim(true, "markers_length")
+        .member("poses", NULL, 1).dim(true, "poses_length")
+        .member("erases", "string", 1).dim(true, "erases_length")
+        .value(),
+    visualization_msgs::interned::InteractiveMarker::kHash,
+    visualization_msgs::interned::InteractiveMarkerPose::kHash),
+    "visualization_msgs::interned::InteractiveMarkerUpdate fingerprint does not match its definition");
+
+int InteractiveMarkerUpdate::encode(void *buf, int offset, int maxlen) const
+{
+    int pos = 0, tlen;
+    int64_t hash = getHash();
+
+    tlen = __int64_t_encode_array(buf, offset + pos, maxlen - pos, &hash, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = this->_encodeNoHash(buf, offset + pos, maxlen - pos);
+    if (tlen < 0) return tlen; else pos += tlen;
+
+    return pos;
+}
+
+int InteractiveMarkerUpdate::encodeTo(std::vector<uint8_t> &buf) const
+{
+    dimos_lcm::vector_writer out(buf);
+    int64_t hash = getHash();
+    out.put(&hash, 1);
+    this->_writeNoHash(out);
+    return static_cast<int>(out.size());
+}
+
+int InteractiveMarkerUpdate::decode(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, thislen;
+
+    int64_t msg_hash;
+    thislen = __int64_t_decode_array(buf, offset + pos, maxlen - pos, &msg_hash, 1);
+    if (thislen < 0) return thislen; else pos += thislen;
+    if (msg_hash != getHash()) return -1;
+
+    thislen = this->_decodeNoHash(buf, offset + pos, maxlen - pos);
+    if (thislen < 0) return thislen; else pos += thislen;
+
+    return pos;
+}
+
+template <uint64_t Mask>
+int InteractiveMarkerUpdate::decodeFields(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, thislen;
+
+    int64_t msg_hash;
+    thislen = __int64_t_decode_array(buf, offset + pos, maxlen - pos, &msg_hash, 1);
+    if (thislen < 0) return thislen; else pos += thislen;
+    if (msg_hash != getHash()) return -1;
+
+    thislen = this->_decodeFieldsNoHash<Mask>(buf, offset + pos, maxlen - pos);
+    if (thislen < 0) return thislen; else pos += thislen;
+
+    return pos;
+}
+
+int InteractiveMarkerUpdate::getEncodedSize() const
+{
+    return 8 + _getEncodedSizeNoHash();
+}
+
+int64_t InteractiveMarkerUpdate::getHash()
+{
+    return kHash;
+}
+
+const char* InteractiveMarkerUpdate::getTypeName()
+{
+    return "InteractiveMarkerUpdate";
+}
+
+int InteractiveMarkerUpdate::_encodeNoHash(void *buf, int offset, int maxlen) const
+{
+    int pos = 0, tlen;
+
+    tlen = __int32_t_encode_array(buf, offset + pos, maxlen - pos, &this->markers_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = __int32_t_encode_array(buf, offset + pos, maxlen - pos, &this->poses_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = __int32_t_encode_array(buf, offset + pos, maxlen - pos, &this->erases_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    char* server_id_cstr = const_cast<char*>(this->server_id.c_str());
+    tlen = __string_encode_array(
+        buf, offset + pos, maxlen - pos, &server_id_cstr, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = __int64_t_encode_array(buf, offset + pos, maxlen - pos, &this->seq_num, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = __byte_encode_array(buf, offset + pos, maxlen - pos, &this->type, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    for (int a0 = 0; a0 < this->markers_length; a0++) {
+        tlen = this->markers[a0]._encodeNoHash(buf, offset + pos, maxlen - pos);
+        if(tlen < 0) return tlen; else pos += tlen;
+    }
+
+    for (int a0 = 0; a0 < this->poses_length; a0++) {
+        tlen = this->poses[a0]._encodeNoHash(buf, offset + pos, maxlen - pos);
+        if(tlen < 0) return tlen; else pos += tlen;
+    }
+
+    for (int a0 = 0; a0 < this->erases_length; a0++) {
+        char* __cstr = const_cast<char*>(this->erases[a0].c_str());
+        tlen = __string_encode_array(
+            buf, offset + pos, maxlen - pos, &__cstr, 1);
+        if(tlen < 0) return tlen; else pos += tlen;
+    }
+
+    return pos;
+}
+
+template <typename Writer>
+void InteractiveMarkerUpdate::_writeNoHash(Writer &out) const
+{
+    out.put(&this->markers_length, 1);
+    out.put(&this->poses_length, 1);
+    out.put(&this->erases_length, 1);
+    out.put(this->server_id);
+    out.put(&this->seq_num, 1);
+    out.put(&this->type, 1);
+    for (int a0 = 0; a0 < this->markers_length; a0++)
+        this->markers[a0]._writeNoHash(out);
+    for (int a0 = 0; a0 < this->poses_length; a0++)
+        this->poses[a0]._writeNoHash(out);
+    for (int a0 = 0; a0 < this->erases_length; a0++)
+        out.put(this->erases[a0]);
+}
+
+int InteractiveMarkerUpdate::_decodeNoHash(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, tlen;
+
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &this->markers_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &this->poses_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &this->erases_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    int32_t __server_id_len__;
+    tlen = __int32_t_decode_array(
+        buf, offset + pos, maxlen - pos, &__server_id_len__, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+    if(__server_id_len__ < 1 || __server_id_len__ > maxlen - pos) return -1;
+    this->server_id.assign(
+        static_cast<const char*>(buf) + offset + pos, __server_id_len__ - 1);
+    pos += __server_id_len__;
+
+    tlen = __int64_t_decode_array(buf, offset + pos, maxlen - pos, &this->seq_num, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = __byte_decode_array(buf, offset + pos, maxlen - pos, &this->type, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    if(this->markers_length < 0 || this->markers_length > (maxlen - pos) / 95 || this->markers_length > maxArrayLength) return -1;
+    try {
+        this->markers.resize(this->markers_length);
+    } catch (...) {
+        return -1;
+    }
+    for (int a0 = 0; a0 < this->markers_length; a0++) {
+        tlen = this->markers[a0]._decodeNoHash(buf, offset + pos, maxlen - pos);
+        if(tlen < 0) return tlen; else pos += tlen;
+    }
+
+    if(this->poses_length < 0 || this->poses_length > (maxlen - pos) / 78 || this->poses_length > maxArrayLength) return -1;
+    try {
+        this->poses.resize(this->poses_length);
+    } catch (...) {
+        return -1;
+    }
+    for (int a0 = 0; a0 < this->poses_length; a0++) {
+        tlen = this->poses[a0]._decodeNoHash(buf, offset + pos, maxlen - pos);
+        if(tlen < 0) return tlen; else pos += tlen;
+    }
+
+    if(this->erases_length < 0 || this->erases_length > (maxlen - pos) / 5 || this->erases_length > maxArrayLength) return -1;
+    try {
+        this->erases.resize(this->erases_length);
+    } catch (...) {
+        return -1;
+    }
+    for (int a0 = 0; a0 < this->erases_length; a0++) {
+        int32_t __elem_len;
+        tlen = __int32_t_decode_array(
+            buf, offset + pos, maxlen - pos, &__elem_len, 1);
+        if(tlen < 0) return tlen; else pos += tlen;
+        if(__elem_len < 1 || __elem_len > maxlen - pos) return -1;
+        this->erases[a0].assign(static_cast<const char*>(buf) + offset + pos, __elem_len -  1);
+        pos += __elem_len;
+    }
+
+    return pos;
+}
+
+template <uint64_t Mask>
+int InteractiveMarkerUpdate::_decodeFieldsNoHash(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, tlen;
+
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &this->markers_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &this->poses_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &this->erases_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    if ((Mask & Fields::server_id) != 0) {
+        int32_t __server_id_len__;
+        tlen = __int32_t_decode_array(
+            buf, offset + pos, maxlen - pos, &__server_id_len__, 1);
+        if(tlen < 0) return tlen; else pos += tlen;
+        if(__server_id_len__ < 1 || __server_id_len__ > maxlen - pos) return -1;
+        this->server_id.assign(
+            static_cast<const char*>(buf) + offset + pos, __server_id_len__ - 1);
+        pos += __server_id_len__;
+    } else {
+        int32_t __server_id_len__;
+        tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &__server_id_len__, 1);
+        if(tlen < 0) return tlen; else pos += tlen;
+        if(__server_id_len__ < 0 || __server_id_len__ > maxlen - pos) return -1;
+        pos += __server_id_len__;
+    }
+
+    tlen = __int64_t_decode_array(buf, offset + pos, maxlen - pos, &this->seq_num, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = __byte_decode_array(buf, offset + pos, maxlen - pos, &this->type, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    if ((Mask & Fields::markers) != 0) {
+        if(this->markers_length < 0 || this->markers_length > (maxlen - pos) / 95 || this->markers_length > maxArrayLength) return -1;
+        try {
+            this->markers.resize(this->markers_length);
+        } catch (...) {
+            return -1;
+        }
+        for (int a0 = 0; a0 < this->markers_length; a0++) {
+            tlen = this->markers[a0]._decodeNoHash(buf, offset + pos, maxlen - pos);
+            if(tlen < 0) return tlen; else pos += tlen;
+        }
+    } else {
+        if(this->markers_length < 0) return -1;
+        for (int a0 = 0; a0 < this->markers_length; a0++) {
+            tlen = visualization_msgs::interned::InteractiveMarker::_skipNoHash(buf, offset + pos, maxlen - pos);
+            if(tlen < 0) return tlen; else pos += tlen;
+        }
+    }
+
+    if ((Mask & Fields::poses) != 0) {
+        if(this->poses_length < 0 || this->poses_length > (maxlen - pos) / 78 || this->poses_length > maxArrayLength) return -1;
+        try {
+            this->poses.resize(this->poses_length);
+        } catch (...) {
+            return -1;
+        }
+        for (int a0 = 0; a0 < this->poses_length; a0++) {
+            tlen = this->poses[a0]._decodeNoHash(buf, offset + pos, maxlen - pos);
+            if(tlen < 0) return tlen; else pos += tlen;
+        }
+    } else {
+        if(this->poses_length < 0) return -1;
+        for (int a0 = 0; a0 < this->poses_length; a0++) {
+            tlen = visualization_msgs::interned::InteractiveMarkerPose::_skipNoHash(buf, offset + pos, maxlen - pos);
+            if(tlen < 0) return tlen; else pos += tlen;
+        }
+    }
+
+    if ((Mask & Fields::erases) != 0) {
+        if(this->erases_length < 0 || this->erases_length > (maxlen - pos) / 5 || this->erases_length > maxArrayLength) return -1;
+        try {
+            this->erases.resize(this->erases_length);
+        } catch (...) {
+            return -1;
+        }
+        for (int a0 = 0; a0 < this->erases_length; a0++) {
+            int32_t __elem_len;
+            tlen = __int32_t_decode_array(
+                buf, offset + pos, maxlen - pos, &__elem_len, 1);
+            if(tlen < 0) return tlen; else pos += tlen;
+            if(__elem_len < 1 || __elem_len > maxlen - pos) return -1;
+            this->erases[a0].assign(static_cast<const char*>(buf) + offset + pos, __elem_len -  1);
+            pos += __elem_len;
+        }
+    } else {
+        if(this->erases_length < 0) return -1;
+        for (int a0 = 0; a0 < this->erases_length; a0++) {
+            int32_t __erases_len__;
+            tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &__erases_len__, 1);
+            if(tlen < 0) return tlen; else pos += tlen;
+            if(__erases_len__ < 0 || __erases_len__ > maxlen - pos) return -1;
+            pos += __erases_len__;
+        }
+    }
+
+    return pos;
+}
+
+int InteractiveMarkerUpdate::_getEncodedSizeNoHash() const
+{
+    int enc_size = 0;
+    enc_size += __int32_t_encoded_array_size(NULL, 1);
+    enc_size += __int32_t_encoded_array_size(NULL, 1);
+    enc_size += __int32_t_encoded_array_size(NULL, 1);
+    enc_size += this->server_id.size() + 4 + 1;
+    enc_size += __int64_t_encoded_array_size(NULL, 1);
+    enc_size += __byte_encoded_array_size(NULL, 1);
+    for (int a0 = 0; a0 < this->markers_length; a0++) {
+        enc_size += this->markers[a0]._getEncodedSizeNoHash();
+    }
+    for (int a0 = 0; a0 < this->poses_length; a0++) {
+        enc_size += this->poses[a0]._getEncodedSizeNoHash();
+    }
+    for (int a0 = 0; a0 < this->erases_length; a0++) {
+        enc_size += this->erases[a0].size() + 4 + 1;
+    }
+    return enc_size;
+}
+
+int InteractiveMarkerUpdate::_skipNoHash(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, tlen;
+    int32_t markers_length;
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &markers_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+    int32_t poses_length;
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &poses_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+    int32_t erases_length;
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &erases_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+    int32_t __server_id_len__;
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &__server_id_len__, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+    if(__server_id_len__ < 0 || __server_id_len__ > maxlen - pos) return -1;
+    pos += __server_id_len__;
+    pos += 8;
+    pos += 1;
+    if(markers_length < 0) return -1;
+    for (int a0 = 0; a0 < markers_length; a0++) {
+        tlen = visualization_msgs::interned::InteractiveMarker::_skipNoHash(buf, offset + pos, maxlen - pos);
+        if(tlen < 0) return tlen; else pos += tlen;
+    }
+    if(poses_length < 0) return -1;
+    for (int a0 = 0; a0 < poses_length; a0++) {
+        tlen = visualization_msgs::interned::InteractiveMarkerPose::_skipNoHash(buf, offset + pos, maxlen - pos);
+        if(tlen < 0) return tlen; else pos += tlen;
+    }
+    if(erases_length < 0) return -1;
+    for (int a0 = 0; a0 < erases_length; a0++) {
+        int32_t __erases_len__;
+        tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &__erases_len__, 1);
+        if(tlen < 0) return tlen; else pos += tlen;
+        if(__erases_len__ < 0 || __erases_len__ > maxlen - pos) return -1;
+        pos += __erases_len__;
+    }
+    if(pos > maxlen) return -1;
+    return pos;
+}
+
+template <typename Self, typename Visitor>
+void InteractiveMarkerUpdate::_forEachField(Self &self, Visitor &visitor)
+{
+    visitor(kFields[0], self.markers_length);
+    visitor(kFields[1], self.poses_length);
+    visitor(kFields[2], self.erases_length);
+    visitor(kFields[3], self.server_id);
+    visitor(kFields[4], self.seq_num);
+    visitor(kFields[5], self.type);
+    visitor(kFields[6], self.markers);
+    visitor(kFields[7], self.poses);
+    visitor(kFields[8], self.erases);
+}
+
+uint64_t InteractiveMarkerUpdate::_computeHash(const __lcm_hash_ptr *p)
+{
+    const __lcm_hash_ptr *fp;
+    for(fp = p; fp != NULL; fp = fp->parent)
+        if(fp->v == InteractiveMarkerUpdate::getHash)
+            return 0;
+    const __lcm_hash_ptr cp = { p, InteractiveMarkerUpdate::getHash };
+
+    uint64_t hash = 0xf6eebb4c4a608b4cLL +
+         visualization_msgs::interned::InteractiveMarker::_computeHash(&cp) +
+         visualization_msgs::interned::InteractiveMarkerPose::_computeHash(&cp);
+
+    return (hash<<1) + ((hash>>63)&1);
+}
+
+}
+}
+
+#endif
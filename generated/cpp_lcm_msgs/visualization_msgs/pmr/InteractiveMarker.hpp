@@ -0,0 +1,660 @@
+/** THIS IS AN AUTOMATICALLY GENERATED FILE.  DO NOT MODIFY
+ * BY HAND!!
+ *
+ * Generated by lcm-cpp (tools/cpp/gen)
+ **/
+
+#ifndef __visualization_msgs_pmr_InteractiveMarker_hpp__
+#define __visualization_msgs_pmr_InteractiveMarker_hpp__
+
+#include <lcm/lcm_coretypes.h>
+
+#include <array>
+#include <memory_resource>
+#include <utility>
+#include <string>
+#include <vector>
+#include "dimos_lcm/writer.hpp"
+#include "dimos_lcm/fingerprint.hpp"
+#include "dimos_lcm/reflection.hpp"
+#include "std_msgs/pmr/Header.hpp"
+#include "geometry_msgs/pmr/Pose.hpp"
+#include "visualization_msgs/pmr/MenuEntry.hpp"
+#include "visualization_msgs/pmr/InteractiveMarkerControl.hpp"
+#if __cplusplus >= 201703L
+#include "std_msgs/HeaderView.hpp"
+#endif
+
+namespace visualization_msgs
+{
+namespace pmr
+{
+
+class InteractiveMarker
+{
+    public:
+        int32_t    menu_entries_length;
+
+        int32_t    controls_length;
+
+        std_msgs::pmr::Header header;
+
+        geometry_msgs::pmr::Pose pose;
+
+        std::pmr::string name;
+
+        std::pmr::string description;
+
+        float      scale;
+
+        /**
+         * LCM Type: visualization_msgs.MenuEntry[menu_entries_length]
+         */
+        std::pmr::vector< visualization_msgs::pmr::MenuEntry > menu_entries;
+
+        /**
+         * LCM Type: visualization_msgs.InteractiveMarkerControl[controls_length]
+         */
+        std::pmr::vector< visualization_msgs::pmr::InteractiveMarkerControl > controls;
+
+    public:
+        typedef std::pmr::polymorphic_allocator<char> allocator_type;
+
+        /**
+         * Construct a message whose strings and arrays, and those of the
+         * messages it nests, allocate from @p alloc. Scalars are zeroed.
+         */
+        inline explicit InteractiveMarker(const allocator_type &alloc = allocator_type());
+
+        /**
+         * Copy or move @p other into a message that allocates from @p alloc.
+         * With allocator_type, these let std::pmr containers of InteractiveMarker pass
+         * their memory resource on to their elements.
+         */
+        inline InteractiveMarker(const InteractiveMarker &other, const allocator_type &alloc);
+        inline InteractiveMarker(InteractiveMarker &&other, const allocator_type &alloc);
+
+        /**
+         * Encode a message into binary form.
+         *
+         * @param buf The output buffer.
+         * @param offset Encoding starts at thie byte offset into @p buf.
+         * @param maxlen Maximum number of bytes to write.  This should generally be
+         *  equal to getEncodedSize().
+         * @return The number of bytes encoded, or <0 on error.
+         */
+        inline int encode(void *buf, int offset, int maxlen) const;
+
+        /**
+         * Encode a message by appending it to @p buf, walking the message once
+         * instead of sizing it with getEncodedSize() first. @p buf grows
+         * geometrically; reuse it across calls to avoid reallocating.
+         *
+         * @return The number of bytes appended.
+         */
+        inline int encodeTo(std::vector<uint8_t> &buf) const;
+
+        /**
+         * Check how many bytes are required to encode this message.
+         */
+        inline int getEncodedSize() const;
+
+        /**
+         * Decode a message from binary form into this instance.
+         *
+         * @param buf The buffer containing the encoded message.
+         * @param offset The byte offset into @p buf where the encoded message starts.
+         * @param maxlen The maximum number of bytes to read while decoding.
+         * @return The number of bytes decoded, or <0 if an error occured.
+         */
+        inline int decode(const void *buf, int offset, int maxlen);
+
+#if __cplusplus >= 201703L
+        /**
+         * Decode only the header field of an encoded message, leaving the
+         * rest of it untouched. The field sits at a fixed offset, so this costs
+         * the same for any payload size. The view points into @p buf.
+         *
+         * @param buf The buffer containing the encoded message.
+         * @param offset The byte offset into @p buf where the encoded message starts.
+         * @param maxlen The maximum number of bytes to read while decoding.
+         * @param header Receives the decoded header.
+         * @return The number of bytes of the field decoded, or <0 if @p buf does
+         *  not hold a InteractiveMarker or is truncated.
+         *
+         * Needs C++17, for the std::string_view of the view.
+         */
+        inline static int peekHeader(const void *buf, int offset, int maxlen, std_msgs::HeaderView &header);
+#endif
+
+        /**
+         * Field bits for decodeFields().
+         */
+        struct Fields
+        {
+            static constexpr uint64_t menu_entries_length = 1ULL << 0;
+            static constexpr uint64_t controls_length = 1ULL << 1;
+            static constexpr uint64_t header = 1ULL << 2;
+            static constexpr uint64_t pose = 1ULL << 3;
+            static constexpr uint64_t name = 1ULL << 4;
+            static constexpr uint64_t description = 1ULL << 5;
+            static constexpr uint64_t scale = 1ULL << 6;
+            static constexpr uint64_t menu_entries = 1ULL << 7;
+            static constexpr uint64_t controls = 1ULL << 8;
+            static constexpr uint64_t all = (1ULL << 9) - 1;
+        };
+
+        /**
+         * Decode only the fields selected by @p Mask, a bitwise or of Fields
+         * values. Strings, arrays and nested structs that are not selected are
+         * skipped over by their length prefixes without being allocated, and
+         * keep their previous value. Scalar fields are always decoded: they
+         * cost nothing to read and array lengths depend on them.
+         *
+         * @return The number of bytes decoded, or <0 if an error occured.
+         */
+        template <uint64_t Mask>
+        inline int decodeFields(const void *buf, int offset, int maxlen);
+
+        /**
+         * Upper bound on the length of every variable-length array of this
+         * type, checked by decode() before anything is allocated; messages
+         * exceeding it fail to decode. It does not apply to nested types,
+         * which have their own. Set it once at startup, before decoding.
+         * Before C++17 it is a constant with no limit.
+         */
+#if __cplusplus >= 201703L
+        static inline int32_t maxArrayLength = INT32_MAX;
+#else
+        static constexpr int32_t maxArrayLength = INT32_MAX;
+#endif
+
+        /**
+         * Retrieve the 64-bit fingerprint identifying the structure of the message.
+         * Note that the fingerprint is the same for all instances of the same
+         * message type, and is a fingerprint on the message type definition, not on
+         * the message contents.
+         */
+        inline static int64_t getHash();
+
+        /**
+         * The fingerprint returned by getHash(), as a compile-time constant.
+         */
+        static constexpr int64_t kHash = static_cast<int64_t>(0x39ec4f85e18ac7ddULL);
+
+        /**
+         * Returns "InteractiveMarker"
+         */
+        inline static const char* getTypeName();
+
+        /**
+         * Name, LCM type and array dimensions of each field, in wire order.
+         * See dimos_lcm::for_each_field() for visiting the fields themselves.
+         */
+        static constexpr std::array<dimos_lcm::field_info, 9> kFields = {{
+            { "menu_entries_length", "int32_t", true, 0, 0, NULL },
+            { "controls_length", "int32_t", true, 0, 0, NULL },
+            { "header", "std_msgs.Header", false, 0, 0, NULL },
+            { "pose", "geometry_msgs.Pose", false, 0, 0, NULL },
+            { "name", "string", true, 0, 0, NULL },
+            { "description", "string", true, 0, 0, NULL },
+            { "scale", "float", true, 0, 0, NULL },
+            { "menu_entries", "visualization_msgs.MenuEntry", false, 1, -1, "menu_entries_length" },
+            { "controls", "visualization_msgs.InteractiveMarkerControl", false, 1, -1, "controls_length" },
+        }};
+
+        // LCM support functions. Users should not call these
+        inline int _encodeNoHash(void *buf, int offset, int maxlen) const;
+        template <typename Writer>
+        inline void _writeNoHash(Writer &out) const;
+        inline int _getEncodedSizeNoHash() const;
+        inline int _decodeNoHash(const void *buf, int offset, int maxlen);
+        template <uint64_t Mask>
+        inline int _decodeFieldsNoHash(const void *buf, int offset, int maxlen);
+        template <typename Self, typename Visitor>
+        inline static void _forEachField(Self &self, Visitor &visitor);
+        inline static int _skipNoHash(const void *buf, int offset, int maxlen);
+        inline static uint64_t _computeHash(const __lcm_hash_ptr *p);
+};
+
+static_assert(InteractiveMarker::kHash == dimos_lcm::fingerprint(
+    dimos_lcm::signature_hash()
+        .member("menu_entries_length", "int32_t", 0)
+        .member("controls_length", "int32_t", 0)
+        .member("header", NULL, 0)
+        .member("pose", NULL, 0)
+        .member("name", "string", 0)
+        .member("description", "string", 0)
+        .member("scale", "float", 0)
+        .member("menu_entries", NULL, 1).dim(true, "menu_entries_length")
+        .member("controls", NULL, 1).dim(true, "controls_length")
+        .value(),
+    std_msgs::pmr::Header::kHash,
+    geometry_msgs::pmr::Pose::kHash,
+    visualization_msgs::pmr::MenuEntry::kHash,
+    visualization_msgs::pmr::InteractiveMarkerControl::kHash),
+    "visualization_msgs::pmr::InteractiveMarker fingerprint does not match its definition");
+
+InteractiveMarker::InteractiveMarker(const allocator_type &alloc) :
+    menu_entries_length(),
+    controls_length(),
+    header(alloc),
+    pose(),
+    name(alloc),
+    description(alloc),
+    scale(),
+    menu_entries(alloc),
+    controls(alloc)
+{
+}
+
+InteractiveMarker::InteractiveMarker(const InteractiveMarker &other, const allocator_type &alloc) :
+    InteractiveMarker(alloc)
+{
+    *this = other;
+}
+
+InteractiveMarker::InteractiveMarker(InteractiveMarker &&other, const allocator_type &alloc) :
+    InteractiveMarker(alloc)
+{
+    *this = std::move(other);
+}
+
+int InteractiveMarker::encode(void *buf, int offset, int maxlen) const
+{
+    int pos = 0, tlen;
+    int64_t hash = getHash();
+
+    tlen = __int64_t_encode_array(buf, offset + pos, maxlen - pos, &hash, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = this->_encodeNoHash(buf, offset + pos, maxlen - pos);
+    if (tlen < 0) return tlen; else pos += tlen;
+
+    return pos;
+}
+
+int InteractiveMarker::encodeTo(std::vector<uint8_t> &buf) const
+{
+    dimos_lcm::vector_writer out(buf);
+    int64_t hash = getHash();
+    out.put(&hash, 1);
+    this->_writeNoHash(out);
+    return static_cast<int>(out.size());
+}
+
+int InteractiveMarker::decode(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, thislen;
+
+    int64_t msg_hash;
+    thislen = __int64_t_decode_array(buf, offset + pos, maxlen - pos, &msg_hash, 1);
+    if (thislen < 0) return thislen; else pos += thislen;
+    if (msg_hash != getHash()) return -1;
+
+    thislen = this->_decodeNoHash(buf, offset + pos, maxlen - pos);
+    if (thislen < 0) return thislen; else pos += thislen;
+
+    return pos;
+}
+
+#if __cplusplus >= 201703L
+int InteractiveMarker::peekHeader(const void *buf, int offset, int maxlen, std_msgs::HeaderView &header)
+{
+    int64_t msg_hash;
+    if (__int64_t_decode_array(buf, offset, maxlen, &msg_hash, 1) < 0) return -1;
+    if (msg_hash != kHash) return -1;
+
+    // header follows the hash and 8 bytes of fixed-size fields
+    return header._decodeNoHash(buf, offset + 16, maxlen - 16);
+}
+#endif
+
+template <uint64_t Mask>
+int InteractiveMarker::decodeFields(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, thislen;
+
+    int64_t msg_hash;
+    thislen = __int64_t_decode_array(buf, offset + pos, maxlen - pos, &msg_hash, 1);
+    if (thislen < 0) return thislen; else pos += thislen;
+    if (msg_hash != getHash()) return -1;
+
+    thislen = this->_decodeFieldsNoHash<Mask>(buf, offset + pos, maxlen - pos);
+    if (thislen < 0) return thislen; else pos += thislen;
+
+    return pos;
+}
+
+int InteractiveMarker::getEncodedSize() const
+{
+    return 8 + _getEncodedSizeNoHash();
+}
+
+int64_t InteractiveMarker::getHash()
+{
+    return kHash;
+}
+
+const char* InteractiveMarker::getTypeName()
+{
+    return "InteractiveMarker";
+}
+
+int InteractiveMarker::_encodeNoHash(void *buf, int offset, int maxlen) const
+{
+    int pos = 0, tlen;
+
+    tlen = __int32_t_encode_array(buf, offset + pos, maxlen - pos, &this->menu_entries_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = __int32_t_encode_array(buf, offset + pos, maxlen - pos, &this->controls_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = this->header._encodeNoHash(buf, offset + pos, maxlen - pos);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = this->pose._encodeNoHash(buf, offset + pos, maxlen - pos);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    char* name_cstr = const_cast<char*>(this->name.c_str());
+    tlen = __string_encode_array(
+        buf, offset + pos, maxlen - pos, &name_cstr, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    char* description_cstr = const_cast<char*>(this->description.c_str());
+    tlen = __string_encode_array(
+        buf, offset + pos, maxlen - pos, &description_cstr, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = __float_encode_array(buf, offset + pos, maxlen - pos, &this->scale, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    for (int a0 = 0; a0 < this->menu_entries_length; a0++) {
+        tlen = this->menu_entries[a0]._encodeNoHash(buf, offset + pos, maxlen - pos);
+        if(tlen < 0) return tlen; else pos += tlen;
+    }
+
+    for (int a0 = 0; a0 < this->controls_length; a0++) {
+        tlen = this->controls[a0]._encodeNoHash(buf, offset + pos, maxlen - pos);
+        if(tlen < 0) return tlen; else pos += tlen;
+    }
+
+    return pos;
+}
+
+template <typename Writer>
+void InteractiveMarker::_writeNoHash(Writer &out) const
+{
+    out.put(&this->menu_entries_length, 1);
+    out.put(&this->controls_length, 1);
+    this->header._writeNoHash(out);
+    this->pose._writeNoHash(out);
+    out.put(this->name);
+    out.put(this->description);
+    out.put(&this->scale, 1);
+    for (int a0 = 0; a0 < this->menu_entries_length; a0++)
+        this->menu_entries[a0]._writeNoHash(out);
+    for (int a0 = 0; a0 < this->controls_length; a0++)
+        this->controls[a0]._writeNoHash(out);
+}
+
+int InteractiveMarker::_decodeNoHash(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, tlen;
+
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &this->menu_entries_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &this->controls_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = this->header._decodeNoHash(buf, offset + pos, maxlen - pos);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = this->pose._decodeNoHash(buf, offset + pos, maxlen - pos);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    int32_t __name_len__;
+    tlen = __int32_t_decode_array(
+        buf, offset + pos, maxlen - pos, &__name_len__, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+    if(__name_len__ < 1 || __name_len__ > maxlen - pos) return -1;
+    this->name.assign(
+        static_cast<const char*>(buf) + offset + pos, __name_len__ - 1);
+    pos += __name_len__;
+
+    int32_t __description_len__;
+    tlen = __int32_t_decode_array(
+        buf, offset + pos, maxlen - pos, &__description_len__, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+    if(__description_len__ < 1 || __description_len__ > maxlen - pos) return -1;
+    this->description.assign(
+        static_cast<const char*>(buf) + offset + pos, __description_len__ - 1);
+    pos += __description_len__;
+
+    tlen = __float_decode_array(buf, offset + pos, maxlen - pos, &this->scale, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    if(this->menu_entries_length < 0 || this->menu_entries_length > (maxlen - pos) / 19 || this->menu_entries_length > maxArrayLength) return -1;
+    try {
+        this->menu_entries.resize(this->menu_entries_length);
+    } catch (...) {
+        return -1;
+    }
+    for (int a0 = 0; a0 < this->menu_entries_length; a0++) {
+        tlen = this->menu_entries[a0]._decodeNoHash(buf, offset + pos, maxlen - pos);
+        if(tlen < 0) return tlen; else pos += tlen;
+    }
+
+    if(this->controls_length < 0 || this->controls_length > (maxlen - pos) / 50 || this->controls_length > maxArrayLength) return -1;
+    try {
+        this->controls.resize(this->controls_length);
+    } catch (...) {
+        return -1;
+    }
+    for (int a0 = 0; a0 < this->controls_length; a0++) {
+        tlen = this->controls[a0]._decodeNoHash(buf, offset + pos, maxlen - pos);
+        if(tlen < 0) return tlen; else pos += tlen;
+    }
+
+    return pos;
+}
+
+template <uint64_t Mask>
+int InteractiveMarker::_decodeFieldsNoHash(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, tlen;
+
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &this->menu_entries_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &this->controls_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    if ((Mask & Fields::header) != 0) {
+        tlen = this->header._decodeNoHash(buf, offset + pos, maxlen - pos);
+        if(tlen < 0) return tlen; else pos += tlen;
+    } else {
+        tlen = std_msgs::pmr::Header::_skipNoHash(buf, offset + pos, maxlen - pos);
+        if(tlen < 0) return tlen; else pos += tlen;
+    }
+
+    if ((Mask & Fields::pose) != 0) {
+        tlen = this->pose._decodeNoHash(buf, offset + pos, maxlen - pos);
+        if(tlen < 0) return tlen; else pos += tlen;
+    } else {
+        tlen = geometry_msgs::pmr::Pose::_skipNoHash(buf, offset + pos, maxlen - pos);
+        if(tlen < 0) return tlen; else pos += tlen;
+    }
+
+    if ((Mask & Fields::name) != 0) {
+        int32_t __name_len__;
+        tlen = __int32_t_decode_array(
+            buf, offset + pos, maxlen - pos, &__name_len__, 1);
+        if(tlen < 0) return tlen; else pos += tlen;
+        if(__name_len__ < 1 || __name_len__ > maxlen - pos) return -1;
+        this->name.assign(
+            static_cast<const char*>(buf) + offset + pos, __name_len__ - 1);
+        pos += __name_len__;
+    } else {
+        int32_t __name_len__;
+        tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &__name_len__, 1);
+        if(tlen < 0) return tlen; else pos += tlen;
+        if(__name_len__ < 0 || __name_len__ > maxlen - pos) return -1;
+        pos += __name_len__;
+    }
+
+    if ((Mask & Fields::description) != 0) {
+        int32_t __description_len__;
+        tlen = __int32_t_decode_array(
+            buf, offset + pos, maxlen - pos, &__description_len__, 1);
+        if(tlen < 0) return tlen; else pos += tlen;
+        if(__description_len__ < 1 || __description_len__ > maxlen - pos) return -1;
+        this->description.assign(
+            static_cast<const char*>(buf) + offset + pos, __description_len__ - 1);
+        pos += __description_len__;
+    } else {
+        int32_t __description_len__;
+        tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &__description_len__, 1);
+        if(tlen < 0) return tlen; else pos += tlen;
+        if(__description_len__ < 0 || __description_len__ > maxlen - pos) return -1;
+        pos += __description_len__;
+    }
+
+    tlen = __float_decode_array(buf, offset + pos, maxlen - pos, &this->scale, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    if ((Mask & Fields::menu_entries) != 0) {
+        if(this->menu_entries_length < 0 || this->menu_entries_length > (maxlen - pos) / 19 || this->menu_entries_length > maxArrayLength) return -1;
+        try {
+            this->menu_entries.resize(this->menu_entries_length);
+        } catch (...) {
+            return -1;
+        }
+        for (int a0 = 0; a0 < this->menu_entries_length; a0++) {
+            tlen = this->menu_entries[a0]._decodeNoHash(buf, offset + pos, maxlen - pos);
+            if(tlen < 0) return tlen; else pos += tlen;
+        }
+    } else {
+        if(this->menu_entries_length < 0) return -1;
+        for (int a0 = 0; a0 < this->menu_entries_length; a0++) {
+            tlen = visualization_msgs::pmr::MenuEntry::_skipNoHash(buf, offset + pos, maxlen - pos);
+            if(tlen < 0) return tlen; else pos += tlen;
+        }
+    }
+
+    if ((Mask & Fields::controls) != 0) {
+        if(this->controls_length < 0 || this->controls_length > (maxlen - pos) / 50 || this->controls_length > maxArrayLength) return -1;
+        try {
+            this->controls.resize(this->controls_length);
+        } catch (...) {
+            return -1;
+        }
+        for (int a0 = 0; a0 < this->controls_length; a0++) {
+            tlen = this->controls[a0]._decodeNoHash(buf, offset + pos, maxlen - pos);
+            if(tlen < 0) return tlen; else pos += tlen;
+        }
+    } else {
+        if(this->controls_length < 0) return -1;
+        for (int a0 = 0; a0 < this->controls_length; a0++) {
+            tlen = visualization_msgs::pmr::InteractiveMarkerControl::_skipNoHash(buf, offset + pos, maxlen - pos);
+            if(tlen < 0) return tlen; else pos += tlen;
+        }
+    }
+
+    return pos;
+}
+
+int InteractiveMarker::_getEncodedSizeNoHash() const
+{
+    int enc_size = 0;
+    enc_size += __int32_t_encoded_array_size(NULL, 1);
+    enc_size += __int32_t_encoded_array_size(NULL, 1);
+    enc_size += this->header._getEncodedSizeNoHash();
+    enc_size += this->pose._getEncodedSizeNoHash();
+    enc_size += this->name.size() + 4 + 1;
+    enc_size += this->description.size() + 4 + 1;
+    enc_size += __float_encoded_array_size(NULL, 1);
+    for (int a0 = 0; a0 < this->menu_entries_length; a0++) {
+        enc_size += this->menu_entries[a0]._getEncodedSizeNoHash();
+    }
+    for (int a0 = 0; a0 < this->controls_length; a0++) {
+        enc_size += this->controls[a0]._getEncodedSizeNoHash();
+    }
+    return enc_size;
+}
+
+int InteractiveMarker::_skipNoHash(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, tlen;
+    int32_t menu_entries_length;
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &menu_entries_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+    int32_t controls_length;
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &controls_length, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+    tlen = std_msgs::pmr::Header::_skipNoHash(buf, offset + pos, maxlen - pos);
+    if(tlen < 0) return tlen; else pos += tlen;
+    tlen = geometry_msgs::pmr::Pose::_skipNoHash(buf, offset + pos, maxlen - pos);
+    if(tlen < 0) return tlen; else pos += tlen;
+    int32_t __name_len__;
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &__name_len__, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+    if(__name_len__ < 0 || __name_len__ > maxlen - pos) return -1;
+    pos += __name_len__;
+    int32_t __description_len__;
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &__description_len__, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+    if(__description_len__ < 0 || __description_len__ > maxlen - pos) return -1;
+    pos += __description_len__;
+    pos += 4;
+    if(menu_entries_length < 0) return -1;
+    for (int a0 = 0; a0 < menu_entries_length; a0++) {
+        tlen = visualization_msgs::pmr::MenuEntry::_skipNoHash(buf, offset + pos, maxlen - pos);
+        if(tlen < 0) return tlen; else pos += tlen;
+    }
+    if(controls_length < 0) return -1;
+    for (int a0 = 0; a0 < controls_length; a0++) {
+        tlen = visualization_msgs::pmr::InteractiveMarkerControl::_skipNoHash(buf, offset + pos, maxlen - pos);
+        if(tlen < 0) return tlen; else pos += tlen;
+    }
+    if(pos > maxlen) return -1;
+    return pos;
+}
+
+template <typename Self, typename Visitor>
+void InteractiveMarker::_forEachField(Self &self, Visitor &visitor)
+{
+    visitor(kFields[0], self.menu_entries_length);
+    visitor(kFields[1], self.controls_length);
+    visitor(kFields[2], self.header);
+    visitor(kFields[3], self.pose);
+    visitor(kFields[4], self.name);
+    visitor(kFields[5], self.description);
+    visitor(kFields[6], self.scale);
+    visitor(kFields[7], self.menu_entries);
+    visitor(kFields[8], self.controls);
+}
+
+uint64_t InteractiveMarker::_computeHash(const __lcm_hash_ptr *p)
+{
+    const __lcm_hash_ptr *fp;
+    for(fp = p; fp != NULL; fp = fp->parent)
+        if(fp->v == InteractiveMarker::getHash)
+            return 0;
+    const __lcm_hash_ptr cp = { p, InteractiveMarker::getHash };
+
+    uint64_t hash = 0xe9ed8e5f9a72545fLL +
+         std_msgs::pmr::Header::_computeHash(&cp) +
+         geometry_msgs::pmr::Pose::_computeHash(&cp) +
+         visualization_msgs::pmr::MenuEntry::_computeHash(&cp) +
+         visualization_msgs::pmr::InteractiveMarkerControl::_computeHash(&cp);
+
+    return (hash<<1) + ((hash>>63)&1);
+}
+
+}
+}
+
+#endif
@@ -0,0 +1,631 @@
+/** THIS IS AN AUTOMATICALLY GENERATED FILE.  DO NOT MODIFY
+ * BY HAND!!
+ *
+ * Generated by lcm-cpp (tools/cpp/gen)
+ **/
+
+#ifndef __visualization_msgs_pmr_InteractiveMarkerFeedback_hpp__
+#define __visualization_msgs_pmr_InteractiveMarkerFeedback_hpp__
+
+#include <lcm/lcm_coretypes.h>
+
+#include <array>
+#include <memory_resource>
+#include <utility>
+#include <string>
+#include "dimos_lcm/writer.hpp"
+#include "dimos_lcm/fingerprint.hpp"
+#include "dimos_lcm/reflection.hpp"
+#include "std_msgs/pmr/Header.hpp"
+#include "geometry_msgs/pmr/Pose.hpp"
+#include "geometry_msgs/pmr/Point.hpp"
+#if __cplusplus >= 201703L
+#include "std_msgs/HeaderView.hpp"
+#endif
+
+namespace visualization_msgs
+{
+namespace pmr
+{
+
+class InteractiveMarkerFeedback
+{
+    public:
+        std_msgs::pmr::Header header;
+
+        std::pmr::string client_id;
+
+        std::pmr::string marker_name;
+
+        std::pmr::string control_name;
+
+        uint8_t    event_type;
+
+        geometry_msgs::pmr::Pose pose;
+
+        int32_t    menu_entry_id;
+
+        geometry_msgs::pmr::Point mouse_point;
+
+        int8_t     mouse_point_valid;
+
+    public:
+        // If you're using C++11 and are getting compiler errors saying
+        // things like ‘constexpr’ needed for in-class initialization of
+        // static data member then re-run lcm-gen with '--cpp-std=c++11'
+        // to generate code that is compliant with C++11
+        static const int8_t   KEEP_ALIVE = 0;
+        // If you're using C++11 and are getting compiler errors saying
+        // things like ‘constexpr’ needed for in-class initialization of
+        // static data member then re-run lcm-gen with '--cpp-std=c++11'
+        // to generate code that is compliant with C++11
+        static const int8_t   POSE_UPDATE = 1;
+        // If you're using C++11 and are getting compiler errors saying
+        // things like ‘constexpr’ needed for in-class initialization of
+        // static data member then re-run lcm-gen with '--cpp-std=c++11'
+        // to generate code that is compliant with C++11
+        static const int8_t   MENU_SELECT = 2;
+        // If you're using C++11 and are getting compiler errors saying
+        // things like ‘constexpr’ needed for in-class initialization of
+        // static data member then re-run lcm-gen with '--cpp-std=c++11'
+        // to generate code that is compliant with C++11
+        static const int8_t   BUTTON_CLICK = 3;
+        // If you're using C++11 and are getting compiler errors saying
+        // things like ‘constexpr’ needed for in-class initialization of
+        // static data member then re-run lcm-gen with '--cpp-std=c++11'
+        // to generate code that is compliant with C++11
+        static const int8_t   MOUSE_DOWN = 4;
+        // If you're using C++11 and are getting compiler errors saying
+        // things like ‘constexpr’ needed for in-class initialization of
+        // static data member then re-run lcm-gen with '--cpp-std=c++11'
+        // to generate code that is compliant with C++11
+        static const int8_t   MOUSE_UP = 5;
+
+    public:
+        typedef std::pmr::polymorphic_allocator<char> allocator_type;
+
+        /**
+         * Construct a message whose strings and arrays, and those of the
+         * messages it nests, allocate from @p alloc. Scalars are zeroed.
+         */
+        inline explicit InteractiveMarkerFeedback(const allocator_type &alloc = allocator_type());
+
+        /**
+         * Copy or move @p other into a message that allocates from @p alloc.
+         * With allocator_type, these let std::pmr containers of InteractiveMarkerFeedback pass
+         * their memory resource on to their elements.
+         */
+        inline InteractiveMarkerFeedback(const InteractiveMarkerFeedback &other, const allocator_type &alloc);
+        inline InteractiveMarkerFeedback(InteractiveMarkerFeedback &&other, const allocator_type &alloc);
+
+        /**
+         * Encode a message into binary form.
+         *
+         * @param buf The output buffer.
+         * @param offset Encoding starts at thie byte offset into @p buf.
+         * @param maxlen Maximum number of bytes to write.  This should generally be
+         *  equal to getEncodedSize().
+         * @return The number of bytes encoded, or <0 on error.
+         */
+        inline int encode(void *buf, int offset, int maxlen) const;
+
+        /**
+         * Encode a message by appending it to @p buf, walking the message once
+         * instead of sizing it with getEncodedSize() first. @p buf grows
+         * geometrically; reuse it across calls to avoid reallocating.
+         *
+         * @return The number of bytes appended.
+         */
+        inline int encodeTo(std::vector<uint8_t> &buf) const;
+
+        /**
+         * Check how many bytes are required to encode this message.
+         */
+        inline int getEncodedSize() const;
+
+        /**
+         * Decode a message from binary form into this instance.
+         *
+         * @param buf The buffer containing the encoded message.
+         * @param offset The byte offset into @p buf where the encoded message starts.
+         * @param maxlen The maximum number of bytes to read while decoding.
+         * @return The number of bytes decoded, or <0 if an error occured.
+         */
+        inline int decode(const void *buf, int offset, int maxlen);
+
+#if __cplusplus >= 201703L
+        /**
+         * Decode only the header field of an encoded message, leaving the
+         * rest of it untouched. The field sits at a fixed offset, so this costs
+         * the same for any payload size. The view points into @p buf.
+         *
+         * @param buf The buffer containing the encoded message.
+         * @param offset The byte offset into @p buf where the encoded message starts.
+         * @param maxlen The maximum number of bytes to read while decoding.
+         * @param header Receives the decoded header.
+         * @return The number of bytes of the field decoded, or <0 if @p buf does
+         *  not hold a InteractiveMarkerFeedback or is truncated.
+         *
+         * Needs C++17, for the std::string_view of the view.
+         */
+        inline static int peekHeader(const void *buf, int offset, int maxlen, std_msgs::HeaderView &header);
+#endif
+
+        /**
+         * Field bits for decodeFields().
+         */
+        struct Fields
+        {
+            static constexpr uint64_t header = 1ULL << 0;
+            static constexpr uint64_t client_id = 1ULL << 1;
+            static constexpr uint64_t marker_name = 1ULL << 2;
+            static constexpr uint64_t control_name = 1ULL << 3;
+            static constexpr uint64_t event_type = 1ULL << 4;
+            static constexpr uint64_t pose = 1ULL << 5;
+            static constexpr uint64_t menu_entry_id = 1ULL << 6;
+            static constexpr uint64_t mouse_point = 1ULL << 7;
+            static constexpr uint64_t mouse_point_valid = 1ULL << 8;
+            static constexpr uint64_t all = (1ULL << 9) - 1;
+        };
+
+        /**
+         * Decode only the fields selected by @p Mask, a bitwise or of Fields
+         * values. Strings, arrays and nested structs that are not selected are
+         * skipped over by their length prefixes without being allocated, and
+         * keep their previous value. Scalar fields are always decoded: they
+         * cost nothing to read and array lengths depend on them.
+         *
+         * @return The number of bytes decoded, or <0 if an error occured.
+         */
+        template <uint64_t Mask>
+        inline int decodeFields(const void *buf, int offset, int maxlen);
+
+        /**
+         * Retrieve the 64-bit fingerprint identifying the structure of the message.
+         * Note that the fingerprint is the same for all instances of the same
+         * message type, and is a fingerprint on the message type definition, not on
+         * the message contents.
+         */
+        inline static int64_t getHash();
+
+        /**
+         * The fingerprint returned by getHash(), as a compile-time constant.
+         */
+        static constexpr int64_t kHash = static_cast<int64_t>(0xadfb8c240a6a7905ULL);
+
+        /**
+         * Returns "InteractiveMarkerFeedback"
+         */
+        inline static const char* getTypeName();
+
+        /**
+         * Name, LCM type and array dimensions of each field, in wire order.
+         * See dimos_lcm::for_each_field() for visiting the fields themselves.
+         */
+        static constexpr std::array<dimos_lcm::field_info, 9> kFields = {{
+            { "header", "std_msgs.Header", false, 0, 0, NULL },
+            { "client_id", "string", true, 0, 0, NULL },
+            { "marker_name", "string", true, 0, 0, NULL },
+            { "control_name", "string", true, 0, 0, NULL },
+            { "event_type", "byte", true, 0, 0, NULL },
+            { "pose", "geometry_msgs.Pose", false, 0, 0, NULL },
+            { "menu_entry_id", "int32_t", true, 0, 0, NULL },
+            { "mouse_point", "geometry_msgs.Point", false, 0, 0, NULL },
+            { "mouse_point_valid", "boolean", true, 0, 0, NULL },
+        }};
+
+        // LCM support functions. Users should not call these
+        inline int _encodeNoHash(void *buf, int offset, int maxlen) const;
+        template <typename Writer>
+        inline void _writeNoHash(Writer &out) const;
+        inline int _getEncodedSizeNoHash() const;
+        inline int _decodeNoHash(const void *buf, int offset, int maxlen);
+        template <uint64_t Mask>
+        inline int _decodeFieldsNoHash(const void *buf, int offset, int maxlen);
+        template <typename Self, typename Visitor>
+        inline static void _forEachField(Self &self, Visitor &visitor);
+        inline static int _skipNoHash(const void *buf, int offset, int maxlen);
+        inline static uint64_t _computeHash(const __lcm_hash_ptr *p);
+};
+
+static_assert(InteractiveMarkerFeedback::kHash == dimos_lcm::fingerprint(
+    dimos_lcm::signature_hash()
+        .member("header", NULL, 0)
+        .member("client_id", "string", 0)
+        .member("marker_name", "string", 0)
+        .member("control_name", "string", 0)
+        .member("event_type", "byte", 0)
+        .member("pose", NULL, 0)
+        .member("menu_entry_id", "int32_t", 0)
+        .member("mouse_point", NULL, 0)
+        .member("mouse_point_valid", "boolean", 0)
+        .value(),
+    std_msgs::pmr::Header::kHash,
+    geometry_msgs::pmr::Pose::kHash,
+    geometry_msgs::pmr::Point::kHash),
+    "visualization_msgs::pmr::InteractiveMarkerFeedback fingerprint does not match its definition");
+
+InteractiveMarkerFeedback::InteractiveMarkerFeedback(const allocator_type &alloc) :
+    header(alloc),
+    client_id(alloc),
+    marker_name(alloc),
+    control_name(alloc),
+    event_type(),
+    pose(),
+    menu_entry_id(),
+    mouse_point(),
+    mouse_point_valid()
+{
+}
+
+InteractiveMarkerFeedback::InteractiveMarkerFeedback(const InteractiveMarkerFeedback &other, const allocator_type &alloc) :
+    InteractiveMarkerFeedback(alloc)
+{
+    *this = other;
+}
+
+InteractiveMarkerFeedback::InteractiveMarkerFeedback(InteractiveMarkerFeedback &&other, const allocator_type &alloc) :
+    InteractiveMarkerFeedback(alloc)
+{
+    *this = std::move(other);
+}
+
+int InteractiveMarkerFeedback::encode(void *buf, int offset, int maxlen) const
+{
+    int pos = 0, tlen;
+    int64_t hash = getHash();
+
+    tlen = __int64_t_encode_array(buf, offset + pos, maxlen - pos, &hash, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = this->_encodeNoHash(buf, offset + pos, maxlen - pos);
+    if (tlen < 0) return tlen; else pos += tlen;
+
+    return pos;
+}
+
+int InteractiveMarkerFeedback::encodeTo(std::vector<uint8_t> &buf) const
+{
+    dimos_lcm::vector_writer out(buf);
+    int64_t hash = getHash();
+    out.put(&hash, 1);
+    this->_writeNoHash(out);
+    return static_cast<int>(out.size());
+}
+
+int InteractiveMarkerFeedback::decode(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, thislen;
+
+    int64_t msg_hash;
+    thislen = __int64_t_decode_array(buf, offset + pos, maxlen - pos, &msg_hash, 1);
+    if (thislen < 0) return thislen; else pos += thislen;
+    if (msg_hash != getHash()) return -1;
+
+    thislen = this->_decodeNoHash(buf, offset + pos, maxlen - pos);
+    if (thislen < 0) return thislen; else pos += thislen;
+
+    return pos;
+}
+
+#if __cplusplus >= 201703L
+int InteractiveMarkerFeedback::peekHeader(const void *buf, int offset, int maxlen, std_msgs::HeaderView &header)
+{
+    int64_t msg_hash;
+    if (__int64_t_decode_array(buf, offset, maxlen, &msg_hash, 1) < 0) return -1;
+    if (msg_hash != kHash) return -1;
+
+    // header follows the hash and 0 bytes of fixed-size fields
+    return header._decodeNoHash(buf, offset + 8, maxlen - 8);
+}
+#endif
+
+template <uint64_t Mask>
+int InteractiveMarkerFeedback::decodeFields(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, thislen;
+
+    int64_t msg_hash;
+    thislen = __int64_t_decode_array(buf, offset + pos, maxlen - pos, &msg_hash, 1);
+    if (thislen < 0) return thislen; else pos += thislen;
+    if (msg_hash != getHash()) return -1;
+
+    thislen = this->_decodeFieldsNoHash<Mask>(buf, offset + pos, maxlen - pos);
+    if (thislen < 0) return thislen; else pos += thislen;
+
+    return pos;
+}
+
+int InteractiveMarkerFeedback::getEncodedSize() const
+{
+    return 8 + _getEncodedSizeNoHash();
+}
+
+int64_t InteractiveMarkerFeedback::getHash()
+{
+    return kHash;
+}
+
+const char* InteractiveMarkerFeedback::getTypeName()
+{
+    return "InteractiveMarkerFeedback";
+}
+
+int InteractiveMarkerFeedback::_encodeNoHash(void *buf, int offset, int maxlen) const
+{
+    int pos = 0, tlen;
+
+    tlen = this->header._encodeNoHash(buf, offset + pos, maxlen - pos);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    char* client_id_cstr = const_cast<char*>(this->client_id.c_str());
+    tlen = __string_encode_array(
+        buf, offset + pos, maxlen - pos, &client_id_cstr, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    char* marker_name_cstr = const_cast<char*>(this->marker_name.c_str());
+    tlen = __string_encode_array(
+        buf, offset + pos, maxlen - pos, &marker_name_cstr, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    char* control_name_cstr = const_cast<char*>(this->control_name.c_str());
+    tlen = __string_encode_array(
+        buf, offset + pos, maxlen - pos, &control_name_cstr, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = __byte_encode_array(buf, offset + pos, maxlen - pos, &this->event_type, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = this->pose._encodeNoHash(buf, offset + pos, maxlen - pos);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = __int32_t_encode_array(buf, offset + pos, maxlen - pos, &this->menu_entry_id, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = this->mouse_point._encodeNoHash(buf, offset + pos, maxlen - pos);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = __boolean_encode_array(buf, offset + pos, maxlen - pos, &this->mouse_point_valid, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    return pos;
+}
+
+template <typename Writer>
+void InteractiveMarkerFeedback::_writeNoHash(Writer &out) const
+{
+    this->header._writeNoHash(out);
+    out.put(this->client_id);
+    out.put(this->marker_name);
+    out.put(this->control_name);
+    out.put(&this->event_type, 1);
+    this->pose._writeNoHash(out);
+    out.put(&this->menu_entry_id, 1);
+    this->mouse_point._writeNoHash(out);
+    out.put(&this->mouse_point_valid, 1);
+}
+
+int InteractiveMarkerFeedback::_decodeNoHash(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, tlen;
+
+    tlen = this->header._decodeNoHash(buf, offset + pos, maxlen - pos);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    int32_t __client_id_len__;
+    tlen = __int32_t_decode_array(
+        buf, offset + pos, maxlen - pos, &__client_id_len__, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+    if(__client_id_len__ < 1 || __client_id_len__ > maxlen - pos) return -1;
+    this->client_id.assign(
+        static_cast<const char*>(buf) + offset + pos, __client_id_len__ - 1);
+    pos += __client_id_len__;
+
+    int32_t __marker_name_len__;
+    tlen = __int32_t_decode_array(
+        buf, offset + pos, maxlen - pos, &__marker_name_len__, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+    if(__marker_name_len__ < 1 || __marker_name_len__ > maxlen - pos) return -1;
+    this->marker_name.assign(
+        static_cast<const char*>(buf) + offset + pos, __marker_name_len__ - 1);
+    pos += __marker_name_len__;
+
+    int32_t __control_name_len__;
+    tlen = __int32_t_decode_array(
+        buf, offset + pos, maxlen - pos, &__control_name_len__, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+    if(__control_name_len__ < 1 || __control_name_len__ > maxlen - pos) return -1;
+    this->control_name.assign(
+        static_cast<const char*>(buf) + offset + pos, __control_name_len__ - 1);
+    pos += __control_name_len__;
+
+    tlen = __byte_decode_array(buf, offset + pos, maxlen - pos, &this->event_type, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = this->pose._decodeNoHash(buf, offset + pos, maxlen - pos);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &this->menu_entry_id, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = this->mouse_point._decodeNoHash(buf, offset + pos, maxlen - pos);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = __boolean_decode_array(buf, offset + pos, maxlen - pos, &this->mouse_point_valid, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    return pos;
+}
+
+template <uint64_t Mask>
+int InteractiveMarkerFeedback::_decodeFieldsNoHash(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, tlen;
+
+    if ((Mask & Fields::header) != 0) {
+        tlen = this->header._decodeNoHash(buf, offset + pos, maxlen - pos);
+        if(tlen < 0) return tlen; else pos += tlen;
+    } else {
+        tlen = std_msgs::pmr::Header::_skipNoHash(buf, offset + pos, maxlen - pos);
+        if(tlen < 0) return tlen; else pos += tlen;
+    }
+
+    if ((Mask & Fields::client_id) != 0) {
+        int32_t __client_id_len__;
+        tlen = __int32_t_decode_array(
+            buf, offset + pos, maxlen - pos, &__client_id_len__, 1);
+        if(tlen < 0) return tlen; else pos += tlen;
+        if(__client_id_len__ < 1 || __client_id_len__ > maxlen - pos) return -1;
+        this->client_id.assign(
+            static_cast<const char*>(buf) + offset + pos, __client_id_len__ - 1);
+        pos += __client_id_len__;
+    } else {
+        int32_t __client_id_len__;
+        tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &__client_id_len__, 1);
+        if(tlen < 0) return tlen; else pos += tlen;
+        if(__client_id_len__ < 0 || __client_id_len__ > maxlen - pos) return -1;
+        pos += __client_id_len__;
+    }
+
+    if ((Mask & Fields::marker_name) != 0) {
+        int32_t __marker_name_len__;
+        tlen = __int32_t_decode_array(
+            buf, offset + pos, maxlen - pos, &__marker_name_len__, 1);
+        if(tlen < 0) return tlen; else pos += tlen;
+        if(__marker_name_len__ < 1 || __marker_name_len__ > maxlen - pos) return -1;
+        this->marker_name.assign(
+            static_cast<const char*>(buf) + offset + pos, __marker_name_len__ - 1);
+        pos += __marker_name_len__;
+    } else {
+        int32_t __marker_name_len__;
+        tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &__marker_name_len__, 1);
+        if(tlen < 0) return tlen; else pos += tlen;
+        if(__marker_name_len__ < 0 || __marker_name_len__ > maxlen - pos) return -1;
+        pos += __marker_name_len__;
+    }
+
+    if ((Mask & Fields::control_name) != 0) {
+        int32_t __control_name_len__;
+        tlen = __int32_t_decode_array(
+            buf, offset + pos, maxlen - pos, &__control_name_len__, 1);
+        if(tlen < 0) return tlen; else pos += tlen;
+        if(__control_name_len__ < 1 || __control_name_len__ > maxlen - pos) return -1;
+        this->control_name.assign(
+            static_cast<const char*>(buf) + offset + pos, __control_name_len__ - 1);
+        pos += __control_name_len__;
+    } else {
+        int32_t __control_name_len__;
+        tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &__control_name_len__, 1);
+        if(tlen < 0) return tlen; else pos += tlen;
+        if(__control_name_len__ < 0 || __control_name_len__ > maxlen - pos) return -1;
+        pos += __control_name_len__;
+    }
+
+    tlen = __byte_decode_array(buf, offset + pos, maxlen - pos, &this->event_type, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    if ((Mask & Fields::pose) != 0) {
+        tlen = this->pose._decodeNoHash(buf, offset + pos, maxlen - pos);
+        if(tlen < 0) return tlen; else pos += tlen;
+    } else {
+        tlen = geometry_msgs::pmr::Pose::_skipNoHash(buf, offset + pos, maxlen - pos);
+        if(tlen < 0) return tlen; else pos += tlen;
+    }
+
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &this->menu_entry_id, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    if ((Mask & Fields::mouse_point) != 0) {
+        tlen = this->mouse_point._decodeNoHash(buf, offset + pos, maxlen - pos);
+        if(tlen < 0) return tlen; else pos += tlen;
+    } else {
+        tlen = geometry_msgs::pmr::Point::_skipNoHash(buf, offset + pos, maxlen - pos);
+        if(tlen < 0) return tlen; else pos += tlen;
+    }
+
+    tlen = __boolean_decode_array(buf, offset + pos, maxlen - pos, &this->mouse_point_valid, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    return pos;
+}
+
+int InteractiveMarkerFeedback::_getEncodedSizeNoHash() const
+{
+    int enc_size = 0;
+    enc_size += this->header._getEncodedSizeNoHash();
+    enc_size += this->client_id.size() + 4 + 1;
+    enc_size += this->marker_name.size() + 4 + 1;
+    enc_size += this->control_name.size() + 4 + 1;
+    enc_size += __byte_encoded_array_size(NULL, 1);
+    enc_size += this->pose._getEncodedSizeNoHash();
+    enc_size += __int32_t_encoded_array_size(NULL, 1);
+    enc_size += this->mouse_point._getEncodedSizeNoHash();
+    enc_size += __boolean_encoded_array_size(NULL, 1);
+    return enc_size;
+}
+
+int InteractiveMarkerFeedback::_skipNoHash(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, tlen;
+    tlen = std_msgs::pmr::Header::_skipNoHash(buf, offset + pos, maxlen - pos);
+    if(tlen < 0) return tlen; else pos += tlen;
+    int32_t __client_id_len__;
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &__client_id_len__, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+    if(__client_id_len__ < 0 || __client_id_len__ > maxlen - pos) return -1;
+    pos += __client_id_len__;
+    int32_t __marker_name_len__;
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &__marker_name_len__, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+    if(__marker_name_len__ < 0 || __marker_name_len__ > maxlen - pos) return -1;
+    pos += __marker_name_len__;
+    int32_t __control_name_len__;
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &__control_name_len__, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+    if(__control_name_len__ < 0 || __control_name_len__ > maxlen - pos) return -1;
+    pos += __control_name_len__;
+    pos += 1;
+    tlen = geometry_msgs::pmr::Pose::_skipNoHash(buf, offset + pos, maxlen - pos);
+    if(tlen < 0) return tlen; else pos += tlen;
+    pos += 4;
+    tlen = geometry_msgs::pmr::Point::_skipNoHash(buf, offset + pos, maxlen - pos);
+    if(tlen < 0) return tlen; else pos += tlen;
+    pos += 1;
+    if(pos > maxlen) return -1;
+    return pos;
+}
+
+template <typename Self, typename Visitor>
+void InteractiveMarkerFeedback::_forEachField(Self &self, Visitor &visitor)
+{
+    visitor(kFields[0], self.header);
+    visitor(kFields[1], self.client_id);
+    visitor(kFields[2], self.marker_name);
+    visitor(kFields[3], self.control_name);
+    visitor(kFields[4], self.event_type);
+    visitor(kFields[5], self.pose);
+    visitor(kFields[6], self.menu_entry_id);
+    visitor(kFields[7], self.mouse_point);
+    visitor(kFields[8], self.mouse_point_valid);
+}
+
+uint64_t InteractiveMarkerFeedback::_computeHash(const __lcm_hash_ptr *p)
+{
+    const __lcm_hash_ptr *fp;
+    for(fp = p; fp != NULL; fp = fp->parent)
+        if(fp->v == InteractiveMarkerFeedback::getHash)
+            return 0;
+    const __lcm_hash_ptr cp = { p, InteractiveMarkerFeedback::getHash };
+
+    uint64_t hash = 0xd44e20643fb0d4f7LL +
+         std_msgs::pmr::Header::_computeHash(&cp) +
+         geometry_msgs::pmr::Pose::_computeHash(&cp) +
+         geometry_msgs::pmr::Point::_computeHash(&cp);
+
+    return (hash<<1) + ((hash>>63)&1);
+}
+
+}
+}
+
+#endif
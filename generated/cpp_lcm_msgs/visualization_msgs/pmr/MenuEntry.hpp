@@ -0,0 +1,447 @@
+/** THIS IS AN AUTOMATICALLY GENERATED FILE.  DO NOT MODIFY
+ * BY HAND!!
+ *
+ * Generated by lcm-cpp (tools/cpp/gen)
+ **/
+
+#ifndef __visualization_msgs_pmr_MenuEntry_hpp__
+#define __visualization_msgs_pmr_MenuEntry_hpp__
+
+#include <lcm/lcm_coretypes.h>
+
+#include <array>
+#include <memory_resource>
+#include <utility>
+#include <string>
+#include "dimos_lcm/writer.hpp"
+#include "dimos_lcm/fingerprint.hpp"
+#include "dimos_lcm/reflection.hpp"
+
+namespace visualization_msgs
+{
+namespace pmr
+{
+
+class MenuEntry
+{
+    public:
+        int32_t    id;
+
+        int32_t    parent_id;
+
+        std::pmr::string title;
+
+        std::pmr::string command;
+
+        uint8_t    command_type;
+
+    public:
+        // If you're using C++11 and are getting compiler errors saying
+        // things like ‘constexpr’ needed for in-class initialization of
+        // static data member then re-run lcm-gen with '--cpp-std=c++11'
+        // to generate code that is compliant with C++11
+        static const int8_t   FEEDBACK = 0;
+        // If you're using C++11 and are getting compiler errors saying
+        // things like ‘constexpr’ needed for in-class initialization of
+        // static data member then re-run lcm-gen with '--cpp-std=c++11'
+        // to generate code that is compliant with C++11
+        static const int8_t   ROSRUN = 1;
+        // If you're using C++11 and are getting compiler errors saying
+        // things like ‘constexpr’ needed for in-class initialization of
+        // static data member then re-run lcm-gen with '--cpp-std=c++11'
+        // to generate code that is compliant with C++11
+        static const int8_t   ROSLAUNCH = 2;
+
+    public:
+        typedef std::pmr::polymorphic_allocator<char> allocator_type;
+
+        /**
+         * Construct a message whose strings and arrays, and those of the
+         * messages it nests, allocate from @p alloc. Scalars are zeroed.
+         */
+        inline explicit MenuEntry(const allocator_type &alloc = allocator_type());
+
+        /**
+         * Copy or move @p other into a message that allocates from @p alloc.
+         * With allocator_type, these let std::pmr containers of MenuEntry pass
+         * their memory resource on to their elements.
+         */
+        inline MenuEntry(const MenuEntry &other, const allocator_type &alloc);
+        inline MenuEntry(MenuEntry &&other, const allocator_type &alloc);
+
+        /**
+         * Encode a message into binary form.
+         *
+         * @param buf The output buffer.
+         * @param offset Encoding starts at thie byte offset into @p buf.
+         * @param maxlen Maximum number of bytes to write.  This should generally be
+         *  equal to getEncodedSize().
+         * @return The number of bytes encoded, or <0 on error.
+         */
+        inline int encode(void *buf, int offset, int maxlen) const;
+
+        /**
+         * Encode a message by appending it to @p buf, walking the message once
+         * instead of sizing it with getEncodedSize() first. @p buf grows
+         * geometrically; reuse it across calls to avoid reallocating.
+         *
+         * @return The number of bytes appended.
+         */
+        inline int encodeTo(std::vector<uint8_t> &buf) const;
+
+        /**
+         * Check how many bytes are required to encode this message.
+         */
+        inline int getEncodedSize() const;
+
+        /**
+         * Decode a message from binary form into this instance.
+         *
+         * @param buf The buffer containing the encoded message.
+         * @param offset The byte offset into @p buf where the encoded message starts.
+         * @param maxlen The maximum number of bytes to read while decoding.
+         * @return The number of bytes decoded, or <0 if an error occured.
+         */
+        inline int decode(const void *buf, int offset, int maxlen);
+
+        /**
+         * Field bits for decodeFields().
+         */
+        struct Fields
+        {
+            static constexpr uint64_t id = 1ULL << 0;
+            static constexpr uint64_t parent_id = 1ULL << 1;
+            static constexpr uint64_t title = 1ULL << 2;
+            static constexpr uint64_t command = 1ULL << 3;
+            static constexpr uint64_t command_type = 1ULL << 4;
+            static constexpr uint64_t all = (1ULL << 5) - 1;
+        };
+
+        /**
+         * Decode only the fields selected by @p Mask, a bitwise or of Fields
+         * values. Strings, arrays and nested structs that are not selected are
+         * skipped over by their length prefixes without being allocated, and
+         * keep their previous value. Scalar fields are always decoded: they
+         * cost nothing to read and array lengths depend on them.
+         *
+         * @return The number of bytes decoded, or <0 if an error occured.
+         */
+        template <uint64_t Mask>
+        inline int decodeFields(const void *buf, int offset, int maxlen);
+
+        /**
+         * Retrieve the 64-bit fingerprint identifying the structure of the message.
+         * Note that the fingerprint is the same for all instances of the same
+         * message type, and is a fingerprint on the message type definition, not on
+         * the message contents.
+         */
+        inline static int64_t getHash();
+
+        /**
+         * The fingerprint returned by getHash(), as a compile-time constant.
+         */
+        static constexpr int64_t kHash = static_cast<int64_t>(0xccf65a2bde07d2e4ULL);
+
+        /**
+         * Returns "MenuEntry"
+         */
+        inline static const char* getTypeName();
+
+        /**
+         * Name, LCM type and array dimensions of each field, in wire order.
+         * See dimos_lcm::for_each_field() for visiting the fields themselves.
+         */
+        static constexpr std::array<dimos_lcm::field_info, 5> kFields = {{
+            { "id", "int32_t", true, 0, 0, NULL },
+            { "parent_id", "int32_t", true, 0, 0, NULL },
+            { "title", "string", true, 0, 0, NULL },
+            { "command", "string", true, 0, 0, NULL },
+            { "command_type", "byte", true, 0, 0, NULL },
+        }};
+
+        // LCM support functions. Users should not call these
+        inline int _encodeNoHash(void *buf, int offset, int maxlen) const;
+        template <typename Writer>
+        inline void _writeNoHash(Writer &out) const;
+        inline int _getEncodedSizeNoHash() const;
+        inline int _decodeNoHash(const void *buf, int offset, int maxlen);
+        template <uint64_t Mask>
+        inline int _decodeFieldsNoHash(const void *buf, int offset, int maxlen);
+        template <typename Self, typename Visitor>
+        inline static void _forEachField(Self &self, Visitor &visitor);
+        inline static int _skipNoHash(const void *buf, int offset, int maxlen);
+        inline static uint64_t _computeHash(const __lcm_hash_ptr *p);
+};
+
+static_assert(MenuEntry::kHash == dimos_lcm::fingerprint(
+    dimos_lcm::signature_hash()
+        .member("id", "int32_t", 0)
+        .member("parent_id", "int32_t", 0)
+        .member("title", "string", 0)
+        .member("command", "string", 0)
+        .member("command_type", "byte", 0)
+        .value()),
+    "visualization_msgs::pmr::MenuEntry fingerprint does not match its definition");
+
+MenuEntry::MenuEntry(const allocator_type &alloc) :
+    id(),
+    parent_id(),
+    title(alloc),
+    command(alloc),
+    command_type()
+{
+}
+
+MenuEntry::MenuEntry(const MenuEntry &other, const allocator_type &alloc) :
+    MenuEntry(alloc)
+{
+    *this = other;
+}
+
+MenuEntry::MenuEntry(MenuEntry &&other, const allocator_type &alloc) :
+    MenuEntry(alloc)
+{
+    *this = std::move(other);
+}
+
+int MenuEntry::encode(void *buf, int offset, int maxlen) const
+{
+    int pos = 0, tlen;
+    int64_t hash = getHash();
+
+    tlen = __int64_t_encode_array(buf, offset + pos, maxlen - pos, &hash, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = this->_encodeNoHash(buf, offset + pos, maxlen - pos);
+    if (tlen < 0) return tlen; else pos += tlen;
+
+    return pos;
+}
+
+int MenuEntry::encodeTo(std::vector<uint8_t> &buf) const
+{
+    dimos_lcm::vector_writer out(buf);
+    int64_t hash = getHash();
+    out.put(&hash, 1);
+    this->_writeNoHash(out);
+    return static_cast<int>(out.size());
+}
+
+int MenuEntry::decode(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, thislen;
+
+    int64_t msg_hash;
+    thislen = __int64_t_decode_array(buf, offset + pos, maxlen - pos, &msg_hash, 1);
+    if (thislen < 0) return thislen; else pos += thislen;
+    if (msg_hash != getHash()) return -1;
+
+    thislen = this->_decodeNoHash(buf, offset + pos, maxlen - pos);
+    if (thislen < 0) return thislen; else pos += thislen;
+
+    return pos;
+}
+
+template <uint64_t Mask>
+int MenuEntry::decodeFields(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, thislen;
+
+    int64_t msg_hash;
+    thislen = __int64_t_decode_array(buf, offset + pos, maxlen - pos, &msg_hash, 1);
+    if (thislen < 0) return thislen; else pos += thislen;
+    if (msg_hash != getHash()) return -1;
+
+    thislen = this->_decodeFieldsNoHash<Mask>(buf, offset + pos, maxlen - pos);
+    if (thislen < 0) return thislen; else pos += thislen;
+
+    return pos;
+}
+
+int MenuEntry::getEncodedSize() const
+{
+    return 8 + _getEncodedSizeNoHash();
+}
+
+int64_t MenuEntry::getHash()
+{
+    return kHash;
+}
+
+const char* MenuEntry::getTypeName()
+{
+    return "MenuEntry";
+}
+
+int MenuEntry::_encodeNoHash(void *buf, int offset, int maxlen) const
+{
+    int pos = 0, tlen;
+
+    tlen = __int32_t_encode_array(buf, offset + pos, maxlen - pos, &this->id, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = __int32_t_encode_array(buf, offset + pos, maxlen - pos, &this->parent_id, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    char* title_cstr = const_cast<char*>(this->title.c_str());
+    tlen = __string_encode_array(
+        buf, offset + pos, maxlen - pos, &title_cstr, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    char* command_cstr = const_cast<char*>(this->command.c_str());
+    tlen = __string_encode_array(
+        buf, offset + pos, maxlen - pos, &command_cstr, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = __byte_encode_array(buf, offset + pos, maxlen - pos, &this->command_type, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    return pos;
+}
+
+template <typename Writer>
+void MenuEntry::_writeNoHash(Writer &out) const
+{
+    out.put(&this->id, 1);
+    out.put(&this->parent_id, 1);
+    out.put(this->title);
+    out.put(this->command);
+    out.put(&this->command_type, 1);
+}
+
+int MenuEntry::_decodeNoHash(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, tlen;
+
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &this->id, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &this->parent_id, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    int32_t __title_len__;
+    tlen = __int32_t_decode_array(
+        buf, offset + pos, maxlen - pos, &__title_len__, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+    if(__title_len__ < 1 || __title_len__ > maxlen - pos) return -1;
+    this->title.assign(
+        static_cast<const char*>(buf) + offset + pos, __title_len__ - 1);
+    pos += __title_len__;
+
+    int32_t __command_len__;
+    tlen = __int32_t_decode_array(
+        buf, offset + pos, maxlen - pos, &__command_len__, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+    if(__command_len__ < 1 || __command_len__ > maxlen - pos) return -1;
+    this->command.assign(
+        static_cast<const char*>(buf) + offset + pos, __command_len__ - 1);
+    pos += __command_len__;
+
+    tlen = __byte_decode_array(buf, offset + pos, maxlen - pos, &this->command_type, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    return pos;
+}
+
+template <uint64_t Mask>
+int MenuEntry::_decodeFieldsNoHash(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, tlen;
+
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &this->id, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &this->parent_id, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    if ((Mask & Fields::title) != 0) {
+        int32_t __title_len__;
+        tlen = __int32_t_decode_array(
+            buf, offset + pos, maxlen - pos, &__title_len__, 1);
+        if(tlen < 0) return tlen; else pos += tlen;
+        if(__title_len__ < 1 || __title_len__ > maxlen - pos) return -1;
+        this->title.assign(
+            static_cast<const char*>(buf) + offset + pos, __title_len__ - 1);
+        pos += __title_len__;
+    } else {
+        int32_t __title_len__;
+        tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &__title_len__, 1);
+        if(tlen < 0) return tlen; else pos += tlen;
+        if(__title_len__ < 0 || __title_len__ > maxlen - pos) return -1;
+        pos += __title_len__;
+    }
+
+    if ((Mask & Fields::command) != 0) {
+        int32_t __command_len__;
+        tlen = __int32_t_decode_array(
+            buf, offset + pos, maxlen - pos, &__command_len__, 1);
+        if(tlen < 0) return tlen; else pos += tlen;
+        if(__command_len__ < 1 || __command_len__ > maxlen - pos) return -1;
+        this->command.assign(
+            static_cast<const char*>(buf) + offset + pos, __command_len__ - 1);
+        pos += __command_len__;
+    } else {
+        int32_t __command_len__;
+        tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &__command_len__, 1);
+        if(tlen < 0) return tlen; else pos += tlen;
+        if(__command_len__ < 0 || __command_len__ > maxlen - pos) return -1;
+        pos += __command_len__;
+    }
+
+    tlen = __byte_decode_array(buf, offset + pos, maxlen - pos, &this->command_type, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    return pos;
+}
+
+int MenuEntry::_getEncodedSizeNoHash() const
+{
+    int enc_size = 0;
+    enc_size += __int32_t_encoded_array_size(NULL, 1);
+    enc_size += __int32_t_encoded_array_size(NULL, 1);
+    enc_size += this->title.size() + 4 + 1;
+    enc_size += this->command.size() + 4 + 1;
+    enc_size += __byte_encoded_array_size(NULL, 1);
+    return enc_size;
+}
+
+int MenuEntry::_skipNoHash(const void *buf, int offset, int maxlen)
+{
+    int pos = 0, tlen;
+    pos += 4;
+    pos += 4;
+    int32_t __title_len__;
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &__title_len__, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+    if(__title_len__ < 0 || __title_len__ > maxlen - pos) return -1;
+    pos += __title_len__;
+    int32_t __command_len__;
+    tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &__command_len__, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+    if(__command_len__ < 0 || __command_len__ > maxlen - pos) return -1;
+    pos += __command_len__;
+    pos += 1;
+    if(pos > maxlen) return -1;
+    return pos;
+}
+
+template <typename Self, typename Visitor>
+void MenuEntry::_forEachField(Self &self, Visitor &visitor)
+{
+    visitor(kFields[0], self.id);
+    visitor(kFields[1], self.parent_id);
+    visitor(kFields[2], self.title);
+    visitor(kFields[3], self.command);
+    visitor(kFields[4], self.command_type);
+}
+
+uint64_t MenuEntry::_computeHash(const __lcm_hash_ptr *)
+{
+    uint64_t hash = 0x667b2d15ef03e972LL;
+    return (hash<<1) + ((hash>>63)&1);
+}
+
+}
+}
+
+#endif
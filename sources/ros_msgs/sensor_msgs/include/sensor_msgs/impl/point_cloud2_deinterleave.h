@@ -0,0 +1,510 @@
+/*
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2026, Dimensional Robotics
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of the copyright holder nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef SENSOR_MSGS_IMPL_POINT_CLOUD2_DEINTERLEAVE_H
+#define SENSOR_MSGS_IMPL_POINT_CLOUD2_DEINTERLEAVE_H
+
+#include <sensor_msgs/PointCloud2.h>
+#include <sensor_msgs/point_cloud2_iterator.h>
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#if !defined(SENSOR_MSGS_NO_SIMD)
+#if defined(__AVX__)
+#include <immintrin.h>
+#define SENSOR_MSGS_DEINTERLEAVE_AVX 1
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#define SENSOR_MSGS_DEINTERLEAVE_SSE2 1
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#define SENSOR_MSGS_DEINTERLEAVE_NEON 1
+#endif
+#endif
+
+/**
+ * \brief Private implementation used by extractFields and interleaveFields
+ */
+
+namespace sensor_msgs
+{
+namespace impl
+{
+/** Where a requested field is in the points of a cloud */
+struct PointFieldSlot
+{
+  size_t offset;
+  int datatype;
+};
+
+/** Look up every field of field_names in cloud_msg
+ * @throw std::runtime_error if a field does not exist or ends past the point step
+ */
+inline std::vector<PointFieldSlot> findPointFields(const sensor_msgs::PointCloud2 &cloud_msg,
+    const std::vector<std::string> &field_names)
+{
+  std::vector<PointFieldSlot> slots(field_names.size());
+  for (size_t i = 0; i < field_names.size(); ++i)
+  {
+    std::vector<sensor_msgs::PointField>::const_iterator field_iter = cloud_msg.fields.begin(), field_end =
+        cloud_msg.fields.end();
+    while ((field_iter != field_end) && (field_iter->name != field_names[i]))
+      ++field_iter;
+    if (field_iter == field_end)
+      throw std::runtime_error("Field " + field_names[i] + " does not exist");
+    if (field_iter->offset + sizeOfPointField(field_iter->datatype) > cloud_msg.point_step)
+      throw std::runtime_error("Field " + field_names[i] + " ends past the point step");
+    slots[i].offset = field_iter->offset;
+    slots[i].datatype = field_iter->datatype;
+  }
+  return slots;
+}
+
+template<typename T, typename F>
+inline void extractStrided(const unsigned char *src, size_t step, size_t n, T *out)
+{
+  for (size_t i = 0; i < n; ++i, src += step)
+  {
+    F value;
+    std::memcpy(&value, src, sizeof(F));
+    out[i] = static_cast<T>(value);
+  }
+}
+
+template<typename T, typename F>
+inline void interleaveStrided(unsigned char *dst, size_t step, size_t n, const T *in)
+{
+  for (size_t i = 0; i < n; ++i, dst += step)
+  {
+    F value = static_cast<F>(in[i]);
+    std::memcpy(dst, &value, sizeof(F));
+  }
+}
+
+/** Copy n values of a field of the given datatype, the first at src, into out */
+template<typename T>
+inline void extractField(const unsigned char *src, int datatype, size_t step, size_t n, T *out)
+{
+  switch (datatype)
+  {
+    case sensor_msgs::PointField::INT8:
+      return extractStrided<T, pointFieldTypeAsType<sensor_msgs::PointField::INT8>::type>(src, step, n, out);
+    case sensor_msgs::PointField::UINT8:
+      return extractStrided<T, pointFieldTypeAsType<sensor_msgs::PointField::UINT8>::type>(src, step, n, out);
+    case sensor_msgs::PointField::INT16:
+      return extractStrided<T, pointFieldTypeAsType<sensor_msgs::PointField::INT16>::type>(src, step, n, out);
+    case sensor_msgs::PointField::UINT16:
+      return extractStrided<T, pointFieldTypeAsType<sensor_msgs::PointField::UINT16>::type>(src, step, n, out);
+    case sensor_msgs::PointField::INT32:
+      return extractStrided<T, pointFieldTypeAsType<sensor_msgs::PointField::INT32>::type>(src, step, n, out);
+    case sensor_msgs::PointField::UINT32:
+      return extractStrided<T, pointFieldTypeAsType<sensor_msgs::PointField::UINT32>::type>(src, step, n, out);
+    case sensor_msgs::PointField::FLOAT32:
+      return extractStrided<T, pointFieldTypeAsType<sensor_msgs::PointField::FLOAT32>::type>(src, step, n, out);
+    case sensor_msgs::PointField::FLOAT64:
+      return extractStrided<T, pointFieldTypeAsType<sensor_msgs::PointField::FLOAT64>::type>(src, step, n, out);
+  }
+}
+
+/** Copy n values from in into a field of the given datatype, the first at dst */
+template<typename T>
+inline void interleaveField(unsigned char *dst, int datatype, size_t step, size_t n, const T *in)
+{
+  switch (datatype)
+  {
+    case sensor_msgs::PointField::INT8:
+      return interleaveStrided<T, pointFieldTypeAsType<sensor_msgs::PointField::INT8>::type>(dst, step, n, in);
+    case sensor_msgs::PointField::UINT8:
+      return interleaveStrided<T, pointFieldTypeAsType<sensor_msgs::PointField::UINT8>::type>(dst, step, n, in);
+    case sensor_msgs::PointField::INT16:
+      return interleaveStrided<T, pointFieldTypeAsType<sensor_msgs::PointField::INT16>::type>(dst, step, n, in);
+    case sensor_msgs::PointField::UINT16:
+      return interleaveStrided<T, pointFieldTypeAsType<sensor_msgs::PointField::UINT16>::type>(dst, step, n, in);
+    case sensor_msgs::PointField::INT32:
+      return interleaveStrided<T, pointFieldTypeAsType<sensor_msgs::PointField::INT32>::type>(dst, step, n, in);
+    case sensor_msgs::PointField::UINT32:
+      return interleaveStrided<T, pointFieldTypeAsType<sensor_msgs::PointField::UINT32>::type>(dst, step, n, in);
+    case sensor_msgs::PointField::FLOAT32:
+      return interleaveStrided<T, pointFieldTypeAsType<sensor_msgs::PointField::FLOAT32>::type>(dst, step, n, in);
+    case sensor_msgs::PointField::FLOAT64:
+      return interleaveStrided<T, pointFieldTypeAsType<sensor_msgs::PointField::FLOAT64>::type>(dst, step, n, in);
+  }
+}
+
+#if defined(SENSOR_MSGS_DEINTERLEAVE_AVX) || defined(SENSOR_MSGS_DEINTERLEAVE_SSE2) || \
+    defined(SENSOR_MSGS_DEINTERLEAVE_NEON)
+/** 16 bytes of a point holding up to four of the requested FLOAT32 fields */
+struct FloatWindow
+{
+  size_t base;
+  /** The index in field_names of the field at base + 4 * lane, or -1 */
+  int field[4];
+};
+
+/** Group the FLOAT32 fields into windows, each starting at the lowest offset not yet covered */
+inline std::vector<FloatWindow> floatWindows(const std::vector<PointFieldSlot> &slots)
+{
+  std::vector<int> order;
+  for (size_t i = 0; i < slots.size(); ++i)
+    if (slots[i].datatype == sensor_msgs::PointField::FLOAT32)
+      order.push_back(static_cast<int>(i));
+  std::stable_sort(order.begin(), order.end(), [&](int a, int b) { return slots[a].offset < slots[b].offset; });
+
+  std::vector<FloatWindow> windows;
+  for (size_t i = 0; i < order.size(); ++i)
+  {
+    size_t offset = slots[order[i]].offset;
+    if (!windows.empty())
+    {
+      FloatWindow &window = windows.back();
+      size_t lane = (offset - window.base) / 4;
+      if (offset + 4 <= window.base + 16 && (offset - window.base) % 4 == 0 && window.field[lane] < 0)
+      {
+        window.field[lane] = order[i];
+        continue;
+      }
+    }
+    FloatWindow window = {offset, {order[i], -1, -1, -1}};
+    windows.push_back(window);
+  }
+  return windows;
+}
+
+#if defined(SENSOR_MSGS_DEINTERLEAVE_AVX)
+const size_t kWindowBatch = 8;
+
+/** Transpose the 4x4 blocks in each half of r0..r3, so that rows of points become columns of fields */
+inline void transposeWindows(__m256 &r0, __m256 &r1, __m256 &r2, __m256 &r3)
+{
+  __m256 t0 = _mm256_unpacklo_ps(r0, r1);
+  __m256 t1 = _mm256_unpackhi_ps(r0, r1);
+  __m256 t2 = _mm256_unpacklo_ps(r2, r3);
+  __m256 t3 = _mm256_unpackhi_ps(r2, r3);
+  r0 = _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(1, 0, 1, 0));
+  r1 = _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(3, 2, 3, 2));
+  r2 = _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(1, 0, 1, 0));
+  r3 = _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(3, 2, 3, 2));
+}
+
+/** Points j and j + 4 of a batch in the two halves */
+inline __m256 loadWindows(const unsigned char *p, size_t step)
+{
+  __m128 lo = _mm_loadu_ps(reinterpret_cast<const float *>(p));
+  __m128 hi = _mm_loadu_ps(reinterpret_cast<const float *>(p + 4 * step));
+  return _mm256_insertf128_ps(_mm256_castps128_ps256(lo), hi, 1);
+}
+
+inline void storeWindows(unsigned char *p, size_t step, __m256 r)
+{
+  _mm_storeu_ps(reinterpret_cast<float *>(p), _mm256_castps256_ps128(r));
+  _mm_storeu_ps(reinterpret_cast<float *>(p + 4 * step), _mm256_extractf128_ps(r, 1));
+}
+
+/** Copy the fields of the window at src of n points, a multiple of kWindowBatch, into the non-null columns */
+inline void extractWindow(const unsigned char *src, size_t step, size_t n, float *const columns[4])
+{
+  for (size_t i = 0; i < n; i += kWindowBatch, src += kWindowBatch * step)
+  {
+    __m256 r[4] = {loadWindows(src, step), loadWindows(src + step, step), loadWindows(src + 2 * step, step),
+                   loadWindows(src + 3 * step, step)};
+    transposeWindows(r[0], r[1], r[2], r[3]);
+    for (int lane = 0; lane < 4; ++lane)
+      if (columns[lane])
+        _mm256_storeu_ps(columns[lane] + i, r[lane]);
+  }
+}
+
+/** Copy the non-null columns into the window at dst of n points, keeping the lanes without one */
+inline void interleaveWindow(unsigned char *dst, size_t step, size_t n, const float *const columns[4])
+{
+  for (size_t i = 0; i < n; i += kWindowBatch, dst += kWindowBatch * step)
+  {
+    __m256 r[4] = {loadWindows(dst, step), loadWindows(dst + step, step), loadWindows(dst + 2 * step, step),
+                   loadWindows(dst + 3 * step, step)};
+    transposeWindows(r[0], r[1], r[2], r[3]);
+    for (int lane = 0; lane < 4; ++lane)
+      if (columns[lane])
+        r[lane] = _mm256_loadu_ps(columns[lane] + i);
+    transposeWindows(r[0], r[1], r[2], r[3]);
+    for (int j = 0; j < 4; ++j)
+      storeWindows(dst + j * step, step, r[j]);
+  }
+}
+#else
+const size_t kWindowBatch = 4;
+
+#if defined(SENSOR_MSGS_DEINTERLEAVE_SSE2)
+typedef __m128 WindowRow;
+
+inline WindowRow loadWindow(const unsigned char *p)
+{
+  return _mm_loadu_ps(reinterpret_cast<const float *>(p));
+}
+
+inline void storeWindow(unsigned char *p, WindowRow r)
+{
+  _mm_storeu_ps(reinterpret_cast<float *>(p), r);
+}
+
+inline void storeColumn(float *p, WindowRow c)
+{
+  _mm_storeu_ps(p, c);
+}
+
+inline WindowRow loadColumn(const float *p)
+{
+  return _mm_loadu_ps(p);
+}
+
+inline void transposeWindows(WindowRow &r0, WindowRow &r1, WindowRow &r2, WindowRow &r3)
+{
+  _MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+}
+#else
+typedef float32x4_t WindowRow;
+
+inline WindowRow loadWindow(const unsigned char *p)
+{
+  return vreinterpretq_f32_u8(vld1q_u8(p));
+}
+
+inline void storeWindow(unsigned char *p, WindowRow r)
+{
+  vst1q_u8(p, vreinterpretq_u8_f32(r));
+}
+
+inline void storeColumn(float *p, WindowRow c)
+{
+  vst1q_f32(p, c);
+}
+
+inline WindowRow loadColumn(const float *p)
+{
+  return vld1q_f32(p);
+}
+
+inline void transposeWindows(WindowRow &r0, WindowRow &r1, WindowRow &r2, WindowRow &r3)
+{
+  float32x4x2_t t01 = vtrnq_f32(r0, r1);
+  float32x4x2_t t23 = vtrnq_f32(r2, r3);
+  r0 = vcombine_f32(vget_low_f32(t01.val[0]), vget_low_f32(t23.val[0]));
+  r1 = vcombine_f32(vget_low_f32(t01.val[1]), vget_low_f32(t23.val[1]));
+  r2 = vcombine_f32(vget_high_f32(t01.val[0]), vget_high_f32(t23.val[0]));
+  r3 = vcombine_f32(vget_high_f32(t01.val[1]), vget_high_f32(t23.val[1]));
+}
+#endif
+
+/** Copy the fields of the window at src of n points, a multiple of kWindowBatch, into the non-null columns */
+inline void extractWindow(const unsigned char *src, size_t step, size_t n, float *const columns[4])
+{
+  for (size_t i = 0; i < n; i += kWindowBatch, src += kWindowBatch * step)
+  {
+    WindowRow r[4] = {loadWindow(src), loadWindow(src + step), loadWindow(src + 2 * step),
+                      loadWindow(src + 3 * step)};
+    transposeWindows(r[0], r[1], r[2], r[3]);
+    for (int lane = 0; lane < 4; ++lane)
+      if (columns[lane])
+        storeColumn(columns[lane] + i, r[lane]);
+  }
+}
+
+/** Copy the non-null columns into the window at dst of n points, keeping the lanes without one */
+inline void interleaveWindow(unsigned char *dst, size_t step, size_t n, const float *const columns[4])
+{
+  for (size_t i = 0; i < n; i += kWindowBatch, dst += kWindowBatch * step)
+  {
+    WindowRow r[4] = {loadWindow(dst), loadWindow(dst + step), loadWindow(dst + 2 * step),
+                      loadWindow(dst + 3 * step)};
+    transposeWindows(r[0], r[1], r[2], r[3]);
+    for (int lane = 0; lane < 4; ++lane)
+      if (columns[lane])
+        r[lane] = loadColumn(columns[lane] + i);
+    transposeWindows(r[0], r[1], r[2], r[3]);
+    for (int j = 0; j < 4; ++j)
+      storeWindow(dst + j * step, r[j]);
+  }
+}
+#endif
+
+/** Number of the first n points, rounded down to a whole batch, whose window ends within size bytes */
+inline size_t windowPoints(size_t base, size_t size, size_t step, size_t n)
+{
+  if (size < base + 16)
+    return 0;
+  size_t fit = std::min(n, (size - base - 16) / step + 1);
+  return fit / kWindowBatch * kWindowBatch;
+}
+
+/** Extract the FLOAT32 fields, marking them done */
+inline void extractFloatFields(const unsigned char *data, size_t size, size_t step, size_t n,
+    const std::vector<PointFieldSlot> &slots, float *const *out, std::vector<bool> &done)
+{
+  std::vector<FloatWindow> windows = floatWindows(slots);
+  for (size_t w = 0; w < windows.size(); ++w)
+  {
+    const FloatWindow &window = windows[w];
+    float *columns[4];
+    for (int lane = 0; lane < 4; ++lane)
+      columns[lane] = window.field[lane] < 0 ? NULL : out[window.field[lane]];
+    size_t simd_n = windowPoints(window.base, size, step, n);
+    extractWindow(data + window.base, step, simd_n, columns);
+    for (int lane = 0; lane < 4; ++lane)
+    {
+      int f = window.field[lane];
+      if (f < 0)
+        continue;
+      extractStrided<float, float>(data + slots[f].offset + simd_n * step, step, n - simd_n, out[f] + simd_n);
+      done[f] = true;
+    }
+  }
+}
+
+/** Interleave the FLOAT32 fields, marking them done. Windows that reach into the next point are left to the
+ * scalar loop, since they write its bytes back.
+ */
+inline void interleaveFloatFields(unsigned char *data, size_t size, size_t step, size_t n,
+    const std::vector<PointFieldSlot> &slots, const float *const *in, std::vector<bool> &done)
+{
+  std::vector<FloatWindow> windows = floatWindows(slots);
+  for (size_t w = 0; w < windows.size(); ++w)
+  {
+    const FloatWindow &window = windows[w];
+    if (window.base + 16 > step)
+      continue;
+    const float *columns[4];
+    for (int lane = 0; lane < 4; ++lane)
+      columns[lane] = window.field[lane] < 0 ? NULL : in[window.field[lane]];
+    size_t simd_n = windowPoints(window.base, size, step, n);
+    interleaveWindow(data + window.base, step, simd_n, columns);
+    for (int lane = 0; lane < 4; ++lane)
+    {
+      int f = window.field[lane];
+      if (f < 0)
+        continue;
+      interleaveStrided<float, float>(data + slots[f].offset + simd_n * step, step, n - simd_n, in[f] + simd_n);
+      done[f] = true;
+    }
+  }
+}
+#endif
+
+/** Only float arrays have SIMD kernels */
+template<typename T>
+inline void extractFloatFields(const unsigned char *, size_t, size_t, size_t, const std::vector<PointFieldSlot> &,
+    T *const *, std::vector<bool> &)
+{
+}
+
+template<typename T>
+inline void interleaveFloatFields(unsigned char *, size_t, size_t, size_t, const std::vector<PointFieldSlot> &,
+    const T *const *, std::vector<bool> &)
+{
+}
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename T>
+void extractFields(const sensor_msgs::PointCloud2 &cloud_msg, const std::vector<std::string> &field_names,
+    T *const *out)
+{
+  std::vector<impl::PointFieldSlot> slots = impl::findPointFields(cloud_msg, field_names);
+  if (cloud_msg.data.empty() || slots.empty())
+    return;
+  const size_t step = cloud_msg.point_step;
+  const size_t n = cloud_msg.data.size() / step;
+  const unsigned char *data = &cloud_msg.data.front();
+
+  std::vector<bool> done(slots.size(), false);
+  impl::extractFloatFields(data, cloud_msg.data.size(), step, n, slots, out, done);
+  for (size_t i = 0; i < slots.size(); ++i)
+    if (!done[i])
+      impl::extractField(data + slots[i].offset, slots[i].datatype, step, n, out[i]);
+}
+
+template<typename T>
+void extractFields(const sensor_msgs::PointCloud2 &cloud_msg, const std::vector<std::string> &field_names,
+    std::vector<std::vector<T> > &out)
+{
+  const size_t n = cloud_msg.point_step ? cloud_msg.data.size() / cloud_msg.point_step : 0;
+  out.resize(field_names.size());
+  std::vector<T *> columns(field_names.size());
+  for (size_t i = 0; i < field_names.size(); ++i)
+  {
+    out[i].resize(n);
+    columns[i] = out[i].data();
+  }
+  extractFields(cloud_msg, field_names, columns.data());
+}
+
+template<typename T>
+void interleaveFields(sensor_msgs::PointCloud2 &cloud_msg, const std::vector<std::string> &field_names,
+    const T *const *in)
+{
+  std::vector<impl::PointFieldSlot> slots = impl::findPointFields(cloud_msg, field_names);
+  if (cloud_msg.data.empty() || slots.empty())
+    return;
+  const size_t step = cloud_msg.point_step;
+  const size_t n = cloud_msg.data.size() / step;
+  unsigned char *data = &cloud_msg.data.front();
+
+  std::vector<bool> done(slots.size(), false);
+  impl::interleaveFloatFields(data, cloud_msg.data.size(), step, n, slots, in, done);
+  for (size_t i = 0; i < slots.size(); ++i)
+    if (!done[i])
+      impl::interleaveField(data + slots[i].offset, slots[i].datatype, step, n, in[i]);
+}
+
+template<typename T>
+void interleaveFields(sensor_msgs::PointCloud2 &cloud_msg, const std::vector<std::string> &field_names,
+    const std::vector<std::vector<T> > &in)
+{
+  const size_t n = cloud_msg.point_step ? cloud_msg.data.size() / cloud_msg.point_step : 0;
+  if (in.size() < field_names.size())
+    throw std::runtime_error("Not as many arrays as fields");
+  std::vector<const T *> columns(field_names.size());
+  for (size_t i = 0; i < field_names.size(); ++i)
+  {
+    if (in[i].size() != n)
+      throw std::runtime_error("Field " + field_names[i] + " does not have a value for each point");
+    columns[i] = in[i].data();
+  }
+  interleaveFields(cloud_msg, field_names, columns.data());
+}
+}
+
+#endif// SENSOR_MSGS_IMPL_POINT_CLOUD2_DEINTERLEAVE_H
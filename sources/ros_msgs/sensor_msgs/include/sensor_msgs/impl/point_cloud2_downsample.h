@@ -0,0 +1,390 @@
+/*
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2026, Dimensional Robotics
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of the copyright holder nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef SENSOR_MSGS_IMPL_POINT_CLOUD2_DOWNSAMPLE_H
+#define SENSOR_MSGS_IMPL_POINT_CLOUD2_DOWNSAMPLE_H
+
+#include <sensor_msgs/PointCloud2.h>
+#include <sensor_msgs/point_cloud2_deinterleave.h>
+#include <sensor_msgs/point_cloud2_iterator.h>
+#include <sensor_msgs/point_field_conversion.h>
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+/**
+ * \brief Private implementation used by voxelDownsample
+ */
+
+namespace sensor_msgs
+{
+namespace impl
+{
+/** The number of points, or of cubes, each thread takes at a time */
+const size_t kVoxelBlock = 16 * 1024;
+/** The bits of the key sorted on by each pass of the radix sort */
+const int kVoxelRadixBits = 11;
+
+/** A point and the key of its cube */
+struct VoxelEntry
+{
+  uint64_t key;
+  uint32_t index;
+};
+
+/** The smallest and largest indices of the cubes of a set of points, along each axis */
+struct VoxelBounds
+{
+  int64_t min[3];
+  int64_t max[3];
+};
+
+/** The index along an axis of the cube of coordinate v, kept far from the ends of int64_t */
+inline int64_t voxelIndex(double v, double inverse_leaf_size)
+{
+  const double limit = 4611686018427387904.0;
+  return static_cast<int64_t>(std::max(-limit, std::min(limit, std::floor(v * inverse_leaf_size))));
+}
+
+inline bool isFinitePoint(double x, double y, double z)
+{
+  return std::isfinite(x) && std::isfinite(y) && std::isfinite(z);
+}
+
+/** Sort entries by key, keeping entries of the same key in order, with keys up to max_key
+ *
+ * A radix sort, kVoxelRadixBits at a time: each block of entries counts its keys per digit, and then moves its
+ * entries to where the counts of all the blocks put them.
+ */
+inline void radixSortVoxelEntries(std::vector<VoxelEntry> &entries, uint64_t max_key, PointCloud2ThreadPool &pool)
+{
+  const size_t buckets = size_t(1) << kVoxelRadixBits;
+  const size_t n = entries.size();
+  const size_t blocks = (n + kVoxelBlock - 1) / kVoxelBlock;
+  std::vector<VoxelEntry> sorted(n);
+  std::vector<size_t> offsets(blocks * buckets);
+  for (int shift = 0; shift < 64 && (max_key >> shift) != 0; shift += kVoxelRadixBits)
+  {
+    pool.run(blocks, [&](size_t b) {
+      size_t *counts = &offsets[b * buckets];
+      std::fill(counts, counts + buckets, 0);
+      for (size_t i = b * kVoxelBlock; i < std::min(n, (b + 1) * kVoxelBlock); ++i)
+        ++counts[(entries[i].key >> shift) & (buckets - 1)];
+    });
+    size_t total = 0;
+    for (size_t digit = 0; digit < buckets; ++digit)
+      for (size_t b = 0; b < blocks; ++b)
+      {
+        const size_t count = offsets[b * buckets + digit];
+        offsets[b * buckets + digit] = total;
+        total += count;
+      }
+    pool.run(blocks, [&](size_t b) {
+      size_t *next = &offsets[b * buckets];
+      for (size_t i = b * kVoxelBlock; i < std::min(n, (b + 1) * kVoxelBlock); ++i)
+        sorted[next[(entries[i].key >> shift) & (buckets - 1)]++] = entries[i];
+    });
+    entries.swap(sorted);
+  }
+}
+
+/** The points with finite coordinates among the coordinates xyz, with the keys of their cubes, sorted by key and
+ * then index
+ * @throw std::runtime_error if the points span more than 2^62 cubes
+ */
+template<typename T>
+std::vector<VoxelEntry> sortedVoxelEntries(const std::vector<std::vector<T> > &xyz, double leaf_size,
+    PointCloud2ThreadPool &pool)
+{
+  const size_t n = xyz[0].size();
+  const size_t blocks = (n + kVoxelBlock - 1) / kVoxelBlock;
+  const double inverse_leaf_size = 1 / leaf_size;
+
+  std::vector<VoxelBounds> block_bounds(blocks);
+  std::vector<char> block_empty(blocks, true);
+  pool.run(blocks, [&](size_t b) {
+    VoxelBounds bounds;
+    bool empty = true;
+    for (size_t i = b * kVoxelBlock; i < std::min(n, (b + 1) * kVoxelBlock); ++i)
+    {
+      if (!isFinitePoint(xyz[0][i], xyz[1][i], xyz[2][i]))
+        continue;
+      for (int axis = 0; axis < 3; ++axis)
+      {
+        const int64_t index = voxelIndex(xyz[axis][i], inverse_leaf_size);
+        bounds.min[axis] = empty ? index : std::min(bounds.min[axis], index);
+        bounds.max[axis] = empty ? index : std::max(bounds.max[axis], index);
+      }
+      empty = false;
+    }
+    block_bounds[b] = bounds;
+    block_empty[b] = empty;
+  });
+  VoxelBounds bounds;
+  bool empty = true;
+  for (size_t b = 0; b < blocks; ++b)
+  {
+    if (block_empty[b])
+      continue;
+    for (int axis = 0; axis < 3; ++axis)
+    {
+      bounds.min[axis] = empty ? block_bounds[b].min[axis] : std::min(bounds.min[axis], block_bounds[b].min[axis]);
+      bounds.max[axis] = empty ? block_bounds[b].max[axis] : std::max(bounds.max[axis], block_bounds[b].max[axis]);
+    }
+    empty = false;
+  }
+  if (empty)
+    return std::vector<VoxelEntry>();
+
+  // The key numbers the cubes of the bounding box of the points, x first, so that it has as few bits as possible
+  // for the radix sort; the points in no cube get the number past the last cube
+  uint64_t span[3];
+  double cubes = 1;
+  for (int axis = 0; axis < 3; ++axis)
+  {
+    // Up to 2^63: out of the range of int64_t
+    span[axis] = uint64_t(bounds.max[axis]) - uint64_t(bounds.min[axis]) + 1;
+    cubes *= double(span[axis]);
+  }
+  if (cubes > 4611686018427387904.0)
+    throw std::runtime_error("The points span too many cubes of the leaf size");
+  const uint64_t no_voxel = span[0] * span[1] * span[2];
+
+  std::vector<VoxelEntry> entries(n);
+  pool.run(blocks, [&](size_t b) {
+    for (size_t i = b * kVoxelBlock; i < std::min(n, (b + 1) * kVoxelBlock); ++i)
+    {
+      entries[i].index = static_cast<uint32_t>(i);
+      entries[i].key = no_voxel;
+      if (!isFinitePoint(xyz[0][i], xyz[1][i], xyz[2][i]))
+        continue;
+      uint64_t key = 0;
+      for (int axis = 2; axis >= 0; --axis)
+        key = key * span[axis] + (uint64_t(voxelIndex(xyz[axis][i], inverse_leaf_size)) - uint64_t(bounds.min[axis]));
+      entries[i].key = key;
+    }
+  });
+  radixSortVoxelEntries(entries, no_voxel, pool);
+
+  // The points in no cube come last
+  entries.erase(std::partition_point(entries.begin(), entries.end(), [no_voxel](const VoxelEntry &entry) {
+    return entry.key != no_voxel;
+  }), entries.end());
+  return entries;
+}
+
+/** The points of cloud_msg with finite coordinates, with the keys of their cubes, sorted by key and then index
+ *
+ * The coordinates are read as float unless one of them is a FLOAT64 field: far from the origin, float would put
+ * points in the wrong cubes.
+ * @throw std::runtime_error if x, y or z is missing, or the points span more than 2^62 cubes
+ */
+inline std::vector<VoxelEntry> sortedVoxelEntries(const sensor_msgs::PointCloud2 &cloud_msg, double leaf_size,
+    PointCloud2ThreadPool &pool)
+{
+  const std::vector<std::string> names{"x", "y", "z"};
+  const std::vector<PointFieldSlot> slots = findPointFields(cloud_msg, names);
+  for (size_t i = 0; i < slots.size(); ++i)
+    if (slots[i].datatype == sensor_msgs::PointField::FLOAT64)
+    {
+      std::vector<std::vector<double> > xyz;
+      extractFields(cloud_msg, names, xyz);
+      return sortedVoxelEntries(xyz, leaf_size, pool);
+    }
+  std::vector<std::vector<float> > xyz;
+  extractFields(cloud_msg, names, xyz);
+  return sortedVoxelEntries(xyz, leaf_size, pool);
+}
+
+/** A value averaged by VOXEL_CENTROID: an element of a field */
+struct VoxelValue
+{
+  size_t offset;
+  int datatype;
+  /** Whether the value is a packed color, averaged byte by byte */
+  bool channels;
+};
+
+/** The values of the fields of cloud_msg within the point step */
+inline std::vector<VoxelValue> voxelValues(const sensor_msgs::PointCloud2 &cloud_msg)
+{
+  std::vector<VoxelValue> values;
+  for (size_t i = 0; i < cloud_msg.fields.size(); ++i)
+  {
+    const sensor_msgs::PointField &field = cloud_msg.fields[i];
+    const size_t size = sizeOfPointField(field.datatype);
+    const size_t count = std::max<size_t>(1, field.count);
+    if (field.offset + size * count > cloud_msg.point_step)
+      continue;
+    const bool channels = (field.name == "rgb" || field.name == "rgba") && size == 4 && count == 1;
+    for (size_t c = 0; c < count; ++c)
+    {
+      VoxelValue value = {field.offset + c * size, field.datatype, channels};
+      values.push_back(value);
+    }
+  }
+  return values;
+}
+
+/** Write the mean of the points [begin, end) of data to out, using sums, with four per value, to add them up */
+inline void averagePoints(const unsigned char *data, size_t step, const VoxelEntry *begin, const VoxelEntry *end,
+    const std::vector<VoxelValue> &values, double *sums, unsigned char *out)
+{
+  // Bytes that are in no field are those of the first point
+  memcpy(out, data + begin->index * step, step);
+  const size_t n = end - begin;
+  if (n == 1)
+    return;
+  std::fill(sums, sums + 4 * values.size(), 0.0);
+  for (const VoxelEntry *e = begin; e != end; ++e)
+  {
+    const unsigned char *point = data + e->index * step;
+    for (size_t v = 0; v < values.size(); ++v)
+    {
+      const VoxelValue &value = values[v];
+      if (value.channels)
+      {
+        for (int c = 0; c < 4; ++c)
+          sums[4 * v + c] += point[value.offset + c];
+      }
+      else if (value.datatype == sensor_msgs::PointField::FLOAT32)
+      {
+        float f;
+        memcpy(&f, point + value.offset, sizeof(f));
+        sums[4 * v] += f;
+      }
+      else
+      {
+        sums[4 * v] += readPointCloud2BufferValue<double>(point + value.offset, value.datatype);
+      }
+    }
+  }
+  for (size_t v = 0; v < values.size(); ++v)
+  {
+    const VoxelValue &value = values[v];
+    if (value.channels)
+    {
+      for (int c = 0; c < 4; ++c)
+        out[value.offset + c] = static_cast<unsigned char>(std::round(sums[4 * v + c] / n));
+      continue;
+    }
+    const double mean = sums[4 * v] / n;
+    const bool is_float = value.datatype == sensor_msgs::PointField::FLOAT32 ||
+                          value.datatype == sensor_msgs::PointField::FLOAT64;
+    writePointCloud2BufferValue<double>(out + value.offset, value.datatype, is_float ? mean : std::round(mean));
+  }
+}
+
+/** Copy the point of [begin, end) of data with the largest value of the field at slot to out */
+inline void copyMaxPoint(const unsigned char *data, size_t step, const VoxelEntry *begin, const VoxelEntry *end,
+    const PointFieldSlot &slot, unsigned char *out)
+{
+  const VoxelEntry *best = begin;
+  double best_value = readPointCloud2BufferValue<double>(data + begin->index * step + slot.offset, slot.datatype);
+  for (const VoxelEntry *e = begin + 1; e != end; ++e)
+  {
+    const double value = readPointCloud2BufferValue<double>(data + e->index * step + slot.offset, slot.datatype);
+    if (value > best_value)
+    {
+      best = e;
+      best_value = value;
+    }
+  }
+  memcpy(out, data + best->index * step, step);
+}
+}
+
+inline sensor_msgs::PointCloud2 voxelDownsample(const sensor_msgs::PointCloud2 &cloud_msg, double leaf_size,
+    VoxelReduction reduction, PointCloud2ThreadPool &pool)
+{
+  if (!(leaf_size > 0))
+    throw std::runtime_error("The leaf size is not positive");
+  std::vector<impl::PointFieldSlot> intensity;
+  if (reduction == VOXEL_MAX_INTENSITY)
+    intensity = impl::findPointFields(cloud_msg, std::vector<std::string>(1, "intensity"));
+  const std::vector<impl::VoxelEntry> entries = impl::sortedVoxelEntries(cloud_msg, leaf_size, pool);
+
+  // Where the points of each cube start in entries
+  std::vector<size_t> starts;
+  for (size_t i = 0; i < entries.size(); ++i)
+    if (i == 0 || entries[i].key != entries[i - 1].key)
+      starts.push_back(i);
+  const size_t voxels = starts.size();
+  starts.push_back(entries.size());
+
+  sensor_msgs::PointCloud2 out_msg;
+  out_msg.header = cloud_msg.header;
+  out_msg.height = 1;
+  out_msg.width = static_cast<uint32_t>(voxels);
+  out_msg.fields = cloud_msg.fields;
+  out_msg.is_bigendian = cloud_msg.is_bigendian;
+  out_msg.point_step = cloud_msg.point_step;
+  out_msg.row_step = static_cast<uint32_t>(voxels * cloud_msg.point_step);
+  out_msg.is_dense = true;
+  out_msg.data.resize(out_msg.row_step);
+  if (voxels == 0)
+    return out_msg;
+
+  const std::vector<impl::VoxelValue> values = impl::voxelValues(cloud_msg);
+  const size_t step = cloud_msg.point_step;
+  const unsigned char *data = &cloud_msg.data.front();
+  pool.run((voxels + impl::kVoxelBlock - 1) / impl::kVoxelBlock, [&](size_t b) {
+    std::vector<double> sums(4 * values.size());
+    for (size_t v = b * impl::kVoxelBlock; v < std::min(voxels, (b + 1) * impl::kVoxelBlock); ++v)
+    {
+      const impl::VoxelEntry *begin = &entries[starts[v]], *end = begin + (starts[v + 1] - starts[v]);
+      unsigned char *out = &out_msg.data[v * step];
+      switch (reduction)
+      {
+        case VOXEL_CENTROID:
+          impl::averagePoints(data, step, begin, end, values, sums.data(), out);
+          break;
+        case VOXEL_FIRST_POINT:
+          memcpy(out, data + begin->index * step, step);
+          break;
+        case VOXEL_MAX_INTENSITY:
+          impl::copyMaxPoint(data, step, begin, end, intensity[0], out);
+          break;
+      }
+    }
+  });
+  return out_msg;
+}
+}
+
+#endif// SENSOR_MSGS_IMPL_POINT_CLOUD2_DOWNSAMPLE_H
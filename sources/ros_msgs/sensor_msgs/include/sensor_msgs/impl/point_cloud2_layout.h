@@ -0,0 +1,304 @@
+/*
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2026, Dimensional Robotics
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of the copyright holder nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef SENSOR_MSGS_IMPL_POINT_CLOUD2_LAYOUT_H
+#define SENSOR_MSGS_IMPL_POINT_CLOUD2_LAYOUT_H
+
+#include <sensor_msgs/PointCloud2.h>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+
+/**
+ * \brief Private implementation used by PointCloud2Layout
+ */
+
+namespace sensor_msgs
+{
+
+template<typename T, char... Name>
+inline std::string PointCloud2Field<T, Name...>::name()
+{
+  const char name[] = {Name..., '\0'};
+  return std::string(name);
+}
+
+namespace impl
+{
+/** Whether values of type T can be read from a PointField of the given datatype
+ * @param datatype one of the enums of sensor_msgs::PointField::
+ */
+template<typename T>
+inline bool pointFieldHoldsType(int datatype)
+{
+  if (datatype == typeAsPointFieldType<T>::value)
+    return true;
+  // Packed fields such as rgb, stored in a FLOAT32, are read as unsigned integers of their size
+  return std::is_unsigned<T>::value && sizeOfPointField(datatype) == static_cast<int>(sizeof(T));
+}
+
+/** Read a T that may not be aligned */
+template<typename T>
+inline T loadPointField(const unsigned char *p)
+{
+  T value;
+  std::memcpy(&value, p, sizeof(T));
+  return value;
+}
+
+/** Write a T that may not be aligned */
+template<typename T>
+inline void storePointField(unsigned char *p, const T &value)
+{
+  std::memcpy(p, &value, sizeof(T));
+}
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename... Fields>
+PointCloud2Layout<Fields...>::PointCloud2Layout(const sensor_msgs::PointCloud2 &cloud_msg) :
+    point_step_(cloud_msg.point_step), packed_(cloud_msg.point_step == packedPointStep())
+{
+  setOffsets(cloud_msg);
+}
+
+template<typename... Fields>
+void PointCloud2Layout<Fields...>::setPointCloud2Fields(sensor_msgs::PointCloud2 &cloud_msg)
+{
+  const std::string names[] = {Fields::name()...};
+  const int datatypes[] = {typeAsPointFieldType<typename Fields::type>::value...};
+  cloud_msg.fields.clear();
+  cloud_msg.fields.reserve(sizeof...(Fields));
+  for (size_t i = 0; i < sizeof...(Fields); ++i)
+    addPointField(cloud_msg, names[i], 1, datatypes[i], packedOffset(i));
+
+  // Resize the point cloud accordingly
+  cloud_msg.point_step = packedPointStep();
+  cloud_msg.row_step = cloud_msg.width * cloud_msg.point_step;
+  cloud_msg.data.resize(cloud_msg.height * cloud_msg.row_step);
+}
+
+template<typename... Fields>
+constexpr size_t PointCloud2Layout<Fields...>::packedOffset(size_t i)
+{
+  const size_t sizes[] = {sizeof(typename Fields::type)...};
+  size_t offset = 0;
+  for (size_t j = 0; j < i; ++j)
+    offset = (offset + sizes[j] - 1) / sizes[j] * sizes[j] + sizes[j];
+  return (offset + sizes[i] - 1) / sizes[i] * sizes[i];
+}
+
+template<typename... Fields>
+constexpr size_t PointCloud2Layout<Fields...>::packedPointStep()
+{
+  const size_t sizes[] = {sizeof(typename Fields::type)...};
+  const size_t last = sizeof...(Fields) - 1;
+  size_t align = 1;
+  for (size_t j = 0; j <= last; ++j)
+    align = sizes[j] > align ? sizes[j] : align;
+  size_t end = packedOffset(last) + sizes[last];
+  return (end + align - 1) / align * align;
+}
+
+template<typename... Fields>
+size_t PointCloud2Layout<Fields...>::offset(size_t i) const
+{
+  return offsets_[i];
+}
+
+template<typename... Fields>
+size_t PointCloud2Layout<Fields...>::pointStep() const
+{
+  return point_step_;
+}
+
+template<typename... Fields>
+bool PointCloud2Layout<Fields...>::isPacked() const
+{
+  return packed_;
+}
+
+template<typename... Fields>
+size_t PointCloud2Layout<Fields...>::size(const sensor_msgs::PointCloud2 &cloud_msg) const
+{
+  return cloud_msg.data.size() / point_step_;
+}
+
+template<typename... Fields>
+template<size_t I>
+typename PointCloud2Layout<Fields...>::template FieldType<I>
+PointCloud2Layout<Fields...>::get(const unsigned char *point) const
+{
+  return impl::loadPointField<FieldType<I> >(point + offsets_[I]);
+}
+
+template<typename... Fields>
+template<size_t I>
+void PointCloud2Layout<Fields...>::set(unsigned char *point, const FieldType<I> &value) const
+{
+  impl::storePointField(point + offsets_[I], value);
+}
+
+template<typename... Fields>
+typename PointCloud2Layout<Fields...>::Point
+PointCloud2Layout<Fields...>::read(const sensor_msgs::PointCloud2 &cloud_msg, size_t i) const
+{
+  return read(&cloud_msg.data[i * point_step_], std::index_sequence_for<Fields...>());
+}
+
+template<typename... Fields>
+void PointCloud2Layout<Fields...>::write(sensor_msgs::PointCloud2 &cloud_msg, size_t i, const Point &point) const
+{
+  write(&cloud_msg.data[i * point_step_], point, std::index_sequence_for<Fields...>());
+}
+
+template<typename... Fields>
+template<typename F>
+void PointCloud2Layout<Fields...>::forEach(const sensor_msgs::PointCloud2 &cloud_msg, F fn) const
+{
+  forEach(cloud_msg, 0, size(cloud_msg), fn);
+}
+
+template<typename... Fields>
+template<typename F>
+void PointCloud2Layout<Fields...>::transform(sensor_msgs::PointCloud2 &cloud_msg, F fn) const
+{
+  transform(cloud_msg, 0, size(cloud_msg), fn);
+}
+
+template<typename... Fields>
+template<typename F>
+void PointCloud2Layout<Fields...>::forEach(const sensor_msgs::PointCloud2 &cloud_msg, size_t begin, size_t end,
+    F fn) const
+{
+  if (begin >= end)
+    return;
+  const unsigned char *data = &cloud_msg.data[begin * point_step_];
+  if (packed_)
+    forEach<true>(data, end - begin, fn, std::index_sequence_for<Fields...>());
+  else
+    forEach<false>(data, end - begin, fn, std::index_sequence_for<Fields...>());
+}
+
+template<typename... Fields>
+template<typename F>
+void PointCloud2Layout<Fields...>::transform(sensor_msgs::PointCloud2 &cloud_msg, size_t begin, size_t end,
+    F fn) const
+{
+  if (begin >= end)
+    return;
+  unsigned char *data = &cloud_msg.data[begin * point_step_];
+  if (packed_)
+    transform<true>(data, end - begin, fn, std::index_sequence_for<Fields...>());
+  else
+    transform<false>(data, end - begin, fn, std::index_sequence_for<Fields...>());
+}
+
+template<typename... Fields>
+template<bool Packed, size_t I>
+size_t PointCloud2Layout<Fields...>::offsetOf() const
+{
+  return Packed ? std::integral_constant<size_t, packedOffset(I)>::value : offsets_[I];
+}
+
+template<typename... Fields>
+template<bool Packed, typename F, size_t... I>
+void PointCloud2Layout<Fields...>::forEach(const unsigned char *data, size_t n, F &fn,
+    std::index_sequence<I...>) const
+{
+  const size_t point_step = Packed ? packedPointStep() : point_step_;
+  for (size_t i = 0; i < n; ++i, data += point_step)
+    fn(impl::loadPointField<FieldType<I> >(data + offsetOf<Packed, I>())...);
+}
+
+template<typename... Fields>
+template<bool Packed, typename F, size_t... I>
+void PointCloud2Layout<Fields...>::transform(unsigned char *data, size_t n, F &fn,
+    std::index_sequence<I...>) const
+{
+  const size_t point_step = Packed ? packedPointStep() : point_step_;
+  for (size_t i = 0; i < n; ++i, data += point_step)
+  {
+    Point point(impl::loadPointField<FieldType<I> >(data + offsetOf<Packed, I>())...);
+    fn(std::get<I>(point)...);
+    int expand[] = {(impl::storePointField(data + offsetOf<Packed, I>(), std::get<I>(point)), 0)...};
+    (void)expand;
+  }
+}
+
+template<typename... Fields>
+void PointCloud2Layout<Fields...>::setOffsets(const sensor_msgs::PointCloud2 &cloud_msg)
+{
+  const std::string names[] = {Fields::name()...};
+  const size_t sizes[] = {sizeof(typename Fields::type)...};
+  bool (*const holds[])(int) = {&impl::pointFieldHoldsType<typename Fields::type>...};
+  for (size_t i = 0; i < sizeof...(Fields); ++i)
+  {
+    std::vector<sensor_msgs::PointField>::const_iterator field_iter = cloud_msg.fields.begin(), field_end =
+        cloud_msg.fields.end();
+    while ((field_iter != field_end) && (field_iter->name != names[i]))
+      ++field_iter;
+    if (field_iter == field_end)
+      throw std::runtime_error("Field " + names[i] + " does not exist");
+    if (!holds[i](field_iter->datatype))
+      throw std::runtime_error("Field " + names[i] + " does not have the type of the layout");
+    if (field_iter->offset + sizes[i] > cloud_msg.point_step)
+      throw std::runtime_error("Field " + names[i] + " ends past the point step");
+    offsets_[i] = field_iter->offset;
+    if (offsets_[i] != packedOffset(i))
+      packed_ = false;
+  }
+}
+
+template<typename... Fields>
+template<size_t... I>
+typename PointCloud2Layout<Fields...>::Point
+PointCloud2Layout<Fields...>::read(const unsigned char *point, std::index_sequence<I...>) const
+{
+  return Point(get<I>(point)...);
+}
+
+template<typename... Fields>
+template<size_t... I>
+void PointCloud2Layout<Fields...>::write(unsigned char *point, const Point &values, std::index_sequence<I...>) const
+{
+  int expand[] = {(set<I>(point, std::get<I>(values)), 0)...};
+  (void)expand;
+}
+
+}
+
+#endif// SENSOR_MSGS_IMPL_POINT_CLOUD2_LAYOUT_H
@@ -0,0 +1,268 @@
+/*
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2026, Dimensional Robotics
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of the copyright holder nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef SENSOR_MSGS_IMPL_POINT_CLOUD2_PARALLEL_H
+#define SENSOR_MSGS_IMPL_POINT_CLOUD2_PARALLEL_H
+
+#include <sensor_msgs/PointCloud2.h>
+#include <algorithm>
+#include <cstring>
+#include <functional>
+
+/**
+ * \brief Private implementation used by PointCloud2ThreadPool and the parallel functions
+ */
+
+namespace sensor_msgs
+{
+inline PointCloud2ThreadPool::PointCloud2ThreadPool(size_t threads)
+  : generation_(0), active_(0), stop_(false), job_(NULL), context_(NULL), failed_(false)
+{
+  if (threads == 0)
+    threads = std::max(1u, std::thread::hardware_concurrency());
+  shares_.reset(new Share[threads]);
+  threads_.reserve(threads - 1);
+  for (size_t i = 1; i < threads; ++i)
+    threads_.push_back(std::thread(&PointCloud2ThreadPool::loop, this, i));
+}
+
+inline PointCloud2ThreadPool::~PointCloud2ThreadPool()
+{
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stop_ = true;
+  }
+  wake_.notify_all();
+  for (size_t i = 0; i < threads_.size(); ++i)
+    threads_[i].join();
+}
+
+inline PointCloud2ThreadPool &PointCloud2ThreadPool::global()
+{
+  static PointCloud2ThreadPool pool;
+  return pool;
+}
+
+inline size_t PointCloud2ThreadPool::size() const
+{
+  return threads_.size() + 1;
+}
+
+template<typename F>
+void PointCloud2ThreadPool::call(void *fn, size_t chunk)
+{
+  (*static_cast<F *>(fn))(chunk);
+}
+
+inline const PointCloud2ThreadPool::Working *&PointCloud2ThreadPool::working()
+{
+  static thread_local const Working *innermost = NULL;
+  return innermost;
+}
+
+inline bool PointCloud2ThreadPool::isWorking() const
+{
+  for (const Working *w = working(); w; w = w->outer)
+    if (w->pool == this)
+      return true;
+  return false;
+}
+
+template<typename F>
+void PointCloud2ThreadPool::run(size_t chunks, F fn)
+{
+  // A chunk of this pool's job may hold run_mutex_ already, through the thread that called run(): try_lock()
+  // is only for jobs started from other threads
+  std::unique_lock<std::mutex> run_lock(run_mutex_, std::defer_lock);
+  if (chunks < 2 || threads_.empty() || isWorking() || !run_lock.try_lock())
+  {
+    for (size_t i = 0; i < chunks; ++i)
+      fn(i);
+    return;
+  }
+  job_ = &PointCloud2ThreadPool::call<F>;
+  context_ = &fn;
+  start(chunks);
+  std::exception_ptr error;
+  {
+    std::unique_lock<std::mutex> lock(mutex_);
+    done_.wait(lock, [this] { return active_ == 0; });
+    std::swap(error, error_);
+  }
+  if (error)
+    std::rethrow_exception(error);
+}
+
+inline void PointCloud2ThreadPool::start(size_t chunks)
+{
+  const size_t n = size();
+  for (size_t i = 0; i < n; ++i)
+  {
+    shares_[i].next.store(chunks * i / n, std::memory_order_relaxed);
+    shares_[i].end = chunks * (i + 1) / n;
+  }
+  failed_.store(false, std::memory_order_relaxed);
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    active_ = n;
+    ++generation_;
+  }
+  wake_.notify_all();
+  work(0);
+}
+
+inline void PointCloud2ThreadPool::work(size_t self)
+{
+  const size_t n = size();
+  const Working working_here = { this, working() };
+  working() = &working_here;
+  // Own share first, then whatever is left in the others
+  for (size_t k = 0; k < n; ++k)
+  {
+    Share &share = shares_[(self + k) % n];
+    while (!failed_.load(std::memory_order_relaxed))
+    {
+      const size_t chunk = share.next.fetch_add(1, std::memory_order_relaxed);
+      if (chunk >= share.end)
+        break;
+      try
+      {
+        job_(context_, chunk);
+      }
+      catch (...)
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!error_)
+          error_ = std::current_exception();
+        failed_.store(true, std::memory_order_relaxed);
+      }
+    }
+  }
+  working() = working_here.outer;
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (--active_ == 0)
+    done_.notify_one();
+}
+
+inline void PointCloud2ThreadPool::loop(size_t self)
+{
+  size_t generation = 0;
+  for (;;)
+  {
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      wake_.wait(lock, [&] { return stop_ || generation_ != generation; });
+      if (stop_)
+        return;
+      generation = generation_;
+    }
+    work(self);
+  }
+}
+
+namespace impl
+{
+/** The number of points in each chunk of cloud_msg: kPointCloud2ChunkBytes worth, rounded down to whole rows
+ * if the cloud is organized and a row fits */
+inline size_t pointsPerChunk(const sensor_msgs::PointCloud2 &cloud_msg)
+{
+  size_t points = std::max<size_t>(1, kPointCloud2ChunkBytes / std::max<size_t>(1, cloud_msg.point_step));
+  if (cloud_msg.height > 1 && cloud_msg.width > 0 && cloud_msg.width <= points)
+    points -= points % cloud_msg.width;
+  return points;
+}
+}
+
+template<typename F>
+void parallelForEachChunk(const sensor_msgs::PointCloud2 &cloud_msg, F fn, PointCloud2ThreadPool &pool)
+{
+  if (cloud_msg.point_step == 0)
+    return;
+  const size_t n = cloud_msg.data.size() / cloud_msg.point_step;
+  const size_t points = impl::pointsPerChunk(cloud_msg);
+  pool.run((n + points - 1) / points, [&](size_t chunk) {
+    fn(chunk * points, std::min(n, (chunk + 1) * points));
+  });
+}
+
+template<typename Layout, typename F>
+void parallelForEachPoint(const sensor_msgs::PointCloud2 &cloud_msg, const Layout &layout, F fn,
+    PointCloud2ThreadPool &pool)
+{
+  parallelForEachChunk(cloud_msg, [&](size_t begin, size_t end) {
+    layout.forEach(cloud_msg, begin, end, std::ref(fn));
+  }, pool);
+}
+
+template<typename Layout, typename F>
+void parallelTransform(sensor_msgs::PointCloud2 &cloud_msg, const Layout &layout, F fn,
+    PointCloud2ThreadPool &pool)
+{
+  parallelForEachChunk(cloud_msg, [&](size_t begin, size_t end) {
+    layout.transform(cloud_msg, begin, end, std::ref(fn));
+  }, pool);
+}
+
+template<typename Layout, typename F>
+void parallelTransform(const sensor_msgs::PointCloud2 &cloud_in, sensor_msgs::PointCloud2 &cloud_out,
+    const Layout &layout, F fn, PointCloud2ThreadPool &pool)
+{
+  if (&cloud_in == &cloud_out)
+  {
+    parallelTransform(cloud_out, layout, fn, pool);
+    return;
+  }
+  cloud_out.header = cloud_in.header;
+  cloud_out.height = cloud_in.height;
+  cloud_out.width = cloud_in.width;
+  cloud_out.fields = cloud_in.fields;
+  cloud_out.is_bigendian = cloud_in.is_bigendian;
+  cloud_out.point_step = cloud_in.point_step;
+  cloud_out.row_step = cloud_in.row_step;
+  cloud_out.is_dense = cloud_in.is_dense;
+  cloud_out.data.resize(cloud_in.data.size());
+  if (cloud_in.data.empty())
+    return;
+  const size_t step = cloud_in.point_step;
+  // Bytes past the last whole point, which no chunk covers
+  const size_t points_end = step ? cloud_in.data.size() / step * step : 0;
+  std::copy(cloud_in.data.begin() + points_end, cloud_in.data.end(), cloud_out.data.begin() + points_end);
+  parallelForEachChunk(cloud_in, [&](size_t begin, size_t end) {
+    memcpy(&cloud_out.data[begin * step], &cloud_in.data[begin * step], (end - begin) * step);
+    layout.transform(cloud_out, begin, end, std::ref(fn));
+  }, pool);
+}
+}
+
+#endif// SENSOR_MSGS_IMPL_POINT_CLOUD2_PARALLEL_H
@@ -0,0 +1,315 @@
+/*
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2026, Dimensional Robotics
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of the copyright holder nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef SENSOR_MSGS_IMPL_POINT_CLOUD2_TRANSFORM_H
+#define SENSOR_MSGS_IMPL_POINT_CLOUD2_TRANSFORM_H
+
+#include <sensor_msgs/PointCloud2.h>
+#include <sensor_msgs/point_cloud2_deinterleave.h>
+#include <cmath>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+/**
+ * \brief Private implementation used by transformPointCloud2
+ */
+
+namespace sensor_msgs
+{
+namespace impl
+{
+/** How to transform one vector field of the points of a cloud: the points themselves or their normals */
+struct VectorTransform
+{
+  /** The offsets of the x, y and z components */
+  size_t offset[3];
+  /** Whether the components are FLOAT64 rather than FLOAT32 */
+  bool is_double;
+  /** The offset of 16 bytes of the point holding the three FLOAT32 components, and the lane of x in them, or -1
+   * if the components do not follow each other in such 16 bytes */
+  size_t window;
+  int lane;
+  /** R | t, row by row */
+  double matrix[3][4];
+  float matrix_f[3][4];
+};
+
+/** Whether cloud_msg has a field named name */
+inline bool hasPointField(const sensor_msgs::PointCloud2 &cloud_msg, const std::string &name)
+{
+  for (size_t i = 0; i < cloud_msg.fields.size(); ++i)
+    if (cloud_msg.fields[i].name == name)
+      return true;
+  return false;
+}
+
+/** The transform of the vector made of the fields names of cloud_msg, translated by the transform if translate
+ * @throw std::runtime_error if a field is missing, or the fields are not all FLOAT32 or all FLOAT64
+ */
+inline VectorTransform vectorTransform(const sensor_msgs::PointCloud2 &cloud_msg,
+    const std::vector<std::string> &names, const geometry_msgs::Transform &transform, bool translate)
+{
+  const std::vector<PointFieldSlot> slots = findPointFields(cloud_msg, names);
+  VectorTransform vector;
+  vector.is_double = slots[0].datatype == sensor_msgs::PointField::FLOAT64;
+  for (int i = 0; i < 3; ++i)
+  {
+    if (slots[i].datatype != (vector.is_double ? sensor_msgs::PointField::FLOAT64 : sensor_msgs::PointField::FLOAT32))
+      throw std::runtime_error("Fields " + names[0] + ", " + names[1] + " and " + names[2] +
+                               " are not all FLOAT32 or all FLOAT64");
+    vector.offset[i] = slots[i].offset;
+  }
+
+  vector.window = size_t(-1);
+  vector.lane = 0;
+  if (!vector.is_double && vector.offset[1] == vector.offset[0] + 4 && vector.offset[2] == vector.offset[0] + 8)
+  {
+    if (vector.offset[0] + 16 <= cloud_msg.point_step)
+    {
+      vector.window = vector.offset[0];
+    }
+    else if (vector.offset[0] >= 4)
+    {
+      vector.window = vector.offset[0] - 4;
+      vector.lane = 1;
+    }
+  }
+
+  // Normalized, so that a quaternion rounded on its way through a message does not scale the cloud
+  const geometry_msgs::Quaternion &q = transform.rotation;
+  const double norm = std::sqrt(q.x * q.x + q.y * q.y + q.z * q.z + q.w * q.w);
+  if (!(norm > 0))
+    throw std::runtime_error("The rotation of the transform is not a quaternion");
+  const double x = q.x / norm, y = q.y / norm, z = q.z / norm, w = q.w / norm;
+  const double rotation[3][3] = {{1 - 2 * (y * y + z * z), 2 * (x * y - z * w), 2 * (x * z + y * w)},
+                                 {2 * (x * y + z * w), 1 - 2 * (x * x + z * z), 2 * (y * z - x * w)},
+                                 {2 * (x * z - y * w), 2 * (y * z + x * w), 1 - 2 * (x * x + y * y)}};
+  const double translation[3] = {transform.translation.x, transform.translation.y, transform.translation.z};
+  for (int r = 0; r < 3; ++r)
+  {
+    for (int c = 0; c < 3; ++c)
+      vector.matrix[r][c] = rotation[r][c];
+    vector.matrix[r][3] = translate ? translation[r] : 0;
+    for (int c = 0; c < 4; ++c)
+      vector.matrix_f[r][c] = static_cast<float>(vector.matrix[r][c]);
+  }
+  return vector;
+}
+
+/** Transform the vector at offset of n points of type T */
+template<typename T>
+inline void transformStrided(unsigned char *data, size_t step, size_t n, const size_t offset[3],
+    const T matrix[3][4])
+{
+  // Copied, since the stores to data could otherwise modify them as far as the compiler knows
+  const size_t ox = offset[0], oy = offset[1], oz = offset[2];
+  const T m00 = matrix[0][0], m01 = matrix[0][1], m02 = matrix[0][2], m03 = matrix[0][3];
+  const T m10 = matrix[1][0], m11 = matrix[1][1], m12 = matrix[1][2], m13 = matrix[1][3];
+  const T m20 = matrix[2][0], m21 = matrix[2][1], m22 = matrix[2][2], m23 = matrix[2][3];
+  for (size_t i = 0; i < n; ++i, data += step)
+  {
+    T x, y, z;
+    memcpy(&x, data + ox, sizeof(T));
+    memcpy(&y, data + oy, sizeof(T));
+    memcpy(&z, data + oz, sizeof(T));
+    const T tx = m00 * x + (m01 * y + (m02 * z + m03));
+    const T ty = m10 * x + (m11 * y + (m12 * z + m13));
+    const T tz = m20 * x + (m21 * y + (m22 * z + m23));
+    memcpy(data + ox, &tx, sizeof(T));
+    memcpy(data + oy, &ty, sizeof(T));
+    memcpy(data + oz, &tz, sizeof(T));
+  }
+}
+
+#if defined(SENSOR_MSGS_DEINTERLEAVE_AVX) || defined(SENSOR_MSGS_DEINTERLEAVE_SSE2) || \
+    defined(SENSOR_MSGS_DEINTERLEAVE_NEON)
+#if defined(SENSOR_MSGS_DEINTERLEAVE_AVX)
+typedef __m256 VectorRow;
+
+inline VectorRow loadVectorRow(const unsigned char *p, size_t step)
+{
+  return loadWindows(p, step);
+}
+
+inline void storeVectorRow(unsigned char *p, size_t step, VectorRow r)
+{
+  storeWindows(p, step, r);
+}
+
+inline VectorRow splat(float value)
+{
+  return _mm256_set1_ps(value);
+}
+
+/** a * b + c */
+inline VectorRow multiplyAdd(VectorRow a, VectorRow b, VectorRow c)
+{
+#if defined(__FMA__)
+  return _mm256_fmadd_ps(a, b, c);
+#else
+  return _mm256_add_ps(_mm256_mul_ps(a, b), c);
+#endif
+}
+#elif defined(SENSOR_MSGS_DEINTERLEAVE_SSE2)
+typedef WindowRow VectorRow;
+
+inline VectorRow loadVectorRow(const unsigned char *p, size_t)
+{
+  return loadWindow(p);
+}
+
+inline void storeVectorRow(unsigned char *p, size_t, VectorRow r)
+{
+  storeWindow(p, r);
+}
+
+inline VectorRow splat(float value)
+{
+  return _mm_set1_ps(value);
+}
+
+inline VectorRow multiplyAdd(VectorRow a, VectorRow b, VectorRow c)
+{
+  return _mm_add_ps(_mm_mul_ps(a, b), c);
+}
+#else
+typedef WindowRow VectorRow;
+
+inline VectorRow loadVectorRow(const unsigned char *p, size_t)
+{
+  return loadWindow(p);
+}
+
+inline void storeVectorRow(unsigned char *p, size_t, VectorRow r)
+{
+  storeWindow(p, r);
+}
+
+inline VectorRow splat(float value)
+{
+  return vdupq_n_f32(value);
+}
+
+inline VectorRow multiplyAdd(VectorRow a, VectorRow b, VectorRow c)
+{
+  return vmlaq_f32(c, a, b);
+}
+#endif
+
+/** Transform the vector in lanes Lane to Lane + 2 of the window at data of n points, a multiple of
+ * kWindowBatch, keeping the other lane */
+template<int Lane>
+inline void transformWindow(unsigned char *data, size_t step, size_t n, const float matrix[3][4])
+{
+  VectorRow m[3][4];
+  for (int r = 0; r < 3; ++r)
+    for (int c = 0; c < 4; ++c)
+      m[r][c] = splat(matrix[r][c]);
+  for (size_t i = 0; i < n; i += kWindowBatch, data += kWindowBatch * step)
+  {
+    VectorRow v[4] = {loadVectorRow(data, step), loadVectorRow(data + step, step),
+                      loadVectorRow(data + 2 * step, step), loadVectorRow(data + 3 * step, step)};
+    transposeWindows(v[0], v[1], v[2], v[3]);
+    const VectorRow x = v[Lane], y = v[Lane + 1], z = v[Lane + 2];
+    for (int r = 0; r < 3; ++r)
+      v[Lane + r] = multiplyAdd(m[r][0], x, multiplyAdd(m[r][1], y, multiplyAdd(m[r][2], z, m[r][3])));
+    transposeWindows(v[0], v[1], v[2], v[3]);
+    for (int j = 0; j < 4; ++j)
+      storeVectorRow(data + j * step, step, v[j]);
+  }
+}
+
+/** Transform the vector of the first points of n through its window, returning how many were done */
+inline size_t transformWindows(unsigned char *data, size_t step, size_t n, const VectorTransform &vector)
+{
+  if (vector.window == size_t(-1))
+    return 0;
+  const size_t done = n / kWindowBatch * kWindowBatch;
+  if (vector.lane == 0)
+    transformWindow<0>(data + vector.window, step, done, vector.matrix_f);
+  else
+    transformWindow<1>(data + vector.window, step, done, vector.matrix_f);
+  return done;
+}
+#else
+inline size_t transformWindows(unsigned char *, size_t, size_t, const VectorTransform &)
+{
+  return 0;
+}
+#endif
+
+/** Transform the vector of the n points at data */
+inline void transformVectors(unsigned char *data, size_t step, size_t n, const VectorTransform &vector)
+{
+  if (vector.is_double)
+  {
+    transformStrided<double>(data, step, n, vector.offset, vector.matrix);
+    return;
+  }
+  const size_t done = transformWindows(data, step, n, vector);
+  transformStrided<float>(data + done * step, step, n - done, vector.offset, vector.matrix_f);
+}
+}
+
+inline void transformPointCloud2(sensor_msgs::PointCloud2 &cloud_msg, const geometry_msgs::Transform &transform,
+    PointCloud2ThreadPool &pool)
+{
+  static const char *const point_names[] = {"x", "y", "z"};
+  static const char *const normal_names[] = {"normal_x", "normal_y", "normal_z"};
+  std::vector<impl::VectorTransform> vectors;
+  vectors.push_back(impl::vectorTransform(cloud_msg, std::vector<std::string>(point_names, point_names + 3),
+                                          transform, true));
+  if (impl::hasPointField(cloud_msg, normal_names[0]) || impl::hasPointField(cloud_msg, normal_names[1]) ||
+      impl::hasPointField(cloud_msg, normal_names[2]))
+    vectors.push_back(impl::vectorTransform(cloud_msg, std::vector<std::string>(normal_names, normal_names + 3),
+                                            transform, false));
+
+  const size_t step = cloud_msg.point_step;
+  parallelForEachChunk(cloud_msg, [&](size_t begin, size_t end) {
+    for (size_t i = 0; i < vectors.size(); ++i)
+      impl::transformVectors(&cloud_msg.data[begin * step], step, end - begin, vectors[i]);
+  }, pool);
+}
+
+inline void transformPointCloud2(sensor_msgs::PointCloud2 &cloud_msg,
+    const geometry_msgs::TransformStamped &transform, PointCloud2ThreadPool &pool)
+{
+  transformPointCloud2(cloud_msg, transform.transform, pool);
+  cloud_msg.header = transform.header;
+}
+}
+
+#endif// SENSOR_MSGS_IMPL_POINT_CLOUD2_TRANSFORM_H
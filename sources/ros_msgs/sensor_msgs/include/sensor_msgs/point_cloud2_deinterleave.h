@@ -0,0 +1,106 @@
+/*
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2026, Dimensional Robotics
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of the copyright holder nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef SENSOR_MSGS_POINT_CLOUD2_DEINTERLEAVE_H
+#define SENSOR_MSGS_POINT_CLOUD2_DEINTERLEAVE_H
+
+#include <sensor_msgs/PointCloud2.h>
+#include <sensor_msgs/point_field_conversion.h>
+#include <string>
+#include <vector>
+
+/**
+ * \brief Bulk copies between the interleaved points of a PointCloud2 and one array per field
+ *
+ * Reading x, y, z and intensity with readPointCloud2BufferValue() switches on the datatype of every value.
+ * extractFields() looks each field up once and copies it into an array of its own, converting it to the
+ * requested type on the way; interleaveFields() does the opposite:
+ * <PRE>
+ *   std::vector<std::vector<float> > xyzi;
+ *   sensor_msgs::extractFields(cloud_msg, {"x", "y", "z", "intensity"}, xyzi);
+ *   // xyzi[0] holds the x of every point, xyzi[3] the intensities
+ *   ...
+ *   sensor_msgs::interleaveFields(cloud_msg, {"x", "y", "z"}, xyzi);
+ * </PRE>
+ *
+ * FLOAT32 fields read or written as float are moved four points at a time: every field that lies within the
+ * same 16 bytes of a point is gathered by loading those 16 bytes of four (SSE2, NEON) or eight (AVX) points
+ * and transposing them. Define SENSOR_MSGS_NO_SIMD to use the scalar loops only. Other fields and types go
+ * through a loop per field, converted with static_cast as readPointCloud2BufferValue() does. Values are in
+ * host byte order, as PointCloud2Iterator reads them, and there are PointCloud2Modifier::size() points.
+ */
+
+namespace sensor_msgs
+{
+/**
+ * @brief Copy fields of every point into one array per field
+ * @param cloud_msg the PointCloud2 to read
+ * @param field_names the fields to copy
+ * @param out receives the values of field_names[i] in out[i], which must have room for one per point
+ * @throw std::runtime_error if a field does not exist or ends past the point step
+ */
+template<typename T>
+void extractFields(const sensor_msgs::PointCloud2 &cloud_msg, const std::vector<std::string> &field_names,
+    T *const *out);
+
+/**
+ * @brief Same as above, resizing out to one vector per field with one value per point
+ */
+template<typename T>
+void extractFields(const sensor_msgs::PointCloud2 &cloud_msg, const std::vector<std::string> &field_names,
+    std::vector<std::vector<T> > &out);
+
+/**
+ * @brief Copy one array per field into fields of every point, leaving the other fields as they are
+ * @param cloud_msg the PointCloud2 to write, with its fields set and its data sized
+ * @param field_names the fields to write
+ * @param in the values of field_names[i] in in[i], one per point
+ * @throw std::runtime_error if a field does not exist or ends past the point step
+ */
+template<typename T>
+void interleaveFields(sensor_msgs::PointCloud2 &cloud_msg, const std::vector<std::string> &field_names,
+    const T *const *in);
+
+/**
+ * @brief Same as above
+ * @throw std::runtime_error also if an array does not hold one value per point
+ */
+template<typename T>
+void interleaveFields(sensor_msgs::PointCloud2 &cloud_msg, const std::vector<std::string> &field_names,
+    const std::vector<std::vector<T> > &in);
+}
+
+#include <sensor_msgs/impl/point_cloud2_deinterleave.h>
+
+#endif// SENSOR_MSGS_POINT_CLOUD2_DEINTERLEAVE_H
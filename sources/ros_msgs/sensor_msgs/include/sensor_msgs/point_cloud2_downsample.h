@@ -0,0 +1,88 @@
+/*
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2026, Dimensional Robotics
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of the copyright holder nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef SENSOR_MSGS_POINT_CLOUD2_DOWNSAMPLE_H
+#define SENSOR_MSGS_POINT_CLOUD2_DOWNSAMPLE_H
+
+#include <sensor_msgs/PointCloud2.h>
+#include <sensor_msgs/point_cloud2_parallel.h>
+
+/**
+ * \brief Voxel grid downsampling of a PointCloud2
+ *
+ * Space is cut into cubes of leaf_size, aligned on the origin, and the points falling in each cube become a single
+ * point with the same fields as the input:
+ * <PRE>
+ *   // At most one point per 10 cm cube, the mean of the points in it
+ *   sensor_msgs::PointCloud2 sparse_msg = sensor_msgs::voxelDownsample(cloud_msg, 0.1);
+ * </PRE>
+ *
+ * Each point gets the number of its cube within the bounding box of the cloud, the points are radix sorted by
+ * it, and the runs of points of the same cube are reduced to one point each. Every step is shared out between
+ * the threads of a PointCloud2ThreadPool. Points whose x, y or z is not finite are dropped. The output is
+ * unorganized (its height is 1), dense, and holds its points in the order of their cube numbers, so the same
+ * input always gives the same output.
+ */
+
+namespace sensor_msgs
+{
+/** How the points of a cube become one */
+enum VoxelReduction
+{
+  /** Every field is the mean of the field over the points, rounded for integer fields; the channels of rgb and
+   * rgba fields are averaged one by one */
+  VOXEL_CENTROID,
+  /** The point that comes first in the input */
+  VOXEL_FIRST_POINT,
+  /** The point with the largest "intensity", the first of them on a tie */
+  VOXEL_MAX_INTENSITY
+};
+
+/**
+ * @brief Downsample a cloud to at most one point per cube of a voxel grid
+ * @param cloud_msg the PointCloud2 to downsample, with x, y and z fields of any type
+ * @param leaf_size the side of the cubes, in the unit of x, y and z
+ * @param reduction how the points of a cube are combined
+ * @param pool the threads to run on
+ * @return a cloud with the header, fields and point step of @p cloud_msg and a point per non-empty cube
+ * @throw std::runtime_error if leaf_size is not positive, x, y or z is missing, the bounding box of the cloud holds
+ *        more than 2^62 cubes, or reduction is VOXEL_MAX_INTENSITY and there is no intensity field
+ */
+sensor_msgs::PointCloud2 voxelDownsample(const sensor_msgs::PointCloud2 &cloud_msg, double leaf_size,
+    VoxelReduction reduction = VOXEL_CENTROID, PointCloud2ThreadPool &pool = PointCloud2ThreadPool::global());
+}
+
+#include <sensor_msgs/impl/point_cloud2_downsample.h>
+
+#endif// SENSOR_MSGS_POINT_CLOUD2_DOWNSAMPLE_H
@@ -0,0 +1,246 @@
+/*
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2026, Dimensional Robotics
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of the copyright holder nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef SENSOR_MSGS_POINT_CLOUD2_LAYOUT_H
+#define SENSOR_MSGS_POINT_CLOUD2_LAYOUT_H
+
+#include <sensor_msgs/PointCloud2.h>
+#include <sensor_msgs/point_cloud2_iterator.h>
+#include <sensor_msgs/point_field_conversion.h>
+#include <cstddef>
+#include <string>
+#include <tuple>
+#include <utility>
+
+/**
+ * \brief Typed access to whole PointCloud2 points
+ *
+ * A PointCloud2Iterator looks its field up by name when it is created and
+ * covers a single field, so reading x, y, z and rgb takes four iterators that
+ * are all advanced on every point. A PointCloud2Layout names every field the
+ * code needs, with its type, checks them against the fields of a cloud once,
+ * and then reads or writes whole points:
+ * <PRE>
+ *   typedef sensor_msgs::PointCloud2Layout<sensor_msgs::point_cloud2_fields::X,
+ *                                          sensor_msgs::point_cloud2_fields::Y,
+ *                                          sensor_msgs::point_cloud2_fields::Z,
+ *                                          sensor_msgs::point_cloud2_fields::Intensity> XYZI;
+ *   // Throws std::runtime_error if a field is missing or of another type
+ *   XYZI layout(cloud_msg);
+ *   layout.forEach(cloud_msg, [&](float x, float y, float z, float intensity) {
+ *     ...
+ *   });
+ *   // Fields passed by reference are written back
+ *   layout.transform(cloud_msg, [](float &x, float &y, float &z, float &intensity) {
+ *     intensity /= 255;
+ *   });
+ * </PRE>
+ *
+ * The fields are found wherever the cloud has them. When the cloud has them
+ * in the layout's own packed order (declaration order, each field aligned to
+ * its size, see setPointCloud2Fields()), forEach() and transform() use
+ * compile-time offsets and point step, so the compiler can turn a loop over
+ * them into packed loads and stores. Values are read in host byte order, as
+ * PointCloud2Iterator does.
+ */
+
+namespace sensor_msgs
+{
+/**
+ * @brief A field of a PointCloud2Layout: its type and its name, spelled as characters since C++14 has no
+ *        string template arguments, e.g. PointCloud2Field<float, 'x'>
+ *
+ * The field of the cloud must have the PointField datatype of T, or be of the same size if T is an unsigned
+ * integer, to read packed fields such as rgb (stored as a FLOAT32) as a uint32_t.
+ */
+template<typename T, char... Name>
+struct PointCloud2Field
+{
+  typedef T type;
+
+  /**
+   * @return the name of the field
+   */
+  static std::string name();
+};
+
+/**
+ * \brief The usual fields of a point cloud
+ */
+namespace point_cloud2_fields
+{
+typedef PointCloud2Field<float, 'x'> X;
+typedef PointCloud2Field<float, 'y'> Y;
+typedef PointCloud2Field<float, 'z'> Z;
+typedef PointCloud2Field<float, 'i', 'n', 't', 'e', 'n', 's', 'i', 't', 'y'> Intensity;
+typedef PointCloud2Field<uint32_t, 'r', 'g', 'b'> RGB;
+typedef PointCloud2Field<uint32_t, 'r', 'g', 'b', 'a'> RGBA;
+typedef PointCloud2Field<uint16_t, 'r', 'i', 'n', 'g'> Ring;
+}
+
+/**
+ * \brief The offsets of a set of fields in a PointCloud2, checked once
+ *
+ * Fields is a list of PointCloud2Field.
+ */
+template<typename... Fields>
+class PointCloud2Layout
+{
+public:
+  /** The values of all the fields of a point */
+  typedef std::tuple<typename Fields::type...> Point;
+
+  /** The type of the I th field */
+  template<size_t I>
+  using FieldType = typename std::tuple_element<I, Point>::type;
+
+  /**
+   * @param cloud_msg The PointCloud2 to find the fields in
+   * @throw std::runtime_error if a field is missing, of another type or past the point step
+   */
+  explicit PointCloud2Layout(const sensor_msgs::PointCloud2 &cloud_msg);
+
+  /**
+   * @brief Set the fields of a PointCloud2 to the packed layout and resize its data for width * height points,
+   *        like PointCloud2Modifier::setPointCloud2Fields
+   * @param cloud_msg the PointCloud2 to modify
+   */
+  static void setPointCloud2Fields(sensor_msgs::PointCloud2 &cloud_msg);
+
+  /**
+   * @return the offset of the i th field in the packed layout
+   */
+  static constexpr size_t packedOffset(size_t i);
+
+  /**
+   * @return the point step of the packed layout: the end of the last field, aligned to the largest field
+   */
+  static constexpr size_t packedPointStep();
+
+  /**
+   * @return the offset of the i th field in the cloud
+   */
+  size_t offset(size_t i) const;
+
+  /**
+   * @return the point step of the cloud
+   */
+  size_t pointStep() const;
+
+  /**
+   * @return whether the cloud has the fields at their packed offsets and the packed point step
+   */
+  bool isPacked() const;
+
+  /**
+   * @return the number of points in @p cloud_msg, as PointCloud2Modifier::size() counts them
+   */
+  size_t size(const sensor_msgs::PointCloud2 &cloud_msg) const;
+
+  /**
+   * @return the value of the I th field of the point starting at @p point
+   */
+  template<size_t I>
+  FieldType<I> get(const unsigned char *point) const;
+
+  /**
+   * @brief Set the I th field of the point starting at @p point
+   */
+  template<size_t I>
+  void set(unsigned char *point, const FieldType<I> &value) const;
+
+  /**
+   * @return all the fields of the i th point of @p cloud_msg
+   */
+  Point read(const sensor_msgs::PointCloud2 &cloud_msg, size_t i) const;
+
+  /**
+   * @brief Set all the fields of the i th point of @p cloud_msg
+   */
+  void write(sensor_msgs::PointCloud2 &cloud_msg, size_t i, const Point &point) const;
+
+  /**
+   * @brief Call fn with the values of the fields of each point, in order
+   */
+  template<typename F>
+  void forEach(const sensor_msgs::PointCloud2 &cloud_msg, F fn) const;
+
+  /**
+   * @brief Call fn with the values of the fields of each point as lvalues, and write them back
+   */
+  template<typename F>
+  void transform(sensor_msgs::PointCloud2 &cloud_msg, F fn) const;
+
+  /**
+   * @brief Same as forEach(cloud_msg, fn) for the points [begin, end) only
+   */
+  template<typename F>
+  void forEach(const sensor_msgs::PointCloud2 &cloud_msg, size_t begin, size_t end, F fn) const;
+
+  /**
+   * @brief Same as transform(cloud_msg, fn) for the points [begin, end) only
+   */
+  template<typename F>
+  void transform(sensor_msgs::PointCloud2 &cloud_msg, size_t begin, size_t end, F fn) const;
+
+private:
+  template<bool Packed, size_t I>
+  size_t offsetOf() const;
+
+  template<bool Packed, typename F, size_t... I>
+  void forEach(const unsigned char *data, size_t n, F &fn, std::index_sequence<I...>) const;
+
+  template<bool Packed, typename F, size_t... I>
+  void transform(unsigned char *data, size_t n, F &fn, std::index_sequence<I...>) const;
+
+  void setOffsets(const sensor_msgs::PointCloud2 &cloud_msg);
+
+  template<size_t... I>
+  Point read(const unsigned char *point, std::index_sequence<I...>) const;
+
+  template<size_t... I>
+  void write(unsigned char *point, const Point &values, std::index_sequence<I...>) const;
+
+  /** The offset of each field in the cloud */
+  size_t offsets_[sizeof...(Fields)];
+  /** The "point_step" of the cloud */
+  size_t point_step_;
+  /** Whether offsets_ and point_step_ are those of the packed layout */
+  bool packed_;
+};
+}
+
+#include <sensor_msgs/impl/point_cloud2_layout.h>
+
+#endif// SENSOR_MSGS_POINT_CLOUD2_LAYOUT_H
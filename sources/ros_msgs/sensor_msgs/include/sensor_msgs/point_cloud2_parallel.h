@@ -0,0 +1,201 @@
+/*
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2026, Dimensional Robotics
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of the copyright holder nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef SENSOR_MSGS_POINT_CLOUD2_PARALLEL_H
+#define SENSOR_MSGS_POINT_CLOUD2_PARALLEL_H
+
+#include <sensor_msgs/PointCloud2.h>
+#include <sensor_msgs/point_cloud2_layout.h>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * \brief Per-point work on a PointCloud2 spread over every core
+ *
+ * The data of the cloud is cut into chunks of about kPointCloud2ChunkBytes, made of whole rows when the cloud
+ * is organized and its rows fit, and the chunks are shared out between the threads of a
+ * PointCloud2ThreadPool:
+ * <PRE>
+ *   XYZI layout(cloud_msg);
+ *   // Each call may come from another thread, so fn must be safe to call concurrently
+ *   sensor_msgs::parallelTransform(cloud_msg, layout, [](float &x, float &y, float &z, float &intensity) {
+ *     if (intensity < 10)
+ *       x = y = z = std::numeric_limits<float>::quiet_NaN();
+ *   });
+ *   // Or into another cloud, leaving cloud_msg as it is
+ *   sensor_msgs::parallelTransform(cloud_msg, filtered_msg, layout, ...);
+ * </PRE>
+ *
+ * The functions return once every point has been seen. The points of a chunk are visited in order, the
+ * chunks in no particular order.
+ */
+
+namespace sensor_msgs
+{
+/** The size of the chunks the data of a cloud is cut into: small enough to stay in the L2 cache of a core and
+ * to leave many chunks per thread, large enough that claiming one costs nothing next to the work on it */
+const size_t kPointCloud2ChunkBytes = 64 * 1024;
+
+/**
+ * \brief A set of threads running chunks of a job, the calling thread included
+ *
+ * run() hands each thread an even share of the chunks; a thread that finishes its share takes chunks left in
+ * the shares of the others, so a chunk that is slow to process does not hold the others up. The threads are
+ * started once and wait for the next job in between.
+ */
+class PointCloud2ThreadPool
+{
+public:
+  /**
+   * @param threads the number of threads running a job, counting the one calling run(); 0 for
+   *        std::thread::hardware_concurrency()
+   */
+  explicit PointCloud2ThreadPool(size_t threads = 0);
+
+  ~PointCloud2ThreadPool();
+
+  PointCloud2ThreadPool(const PointCloud2ThreadPool &) = delete;
+  PointCloud2ThreadPool &operator=(const PointCloud2ThreadPool &) = delete;
+
+  /**
+   * @return the pool the parallel functions use by default, with a thread per core
+   */
+  static PointCloud2ThreadPool &global();
+
+  /**
+   * @return the number of threads running a job, counting the one calling run()
+   */
+  size_t size() const;
+
+  /**
+   * @brief Call fn(i) for each i in [0, chunks), from any thread of the pool, and wait for them all
+   *
+   * If the pool is busy with another job, because run() is called from a chunk or from two threads at once,
+   * the chunks run in order on the calling thread instead.
+   * @throw the first exception thrown by fn, once the chunks already started are done; the others are skipped
+   */
+  template<typename F>
+  void run(size_t chunks, F fn);
+
+private:
+  /** The chunks a thread takes first, on a cache line of its own */
+  struct alignas(64) Share
+  {
+    std::atomic<size_t> next;
+    size_t end;
+  };
+
+  /** A pool a thread is running chunks for, innermost first */
+  struct Working
+  {
+    const PointCloud2ThreadPool *pool;
+    const Working *outer;
+  };
+
+  template<typename F>
+  static void call(void *fn, size_t chunk);
+
+  /** The pools the calling thread is running chunks for */
+  static const Working *&working();
+  /** True if the calling thread is running chunks for this pool, so run() is nested in one of them */
+  bool isWorking() const;
+
+  void start(size_t chunks);
+  void work(size_t self);
+  void loop(size_t self);
+
+  std::vector<std::thread> threads_;
+  std::unique_ptr<Share[]> shares_;
+  /** Taken for the whole of a job, never by a thread that is running chunks of it */
+  std::mutex run_mutex_;
+  /** Guards generation_, active_, stop_ and error_ */
+  std::mutex mutex_;
+  std::condition_variable wake_;
+  std::condition_variable done_;
+  /** Bumped for each job, so that a thread runs each job once */
+  size_t generation_;
+  /** The threads of the pool still on the current job */
+  size_t active_;
+  bool stop_;
+  /** The current job */
+  void (*job_)(void *, size_t);
+  void *context_;
+  std::atomic<bool> failed_;
+  std::exception_ptr error_;
+};
+
+/**
+ * @brief Call fn(begin, end) for consecutive ranges of points covering the PointCloud2Modifier::size() points
+ *        of @p cloud_msg, from the threads of @p pool
+ */
+template<typename F>
+void parallelForEachChunk(const sensor_msgs::PointCloud2 &cloud_msg, F fn,
+    PointCloud2ThreadPool &pool = PointCloud2ThreadPool::global());
+
+/**
+ * @brief Call fn with the values of the fields of @p layout for each point, as PointCloud2Layout::forEach
+ *        does, from the threads of @p pool
+ */
+template<typename Layout, typename F>
+void parallelForEachPoint(const sensor_msgs::PointCloud2 &cloud_msg, const Layout &layout, F fn,
+    PointCloud2ThreadPool &pool = PointCloud2ThreadPool::global());
+
+/**
+ * @brief Call fn with the fields of @p layout for each point as lvalues and write them back, as
+ *        PointCloud2Layout::transform does, from the threads of @p pool
+ */
+template<typename Layout, typename F>
+void parallelTransform(sensor_msgs::PointCloud2 &cloud_msg, const Layout &layout, F fn,
+    PointCloud2ThreadPool &pool = PointCloud2ThreadPool::global());
+
+/**
+ * @brief Same as above, writing into @p cloud_out: it is given the header, shape and fields of @p cloud_in
+ *        and a copy of its points, which fn then modifies. The copy is made by the same threads, a chunk at a
+ *        time, so each chunk is still in cache when fn runs on it.
+ * @param layout a layout checked against @p cloud_in
+ */
+template<typename Layout, typename F>
+void parallelTransform(const sensor_msgs::PointCloud2 &cloud_in, sensor_msgs::PointCloud2 &cloud_out,
+    const Layout &layout, F fn, PointCloud2ThreadPool &pool = PointCloud2ThreadPool::global());
+}
+
+#include <sensor_msgs/impl/point_cloud2_parallel.h>
+
+#endif// SENSOR_MSGS_POINT_CLOUD2_PARALLEL_H
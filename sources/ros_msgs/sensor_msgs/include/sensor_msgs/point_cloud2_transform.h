@@ -0,0 +1,87 @@
+/*
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2026, Dimensional Robotics
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of the copyright holder nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef SENSOR_MSGS_POINT_CLOUD2_TRANSFORM_H
+#define SENSOR_MSGS_POINT_CLOUD2_TRANSFORM_H
+
+#include <geometry_msgs/Transform.h>
+#include <geometry_msgs/TransformStamped.h>
+#include <sensor_msgs/PointCloud2.h>
+#include <sensor_msgs/point_cloud2_parallel.h>
+
+/**
+ * \brief Rigid transform of the points of a PointCloud2, in place
+ *
+ * The rotation matrix is computed from the quaternion once, and each point p becomes R * p + t. The normal_x,
+ * normal_y and normal_z fields, when the cloud has them, are rotated as well. Other fields are left as they are:
+ * <PRE>
+ *   geometry_msgs::TransformStamped base_from_lidar = tf_buffer.lookupTransform("base_link", cloud_msg.header.frame_id,
+ *                                                                              cloud_msg.header.stamp);
+ *   // cloud_msg is now in base_link
+ *   sensor_msgs::transformPointCloud2(cloud_msg, base_from_lidar);
+ * </PRE>
+ *
+ * When x, y and z are FLOAT32 fields that follow each other, as in PCL clouds and most lidar drivers, and the
+ * 16 bytes around them lie within a point, points are transformed eight (AVX) or four (SSE2, NEON) at a time
+ * by transposing those bytes into one register per field, like extractFields() does. Define
+ * SENSOR_MSGS_NO_SIMD to use the scalar loops only. Fields placed otherwise, and FLOAT64 fields, which are
+ * transformed in double precision, go through a scalar loop. The points are shared out between the threads of
+ * a PointCloud2ThreadPool, as parallelForEachChunk() does.
+ */
+
+namespace sensor_msgs
+{
+/**
+ * @brief Apply @p transform to the points and normals of @p cloud_msg
+ * @param cloud_msg the PointCloud2 to modify
+ * @param transform the pose of the frame of the cloud in the target frame
+ * @param pool the threads to run on
+ * @throw std::runtime_error if x, y or z is missing, if the cloud has some but not all of normal_x, normal_y
+ *        and normal_z, if the fields of a vector are not all FLOAT32 or all FLOAT64, or if the rotation of
+ *        @p transform is all zeros
+ */
+void transformPointCloud2(sensor_msgs::PointCloud2 &cloud_msg, const geometry_msgs::Transform &transform,
+    PointCloud2ThreadPool &pool = PointCloud2ThreadPool::global());
+
+/**
+ * @brief Same as above, also setting the header of @p cloud_msg to that of @p transform, as tf2's doTransform
+ *        does
+ */
+void transformPointCloud2(sensor_msgs::PointCloud2 &cloud_msg, const geometry_msgs::TransformStamped &transform,
+    PointCloud2ThreadPool &pool = PointCloud2ThreadPool::global());
+}
+
+#include <sensor_msgs/impl/point_cloud2_transform.h>
+
+#endif// SENSOR_MSGS_POINT_CLOUD2_TRANSFORM_H
@@ -0,0 +1,137 @@
+/*
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2026, Dimensional Robotics
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of the copyright holder nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <cstring>
+
+#include <sensor_msgs/point_cloud2_deinterleave.h>
+
+namespace
+{
+// Store @p value at @p p, which need not be aligned for T
+template <typename T>
+void put(unsigned char *p, T value)
+{
+  memcpy(p, &value, sizeof(value));
+}
+
+// n points of x, y, z, a uint16 ring and a float64 time, unaligned, with the values of point i derived from i
+sensor_msgs::PointCloud2 makeCloud(size_t n)
+{
+  sensor_msgs::PointCloud2 cloud_msg;
+  cloud_msg.height = 1;
+  cloud_msg.width = n;
+  sensor_msgs::PointCloud2Modifier modifier(cloud_msg);
+  modifier.setPointCloud2Fields(5, "x", 1, sensor_msgs::PointField::FLOAT32,
+                                   "y", 1, sensor_msgs::PointField::FLOAT32,
+                                   "z", 1, sensor_msgs::PointField::FLOAT32,
+                                   "ring", 1, sensor_msgs::PointField::UINT16,
+                                   "time", 1, sensor_msgs::PointField::FLOAT64);
+  for (size_t i = 0; i < n; ++i)
+  {
+    unsigned char *point = &cloud_msg.data[i * cloud_msg.point_step];
+    put(point + 0, i + 0.5f);
+    put(point + 4, -1.0f * i);
+    put(point + 8, 2.0f * i);
+    put(point + 12, static_cast<uint16_t>(i % 128));
+    put(point + 14, i * 1e-6);
+  }
+  return cloud_msg;
+}
+}
+
+TEST(sensor_msgs, ExtractFields)
+{
+  sensor_msgs::PointCloud2 cloud_msg = makeCloud(37);
+  std::vector<std::vector<float> > xyzr;
+  sensor_msgs::extractFields(cloud_msg, {"z", "x", "ring", "y"}, xyzr);
+  ASSERT_EQ(4u, xyzr.size());
+  for (size_t i = 0; i < 37; ++i)
+  {
+    EXPECT_EQ(2.0f * i, xyzr[0][i]);
+    EXPECT_EQ(i + 0.5f, xyzr[1][i]);
+    EXPECT_EQ(static_cast<float>(i % 128), xyzr[2][i]);
+    EXPECT_EQ(-1.0f * i, xyzr[3][i]);
+  }
+
+  std::vector<std::vector<double> > time;
+  sensor_msgs::extractFields(cloud_msg, {"time"}, time);
+  EXPECT_DOUBLE_EQ(36e-6, time[0][36]);
+
+  EXPECT_THROW(sensor_msgs::extractFields(cloud_msg, {"intensity"}, xyzr), std::runtime_error);
+}
+
+TEST(sensor_msgs, InterleaveFields)
+{
+  // PCL's PointXYZRGB: the padding after z and rgb must survive
+  sensor_msgs::PointCloud2 cloud_msg;
+  cloud_msg.height = 1;
+  cloud_msg.width = 21;
+  sensor_msgs::PointCloud2Modifier modifier(cloud_msg);
+  modifier.setPointCloud2FieldsByString(2, "xyz", "rgb");
+  for (size_t i = 0; i < cloud_msg.data.size(); ++i)
+    cloud_msg.data[i] = static_cast<unsigned char>(i);
+  sensor_msgs::PointCloud2 original = cloud_msg;
+
+  std::vector<std::vector<float> > xyz(3, std::vector<float>(21));
+  for (size_t i = 0; i < 21; ++i)
+  {
+    xyz[0][i] = i;
+    xyz[1][i] = 10.0f * i;
+    xyz[2][i] = 100.0f * i;
+  }
+  sensor_msgs::interleaveFields(cloud_msg, {"x", "y", "z"}, xyz);
+
+  sensor_msgs::PointCloud2ConstIterator<float> iter_x(cloud_msg, "x");
+  for (size_t i = 0; i < 21; ++i, ++iter_x)
+  {
+    EXPECT_EQ(xyz[0][i], iter_x[0]);
+    EXPECT_EQ(xyz[1][i], iter_x[1]);
+    EXPECT_EQ(xyz[2][i], iter_x[2]);
+  }
+  for (size_t i = 0; i < cloud_msg.data.size(); ++i)
+    ASSERT_TRUE(i % cloud_msg.point_step < 12 || original.data[i] == cloud_msg.data[i]) << "byte " << i;
+
+  // Converted to the datatype of each field
+  sensor_msgs::PointCloud2 lidar_msg = makeCloud(9);
+  std::vector<std::vector<int> > rings(1, std::vector<int>(9, 7));
+  sensor_msgs::interleaveFields(lidar_msg, {"ring"}, rings);
+  std::vector<std::vector<int> > back;
+  sensor_msgs::extractFields(lidar_msg, {"ring"}, back);
+  EXPECT_EQ(rings, back);
+
+  rings[0].pop_back();
+  EXPECT_THROW(sensor_msgs::interleaveFields(lidar_msg, {"ring"}, rings), std::runtime_error);
+}
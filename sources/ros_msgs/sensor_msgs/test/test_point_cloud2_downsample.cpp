@@ -0,0 +1,163 @@
+/*
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2026, Dimensional Robotics
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of the copyright holder nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <sensor_msgs/point_cloud2_downsample.h>
+#include <sensor_msgs/point_cloud2_layout.h>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+namespace
+{
+namespace fields = sensor_msgs::point_cloud2_fields;
+typedef sensor_msgs::PointCloud2Layout<fields::X, fields::Y, fields::Z, fields::Intensity, fields::RGB> XYZIRGB;
+
+sensor_msgs::PointCloud2 makeCloud(const std::vector<XYZIRGB::Point> &points)
+{
+  sensor_msgs::PointCloud2 cloud_msg;
+  cloud_msg.header.frame_id = "lidar";
+  cloud_msg.height = 1;
+  cloud_msg.width = points.size();
+  XYZIRGB::setPointCloud2Fields(cloud_msg);
+  XYZIRGB layout(cloud_msg);
+  for (size_t i = 0; i < points.size(); ++i)
+    layout.write(cloud_msg, i, points[i]);
+  return cloud_msg;
+}
+}
+
+TEST(sensor_msgs, voxelDownsampleReductions)
+{
+  const float nan = std::numeric_limits<float>::quiet_NaN();
+  // Two points in the cube of the origin, one in the cube at -1 along x, and one dropped
+  sensor_msgs::PointCloud2 cloud_msg = makeCloud({XYZIRGB::Point(0.1f, 0.2f, 0.3f, 10, 0x102030),
+                                                  XYZIRGB::Point(-0.5f, 0.5f, 0.5f, 7, 0x000000),
+                                                  XYZIRGB::Point(nan, 0, 0, 100, 0),
+                                                  XYZIRGB::Point(0.3f, 0.4f, 0.5f, 20, 0x305070)});
+  XYZIRGB layout(cloud_msg);
+
+  sensor_msgs::PointCloud2 out_msg = sensor_msgs::voxelDownsample(cloud_msg, 1.0);
+  EXPECT_EQ("lidar", out_msg.header.frame_id);
+  EXPECT_EQ(1u, out_msg.height);
+  ASSERT_EQ(2u, out_msg.width);
+  EXPECT_EQ(cloud_msg.fields.size(), out_msg.fields.size());
+  ASSERT_EQ(2 * out_msg.point_step, out_msg.data.size());
+  // Ordered by cube: -1 along x first
+  EXPECT_EQ(layout.read(cloud_msg, 1), layout.read(out_msg, 0));
+  XYZIRGB::Point centroid = layout.read(out_msg, 1);
+  EXPECT_FLOAT_EQ(0.2f, std::get<0>(centroid));
+  EXPECT_FLOAT_EQ(0.3f, std::get<1>(centroid));
+  EXPECT_FLOAT_EQ(0.4f, std::get<2>(centroid));
+  EXPECT_FLOAT_EQ(15, std::get<3>(centroid));
+  EXPECT_EQ(0x203850u, std::get<4>(centroid));
+
+  out_msg = sensor_msgs::voxelDownsample(cloud_msg, 1.0, sensor_msgs::VOXEL_FIRST_POINT);
+  ASSERT_EQ(2u, out_msg.width);
+  EXPECT_EQ(layout.read(cloud_msg, 0), layout.read(out_msg, 1));
+  out_msg = sensor_msgs::voxelDownsample(cloud_msg, 1.0, sensor_msgs::VOXEL_MAX_INTENSITY);
+  ASSERT_EQ(2u, out_msg.width);
+  EXPECT_EQ(layout.read(cloud_msg, 3), layout.read(out_msg, 1));
+
+  EXPECT_THROW(sensor_msgs::voxelDownsample(cloud_msg, 0), std::runtime_error);
+  EXPECT_THROW(sensor_msgs::voxelDownsample(cloud_msg, 1e-7), std::runtime_error);
+  // Cube indices at both ends of the range voxelIndex() clamps to
+  sensor_msgs::PointCloud2 far_msg = makeCloud({XYZIRGB::Point(-1e30f, 0, 0, 0, 0),
+                                                XYZIRGB::Point(1e30f, 0, 0, 0, 0)});
+  EXPECT_THROW(sensor_msgs::voxelDownsample(far_msg, 1.0), std::runtime_error);
+  sensor_msgs::PointCloud2 xyz_msg;
+  xyz_msg.height = 1;
+  xyz_msg.width = 1;
+  sensor_msgs::PointCloud2Layout<fields::X, fields::Y, fields::Z>::setPointCloud2Fields(xyz_msg);
+  EXPECT_THROW(sensor_msgs::voxelDownsample(xyz_msg, 1.0, sensor_msgs::VOXEL_MAX_INTENSITY), std::runtime_error);
+}
+
+TEST(sensor_msgs, voxelDownsampleFloat64)
+{
+  // Map coordinates, where floats are 0.5 apart: as floats, the three points would fall in one cube
+  const double xs[] = {5e6 + 0.01, 5e6 + 0.04, 5e6 + 0.07};
+  sensor_msgs::PointCloud2 cloud_msg;
+  cloud_msg.height = 1;
+  cloud_msg.width = 3;
+  sensor_msgs::PointCloud2Modifier modifier(cloud_msg);
+  modifier.setPointCloud2Fields(3, "x", 1, sensor_msgs::PointField::FLOAT64,
+                                   "y", 1, sensor_msgs::PointField::FLOAT64,
+                                   "z", 1, sensor_msgs::PointField::FLOAT64);
+  sensor_msgs::PointCloud2Iterator<double> iter(cloud_msg, "x");
+  for (size_t i = 0; i < 3; ++i, ++iter)
+  {
+    iter[0] = xs[i];
+    iter[1] = 4e5;
+    iter[2] = 0;
+  }
+
+  sensor_msgs::PointCloud2 out_msg = sensor_msgs::voxelDownsample(cloud_msg, 0.05);
+  ASSERT_EQ(2u, out_msg.width);
+  sensor_msgs::PointCloud2ConstIterator<double> out_iter(out_msg, "x");
+  EXPECT_DOUBLE_EQ((xs[0] + xs[1]) / 2, out_iter[0]);
+  EXPECT_DOUBLE_EQ(4e5, out_iter[1]);
+  ++out_iter;
+  EXPECT_DOUBLE_EQ(xs[2], out_iter[0]);
+}
+
+TEST(sensor_msgs, voxelDownsampleParallel)
+{
+  // A 100 x 100 x 10 grid of points 0.1 apart, in cubes of 0.5: 20 x 20 x 2 cubes of 125 points, over many blocks
+  std::vector<XYZIRGB::Point> points;
+  for (int k = 0; k < 10; ++k)
+    for (int j = 0; j < 100; ++j)
+      for (int i = 0; i < 100; ++i)
+        points.push_back(XYZIRGB::Point(0.05f + 0.1f * i, 0.05f + 0.1f * j, 0.05f + 0.1f * k, i + j + k, 0));
+  sensor_msgs::PointCloud2 cloud_msg = makeCloud(points);
+  XYZIRGB layout(cloud_msg);
+
+  sensor_msgs::PointCloud2ThreadPool pool(4);
+  sensor_msgs::PointCloud2 out_msg = sensor_msgs::voxelDownsample(cloud_msg, 0.5, sensor_msgs::VOXEL_CENTROID, pool);
+  ASSERT_EQ(800u, out_msg.width);
+  double intensity = 0;
+  layout.forEach(out_msg, [&](float x, float y, float z, float i, uint32_t) {
+    // The centre of each cube
+    EXPECT_NEAR(0.25, std::fmod(x, 0.5), 1e-4);
+    EXPECT_NEAR(0.25, std::fmod(y, 0.5), 1e-4);
+    EXPECT_NEAR(0.25, std::fmod(z, 0.5), 1e-4);
+    intensity += i;
+  });
+  EXPECT_NEAR((49.5 + 49.5 + 4.5) * 800, intensity, 1e-3);
+
+  sensor_msgs::PointCloud2ThreadPool serial(1);
+  EXPECT_EQ(sensor_msgs::voxelDownsample(cloud_msg, 0.5, sensor_msgs::VOXEL_CENTROID, serial).data, out_msg.data);
+  EXPECT_EQ(sensor_msgs::voxelDownsample(cloud_msg, 0.5, sensor_msgs::VOXEL_FIRST_POINT, serial).data,
+            sensor_msgs::voxelDownsample(cloud_msg, 0.5, sensor_msgs::VOXEL_FIRST_POINT, pool).data);
+}
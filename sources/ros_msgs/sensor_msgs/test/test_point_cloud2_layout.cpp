@@ -0,0 +1,132 @@
+/*
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2026, Dimensional Robotics
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of the copyright holder nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <sensor_msgs/point_cloud2_layout.h>
+
+namespace
+{
+namespace fields = sensor_msgs::point_cloud2_fields;
+typedef sensor_msgs::PointCloud2Layout<fields::X, fields::Y, fields::Z, fields::Intensity> XYZI;
+typedef sensor_msgs::PointCloud2Layout<fields::X, fields::Y, fields::Z, fields::RGB> XYZRGB;
+}
+
+TEST(sensor_msgs, PointCloud2LayoutPacked)
+{
+  EXPECT_EQ(0u, XYZI::packedOffset(0));
+  EXPECT_EQ(12u, XYZI::packedOffset(3));
+  EXPECT_EQ(16u, XYZI::packedPointStep());
+  typedef sensor_msgs::PointCloud2Layout<fields::X, fields::Ring, fields::Z> Mixed;
+  EXPECT_EQ(4u, Mixed::packedOffset(1));
+  EXPECT_EQ(8u, Mixed::packedOffset(2));
+  EXPECT_EQ(12u, Mixed::packedPointStep());
+
+  sensor_msgs::PointCloud2 cloud_msg;
+  cloud_msg.height = 1;
+  cloud_msg.width = 3;
+  XYZI::setPointCloud2Fields(cloud_msg);
+  ASSERT_EQ(4u, cloud_msg.fields.size());
+  EXPECT_EQ("intensity", cloud_msg.fields[3].name);
+  EXPECT_EQ(48u, cloud_msg.data.size());
+
+  XYZI layout(cloud_msg);
+  EXPECT_TRUE(layout.isPacked());
+  layout.transform(cloud_msg, [](float &x, float &y, float &z, float &intensity) {
+    static float n = 0;
+    x = n++;
+    y = 2 * x;
+    z = 3 * x;
+    intensity = 255;
+  });
+  float sum = 0;
+  layout.forEach(cloud_msg, [&](float x, float y, float z, float intensity) {
+    sum += x + y + z + intensity;
+  });
+  EXPECT_FLOAT_EQ((0 + 1 + 2) * 6 + 3 * 255, sum);
+  EXPECT_EQ(XYZI::Point(2, 4, 6, 255), layout.read(cloud_msg, 2));
+}
+
+TEST(sensor_msgs, PointCloud2LayoutPadded)
+{
+  // PCL's PointXYZRGB: xyz, a float of padding, rgb in a float and 12 more bytes of padding
+  sensor_msgs::PointCloud2 cloud_msg;
+  cloud_msg.height = 1;
+  cloud_msg.width = 2;
+  sensor_msgs::PointCloud2Modifier modifier(cloud_msg);
+  modifier.setPointCloud2FieldsByString(2, "xyz", "rgb");
+
+  XYZRGB layout(cloud_msg);
+  EXPECT_FALSE(layout.isPacked());
+  EXPECT_EQ(16u, layout.offset(3));
+  EXPECT_EQ(32u, layout.pointStep());
+  layout.write(cloud_msg, 1, XYZRGB::Point(1, 2, 3, 0x00ff8040));
+
+  // The same bytes through the iterators
+  sensor_msgs::PointCloud2ConstIterator<float> iter_x(cloud_msg, "x");
+  sensor_msgs::PointCloud2ConstIterator<uint8_t> iter_r(cloud_msg, "r");
+  ++iter_x;
+  ++iter_r;
+  EXPECT_EQ(1, iter_x[0]);
+  EXPECT_EQ(3, iter_x[2]);
+  EXPECT_EQ(0xff, *iter_r);
+
+  size_t n = 0;
+  layout.forEach(cloud_msg, [&](float x, float, float, uint32_t rgb) {
+    EXPECT_EQ(n == 1 ? 1 : 0, x);
+    EXPECT_EQ(n == 1 ? 0x00ff8040u : 0u, rgb);
+    ++n;
+  });
+  EXPECT_EQ(2u, n);
+}
+
+TEST(sensor_msgs, PointCloud2LayoutMismatch)
+{
+  sensor_msgs::PointCloud2 cloud_msg;
+  cloud_msg.height = 1;
+  cloud_msg.width = 1;
+  sensor_msgs::PointCloud2Modifier modifier(cloud_msg);
+  modifier.setPointCloud2Fields(3, "x", 1, sensor_msgs::PointField::FLOAT32,
+                                   "y", 1, sensor_msgs::PointField::FLOAT32,
+                                   "z", 1, sensor_msgs::PointField::FLOAT64);
+  typedef sensor_msgs::PointCloud2Layout<fields::X, fields::Y, fields::Z> XYZ;
+  typedef sensor_msgs::PointCloud2Layout<fields::X, fields::Y> XY;
+  // No intensity
+  EXPECT_THROW(XYZI layout(cloud_msg), std::runtime_error);
+  // z is a double
+  EXPECT_THROW(XYZ layout(cloud_msg), std::runtime_error);
+  EXPECT_NO_THROW(XY layout(cloud_msg));
+  cloud_msg.point_step = 4;
+  EXPECT_THROW(XY layout(cloud_msg), std::runtime_error);
+}
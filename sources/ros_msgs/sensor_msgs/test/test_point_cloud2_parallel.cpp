@@ -0,0 +1,147 @@
+/*
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2026, Dimensional Robotics
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of the copyright holder nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <sensor_msgs/point_cloud2_parallel.h>
+#include <stdexcept>
+#include <vector>
+
+namespace
+{
+namespace fields = sensor_msgs::point_cloud2_fields;
+typedef sensor_msgs::PointCloud2Layout<fields::X, fields::Y, fields::Z, fields::Intensity> XYZI;
+
+sensor_msgs::PointCloud2 makeCloud(uint32_t height, uint32_t width)
+{
+  sensor_msgs::PointCloud2 cloud_msg;
+  cloud_msg.height = height;
+  cloud_msg.width = width;
+  XYZI::setPointCloud2Fields(cloud_msg);
+  XYZI layout(cloud_msg);
+  float n = 0;
+  layout.transform(cloud_msg, [&](float &x, float &y, float &z, float &intensity) {
+    x = n;
+    y = 2 * n;
+    z = 3 * n;
+    intensity = n++;
+  });
+  return cloud_msg;
+}
+}
+
+TEST(sensor_msgs, PointCloud2ThreadPool)
+{
+  sensor_msgs::PointCloud2ThreadPool pool(4);
+  EXPECT_EQ(4u, pool.size());
+  std::vector<std::atomic<int> > runs(1000);
+  for (size_t i = 0; i < runs.size(); ++i)
+    runs[i] = 0;
+  pool.run(runs.size(), [&](size_t chunk) {
+    ++runs[chunk];
+  });
+  for (size_t i = 0; i < runs.size(); ++i)
+    ASSERT_EQ(1, runs[i].load()) << "chunk " << i;
+
+  // A job started from a chunk runs on the calling thread
+  std::atomic<int> nested(0);
+  pool.run(8, [&](size_t) {
+    pool.run(4, [&](size_t) {
+      ++nested;
+    });
+  });
+  EXPECT_EQ(32, nested.load());
+  // Also when the job is nested in a job of another pool
+  sensor_msgs::PointCloud2ThreadPool other(2);
+  std::atomic<int> crossed(0);
+  pool.run(4, [&](size_t) {
+    other.run(2, [&](size_t) {
+      pool.run(3, [&](size_t) {
+        ++crossed;
+      });
+    });
+  });
+  EXPECT_EQ(24, crossed.load());
+
+  EXPECT_THROW(pool.run(100, [](size_t chunk) {
+    if (chunk == 42)
+      throw std::runtime_error("chunk 42");
+  }), std::runtime_error);
+  // Still usable after a failed job
+  std::atomic<int> count(0);
+  pool.run(10, [&](size_t) {
+    ++count;
+  });
+  EXPECT_EQ(10, count.load());
+}
+
+TEST(sensor_msgs, PointCloud2ParallelTransform)
+{
+  sensor_msgs::PointCloud2ThreadPool pool(3);
+  // Organized, with rows of 1000 points: chunks hold whole rows
+  sensor_msgs::PointCloud2 cloud_msg = makeCloud(64, 1000);
+  EXPECT_EQ(4000u, sensor_msgs::impl::pointsPerChunk(cloud_msg));
+  XYZI layout(cloud_msg);
+  const size_t n = layout.size(cloud_msg);
+
+  std::vector<std::atomic<int> > seen(n);
+  for (size_t i = 0; i < n; ++i)
+    seen[i] = 0;
+  sensor_msgs::parallelForEachPoint(cloud_msg, layout, [&](float x, float y, float, float intensity) {
+    EXPECT_EQ(2 * x, y);
+    ++seen[static_cast<size_t>(intensity)];
+  }, pool);
+  for (size_t i = 0; i < n; ++i)
+    ASSERT_EQ(1, seen[i].load()) << "point " << i;
+
+  sensor_msgs::PointCloud2 scaled_msg;
+  sensor_msgs::parallelTransform(cloud_msg, scaled_msg, layout, [](float &x, float &y, float &z, float &) {
+    x *= 2;
+    y *= 2;
+    z *= 2;
+  }, pool);
+  EXPECT_EQ(cloud_msg.height, scaled_msg.height);
+  EXPECT_EQ(cloud_msg.fields.size(), scaled_msg.fields.size());
+  ASSERT_EQ(cloud_msg.data.size(), scaled_msg.data.size());
+  for (size_t i = 0; i < n; i += 997)
+  {
+    EXPECT_EQ(XYZI::Point(i, 2 * i, 3 * i, i), layout.read(cloud_msg, i));
+    EXPECT_EQ(XYZI::Point(2 * i, 4 * i, 6 * i, i), layout.read(scaled_msg, i));
+  }
+
+  sensor_msgs::parallelTransform(cloud_msg, layout, [](float &, float &, float &, float &intensity) {
+    intensity = -intensity;
+  }, pool);
+  EXPECT_EQ(XYZI::Point(n - 1, 2 * (n - 1), 3 * (n - 1), -float(n - 1)), layout.read(cloud_msg, n - 1));
+}
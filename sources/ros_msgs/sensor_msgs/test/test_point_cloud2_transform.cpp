@@ -0,0 +1,184 @@
+/*
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2026, Dimensional Robotics
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of the copyright holder nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <sensor_msgs/point_cloud2_transform.h>
+#include <cmath>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace
+{
+/** A cloud of n points with the named fields at the given offsets, field f of point i holding i / 100 + f / 10 */
+sensor_msgs::PointCloud2 makeCloud(const std::vector<std::string> &names, const std::vector<uint32_t> &offsets,
+    uint8_t datatype, uint32_t point_step, uint32_t n)
+{
+  sensor_msgs::PointCloud2 cloud_msg;
+  cloud_msg.height = 1;
+  cloud_msg.width = n;
+  cloud_msg.point_step = point_step;
+  cloud_msg.row_step = point_step * n;
+  for (size_t f = 0; f < names.size(); ++f)
+  {
+    sensor_msgs::PointField field;
+    field.name = names[f];
+    field.offset = offsets[f];
+    field.datatype = datatype;
+    field.count = 1;
+    cloud_msg.fields.push_back(field);
+  }
+  cloud_msg.data.resize(cloud_msg.row_step);
+  for (uint32_t i = 0; i < n; ++i)
+    for (size_t f = 0; f < names.size(); ++f)
+    {
+      unsigned char *p = &cloud_msg.data[i * point_step + offsets[f]];
+      double value = 0.01 * i + 0.1 * f;
+      if (datatype == sensor_msgs::PointField::FLOAT64)
+        memcpy(p, &value, 8);
+      else
+      {
+        float value_f = value;
+        memcpy(p, &value_f, 4);
+      }
+    }
+  return cloud_msg;
+}
+
+double readValue(const sensor_msgs::PointCloud2 &cloud_msg, size_t i, const std::string &name)
+{
+  for (size_t f = 0; f < cloud_msg.fields.size(); ++f)
+    if (cloud_msg.fields[f].name == name)
+      return sensor_msgs::readPointCloud2BufferValue<double>(
+          &cloud_msg.data[i * cloud_msg.point_step + cloud_msg.fields[f].offset], cloud_msg.fields[f].datatype);
+  throw std::runtime_error(name);
+}
+
+/** Quarter turn about z, then a shift */
+geometry_msgs::Transform quarterTurn()
+{
+  geometry_msgs::Transform transform;
+  transform.rotation.z = std::sqrt(0.5);
+  transform.rotation.w = std::sqrt(0.5);
+  transform.translation.x = 1;
+  transform.translation.y = 2;
+  transform.translation.z = 3;
+  return transform;
+}
+
+/** Check that the points and normals of cloud_msg are those of original turned by quarterTurn() */
+void expectTurned(const sensor_msgs::PointCloud2 &original, const sensor_msgs::PointCloud2 &cloud_msg, double eps)
+{
+  const size_t n = original.width;
+  for (size_t i = 0; i < n; ++i)
+  {
+    ASSERT_NEAR(1 - readValue(original, i, "y"), readValue(cloud_msg, i, "x"), eps) << "point " << i;
+    ASSERT_NEAR(2 + readValue(original, i, "x"), readValue(cloud_msg, i, "y"), eps) << "point " << i;
+    ASSERT_NEAR(3 + readValue(original, i, "z"), readValue(cloud_msg, i, "z"), eps) << "point " << i;
+  }
+  if (sensor_msgs::impl::hasPointField(original, "normal_x"))
+  {
+    for (size_t i = 0; i < n; ++i)
+    {
+      ASSERT_NEAR(-readValue(original, i, "normal_y"), readValue(cloud_msg, i, "normal_x"), eps);
+      ASSERT_NEAR(readValue(original, i, "normal_x"), readValue(cloud_msg, i, "normal_y"), eps);
+      ASSERT_NEAR(readValue(original, i, "normal_z"), readValue(cloud_msg, i, "normal_z"), eps);
+    }
+  }
+  if (sensor_msgs::impl::hasPointField(original, "intensity"))
+  {
+    for (size_t i = 0; i < n; ++i)
+      ASSERT_EQ(readValue(original, i, "intensity"), readValue(cloud_msg, i, "intensity"));
+  }
+}
+}
+
+TEST(sensor_msgs, transformPointCloud2Float32)
+{
+  sensor_msgs::PointCloud2ThreadPool pool(2);
+  const std::vector<std::string> xyzi = {"x", "y", "z", "intensity"};
+  // xyz at the start of a window, at its end, and with no window to use
+  const std::vector<std::vector<uint32_t> > offsets = {{0, 4, 8, 12}, {4, 8, 12, 0}, {0, 4, 8, 12}};
+  const uint32_t steps[] = {16, 16, 12};
+  for (size_t c = 0; c < offsets.size(); ++c)
+  {
+    std::vector<std::string> names = xyzi;
+    if (steps[c] == 12)
+      names.pop_back();
+    // Not a whole number of batches, and more than a chunk
+    sensor_msgs::PointCloud2 original = makeCloud(names, offsets[c], sensor_msgs::PointField::FLOAT32, steps[c],
+                                                  10003);
+    sensor_msgs::PointCloud2 cloud_msg = original;
+    sensor_msgs::transformPointCloud2(cloud_msg, quarterTurn(), pool);
+    SCOPED_TRACE(c);
+    expectTurned(original, cloud_msg, 1e-4);
+  }
+}
+
+TEST(sensor_msgs, transformPointCloud2Normals)
+{
+  const std::vector<std::string> names = {"x", "y", "z", "intensity", "normal_x", "normal_y", "normal_z"};
+  const std::vector<uint32_t> offsets = {0, 4, 8, 12, 16, 20, 24};
+  sensor_msgs::PointCloud2 original = makeCloud(names, offsets, sensor_msgs::PointField::FLOAT32, 32, 101);
+  sensor_msgs::PointCloud2 cloud_msg = original;
+  geometry_msgs::TransformStamped transform;
+  transform.header.frame_id = "base_link";
+  transform.transform = quarterTurn();
+  sensor_msgs::transformPointCloud2(cloud_msg, transform);
+  EXPECT_EQ("base_link", cloud_msg.header.frame_id);
+  expectTurned(original, cloud_msg, 1e-5);
+
+  original = makeCloud(names, {0, 8, 16, 24, 32, 40, 48}, sensor_msgs::PointField::FLOAT64, 56, 101);
+  cloud_msg = original;
+  sensor_msgs::transformPointCloud2(cloud_msg, quarterTurn());
+  expectTurned(original, cloud_msg, 1e-12);
+}
+
+TEST(sensor_msgs, transformPointCloud2Errors)
+{
+  sensor_msgs::PointCloud2 cloud_msg = makeCloud({"x", "y"}, {0, 4}, sensor_msgs::PointField::FLOAT32, 8, 4);
+  EXPECT_THROW(sensor_msgs::transformPointCloud2(cloud_msg, quarterTurn()), std::runtime_error);
+  cloud_msg = makeCloud({"x", "y", "z"}, {0, 4, 8}, sensor_msgs::PointField::FLOAT32, 12, 4);
+  cloud_msg.fields[2].datatype = sensor_msgs::PointField::INT32;
+  EXPECT_THROW(sensor_msgs::transformPointCloud2(cloud_msg, quarterTurn()), std::runtime_error);
+  cloud_msg.fields[2].datatype = sensor_msgs::PointField::FLOAT32;
+  geometry_msgs::Transform zero = quarterTurn();
+  zero.rotation.z = zero.rotation.w = 0;
+  EXPECT_THROW(sensor_msgs::transformPointCloud2(cloud_msg, zero), std::runtime_error);
+  cloud_msg = makeCloud({"x", "y", "z", "normal_x", "normal_y"}, {0, 4, 8, 12, 16}, sensor_msgs::PointField::FLOAT32,
+                        20, 4);
+  EXPECT_THROW(sensor_msgs::transformPointCloud2(cloud_msg, quarterTurn()), std::runtime_error);
+}
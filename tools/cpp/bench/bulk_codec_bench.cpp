@@ -0,0 +1,80 @@
+// Throughput of the lcm_coretypes.h array codec versus dimos_lcm/bulk_codec.hpp
+// for each multi-byte element width.
+//
+// Build from the repo root (needs the LCM headers on the include path):
+//   g++ -std=c++17 -O2 -march=native -I generated/cpp_lcm_msgs
+//       tools/cpp/bench/bulk_codec_bench.cpp -o bulk_codec_bench
+
+#include <lcm/lcm_coretypes.h>
+
+#include <chrono>
+#include <cstdio>
+#include <vector>
+
+#include "dimos_lcm/bulk_codec.hpp"
+
+namespace
+{
+
+const int kElements = 1 << 18;
+const int kRounds = 200;
+
+volatile int g_sink;
+
+template <typename F>
+double gigabytesPerSecond(size_t bytes, F fn)
+{
+    fn();  // warm up caches and page in the buffers
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for (int r = 0; r < kRounds; r++)
+        fn();
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    return static_cast<double>(bytes) * kRounds / seconds / 1e9;
+}
+
+template <typename T, typename Enc, typename Dec>
+void run(const char *name, Enc lcm_encode, Dec lcm_decode)
+{
+    std::vector<T> values(kElements), decoded(kElements);
+    for (int i = 0; i < kElements; i++)
+        values[i] = static_cast<T>(i * 3 + 1);
+    std::vector<uint8_t> wire(kElements * sizeof(T));
+    size_t bytes = wire.size();
+
+    double lcm_enc = gigabytesPerSecond(bytes, [&] {
+        g_sink = lcm_encode(wire.data(), 0, static_cast<int>(bytes), values.data(), kElements);
+    });
+    double bulk_enc = gigabytesPerSecond(bytes, [&] {
+        g_sink = dimos_lcm::bulk_encode_array(wire.data(), 0, static_cast<int>(bytes), values.data(), kElements);
+    });
+    double lcm_dec = gigabytesPerSecond(bytes, [&] {
+        g_sink = lcm_decode(wire.data(), 0, static_cast<int>(bytes), decoded.data(), kElements);
+    });
+    double bulk_dec = gigabytesPerSecond(bytes, [&] {
+        g_sink = dimos_lcm::bulk_decode_array(wire.data(), 0, static_cast<int>(bytes), decoded.data(), kElements);
+    });
+
+    printf("%-8s encode %6.2f -> %6.2f GB/s (x%.1f)   decode %6.2f -> %6.2f GB/s (x%.1f)\n",
+           name, lcm_enc, bulk_enc, bulk_enc / lcm_enc, lcm_dec, bulk_dec, bulk_dec / lcm_dec);
+}
+
+}
+
+int main()
+{
+#if defined(DIMOS_LCM_BSWAP_AVX2)
+    printf("kernel: AVX2\n");
+#elif defined(DIMOS_LCM_BSWAP_SSSE3)
+    printf("kernel: SSSE3\n");
+#elif defined(DIMOS_LCM_BSWAP_NEON)
+    printf("kernel: NEON\n");
+#else
+    printf("kernel: scalar\n");
+#endif
+    run<int16_t>("int16_t", __int16_t_encode_array, __int16_t_decode_array);
+    run<int32_t>("int32_t", __int32_t_encode_array, __int32_t_decode_array);
+    run<float>("float", __float_encode_array, __float_decode_array);
+    run<int64_t>("int64_t", __int64_t_encode_array, __int64_t_decode_array);
+    run<double>("double", __double_encode_array, __double_decode_array);
+    return 0;
+}
@@ -0,0 +1,90 @@
+// Cost of handing one decoded message to several in-process consumers that
+// each keep their own copy: the regular classes copy the payload per
+// consumer, their cow:: flavor shares it and copies only on write.
+//
+// Build from the repo root (needs the LCM headers on the include path):
+//   g++ -std=c++17 -O2 -I generated/cpp_lcm_msgs
+//       tools/cpp/bench/cow_fanout_bench.cpp -o cow_fanout_bench
+
+#include <lcm/lcm_coretypes.h>
+
+#include <chrono>
+#include <cstdio>
+#include <vector>
+
+#include "sensor_msgs/Image.hpp"
+#include "sensor_msgs/PointCloud2.hpp"
+#include "sensor_msgs/cow/Image.hpp"
+#include "sensor_msgs/cow/PointCloud2.hpp"
+
+namespace
+{
+
+const int kRounds = 500;
+const int kConsumers = 3;
+
+volatile int g_sink;
+
+template <typename F>
+double microsecondsPerCall(F fn)
+{
+    fn();
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for (int r = 0; r < kRounds; r++)
+        fn();
+    return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count() / kRounds;
+}
+
+// Decode once, then give each consumer a copy (recorder, visualizer, ...)
+template <typename Msg>
+double fanOut(const std::vector<uint8_t> &wire)
+{
+    const int size = static_cast<int>(wire.size());
+    std::vector<Msg> consumers(kConsumers);
+    Msg msg;
+    return microsecondsPerCall([&] {
+        msg.decode(wire.data(), 0, size);
+        for (int c = 0; c < kConsumers; c++)
+            consumers[c] = msg;
+        g_sink = consumers[kConsumers - 1].data[size / 2];
+    });
+}
+
+template <typename Msg, typename CowMsg>
+void run(const char *name, const Msg &msg)
+{
+    std::vector<uint8_t> wire(msg.getEncodedSize());
+    msg.encode(wire.data(), 0, static_cast<int>(wire.size()));
+
+    double us = fanOut<Msg>(wire);
+    double cow_us = fanOut<CowMsg>(wire);
+
+    printf("%s (%zu bytes) to %d consumers\n", name, wire.size(), kConsumers);
+    printf("  std:: %9.2f us   cow:: %9.2f us   %4.1fx\n", us, cow_us, us / cow_us);
+}
+
+}
+
+int main()
+{
+    sensor_msgs::Image image{};
+    image.header.frame_id = "camera_color_optical_frame";
+    image.height = 720;
+    image.width = 1280;
+    image.encoding = "rgb8";
+    image.step = 1280 * 3;
+    image.data_length = 1280 * 720 * 3;
+    image.data.assign(image.data_length, 0x5a);
+    run<sensor_msgs::Image, sensor_msgs::cow::Image>("sensor_msgs::Image 1280x720 rgb8", image);
+
+    sensor_msgs::PointCloud2 cloud{};
+    cloud.header.frame_id = "lidar";
+    cloud.height = 1;
+    cloud.width = 100000;
+    cloud.point_step = 16;
+    cloud.row_step = 16 * 100000;
+    cloud.data_length = 16 * 100000;
+    cloud.data.assign(cloud.data_length, 0x5a);
+    run<sensor_msgs::PointCloud2, sensor_msgs::cow::PointCloud2>("sensor_msgs::PointCloud2 100k points", cloud);
+    return 0;
+}
@@ -0,0 +1,151 @@
+// Heap allocations, page faults and latency of a publisher that encodes into
+// a fresh getEncodedSize() buffer per message versus one from a
+// dimos_lcm::encode_pool. Message sizes vary a little from one publish to the
+// next, as they do for marker arrays and filtered clouds.
+//
+// Build from the repo root (needs the LCM headers on the include path):
+//   g++ -std=c++17 -O2 -I generated/cpp_lcm_msgs
+//       tools/cpp/bench/encode_pool_bench.cpp -o encode_pool_bench
+
+#include <lcm/lcm_coretypes.h>
+#include <sys/resource.h>
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+#include <vector>
+
+#include "dimos_lcm/encode_pool.hpp"
+#include "sensor_msgs/PointCloud2.hpp"
+#include "tf2_msgs/TFMessage.hpp"
+#include "visualization_msgs/MarkerArray.hpp"
+
+namespace
+{
+
+const int kRounds = 500;
+
+volatile int g_sink;
+long g_allocations;
+
+long pageFaults()
+{
+    struct rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+    return usage.ru_minflt + usage.ru_majflt;
+}
+
+struct cost
+{
+    double us;
+    double allocations;
+    double faults;
+};
+
+// Publish msgs[r % msgs.size()] for each round
+template <typename F>
+cost measure(F fn, int variants)
+{
+    for (int r = 0; r < variants; r++)
+        fn(r);
+    long allocations = g_allocations;
+    long faults = pageFaults();
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for (int r = 0; r < kRounds; r++)
+        fn(r % variants);
+    double us = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+    cost c = { us / kRounds, double(g_allocations - allocations) / kRounds, double(pageFaults() - faults) / kRounds };
+    return c;
+}
+
+template <typename Msg>
+void run(const char *name, const std::vector<Msg> &msgs)
+{
+    const int variants = static_cast<int>(msgs.size());
+    cost fresh = measure([&](int i) {
+        std::vector<uint8_t> buf(msgs[i].getEncodedSize());
+        g_sink = msgs[i].encode(buf.data(), 0, static_cast<int>(buf.size()));
+    }, variants);
+
+    dimos_lcm::encode_pool<Msg> pool;
+    cost pooled = measure([&](int i) {
+        typename dimos_lcm::encode_pool<Msg>::buffer buf = pool.encode(msgs[i]);
+        g_sink = static_cast<int>(buf.size());
+    }, variants);
+
+    printf("%s (%d bytes)\n", name, msgs[0].getEncodedSize());
+    printf("  fresh %9.1f us %5.1f allocs %7.1f faults   pool %9.1f us %5.1f allocs %7.1f faults (%zu by the pool)\n",
+           fresh.us, fresh.allocations, fresh.faults, pooled.us, pooled.allocations, pooled.faults,
+           pool.allocations());
+}
+
+}
+
+void *operator new(size_t n)
+{
+    g_allocations++;
+    void *p = malloc(n ? n : 1);
+    if (!p)
+        throw std::bad_alloc();
+    return p;
+}
+
+void operator delete(void *p) noexcept { free(p); }
+void operator delete(void *p, size_t) noexcept { free(p); }
+
+int main()
+{
+    std::vector<visualization_msgs::MarkerArray> marker_arrays(8);
+    for (size_t v = 0; v < marker_arrays.size(); v++) {
+        visualization_msgs::MarkerArray &markers = marker_arrays[v];
+        markers.markers_length = 500 - 10 * static_cast<int>(v);
+        markers.markers.resize(markers.markers_length);
+        for (visualization_msgs::Marker &m : markers.markers) {
+            m.header.frame_id = "map";
+            m.ns = "obstacles";
+            m.text = "obstacle";
+            m.points_length = 20;
+            m.points.resize(m.points_length);
+            m.colors_length = 20;
+            m.colors.resize(m.colors_length);
+        }
+    }
+    run("visualization_msgs::MarkerArray ~500x20", marker_arrays);
+
+    std::vector<sensor_msgs::PointCloud2> clouds(8);
+    for (size_t v = 0; v < clouds.size(); v++) {
+        sensor_msgs::PointCloud2 &cloud = clouds[v];
+        cloud.header.frame_id = "lidar";
+        cloud.height = 1;
+        cloud.width = 100000 - 1000 * static_cast<int>(v);
+        cloud.fields_length = 4;
+        cloud.fields.resize(4);
+        const char *names[] = {"x", "y", "z", "intensity"};
+        for (int i = 0; i < 4; i++) {
+            cloud.fields[i].name = names[i];
+            cloud.fields[i].offset = 4 * i;
+            cloud.fields[i].datatype = 7;
+            cloud.fields[i].count = 1;
+        }
+        cloud.point_step = 16;
+        cloud.row_step = 16 * cloud.width;
+        cloud.data_length = cloud.row_step;
+        cloud.data.assign(cloud.data_length, 0x5a);
+    }
+    run("sensor_msgs::PointCloud2 ~100k points", clouds);
+
+    std::vector<tf2_msgs::TFMessage> tfs(4);
+    for (size_t v = 0; v < tfs.size(); v++) {
+        tf2_msgs::TFMessage &tf = tfs[v];
+        tf.transforms_length = 40 + static_cast<int>(v);
+        tf.transforms.resize(tf.transforms_length);
+        for (geometry_msgs::TransformStamped &t : tf.transforms) {
+            t.header.frame_id = "odom";
+            t.child_frame_id = "base_link";
+            t.transform.rotation.w = 1;
+        }
+    }
+    run("tf2_msgs::TFMessage ~40 transforms", tfs);
+    return 0;
+}
@@ -0,0 +1,91 @@
+// Publishing cost of a frame produced by a driver: filling Image::data or
+// PointCloud2::data and then encode() into the send buffer, which writes the
+// payload twice, versus encodeInPlace() and filling the gap it leaves in the
+// send buffer. The "driver" is a memcpy from a frame buffer of its own.
+//
+// Build from the repo root (needs the LCM headers on the include path):
+//   g++ -std=c++17 -O2 -I generated/cpp_lcm_msgs
+//       tools/cpp/bench/in_place_encode_bench.cpp -o in_place_encode_bench
+
+#include <lcm/lcm_coretypes.h>
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+#include "sensor_msgs/Image.hpp"
+#include "sensor_msgs/PointCloud2.hpp"
+
+namespace
+{
+
+const int kRounds = 200;
+
+volatile int g_sink;
+
+template <typename F>
+double microsecondsPerCall(F fn)
+{
+    fn();
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for (int r = 0; r < kRounds; r++)
+        fn();
+    return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count() / kRounds;
+}
+
+// @p msg has its length fields set and an empty payload
+template <typename Msg>
+void run(const char *name, Msg msg, const std::vector<uint8_t> &frame)
+{
+    std::vector<uint8_t> packet(msg.getEncodedSize());
+
+    Msg filled = msg;
+    double copy_then_encode = microsecondsPerCall([&] {
+        filled.data.assign(frame.begin(), frame.end());
+        g_sink = filled.encode(packet.data(), 0, static_cast<int>(packet.size()));
+    });
+
+    dimos_lcm::wire_builder out;
+    double in_place = microsecondsPerCall([&] {
+        out.reset(packet.data(), packet.size());
+        g_sink = msg.encodeInPlace(out);
+        memcpy(out.payload().data(), frame.data(), out.payload().size());
+    });
+
+    printf("%-36s %7.1f MB   fill+encode %8.1f us   encodeInPlace+fill %8.1f us\n",
+           name, packet.size() / 1e6, copy_then_encode, in_place);
+}
+
+}
+
+int main()
+{
+    sensor_msgs::Image img = {};
+    img.header.frame_id = "camera_optical";
+    img.height = 1080;
+    img.width = 1920;
+    img.encoding = "rgb8";
+    img.step = img.width * 3;
+    img.data_length = img.step * img.height;
+    run("sensor_msgs::Image 1920x1080 rgb8", img, std::vector<uint8_t>(img.data_length, 0x5a));
+
+    sensor_msgs::PointCloud2 cloud = {};
+    cloud.header.frame_id = "lidar";
+    cloud.height = 1;
+    cloud.width = 128 * 2048;
+    const char *names[] = { "x", "y", "z", "intensity" };
+    cloud.fields_length = 4;
+    cloud.fields.resize(cloud.fields_length);
+    for (int i = 0; i < cloud.fields_length; i++) {
+        cloud.fields[i].name = names[i];
+        cloud.fields[i].offset = 4 * i;
+        cloud.fields[i].datatype = sensor_msgs::PointField::FLOAT32;
+        cloud.fields[i].count = 1;
+    }
+    cloud.point_step = 16;
+    cloud.row_step = cloud.point_step * cloud.width;
+    cloud.data_length = cloud.row_step;
+    run("sensor_msgs::PointCloud2 262144 pts", cloud, std::vector<uint8_t>(cloud.data_length, 0x3c));
+    return 0;
+}
@@ -0,0 +1,144 @@
+// Decode cost of messages made of frame ids and joint names, and of looking up
+// a frame in them: the regular classes, which allocate a std::string per id
+// unless it fits the small-string buffer, versus their interned:: flavor,
+// which finds each id in the process-wide string table and compares ids by
+// pointer.
+//
+// Build from the repo root (needs the LCM headers on the include path):
+//   g++ -std=c++17 -O2 -I generated/cpp_lcm_msgs
+//       tools/cpp/bench/interned_decode_bench.cpp -o interned_decode_bench
+
+#include <lcm/lcm_coretypes.h>
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+#include <string>
+#include <vector>
+
+#include "sensor_msgs/JointState.hpp"
+#include "sensor_msgs/interned/JointState.hpp"
+#include "tf2_msgs/TFMessage.hpp"
+#include "tf2_msgs/interned/TFMessage.hpp"
+
+namespace
+{
+
+const int kRounds = 20000;
+
+volatile int g_sink;
+long g_allocations;
+
+template <typename F>
+double microsecondsPerCall(F fn)
+{
+    fn();
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for (int r = 0; r < kRounds; r++)
+        fn();
+    return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count() / kRounds;
+}
+
+template <typename F>
+long allocationsPerCall(F fn)
+{
+    long before = g_allocations;
+    fn();
+    return g_allocations - before;
+}
+
+template <typename Msg, typename InternedMsg>
+void run(const char *name, const Msg &msg)
+{
+    std::vector<uint8_t> wire(msg.getEncodedSize());
+    msg.encode(wire.data(), 0, static_cast<int>(wire.size()));
+    const int size = static_cast<int>(wire.size());
+
+    // A fresh message per call, as in a subscriber handler
+    auto decode = [&] {
+        Msg out;
+        g_sink = out.decode(wire.data(), 0, size);
+    };
+    auto decodeInterned = [&] {
+        InternedMsg out;
+        g_sink = out.decode(wire.data(), 0, size);
+    };
+
+    // The first interned decode adds the ids to the table
+    decodeInterned();
+    long allocations = allocationsPerCall(decode);
+    long interned_allocations = allocationsPerCall(decodeInterned);
+    double us = microsecondsPerCall(decode);
+    double interned_us = microsecondsPerCall(decodeInterned);
+
+    printf("%s (%d bytes)\n", name, size);
+    printf("  std:: %8.2f us %4ld allocations   interned:: %8.2f us %4ld allocations   %4.1fx\n",
+           us, allocations, interned_us, interned_allocations, us / interned_us);
+}
+
+// Index of the transform to @p child, as a TF buffer looks it up
+template <typename Msg, typename Id>
+int findChild(const Msg &msg, const Id &child)
+{
+    for (int i = 0; i < msg.transforms_length; i++) {
+        if (msg.transforms[i].child_frame_id == child)
+            return i;
+    }
+    return -1;
+}
+
+}
+
+void *operator new(size_t n)
+{
+    g_allocations++;
+    void *p = malloc(n ? n : 1);
+    if (!p)
+        throw std::bad_alloc();
+    return p;
+}
+
+void operator delete(void *p) noexcept { free(p); }
+void operator delete(void *p, size_t) noexcept { free(p); }
+
+int main()
+{
+    const int transforms = 50;
+    tf2_msgs::TFMessage tf{};
+    tf.transforms_length = transforms;
+    tf.transforms.resize(transforms);
+    for (int i = 0; i < transforms; i++) {
+        tf.transforms[i].header.frame_id = i == 0 ? "odom" : "robot_1/arm/link_" + std::to_string(i - 1);
+        tf.transforms[i].child_frame_id = "robot_1/arm/link_" + std::to_string(i);
+        tf.transforms[i].transform.rotation.w = 1;
+    }
+    run<tf2_msgs::TFMessage, tf2_msgs::interned::TFMessage>("tf2_msgs::TFMessage 50 transforms", tf);
+
+    const int joints = 32;
+    sensor_msgs::JointState joint_state{};
+    joint_state.header.frame_id = "base_link";
+    joint_state.name_length = joints;
+    joint_state.position_length = joints;
+    joint_state.velocity_length = 0;
+    joint_state.effort_length = 0;
+    for (int i = 0; i < joints; i++) {
+        joint_state.name.push_back("arm_joint_with_a_long_name_" + std::to_string(i));
+        joint_state.position.push_back(i * 0.1);
+    }
+    run<sensor_msgs::JointState, sensor_msgs::interned::JointState>("sensor_msgs::JointState 32 joints", joint_state);
+
+    std::vector<uint8_t> wire(tf.getEncodedSize());
+    tf.encode(wire.data(), 0, static_cast<int>(wire.size()));
+    tf2_msgs::TFMessage decoded;
+    decoded.decode(wire.data(), 0, static_cast<int>(wire.size()));
+    tf2_msgs::interned::TFMessage interned;
+    interned.decode(wire.data(), 0, static_cast<int>(wire.size()));
+    const std::string child = "robot_1/arm/link_49";
+    const dimos_lcm::interned_string interned_child = child;
+    double us = microsecondsPerCall([&] { g_sink = findChild(decoded, child); });
+    double interned_us = microsecondsPerCall([&] { g_sink = findChild(interned, interned_child); });
+    printf("child frame lookup in 50 transforms\n");
+    printf("  std:: %8.3f us   interned:: %8.3f us   %4.1fx\n", us, interned_us, us / interned_us);
+    return 0;
+}
@@ -0,0 +1,105 @@
+// Throughput of dimos_lcm::append_json() (dimos_lcm/json_writer.hpp), which the
+// Foxglove bridge's native encoder uses: an Image and a PointCloud2, whose
+// payloads go through the base64 encoder, and a PoseArray and a JointState,
+// which are mostly numbers. Build once more with -DDIMOS_LCM_NO_SIMD to compare
+// the SIMD base64 paths with the table one.
+//
+// Build from the repo root (needs the LCM headers on the include path):
+//   g++ -std=c++17 -O2 -march=native -I generated/cpp_lcm_msgs
+//       tools/cpp/bench/json_encode_bench.cpp -o json_encode_bench
+
+#include <lcm/lcm_coretypes.h>
+
+#include <chrono>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include "dimos_lcm/json_writer.hpp"
+#include "geometry_msgs/PoseArray.hpp"
+#include "sensor_msgs/Image.hpp"
+#include "sensor_msgs/JointState.hpp"
+#include "sensor_msgs/PointCloud2.hpp"
+
+namespace
+{
+
+const int kRounds = 200;
+
+volatile size_t g_sink;
+
+template <typename Msg>
+void run(const char *label, const Msg &msg)
+{
+    std::string out;
+    dimos_lcm::append_json(out, msg);
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for (int r = 0; r < kRounds; r++) {
+        out.clear();
+        dimos_lcm::append_json(out, msg);
+        g_sink = out.size();
+    }
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count() / kRounds;
+    printf("%-28s %9.1f us   %8.1f MB/s of message   %8.1f MB/s of JSON\n", label, seconds * 1e6,
+           msg.getEncodedSize() / seconds / 1e6, out.size() / seconds / 1e6);
+}
+
+}
+
+int main()
+{
+    sensor_msgs::Image image;
+    image.height = 480;
+    image.width = 640;
+    image.step = 640 * 3;
+    image.encoding = "rgb8";
+    image.data_length = image.height * image.step;
+    image.data.resize(image.data_length);
+    for (size_t i = 0; i < image.data.size(); i++)
+        image.data[i] = static_cast<uint8_t>(i * 7);
+
+    sensor_msgs::PointCloud2 cloud;
+    cloud.height = 1;
+    cloud.width = 100000;
+    cloud.point_step = 16;
+    cloud.row_step = cloud.point_step * cloud.width;
+    cloud.fields_length = 3;
+    cloud.fields.resize(3);
+    const char *names[] = {"x", "y", "z"};
+    for (int i = 0; i < 3; i++) {
+        cloud.fields[i].name = names[i];
+        cloud.fields[i].offset = 4 * i;
+        cloud.fields[i].datatype = 7;
+        cloud.fields[i].count = 1;
+    }
+    cloud.data_length = cloud.row_step;
+    cloud.data.resize(cloud.data_length);
+    for (size_t i = 0; i < cloud.data.size(); i++)
+        cloud.data[i] = static_cast<uint8_t>(i * 13);
+
+    geometry_msgs::PoseArray poses;
+    poses.header.frame_id = "map";
+    poses.poses_length = 1000;
+    poses.poses.resize(poses.poses_length);
+    for (int i = 0; i < poses.poses_length; i++) {
+        poses.poses[i].position.x = i * 0.37;
+        poses.poses[i].position.y = -i * 1.25;
+        poses.poses[i].orientation.w = 1.0;
+    }
+
+    sensor_msgs::JointState joints;
+    joints.header.frame_id = "base_link";
+    joints.name_length = joints.position_length = joints.velocity_length = joints.effort_length = 12;
+    for (int i = 0; i < 12; i++) {
+        joints.name.push_back("arm_joint_" + std::to_string(i));
+        joints.position.push_back(0.1 * i);
+        joints.velocity.push_back(0.013 * i);
+        joints.effort.push_back(1.5);
+    }
+
+    run("Image (640x480 rgb8)", image);
+    run("PointCloud2 (100k points)", cloud);
+    run("PoseArray (1000 poses)", poses);
+    run("JointState (12 joints)", joints);
+    return 0;
+}
@@ -0,0 +1,143 @@
+// Heap allocations and latency of a subscriber handler that decodes into a
+// fresh std::make_shared message per call versus one acquired from a
+// dimos_lcm::message_pool, whose recycled messages keep their capacity.
+//
+// Build from the repo root (needs the LCM headers on the include path):
+//   g++ -std=c++17 -O2 -I generated/cpp_lcm_msgs
+//       tools/cpp/bench/message_pool_bench.cpp -o message_pool_bench
+
+#include <lcm/lcm_coretypes.h>
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <new>
+#include <string>
+#include <vector>
+
+#include "dimos_lcm/message_pool.hpp"
+#include "sensor_msgs/Image.hpp"
+#include "sensor_msgs/JointState.hpp"
+#include "sensor_msgs/PointCloud2.hpp"
+
+namespace
+{
+
+const int kRounds = 1000;
+
+volatile int g_sink;
+long g_allocations;
+
+template <typename F>
+double microsecondsPerCall(F fn)
+{
+    fn();
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for (int r = 0; r < kRounds; r++)
+        fn();
+    return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count() / kRounds;
+}
+
+template <typename F>
+long allocationsPerCall(F fn)
+{
+    long before = g_allocations;
+    fn();
+    return g_allocations - before;
+}
+
+template <typename Msg>
+void run(const char *name, const Msg &msg)
+{
+    std::vector<uint8_t> wire(msg.getEncodedSize());
+    msg.encode(wire.data(), 0, static_cast<int>(wire.size()));
+    const int size = static_cast<int>(wire.size());
+
+    // The handler hands the message on, so it is reference counted either way
+    std::shared_ptr<Msg> last;
+    auto decode = [&] {
+        std::shared_ptr<Msg> out = std::make_shared<Msg>();
+        g_sink = out->decode(wire.data(), 0, size);
+        last = std::move(out);
+    };
+
+    dimos_lcm::message_pool<Msg> pool;
+    auto decodePooled = [&] {
+        std::shared_ptr<Msg> out = pool.acquire();
+        g_sink = out->decode(wire.data(), 0, size);
+        last = std::move(out);
+    };
+
+    long allocations = allocationsPerCall(decode);
+    double us = microsecondsPerCall(decode);
+    last.reset();
+    double pooled_us = microsecondsPerCall(decodePooled);
+    long pooled_allocations = allocationsPerCall(decodePooled);
+
+    printf("%s (%d bytes)\n", name, size);
+    printf("  make_shared %9.2f us %4ld allocations   pool %9.2f us %4ld allocations (%zu by the pool)   %4.1fx\n",
+           us, allocations, pooled_us, pooled_allocations, pool.allocations(), us / pooled_us);
+}
+
+}
+
+void *operator new(size_t n)
+{
+    g_allocations++;
+    void *p = malloc(n ? n : 1);
+    if (!p)
+        throw std::bad_alloc();
+    return p;
+}
+
+void operator delete(void *p) noexcept { free(p); }
+void operator delete(void *p, size_t) noexcept { free(p); }
+
+int main()
+{
+    sensor_msgs::Image image{};
+    image.header.frame_id = "camera_color_optical_frame";
+    image.height = 480;
+    image.width = 640;
+    image.encoding = "rgb8";
+    image.step = 640 * 3;
+    image.data_length = 640 * 480 * 3;
+    image.data.assign(image.data_length, 0x5a);
+    run("sensor_msgs::Image 640x480 rgb8", image);
+
+    sensor_msgs::PointCloud2 cloud{};
+    cloud.header.frame_id = "lidar";
+    cloud.height = 1;
+    cloud.width = 50000;
+    cloud.fields_length = 4;
+    cloud.fields.resize(4);
+    const char *names[] = {"x", "y", "z", "intensity"};
+    for (int i = 0; i < 4; i++) {
+        cloud.fields[i].name = names[i];
+        cloud.fields[i].offset = 4 * i;
+        cloud.fields[i].datatype = 7;
+        cloud.fields[i].count = 1;
+    }
+    cloud.point_step = 16;
+    cloud.row_step = 16 * 50000;
+    cloud.data_length = 16 * 50000;
+    cloud.data.assign(cloud.data_length, 0x5a);
+    run("sensor_msgs::PointCloud2 50k points", cloud);
+
+    const int joints = 32;
+    sensor_msgs::JointState joint_state{};
+    joint_state.header.frame_id = "base_link";
+    joint_state.name_length = joints;
+    joint_state.position_length = joints;
+    joint_state.velocity_length = joints;
+    joint_state.effort_length = joints;
+    for (int i = 0; i < joints; i++) {
+        joint_state.name.push_back("arm_joint_with_a_long_name_" + std::to_string(i));
+        joint_state.position.push_back(i * 0.1);
+        joint_state.velocity.push_back(i * 0.2);
+        joint_state.effort.push_back(i * 0.3);
+    }
+    run("sensor_msgs::JointState 32 joints", joint_state);
+    return 0;
+}
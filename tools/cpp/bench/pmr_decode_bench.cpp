@@ -0,0 +1,140 @@
+// Heap allocations and latency of decoding message trees with many small
+// strings and arrays: the regular classes, which allocate every std::string
+// and std::vector on the heap, versus their std::pmr flavor decoding into a
+// monotonic_buffer_resource arena that is released after each message.
+//
+// Build from the repo root (needs the LCM headers on the include path):
+//   g++ -std=c++17 -O2 -I generated/cpp_lcm_msgs
+//       tools/cpp/bench/pmr_decode_bench.cpp -o pmr_decode_bench
+
+#include <lcm/lcm_coretypes.h>
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <memory_resource>
+#include <new>
+#include <string>
+#include <vector>
+
+#include "foxglove_msgs/SceneUpdate.hpp"
+#include "foxglove_msgs/pmr/SceneUpdate.hpp"
+#include "visualization_msgs/MarkerArray.hpp"
+#include "visualization_msgs/pmr/MarkerArray.hpp"
+
+namespace
+{
+
+const int kRounds = 2000;
+
+volatile int g_sink;
+long g_allocations;
+
+template <typename F>
+double microsecondsPerCall(F fn)
+{
+    fn();
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for (int r = 0; r < kRounds; r++)
+        fn();
+    return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count() / kRounds;
+}
+
+template <typename F>
+long allocationsPerCall(F fn)
+{
+    long before = g_allocations;
+    fn();
+    return g_allocations - before;
+}
+
+template <typename Msg, typename PmrMsg>
+void run(const char *name, const Msg &msg)
+{
+    std::vector<uint8_t> wire(msg.getEncodedSize());
+    msg.encode(wire.data(), 0, static_cast<int>(wire.size()));
+    const int size = static_cast<int>(wire.size());
+
+    // A fresh message per call, as in a subscriber handler
+    auto decode = [&] {
+        Msg out;
+        g_sink = out.decode(wire.data(), 0, size);
+    };
+
+    std::vector<uint8_t> arena_buffer(4 * wire.size() + 65536);
+    std::pmr::monotonic_buffer_resource arena(arena_buffer.data(), arena_buffer.size());
+    auto decodePmr = [&] {
+        {
+            PmrMsg out(&arena);
+            g_sink = out.decode(wire.data(), 0, size);
+        }
+        arena.release();
+    };
+
+    long allocations = allocationsPerCall(decode);
+    long pmr_allocations = allocationsPerCall(decodePmr);
+    double us = microsecondsPerCall(decode);
+    double pmr_us = microsecondsPerCall(decodePmr);
+
+    printf("%s (%d bytes)\n", name, size);
+    printf("  std:: %9.2f us %6ld allocations   pmr:: %9.2f us %6ld allocations   %4.1fx\n",
+           us, allocations, pmr_us, pmr_allocations, us / pmr_us);
+}
+
+}
+
+void *operator new(size_t n)
+{
+    g_allocations++;
+    void *p = malloc(n ? n : 1);
+    if (!p)
+        throw std::bad_alloc();
+    return p;
+}
+
+void operator delete(void *p) noexcept { free(p); }
+void operator delete(void *p, size_t) noexcept { free(p); }
+
+int main()
+{
+    const int markers = 200;
+    visualization_msgs::MarkerArray marker_array{};
+    marker_array.markers_length = markers;
+    marker_array.markers.resize(markers);
+    for (int i = 0; i < markers; i++) {
+        visualization_msgs::Marker &marker = marker_array.markers[i];
+        marker.header.frame_id = "map";
+        marker.ns = "planner/trajectory_candidates";
+        marker.id = i;
+        marker.text = "candidate " + std::to_string(i);
+        marker.points_length = 8;
+        marker.points.resize(8);
+        marker.colors_length = 8;
+        marker.colors.resize(8);
+    }
+    run<visualization_msgs::MarkerArray, visualization_msgs::pmr::MarkerArray>(
+        "visualization_msgs::MarkerArray 200 markers", marker_array);
+
+    const int entities = 50;
+    foxglove_msgs::SceneUpdate scene{};
+    scene.entities_length = entities;
+    scene.entities.resize(entities);
+    for (int i = 0; i < entities; i++) {
+        foxglove_msgs::SceneEntity &entity = scene.entities[i];
+        entity.frame_id = "base_link";
+        entity.id = "obstacle_" + std::to_string(i);
+        entity.metadata_length = 2;
+        entity.metadata.resize(2);
+        entity.metadata[0].key = "class";
+        entity.metadata[0].value = "pedestrian";
+        entity.metadata[1].key = "tracker";
+        entity.metadata[1].value = "kalman";
+        entity.cubes_length = 1;
+        entity.cubes.resize(1);
+        entity.texts_length = 1;
+        entity.texts.resize(1);
+        entity.texts[0].text = entity.id;
+    }
+    run<foxglove_msgs::SceneUpdate, foxglove_msgs::pmr::SceneUpdate>("foxglove_msgs::SceneUpdate 50 entities", scene);
+    return 0;
+}
@@ -0,0 +1,85 @@
+// Cost of finding the type of a message from its fingerprint, as a recorder or
+// bridge demultiplexing a mixed channel does for every message: a chain of
+// getHash() comparisons over every type, a std::unordered_map, and the
+// registry's generated perfect hash (dimos_lcm::find_type()).
+//
+// Build from the repo root (needs the LCM headers on the include path):
+//   g++ -std=c++17 -O2 -I generated/cpp_lcm_msgs
+//       tools/cpp/bench/registry_lookup_bench.cpp -o registry_lookup_bench
+
+#include <lcm/lcm_coretypes.h>
+
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <unordered_map>
+#include <vector>
+
+#include "dimos_lcm/registry.hpp"
+
+namespace
+{
+
+const int kRounds = 200;
+
+volatile int g_sink;
+
+template <typename F>
+double nanosecondsPerLookup(F fn, int lookups)
+{
+    fn();
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for (int r = 0; r < kRounds; r++)
+        fn();
+    return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() /
+           (static_cast<double>(kRounds) * lookups);
+}
+
+// What a hand-written if-chain over getHash() compiles to
+const dimos_lcm::type_info *findByChain(int64_t hash)
+{
+    for (const dimos_lcm::type_info &type : dimos_lcm::kTypes) {
+        if (type.hash == hash)
+            return &type;
+    }
+    return NULL;
+}
+
+}
+
+int main()
+{
+    // A log mixing every type, in random order
+    std::mt19937 rng(1);
+    std::vector<int64_t> hashes;
+    for (int i = 0; i < 10000; i++)
+        hashes.push_back(dimos_lcm::kTypes[rng() % dimos_lcm::kTypeCount].hash);
+    const int lookups = static_cast<int>(hashes.size());
+
+    std::unordered_map<int64_t, const dimos_lcm::type_info *> map;
+    for (const dimos_lcm::type_info &type : dimos_lcm::kTypes)
+        map.emplace(type.hash, &type);
+
+    double chain = nanosecondsPerLookup([&] {
+        int sum = 0;
+        for (int64_t hash : hashes)
+            sum += findByChain(hash)->index;
+        g_sink = sum;
+    }, lookups);
+    double unordered = nanosecondsPerLookup([&] {
+        int sum = 0;
+        for (int64_t hash : hashes)
+            sum += map.find(hash)->second->index;
+        g_sink = sum;
+    }, lookups);
+    double perfect = nanosecondsPerLookup([&] {
+        int sum = 0;
+        for (int64_t hash : hashes)
+            sum += dimos_lcm::find_type(hash)->index;
+        g_sink = sum;
+    }, lookups);
+
+    printf("fingerprint lookup over %d types\n", dimos_lcm::kTypeCount);
+    printf("  getHash() chain %7.2f ns   unordered_map %7.2f ns   find_type() %7.2f ns\n", chain, unordered, perfect);
+    return 0;
+}
@@ -0,0 +1,96 @@
+// Decode cost of a full decode() versus decodeFields<Mask>() when a consumer
+// only needs a few fields: the unselected strings, arrays and payloads are
+// skipped by their length prefixes instead of being allocated and copied.
+//
+// Build from the repo root (needs the LCM headers on the include path):
+//   g++ -std=c++17 -O2 -I generated/cpp_lcm_msgs
+//       tools/cpp/bench/selective_decode_bench.cpp -o selective_decode_bench
+
+#include <lcm/lcm_coretypes.h>
+
+#include <chrono>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include "sensor_msgs/JointState.hpp"
+#include "sensor_msgs/PointCloud2.hpp"
+
+namespace
+{
+
+const int kRounds = 2000;
+
+volatile int g_sink;
+
+template <typename F>
+double microsecondsPerCall(F fn)
+{
+    fn();
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for (int r = 0; r < kRounds; r++)
+        fn();
+    return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count() / kRounds;
+}
+
+template <uint64_t Mask, typename Msg>
+void run(const char *name, const char *selected, const Msg &msg)
+{
+    std::vector<uint8_t> wire(msg.getEncodedSize());
+    msg.encode(wire.data(), 0, static_cast<int>(wire.size()));
+    const int size = static_cast<int>(wire.size());
+
+    // A fresh message per call, as in a subscriber handler
+    double full = microsecondsPerCall([&] {
+        Msg out;
+        g_sink = out.decode(wire.data(), 0, size);
+    });
+    double selective = microsecondsPerCall([&] {
+        Msg out;
+        g_sink = out.template decodeFields<Mask>(wire.data(), 0, size);
+    });
+
+    printf("%s, %s only (%d bytes)\n", name, selected, size);
+    printf("  decode() %9.2f us   decodeFields() %9.2f us   %5.1fx\n", full, selective, full / selective);
+}
+
+}
+
+int main()
+{
+    const int joints = 64;
+    sensor_msgs::JointState joint_state;
+    joint_state.header.seq = 0;
+    joint_state.header.stamp.sec = 0;
+    joint_state.header.stamp.nsec = 0;
+    joint_state.header.frame_id = "base_link";
+    joint_state.name_length = joints;
+    joint_state.position_length = joints;
+    joint_state.velocity_length = joints;
+    joint_state.effort_length = joints;
+    for (int i = 0; i < joints; i++) {
+        joint_state.name.push_back("arm_joint_with_a_long_name_" + std::to_string(i));
+        joint_state.position.push_back(i * 0.1);
+        joint_state.velocity.push_back(i * 0.2);
+        joint_state.effort.push_back(i * 0.3);
+    }
+    run<sensor_msgs::JointState::Fields::position>("sensor_msgs::JointState 64 joints", "position", joint_state);
+
+    sensor_msgs::PointCloud2 cloud;
+    cloud.header.seq = 0;
+    cloud.header.stamp.sec = 0;
+    cloud.header.stamp.nsec = 0;
+    cloud.header.frame_id = "lidar";
+    cloud.height = 1;
+    cloud.width = 100000;
+    cloud.fields_length = 0;
+    cloud.is_bigendian = 0;
+    cloud.point_step = 16;
+    cloud.row_step = 16 * 100000;
+    cloud.data_length = 16 * 100000;
+    cloud.data.assign(cloud.data_length, 0x5a);
+    cloud.is_dense = 1;
+    run<sensor_msgs::PointCloud2::Fields::header | sensor_msgs::PointCloud2::Fields::fields>(
+        "sensor_msgs::PointCloud2 100k points x 16 B", "header and fields", cloud);
+    return 0;
+}
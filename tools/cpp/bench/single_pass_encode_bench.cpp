@@ -0,0 +1,85 @@
+// Publishing cost of deeply nested messages: getEncodedSize() followed by
+// encode(), which walks the message twice, versus the single-pass encodeTo().
+// Both encode into a buffer reused across messages, as a publisher would.
+//
+// Build from the repo root (needs the LCM headers on the include path):
+//   g++ -std=c++17 -O2 -I generated/cpp_lcm_msgs
+//       tools/cpp/bench/single_pass_encode_bench.cpp -o single_pass_encode_bench
+
+#include <lcm/lcm_coretypes.h>
+
+#include <chrono>
+#include <cstdio>
+#include <vector>
+
+#include "nav_msgs/Path.hpp"
+#include "visualization_msgs/MarkerArray.hpp"
+
+namespace
+{
+
+const int kRounds = 2000;
+
+volatile int g_sink;
+
+template <typename F>
+double microsecondsPerCall(F fn)
+{
+    fn();
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for (int r = 0; r < kRounds; r++)
+        fn();
+    return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count() / kRounds;
+}
+
+template <typename Msg>
+void run(const char *name, const Msg &msg)
+{
+    std::vector<uint8_t> buf;
+
+    double two_pass = microsecondsPerCall([&] {
+        buf.resize(msg.getEncodedSize());
+        g_sink = msg.encode(buf.data(), 0, static_cast<int>(buf.size()));
+    });
+    double single_pass = microsecondsPerCall([&] {
+        buf.clear();
+        g_sink = msg.encodeTo(buf);
+    });
+
+    printf("%-40s %7.1f KB   getEncodedSize+encode %7.1f us   encodeTo %7.1f us\n",
+           name, buf.size() / 1e3, two_pass, single_pass);
+}
+
+}
+
+int main()
+{
+    visualization_msgs::MarkerArray markers = {};
+    markers.markers_length = 500;
+    markers.markers.resize(markers.markers_length);
+    for (int i = 0; i < markers.markers_length; i++) {
+        visualization_msgs::Marker &m = markers.markers[i];
+        m.header.frame_id = "map";
+        m.ns = "obstacles";
+        m.id = i;
+        m.text = "obstacle";
+        m.mesh_resource = "";
+        m.points_length = 20;
+        m.points.resize(m.points_length);
+        m.colors_length = 20;
+        m.colors.resize(m.colors_length);
+    }
+    run("visualization_msgs::MarkerArray 500x20", markers);
+
+    nav_msgs::Path path = {};
+    path.header.frame_id = "map";
+    path.poses_length = 5000;
+    path.poses.resize(path.poses_length);
+    for (int i = 0; i < path.poses_length; i++) {
+        path.poses[i].header.frame_id = "map";
+        path.poses[i].pose.position.x = i * 0.1;
+        path.poses[i].pose.orientation.w = 1;
+    }
+    run("nav_msgs::Path 5000 poses", path);
+    return 0;
+}
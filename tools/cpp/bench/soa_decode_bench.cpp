@@ -0,0 +1,127 @@
+// Decode and a per-element pass over arrays of poses: the regular classes, which
+// decode an array of Pose/PoseStamped structs whose fields are read with a
+// stride of the whole struct, versus their soa:: flavor, which decodes into
+// one contiguous column per field. The messages are reused across calls, as
+// in a subscriber that keeps its last message.
+//
+// Build from the repo root (needs the LCM headers on the include path):
+//   g++ -std=c++17 -O2 -I generated/cpp_lcm_msgs
+//       tools/cpp/bench/soa_decode_bench.cpp -o soa_decode_bench
+
+#include <lcm/lcm_coretypes.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <vector>
+
+#include "geometry_msgs/PoseArray.hpp"
+#include "geometry_msgs/soa/PoseArray.hpp"
+#include "nav_msgs/Path.hpp"
+#include "nav_msgs/soa/Path.hpp"
+
+namespace
+{
+
+const int kRounds = 200;
+const int kPoses = 20000;
+
+volatile double g_sink;
+std::vector<double> g_ranges;
+
+template <typename F>
+double microsecondsPerCall(F fn)
+{
+    fn();
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for (int r = 0; r < kRounds; r++)
+        fn();
+    return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count() / kRounds;
+}
+
+// Squared range of every position, as a filter or cost function would compute
+template <typename GetX, typename GetY, typename GetZ>
+double squaredRanges(int n, GetX x, GetY y, GetZ z, std::vector<double> &out)
+{
+    out.resize(n);
+    double *d = out.data();
+    for (int i = 0; i < n; i++)
+        d[i] = x(i) * x(i) + y(i) * y(i) + z(i) * z(i);
+    return n > 0 ? d[n - 1] : 0;
+}
+
+template <typename Msg, typename SoaMsg, typename Aos, typename Soa>
+void run(const char *name, const Msg &msg, Aos aosPass, Soa soaPass)
+{
+    std::vector<uint8_t> wire(msg.getEncodedSize());
+    msg.encode(wire.data(), 0, static_cast<int>(wire.size()));
+    const int size = static_cast<int>(wire.size());
+
+    Msg out;
+    SoaMsg soa_out;
+    double decode = microsecondsPerCall([&] { out.decode(wire.data(), 0, size); });
+    double soa_decode = microsecondsPerCall([&] { soa_out.decode(wire.data(), 0, size); });
+    double pass = microsecondsPerCall([&] { g_sink = aosPass(out); });
+    double soa_pass = microsecondsPerCall([&] { g_sink = soaPass(soa_out); });
+
+    printf("%s (%d bytes)\n", name, size);
+    printf("  decode         std:: %8.2f us   soa:: %8.2f us   %4.1fx\n", decode, soa_decode, decode / soa_decode);
+    printf("  ranges         std:: %8.2f us   soa:: %8.2f us   %4.1fx\n", pass, soa_pass, pass / soa_pass);
+}
+
+}
+
+int main()
+{
+    geometry_msgs::PoseArray pose_array{};
+    pose_array.header.frame_id = "map";
+    pose_array.poses_length = kPoses;
+    pose_array.poses.resize(kPoses);
+    for (int i = 0; i < kPoses; i++) {
+        pose_array.poses[i].position.x = i * 0.1;
+        pose_array.poses[i].position.y = (i % 101) * 0.2;
+        pose_array.poses[i].position.z = (i % 17) * 0.01;
+        pose_array.poses[i].orientation.w = 1;
+    }
+    run<geometry_msgs::PoseArray, geometry_msgs::soa::PoseArray>(
+        "geometry_msgs::PoseArray 20k poses", pose_array,
+        [](const geometry_msgs::PoseArray &m) {
+            const geometry_msgs::Pose *p = m.poses.data();
+            return squaredRanges(
+                m.poses_length, [p](int i) { return p[i].position.x; }, [p](int i) { return p[i].position.y; },
+                [p](int i) { return p[i].position.z; }, g_ranges);
+        },
+        [](const geometry_msgs::soa::PoseArray &m) {
+            const double *x = m.poses.position_x.data();
+            const double *y = m.poses.position_y.data();
+            const double *z = m.poses.position_z.data();
+            return squaredRanges(
+                m.poses_length, [x](int i) { return x[i]; }, [y](int i) { return y[i]; }, [z](int i) { return z[i]; }, g_ranges);
+        });
+
+    nav_msgs::Path path{};
+    path.header.frame_id = "map";
+    path.poses_length = kPoses;
+    path.poses.resize(kPoses);
+    for (int i = 0; i < kPoses; i++) {
+        path.poses[i].header.seq = i;
+        path.poses[i].header.frame_id = "map";
+        path.poses[i].pose = pose_array.poses[i];
+    }
+    run<nav_msgs::Path, nav_msgs::soa::Path>(
+        "nav_msgs::Path 20k stamped poses", path,
+        [](const nav_msgs::Path &m) {
+            const geometry_msgs::PoseStamped *p = m.poses.data();
+            return squaredRanges(
+                m.poses_length, [p](int i) { return p[i].pose.position.x; },
+                [p](int i) { return p[i].pose.position.y; }, [p](int i) { return p[i].pose.position.z; }, g_ranges);
+        },
+        [](const nav_msgs::soa::Path &m) {
+            const double *x = m.poses.pose_position_x.data();
+            const double *y = m.poses.pose_position_y.data();
+            const double *z = m.poses.pose_position_z.data();
+            return squaredRanges(
+                m.poses_length, [x](int i) { return x[i]; }, [y](int i) { return y[i]; }, [z](int i) { return z[i]; }, g_ranges);
+        });
+    return 0;
+}
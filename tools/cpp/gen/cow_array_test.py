@@ -0,0 +1,64 @@
+import unittest
+
+from cpp_program import compiler, run_program, thread_sanitizer_flags
+
+# Decodes an Image into a cow:: message, hands copies to consumer threads that
+# read and drop them, and decodes the next Image into the same message as
+# soon as it is unshared again, without joining the consumers first
+PROGRAM = r"""
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include "sensor_msgs/Image.hpp"
+#include "sensor_msgs/cow/Image.hpp"
+
+int main()
+{
+    const int kConsumers = 4, kRounds = 50, kBytes = 1 << 16;
+    std::vector<std::vector<uint8_t> > wire(2);
+    for (int k = 0; k < 2; k++) {
+        sensor_msgs::Image msg = {};
+        msg.data_length = kBytes;
+        msg.data.assign(kBytes, static_cast<uint8_t>(k + 1));
+        wire[k].resize(msg.getEncodedSize());
+        msg.encode(wire[k].data(), 0, static_cast<int>(wire[k].size()));
+    }
+
+    std::atomic<bool> torn(false);
+    std::vector<std::thread> consumers;
+    sensor_msgs::cow::Image img;
+    for (int round = 0; round < kRounds; round++) {
+        const std::vector<uint8_t> &buf = wire[round % 2];
+        if (img.decode(buf.data(), 0, static_cast<int>(buf.size())) < 0)
+            return 1;
+        const uint8_t expected = static_cast<uint8_t>(round % 2 + 1);
+        for (int c = 0; c < kConsumers; c++) {
+            consumers.emplace_back([copy = img, expected, &torn]() mutable {
+                for (uint8_t b : copy.data)
+                    if (b != expected)
+                        torn = true;
+                copy = sensor_msgs::cow::Image();
+            });
+        }
+        // Decoding reuses the buffer once the consumers are done with it
+        while (img.data.use_count() != 1)
+            std::this_thread::yield();
+    }
+    for (std::thread &t : consumers)
+        t.join();
+    return torn ? 2 : 0;
+}
+"""
+
+
+@unittest.skipUnless(compiler(), "needs a C++17 compiler and the LCM headers")
+class CowArrayTest(unittest.TestCase):
+    def test_payload_handed_to_consumer_threads(self):
+        # ThreadSanitizer, where available, fails the program on a data race
+        # between the consumers' reads and the next decode
+        self.assertEqual(run_program(PROGRAM, "cow_array_test", thread_sanitizer_flags()), 0)
+
+
+if __name__ == "__main__":
+    unittest.main()
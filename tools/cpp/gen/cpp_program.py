@@ -0,0 +1,50 @@
+"""Build and run small C++ programs against generated/cpp_lcm_msgs, for the
+tests of the runtime headers."""
+
+import os
+import shutil
+import subprocess
+import tempfile
+from typing import List, Optional
+
+GENERATED_DIR = os.path.join(os.path.dirname(__file__), "..", "..", "..", "generated", "cpp_lcm_msgs")
+
+
+def _compiles(cxx: str, flags: List[str]) -> bool:
+    with tempfile.TemporaryDirectory() as tmp:
+        probe = subprocess.run(
+            [cxx, "-std=c++17", "-x", "c++", "-", "-o", os.path.join(tmp, "probe")] + flags,
+            input="#include <lcm/lcm_coretypes.h>\nint main() { return 0; }\n",
+            capture_output=True,
+            text=True,
+        )
+    return probe.returncode == 0
+
+
+def compiler() -> Optional[str]:
+    """A C++ compiler that finds the LCM headers, or None."""
+    cxx = os.environ.get("CXX") or shutil.which("c++") or shutil.which("g++")
+    if not cxx or not _compiles(cxx, []):
+        return None
+    return cxx
+
+
+def run_program(source: str, name: str, flags: Optional[List[str]] = None) -> int:
+    """Build @p source with compiler() and @p flags, run it and return its exit
+    status. A build failure raises CalledProcessError."""
+    with tempfile.TemporaryDirectory() as tmp:
+        path = os.path.join(tmp, name + ".cpp")
+        binary = os.path.join(tmp, name)
+        with open(path, "w") as f:
+            f.write(source)
+        subprocess.run(
+            [compiler(), "-std=c++17", "-I", GENERATED_DIR, path, "-o", binary, "-pthread"] + (flags or []),
+            check=True,
+        )
+        return subprocess.run([binary]).returncode
+
+
+def thread_sanitizer_flags() -> List[str]:
+    """Flags that build with ThreadSanitizer, or none if the compiler cannot."""
+    flags = ["-g", "-O1", "-fsanitize=thread"]
+    return flags if _compiles(compiler(), flags) else []
@@ -0,0 +1,283 @@
+"""
+Helpers shared by the C++ emitters: type name mapping, include paths and a
+small line buffer that indents the same way lcm-gen's emit() does.
+"""
+
+from typing import Callable, Dict, List, Optional, Set, Tuple
+
+from lcm_parser import PRIMITIVE_SIZES, LcmMember, LcmStruct, is_primitive
+
+# C++ storage type of each LCM primitive, as used by lcm-gen
+PRIMITIVE_CPP_TYPES = {
+    "int8_t": "int8_t",
+    "int16_t": "int16_t",
+    "int32_t": "int32_t",
+    "int64_t": "int64_t",
+    "float": "float",
+    "double": "double",
+    "string": "std::string",
+    "boolean": "int8_t",
+    "byte": "uint8_t",
+}
+
+BANNER = """/** THIS IS AN AUTOMATICALLY GENERATED FILE.  DO NOT MODIFY
+ * BY HAND!!
+ *
+ * Generated by lcm-cpp (tools/cpp/gen)
+ **/
+"""
+
+
+def cpp_type(lcm_type: str) -> str:
+    """C++ spelling of an LCM type, e.g. "std_msgs.Header" -> "std_msgs::Header"."""
+    if is_primitive(lcm_type):
+        return PRIMITIVE_CPP_TYPES[lcm_type]
+    return lcm_type.replace(".", "::")
+
+
+# Namespaces, nested in each package, of the flavors of the message classes:
+# std::pmr containers, structure-of-arrays storage for struct arrays,
+# copy-on-write byte payloads and interned identifier strings
+PMR_NAMESPACE = "pmr"
+SOA_NAMESPACE = "soa"
+COW_NAMESPACE = "cow"
+INTERNED_NAMESPACE = "interned"
+
+
+def flavor_name(full_name: str, namespace: str) -> str:
+    """Full name of a type in a flavor namespace, e.g. "std_msgs.pmr.Header"."""
+    return f"{package_of(full_name)}.{namespace}.{short_name(full_name)}"
+
+
+def pmr_name(full_name: str) -> str:
+    return flavor_name(full_name, PMR_NAMESPACE)
+
+
+def pmr_cpp_type(lcm_type: str) -> str:
+    """cpp_type() for the std::pmr flavor: strings become std::pmr::string and
+    structs their pmr namespace counterpart."""
+    if lcm_type == "string":
+        return "std::pmr::string"
+    if is_primitive(lcm_type):
+        return PRIMITIVE_CPP_TYPES[lcm_type]
+    return cpp_type(pmr_name(lcm_type))
+
+
+def coretypes_prefix(lcm_type: str) -> str:
+    """Name stem of the lcm_coretypes.h codec functions, e.g. "__int32_t"."""
+    return f"__{lcm_type}"
+
+
+def short_name(full_name: str) -> str:
+    return full_name.split(".")[-1]
+
+
+def package_of(full_name: str) -> str:
+    return ".".join(full_name.split(".")[:-1])
+
+
+def header_path(full_name: str, suffix: str = "") -> str:
+    """Include path of a generated header relative to cpp_lcm_msgs/."""
+    return full_name.replace(".", "/") + suffix + ".hpp"
+
+
+def guard_name(full_name: str, suffix: str = "") -> str:
+    return "__" + full_name.replace(".", "_") + suffix + "_hpp__"
+
+
+def dim_size(member: LcmMember, index: int = 0, owner: str = "this->") -> str:
+    """Element count expression of one dimension of an array member."""
+    dim = member.dimensions[index]
+    return dim.size if dim.is_constant else owner + dim.size
+
+
+def is_plain(struct: LcmStruct, types: Dict[str, LcmStruct]) -> bool:
+    """True if the struct has no strings or variable-length arrays, recursively."""
+    for member in struct.members:
+        if member.is_variable_array or member.type == "string":
+            return False
+        if not member.is_primitive and not is_plain(types[member.type], types):
+            return False
+    return True
+
+
+def fixed_encoded_size(struct: LcmStruct, types: Dict[str, LcmStruct]) -> int:
+    """Encoded size, without the 8-byte hash, of a struct for which is_plain() holds."""
+    size = 0
+    for member in struct.members:
+        count = 1
+        for dim in member.dimensions:
+            count *= int(dim.size)
+        if member.is_primitive:
+            size += count * PRIMITIVE_SIZES[member.type]
+        else:
+            size += count * fixed_encoded_size(types[member.type], types)
+    return size
+
+
+def min_encoded_size(struct: LcmStruct, types: Dict[str, LcmStruct]) -> int:
+    """Smallest encoded size, without the hash, of any valid instance of the struct:
+    variable-length arrays empty and strings holding just the terminating NUL."""
+    size = 0
+    for member in struct.members:
+        if member.is_variable_array:
+            continue
+        count = 1
+        for dim in member.dimensions:
+            count *= int(dim.size)
+        if member.type == "string":
+            size += count * 5
+        elif member.is_primitive:
+            size += count * PRIMITIVE_SIZES[member.type]
+        else:
+            size += count * min_encoded_size(types[member.type], types)
+    return size
+
+
+def is_flat(struct: LcmStruct, types: Dict[str, LcmStruct]) -> bool:
+    """True if the struct has no arrays, recursively, so that a sequence of
+    it can be stored as one column per scalar or string field."""
+    for member in struct.members:
+        if member.is_array:
+            return False
+        if not member.is_primitive and not is_flat(types[member.type], types):
+            return False
+    return bool(struct.members)
+
+
+def _has_floating_point(struct: LcmStruct, types: Dict[str, LcmStruct]) -> bool:
+    for member in struct.members:
+        if member.type in ("float", "double"):
+            return True
+        if not member.is_primitive and _has_floating_point(types[member.type], types):
+            return True
+    return False
+
+
+def is_columnar(member: LcmMember, types: Dict[str, LcmStruct]) -> bool:
+    """True for the variable-length struct arrays stored as columns in the
+    structure-of-arrays flavor: arrays of flat structs with float or double
+    fields (points, poses, colors, ...), which is what vectorized math reads."""
+    if not member.is_variable_array or len(member.dimensions) > 1 or member.is_primitive:
+        return False
+    element = types[member.type]
+    return is_flat(element, types) and _has_floating_point(element, types)
+
+
+def _nesting_closure(types: Dict[str, LcmStruct], direct: Callable[[LcmMember], bool]) -> Set[str]:
+    """Types with a member for which @p direct is true, and those nesting such
+    a type."""
+    result: Set[str] = set()
+    changed = True
+    while changed:
+        changed = False
+        for name, struct in types.items():
+            if name in result:
+                continue
+            for member in struct.members:
+                if direct(member) or member.type in result:
+                    result.add(name)
+                    changed = True
+                    break
+    return result
+
+
+def soa_types(types: Dict[str, LcmStruct]) -> Set[str]:
+    """Types with a structure-of-arrays flavor: those with a columnar member,
+    and those nesting such a type."""
+    return _nesting_closure(types, lambda member: is_columnar(member, types))
+
+
+# String fields holding identifiers from a small vocabulary, which the
+# interned flavor stores as dimos_lcm::interned_string
+INTERNED_FIELDS = {"frame_id", "child_frame_id", "parent_frame_id", "hardware_id", "name", "joint_names"}
+
+
+def is_interned(member: LcmMember) -> bool:
+    return member.type == "string" and member.name in INTERNED_FIELDS
+
+
+def interned_types(types: Dict[str, LcmStruct]) -> Set[str]:
+    """Types with an interned flavor: those with an interned string field, and
+    those nesting such a type."""
+    return _nesting_closure(types, is_interned)
+
+
+def columns_types(types: Dict[str, LcmStruct]) -> Set[str]:
+    """Element types of the columnar members, which get a *Columns class."""
+    return {
+        member.type
+        for struct in types.values()
+        for member in struct.members
+        if not member.is_primitive and is_columnar(member, types)
+    }
+
+
+# Suffix of the generated column storage classes, e.g. PointColumns
+COLUMNS_SUFFIX = "Columns"
+
+# Suffix of the generated zero-copy view classes, e.g. ImageView
+VIEW_SUFFIX = "View"
+
+# Message header type; types that hold one at a fixed offset get peekHeader()
+HEADER_TYPE = "std_msgs.Header"
+
+
+def header_offset(struct: LcmStruct, types: Dict[str, LcmStruct]) -> Optional[Tuple[str, int]]:
+    """Name and encoded offset (after the 8-byte hash) of the struct's
+    std_msgs.Header member, or None if it has none or the fields before it
+    are not fixed-size."""
+    offset = 0
+    for member in struct.members:
+        if member.type == HEADER_TYPE and not member.is_array:
+            return member.name, offset
+        if member.is_variable_array or member.type == "string":
+            return None
+        count = 1
+        for dim in member.dimensions:
+            count *= int(dim.size)
+        if member.is_primitive:
+            offset += count * PRIMITIVE_SIZES[member.type]
+        elif is_plain(types[member.type], types):
+            offset += count * fixed_encoded_size(types[member.type], types)
+        else:
+            return None
+    return None
+
+
+def is_byte_payload(member: LcmMember) -> bool:
+    """True for a variable-length byte or int8_t array."""
+    return member.type in ("byte", "int8_t") and member.is_variable_array
+
+
+def has_byte_payload(struct: LcmStruct) -> bool:
+    """True if the struct has a variable-length byte or int8_t array."""
+    return any(is_byte_payload(m) for m in struct.members)
+
+
+def carries_byte_payload(struct: LcmStruct, types: Dict[str, LcmStruct]) -> bool:
+    """True if the struct or any struct nested in it has a byte payload."""
+    if has_byte_payload(struct):
+        return True
+    return any(
+        not m.is_primitive and m.type != struct.full_name and carries_byte_payload(types[m.type], types)
+        for m in struct.members
+    )
+
+
+def cow_types(types: Dict[str, LcmStruct]) -> Set[str]:
+    """Types with a copy-on-write flavor: those carrying a byte payload."""
+    return {name for name, struct in types.items() if carries_byte_payload(struct, types)}
+
+
+class Emitter:
+    """Accumulates generated lines; each indent level is four spaces."""
+
+    def __init__(self):
+        self.lines: List[str] = []
+
+    def emit(self, indent: int, text: str = "") -> None:
+        self.lines.append(("    " * indent + text) if text else "")
+
+    def text(self) -> str:
+        return "\n".join(self.lines) + "\n"
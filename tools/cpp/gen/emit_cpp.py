@@ -0,0 +1,1231 @@
+"""
+Emits the C++ message classes in generated/cpp_lcm_msgs.
+
+This is a port of lcm-gen's emit_cpp.c (1.5.2, --cpp-std=c++98 output), so
+the classes keep the exact API and wire format the rest of our C++ code and
+the upstream lcm::LCM templates expect. Owning the emitter lets us change the
+generated encode/decode paths, which lcm-gen gives no hook for.
+
+Differences from lcm-gen output:
+- arrays of multi-byte primitives are encoded/decoded with the SIMD kernels
+  in dimos_lcm/bulk_codec.hpp instead of the per-byte lcm_coretypes.h loops
+- variable-length byte/int8_t/boolean arrays are decoded with assign() from
+  the buffer, so the payload is written once instead of zeroed by resize()
+  and then overwritten
+- getHash() returns the constant kHash, whose value the header checks with a
+  static_assert, instead of computing _computeHash() into a function-local
+  static on first use
+- types without strings or variable-length arrays declare kEncodedSize and
+  encode/decode with a single length check followed by stores/loads at
+  constant offsets (dimos_lcm/fixed_codec.hpp), nested structs included
+- encodeTo() appends a message to a std::vector in a single walk over it,
+  through the generated _writeNoHash() and dimos_lcm/writer.hpp
+- types with a std_msgs.Header at a fixed offset get a static peekHeader()
+  that decodes just the header into a std_msgs::HeaderView
+- types that carry a byte payload, directly or in a nested struct, also get
+  encodeIov(), which writes into a dimos_lcm::iov_writer and references the
+  payload instead of copying it, and encodeInPlace(), which writes into a
+  caller-provided buffer through a dimos_lcm::wire_builder and leaves the
+  payload for the caller to fill in place
+- decode() checks every variable array length against the remaining bytes,
+  and against the type's maxArrayLength, before allocating the array, and
+  rejects strings with a length below 1, so corrupt input fails without
+  allocating instead of resizing to whatever length it claims
+- types with strings or variable-length arrays get decodeFields<Mask>(), which
+  skips unselected top-level fields by their length prefixes; every type gets
+  a static _skipNoHash() for this
+- every type describes its fields in a constexpr kFields array and can be
+  visited field by field with dimos_lcm::for_each_field()
+  (dimos_lcm/reflection.hpp)
+
+emit_pmr() emits a std::pmr flavor of each type in the package's pmr
+namespace, with std::pmr::string/vector members and allocator-extended
+constructors, so a message tree can be decoded into a memory_resource arena.
+
+emit_soa() emits a structure-of-arrays flavor, in the soa namespace, of each
+type holding arrays of flat float/double structs (poses, points, colors): those
+arrays become the <Element>Columns classes from emit_soa.py, decoded straight
+into one vector per field.
+
+emit_cow() emits a copy-on-write flavor, in the cow namespace, of each type
+carrying a byte payload: the payload is a dimos_lcm::cow_array, so copies of
+an Image or PointCloud2 share one buffer until one of them writes to it.
+
+emit_interned() emits an interned flavor, in the interned namespace, of each
+type with identifier strings (frame ids, joint and hardware names) or nesting
+one: those strings are dimos_lcm::interned_strings, so decoding a known id does
+not allocate and comparing two of them is a pointer compare.
+"""
+
+from typing import Callable, Dict, List, Set
+
+from cpp_util import (
+    BANNER,
+    COLUMNS_SUFFIX,
+    COW_NAMESPACE,
+    HEADER_TYPE,
+    INTERNED_NAMESPACE,
+    PMR_NAMESPACE,
+    SOA_NAMESPACE,
+    VIEW_SUFFIX,
+    Emitter,
+    carries_byte_payload,
+    cow_types,
+    fixed_encoded_size,
+    coretypes_prefix,
+    cpp_type,
+    dim_size,
+    guard_name,
+    header_offset,
+    flavor_name,
+    header_path,
+    interned_types,
+    is_byte_payload,
+    is_columnar,
+    is_interned,
+    is_plain,
+    min_encoded_size,
+    pmr_cpp_type,
+    pmr_name,
+    soa_types,
+)
+from lcm_parser import PRIMITIVE_SIZES, LcmMember, LcmStruct, compute_fingerprint
+
+_METHOD_DECLS = """\
+    public:
+{ctor_decl}        /**
+         * Encode a message into binary form.
+         *
+         * @param buf The output buffer.
+         * @param offset Encoding starts at thie byte offset into @p buf.
+         * @param maxlen Maximum number of bytes to write.  This should generally be
+         *  equal to getEncodedSize().
+         * @return The number of bytes encoded, or <0 on error.
+         */
+        inline int encode(void *buf, int offset, int maxlen) const;
+
+        /**
+         * Encode a message by appending it to @p buf, walking the message once
+         * instead of sizing it with getEncodedSize() first. @p buf grows
+         * geometrically; reuse it across calls to avoid reallocating.
+         *
+         * @return The number of bytes appended.
+         */
+        inline int encodeTo(std::vector<uint8_t> &buf) const;
+{iov_decl}
+        /**
+         * Check how many bytes are required to encode this message.
+         */
+        inline int getEncodedSize() const;
+{size_decl}
+        /**
+         * Decode a message from binary form into this instance.
+         *
+         * @param buf The buffer containing the encoded message.
+         * @param offset The byte offset into @p buf where the encoded message starts.
+         * @param maxlen The maximum number of bytes to read while decoding.
+         * @return The number of bytes decoded, or <0 if an error occured.
+         */
+        inline int decode(const void *buf, int offset, int maxlen);
+{peek_decl}{fields_decl}{limit_decl}
+        /**
+         * Retrieve the 64-bit fingerprint identifying the structure of the message.
+         * Note that the fingerprint is the same for all instances of the same
+         * message type, and is a fingerprint on the message type definition, not on
+         * the message contents.
+         */
+        inline static int64_t getHash();
+
+        /**
+         * The fingerprint returned by getHash(), as a compile-time constant.
+         */
+        static constexpr int64_t kHash = static_cast<int64_t>(0x{fingerprint:016x}ULL);
+
+        /**
+         * Returns "{name}"
+         */
+        inline static const char* getTypeName();
+
+        /**
+         * Name, LCM type and array dimensions of each field, in wire order.
+         * See dimos_lcm::for_each_field() for visiting the fields themselves.
+         */
+        static constexpr std::array<dimos_lcm::field_info, {field_count}> kFields = {{{{
+{field_infos}        }}}};
+
+        // LCM support functions. Users should not call these
+        inline int _encodeNoHash(void *buf, int offset, int maxlen) const;
+        template <typename Writer>
+        inline void _writeNoHash(Writer &out) const;
+        inline int _getEncodedSizeNoHash() const;
+        inline int _decodeNoHash(const void *buf, int offset, int maxlen);
+{fields_support_decl}        template <typename Self, typename Visitor>
+        inline static void _forEachField(Self &self, Visitor &visitor);
+        inline static int _skipNoHash(const void *buf, int offset, int maxlen);
+        inline static uint64_t _computeHash(const __lcm_hash_ptr *p);
+}};
+"""
+
+_METHOD_DEFS = """\
+{ctor_def}int {name}::encode(void *buf, int offset, int maxlen) const
+{{
+    int pos = 0, tlen;
+    int64_t hash = getHash();
+
+    tlen = __int64_t_encode_array(buf, offset + pos, maxlen - pos, &hash, 1);
+    if(tlen < 0) return tlen; else pos += tlen;
+
+    tlen = this->_encodeNoHash(buf, offset + pos, maxlen - pos);
+    if (tlen < 0) return tlen; else pos += tlen;
+
+    return pos;
+}}
+
+int {name}::encodeTo(std::vector<uint8_t> &buf) const
+{{
+    dimos_lcm::vector_writer out(buf);
+    int64_t hash = getHash();
+    out.put(&hash, 1);
+    this->_writeNoHash(out);
+    return static_cast<int>(out.size());
+}}
+{iov_def}
+int {name}::decode(const void *buf, int offset, int maxlen)
+{{
+    int pos = 0, thislen;
+
+    int64_t msg_hash;
+    thislen = __int64_t_decode_array(buf, offset + pos, maxlen - pos, &msg_hash, 1);
+    if (thislen < 0) return thislen; else pos += thislen;
+    if (msg_hash != getHash()) return -1;
+
+    thislen = this->_decodeNoHash(buf, offset + pos, maxlen - pos);
+    if (thislen < 0) return thislen; else pos += thislen;
+
+    return pos;
+}}
+{peek_def}{fields_def}
+int {name}::getEncodedSize() const
+{{
+    return 8 + _getEncodedSizeNoHash();
+}}
+
+int64_t {name}::getHash()
+{{
+    return kHash;
+}}
+
+const char* {name}::getTypeName()
+{{
+    return "{name}";
+}}
+"""
+
+_PMR_CTOR_DECL = """\
+        typedef std::pmr::polymorphic_allocator<char> allocator_type;
+
+        /**
+         * Construct a message whose strings and arrays, and those of the
+         * messages it nests, allocate from @p alloc. Scalars are zeroed.
+         */
+        inline explicit {name}(const allocator_type &alloc = allocator_type());
+
+        /**
+         * Copy or move @p other into a message that allocates from @p alloc.
+         * With allocator_type, these let std::pmr containers of {name} pass
+         * their memory resource on to their elements.
+         */
+        inline {name}(const {name} &other, const allocator_type &alloc);
+        inline {name}({name} &&other, const allocator_type &alloc);
+
+"""
+
+_PMR_CTOR_DEF = """\
+{name}::{name}(const allocator_type &alloc) :
+{inits}
+{{
+}}
+
+{name}::{name}(const {name} &other, const allocator_type &alloc) :
+    {name}(alloc)
+{{
+    *this = other;
+}}
+
+{name}::{name}({name} &&other, const allocator_type &alloc) :
+    {name}(alloc)
+{{
+    *this = std::move(other);
+}}
+
+"""
+
+_PMR_ALIAS = """\
+#include "{header}"
+
+namespace {package}
+{{
+namespace pmr
+{{
+
+// {name} has no strings or variable-length arrays, so it never allocates
+typedef {type} {name};
+
+}}
+}}
+"""
+
+_IOV_DECL = """
+        /**
+         * Encode a message as a list of buffers for writev()/sendmsg(). Byte
+         * payloads are referenced in place instead of copied; see
+         * dimos_lcm/iov_writer.hpp for how long they must stay valid.
+         *
+         * @param out Receives the encoded message after anything it already holds.
+         * @return The number of bytes encoded.
+         */
+        inline int encodeIov(dimos_lcm::iov_writer &out) const;
+
+        /**
+         * Encode a message into the buffer of @p out, leaving a gap at the
+         * place of each byte payload for the caller to fill; see
+         * dimos_lcm/wire_builder.hpp. The payload arrays are not read: set
+         * their length fields, and leave the arrays empty to skip filling them
+         * twice.
+         *
+         * @param out Receives the encoded message after anything it already holds.
+         * @return The number of bytes encoded, or <0 if they do not fit.
+         */
+        inline int encodeInPlace(dimos_lcm::wire_builder &out) const;
+"""
+
+_LIMIT_DECL = """
+        /**
+         * Upper bound on the length of every variable-length array of this
+         * type, checked by decode() before anything is allocated; messages
+         * exceeding it fail to decode. It does not apply to nested types,
+         * which have their own. Set it once at startup, before decoding.
+         * Before C++17 it is a constant with no limit.
+         */
+#if __cplusplus >= 201703L
+        static inline int32_t maxArrayLength = INT32_MAX;
+#else
+        static constexpr int32_t maxArrayLength = INT32_MAX;
+#endif
+"""
+
+_SIZE_DECL = """
+        /**
+         * getEncodedSize() of every instance: the type has no strings or
+         * variable-length arrays.
+         */
+        static constexpr int kEncodedSize = {size};
+"""
+
+_IOV_DEF = """
+int {name}::encodeIov(dimos_lcm::iov_writer &out) const
+{{
+    size_t start = out.size();
+    int64_t hash = getHash();
+    out.put(&hash, 1);
+    this->_writeNoHash(out);
+    return static_cast<int>(out.size() - start);
+}}
+
+int {name}::encodeInPlace(dimos_lcm::wire_builder &out) const
+{{
+    int size = getEncodedSize();
+    if (static_cast<size_t>(size) > out.remaining())
+        return -1;
+    int64_t hash = getHash();
+    out.put(&hash, 1);
+    this->_writeNoHash(out);
+    return size;
+}}
+"""
+
+_PEEK_DECL = """
+#if __cplusplus >= 201703L
+        /**
+         * Decode only the {member} field of an encoded message, leaving the
+         * rest of it untouched. The field sits at a fixed offset, so this costs
+         * the same for any payload size. The view points into @p buf.
+         *
+         * @param buf The buffer containing the encoded message.
+         * @param offset The byte offset into @p buf where the encoded message starts.
+         * @param maxlen The maximum number of bytes to read while decoding.
+         * @param {member} Receives the decoded header.
+         * @return The number of bytes of the field decoded, or <0 if @p buf does
+         *  not hold a {name} or is truncated.
+         *
+         * Needs C++17, for the std::string_view of the view.
+         */
+        inline static int peekHeader(const void *buf, int offset, int maxlen, {view} &{member});
+#endif
+"""
+
+_PEEK_DEF = """
+#if __cplusplus >= 201703L
+int {name}::peekHeader(const void *buf, int offset, int maxlen, {view} &{member})
+{{
+    int64_t msg_hash;
+    if (__int64_t_decode_array(buf, offset, maxlen, &msg_hash, 1) < 0) return -1;
+    if (msg_hash != kHash) return -1;
+
+    // {member} follows the hash and {fixed} bytes of fixed-size fields
+    return {member}._decodeNoHash(buf, offset + {start}, maxlen - {start});
+}}
+#endif
+"""
+
+_FIELDS_DECL = """
+        /**
+         * Field bits for decodeFields().
+         */
+        struct Fields
+        {{
+{constants}
+        }};
+
+        /**
+         * Decode only the fields selected by @p Mask, a bitwise or of Fields
+         * values. Strings, arrays and nested structs that are not selected are
+         * skipped over by their length prefixes without being allocated, and
+         * keep their previous value. Scalar fields are always decoded: they
+         * cost nothing to read and array lengths depend on them.
+         *
+         * @return The number of bytes decoded, or <0 if an error occured.
+         */
+        template <uint64_t Mask>
+        inline int decodeFields(const void *buf, int offset, int maxlen);
+"""
+
+_FIELDS_SUPPORT_DECL = """\
+        template <uint64_t Mask>
+        inline int _decodeFieldsNoHash(const void *buf, int offset, int maxlen);
+"""
+
+_FIELDS_DEF = """
+template <uint64_t Mask>
+int {name}::decodeFields(const void *buf, int offset, int maxlen)
+{{
+    int pos = 0, thislen;
+
+    int64_t msg_hash;
+    thislen = __int64_t_decode_array(buf, offset + pos, maxlen - pos, &msg_hash, 1);
+    if (thislen < 0) return thislen; else pos += thislen;
+    if (msg_hash != getHash()) return -1;
+
+    thislen = this->_decodeFieldsNoHash<Mask>(buf, offset + pos, maxlen - pos);
+    if (thislen < 0) return thislen; else pos += thislen;
+
+    return pos;
+}}
+"""
+
+_CONSTANT_NOTE = """\
+        // If you're using C++11 and are getting compiler errors saying
+        // things like ‘constexpr’ needed for in-class initialization of
+        // static data member then re-run lcm-gen with '--cpp-std=c++11'
+        // to generate code that is compliant with C++11"""
+
+
+def _is_string(member: LcmMember) -> bool:
+    return member.type == "string"
+
+
+def _uses_bulk_codec(member: LcmMember) -> bool:
+    """Arrays of multi-byte primitives go through dimos_lcm/bulk_codec.hpp."""
+    return member.is_array and PRIMITIVE_SIZES.get(member.type, 1) > 1
+
+
+def _array_codec(member: LcmMember) -> str:
+    """Name stem of the function that encodes/decodes a primitive array member."""
+    if _uses_bulk_codec(member):
+        return "dimos_lcm::bulk"
+    return coretypes_prefix(member.type)
+
+
+def _emit_member_decl(
+    e: Emitter,
+    member: LcmMember,
+    pmr: bool,
+    type_name: Callable[[str], str],
+    columns: bool,
+    payload: bool,
+    interned: bool,
+) -> None:
+    if member.is_array:
+        lcm_type = member.type + "".join(f"[{d.size}]" for d in member.dimensions)
+        e.emit(2, "/**")
+        e.emit(2, f" * LCM Type: {lcm_type}")
+        e.emit(2, " */")
+    if columns:
+        e.emit(2, f"{cpp_type(member.type) + COLUMNS_SUFFIX:<10} {member.name};")
+        e.emit(0)
+        return
+    if payload:
+        e.emit(2, f"dimos_lcm::cow_array< {cpp_type(member.type)} > {member.name};")
+        e.emit(0)
+        return
+    decl = "dimos_lcm::interned_string" if interned else type_name(member.type)
+    vector = "std::pmr::vector" if pmr else "std::vector"
+    suffix = ""
+    for dim in reversed(member.dimensions):
+        if dim.is_constant:
+            suffix = f"[{dim.size}]" + suffix
+        else:
+            decl = f"{vector}< {decl} >"
+    e.emit(2, f"{decl:<10} {member.name}{suffix};")
+    e.emit(0)
+
+
+def _emit_encode_member(e: Emitter, member: LcmMember, columns: bool = False) -> None:
+    name = member.name
+    if columns:
+        e.emit(1, f"tlen = this->{name}._encodeNoHash(buf, offset + pos, maxlen - pos, {dim_size(member)});")
+        e.emit(1, "if(tlen < 0) return tlen; else pos += tlen;")
+        e.emit(0)
+        return
+    if not member.is_array:
+        if _is_string(member):
+            e.emit(1, f"char* {name}_cstr = const_cast<char*>(this->{name}.c_str());")
+            e.emit(1, "tlen = __string_encode_array(")
+            e.emit(2, f"buf, offset + pos, maxlen - pos, &{name}_cstr, 1);")
+        elif member.is_primitive:
+            e.emit(1, f"tlen = {coretypes_prefix(member.type)}_encode_array(buf, offset + pos, maxlen - pos, &this->{name}, 1);")
+        else:
+            e.emit(1, f"tlen = this->{name}._encodeNoHash(buf, offset + pos, maxlen - pos);")
+        e.emit(1, "if(tlen < 0) return tlen; else pos += tlen;")
+        e.emit(0)
+        return
+
+    size = dim_size(member)
+    if member.is_primitive and not _is_string(member):
+        if member.is_variable_array:
+            e.emit(1, f"if({size} > 0) {{")
+            e.emit(2, f"tlen = {_array_codec(member)}_encode_array(buf, offset + pos, maxlen - pos, &this->{name}[0], {size});")
+            e.emit(2, "if(tlen < 0) return tlen; else pos += tlen;")
+            e.emit(1, "}")
+        else:
+            e.emit(1, f"tlen = {_array_codec(member)}_encode_array(buf, offset + pos, maxlen - pos, &this->{name}[0], {size});")
+            e.emit(1, "if(tlen < 0) return tlen; else pos += tlen;")
+        e.emit(0)
+        return
+
+    e.emit(1, f"for (int a0 = 0; a0 < {size}; a0++) {{")
+    if _is_string(member):
+        e.emit(2, f"char* __cstr = const_cast<char*>(this->{name}[a0].c_str());")
+        e.emit(2, "tlen = __string_encode_array(")
+        e.emit(3, "buf, offset + pos, maxlen - pos, &__cstr, 1);")
+    else:
+        e.emit(2, f"tlen = this->{name}[a0]._encodeNoHash(buf, offset + pos, maxlen - pos);")
+    e.emit(2, "if(tlen < 0) return tlen; else pos += tlen;")
+    e.emit(1, "}")
+    e.emit(0)
+
+
+def _emit_write_member(e: Emitter, member: LcmMember, types: Dict[str, LcmStruct], columns: bool = False) -> None:
+    name = member.name
+    if columns:
+        e.emit(1, f"this->{name}._writeNoHash(out, {dim_size(member)});")
+        return
+    if not member.is_primitive:
+        if member.is_array and is_plain(types[member.type], types):
+            size = dim_size(member)
+            if member.is_variable_array:
+                e.emit(1, f"if({size} > 0)")
+                e.emit(2, f"out.putStructArray(&this->{name}[0], {size});")
+            else:
+                e.emit(1, f"out.putStructArray(&this->{name}[0], {size});")
+        elif member.is_array:
+            e.emit(1, f"for (int a0 = 0; a0 < {dim_size(member)}; a0++)")
+            e.emit(2, f"this->{name}[a0]._writeNoHash(out);")
+        else:
+            e.emit(1, f"this->{name}._writeNoHash(out);")
+    elif _is_string(member):
+        if member.is_array:
+            e.emit(1, f"for (int a0 = 0; a0 < {dim_size(member)}; a0++)")
+            e.emit(2, f"out.put(this->{name}[a0]);")
+        else:
+            e.emit(1, f"out.put(this->{name});")
+    elif not member.is_array:
+        e.emit(1, f"out.put(&this->{name}, 1);")
+    elif member.is_variable_array:
+        size = dim_size(member)
+        e.emit(1, f"if({size} > 0)")
+        if PRIMITIVE_SIZES[member.type] == 1:
+            e.emit(2, f"out.reference(this->{name}.data(), {size});")
+        else:
+            e.emit(2, f"out.put(&this->{name}[0], {size});")
+    else:
+        e.emit(1, f"out.put(&this->{name}[0], {dim_size(member)});")
+
+
+def _fixed_fields(struct: LcmStruct, types: Dict[str, LcmStruct], path: str = "this->", offset: int = 0):
+    """(lvalue, byte offset, element count or None for a scalar) of each
+    primitive in a plain struct, with nested structs flattened."""
+    fields = []
+    for member in struct.members:
+        count = 1
+        for dim in member.dimensions:
+            count *= int(dim.size)
+        if member.is_primitive:
+            if member.is_array:
+                fields.append((f"&{path}{member.name}" + "[0]" * len(member.dimensions), offset, count))
+            else:
+                fields.append((f"{path}{member.name}", offset, None))
+            offset += count * PRIMITIVE_SIZES[member.type]
+            continue
+        nested = types[member.type]
+        elements = [f"{path}{member.name}."] if not member.is_array else [
+            f"{path}{member.name}[{i}]." for i in range(count)]
+        for elem_path in elements:
+            fields.extend(_fixed_fields(nested, types, elem_path, offset))
+            offset += fixed_encoded_size(nested, types)
+    return fields
+
+
+def _emit_fixed_codec(e: Emitter, struct: LcmStruct, types: Dict[str, LcmStruct]) -> None:
+    """Encoder and decoder of a plain struct: one length check, then every
+    field at a constant offset."""
+    fields = _fixed_fields(struct, types)
+    name = struct.name
+    e.emit(0, f"int {name}::_encodeNoHash(void *buf, int offset, int maxlen) const")
+    e.emit(0, "{")
+    e.emit(1, "if(maxlen < kEncodedSize - 8) return -1;")
+    e.emit(1, "uint8_t *p = static_cast<uint8_t*>(buf) + offset;")
+    for lvalue, field_offset, count in fields:
+        if count is None:
+            e.emit(1, f"dimos_lcm::store_be(p + {field_offset}, {lvalue});")
+        else:
+            e.emit(1, f"dimos_lcm::store_be_array(p + {field_offset}, {lvalue}, {count});")
+    e.emit(1, "return kEncodedSize - 8;")
+    e.emit(0, "}")
+    e.emit(0)
+    e.emit(0, "template <typename Writer>")
+    e.emit(0, f"void {name}::_writeNoHash(Writer &out) const")
+    e.emit(0, "{")
+    e.emit(1, "out.putStruct(*this);")
+    e.emit(0, "}")
+    e.emit(0)
+    e.emit(0, f"int {name}::_decodeNoHash(const void *buf, int offset, int maxlen)")
+    e.emit(0, "{")
+    e.emit(1, "if(maxlen < kEncodedSize - 8) return -1;")
+    e.emit(1, "const uint8_t *p = static_cast<const uint8_t*>(buf) + offset;")
+    for lvalue, field_offset, count in fields:
+        if count is None:
+            e.emit(1, f"dimos_lcm::load_be(p + {field_offset}, {lvalue});")
+        else:
+            e.emit(1, f"dimos_lcm::load_be_array(p + {field_offset}, {lvalue}, {count});")
+    e.emit(1, "return kEncodedSize - 8;")
+    e.emit(0, "}")
+    e.emit(0)
+    e.emit(0, f"int {name}::_getEncodedSizeNoHash() const")
+    e.emit(0, "{")
+    e.emit(1, "return kEncodedSize - 8;")
+    e.emit(0, "}")
+    e.emit(0)
+
+
+def _length_check(size: str, element_size: int) -> str:
+    """Condition rejecting a variable array length before it is allocated: the
+    length must be non-negative, within maxArrayLength and leave at least
+    @p element_size bytes per element in the buffer."""
+    checks = [f"{size} < 0"]
+    if element_size == 1:
+        checks.append(f"{size} > maxlen - pos")
+    elif element_size > 1:
+        checks.append(f"{size} > (maxlen - pos) / {element_size}")
+    checks.append(f"{size} > maxArrayLength")
+    return " || ".join(checks)
+
+
+def _emit_decode_member(e: Emitter, member: LcmMember, types: Dict[str, LcmStruct], columns: bool = False) -> None:
+    name = member.name
+    if columns:
+        size = dim_size(member)
+        e.emit(1, f"if({_length_check(size, min_encoded_size(types[member.type], types))}) return -1;")
+        e.emit(1, f"tlen = this->{name}._decodeNoHash(buf, offset + pos, maxlen - pos, {size});")
+        e.emit(1, "if(tlen < 0) return tlen; else pos += tlen;")
+        e.emit(0)
+        return
+    if not member.is_array:
+        if _is_string(member):
+            e.emit(1, f"int32_t __{name}_len__;")
+            e.emit(1, "tlen = __int32_t_decode_array(")
+            e.emit(2, f"buf, offset + pos, maxlen - pos, &__{name}_len__, 1);")
+            e.emit(1, "if(tlen < 0) return tlen; else pos += tlen;")
+            e.emit(1, f"if(__{name}_len__ < 1 || __{name}_len__ > maxlen - pos) return -1;")
+            e.emit(1, f"this->{name}.assign(")
+            e.emit(2, f"static_cast<const char*>(buf) + offset + pos, __{name}_len__ - 1);")
+            e.emit(1, f"pos += __{name}_len__;")
+        elif member.is_primitive:
+            e.emit(1, f"tlen = {coretypes_prefix(member.type)}_decode_array(buf, offset + pos, maxlen - pos, &this->{name}, 1);")
+            e.emit(1, "if(tlen < 0) return tlen; else pos += tlen;")
+        else:
+            e.emit(1, f"tlen = this->{name}._decodeNoHash(buf, offset + pos, maxlen - pos);")
+            e.emit(1, "if(tlen < 0) return tlen; else pos += tlen;")
+        e.emit(0)
+        return
+
+    size = dim_size(member)
+    if member.is_primitive and not _is_string(member):
+        if member.is_variable_array and PRIMITIVE_SIZES[member.type] == 1:
+            # Copy straight from the buffer: resize() would zero the payload first
+            elem = cpp_type(member.type)
+            e.emit(1, f"if({size}) {{")
+            e.emit(2, f"if({_length_check(size, 1)}) return -1;")
+            e.emit(2, f"const {elem} *__{name}_src__ = static_cast<const {elem}*>(buf) + offset + pos;")
+            e.emit(2, f"this->{name}.assign(__{name}_src__, __{name}_src__ + {size});")
+            e.emit(2, f"pos += {size};")
+            e.emit(1, "} else {")
+            # Drop the previous payload of a reused message
+            e.emit(2, f"this->{name}.clear();")
+            e.emit(1, "}")
+        elif member.is_variable_array:
+            e.emit(1, f"if({size}) {{")
+            e.emit(2, f"if({_length_check(size, PRIMITIVE_SIZES[member.type])}) return -1;")
+            e.emit(2, f"this->{name}.resize({size});")
+            e.emit(2, f"tlen = {_array_codec(member)}_decode_array(buf, offset + pos, maxlen - pos, &this->{name}[0], {size});")
+            e.emit(2, "if(tlen < 0) return tlen; else pos += tlen;")
+            e.emit(1, "} else {")
+            e.emit(2, f"this->{name}.clear();")
+            e.emit(1, "}")
+        else:
+            e.emit(1, f"tlen = {_array_codec(member)}_decode_array(buf, offset + pos, maxlen - pos, &this->{name}[0], {size});")
+            e.emit(1, "if(tlen < 0) return tlen; else pos += tlen;")
+        e.emit(0)
+        return
+
+    if member.is_variable_array:
+        if _is_string(member):
+            element_size = 5
+        else:
+            element_size = min_encoded_size(types[member.type], types)
+        e.emit(1, f"if({_length_check(size, element_size)}) return -1;")
+        e.emit(1, "try {")
+        e.emit(2, f"this->{name}.resize({size});")
+        e.emit(1, "} catch (...) {")
+        e.emit(2, "return -1;")
+        e.emit(1, "}")
+    e.emit(1, f"for (int a0 = 0; a0 < {size}; a0++) {{")
+    if _is_string(member):
+        e.emit(2, "int32_t __elem_len;")
+        e.emit(2, "tlen = __int32_t_decode_array(")
+        e.emit(3, "buf, offset + pos, maxlen - pos, &__elem_len, 1);")
+        e.emit(2, "if(tlen < 0) return tlen; else pos += tlen;")
+        e.emit(2, "if(__elem_len < 1 || __elem_len > maxlen - pos) return -1;")
+        e.emit(2, f"this->{name}[a0].assign(static_cast<const char*>(buf) + offset + pos, __elem_len -  1);")
+        e.emit(2, "pos += __elem_len;")
+    else:
+        e.emit(2, f"tlen = this->{name}[a0]._decodeNoHash(buf, offset + pos, maxlen - pos);")
+        e.emit(2, "if(tlen < 0) return tlen; else pos += tlen;")
+    e.emit(1, "}")
+    e.emit(0)
+
+
+def _field_constants(struct: LcmStruct) -> str:
+    lines = [
+        f"            static constexpr uint64_t {m.name} = 1ULL << {i};" for i, m in enumerate(struct.members)
+    ]
+    lines.append(f"            static constexpr uint64_t all = (1ULL << {len(struct.members)}) - 1;")
+    return "\n".join(lines)
+
+
+def _field_info(member: LcmMember) -> str:
+    """Initializer of the dimos_lcm::field_info of a member in kFields."""
+    if not member.is_array:
+        size, length = "0", "NULL"
+    elif member.dimensions[0].is_constant:
+        size, length = member.dimensions[0].size, "NULL"
+    else:
+        size, length = "-1", f'"{member.dimensions[0].size}"'
+    primitive = "true" if member.is_primitive else "false"
+    return f'{{ "{member.name}", "{member.type}", {primitive}, {len(member.dimensions)}, {size}, {length} }}'
+
+
+def _emit_for_each_field(e: Emitter, struct: LcmStruct) -> None:
+    """_forEachField(), which dimos_lcm::for_each_field() calls with a const or
+    non-const message as @p self."""
+    e.emit(0, "template <typename Self, typename Visitor>")
+    if not struct.members:
+        e.emit(0, f"void {struct.name}::_forEachField(Self &, Visitor &)")
+        e.emit(0, "{")
+        e.emit(0, "}")
+        e.emit(0)
+        return
+    e.emit(0, f"void {struct.name}::_forEachField(Self &self, Visitor &visitor)")
+    e.emit(0, "{")
+    for i, member in enumerate(struct.members):
+        e.emit(1, f"visitor(kFields[{i}], self.{member.name});")
+    e.emit(0, "}")
+    e.emit(0)
+
+
+def _is_scalar(member: LcmMember) -> bool:
+    return member.is_primitive and not member.is_array and not _is_string(member)
+
+
+def _emit_skip_member(
+    e: Emitter, indent: int, member: LcmMember, owner: str, type_name: Callable[[str], str] = cpp_type
+) -> None:
+    """Advance pos past a string, array or nested struct without decoding it.
+    Array lengths are read from @p owner ("this->" or "" for locals)."""
+    name = member.name
+    count = dim_size(member, owner=owner) if member.is_array else None
+    if member.is_primitive and not _is_string(member):
+        width = PRIMITIVE_SIZES[member.type]
+        if not member.is_variable_array:
+            e.emit(indent, f"pos += {int(count) * width};")
+            return
+        nbytes = count if width == 1 else f"{count} * {width}"
+        limit = "maxlen - pos" if width == 1 else f"(maxlen - pos) / {width}"
+        e.emit(indent, f"if({count} < 0 || {count} > {limit}) return -1;")
+        e.emit(indent, f"pos += {nbytes};")
+        return
+    if member.is_array:
+        if member.is_variable_array:
+            e.emit(indent, f"if({count} < 0) return -1;")
+        e.emit(indent, f"for (int a0 = 0; a0 < {count}; a0++) {{")
+        indent += 1
+    if _is_string(member):
+        length = f"__{name}_len__"
+        e.emit(indent, f"int32_t {length};")
+        e.emit(indent, f"tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &{length}, 1);")
+        e.emit(indent, "if(tlen < 0) return tlen; else pos += tlen;")
+        e.emit(indent, f"if({length} < 0 || {length} > maxlen - pos) return -1;")
+        e.emit(indent, f"pos += {length};")
+    else:
+        e.emit(indent, f"tlen = {type_name(member.type)}::_skipNoHash(buf, offset + pos, maxlen - pos);")
+        e.emit(indent, "if(tlen < 0) return tlen; else pos += tlen;")
+    if member.is_array:
+        e.emit(indent - 1, "}")
+
+
+def _emit_skip(e: Emitter, struct: LcmStruct, plain: bool, type_name: Callable[[str], str]) -> None:
+    name = struct.name
+    if not struct.members:
+        e.emit(0, f"int {name}::_skipNoHash(const void *, int, int)")
+        e.emit(0, "{")
+        e.emit(1, "return 0;")
+        e.emit(0, "}")
+        e.emit(0)
+        return
+    if plain:
+        e.emit(0, f"int {name}::_skipNoHash(const void *, int, int maxlen)")
+        e.emit(0, "{")
+        e.emit(1, "return maxlen < kEncodedSize - 8 ? -1 : kEncodedSize - 8;")
+        e.emit(0, "}")
+        e.emit(0)
+        return
+    lengths = {d.size for m in struct.members for d in m.dimensions if not d.is_constant}
+    e.emit(0, f"int {name}::_skipNoHash(const void *buf, int offset, int maxlen)")
+    e.emit(0, "{")
+    e.emit(1, "int pos = 0, tlen;")
+    for member in struct.members:
+        if not _is_scalar(member):
+            _emit_skip_member(e, 1, member, "", type_name)
+        elif member.name in lengths:
+            e.emit(1, f"{cpp_type(member.type)} {member.name};")
+            e.emit(1, f"tlen = {coretypes_prefix(member.type)}_decode_array(buf, offset + pos, maxlen - pos, &{member.name}, 1);")
+            e.emit(1, "if(tlen < 0) return tlen; else pos += tlen;")
+        else:
+            e.emit(1, f"pos += {PRIMITIVE_SIZES[member.type]};")
+    e.emit(1, "if(pos > maxlen) return -1;")
+    e.emit(1, "return pos;")
+    e.emit(0, "}")
+    e.emit(0)
+
+
+def _emit_decode_fields(
+    e: Emitter, struct: LcmStruct, types: Dict[str, LcmStruct], type_name: Callable[[str], str], columnar: Set[str]
+) -> None:
+    e.emit(0, "template <uint64_t Mask>")
+    e.emit(0, f"int {struct.name}::_decodeFieldsNoHash(const void *buf, int offset, int maxlen)")
+    e.emit(0, "{")
+    e.emit(1, "int pos = 0, tlen;")
+    e.emit(0)
+    for member in struct.members:
+        if _is_scalar(member):
+            _emit_decode_member(e, member, types)
+            continue
+        e.emit(1, f"if ((Mask & Fields::{member.name}) != 0) {{")
+        body = Emitter()
+        _emit_decode_member(body, member, types, member.name in columnar)
+        e.lines.extend(("    " + line) if line else line for line in body.lines[:-1])
+        e.emit(1, "} else {")
+        _emit_skip_member(e, 2, member, "this->", type_name)
+        e.emit(1, "}")
+        e.emit(0)
+    e.emit(1, "return pos;")
+    e.emit(0, "}")
+    e.emit(0)
+
+
+def _emit_encoded_size_member(e: Emitter, member: LcmMember, columns: bool = False) -> None:
+    name = member.name
+    if columns:
+        e.emit(1, f"enc_size += this->{name}._getEncodedSizeNoHash({dim_size(member)});")
+        return
+    if not member.is_array:
+        if _is_string(member):
+            e.emit(1, f"enc_size += this->{name}.size() + 4 + 1;")
+        elif member.is_primitive:
+            e.emit(1, f"enc_size += {coretypes_prefix(member.type)}_encoded_array_size(NULL, 1);")
+        else:
+            e.emit(1, f"enc_size += this->{name}._getEncodedSizeNoHash();")
+        return
+
+    size = dim_size(member)
+    if member.is_primitive and not _is_string(member):
+        e.emit(1, f"enc_size += {coretypes_prefix(member.type)}_encoded_array_size(NULL, {size});")
+        return
+    e.emit(1, f"for (int a0 = 0; a0 < {size}; a0++) {{")
+    if _is_string(member):
+        e.emit(2, f"enc_size += this->{name}[a0].size() + 4 + 1;")
+    else:
+        e.emit(2, f"enc_size += this->{name}[a0]._getEncodedSizeNoHash();")
+    e.emit(1, "}")
+
+
+def _emit_fingerprint_check(
+    e: Emitter, struct: LcmStruct, nested: List[str], type_name: Callable[[str], str]
+) -> None:
+    e.emit(0, f"static_assert({struct.name}::kHash == dimos_lcm::fingerprint(")
+    e.emit(1, "dimos_lcm::signature_hash()")
+    for member in struct.members:
+        type_arg = f'"{member.type}"' if member.is_primitive else "NULL"
+        line = f'.member("{member.name}", {type_arg}, {len(member.dimensions)})'
+        for dim in member.dimensions:
+            line += f'.dim({"false" if dim.is_constant else "true"}, "{dim.size}")'
+        e.emit(2, line)
+    if not nested:
+        e.emit(2, ".value()),")
+    else:
+        e.emit(2, ".value(),")
+        for i, nested_type in enumerate(nested):
+            e.emit(1, f"{type_name(nested_type)}::kHash" + ("," if i < len(nested) - 1 else "),"))
+    e.emit(1, f'"{type_name(struct.full_name)} fingerprint does not match its definition");')
+
+
+def _allocator_aware(member: LcmMember, types: Dict[str, LcmStruct]) -> bool:
+    """True if the std::pmr flavor of @p member takes an allocator."""
+    if member.is_array:
+        return member.is_variable_array
+    if member.is_primitive:
+        return _is_string(member)
+    return not is_plain(types[member.type], types)
+
+
+def _pmr_inits(struct: LcmStruct, types: Dict[str, LcmStruct]) -> str:
+    inits = [f"    {m.name}({'alloc' if _allocator_aware(m, types) else ''})" for m in struct.members]
+    return ",\n".join(inits)
+
+
+def emit_cpp(
+    struct: LcmStruct,
+    types: Dict[str, LcmStruct],
+    pmr: bool = False,
+    soa: bool = False,
+    cow: bool = False,
+    interned: bool = False,
+) -> str:
+    """Message class of @p struct; with @p pmr, its std::pmr flavor, which only
+    non-plain types have (see emit_pmr()); with @p soa, its structure-of-arrays
+    flavor, which only soa_types() have; with @p cow, its copy-on-write payload
+    flavor, which only cow_types() have; with @p interned, its interned string
+    flavor, which only interned_types() have."""
+    name = struct.name
+    members = struct.members
+    nested = [m.type for m in members if not m.is_primitive and m.type != struct.full_name]
+    columnar: Set[str] = set()
+    payloads: Set[str] = set()
+    identifiers: Set[str] = set()
+    namespace = None
+    if pmr:
+        namespace = PMR_NAMESPACE
+        type_name = pmr_cpp_type
+    elif soa or cow or interned:
+        if soa:
+            namespace, flavored = SOA_NAMESPACE, soa_types(types)
+        elif cow:
+            namespace, flavored = COW_NAMESPACE, cow_types(types)
+        else:
+            namespace, flavored = INTERNED_NAMESPACE, interned_types(types)
+
+        def type_name(lcm_type: str) -> str:
+            return cpp_type(flavor_name(lcm_type, namespace) if lcm_type in flavored else lcm_type)
+
+        if soa:
+            columnar = {m.name for m in members if is_columnar(m, types)}
+        elif cow:
+            payloads = {m.name for m in members if is_byte_payload(m)}
+        else:
+            identifiers = {m.name for m in members if is_interned(m)}
+    else:
+        type_name = cpp_type
+    full_name = flavor_name(struct.full_name, namespace) if namespace else struct.full_name
+    e = Emitter()
+
+    e.lines.extend(BANNER.rstrip("\n").split("\n"))
+    e.emit(0)
+    e.emit(0, f"#ifndef {guard_name(full_name)}")
+    e.emit(0, f"#define {guard_name(full_name)}")
+    e.emit(0)
+    e.emit(0, "#include <lcm/lcm_coretypes.h>")
+    e.emit(0)
+    std_includes = ["<array>"]
+    if pmr:
+        std_includes += ["<memory_resource>", "<utility>"]
+    for member in members:
+        if member.is_variable_array and "<vector>" not in std_includes:
+            std_includes.append("<vector>")
+        if _is_string(member) and "<string>" not in std_includes:
+            std_includes.append("<string>")
+    for include in std_includes:
+        e.emit(0, f"#include {include}")
+    plain = is_plain(struct, types)
+    selective = bool(members) and not plain
+    if plain and members:
+        e.emit(0, '#include "dimos_lcm/fixed_codec.hpp"')
+    elif any(_uses_bulk_codec(m) for m in members):
+        e.emit(0, '#include "dimos_lcm/bulk_codec.hpp"')
+    if payloads:
+        e.emit(0, '#include "dimos_lcm/cow_array.hpp"')
+    if identifiers:
+        e.emit(0, '#include "dimos_lcm/interned_string.hpp"')
+    iov = carries_byte_payload(struct, types)
+    if iov:
+        e.emit(0, '#include "dimos_lcm/iov_writer.hpp"')
+        e.emit(0, '#include "dimos_lcm/wire_builder.hpp"')
+    else:
+        e.emit(0, '#include "dimos_lcm/writer.hpp"')
+    e.emit(0, '#include "dimos_lcm/fingerprint.hpp"')
+    e.emit(0, '#include "dimos_lcm/reflection.hpp"')
+    includes: List[str] = []
+    for member in members:
+        if member.is_primitive or member.type == struct.full_name:
+            continue
+        if member.name in columnar:
+            path = header_path(member.type, COLUMNS_SUFFIX)
+        else:
+            path = header_path(type_name(member.type).replace("::", "."))
+        if path not in includes:
+            includes.append(path)
+    for path in includes:
+        e.emit(0, f'#include "{path}"')
+    peek = header_offset(struct, types)
+    if peek:
+        # Views need std::string_view; the rest of the class does not
+        e.emit(0, "#if __cplusplus >= 201703L")
+        e.emit(0, f'#include "{header_path(HEADER_TYPE, VIEW_SUFFIX)}"')
+        e.emit(0, "#endif")
+    e.emit(0)
+    e.emit(0, f"namespace {struct.package}")
+    e.emit(0, "{")
+    if namespace:
+        e.emit(0, f"namespace {namespace}")
+        e.emit(0, "{")
+    e.emit(0)
+    e.emit(0, f"class {name}")
+    e.emit(0, "{")
+
+    if members:
+        e.emit(1, "public:")
+        for member in members:
+            _emit_member_decl(
+                e, member, pmr, type_name, member.name in columnar, member.name in payloads, member.name in identifiers
+            )
+
+    if struct.constants:
+        e.emit(1, "public:")
+        for const in struct.constants:
+            e.lines.extend(_CONSTANT_NOTE.split("\n"))
+            e.emit(2, f"static const {cpp_type(const.type):<8} {const.name} = {const.value};")
+        e.emit(0)
+
+    decls = _METHOD_DECLS.format(
+        name=name,
+        ctor_decl=_PMR_CTOR_DECL.format(name=name) if pmr else "",
+        fingerprint=compute_fingerprint(struct, types),
+        size_decl=_SIZE_DECL.format(size=8 + fixed_encoded_size(struct, types)) if plain else "",
+        limit_decl=_LIMIT_DECL if any(m.is_variable_array for m in members) else "",
+        fields_decl=_FIELDS_DECL.format(constants=_field_constants(struct)) if selective else "",
+        fields_support_decl=_FIELDS_SUPPORT_DECL if selective else "",
+        peek_decl=_PEEK_DECL.format(name=name, member=peek[0], view=cpp_type(HEADER_TYPE) + VIEW_SUFFIX) if peek else "",
+        iov_decl=_IOV_DECL if iov else "",
+        field_count=len(members),
+        field_infos="".join(f"            {_field_info(m)},\n" for m in members),
+    )
+    e.lines.extend(decls.rstrip("\n").split("\n"))
+    e.emit(0)
+    _emit_fingerprint_check(e, struct, nested, type_name)
+    e.emit(0)
+    peek_def = ""
+    if peek:
+        peek_def = _PEEK_DEF.format(
+            name=name, member=peek[0], view=cpp_type(HEADER_TYPE) + VIEW_SUFFIX, fixed=peek[1], start=8 + peek[1]
+        )
+    defs = _METHOD_DEFS.format(
+        name=name,
+        ctor_def=_PMR_CTOR_DEF.format(name=name, inits=_pmr_inits(struct, types)) if pmr else "",
+        iov_def=_IOV_DEF.format(name=name) if iov else "",
+        peek_def=peek_def,
+        fields_def=_FIELDS_DEF.format(name=name) if selective else "",
+    )
+    e.lines.extend(defs.rstrip("\n").split("\n"))
+    e.emit(0)
+
+    if not members:
+        e.emit(0, f"int {name}::_encodeNoHash(void *, int, int) const")
+        e.emit(0, "{")
+        e.emit(1, "return 0;")
+        e.emit(0, "}")
+        e.emit(0)
+        e.emit(0, "template <typename Writer>")
+        e.emit(0, f"void {name}::_writeNoHash(Writer &) const")
+        e.emit(0, "{")
+        e.emit(0, "}")
+        e.emit(0)
+        e.emit(0, f"int {name}::_decodeNoHash(const void *, int, int)")
+        e.emit(0, "{")
+        e.emit(1, "return 0;")
+        e.emit(0, "}")
+        e.emit(0)
+        e.emit(0, f"int {name}::_getEncodedSizeNoHash() const")
+        e.emit(0, "{")
+        e.emit(1, "return 0;")
+        e.emit(0, "}")
+        e.emit(0)
+    elif plain:
+        _emit_fixed_codec(e, struct, types)
+    else:
+        e.emit(0, f"int {name}::_encodeNoHash(void *buf, int offset, int maxlen) const")
+        e.emit(0, "{")
+        e.emit(1, "int pos = 0, tlen;")
+        e.emit(0)
+        for member in members:
+            _emit_encode_member(e, member, member.name in columnar)
+        e.emit(1, "return pos;")
+        e.emit(0, "}")
+        e.emit(0)
+        e.emit(0, "template <typename Writer>")
+        e.emit(0, f"void {name}::_writeNoHash(Writer &out) const")
+        e.emit(0, "{")
+        for member in members:
+            _emit_write_member(e, member, types, member.name in columnar)
+        e.emit(0, "}")
+        e.emit(0)
+        e.emit(0, f"int {name}::_decodeNoHash(const void *buf, int offset, int maxlen)")
+        e.emit(0, "{")
+        e.emit(1, "int pos = 0, tlen;")
+        e.emit(0)
+        for member in members:
+            _emit_decode_member(e, member, types, member.name in columnar)
+        e.emit(1, "return pos;")
+        e.emit(0, "}")
+        e.emit(0)
+        _emit_decode_fields(e, struct, types, type_name, columnar)
+        e.emit(0, f"int {name}::_getEncodedSizeNoHash() const")
+        e.emit(0, "{")
+        e.emit(1, "int enc_size = 0;")
+        for member in members:
+            _emit_encoded_size_member(e, member, member.name in columnar)
+        e.emit(1, "return enc_size;")
+        e.emit(0, "}")
+        e.emit(0)
+    _emit_skip(e, struct, plain, type_name)
+    _emit_for_each_field(e, struct)
+
+    if not nested:
+        e.emit(0, f"uint64_t {name}::_computeHash(const __lcm_hash_ptr *)")
+        e.emit(0, "{")
+        e.emit(1, f"uint64_t hash = 0x{struct.hash:016x}LL;")
+    else:
+        e.emit(0, f"uint64_t {name}::_computeHash(const __lcm_hash_ptr *p)")
+        e.emit(0, "{")
+        e.emit(1, "const __lcm_hash_ptr *fp;")
+        e.emit(1, "for(fp = p; fp != NULL; fp = fp->parent)")
+        e.emit(2, f"if(fp->v == {name}::getHash)")
+        e.emit(3, "return 0;")
+        e.emit(1, f"const __lcm_hash_ptr cp = {{ p, {name}::getHash }};")
+        e.emit(0)
+        e.emit(1, f"uint64_t hash = 0x{struct.hash:016x}LL +")
+        for i, nested_type in enumerate(nested):
+            end = ";" if i == len(nested) - 1 else " +"
+            e.emit(0, f"         {type_name(nested_type)}::_computeHash(&cp){end}")
+        e.emit(0)
+    e.emit(1, "return (hash<<1) + ((hash>>63)&1);")
+    e.emit(0, "}")
+    e.emit(0)
+    e.emit(0, "}")
+    if namespace:
+        e.emit(0, "}")
+    e.emit(0)
+    e.emit(0, "#endif")
+    return e.text()
+
+
+def emit_pmr(struct: LcmStruct, types: Dict[str, LcmStruct]) -> str:
+    """The std::pmr flavor of @p struct, in its package's pmr namespace. Plain
+    types never allocate, so for them this is just an alias of the class."""
+    if not is_plain(struct, types):
+        return emit_cpp(struct, types, pmr=True)
+    e = Emitter()
+    e.lines.extend(BANNER.rstrip("\n").split("\n"))
+    e.emit(0)
+    e.emit(0, f"#ifndef {guard_name(pmr_name(struct.full_name))}")
+    e.emit(0, f"#define {guard_name(pmr_name(struct.full_name))}")
+    e.emit(0)
+    alias = _PMR_ALIAS.format(
+        header=header_path(struct.full_name),
+        package=struct.package,
+        name=struct.name,
+        type=cpp_type(struct.full_name),
+    )
+    e.lines.extend(alias.split("\n"))
+    e.emit(0, "#endif")
+    return e.text()
+
+
+def emit_soa(struct: LcmStruct, types: Dict[str, LcmStruct]) -> str:
+    """The structure-of-arrays flavor of @p struct, in its package's soa
+    namespace, for the types in soa_types(): arrays of flat structs with
+    floating-point fields are stored as *Columns (see emit_soa.py)."""
+    return emit_cpp(struct, types, soa=True)
+
+
+def emit_cow(struct: LcmStruct, types: Dict[str, LcmStruct]) -> str:
+    """The copy-on-write flavor of @p struct, in its package's cow namespace,
+    for the types in cow_types(): byte payloads are dimos_lcm::cow_arrays, which
+    copies of the message share until one of them is written to."""
+    return emit_cpp(struct, types, cow=True)
+
+
+def emit_interned(struct: LcmStruct, types: Dict[str, LcmStruct]) -> str:
+    """The interned string flavor of @p struct, in its package's interned
+    namespace, for the types in interned_types(): identifier strings (frame ids,
+    joint names, ...) are dimos_lcm::interned_strings, which decode() looks up
+    in a process-wide table instead of allocating."""
+    return emit_cpp(struct, types, interned=True)
+
+
+def cpp_file_name(struct: LcmStruct) -> str:
+    return header_path(struct.full_name)
+
+
+def pmr_file_name(struct: LcmStruct) -> str:
+    return header_path(pmr_name(struct.full_name))
+
+
+def soa_file_name(struct: LcmStruct) -> str:
+    return header_path(flavor_name(struct.full_name, SOA_NAMESPACE))
+
+
+def cow_file_name(struct: LcmStruct) -> str:
+    return header_path(flavor_name(struct.full_name, COW_NAMESPACE))
+
+
+def interned_file_name(struct: LcmStruct) -> str:
+    return header_path(flavor_name(struct.full_name, INTERNED_NAMESPACE))
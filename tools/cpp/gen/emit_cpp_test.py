@@ -0,0 +1,218 @@
+import glob
+import os
+import unittest
+
+from emit_cpp import cow_file_name, emit_cow, emit_cpp, emit_interned, emit_pmr, interned_file_name, pmr_file_name
+from lcm_parser import load_types
+
+LCM_TYPES_DIR = os.path.join(os.path.dirname(__file__), "..", "..", "..", "lcm_types")
+
+
+class EmitCppTest(unittest.TestCase):
+    @classmethod
+    def setUpClass(cls):
+        cls.types = load_types(glob.glob(os.path.join(LCM_TYPES_DIR, "*.lcm")))
+
+    def test_lcm_gen_layout(self):
+        out = emit_cpp(self.types["sensor_msgs.Image"], self.types)
+        self.assertIn("class Image\n{\n    public:\n        int32_t    data_length;\n", out)
+        self.assertIn("        std::vector< uint8_t > data;\n", out)
+        self.assertIn("uint64_t hash = 0x79d36c21d3c16094LL +\n         std_msgs::Header::_computeHash(&cp);", out)
+
+    def test_constexpr_fingerprint(self):
+        out = emit_cpp(self.types["sensor_msgs.Image"], self.types)
+        self.assertIn("static constexpr int64_t kHash = static_cast<int64_t>(0x535cface1f4f5717ULL);", out)
+        self.assertIn("int64_t Image::getHash()\n{\n    return kHash;\n}", out)
+        self.assertIn('        .member("data", "byte", 1).dim(true, "data_length")\n', out)
+        self.assertIn("        .value(),\n    std_msgs::Header::kHash),\n", out)
+
+    def test_fixed_size_fast_path(self):
+        out = emit_cpp(self.types["geometry_msgs.PoseWithCovariance"], self.types)
+        self.assertIn("static constexpr int kEncodedSize = 352;", out)
+        self.assertIn('#include "dimos_lcm/fixed_codec.hpp"', out)
+        self.assertIn("    if(maxlen < kEncodedSize - 8) return -1;\n", out)
+        # Nested plain structs are flattened into constant offsets
+        self.assertIn("dimos_lcm::store_be(p + 48, this->pose.orientation.w);", out)
+        self.assertIn("dimos_lcm::load_be_array(p + 56, &this->covariance[0], 36);", out)
+        # Types with strings keep the per-field codec and calling the nested one
+        out = emit_cpp(self.types["nav_msgs.Odometry"], self.types)
+        self.assertNotIn("kEncodedSize", out)
+        self.assertIn("tlen = this->pose._encodeNoHash(buf, offset + pos, maxlen - pos);", out)
+
+    def test_peek_header(self):
+        out = emit_cpp(self.types["sensor_msgs.PointCloud2"], self.types)
+        # The view needs C++17; the rest of the class does not
+        self.assertIn('#if __cplusplus >= 201703L\n#include "std_msgs/HeaderView.hpp"\n#endif\n', out)
+        self.assertIn(
+            "inline static int peekHeader(const void *buf, int offset, int maxlen, std_msgs::HeaderView &header);", out
+        )
+        # After the hash and fields_length, data_length
+        self.assertIn("return header._decodeNoHash(buf, offset + 16, maxlen - 16);", out)
+        out = emit_cpp(self.types["geometry_msgs.Pose"], self.types)
+        self.assertNotIn("peekHeader", out)
+
+    def test_decode_fields(self):
+        out = emit_cpp(self.types["sensor_msgs.JointState"], self.types)
+        self.assertIn("static constexpr uint64_t position = 1ULL << 6;", out)
+        self.assertIn("static constexpr uint64_t all = (1ULL << 9) - 1;", out)
+        self.assertIn("if ((Mask & Fields::position) != 0) {", out)
+        self.assertIn("if(this->position_length < 0 || this->position_length > (maxlen - pos) / 8) return -1;", out)
+        self.assertIn("tlen = std_msgs::Header::_skipNoHash(buf, offset + pos, maxlen - pos);", out)
+        # _skipNoHash reads array lengths into locals
+        self.assertIn("tlen = __int32_t_decode_array(buf, offset + pos, maxlen - pos, &name_length, 1);", out)
+        out = emit_cpp(self.types["geometry_msgs.Pose"], self.types)
+        self.assertNotIn("decodeFields", out)
+        self.assertIn("return maxlen < kEncodedSize - 8 ? -1 : kEncodedSize - 8;", out)
+
+    def test_lengths_checked_before_allocation(self):
+        out = emit_cpp(self.types["sensor_msgs.JointState"], self.types)
+        self.assertIn(
+            "#if __cplusplus >= 201703L\n"
+            "        static inline int32_t maxArrayLength = INT32_MAX;\n"
+            "#else\n"
+            "        static constexpr int32_t maxArrayLength = INT32_MAX;\n"
+            "#endif\n",
+            out,
+        )
+        self.assertIn(
+            "if(this->position_length < 0 || this->position_length > (maxlen - pos) / 8"
+            " || this->position_length > maxArrayLength) return -1;\n"
+            "        this->position.resize(this->position_length);",
+            out,
+        )
+        # Each string takes at least its length and NUL
+        self.assertIn("this->name_length > (maxlen - pos) / 5", out)
+        out = emit_cpp(self.types["visualization_msgs.MarkerArray"], self.types)
+        self.assertIn("this->markers_length > (maxlen - pos) / 158", out)
+        out = emit_cpp(self.types["sensor_msgs.Image"], self.types)
+        self.assertIn("if(__encoding_len__ < 1 || __encoding_len__ > maxlen - pos) return -1;", out)
+        out = emit_cpp(self.types["geometry_msgs.Pose"], self.types)
+        self.assertNotIn("maxArrayLength", out)
+
+    def test_pmr_flavor(self):
+        struct = self.types["visualization_msgs.MarkerArray"]
+        self.assertEqual(pmr_file_name(struct), "visualization_msgs/pmr/MarkerArray.hpp")
+        out = emit_pmr(struct, self.types)
+        self.assertIn("namespace visualization_msgs\n{\nnamespace pmr\n{\n", out)
+        self.assertIn('#include "visualization_msgs/pmr/Marker.hpp"', out)
+        self.assertIn("        std::pmr::vector< visualization_msgs::pmr::Marker > markers;\n", out)
+        self.assertIn("MarkerArray::MarkerArray(const allocator_type &alloc) :\n    markers_length(),\n    markers(alloc)\n{", out)
+        self.assertIn("static constexpr int64_t kHash = static_cast<int64_t>(0x", out)
+        out = emit_pmr(self.types["visualization_msgs.Marker"], self.types)
+        self.assertIn("        std::pmr::string ns;\n", out)
+        # Plain members of a pmr type are the regular classes
+        self.assertIn("    pose(),\n", out)
+        out = emit_pmr(self.types["geometry_msgs.Pose"], self.types)
+        self.assertIn("typedef geometry_msgs::Pose Pose;", out)
+        self.assertNotIn("class Pose", out)
+
+    def test_cow_flavor(self):
+        struct = self.types["sensor_msgs.Image"]
+        self.assertEqual(cow_file_name(struct), "sensor_msgs/cow/Image.hpp")
+        out = emit_cow(struct, self.types)
+        self.assertIn("namespace sensor_msgs\n{\nnamespace cow\n{\n", out)
+        self.assertIn('#include "dimos_lcm/cow_array.hpp"', out)
+        self.assertIn("        dimos_lcm::cow_array< uint8_t > data;\n", out)
+        self.assertIn("this->data.assign(__data_src__, __data_src__ + this->data_length);", out)
+        # Headers carry no payload and stay the regular class
+        self.assertIn("        std_msgs::Header header;\n", out)
+        out = emit_cow(self.types["foxglove_msgs.SceneUpdate"], self.types)
+        self.assertIn("        std::vector< foxglove_msgs::cow::SceneEntity > entities;\n", out)
+        self.assertNotIn("cow_array", out)
+
+    def test_interned_flavor(self):
+        struct = self.types["sensor_msgs.JointState"]
+        self.assertEqual(interned_file_name(struct), "sensor_msgs/interned/JointState.hpp")
+        out = emit_interned(struct, self.types)
+        self.assertIn("namespace sensor_msgs\n{\nnamespace interned\n{\n", out)
+        self.assertIn('#include "dimos_lcm/interned_string.hpp"', out)
+        self.assertIn("        std::vector< dimos_lcm::interned_string > name;\n", out)
+        self.assertIn("        std_msgs::interned::Header header;\n", out)
+        out = emit_interned(self.types["diagnostic_msgs.DiagnosticStatus"], self.types)
+        self.assertIn("        dimos_lcm::interned_string hardware_id;\n", out)
+        # Free text is not interned
+        self.assertIn("        std::string message;\n", out)
+
+    def test_field_reflection(self):
+        out = emit_cpp(self.types["geometry_msgs.PoseWithCovariance"], self.types)
+        self.assertIn('#include "dimos_lcm/reflection.hpp"', out)
+        self.assertIn("static constexpr std::array<dimos_lcm::field_info, 2> kFields = {{\n", out)
+        self.assertIn('            { "pose", "geometry_msgs.Pose", false, 0, 0, NULL },\n', out)
+        self.assertIn('            { "covariance", "double", true, 1, 36, NULL },\n', out)
+        self.assertIn("    visitor(kFields[1], self.covariance);\n", out)
+        out = emit_cpp(self.types["sensor_msgs.JointState"], self.types)
+        self.assertIn('            { "name", "string", true, 1, -1, "name_length" },\n', out)
+        # Flavors describe their fields by LCM type too
+        out = emit_interned(self.types["sensor_msgs.JointState"], self.types)
+        self.assertIn('            { "header", "std_msgs.Header", false, 0, 0, NULL },\n', out)
+        out = emit_cpp(self.types["std_msgs.Empty"], self.types)
+        self.assertIn("void Empty::_forEachField(Self &, Visitor &)", out)
+
+    def test_empty_struct(self):
+        out = emit_cpp(self.types["std_msgs.Empty"], self.types)
+        self.assertIn("int Empty::_encodeNoHash(void *, int, int) const", out)
+        self.assertIn("uint64_t hash = 0x0000000012345678LL;", out)
+
+    def test_bulk_codec_for_multibyte_arrays(self):
+        out = emit_cpp(self.types["sensor_msgs.JointState"], self.types)
+        self.assertIn('#include "dimos_lcm/bulk_codec.hpp"', out)
+        self.assertIn("dimos_lcm::bulk_decode_array(buf, offset + pos, maxlen - pos, &this->position[0], this->position_length);", out)
+        self.assertIn("dimos_lcm::bulk_encode_array(buf, offset + pos, maxlen - pos, &this->effort[0], this->effort_length);", out)
+        # Scalars keep the lcm_coretypes.h codec
+        self.assertIn("__int32_t_decode_array(buf, offset + pos, maxlen - pos, &this->name_length, 1);", out)
+
+    def test_byte_arrays_keep_memcpy_codec(self):
+        out = emit_cpp(self.types["sensor_msgs.Image"], self.types)
+        self.assertNotIn("bulk_codec", out)
+        self.assertIn("__byte_encode_array(buf, offset + pos, maxlen - pos, &this->data[0], this->data_length);", out)
+
+    def test_byte_arrays_decode_without_resize(self):
+        out = emit_cpp(self.types["sensor_msgs.Image"], self.types)
+        self.assertNotIn("this->data.resize(", out)
+        self.assertIn("if(this->data_length < 0 || this->data_length > maxlen - pos) return -1;", out)
+        self.assertIn("this->data.assign(__data_src__, __data_src__ + this->data_length);", out)
+        # Arrays of multi-byte primitives still resize before the bulk decode
+        out = emit_cpp(self.types["sensor_msgs.JointState"], self.types)
+        self.assertIn("this->position.resize(this->position_length);", out)
+
+    def test_empty_arrays_clear_previous_contents(self):
+        out = emit_cpp(self.types["sensor_msgs.Image"], self.types)
+        self.assertIn("    } else {\n        this->data.clear();\n    }\n", out)
+        out = emit_cpp(self.types["sensor_msgs.JointState"], self.types)
+        self.assertIn("    } else {\n        this->position.clear();\n    }\n", out)
+
+    def test_single_pass_encode(self):
+        out = emit_cpp(self.types["visualization_msgs.Marker"], self.types)
+        self.assertIn("inline int encodeTo(std::vector<uint8_t> &buf) const;", out)
+        self.assertIn('#include "dimos_lcm/writer.hpp"', out)
+        self.assertIn("    out.put(this->ns);\n", out)
+        # Arrays of fixed-size structs are reserved in one go
+        self.assertIn("        out.putStructArray(&this->points[0], this->points_length);\n", out)
+        out = emit_cpp(self.types["geometry_msgs.Pose"], self.types)
+        self.assertIn("void Pose::_writeNoHash(Writer &out) const\n{\n    out.putStruct(*this);\n}", out)
+
+    def test_encode_iov_references_payloads(self):
+        out = emit_cpp(self.types["sensor_msgs.PointCloud2"], self.types)
+        self.assertIn('#include "dimos_lcm/iov_writer.hpp"', out)
+        self.assertIn("out.reference(this->data.data(), this->data_length);", out)
+        self.assertIn("this->fields[a0]._writeNoHash(out);", out)
+        # Nested payloads are referenced too
+        out = emit_cpp(self.types["stereo_msgs.DisparityImage"], self.types)
+        self.assertIn("this->image._writeNoHash(out);", out)
+        # Types without a payload keep the lcm-gen API
+        out = emit_cpp(self.types["geometry_msgs.PoseStamped"], self.types)
+        self.assertNotIn("encodeIov", out)
+
+    def test_encode_in_place(self):
+        out = emit_cpp(self.types["sensor_msgs.Image"], self.types)
+        self.assertIn('#include "dimos_lcm/wire_builder.hpp"', out)
+        self.assertIn("inline int encodeInPlace(dimos_lcm::wire_builder &out) const;", out)
+        # Checked against the buffer before anything is written
+        self.assertIn("    if (static_cast<size_t>(size) > out.remaining())\n        return -1;\n", out)
+        out = emit_cpp(self.types["geometry_msgs.PoseStamped"], self.types)
+        self.assertNotIn("encodeInPlace", out)
+        self.assertNotIn("wire_builder", out)
+
+
+if __name__ == "__main__":
+    unittest.main()
@@ -0,0 +1,215 @@
+"""
+Emits dimos_lcm/registry.hpp, which lists every message type as a
+dimos_lcm::type_info (dimos_lcm/type_registry.hpp) and finds them by
+fingerprint in O(1).
+
+The lookup is a perfect hash over the distinct fingerprints, computed here:
+fingerprints are split into buckets by one hash, then each bucket gets the
+displacement that moves its fingerprints, by a second hash, to slots no other
+bucket uses (hash and displace). Types with identical definitions share a
+fingerprint, so a slot holds the first of a run of types.
+"""
+
+from typing import Dict, List, Tuple
+
+from cpp_util import BANNER, Emitter, cpp_type, header_path
+from lcm_parser import LcmStruct, compute_fingerprint
+
+MASK64 = (1 << 64) - 1
+
+# Slot and bucket counts as powers of two
+_SLOT_BITS = 8
+_BUCKET_BITS = 6
+
+
+def mix_hash(x: int) -> int:
+    """splitmix64's finalizer; the C++ side is dimos_lcm::detail::mix_hash()."""
+    x ^= x >> 30
+    x = (x * 0xBF58476D1CE4E5B9) & MASK64
+    x ^= x >> 27
+    x = (x * 0x94D049BB133111EB) & MASK64
+    x ^= x >> 31
+    return x
+
+
+def _hashes(fingerprint: int, seed: int, bucket_bits: int) -> Tuple[int, int]:
+    """(bucket, slot hash) of a fingerprint, as find_type() computes them."""
+    h1 = mix_hash(fingerprint ^ seed)
+    return h1 >> (64 - bucket_bits), mix_hash(h1)
+
+
+def perfect_hash(fingerprints: List[int], slot_bits: int = _SLOT_BITS, bucket_bits: int = _BUCKET_BITS):
+    """(seed, displacements, slots): slots[(slot hash ^ displacements[bucket])
+    & mask] is the position of the fingerprint in @p fingerprints, -1 for an
+    unused slot."""
+    mask = (1 << slot_bits) - 1
+    if len(fingerprints) > mask + 1:
+        raise ValueError("too many types for the registry's perfect hash")
+    for seed in range(1, 1 << 16):
+        buckets: List[List[int]] = [[] for _ in range(1 << bucket_bits)]
+        for i, fp in enumerate(fingerprints):
+            buckets[_hashes(fp, seed, bucket_bits)[0]].append(i)
+        displacements = [0] * (1 << bucket_bits)
+        slots = [-1] * (mask + 1)
+        ok = True
+        for bucket in sorted(range(len(buckets)), key=lambda b: -len(buckets[b])):
+            keys = buckets[bucket]
+            if not keys:
+                break
+            low = [_hashes(fingerprints[i], seed, bucket_bits)[1] & mask for i in keys]
+            if len(set(low)) != len(low):
+                ok = False
+                break
+            for d in range(mask + 1):
+                if all(slots[s ^ d] < 0 for s in low):
+                    displacements[bucket] = d
+                    for i, s in zip(keys, low):
+                        slots[s ^ d] = i
+                    break
+            else:
+                ok = False
+            if not ok:
+                break
+        if ok:
+            return seed, displacements, slots
+    raise ValueError("no perfect hash found for the registry")
+
+
+def _hex(value: int) -> str:
+    return f"0x{value:016x}ULL"
+
+
+def emit_registry(types: Dict[str, LcmStruct]) -> str:
+    fingerprints = {name: compute_fingerprint(struct, types) for name, struct in types.items()}
+    # Types sharing a fingerprint are adjacent, in name order
+    groups: Dict[int, List[str]] = {}
+    for name in sorted(types):
+        groups.setdefault(fingerprints[name], []).append(name)
+    order = [name for group in groups.values() for name in group]
+    distinct = list(groups)
+    first = {}
+    for index, name in enumerate(order):
+        first.setdefault(fingerprints[name], index)
+    seed, displacements, slots = perfect_hash(distinct)
+    slot_entries = [first[distinct[s]] if s >= 0 else -1 for s in slots]
+
+    e = Emitter()
+    e.lines.extend(BANNER.rstrip("\n").split("\n"))
+    e.emit(0)
+    e.emit(0, "#ifndef __dimos_lcm_registry_hpp__")
+    e.emit(0, "#define __dimos_lcm_registry_hpp__")
+    e.emit(0)
+    e.emit(0, "#include <string_view>")
+    e.emit(0)
+    e.emit(0, '#include "dimos_lcm/type_registry.hpp"')
+    e.emit(0, '#include "dimos_lcm/view.hpp"')
+    for name in sorted(types):
+        e.emit(0, f'#include "{header_path(name)}"')
+    e.emit(0)
+    e.emit(0, "namespace dimos_lcm")
+    e.emit(0, "{")
+    e.emit(0)
+    e.emit(0, "/**")
+    e.emit(0, " * Every message type. Types with the same definition, and so the same")
+    e.emit(0, " * fingerprint, are adjacent and in name order.")
+    e.emit(0, " */")
+    e.emit(0, "inline constexpr type_info kTypes[] = {")
+    for index, name in enumerate(order):
+        e.emit(1, f'make_type_info< {cpp_type(name)} >("{name}", {index}),')
+    e.emit(0, "};")
+    e.emit(0)
+    e.emit(0, f"inline constexpr int kTypeCount = {len(order)};")
+    e.emit(0)
+    e.emit(0, "namespace detail")
+    e.emit(0, "{")
+    e.emit(0)
+    e.emit(0, "// Perfect hash of the fingerprints, see find_type()")
+    e.emit(0, f"inline constexpr uint64_t kRegistrySeed = {_hex(seed)};")
+    e.emit(0, f"inline constexpr uint16_t kRegistryDisplacements[{len(displacements)}] = {{")
+    for i in range(0, len(displacements), 16):
+        e.emit(1, ", ".join(str(d) for d in displacements[i:i + 16]) + ",")
+    e.emit(0, "};")
+    e.emit(0, f"inline constexpr int16_t kRegistrySlots[{len(slot_entries)}] = {{")
+    for i in range(0, len(slot_entries), 16):
+        e.emit(1, ", ".join(str(s) for s in slot_entries[i:i + 16]) + ",")
+    e.emit(0, "};")
+    e.emit(0)
+    e.emit(0, "}")
+    e.emit(0)
+    e.emit(0, "/**")
+    e.emit(0, " * The type with fingerprint @p hash, or NULL if there is none. Of types")
+    e.emit(0, " * sharing a fingerprint this is the first by name; see find_types().")
+    e.emit(0, " */")
+    e.emit(0, "inline const type_info *find_type(int64_t hash)")
+    e.emit(0, "{")
+    e.emit(1, "uint64_t h1 = detail::mix_hash(static_cast<uint64_t>(hash) ^ detail::kRegistrySeed);")
+    e.emit(1, f"uint64_t slot = (detail::mix_hash(h1) ^ detail::kRegistryDisplacements[h1 >> {64 - _BUCKET_BITS}]) &")
+    e.emit(2, f"{(1 << _SLOT_BITS) - 1};")
+    e.emit(1, "int index = detail::kRegistrySlots[slot];")
+    e.emit(1, "if (index < 0 || kTypes[index].hash != hash)")
+    e.emit(2, "return NULL;")
+    e.emit(1, "return &kTypes[index];")
+    e.emit(0, "}")
+    e.emit(0)
+    e.emit(0, "/**")
+    e.emit(0, " * All the types with fingerprint @p hash; empty if there are none.")
+    e.emit(0, " */")
+    e.emit(0, "inline span<const type_info> find_types(int64_t hash)")
+    e.emit(0, "{")
+    e.emit(1, "const type_info *type = find_type(hash);")
+    e.emit(1, "if (!type)")
+    e.emit(2, "return span<const type_info>();")
+    e.emit(1, "int end = type->index + 1;")
+    e.emit(1, "while (end < kTypeCount && kTypes[end].hash == hash)")
+    e.emit(2, "end++;")
+    e.emit(1, "return span<const type_info>(type, end - type->index);")
+    e.emit(0, "}")
+    e.emit(0)
+    e.emit(0, "/**")
+    e.emit(0, ' * The type named @p name ("sensor_msgs.Image"), or NULL. A linear search,')
+    e.emit(0, " * meant for setup rather than per message.")
+    e.emit(0, " */")
+    e.emit(0, "inline const type_info *find_type(std::string_view name)")
+    e.emit(0, "{")
+    e.emit(1, "for (const type_info &type : kTypes) {")
+    e.emit(2, "if (name == type.name)")
+    e.emit(3, "return &type;")
+    e.emit(1, "}")
+    e.emit(1, "return NULL;")
+    e.emit(0, "}")
+    e.emit(0)
+    e.emit(0, "/**")
+    e.emit(0, " * Decode a message of type @p type and call @p visitor with it as its")
+    e.emit(0, " * concrete class, const T &. Returns what decode() returned.")
+    e.emit(0, " */")
+    e.emit(0, "template <typename Visitor>")
+    e.emit(0, "int visit(const type_info &type, const void *buf, int offset, int maxlen, Visitor &&visitor)")
+    e.emit(0, "{")
+    e.emit(1, "switch (type.index) {")
+    for index, name in enumerate(order):
+        e.emit(2, f"case {index}: return detail::visit_as< {cpp_type(name)} >(buf, offset, maxlen, visitor);")
+    e.emit(1, "}")
+    e.emit(1, "return -1;")
+    e.emit(0, "}")
+    e.emit(0)
+    e.emit(0, "/**")
+    e.emit(0, " * Decode a message of whichever type its fingerprint names and call")
+    e.emit(0, " * @p visitor with it; -1 if no type has that fingerprint.")
+    e.emit(0, " */")
+    e.emit(0, "template <typename Visitor>")
+    e.emit(0, "int visit(const void *buf, int offset, int maxlen, Visitor &&visitor)")
+    e.emit(0, "{")
+    e.emit(1, "const type_info *type = find_type(peek_hash(buf, offset, maxlen));")
+    e.emit(1, "if (!type)")
+    e.emit(2, "return -1;")
+    e.emit(1, "return visit(*type, buf, offset, maxlen, visitor);")
+    e.emit(0, "}")
+    e.emit(0)
+    e.emit(0, "}")
+    e.emit(0)
+    e.emit(0, "#endif")
+    return e.text()
+
+
+def registry_file_name() -> str:
+    return "dimos_lcm/registry.hpp"
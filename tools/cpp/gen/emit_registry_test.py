@@ -0,0 +1,44 @@
+import glob
+import os
+import random
+import unittest
+
+from emit_registry import _BUCKET_BITS, _SLOT_BITS, _hashes, emit_registry, perfect_hash
+from lcm_parser import compute_fingerprint, load_types
+
+LCM_TYPES_DIR = os.path.join(os.path.dirname(__file__), "..", "..", "..", "lcm_types")
+
+
+class EmitRegistryTest(unittest.TestCase):
+    @classmethod
+    def setUpClass(cls):
+        cls.types = load_types(glob.glob(os.path.join(LCM_TYPES_DIR, "*.lcm")))
+
+    def test_perfect_hash(self):
+        fingerprints = sorted({compute_fingerprint(s, self.types) for s in self.types.values()})
+        seed, displacements, slots = perfect_hash(fingerprints)
+        mask = (1 << _SLOT_BITS) - 1
+        for i, fp in enumerate(fingerprints):
+            bucket, h2 = _hashes(fp, seed, _BUCKET_BITS)
+            self.assertEqual(slots[(h2 ^ displacements[bucket]) & mask], i)
+        self.assertEqual(sum(1 for s in slots if s >= 0), len(fingerprints))
+
+    def test_perfect_hash_random_keys(self):
+        rng = random.Random(7)
+        keys = [rng.getrandbits(64) for _ in range(240)]
+        seed, displacements, slots = perfect_hash(keys)
+        self.assertEqual(sorted(s for s in slots if s >= 0), list(range(240)))
+
+    def test_registry(self):
+        out = emit_registry(self.types)
+        self.assertIn('#include "sensor_msgs/Image.hpp"', out)
+        self.assertIn("inline constexpr int kTypeCount = %d;" % len(self.types), out)
+        # Types with the same fingerprint are adjacent, in name order
+        point = out.index('make_type_info< geometry_msgs::Point >("geometry_msgs.Point", ')
+        vector3 = out.index('make_type_info< geometry_msgs::Vector3 >("geometry_msgs.Vector3", ')
+        self.assertEqual(out.count("\n", point, vector3), 1)
+        self.assertIn("return detail::visit_as< sensor_msgs::Image >(buf, offset, maxlen, visitor);", out)
+
+
+if __name__ == "__main__":
+    unittest.main()
@@ -0,0 +1,285 @@
+"""
+Emits the *Columns companions used by the structure-of-arrays flavor of the
+message classes (the soa:: namespace, emitted by emit_cpp).
+
+A Columns class stores a sequence of a flat struct (Point, Pose, PoseStamped,
+ColorRGBA, ...) as one std::vector per scalar or string field, nested fields
+included, and encodes/decodes it straight between the wire and the columns.
+"""
+
+from typing import Dict, List, Tuple, Union
+
+from cpp_util import (
+    BANNER,
+    COLUMNS_SUFFIX,
+    Emitter,
+    cpp_type,
+    guard_name,
+    header_path,
+    is_plain,
+    min_encoded_size,
+)
+from lcm_parser import PRIMITIVE_SIZES, LcmStruct
+
+# A field of the flattened struct: (column name, member path, LCM type)
+_Leaf = Tuple[str, str, str]
+
+
+def _leaves(struct: LcmStruct, types: Dict[str, LcmStruct], prefix: str = "") -> List[_Leaf]:
+    """Scalar and string fields of a flat struct in wire order, with nested
+    structs flattened; columns are named by their path joined with '_'."""
+    leaves: List[_Leaf] = []
+    for member in struct.members:
+        path = prefix + member.name
+        if member.is_primitive:
+            leaves.append((path.replace(".", "_"), path, member.type))
+        else:
+            leaves.extend(_leaves(types[member.type], types, path + "."))
+    return leaves
+
+
+def _runs(leaves: List[_Leaf]) -> List[Union[List[Tuple[_Leaf, int]], _Leaf]]:
+    """Split the fields into runs of fixed-size fields, as (field, offset in the
+    run) lists, and the strings between them."""
+    runs: List[Union[List[Tuple[_Leaf, int]], _Leaf]] = []
+    run: List[Tuple[_Leaf, int]] = []
+    offset = 0
+    for leaf in leaves:
+        if leaf[2] == "string":
+            if run:
+                runs.append(run)
+            runs.append(leaf)
+            run, offset = [], 0
+            continue
+        run.append((leaf, offset))
+        offset += PRIMITIVE_SIZES[leaf[2]]
+    if run:
+        runs.append(run)
+    return runs
+
+
+def _run_size(run: List[Tuple[_Leaf, int]]) -> int:
+    leaf, offset = run[-1]
+    return offset + PRIMITIVE_SIZES[leaf[2]]
+
+
+def _emit_decode(e: Emitter, cls: str, struct: LcmStruct, types: Dict[str, LcmStruct], runs, plain: bool) -> None:
+    e.emit(0, f"int {cls}::_decodeNoHash(const void *buf, int offset, int maxlen, int n)")
+    e.emit(0, "{")
+    e.emit(1, f"if(n < 0 || n > maxlen / {min_encoded_size(struct, types)}) return -1;")
+    e.emit(1, "this->resize(n);")
+    e.emit(1, "const uint8_t *p = static_cast<const uint8_t*>(buf) + offset;")
+    if plain:
+        # One run, whose size the check above covers for all n elements
+        size = _run_size(runs[0])
+        for (column, _, lcm_type), _ in runs[0]:
+            e.emit(1, f"{cpp_type(lcm_type)} *{column} = this->{column}.data();")
+        e.emit(1, f"for (int i = 0; i < n; i++, p += {size}) {{")
+        for (column, _, _), offset in runs[0]:
+            e.emit(2, f"dimos_lcm::load_be(p + {offset}, {column}[i]);")
+        e.emit(1, "}")
+        e.emit(1, f"return n * {size};")
+        e.emit(0, "}")
+        e.emit(0)
+        return
+    e.emit(1, "int pos = 0;")
+    e.emit(1, "for (int i = 0; i < n; i++) {")
+    for run in runs:
+        if isinstance(run, tuple):
+            column = run[0]
+            e.emit(2, f"int32_t __{column}_len__;")
+            e.emit(2, "if(maxlen - pos < 4) return -1;")
+            e.emit(2, f"dimos_lcm::load_be(p + pos, __{column}_len__);")
+            e.emit(2, "pos += 4;")
+            e.emit(2, f"if(__{column}_len__ < 1 || __{column}_len__ > maxlen - pos) return -1;")
+            e.emit(2, f"this->{column}[i].assign(reinterpret_cast<const char*>(p) + pos, __{column}_len__ - 1);")
+            e.emit(2, f"pos += __{column}_len__;")
+            continue
+        size = _run_size(run)
+        e.emit(2, f"if(maxlen - pos < {size}) return -1;")
+        for (column, _, _), offset in run:
+            e.emit(2, f"dimos_lcm::load_be(p + pos + {offset}, this->{column}[i]);")
+        e.emit(2, f"pos += {size};")
+    e.emit(1, "}")
+    e.emit(1, "return pos;")
+    e.emit(0, "}")
+    e.emit(0)
+
+
+def _emit_encode(e: Emitter, cls: str, runs) -> None:
+    e.emit(0, f"int {cls}::_encodeNoHash(void *buf, int offset, int maxlen, int n) const")
+    e.emit(0, "{")
+    e.emit(1, "uint8_t *p = static_cast<uint8_t*>(buf) + offset;")
+    e.emit(1, "int pos = 0;")
+    e.emit(1, "for (int i = 0; i < n; i++) {")
+    for run in runs:
+        if isinstance(run, tuple):
+            column = run[0]
+            e.emit(2, f"int32_t __{column}_len__ = static_cast<int32_t>(this->{column}[i].size()) + 1;")
+            e.emit(2, f"if(maxlen - pos < 4 || __{column}_len__ > maxlen - pos - 4) return -1;")
+            e.emit(2, f"dimos_lcm::store_be(p + pos, __{column}_len__);")
+            e.emit(2, f"memcpy(p + pos + 4, this->{column}[i].c_str(), __{column}_len__);")
+            e.emit(2, f"pos += 4 + __{column}_len__;")
+            continue
+        size = _run_size(run)
+        e.emit(2, f"if(maxlen - pos < {size}) return -1;")
+        for (column, _, _), offset in run:
+            e.emit(2, f"dimos_lcm::store_be(p + pos + {offset}, this->{column}[i]);")
+        e.emit(2, f"pos += {size};")
+    e.emit(1, "}")
+    e.emit(1, "return pos;")
+    e.emit(0, "}")
+    e.emit(0)
+
+
+def _emit_write(e: Emitter, cls: str, runs, plain: bool) -> None:
+    e.emit(0, "template <typename Writer>")
+    e.emit(0, f"void {cls}::_writeNoHash(Writer &out, int n) const")
+    e.emit(0, "{")
+    if plain:
+        # One run: reserve the whole sequence at once
+        size = _run_size(runs[0])
+        e.emit(1, "if(n <= 0) return;")
+        e.emit(1, f"uint8_t *p = out.extend(static_cast<size_t>(n) * {size});")
+        e.emit(1, f"for (int i = 0; i < n; i++, p += {size}) {{")
+        for (column, _, _), offset in runs[0]:
+            e.emit(2, f"dimos_lcm::store_be(p + {offset}, this->{column}[i]);")
+        e.emit(1, "}")
+        e.emit(0, "}")
+        e.emit(0)
+        return
+    e.emit(1, "for (int i = 0; i < n; i++) {")
+    for run in runs:
+        if isinstance(run, tuple):
+            e.emit(2, f"out.put(this->{run[0]}[i]);")
+            continue
+        e.emit(2, "{")
+        e.emit(3, f"uint8_t *p = out.extend({_run_size(run)});")
+        for (column, _, _), offset in run:
+            e.emit(3, f"dimos_lcm::store_be(p + {offset}, this->{column}[i]);")
+        e.emit(2, "}")
+    e.emit(1, "}")
+    e.emit(0, "}")
+    e.emit(0)
+
+
+def emit_columns(struct: LcmStruct, types: Dict[str, LcmStruct]) -> str:
+    name = struct.name
+    cls = name + COLUMNS_SUFFIX
+    msg_type = cpp_type(struct.full_name)
+    leaves = _leaves(struct, types)
+    columns = [leaf[0] for leaf in leaves]
+    if len(set(columns)) != len(columns):
+        raise ValueError(f"{struct.full_name}: flattened field names collide")
+    strings = [leaf for leaf in leaves if leaf[2] == "string"]
+    runs = _runs(leaves)
+    plain = is_plain(struct, types)
+    e = Emitter()
+
+    e.lines.extend(BANNER.rstrip("\n").split("\n"))
+    e.emit(0)
+    e.emit(0, f"#ifndef {guard_name(struct.full_name, COLUMNS_SUFFIX)}")
+    e.emit(0, f"#define {guard_name(struct.full_name, COLUMNS_SUFFIX)}")
+    e.emit(0)
+    e.emit(0, "#include <lcm/lcm_coretypes.h>")
+    e.emit(0)
+    if strings:
+        e.emit(0, "#include <string>")
+    e.emit(0, "#include <vector>")
+    e.emit(0, '#include "dimos_lcm/fixed_codec.hpp"')
+    e.emit(0, f'#include "{header_path(struct.full_name)}"')
+    e.emit(0)
+    e.emit(0, f"namespace {struct.package}")
+    e.emit(0, "{")
+    e.emit(0)
+    e.emit(0, "/**")
+    e.emit(0, f" * Structure-of-arrays storage for a sequence of {struct.full_name}: one")
+    e.emit(0, " * contiguous array per field, with nested fields flattened and named by their")
+    e.emit(0, f" * path ({', '.join(columns[:2])}, ...). The soa:: message classes hold their")
+    e.emit(0, f" * {name} arrays this way and decode them straight into the columns.")
+    e.emit(0, " */")
+    e.emit(0, f"class {cls}")
+    e.emit(0, "{")
+    e.emit(1, "public:")
+    for column, path, lcm_type in leaves:
+        if column != path:
+            e.emit(2, f"// {path}")
+        e.emit(2, f"std::vector< {cpp_type(lcm_type)} > {column};")
+        e.emit(0)
+    e.emit(1, "public:")
+    e.emit(2, "/**")
+    e.emit(2, " * Number of elements.")
+    e.emit(2, " */")
+    e.emit(2, "inline int size() const;")
+    e.emit(0)
+    e.emit(2, "/**")
+    e.emit(2, " * Resize every column to @p n elements.")
+    e.emit(2, " */")
+    e.emit(2, "inline void resize(int n);")
+    e.emit(0)
+    e.emit(2, "/**")
+    e.emit(2, f" * Gather element @p i into a {name}.")
+    e.emit(2, " */")
+    e.emit(2, f"inline {msg_type} get(int i) const;")
+    e.emit(0)
+    e.emit(2, "/**")
+    e.emit(2, " * Scatter @p msg into element @p i.")
+    e.emit(2, " */")
+    e.emit(2, f"inline void set(int i, const {msg_type} &msg);")
+    e.emit(0)
+    e.emit(2, "// LCM support functions. Users should not call these")
+    e.emit(2, "inline int _encodeNoHash(void *buf, int offset, int maxlen, int n) const;")
+    e.emit(2, "template <typename Writer>")
+    e.emit(2, "inline void _writeNoHash(Writer &out, int n) const;")
+    e.emit(2, "inline int _getEncodedSizeNoHash(int n) const;")
+    e.emit(2, "inline int _decodeNoHash(const void *buf, int offset, int maxlen, int n);")
+    e.emit(0, "};")
+    e.emit(0)
+
+    e.emit(0, f"int {cls}::size() const")
+    e.emit(0, "{")
+    e.emit(1, f"return static_cast<int>(this->{columns[0]}.size());")
+    e.emit(0, "}")
+    e.emit(0)
+    e.emit(0, f"void {cls}::resize(int n)")
+    e.emit(0, "{")
+    for column in columns:
+        e.emit(1, f"this->{column}.resize(n);")
+    e.emit(0, "}")
+    e.emit(0)
+    e.emit(0, f"{msg_type} {cls}::get(int i) const")
+    e.emit(0, "{")
+    e.emit(1, f"{msg_type} msg;")
+    for column, path, _ in leaves:
+        e.emit(1, f"msg.{path} = this->{column}[i];")
+    e.emit(1, "return msg;")
+    e.emit(0, "}")
+    e.emit(0)
+    e.emit(0, f"void {cls}::set(int i, const {msg_type} &msg)")
+    e.emit(0, "{")
+    for column, path, _ in leaves:
+        e.emit(1, f"this->{column}[i] = msg.{path};")
+    e.emit(0, "}")
+    e.emit(0)
+    _emit_encode(e, cls, runs)
+    _emit_write(e, cls, runs, plain)
+    e.emit(0, f"int {cls}::_getEncodedSizeNoHash(int n) const")
+    e.emit(0, "{")
+    if not strings:
+        e.emit(1, f"return n * {_run_size(runs[0])};")
+    else:
+        e.emit(1, f"int size = n * {min_encoded_size(struct, types)};")
+        e.emit(1, "for (int i = 0; i < n; i++)")
+        e.emit(2, "size += " + " + ".join(f"this->{leaf[0]}[i].size()" for leaf in strings) + ";")
+        e.emit(1, "return size;")
+    e.emit(0, "}")
+    e.emit(0)
+    _emit_decode(e, cls, struct, types, runs, plain)
+    e.emit(0, "}")
+    e.emit(0)
+    e.emit(0, "#endif")
+    return e.text()
+
+
+def columns_file_name(struct: LcmStruct) -> str:
+    return header_path(struct.full_name, COLUMNS_SUFFIX)
@@ -0,0 +1,57 @@
+import glob
+import os
+import unittest
+
+from cpp_util import columns_types, soa_types
+from emit_cpp import emit_soa, soa_file_name
+from emit_soa import columns_file_name, emit_columns
+from lcm_parser import load_types
+
+LCM_TYPES_DIR = os.path.join(os.path.dirname(__file__), "..", "..", "..", "lcm_types")
+
+
+class EmitSoaTest(unittest.TestCase):
+    @classmethod
+    def setUpClass(cls):
+        cls.types = load_types(glob.glob(os.path.join(LCM_TYPES_DIR, "*.lcm")))
+
+    def test_soa_types(self):
+        names = soa_types(self.types)
+        for name in ("geometry_msgs.PoseArray", "nav_msgs.Path", "visualization_msgs.Marker", "shape_msgs.Mesh"):
+            self.assertIn(name, names)
+        # Containers of soa types get a soa flavor too
+        self.assertIn("visualization_msgs.MarkerArray", names)
+        # Arrays of primitives are already contiguous
+        self.assertNotIn("sensor_msgs.JointState", names)
+        columns = columns_types(self.types)
+        self.assertIn("geometry_msgs.PoseStamped", columns)
+        # Integer-only elements stay arrays of structs
+        self.assertNotIn("shape_msgs.MeshTriangle", columns)
+
+    def test_columns(self):
+        struct = self.types["geometry_msgs.PoseStamped"]
+        self.assertEqual(columns_file_name(struct), "geometry_msgs/PoseStampedColumns.hpp")
+        out = emit_columns(struct, self.types)
+        self.assertIn("class PoseStampedColumns\n{\n    public:\n        // header.seq\n        std::vector< int32_t > header_seq;\n", out)
+        self.assertIn("        std::vector< std::string > header_frame_id;\n", out)
+        self.assertIn("        std::vector< double > pose_orientation_w;\n", out)
+        self.assertIn("    msg.pose.position.x = this->pose_position_x[i];\n", out)
+        # Elements are at least 73 bytes on the wire: checked before resizing
+        self.assertIn("    if(n < 0 || n > maxlen / 73) return -1;\n    this->resize(n);\n", out)
+        self.assertIn("        dimos_lcm::load_be(p + pos + 48, this->pose_orientation_w[i]);\n", out)
+
+    def test_soa_flavor(self):
+        struct = self.types["nav_msgs.Path"]
+        self.assertEqual(soa_file_name(struct), "nav_msgs/soa/Path.hpp")
+        out = emit_soa(struct, self.types)
+        self.assertIn("namespace nav_msgs\n{\nnamespace soa\n{\n", out)
+        self.assertIn('#include "geometry_msgs/PoseStampedColumns.hpp"', out)
+        self.assertIn("        geometry_msgs::PoseStampedColumns poses;\n", out)
+        self.assertIn("tlen = this->poses._decodeNoHash(buf, offset + pos, maxlen - pos, this->poses_length);", out)
+        self.assertIn("static constexpr int64_t kHash = static_cast<int64_t>(0x", out)
+        out = emit_soa(self.types["visualization_msgs.MarkerArray"], self.types)
+        self.assertIn("        std::vector< visualization_msgs::soa::Marker > markers;\n", out)
+
+
+if __name__ == "__main__":
+    unittest.main()
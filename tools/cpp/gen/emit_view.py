@@ -0,0 +1,279 @@
+"""
+Emits zero-copy read-only *View companions for message types with large
+byte payloads (Image, PointCloud2, CompressedImage, OccupancyGrid, ...).
+
+A view decodes scalars by value, exposes strings as std::string_view and
+byte arrays as dimos_lcm::span, both pointing into the receive buffer. Nested
+structs that are fixed-size reuse the regular message class (decoding them
+never allocates); the others get a view of their own.
+"""
+
+from typing import Dict, List, Set
+
+from cpp_util import (
+    BANNER,
+    HEADER_TYPE,
+    VIEW_SUFFIX,
+    Emitter,
+    coretypes_prefix,
+    cpp_type,
+    dim_size,
+    guard_name,
+    has_byte_payload,
+    header_offset,
+    header_path,
+    is_plain,
+)
+from lcm_parser import PRIMITIVE_SIZES, LcmMember, LcmStruct
+
+
+def view_types(types: Dict[str, LcmStruct]) -> Set[str]:
+    """Payload-carrying types plus every non-plain type they nest, and the
+    header type if any type supports peekHeader()."""
+    result: Set[str] = set()
+
+    def visit(name: str) -> None:
+        if name in result:
+            return
+        result.add(name)
+        for member in types[name].members:
+            if not member.is_primitive and not is_plain(types[member.type], types):
+                visit(member.type)
+
+    for name, struct in types.items():
+        if has_byte_payload(struct):
+            visit(name)
+        if header_offset(struct, types) is not None:
+            visit(HEADER_TYPE)
+    return result
+
+
+def _nested_cpp_type(member: LcmMember, types: Dict[str, LcmStruct]) -> str:
+    if is_plain(types[member.type], types):
+        return cpp_type(member.type)
+    return cpp_type(member.type) + VIEW_SUFFIX
+
+
+def _member_view_type(member: LcmMember, types: Dict[str, LcmStruct]) -> str:
+    if len(member.dimensions) > 1:
+        raise ValueError(f"{member.name}: multi-dimensional arrays are not supported by views")
+    if member.is_primitive:
+        if member.type == "string":
+            if member.is_array:
+                raise ValueError(f"{member.name}: string arrays are not supported by views")
+            return "std::string_view"
+        if not member.is_array:
+            return cpp_type(member.type)
+        if not member.is_variable_array:
+            return cpp_type(member.type)
+        if PRIMITIVE_SIZES[member.type] == 1:
+            return f"dimos_lcm::span< const {cpp_type(member.type)} >"
+        return f"dimos_lcm::be_array< {cpp_type(member.type)} >"
+    if not member.is_array:
+        return _nested_cpp_type(member, types)
+    if not member.is_variable_array:
+        raise ValueError(f"{member.name}: fixed-size struct arrays are not supported by views")
+    return f"dimos_lcm::view_array< {_nested_cpp_type(member, types)} >"
+
+
+def _emit_decode_member(e: Emitter, member: LcmMember, types: Dict[str, LcmStruct]) -> None:
+    name = member.name
+    if member.type == "string":
+        e.emit(1, f"int32_t __{name}_len__;")
+        e.emit(1, "tlen = __int32_t_decode_array(")
+        e.emit(2, f"buf, offset + pos, maxlen - pos, &__{name}_len__, 1);")
+        e.emit(1, "if(tlen < 0) return tlen; else pos += tlen;")
+        e.emit(1, f"if(__{name}_len__ < 1 || __{name}_len__ > maxlen - pos) return -1;")
+        e.emit(1, f"this->{name} = std::string_view(")
+        e.emit(2, f"static_cast<const char*>(buf) + offset + pos, __{name}_len__ - 1);")
+        e.emit(1, f"pos += __{name}_len__;")
+    elif member.is_primitive and member.is_variable_array:
+        size = dim_size(member)
+        width = PRIMITIVE_SIZES[member.type]
+        nbytes = size if width == 1 else f"{size} * {width}"
+        e.emit(1, f"if({size} < 0 || {nbytes} > maxlen - pos) return -1;")
+        if width == 1:
+            e.emit(1, f"this->{name} = {_member_view_type(member, types)}(")
+            e.emit(2, f"static_cast<const {cpp_type(member.type)}*>(buf) + offset + pos, {size});")
+        else:
+            e.emit(1, f"this->{name} = {_member_view_type(member, types)}(")
+            e.emit(2, f"static_cast<const uint8_t*>(buf) + offset + pos, {size});")
+        e.emit(1, f"pos += {nbytes};")
+    elif member.is_primitive:
+        count = dim_size(member) if member.is_array else "1"
+        target = f"&this->{name}[0]" if member.is_array else f"&this->{name}"
+        codec = "dimos_lcm::bulk" if member.is_array and PRIMITIVE_SIZES[member.type] > 1 else coretypes_prefix(member.type)
+        e.emit(1, f"tlen = {codec}_decode_array(buf, offset + pos, maxlen - pos, {target}, {count});")
+        e.emit(1, "if(tlen < 0) return tlen; else pos += tlen;")
+    elif member.is_array:
+        e.emit(1, f"tlen = this->{name}._decodeNoHash(buf, offset + pos, maxlen - pos, {dim_size(member)});")
+        e.emit(1, "if(tlen < 0) return tlen; else pos += tlen;")
+    else:
+        e.emit(1, f"tlen = this->{name}._decodeNoHash(buf, offset + pos, maxlen - pos);")
+        e.emit(1, "if(tlen < 0) return tlen; else pos += tlen;")
+    e.emit(0)
+
+
+def _emit_copy_member(e: Emitter, member: LcmMember, types: Dict[str, LcmStruct]) -> None:
+    name = member.name
+    if member.type == "string":
+        e.emit(1, f"msg.{name}.assign(this->{name}.data(), this->{name}.size());")
+    elif member.is_primitive and member.is_variable_array:
+        if PRIMITIVE_SIZES[member.type] == 1:
+            e.emit(1, f"msg.{name}.assign(this->{name}.begin(), this->{name}.end());")
+        else:
+            e.emit(1, f"msg.{name}.resize(this->{name}.size());")
+            e.emit(1, f"if(!this->{name}.empty())")
+            e.emit(2, f"this->{name}.copyTo(&msg.{name}[0]);")
+    elif member.is_primitive and member.is_array:
+        e.emit(1, f"for (int a0 = 0; a0 < {dim_size(member)}; a0++)")
+        e.emit(2, f"msg.{name}[a0] = this->{name}[a0];")
+    elif member.is_primitive or is_plain(types[member.type], types):
+        if member.is_array:
+            e.emit(1, f"msg.{name}.assign(this->{name}.begin(), this->{name}.end());")
+        else:
+            e.emit(1, f"msg.{name} = this->{name};")
+    elif member.is_array:
+        e.emit(1, f"msg.{name}.resize(this->{name}.size());")
+        e.emit(1, "{")
+        e.emit(2, "int a0 = 0;")
+        e.emit(2, f"for ({_member_view_type(member, types)}::iterator it = this->{name}.begin();")
+        e.emit(3, f"it != this->{name}.end(); ++it, a0++)")
+        e.emit(3, f"it->copyTo(msg.{name}[a0]);")
+        e.emit(1, "}")
+    else:
+        e.emit(1, f"this->{name}.copyTo(msg.{name});")
+
+
+def emit_view(struct: LcmStruct, types: Dict[str, LcmStruct]) -> str:
+    name = struct.name
+    view = name + VIEW_SUFFIX
+    e = Emitter()
+
+    e.lines.extend(BANNER.rstrip("\n").split("\n"))
+    e.emit(0)
+    e.emit(0, f"#ifndef {guard_name(struct.full_name, VIEW_SUFFIX)}")
+    e.emit(0, f"#define {guard_name(struct.full_name, VIEW_SUFFIX)}")
+    e.emit(0)
+    e.emit(0, "#include <lcm/lcm_coretypes.h>")
+    e.emit(0)
+    if any(m.type == "string" for m in struct.members):
+        e.emit(0, "#include <string_view>")
+    e.emit(0, '#include "dimos_lcm/view.hpp"')
+    e.emit(0, f'#include "{header_path(struct.full_name)}"')
+    includes: List[str] = []
+    for member in struct.members:
+        if member.is_primitive or is_plain(types[member.type], types):
+            continue
+        path = header_path(member.type, VIEW_SUFFIX)
+        if path not in includes:
+            includes.append(path)
+    for path in includes:
+        e.emit(0, f'#include "{path}"')
+    e.emit(0)
+    e.emit(0, f"namespace {struct.package}")
+    e.emit(0, "{")
+    e.emit(0)
+    e.emit(0, "/**")
+    e.emit(0, f" * Zero-copy read-only view of an encoded {struct.full_name}.")
+    e.emit(0, " *")
+    e.emit(0, " * Strings and variable-length arrays point into the buffer given to decode(),")
+    e.emit(0, " * which must outlive the view. Decoding validates the whole message once and")
+    e.emit(0, " * never allocates.")
+    e.emit(0, " */")
+    e.emit(0, f"class {view}")
+    e.emit(0, "{")
+    e.emit(1, "public:")
+    for member in struct.members:
+        if member.is_array:
+            lcm_type = member.type + "".join(f"[{d.size}]" for d in member.dimensions)
+            e.emit(2, "/**")
+            e.emit(2, f" * LCM Type: {lcm_type}")
+            e.emit(2, " */")
+        suffix = f"[{member.dimensions[0].size}]" if member.is_primitive and member.is_array and not member.is_variable_array else ""
+        e.emit(2, f"{_member_view_type(member, types):<10} {member.name}{suffix};")
+        e.emit(0)
+    e.emit(1, "public:")
+    e.emit(2, "/**")
+    e.emit(2, " * Decode a view over a message in binary form.")
+    e.emit(2, " *")
+    e.emit(2, " * @param buf The buffer containing the encoded message. It must outlive")
+    e.emit(2, " *  this view.")
+    e.emit(2, " * @param offset The byte offset into @p buf where the encoded message starts.")
+    e.emit(2, " * @param maxlen The maximum number of bytes to read while decoding.")
+    e.emit(2, " * @return The number of bytes decoded, or <0 if an error occured.")
+    e.emit(2, " */")
+    e.emit(2, "inline int decode(const void *buf, int offset, int maxlen);")
+    e.emit(0)
+    e.emit(2, "/**")
+    e.emit(2, f" * Copy the viewed message into an owning {name}.")
+    e.emit(2, " */")
+    e.emit(2, f"inline void copyTo({name} &msg) const;")
+    e.emit(0)
+    e.emit(2, "/**")
+    e.emit(2, f" * Returns {name}::getHash()")
+    e.emit(2, " */")
+    e.emit(2, "inline static int64_t getHash();")
+    e.emit(0)
+    e.emit(2, "/**")
+    e.emit(2, f" * Returns \"{name}\"")
+    e.emit(2, " */")
+    e.emit(2, "inline static const char* getTypeName();")
+    e.emit(0)
+    e.emit(2, "// LCM support functions. Users should not call these")
+    e.emit(2, "inline int _decodeNoHash(const void *buf, int offset, int maxlen);")
+    e.emit(0, "};")
+    e.emit(0)
+
+    e.emit(0, f"int {view}::decode(const void *buf, int offset, int maxlen)")
+    e.emit(0, "{")
+    e.emit(1, "int pos = 0, thislen;")
+    e.emit(0)
+    e.emit(1, "int64_t msg_hash;")
+    e.emit(1, "thislen = __int64_t_decode_array(buf, offset + pos, maxlen - pos, &msg_hash, 1);")
+    e.emit(1, "if (thislen < 0) return thislen; else pos += thislen;")
+    e.emit(1, "if (msg_hash != getHash()) return -1;")
+    e.emit(0)
+    e.emit(1, "thislen = this->_decodeNoHash(buf, offset + pos, maxlen - pos);")
+    e.emit(1, "if (thislen < 0) return thislen; else pos += thislen;")
+    e.emit(0)
+    e.emit(1, "return pos;")
+    e.emit(0, "}")
+    e.emit(0)
+
+    e.emit(0, f"void {view}::copyTo({name} &msg) const")
+    e.emit(0, "{")
+    for member in struct.members:
+        _emit_copy_member(e, member, types)
+    e.emit(0, "}")
+    e.emit(0)
+
+    e.emit(0, f"int64_t {view}::getHash()")
+    e.emit(0, "{")
+    e.emit(1, f"return {name}::getHash();")
+    e.emit(0, "}")
+    e.emit(0)
+    e.emit(0, f"const char* {view}::getTypeName()")
+    e.emit(0, "{")
+    e.emit(1, f'return "{name}";')
+    e.emit(0, "}")
+    e.emit(0)
+
+    e.emit(0, f"int {view}::_decodeNoHash(const void *buf, int offset, int maxlen)")
+    e.emit(0, "{")
+    e.emit(1, "int pos = 0, tlen;")
+    e.emit(0)
+    for member in struct.members:
+        _emit_decode_member(e, member, types)
+    e.emit(1, "return pos;")
+    e.emit(0, "}")
+    e.emit(0)
+    e.emit(0, "}")
+    e.emit(0)
+    e.emit(0, "#endif")
+    return e.text()
+
+
+def view_file_name(struct: LcmStruct) -> str:
+    return header_path(struct.full_name, VIEW_SUFFIX)
+
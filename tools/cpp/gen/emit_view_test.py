@@ -0,0 +1,39 @@
+import glob
+import os
+import unittest
+
+from emit_view import emit_view, is_plain, view_types
+from lcm_parser import load_types
+
+LCM_TYPES_DIR = os.path.join(os.path.dirname(__file__), "..", "..", "..", "lcm_types")
+
+
+class EmitViewTest(unittest.TestCase):
+    @classmethod
+    def setUpClass(cls):
+        cls.types = load_types(glob.glob(os.path.join(LCM_TYPES_DIR, "*.lcm")))
+
+    def test_view_types(self):
+        names = view_types(self.types)
+        for name in ("sensor_msgs.Image", "sensor_msgs.PointCloud2", "nav_msgs.OccupancyGrid", "std_msgs.Header"):
+            self.assertIn(name, names)
+        # Fixed-size types are decoded by value and need no view
+        self.assertNotIn("std_msgs.Time", names)
+        self.assertTrue(is_plain(self.types["nav_msgs.MapMetaData"], self.types))
+
+    def test_image_view(self):
+        out = emit_view(self.types["sensor_msgs.Image"], self.types)
+        self.assertIn("class ImageView", out)
+        self.assertIn("std_msgs::HeaderView header;", out)
+        self.assertIn("std::string_view encoding;", out)
+        self.assertIn("dimos_lcm::span< const uint8_t > data;", out)
+        self.assertIn("if(this->data_length < 0 || this->data_length > maxlen - pos) return -1;", out)
+
+    def test_struct_array_view(self):
+        out = emit_view(self.types["sensor_msgs.PointCloud2"], self.types)
+        self.assertIn("dimos_lcm::view_array< sensor_msgs::PointFieldView > fields;", out)
+        self.assertIn('#include "sensor_msgs/PointFieldView.hpp"', out)
+
+
+if __name__ == "__main__":
+    unittest.main()
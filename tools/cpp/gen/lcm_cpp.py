@@ -0,0 +1,107 @@
+#!/usr/bin/env python3
+"""
+lcm-cpp - C++ code generator for LCM types
+
+Emits the C++ message classes (a port of lcm-gen's C++ backend), their
+companion headers (std::pmr, structure-of-arrays, copy-on-write and
+interned string flavors, zero-copy views, ...) and a registry of all types by
+fingerprint, and installs the dimos_lcm/ runtime headers they depend on.
+
+Usage:
+    lcm_cpp.py [-q] -o <dir> <input.lcm...>
+"""
+
+import argparse
+import os
+import shutil
+import sys
+
+from cpp_util import columns_types, cow_types, interned_types, soa_types
+from emit_cpp import (
+    cow_file_name,
+    cpp_file_name,
+    emit_cow,
+    emit_cpp,
+    emit_interned,
+    emit_pmr,
+    emit_soa,
+    interned_file_name,
+    pmr_file_name,
+    soa_file_name,
+)
+from emit_registry import emit_registry, registry_file_name
+from emit_soa import columns_file_name, emit_columns
+from emit_view import emit_view, view_file_name, view_types
+from lcm_parser import load_types
+
+SCRIPT_DIR = os.path.dirname(os.path.abspath(__file__))
+RUNTIME_DIR = os.path.join(os.path.dirname(SCRIPT_DIR), "runtime", "dimos_lcm")
+
+
+def write_file(output_dir: str, rel_path: str, content: str, quiet: bool) -> None:
+    path = os.path.join(output_dir, rel_path)
+    os.makedirs(os.path.dirname(path), exist_ok=True)
+    with open(path, "w") as f:
+        f.write(content)
+    if not quiet:
+        print(f"Generated: {path}")
+
+
+def main() -> int:
+    parser = argparse.ArgumentParser(description="LCM C++ code generator")
+    parser.add_argument("-o", "--output", default=".", help="Output directory (default: .)")
+    parser.add_argument("-q", "--quiet", action="store_true", help="Suppress per-file output messages")
+    parser.add_argument("inputs", nargs="+", help="Input .lcm files")
+    args = parser.parse_args()
+
+    try:
+        types = load_types(args.inputs)
+    except (OSError, ValueError) as e:
+        print(f"Error parsing LCM files: {e}", file=sys.stderr)
+        return 1
+
+    count = 0
+    for name in sorted(types):
+        struct = types[name]
+        write_file(args.output, cpp_file_name(struct), emit_cpp(struct, types), args.quiet)
+        write_file(args.output, pmr_file_name(struct), emit_pmr(struct, types), args.quiet)
+        count += 2
+
+    for name in sorted(soa_types(types)):
+        struct = types[name]
+        write_file(args.output, soa_file_name(struct), emit_soa(struct, types), args.quiet)
+        count += 1
+
+    for name in sorted(columns_types(types)):
+        struct = types[name]
+        write_file(args.output, columns_file_name(struct), emit_columns(struct, types), args.quiet)
+        count += 1
+
+    for name in sorted(cow_types(types)):
+        struct = types[name]
+        write_file(args.output, cow_file_name(struct), emit_cow(struct, types), args.quiet)
+        count += 1
+
+    for name in sorted(interned_types(types)):
+        struct = types[name]
+        write_file(args.output, interned_file_name(struct), emit_interned(struct, types), args.quiet)
+        count += 1
+
+    for name in sorted(view_types(types)):
+        struct = types[name]
+        write_file(args.output, view_file_name(struct), emit_view(struct, types), args.quiet)
+        count += 1
+
+    runtime_out = os.path.join(args.output, "dimos_lcm")
+    shutil.rmtree(runtime_out, ignore_errors=True)
+    shutil.copytree(RUNTIME_DIR, runtime_out)
+    write_file(args.output, registry_file_name(), emit_registry(types), args.quiet)
+    count += 1
+
+    if not args.quiet:
+        print(f"\nGenerated {count} headers for {len(types)} types")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
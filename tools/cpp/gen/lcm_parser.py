@@ -0,0 +1,263 @@
+"""
+LCM file parser for the C++ companion generator.
+
+Mirrors tools/ts/gen/parser.ts: tokenizes .lcm sources into structs with
+members, dimensions and constants, and computes the base fingerprint the
+same way lcmgen.c does.
+"""
+
+import re
+from dataclasses import dataclass, field
+from typing import Dict, List, Optional, Tuple
+
+LCM_PRIMITIVES = (
+    "int8_t",
+    "int16_t",
+    "int32_t",
+    "int64_t",
+    "float",
+    "double",
+    "string",
+    "boolean",
+    "byte",
+)
+
+# Encoded width in bytes of each fixed-width primitive (string is variable).
+PRIMITIVE_SIZES = {
+    "int8_t": 1,
+    "byte": 1,
+    "boolean": 1,
+    "int16_t": 2,
+    "int32_t": 4,
+    "float": 4,
+    "int64_t": 8,
+    "double": 8,
+}
+
+MASK64 = 0xFFFFFFFFFFFFFFFF
+
+
+def is_primitive(type_name: str) -> bool:
+    return type_name in LCM_PRIMITIVES
+
+
+@dataclass
+class LcmDimension:
+    size: str
+    is_constant: bool  # True if numeric literal, False if refers to a field
+
+
+@dataclass
+class LcmMember:
+    type: str  # primitive name or fully qualified "package.Name"
+    name: str
+    dimensions: List[LcmDimension] = field(default_factory=list)
+
+    @property
+    def is_primitive(self) -> bool:
+        return is_primitive(self.type)
+
+    @property
+    def is_array(self) -> bool:
+        return len(self.dimensions) > 0
+
+    @property
+    def is_variable_array(self) -> bool:
+        return any(not d.is_constant for d in self.dimensions)
+
+
+@dataclass
+class LcmConstant:
+    type: str
+    name: str
+    value: str
+
+
+@dataclass
+class LcmStruct:
+    package: str
+    name: str
+    members: List[LcmMember] = field(default_factory=list)
+    constants: List[LcmConstant] = field(default_factory=list)
+    hash: int = 0  # base hash, nested types are folded in by the generated code
+
+    @property
+    def full_name(self) -> str:
+        return f"{self.package}.{self.name}" if self.package else self.name
+
+    def member(self, name: str) -> Optional[LcmMember]:
+        for m in self.members:
+            if m.name == name:
+                return m
+        return None
+
+
+@dataclass
+class LcmFile:
+    package: str
+    structs: List[LcmStruct] = field(default_factory=list)
+
+
+_TOKEN_RE = re.compile(
+    r"//[^\n]*|/\*[\s\S]*?\*/|\"[^\"]*\"|'[^']*'|[a-zA-Z_][a-zA-Z0-9_]*"
+    r"|0x[0-9a-fA-F]+|[0-9]+\.?[0-9]*(?:[eE][+-]?[0-9]+)?|[{}\[\];,=.\-]"
+)
+
+
+class _Tokenizer:
+    def __init__(self, source: str):
+        self.tokens = [
+            t for t in _TOKEN_RE.findall(source) if not (t.startswith("//") or t.startswith("/*"))
+        ]
+        self.pos = 0
+
+    def peek(self, offset: int = 0) -> Optional[str]:
+        i = self.pos + offset
+        return self.tokens[i] if i < len(self.tokens) else None
+
+    def next(self) -> str:
+        if self.pos >= len(self.tokens):
+            raise ValueError("Unexpected end of input")
+        token = self.tokens[self.pos]
+        self.pos += 1
+        return token
+
+    def expect(self, expected: str) -> None:
+        token = self.next()
+        if token != expected:
+            raise ValueError(f"Expected '{expected}', got '{token}'")
+
+    def has_more(self) -> bool:
+        return self.pos < len(self.tokens)
+
+
+# LCM hash algorithm - matches the C implementation in lcmgen.c
+# hash_update: v = ((v << 8) ^ (v >> 55)) + c, with a signed (arithmetic) shift
+def _hash_update(v: int, c: int) -> int:
+    signed = v - (1 << 64) if v & (1 << 63) else v
+    return ((((v << 8) & MASK64) ^ ((signed >> 55) & MASK64)) + c) & MASK64
+
+
+def _hash_string_update(v: int, s: str) -> int:
+    v = _hash_update(v, len(s))
+    for ch in s:
+        v = _hash_update(v, ord(ch))
+    return v
+
+
+def compute_struct_hash(struct: LcmStruct) -> int:
+    v = 0x12345678
+    for member in struct.members:
+        v = _hash_string_update(v, member.name)
+        # Nested type names are not hashed, their fingerprints are added recursively
+        if member.is_primitive:
+            v = _hash_string_update(v, member.type)
+        v = _hash_update(v, len(member.dimensions))
+        for dim in member.dimensions:
+            # LCM_CONST = 0, LCM_VAR = 1
+            v = _hash_update(v, 0 if dim.is_constant else 1)
+            v = _hash_string_update(v, dim.size)
+    return v
+
+
+def compute_fingerprint(struct: LcmStruct, types: Dict[str, LcmStruct], parents: Tuple[str, ...] = ()) -> int:
+    """Full fingerprint as returned by getHash(): the base hash plus the
+    fingerprints of nested types, rotated left by one bit."""
+    if struct.full_name in parents:
+        return 0
+    parents = parents + (struct.full_name,)
+    v = struct.hash
+    for member in struct.members:
+        if not member.is_primitive:
+            v = (v + compute_fingerprint(types[member.type], types, parents)) & MASK64
+    return ((v << 1) & MASK64) | (v >> 63)
+
+
+def parse(source: str) -> LcmFile:
+    tokenizer = _Tokenizer(source)
+    package = ""
+    structs: List[LcmStruct] = []
+
+    while tokenizer.has_more():
+        token = tokenizer.next()
+        if token == "package":
+            package = tokenizer.next()
+            tokenizer.expect(";")
+        elif token == "struct":
+            structs.append(_parse_struct(tokenizer, package))
+        else:
+            raise ValueError(f"Unexpected token: {token}")
+
+    for struct in structs:
+        struct.hash = compute_struct_hash(struct)
+
+    return LcmFile(package=package, structs=structs)
+
+
+def _parse_struct(tokenizer: _Tokenizer, package: str) -> LcmStruct:
+    struct = LcmStruct(package=package, name=tokenizer.next())
+    tokenizer.expect("{")
+
+    while tokenizer.peek() != "}":
+        if tokenizer.peek() == "const":
+            tokenizer.next()
+            _parse_constants(tokenizer, struct.constants)
+        else:
+            struct.members.append(_parse_member(tokenizer, package))
+
+    tokenizer.expect("}")
+    return struct
+
+
+def _parse_constants(tokenizer: _Tokenizer, constants: List[LcmConstant]) -> None:
+    const_type = tokenizer.next()
+    while True:
+        name = tokenizer.next()
+        tokenizer.expect("=")
+        value = tokenizer.next()
+        if value == "-":
+            value = "-" + tokenizer.next()
+        constants.append(LcmConstant(type=const_type, name=name, value=value))
+        if tokenizer.peek() != ",":
+            break
+        tokenizer.next()
+    tokenizer.expect(";")
+
+
+def _parse_qualified_name(tokenizer: _Tokenizer) -> str:
+    name = tokenizer.next()
+    while tokenizer.peek() == ".":
+        tokenizer.next()
+        name += "." + tokenizer.next()
+    return name
+
+
+def _parse_member(tokenizer: _Tokenizer, package: str) -> LcmMember:
+    member_type = _parse_qualified_name(tokenizer)
+    # Unqualified nested types live in the enclosing package, as in lcm-gen
+    if not is_primitive(member_type) and "." not in member_type and package:
+        member_type = f"{package}.{member_type}"
+    member = LcmMember(type=member_type, name=tokenizer.next())
+
+    while tokenizer.peek() == "[":
+        tokenizer.next()
+        size = tokenizer.next()
+        tokenizer.expect("]")
+        member.dimensions.append(LcmDimension(size=size, is_constant=size.isdigit()))
+
+    tokenizer.expect(";")
+    return member
+
+
+def parse_file(path: str) -> LcmFile:
+    with open(path, "r") as f:
+        return parse(f.read())
+
+
+def load_types(paths: List[str]) -> Dict[str, LcmStruct]:
+    """Parse every file and index the structs by fully qualified name."""
+    types: Dict[str, LcmStruct] = {}
+    for path in paths:
+        for struct in parse_file(path).structs:
+            types[struct.full_name] = struct
+    return types
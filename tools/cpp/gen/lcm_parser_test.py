@@ -0,0 +1,55 @@
+import glob
+import os
+import unittest
+
+from lcm_parser import compute_fingerprint, load_types, parse
+
+LCM_TYPES_DIR = os.path.join(os.path.dirname(__file__), "..", "..", "..", "lcm_types")
+
+
+class ParserTest(unittest.TestCase):
+    def test_parse_struct(self):
+        result = parse(
+            """
+            package test;
+            struct arrays_t {
+                const int8_t MODE = -1;
+                int32_t data_length;
+                double position[3];
+                byte data[data_length];
+                Other nested;
+            }
+            """
+        )
+        self.assertEqual(result.package, "test")
+        struct = result.structs[0]
+        self.assertEqual(struct.full_name, "test.arrays_t")
+        self.assertEqual(struct.constants[0].value, "-1")
+        self.assertTrue(struct.member("position").dimensions[0].is_constant)
+        self.assertTrue(struct.member("data").is_variable_array)
+        self.assertEqual(struct.member("nested").type, "test.Other")
+
+    def test_hash_matches_lcm_gen(self):
+        # Base hashes as emitted by lcm-gen into the _computeHash() of each type
+        types = load_types(
+            [
+                os.path.join(LCM_TYPES_DIR, "sensor_msgs_Image.lcm"),
+                os.path.join(LCM_TYPES_DIR, "geometry_msgs_Point.lcm"),
+            ]
+        )
+        self.assertEqual(types["sensor_msgs.Image"].hash, 0x79D36C21D3C16094)
+        self.assertEqual(types["geometry_msgs.Point"].hash, 0x573F2FDD2F76508F)
+
+    def test_fingerprint_matches_lcm_gen(self):
+        # getHash() of the lcm-gen C++ and Python bindings
+        types = load_types(glob.glob(os.path.join(LCM_TYPES_DIR, "*.lcm")))
+        self.assertEqual(compute_fingerprint(types["std_msgs.Header"], types), 0x2FDB11453BE64AF7)
+        self.assertEqual(compute_fingerprint(types["sensor_msgs.Image"], types), 0x535CFACE1F4F5717)
+
+    def test_unexpected_token(self):
+        with self.assertRaises(ValueError):
+            parse("package test; union u {}")
+
+
+if __name__ == "__main__":
+    unittest.main()
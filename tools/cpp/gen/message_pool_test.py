@@ -0,0 +1,72 @@
+import unittest
+
+from cpp_program import compiler, run_program
+
+# Decodes a message with a payload into a pooled instance, recycles it and
+# decodes one without a payload into the same instance
+PROGRAM = r"""
+#include <cstdio>
+#include <vector>
+
+#include "dimos_lcm/message_pool.hpp"
+#include "sensor_msgs/Image.hpp"
+#include "sensor_msgs/JointState.hpp"
+
+template <typename Msg>
+std::vector<uint8_t> encoded(const Msg &msg)
+{
+    std::vector<uint8_t> buf(msg.getEncodedSize());
+    msg.encode(buf.data(), 0, static_cast<int>(buf.size()));
+    return buf;
+}
+
+template <typename Msg>
+bool decode(dimos_lcm::message_pool<Msg> &pool, const std::vector<uint8_t> &buf, Msg *&last)
+{
+    std::shared_ptr<Msg> msg = pool.acquire();
+    last = msg.get();
+    return msg->decode(buf.data(), 0, static_cast<int>(buf.size())) == static_cast<int>(buf.size());
+}
+
+int main()
+{
+    sensor_msgs::Image image = {};
+    image.data_length = 6;
+    image.data.assign(6, 7);
+    sensor_msgs::Image empty_image = {};
+
+    dimos_lcm::message_pool<sensor_msgs::Image> images;
+    sensor_msgs::Image *first, *second;
+    if (!decode(images, encoded(image), first) || !decode(images, encoded(empty_image), second))
+        return 1;
+    if (first != second)
+        return 2;
+    if (second->data_length != 0 || !second->data.empty())
+        return 3;
+
+    sensor_msgs::JointState joints = {};
+    joints.position_length = 3;
+    joints.position.assign(3, 1.5);
+    sensor_msgs::JointState empty_joints = {};
+
+    dimos_lcm::message_pool<sensor_msgs::JointState> states;
+    sensor_msgs::JointState *a, *b;
+    if (!decode(states, encoded(joints), a) || !decode(states, encoded(empty_joints), b))
+        return 4;
+    if (a != b)
+        return 5;
+    if (b->position_length != 0 || !b->position.empty())
+        return 6;
+    return 0;
+}
+"""
+
+
+@unittest.skipUnless(compiler(), "needs a C++17 compiler and the LCM headers")
+class MessagePoolTest(unittest.TestCase):
+    def test_recycled_message_drops_previous_payload(self):
+        self.assertEqual(run_program(PROGRAM, "message_pool_test"), 0)
+
+
+if __name__ == "__main__":
+    unittest.main()
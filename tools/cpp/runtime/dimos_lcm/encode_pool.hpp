@@ -0,0 +1,289 @@
+/**
+ * Recycled encode buffers for publishers of variable-size types.
+ *
+ * Encoding into a fresh getEncodedSize() buffer per publish allocates it and,
+ * for large messages, faults in every page of it again. The pool keeps the
+ * buffers of one message type around, sized from the encoded sizes it has
+ * seen recently, so a steady stream of MarkerArrays, PointCloud2s or
+ * TFMessages is encoded into memory that is already mapped.
+ **/
+
+#ifndef __dimos_lcm_encode_pool_hpp__
+#define __dimos_lcm_encode_pool_hpp__
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <utility>
+#include <vector>
+
+namespace dimos_lcm
+{
+
+/**
+ * A thread-safe pool of encode buffers for messages of type @p T.
+ *
+ * acquire() hands out a buffer of at least the requested size and the
+ * buffer goes back to the pool when its handle is destroyed. Buffers are
+ * aligned to a cache line, and every page of a new one is touched before it
+ * is handed out.
+ *
+ * New buffers are sized for the high-water mark of recent requests plus an
+ * eighth, rounded up to a page, so messages that vary in size around a
+ * steady mean fit the buffers already in the pool. The mark decays by 1/32 on
+ * each request; a buffer more than four times the mark is freed instead of
+ * kept when it comes back, so a burst of large messages does not hold on to
+ * memory. allocations() counts the buffers the pool has allocated; it stops
+ * growing once the pool holds as many as are in use at a time.
+ *
+ *     dimos_lcm::encode_pool<sensor_msgs::PointCloud2> pool;
+ *
+ *     void publish(lcm::LCM &lcm, const sensor_msgs::PointCloud2 &cloud)
+ *     {
+ *         dimos_lcm::encode_pool<sensor_msgs::PointCloud2>::buffer buf = pool.encode(cloud);
+ *         lcm.publish("points", buf.data(), static_cast<unsigned int>(buf.size()));
+ *     }
+ */
+template <typename T>
+class encode_pool
+{
+    public:
+        static const size_t kAlignment = 64;
+        static const size_t kPageSize = 4096;
+
+    private:
+        struct block
+        {
+            uint8_t *data;
+            size_t capacity;
+        };
+
+        struct state
+        {
+            std::mutex mutex;
+            std::vector<block> blocks;
+            size_t high_water = 0;
+            size_t created = 0;
+            size_t allocations = 0;
+
+            ~state()
+            {
+                for (const block &b : blocks)
+                    release(b);
+            }
+
+            // Room for @p n bytes, or for the high-water mark plus an eighth
+            size_t capacity_for(size_t n) const
+            {
+                size_t capacity = high_water + high_water / 8;
+                if (capacity < n)
+                    capacity = n;
+                return (capacity + kPageSize - 1) / kPageSize * kPageSize;
+            }
+
+            static block allocate(size_t capacity)
+            {
+                uint8_t *data = static_cast<uint8_t *>(::operator new(capacity, std::align_val_t(kAlignment)));
+                // Fault the pages in now rather than on the first encode
+                for (size_t i = 0; i < capacity; i += kPageSize)
+                    data[i] = 0;
+                block b = { data, capacity };
+                return b;
+            }
+
+            static void release(const block &b)
+            {
+                ::operator delete(b.data, std::align_val_t(kAlignment));
+            }
+        };
+
+    public:
+        /**
+         * An encode buffer from the pool, returned to it on destruction.
+         */
+        class buffer
+        {
+            public:
+                buffer() : block_(), size_(0) {}
+
+                buffer(buffer &&other) noexcept
+                    : pool_(std::move(other.pool_)), block_(other.block_), size_(other.size_)
+                {
+                    other.block_ = block();
+                    other.size_ = 0;
+                }
+
+                buffer &operator=(buffer &&other) noexcept
+                {
+                    if (this != &other) {
+                        reset();
+                        pool_ = std::move(other.pool_);
+                        block_ = other.block_;
+                        size_ = other.size_;
+                        other.block_ = block();
+                        other.size_ = 0;
+                    }
+                    return *this;
+                }
+
+                ~buffer() { reset(); }
+
+                uint8_t *data() const { return block_.data; }
+
+                /**
+                 * Number of bytes requested, or encoded by encode_pool::encode().
+                 */
+                size_t size() const { return size_; }
+
+                size_t capacity() const { return block_.capacity; }
+
+                /**
+                 * Give the buffer back to the pool now.
+                 */
+                void reset()
+                {
+                    if (!block_.data)
+                        return;
+                    {
+                        std::lock_guard<std::mutex> lock(pool_->mutex);
+                        if (block_.capacity <= 4 * pool_->high_water) {
+                            // Reserved when the buffer was created: does not allocate
+                            pool_->blocks.push_back(block_);
+                            block_ = block();
+                        } else {
+                            pool_->created--;
+                        }
+                    }
+                    if (block_.data)
+                        state::release(block_);
+                    block_ = block();
+                    size_ = 0;
+                    pool_.reset();
+                }
+
+            private:
+                friend class encode_pool;
+
+                buffer(std::shared_ptr<state> pool, block b, size_t size)
+                    : pool_(std::move(pool)), block_(b), size_(size) {}
+
+                std::shared_ptr<state> pool_;
+                block block_;
+                size_t size_;
+        };
+
+        /**
+         * Create a pool holding @p reserve buffers of @p size bytes.
+         */
+        explicit encode_pool(size_t reserve = 0, size_t size = 0) : pool_(std::make_shared<state>())
+        {
+            std::vector<buffer> warm;
+            warm.reserve(reserve);
+            for (size_t i = 0; i < reserve; i++)
+                warm.push_back(acquire(size));
+        }
+
+        encode_pool(const encode_pool &) = delete;
+        encode_pool &operator=(const encode_pool &) = delete;
+
+        /**
+         * The pool shared by every publisher of @p T in the process.
+         */
+        static encode_pool &shared()
+        {
+            static encode_pool pool;
+            return pool;
+        }
+
+        /**
+         * A buffer of at least @p n bytes, taken from the pool if the most
+         * recently returned one is large enough.
+         */
+        buffer acquire(size_t n)
+        {
+            block b = block();
+            block stale = block();
+            size_t capacity = 0;
+            {
+                std::lock_guard<std::mutex> lock(pool_->mutex);
+                size_t mark = pool_->high_water - pool_->high_water / 32;
+                pool_->high_water = n > mark ? n : mark;
+                if (!pool_->blocks.empty()) {
+                    b = pool_->blocks.back();
+                    pool_->blocks.pop_back();
+                    if (b.capacity < n) {
+                        stale = b;
+                        b = block();
+                    }
+                }
+                if (!b.data) {
+                    if (!stale.data)
+                        pool_->created++;
+                    pool_->allocations++;
+                    pool_->blocks.reserve(pool_->created);
+                    capacity = pool_->capacity_for(n);
+                }
+            }
+            if (stale.data)
+                state::release(stale);
+            if (!b.data) {
+                try {
+                    b = state::allocate(capacity);
+                } catch (...) {
+                    std::lock_guard<std::mutex> lock(pool_->mutex);
+                    pool_->created--;
+                    throw;
+                }
+            }
+            return buffer(pool_, b, n);
+        }
+
+        /**
+         * Encode @p msg into a buffer from the pool.
+         */
+        buffer encode(const T &msg)
+        {
+            int n = msg.getEncodedSize();
+            buffer buf = acquire(static_cast<size_t>(n));
+            int encoded = msg.encode(buf.data(), 0, n);
+            buf.size_ = encoded < 0 ? 0 : static_cast<size_t>(encoded);
+            return buf;
+        }
+
+        /**
+         * Number of buffers waiting in the pool.
+         */
+        size_t available() const
+        {
+            std::lock_guard<std::mutex> lock(pool_->mutex);
+            return pool_->blocks.size();
+        }
+
+        /**
+         * Number of buffers the pool has allocated. Constant in steady state.
+         */
+        size_t allocations() const
+        {
+            std::lock_guard<std::mutex> lock(pool_->mutex);
+            return pool_->allocations;
+        }
+
+        /**
+         * The decaying high-water mark of the sizes requested, which new
+         * buffers are sized from.
+         */
+        size_t high_water() const
+        {
+            std::lock_guard<std::mutex> lock(pool_->mutex);
+            return pool_->high_water;
+        }
+
+    private:
+        std::shared_ptr<state> pool_;
+};
+
+}
+
+#endif
@@ -0,0 +1,110 @@
+/**
+ * Compile-time evaluation of the LCM type fingerprint.
+ *
+ * Each generated class declares its fingerprint as the constant kHash. The
+ * header then checks it with a static_assert that recomputes it from the
+ * member list and the kHash of the nested types, in the same way as lcm-gen's
+ * hash_update()/_computeHash().
+ *
+ * Every function is a single return statement, so the generated classes keep
+ * compiling as C++11.
+ **/
+
+#ifndef __dimos_lcm_fingerprint_hpp__
+#define __dimos_lcm_fingerprint_hpp__
+
+#include <stdint.h>
+
+namespace dimos_lcm
+{
+
+/**
+ * Base hash of a struct definition, built one member at a time:
+ *
+ *     signature_hash().member("x", "double", 0).member("data", "byte", 1).dim(true, "data_length")
+ */
+class signature_hash
+{
+    public:
+        constexpr signature_hash() : v_(0x12345678) {}
+
+        /**
+         * Add a member. @p type is the LCM primitive type name, or NULL for
+         * a nested struct, whose name is not part of the hash. Follow it with
+         * one dim() per array dimension.
+         */
+        constexpr signature_hash member(const char *name, const char *type, int ndim) const
+        {
+            return signature_hash(update(
+                type ? update_string(update_string(v_, name), type) : update_string(v_, name),
+                static_cast<char>(ndim)));
+        }
+
+        constexpr signature_hash dim(bool variable, const char *size) const
+        {
+            return signature_hash(update_string(update(v_, variable ? 1 : 0), size));
+        }
+
+        constexpr uint64_t value() const { return v_; }
+
+    private:
+        constexpr explicit signature_hash(uint64_t v) : v_(v) {}
+
+        static constexpr uint64_t update(uint64_t v, char c)
+        {
+            return ((v << 8) ^ static_cast<uint64_t>(static_cast<int64_t>(v) >> 55)) +
+                static_cast<uint64_t>(static_cast<int64_t>(c));
+        }
+
+        static constexpr int length(const char *s)
+        {
+            return *s ? 1 + length(s + 1) : 0;
+        }
+
+        static constexpr uint64_t update_chars(uint64_t v, const char *s)
+        {
+            return *s ? update_chars(update(v, *s), s + 1) : v;
+        }
+
+        static constexpr uint64_t update_string(uint64_t v, const char *s)
+        {
+            return update_chars(update(v, static_cast<char>(length(s))), s);
+        }
+
+        uint64_t v_;
+};
+
+namespace detail
+{
+
+constexpr uint64_t sum_hashes(uint64_t sum)
+{
+    return sum;
+}
+
+template <typename... Nested>
+constexpr uint64_t sum_hashes(uint64_t sum, int64_t first, Nested... rest)
+{
+    return sum_hashes(sum + static_cast<uint64_t>(first), rest...);
+}
+
+constexpr int64_t rotate_hash(uint64_t hash)
+{
+    return static_cast<int64_t>((hash << 1) + ((hash >> 63) & 1));
+}
+
+}
+
+/**
+ * Fingerprint of a struct from its base hash and the fingerprints of the
+ * structs it nests, as computed by the generated _computeHash().
+ */
+template <typename... Nested>
+constexpr int64_t fingerprint(uint64_t base, Nested... nested)
+{
+    return detail::rotate_hash(detail::sum_hashes(base, nested...));
+}
+
+}
+
+#endif
@@ -0,0 +1,85 @@
+/**
+ * Unchecked big-endian loads and stores for fixed-size messages.
+ *
+ * Types without strings or variable-length arrays have an encoded size known
+ * at generation time. Their generated codec checks the buffer length once and
+ * then reads or writes every field at a constant offset with these helpers,
+ * instead of going through one bounds-checked lcm_coretypes.h call per field.
+ **/
+
+#ifndef __dimos_lcm_fixed_codec_hpp__
+#define __dimos_lcm_fixed_codec_hpp__
+
+#include <lcm/lcm_coretypes.h>
+
+#include <cstddef>
+#include <cstring>
+
+#include "dimos_lcm/bulk_codec.hpp"
+
+namespace dimos_lcm
+{
+
+namespace detail
+{
+
+template <size_t W> struct uint_of;
+template <> struct uint_of<1> { typedef uint8_t type; };
+template <> struct uint_of<2> { typedef uint16_t type; };
+template <> struct uint_of<4> { typedef uint32_t type; };
+template <> struct uint_of<8> { typedef uint64_t type; };
+
+// Single bytes have no byte order; lets store_be() and load_be() swap any width
+inline uint8_t bswap(uint8_t v) { return v; }
+
+}
+
+/**
+ * Write @p v at @p p in LCM wire order. @p p needs no alignment.
+ */
+template <typename T>
+inline void store_be(uint8_t *p, T v)
+{
+    typename detail::uint_of<sizeof(T)>::type u;
+    memcpy(&u, &v, sizeof(u));
+#if !defined(DIMOS_LCM_HOST_BIG_ENDIAN)
+    u = detail::bswap(u);
+#endif
+    memcpy(p, &u, sizeof(u));
+}
+
+/**
+ * Read a value in LCM wire order from @p p into @p v.
+ */
+template <typename T>
+inline void load_be(const uint8_t *p, T &v)
+{
+    typename detail::uint_of<sizeof(T)>::type u;
+    memcpy(&u, p, sizeof(u));
+#if !defined(DIMOS_LCM_HOST_BIG_ENDIAN)
+    u = detail::bswap(u);
+#endif
+    memcpy(&v, &u, sizeof(u));
+}
+
+template <typename T>
+inline void store_be_array(uint8_t *p, const T *v, size_t n)
+{
+    if (sizeof(T) == 1)
+        memcpy(p, v, n);
+    else
+        detail::bswap_copy<sizeof(T)>(p, v, n);
+}
+
+template <typename T>
+inline void load_be_array(const uint8_t *p, T *v, size_t n)
+{
+    if (sizeof(T) == 1)
+        memcpy(v, p, n);
+    else
+        detail::bswap_copy<sizeof(T)>(v, p, n);
+}
+
+}
+
+#endif
@@ -0,0 +1,138 @@
+/**
+ * Scatter-gather output for the generated encodeIov() methods.
+ *
+ * Header fields, lengths and small arrays are encoded into a scratch buffer
+ * owned by the writer. Byte payloads are referenced where they live, so a
+ * writev()/sendmsg() transport can send a message without copying them.
+ **/
+
+#ifndef __dimos_lcm_iov_writer_hpp__
+#define __dimos_lcm_iov_writer_hpp__
+
+#include <lcm/lcm_coretypes.h>
+#include <sys/uio.h>
+
+#include <cstddef>
+#include <cstring>
+#include <vector>
+
+#include "dimos_lcm/writer.hpp"
+
+namespace dimos_lcm
+{
+
+/**
+ * Accumulates an encoded message as a list of iovecs.
+ *
+ * The iovecs point into the writer's scratch buffer and into the messages
+ * that were encoded, so both must stay alive and unmodified until the data
+ * has been sent. Reuse one writer per publisher: clear() keeps the scratch
+ * and iovec storage, so steady-state encoding does not allocate.
+ */
+class iov_writer : public writer_base<iov_writer>
+{
+    public:
+        /**
+         * Payloads shorter than this are copied into the scratch buffer rather
+         * than referenced; an extra iovec costs more than copying them.
+         */
+        static const size_t kMinReference = 256;
+
+        iov_writer() : used_(0), size_(0) {}
+
+        void clear()
+        {
+            used_ = 0;
+            size_ = 0;
+            segments_.clear();
+        }
+
+        /**
+         * Total number of bytes written so far.
+         */
+        size_t size() const { return size_; }
+
+        /**
+         * Number of entries in iov().
+         */
+        int iovcnt() const { return static_cast<int>(segments_.size()); }
+
+        /**
+         * The encoded bytes, in order. Valid until the next write or clear().
+         */
+        const struct iovec *iov()
+        {
+            iov_.resize(segments_.size());
+            for (size_t i = 0; i < segments_.size(); i++) {
+                const segment &s = segments_[i];
+                const uint8_t *base = s.ext ? s.ext : scratch_.data() + s.off;
+                iov_[i].iov_base = const_cast<uint8_t *>(base);
+                iov_[i].iov_len = s.len;
+            }
+            return iov_.data();
+        }
+
+        /**
+         * Copy everything written so far into @p buf, which must hold size()
+         * bytes. The result is what encode() would have produced.
+         */
+        void copyTo(void *buf) const
+        {
+            uint8_t *d = static_cast<uint8_t *>(buf);
+            for (size_t i = 0; i < segments_.size(); i++) {
+                const segment &s = segments_[i];
+                memcpy(d, s.ext ? s.ext : scratch_.data() + s.off, s.len);
+                d += s.len;
+            }
+        }
+
+        /**
+         * Append @p n bytes that the caller keeps alive, without copying them.
+         */
+        void reference(const void *p, size_t n)
+        {
+            if (n < kMinReference) {
+                memcpy(extend(n), p, n);
+                return;
+            }
+            segment s = { static_cast<const uint8_t *>(p), 0, n };
+            segments_.push_back(s);
+            size_ += n;
+        }
+
+        /**
+         * Reserve @p n bytes at the end of the scratch buffer.
+         */
+        uint8_t *extend(size_t n)
+        {
+            if (used_ + n > scratch_.size())
+                scratch_.resize(used_ + n > 2 * scratch_.size() ? used_ + n : 2 * scratch_.size());
+            if (segments_.empty() || segments_.back().ext) {
+                segment s = { NULL, used_, 0 };
+                segments_.push_back(s);
+            }
+            segments_.back().len += n;
+            uint8_t *p = scratch_.data() + used_;
+            used_ += n;
+            size_ += n;
+            return p;
+        }
+
+    private:
+        struct segment
+        {
+            const uint8_t *ext;  // NULL for a run of the scratch buffer
+            size_t off;
+            size_t len;
+        };
+
+        std::vector<uint8_t> scratch_;
+        size_t used_;
+        size_t size_;
+        std::vector<segment> segments_;
+        std::vector<struct iovec> iov_;
+};
+
+}
+
+#endif
@@ -0,0 +1,386 @@
+/**
+ * JSON encoding of the generated message classes.
+ *
+ * Messages are written through their field reflection (dimos_lcm/reflection.hpp)
+ * in the shape the Foxglove bridge's generic converter gives them: an object
+ * per message with its fields in wire order, array length fields left out,
+ * byte arrays as base64 strings and boolean fields as true/false. Numbers are
+ * printed with std::to_chars, in the shortest form that reads back to the same
+ * value, and base64 goes through dimos_lcm/base64.hpp.
+ **/
+
+#ifndef __dimos_lcm_json_writer_hpp__
+#define __dimos_lcm_json_writer_hpp__
+
+#include <charconv>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+#include "dimos_lcm/base64.hpp"
+#include "dimos_lcm/cow_array.hpp"
+#include "dimos_lcm/interned_string.hpp"
+#include "dimos_lcm/reflection.hpp"
+
+namespace dimos_lcm
+{
+
+namespace detail
+{
+
+constexpr bool str_equal(const char *a, const char *b)
+{
+    while (*a && *a == *b) {
+        a++;
+        b++;
+    }
+    return *a == *b;
+}
+
+// Bit i set for each field i of Msg that holds another field's array length
+template <typename Msg>
+constexpr uint64_t json_length_fields()
+{
+    uint64_t mask = 0;
+    for (size_t i = 0; i < Msg::kFields.size(); i++) {
+        for (size_t j = 0; j < Msg::kFields.size(); j++) {
+            if (Msg::kFields[j].length && str_equal(Msg::kFields[j].length, Msg::kFields[i].name))
+                mask |= 1ULL << i;
+        }
+    }
+    return mask;
+}
+
+// Bit i set for each boolean field i of Msg, which is stored as int8_t
+template <typename Msg>
+constexpr uint64_t json_boolean_fields()
+{
+    uint64_t mask = 0;
+    for (size_t i = 0; i < Msg::kFields.size(); i++) {
+        if (str_equal(Msg::kFields[i].type, "boolean"))
+            mask |= 1ULL << i;
+    }
+    return mask;
+}
+
+// Longest std::to_chars output of any number the writer prints
+constexpr size_t kMaxNumberChars = 32;
+
+template <typename T>
+inline char *write_number(char *p, T v)
+{
+    if constexpr (std::is_floating_point_v<T>) {
+        // What Python's json.dumps writes for these
+        if (std::isnan(v)) {
+            memcpy(p, "NaN", 3);
+            return p + 3;
+        }
+        if (std::isinf(v)) {
+            if (v < 0) {
+                memcpy(p, "-Infinity", 9);
+                return p + 9;
+            }
+            memcpy(p, "Infinity", 8);
+            return p + 8;
+        }
+    }
+    return std::to_chars(p, p + kMaxNumberChars, v).ptr;
+}
+
+template <typename T>
+struct is_vector : std::false_type
+{
+};
+
+template <typename T, typename A>
+struct is_vector<std::vector<T, A> > : std::true_type
+{
+};
+
+template <typename T>
+struct is_vector<cow_array<T> > : std::true_type
+{
+};
+
+template <typename T>
+struct is_string : std::false_type
+{
+};
+
+template <typename Traits, typename A>
+struct is_string<std::basic_string<char, Traits, A> > : std::true_type
+{
+};
+
+template <>
+struct is_string<interned_string> : std::true_type
+{
+};
+
+}
+
+/**
+ * Appends JSON to a std::string. Values written after key() are members of
+ * the enclosing object, the others elements of the enclosing array; commas
+ * are inserted as needed.
+ *
+ * value() takes numbers, strings and messages of every flavor but soa::,
+ * and std::vectors, cow_arrays and C arrays of them. Arrays of bytes
+ * (uint8_t, the LCM byte type) are written as base64 strings.
+ */
+class json_writer
+{
+    public:
+        explicit json_writer(std::string &out) : out_(out), comma_(false) {}
+
+        std::string &str() { return out_; }
+
+        void begin_object() { open('{'); }
+        void end_object() { close('}'); }
+        void begin_array() { open('['); }
+        void end_array() { close(']'); }
+
+        /**
+         * Start an object member named @p name; its value comes next.
+         */
+        void key(std::string_view name)
+        {
+            separate();
+            quoted(name);
+            out_ += ':';
+            comma_ = false;
+        }
+
+        void null()
+        {
+            separate();
+            out_ += "null";
+        }
+
+        void boolean(bool v)
+        {
+            separate();
+            out_ += v ? "true" : "false";
+        }
+
+        void string(std::string_view s)
+        {
+            separate();
+            quoted(s);
+        }
+
+        /**
+         * Write @p n bytes at @p data as a base64 string.
+         */
+        void base64(const void *data, size_t n)
+        {
+            separate();
+            size_t pos = out_.size();
+            grow(base64_encoded_size(n) + 2);
+            out_.resize(pos + 1 + base64_encoded_size(n));
+            out_[pos] = '"';
+            base64_encode(&out_[pos + 1], data, n);
+            out_ += '"';
+        }
+
+        template <typename T>
+        void value(const T &v)
+        {
+            if constexpr (std::is_arithmetic_v<T>) {
+                separate();
+                char buf[detail::kMaxNumberChars];
+                out_.append(buf, detail::write_number(buf, v) - buf);
+            } else if constexpr (detail::is_string<T>::value) {
+                string(std::string_view(v.data(), v.size()));
+            } else if constexpr (detail::is_vector<T>::value) {
+                array(v.data(), v.size());
+            } else {
+                static_assert(is_message_v<T>, "json_writer::value() needs a number, string, array or message");
+                message(v);
+            }
+        }
+
+        template <typename T, size_t N>
+        void value(const T (&v)[N])
+        {
+            array(v, N);
+        }
+
+        /**
+         * Write @p n elements at @p data as a JSON array, or as a base64
+         * string if they are bytes.
+         */
+        template <typename T>
+        void array(const T *data, size_t n)
+        {
+            if constexpr (std::is_same_v<T, uint8_t>) {
+                base64(data, n);
+            } else if constexpr (std::is_arithmetic_v<T>) {
+                // Size the output for the longest numbers once, then trim
+                separate();
+                size_t pos = out_.size();
+                grow(2 + n * (detail::kMaxNumberChars + 1));
+                out_.resize(pos + 2 + n * (detail::kMaxNumberChars + 1));
+                char *p = &out_[pos];
+                *p++ = '[';
+                for (size_t i = 0; i < n; i++) {
+                    if (i)
+                        *p++ = ',';
+                    p = detail::write_number(p, data[i]);
+                }
+                *p++ = ']';
+                out_.resize(p - out_.data());
+            } else {
+                begin_array();
+                for (size_t i = 0; i < n; i++)
+                    value(data[i]);
+                end_array();
+            }
+        }
+
+        /**
+         * Write a message as an object of its fields, leaving out array
+         * length fields and writing boolean fields as true/false.
+         */
+        template <typename Msg>
+        void message(const Msg &msg)
+        {
+            static_assert(Msg::kFields.size() <= 64, "field masks hold 64 fields");
+            begin_object();
+            field_visitor<Msg> visitor{*this};
+            for_each_field(msg, visitor);
+            end_object();
+        }
+
+    private:
+        template <typename Msg>
+        struct field_visitor
+        {
+            json_writer &w;
+
+            template <typename T>
+            void operator()(const field_info &field, const T &member)
+            {
+                static constexpr uint64_t skipped = detail::json_length_fields<Msg>();
+                static constexpr uint64_t booleans = detail::json_boolean_fields<Msg>();
+                uint64_t bit = 1ULL << (&field - Msg::kFields.data());
+                if (skipped & bit)
+                    return;
+                w.key(field.name);
+                if (booleans & bit)
+                    w.booleans(member);
+                else
+                    w.value(member);
+            }
+        };
+
+        // The visitor picks boolean fields at run time, so this is compiled
+        // for every member type but only called with int8_t and arrays of it
+        template <typename T>
+        void booleans(const T &v)
+        {
+            if constexpr (std::is_same_v<T, int8_t>) {
+                boolean(v != 0);
+            } else if constexpr (detail::is_vector<T>::value || std::is_array_v<T>) {
+                begin_array();
+                for (const auto &b : v)
+                    booleans(b);
+                end_array();
+            } else {
+                value(v);
+            }
+        }
+
+        void quoted(std::string_view s)
+        {
+            out_ += '"';
+            const char *p = s.data(), *end = p + s.size(), *run = p;
+            for (; p != end; p++) {
+                unsigned char c = static_cast<unsigned char>(*p);
+                if (c >= 0x20 && c != '"' && c != '\\')
+                    continue;
+                out_.append(run, p - run);
+                run = p + 1;
+                escape(c);
+            }
+            out_.append(run, end - run);
+            out_ += '"';
+        }
+
+        void escape(unsigned char c)
+        {
+            static const char hex[] = "0123456789abcdef";
+            out_ += '\\';
+            switch (c) {
+                case '"': out_ += '"'; break;
+                case '\\': out_ += '\\'; break;
+                case '\n': out_ += 'n'; break;
+                case '\r': out_ += 'r'; break;
+                case '\t': out_ += 't'; break;
+                case '\b': out_ += 'b'; break;
+                case '\f': out_ += 'f'; break;
+                default:
+                    out_ += "u00";
+                    out_ += hex[c >> 4];
+                    out_ += hex[c & 15];
+            }
+        }
+
+        // Make room for @p n more characters, plus some for the fields after
+        // them, so a large payload is not copied again to append a few bytes
+        void grow(size_t n)
+        {
+            if (out_.capacity() - out_.size() < n)
+                out_.reserve(out_.size() + n + 256);
+        }
+
+        void separate()
+        {
+            if (comma_)
+                out_ += ',';
+            comma_ = true;
+        }
+
+        void open(char c)
+        {
+            separate();
+            out_ += c;
+            comma_ = false;
+        }
+
+        void close(char c)
+        {
+            out_ += c;
+            comma_ = true;
+        }
+
+        std::string &out_;
+        bool comma_;
+};
+
+/**
+ * Append @p msg to @p out as JSON; see json_writer::message().
+ */
+template <typename Msg>
+inline void append_json(std::string &out, const Msg &msg)
+{
+    json_writer w(out);
+    w.message(msg);
+}
+
+template <typename Msg>
+inline std::string to_json(const Msg &msg)
+{
+    std::string out;
+    append_json(out, msg);
+    return out;
+}
+
+}
+
+#endif
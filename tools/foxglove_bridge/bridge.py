@@ -247,8 +247,12 @@ class FoxgloveBridge:
                 for topic_info, msg_dict, timestamp_ns in batched_messages:
                     try:
                         if self.server and topic_info and topic_info.channel_id is not None:
-                            # Convert the message to JSON
-                            json_data = json.dumps(msg_dict).encode("utf-8")
+                            # Convert the message to JSON, unless the native
+                            # encoder already did
+                            if isinstance(msg_dict, bytes):
+                                json_data = msg_dict
+                            else:
+                                json_data = json.dumps(msg_dict).encode("utf-8")
 
                             # Send to Foxglove
                             await self.server.send_message(
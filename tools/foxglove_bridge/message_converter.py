@@ -12,6 +12,13 @@ from .config import logger
 from .models import TopicInfo
 from turbojpeg import TurboJPEG
 
+try:
+    # Native JSON encoder built from lcm_json.cpp (see README.md); without it
+    # every message goes through the Python converters below
+    from . import lcm_json
+except ImportError:
+    lcm_json = None
+
 
 class MessageConverter:
     """Handles conversion of LCM messages to JSON format for Foxglove"""
@@ -27,6 +34,18 @@ class MessageConverter:
             "sensor_msgs.pointcloud2": self._format_pointcloud2_msg,
             "sensor_msgs.PointCloud2": self._format_pointcloud2_msg,
         }
+        # Native encoders for the types above whose Foxglove format it
+        # reproduces; the rest of them stay in Python. Types without a
+        # specialized converter use lcm_json.encode.
+        self.native_encoders: Dict[str, Callable] = {}
+        if lcm_json is not None:
+            self.native_encoders = {
+                "sensor_msgs.image": lcm_json.encode_image,
+                "sensor_msgs.pointcloud2": lcm_json.encode_pointcloud2,
+                "sensor_msgs.jointstate": lcm_json.encode,
+                "tf2_msgs.tfmessage": lcm_json.encode,
+            }
+        self.specialized_types = {schema_type.lower() for schema_type in self.conversion_methods}
         # Cache for previously converted messages
         self.conversion_cache: Dict[str, Any] = {}
         # Stats for conversion timing
@@ -69,6 +88,24 @@ class MessageConverter:
             logger.error(f"Error in converter for {topic_info.schema_type}, falling back to generic: {e}")
             return self._lcm_to_dict(msg)
 
+    def encode_json(self, topic_info: TopicInfo, data: bytes) -> Optional[bytes]:
+        """Encode an LCM-encoded message straight to Foxglove JSON with the
+        native encoder. Returns None if it is not built or leaves this message
+        to convert_message()"""
+        if lcm_json is None:
+            return None
+        schema_type_lower = topic_info.schema_type.lower()
+        encoder = self.native_encoders.get(schema_type_lower)
+        if encoder is None:
+            if schema_type_lower in self.specialized_types:
+                return None
+            encoder = lcm_json.encode
+        try:
+            return encoder(data)
+        except ValueError as e:
+            logger.debug(f"Native JSON encoding failed for {topic_info.schema_type}: {e}")
+            return None
+
     def _lcm_to_dict(self, msg: Any) -> Any:
         """Convert an LCM message to a dictionary"""
         if isinstance(msg, (int, float, bool, str, type(None))):
@@ -148,8 +148,6 @@ class MessageProcessor:
             # Try to decode and convert the message
             if topic_info.lcm_class:
                 try:
-                    msg = topic_info.lcm_class.lcm_decode(data)
-
                     # Check message caching
                     should_process = True
                     if topic_info.is_high_frequency:
@@ -161,8 +159,12 @@ class MessageProcessor:
                             topic_info.cache_hash = msg_hash
 
                     if should_process:
-                        # Convert the message to dict format for Foxglove
-                        msg_dict = self.converter.convert_message(topic_info, msg)
+                        # Encode the message to JSON natively if possible, else
+                        # decode it and convert it to dict format for Foxglove
+                        msg_dict = self.converter.encode_json(topic_info, data)
+                        if msg_dict is None:
+                            msg = topic_info.lcm_class.lcm_decode(data)
+                            msg_dict = self.converter.convert_message(topic_info, msg)
 
                         # Update topic info
                         topic_info.last_sent_timestamp = now